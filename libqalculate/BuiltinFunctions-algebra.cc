@@ -85,6 +85,8 @@ int SumFunction::calculate(MathStructure &mstruct, const MathStructure &vargs, c
 	eo2.expand = eo.expand;
 	mstruct.clear();
 	MathStructure mstruct_calc;
+	CompiledExpression mcomp(m1, vargs[3], eo2);
+	Number nr_calc;
 	bool started = false;
 	while(i_nr.isLessThanOrEqualTo(vargs[2].number())) {
 		if(CALCULATOR->aborted()) {
@@ -97,9 +99,13 @@ int SumFunction::calculate(MathStructure &mstruct, const MathStructure &vargs, c
 				break;
 			}
 		}
-		mstruct_calc.set(m1);
-		mstruct_calc.replace(vargs[3], i_nr);
-		mstruct_calc.eval(eo2);
+		if(mcomp.calculateNumber(i_nr, nr_calc)) {
+			mstruct_calc.set(nr_calc);
+		} else {
+			mstruct_calc.set(m1);
+			mstruct_calc.replace(vargs[3], i_nr);
+			mstruct_calc.eval(eo2);
+		}
 		if(started) {
 			mstruct.calculateAdd(mstruct_calc, eo2);
 		} else {
@@ -171,6 +177,8 @@ int ProductFunction::calculate(MathStructure &mstruct, const MathStructure &varg
 	eo2.expand = eo.expand;
 	mstruct.clear();
 	MathStructure mstruct_calc;
+	CompiledExpression mcomp(m1, vargs[3], eo2);
+	Number nr_calc;
 	bool started = false;
 	while(i_nr.isLessThanOrEqualTo(vargs[2].number())) {
 		if(CALCULATOR->aborted()) {
@@ -183,9 +191,13 @@ int ProductFunction::calculate(MathStructure &mstruct, const MathStructure &varg
 				break;
 			}
 		}
-		mstruct_calc.set(m1);
-		mstruct_calc.replace(vargs[3], i_nr);
-		mstruct_calc.eval(eo2);
+		if(mcomp.calculateNumber(i_nr, nr_calc)) {
+			mstruct_calc.set(nr_calc);
+		} else {
+			mstruct_calc.set(m1);
+			mstruct_calc.replace(vargs[3], i_nr);
+			mstruct_calc.eval(eo2);
+		}
 		if(started) {
 			mstruct.calculateMultiply(mstruct_calc, eo2);
 		} else {
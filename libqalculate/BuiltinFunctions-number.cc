@@ -25,6 +25,7 @@
 #include <limits>
 #include <math.h>
 #include <algorithm>
+#include <bitset>
 
 #include "MathStructure-support.h"
 
@@ -446,10 +447,100 @@ int DivisorsFunction::calculate(MathStructure &mstruct, const MathStructure &var
 
 #include "primes.h"
 
+#define PRIME_SIEVE_SEGMENT_SIZE 131072
+
+// Segmented sieve of Eratosthenes, for iteration over the primes between low and high. Only odd numbers are stored in the segment.
+class PrimeSieve {
+  protected:
+	unsigned long long int i_high, i_segment_low;
+	size_t i_pos;
+	bool b_two;
+	vector<unsigned long long int> base_primes, next_multiples;
+	vector<char> segment;
+	void sieveSegment() {
+		std::fill(segment.begin(), segment.end(), 1);
+		unsigned long long int i_segment_high = i_segment_low + 2 * PRIME_SIEVE_SEGMENT_SIZE;
+		for(size_t i = 0; i < base_primes.size(); i++) {
+			unsigned long long int p = base_primes[i], m = next_multiples[i];
+			for(; m < i_segment_high; m += 2 * p) segment[(m - i_segment_low) / 2] = 0;
+			next_multiples[i] = m;
+		}
+		if(i_segment_low == 1) segment[0] = 0;
+		i_pos = 0;
+	}
+  public:
+	PrimeSieve(unsigned long long int low, unsigned long long int high) : i_high(high), segment(PRIME_SIEVE_SEGMENT_SIZE) {
+		b_two = (low <= 2 && high >= 2);
+		i_segment_low = (low < 3 ? 1 : (low % 2 == 0 ? low + 1 : low));
+		unsigned long long int i_sqrt = (unsigned long long int) ::sqrtl(high);
+		while(i_sqrt * i_sqrt > high) i_sqrt--;
+		while((i_sqrt + 1) * (i_sqrt + 1) <= high) i_sqrt++;
+		vector<char> is_composite(i_sqrt + 1, 0);
+		for(unsigned long long int p = 3; p <= i_sqrt; p += 2) {
+			if(is_composite[p]) continue;
+			for(unsigned long long int m = p * p; m <= i_sqrt; m += 2 * p) is_composite[m] = 1;
+			base_primes.push_back(p);
+			// first odd multiple which is not less than p^2 and i_segment_low
+			unsigned long long int m = p * p;
+			if(m < i_segment_low) {
+				m = ((i_segment_low + p - 1) / p) * p;
+				if(m % 2 == 0) m += p;
+			}
+			next_multiples.push_back(m);
+		}
+		sieveSegment();
+	}
+	// Returns the next prime, or zero if the end of the range has been reached
+	unsigned long long int next() {
+		if(b_two) {
+			b_two = false;
+			return 2;
+		}
+		while(true) {
+			for(; i_pos < PRIME_SIEVE_SEGMENT_SIZE; i_pos++) {
+				if(segment[i_pos]) {
+					unsigned long long int p = i_segment_low + 2 * i_pos;
+					i_pos++;
+					if(p > i_high) return 0;
+					return p;
+				}
+			}
+			i_segment_low += 2 * PRIME_SIEVE_SEGMENT_SIZE;
+			if(i_segment_low > i_high) return 0;
+			sieveSegment();
+		}
+	}
+};
+
+vector<long int> generate_primes_l() {
+	vector<long int> primes_l;
+	primes_l.reserve(NR_OF_PRIMES_L);
+	PrimeSieve sieve(2, LAST_PRIME_L);
+	unsigned long long int p;
+	while((p = sieve.next()) != 0) primes_l.push_back((long int) p);
+	return primes_l;
+}
+const long int *get_primes_l() {
+	// initialization of static local variables is thread safe
+	static const vector<long int> primes_l = generate_primes_l();
+	return &primes_l[0];
+}
+
+Number ullint_to_number(unsigned long long int v) {
+	if(v > LONG_MAX) {
+		Number nr((long int) (v / LONG_MAX), 1L, 0L);
+		nr *= LONG_MAX;
+		nr += (long int) (v % LONG_MAX);
+		return nr;
+	}
+	return Number((long int) v, 1L, 0L);
+}
+
+
 PrimesFunction::PrimesFunction() : MathFunction("primes", 1) {
 	NumberArgument *iarg = new NumberArgument();
 	iarg->setMin(&nr_one);
-	Number nmax(PRIMES_L[NR_OF_PRIMES_L - 1]);
+	Number nmax(LAST_PRIME_L, 1L, 0L);
 	iarg->setMax(&nmax);
 	iarg->setHandleVector(false);
 	setArgumentDefinition(1, iarg);
@@ -459,10 +550,10 @@ int PrimesFunction::calculate(MathStructure &mstruct, const MathStructure &vargs
 	nr.floor();
 	if(!nr.isInteger()) return 0;
 	mstruct.clearVector();
-	long int v = nr.intValue();
-	for(size_t i = 0; i < NR_OF_PRIMES_L; i++) {
-		if(PRIMES_L[i] > v) break;
-		mstruct.addChild_nocopy(new MathStructure(PRIMES_L[i], 1L, 0L));
+	PrimeSieve sieve(2, nr.lintValue());
+	unsigned long long int p;
+	while((p = sieve.next()) != 0) {
+		mstruct.addChild_nocopy(new MathStructure((long int) p, 1L, 0L));
 	}
 	return 1;
 }
@@ -494,25 +585,19 @@ int NthPrimeFunction::calculate(MathStructure &mstruct, const MathStructure &var
 	l10.divide(100000L);
 	l10.floor();
 	if(l10 <= PRIME_M_COUNT) {
-		Number n(l10.lintValue(), 1, 5);
-		mpz_t i;
-		mpz_init(i);
-		if(PRIME_M[l10.lintValue() - 1] > LONG_MAX) {
-			mpz_set_si(i, (long int) (PRIME_M[l10.lintValue() - 1] / ULONG_MAX));
-			mpz_mul_si(i, i, LONG_MAX);
-			mpz_add_ui(i, i, (unsigned long int) (PRIME_M[l10.lintValue() - 1] % LONG_MAX));
-		} else {
-			mpz_set_si(i, (long int) PRIME_M[l10.lintValue() - 1]);
-		}
-		while(n < vargs[0].number()) {
-			if(CALCULATOR->aborted()) {mpz_clear(i); return 0;}
-			n++;
-			mpz_nextprime(i, i);
+		// count primes after the closest preceding tabulated prime
+		long int n = vargs[0].number().lintValue() - l10.lintValue() * 100000L;
+		unsigned long long int p = PRIME_M[l10.lintValue() - 1];
+		while(n > 0) {
+			if(CALCULATOR->aborted()) return 0;
+			PrimeSieve sieve(p + 1, p + 100 * PRIME_SIEVE_SEGMENT_SIZE);
+			unsigned long long int p2;
+			while(n > 0 && (p2 = sieve.next()) != 0) {
+				p = p2;
+				n--;
+			}
 		}
-		Number nr;
-		nr.setInternal(i);
-		mstruct = nr;
-		mpz_clear(i);
+		mstruct = ullint_to_number(p);
 		return 1;
 	}
 	return 0;
@@ -671,57 +756,105 @@ int FactorsFunction::calculate(MathStructure &mstruct, const MathStructure &varg
 	return 1;
 }
 
-unordered_map<long long int, unordered_map<long long int, long long int>> primecount_cache;
+// Prime counting function for values up to limit, using a bit array of odd numbers with the number of primes before each 64-bit word
+class PrimePiTable {
+  protected:
+	unsigned long long int i_limit;
+	vector<unsigned long long int> bits, counts;
+  public:
+	PrimePiTable(unsigned long long int limit) : i_limit(limit), bits(limit / 128 + 1, 0), counts(limit / 128 + 1, 0) {
+		PrimeSieve sieve(3, limit);
+		unsigned long long int p;
+		while((p = sieve.next()) != 0) {
+			if(p % 32768 == 1 && CALCULATOR->aborted()) break;
+			bits[p / 128] |= 1ULL << ((p / 2) % 64);
+		}
+		unsigned long long int n = 1;
+		for(size_t i = 0; i < bits.size(); i++) {
+			counts[i] = n;
+			n += std::bitset<64>(bits[i]).count();
+		}
+	}
+	unsigned long long int limit() const {return i_limit;}
+	long long int pi(unsigned long long int x) const {
+		if(x < 2) return 0;
+		unsigned long long int i = (x - 1) / 2;
+		unsigned long long int mask = (i % 64 == 63 ? ~0ULL : (1ULL << (i % 64 + 1)) - 1);
+		return counts[i / 64] + std::bitset<64>(bits[i / 64] & mask).count();
+	}
+};
 
-long long int primecount_phi(long long int x, long long int a) {
-	unordered_map<long long int, unordered_map<long long int, long long int>>::iterator it = primecount_cache.find(x);
-	if(it != primecount_cache.end()) {
-		unordered_map<long long int, long long int>::iterator it2 = it->second.find(a);
-		if(it2 != it->second.end()) return it2->second;
-	}
-	if(a == 1) {
-		return (x + 1) / 2;
-	}
-	long long int v = primecount_phi(x, a - 1) - primecount_phi(x / PRIMES_L[a - 1], a - 1);
-	primecount_cache[x][a] = v;
-	return v;
-}
+#define PHI_SMALL_A 6
+#define PHI_SMALL_PRODUCT 30030
 
-long long int primecount(long long int x) {
-	if(x == 2) return 1;
-	if(x < 2) return 0;
-	if(x <= PRIMES_L[NR_OF_PRIMES_L - 1]) {
-		long int prime_i = NR_OF_PRIMES_L;
-		long int step = prime_i / 2;
-		while(x != PRIMES_L[prime_i - 1]) {
-			if(x < PRIMES_L[prime_i - 1]) {
-				prime_i -= step;
-				if(step == 1 && x > PRIMES_L[prime_i - 1]) break;
-			} else {
-				prime_i += step;
+// Legendre's phi(x, a) (the number of integers <= x which are not divisible by any of the first a primes)
+class PrimeCounter {
+  protected:
+	PrimePiTable pi_table;
+	vector<long long int> primes;
+	vector<vector<int> > phi_small;
+	long long int phi(long long int x, long long int a) {
+		if(a <= PHI_SMALL_A) return (x / PHI_SMALL_PRODUCT) * phi_small[a][PHI_SMALL_PRODUCT - 1] + phi_small[a][x % PHI_SMALL_PRODUCT];
+		if((unsigned long long int) x <= pi_table.limit() && x < primes[a] * primes[a]) {
+			long long int n = pi_table.pi(x);
+			return n >= a ? n - a + 1 : 1;
+		}
+		// phi(x, a) = phi(x, a - 1) - phi(x / p_a, a - 1)
+		long long int sum = phi(x, PHI_SMALL_A);
+		for(long long int i = PHI_SMALL_A + 1; i <= a; i++) {
+			long long int w = x / primes[i - 1];
+			if(w < primes[i - 1]) {
+				// phi(w, i - 1) = 1 for the remaining terms
+				sum -= a - i + 1;
+				break;
 			}
-			if(step != 1) step /= 2;
-		}
-		return prime_i;
-	}
-	if(CALCULATOR->aborted()) return 0;
-	long long int a = primecount(::sqrt(sqrt(x)));
-	long long int b = primecount(::sqrt(x));
-	long long int c = primecount(::cbrt(x));
-	long long int sum = primecount_phi(x, a) + ((b + a - 2) * (b - a + 1) / 2);
-	for(long int i = a + 1; i <= b; i++) {
+			sum -= phi(w, i - 1);
+		}
+		return sum;
+	}
+  public:
+	PrimeCounter(long long int x) : pi_table((unsigned long long int) ::cbrtl(x) * (unsigned long long int) ::cbrtl(x) + 1000) {
+		// include at least one prime larger than sqrt(x), and the primes used for phi_small
+		unsigned long long int i_sqrt = (unsigned long long int) ::sqrtl(x) + 1;
+		PrimeSieve sieve(2, i_sqrt < 50 ? 100 : i_sqrt * 2);
+		unsigned long long int p;
+		while((p = sieve.next()) != 0) primes.push_back(p);
+		// phi_small[a][x] = phi(x, a) for x < 2*3*5*7*11*13
+		phi_small.resize(PHI_SMALL_A + 1);
+		phi_small[0].resize(PHI_SMALL_PRODUCT);
+		for(int i = 0; i < PHI_SMALL_PRODUCT; i++) phi_small[0][i] = i;
+		for(int a = 1; a <= PHI_SMALL_A; a++) {
+			phi_small[a] = phi_small[a - 1];
+			for(int i = 0; i < PHI_SMALL_PRODUCT; i++) phi_small[a][i] -= phi_small[a - 1][i / primes[a - 1]];
+		}
+	}
+	// Lehmer's formula
+	long long int pi(long long int x) {
+		if((unsigned long long int) x <= pi_table.limit()) return pi_table.pi(x);
 		if(CALCULATOR->aborted()) return 0;
-		long long int w = x / PRIMES_L[i - 1];
-		long long int lim = primecount(::sqrt(w));
-		sum -= primecount(w);
-		if(i <= c) {
-			for(long long int i2 = i; i2 <= lim; i2++) {
-				if(CALCULATOR->aborted()) return 0;
-				sum -= primecount(w / PRIMES_L[i2 - 1]) - i2 + 1;
+		long long int a = pi(::sqrtl(::sqrtl(x)));
+		long long int b = pi(::sqrtl(x));
+		long long int c = pi(::cbrtl(x));
+		long long int sum = phi(x, a) + ((b + a - 2) * (b - a + 1) / 2);
+		for(long long int i = a + 1; i <= b; i++) {
+			if(CALCULATOR->aborted()) return 0;
+			long long int w = x / primes[i - 1];
+			sum -= pi(w);
+			if(i <= c) {
+				long long int lim = pi(::sqrtl(w));
+				for(long long int i2 = i; i2 <= lim; i2++) {
+					sum -= pi(w / primes[i2 - 1]) - i2 + 1;
+				}
 			}
 		}
+		return sum;
 	}
-	return sum;
+};
+
+long long int primecount(long long int x) {
+	if(x < 2) return 0;
+	PrimeCounter counter(x);
+	return counter.pi(x);
 }
 
 PrimeCountFunction::PrimeCountFunction() : MathFunction("primePi", 1) {
@@ -734,14 +867,7 @@ int PrimeCountFunction::calculate(MathStructure &mstruct, const MathStructure &v
 	if(nr.integerLength() < 41) {
 		long long int v = primecount(nr.llintValue());
 		if(CALCULATOR->aborted()) return 0;
-		if(v > LONG_MAX) {
-			nr.set(v / LONG_MAX);
-			nr *= LONG_MAX;
-			nr += (v % LONG_MAX);
-			mstruct = nr;
-		} else {
-			mstruct = Number((long int) v, 1L, 0L);
-		}
+		mstruct = ullint_to_number(v);
 		return 1;
 	}
 	if(eo.approximation == APPROXIMATION_EXACT) return 0;
@@ -1377,48 +1503,21 @@ TotientFunction::TotientFunction() : MathFunction("totient", 1, 1) {
 int TotientFunction::calculate(MathStructure &mstruct, const MathStructure &vargs, const EvaluationOptions&) {
 	if(vargs[0].number().isZero()) {mstruct.clear(); return 1;}
 	if(vargs[0].number() <= 2 && vargs[0].number() >= -2) {mstruct.set(1, 1, 0); return 1;}
-	mpz_t n, result, tmp, p_square, p;
-	mpz_inits(n, result, tmp, p_square, p, NULL);
-	mpz_set(n, mpq_numref(vargs[0].number().internalRational()));
-	mpz_abs(n, n);
-	mpz_set(result, n);
-	size_t i = 0;
-	while(true) {
-		if(CALCULATOR->aborted()) {mpz_clears(n, result, tmp, p, p_square, NULL); return 0;}
-		if(i < NR_OF_PRIMES) {
-			if(i < NR_OF_SQUARE_PRIMES) {
-				if(mpz_cmp_si(n, SQUARE_PRIMES[i]) < 0) break;
-			} else {
-				mpz_ui_pow_ui(p_square, PRIMES[i], 2);
-				if(mpz_cmp(n, p_square) < 0) break;
-			}
-			if(mpz_divisible_ui_p(n, PRIMES[i])) {
-				mpz_divexact_ui(n, n, PRIMES[i]);
-				while(mpz_divisible_ui_p(n, PRIMES[i])) mpz_divexact_ui(n, n, PRIMES[i]);
-				mpz_divexact_ui(tmp, result, PRIMES[i]);
-				mpz_sub(result, result, tmp);
-			}
-			i++;
-		} else {
-			if(i == NR_OF_PRIMES) {mpz_set_si(p, PRIMES[i - 1]); i++;}
-			mpz_add_ui(p, p, 2);
-			mpz_pow_ui(p_square, p, 2);
-			if(mpz_cmp(n, p_square) < 0) break;
-			if(mpz_divisible_p(n, p)) {
-				mpz_divexact(n, n, p);
-				while(mpz_divisible_p(n, p)) mpz_divexact(n, n, p);
-				mpz_divexact(tmp, result, p);
-				mpz_sub(result, result, tmp);
-			}
-		}
-	}
-	if(mpz_cmp_ui(n, 1) > 0) {
-		mpz_divexact(tmp, result, n);
+	Number nr(vargs[0].number());
+	nr.abs();
+	vector<Number> factors;
+	if(!nr.factorize(factors)) return 0;
+	mpz_t result, tmp;
+	mpz_inits(result, tmp, NULL);
+	mpz_set(result, mpq_numref(nr.internalRational()));
+	for(size_t i = 0; i < factors.size(); i++) {
+		if(i > 0 && factors[i] == factors[i - 1]) continue;
+		mpz_divexact(tmp, result, mpq_numref(factors[i].internalRational()));
 		mpz_sub(result, result, tmp);
 	}
 	mstruct.clear();
 	mstruct.number().setInternal(result);
-	mpz_clears(n, result, tmp, p, p_square, NULL);
+	mpz_clears(result, tmp, NULL);
 	return 1;
 }
 
@@ -42,6 +42,7 @@ using std::vector;
 using std::endl;
 
 #include "Calculator_p.h"
+#include "MathStructure_p.h"
 
 void autoConvert(const MathStructure &morig, MathStructure &mconv, const EvaluationOptions &eo) {
 	if(!morig.containsType(STRUCT_UNIT, true)) {
@@ -137,30 +138,30 @@ void Calculator::saveState() {
 void Calculator::restoreState() {
 }
 void Calculator::clearBuffers() {
-	unordered_map<size_t, bool>::iterator it = priv->ids_p.begin();
-	while(it != priv->ids_p.end()) {
+	unordered_map<size_t, bool>::iterator it = CONTEXT->ids_p.begin();
+	while(it != CONTEXT->ids_p.end()) {
 		if(!it->second) {
-			priv->freed_ids.push_back(it->first);
-			priv->id_structs.erase(it->first);
-			priv->ids_ref.erase(it->first);
-			priv->ids_p.erase(it);
+			CONTEXT->freed_ids.push_back(it->first);
+			CONTEXT->id_structs.erase(it->first);
+			CONTEXT->ids_ref.erase(it->first);
+			CONTEXT->ids_p.erase(it);
 		} else {
 			++it;
 		}
 	}
-	if(priv->id_structs.empty()) {
-		priv->ids_i = 0;
-		priv->freed_ids.clear();
+	if(CONTEXT->id_structs.empty()) {
+		CONTEXT->ids_i = 0;
+		CONTEXT->freed_ids.clear();
 	}
 }
 bool Calculator::abort() {
-	i_aborted = 1;
+	CONTEXT->i_aborted = 1;
 	if(!b_busy) return true;
 	if(!calculate_thread->running) {
 		b_busy = false;
 	} else {
 		// wait 5 seconds for clean abortation
-		long int time = 5000 + (::cbrt(i_precision) * 1000);
+		long int time = 5000 + (::cbrt(CONTEXT->i_precision) * 1000);
 		if(time > 100000) time = 100000;
 		PREPARE_TIMECHECK(time)
 		for(int i = 0; b_busy && i < time; i++) {
@@ -174,18 +175,18 @@ bool Calculator::abort() {
 			stopControl();
 
 			// clean up
-			stopped_messages_count.clear();
-			stopped_warnings_count.clear();
-			stopped_errors_count.clear();
-			stopped_messages.clear();
-			disable_errors_ref = 0;
-			i_stop_interval = 0;
-			i_start_interval = 0;
+			CONTEXT->stopped_messages_count.clear();
+			CONTEXT->stopped_warnings_count.clear();
+			CONTEXT->stopped_errors_count.clear();
+			CONTEXT->stopped_messages.clear();
+			CONTEXT->disable_errors_ref = 0;
+			CONTEXT->i_stop_interval = 0;
+			CONTEXT->i_start_interval = 0;
 			if(tmp_rpn_mstruct) tmp_rpn_mstruct->unref();
 			tmp_rpn_mstruct = NULL;
 
 			// thread cancellation is not safe
-			if(i_precision > 10000) {
+			if(CONTEXT->i_precision > 10000) {
 				error(true, _("The calculation has been forcibly terminated. Please restart the application."), NULL);
 			} else {
 				error(true, _("The calculation has been forcibly terminated. Please restart the application and report this as a bug."), NULL);
@@ -210,6 +211,22 @@ void Calculator::terminateThreads() {
 		if(calculate_thread->running) calculate_thread->cancel();
 	}
 }
+bool Calculator::beginThreadContext() {
+	if(calculator_thread_context) return false;
+	calculator_thread_context = new CalculatorContext();
+	calculator_thread_context->b_interval = priv->context.b_interval;
+	// also sets the default precision of MPFR, which is thread specific
+	setPrecision(priv->context.i_precision);
+	return true;
+}
+void Calculator::endThreadContext() {
+	if(!calculator_thread_context) return;
+	priv->timer.remove(calculator_thread_context);
+	delete calculator_thread_context;
+	calculator_thread_context = NULL;
+	mpfr_free_cache();
+	clear_node_pools();
+}
 bool Calculator::calculateRPNRegister(size_t index, int msecs, const EvaluationOptions &eo) {
 	if(index <= 0 || index > rpn_stack.size()) return false;
 	return calculateRPN(new MathStructure(*rpn_stack[rpn_stack.size() - index]), PROC_RPN_SET, index, msecs, eo);
@@ -374,7 +391,7 @@ bool Calculator::calculateRPNLogicalNot(int msecs, const EvaluationOptions &eo,
 	return calculateRPN(mstruct, PROC_RPN_OPERATION_1, 0, msecs, eo);
 }
 MathStructure *Calculator::calculateRPN(MathOperation op, const EvaluationOptions &eo, MathStructure *parsed_struct) {
-	current_stage = MESSAGE_STAGE_PARSING;
+	CONTEXT->current_stage = MESSAGE_STAGE_PARSING;
 	MathStructure *mstruct;
 	if(rpn_stack.size() == 0) {
 		mstruct = new MathStructure();
@@ -409,11 +426,11 @@ MathStructure *Calculator::calculateRPN(MathOperation op, const EvaluationOption
 		mstruct = new MathStructure(*rpn_stack[rpn_stack.size() - 2]);
 		mstruct->add(*rpn_stack.back(), op);
 	}
-	current_stage = MESSAGE_STAGE_CALCULATION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CALCULATION;
 	mstruct->eval(eo);
-	current_stage = MESSAGE_STAGE_CONVERSION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 	autoConvert(*mstruct, *mstruct, eo);
-	current_stage = MESSAGE_STAGE_UNSET;
+	CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 	if(rpn_stack.size() > 1) {
 		rpn_stack.back()->unref();
 		rpn_stack.erase(rpn_stack.begin() + (rpn_stack.size() - 1));
@@ -427,7 +444,7 @@ MathStructure *Calculator::calculateRPN(MathOperation op, const EvaluationOption
 	return rpn_stack.back();
 }
 MathStructure *Calculator::calculateRPN(MathFunction *f, const EvaluationOptions &eo, MathStructure *parsed_struct) {
-	current_stage = MESSAGE_STAGE_PARSING;
+	CONTEXT->current_stage = MESSAGE_STAGE_PARSING;
 	MathStructure *mstruct = new MathStructure(f, NULL);
 	size_t iregs = 0;
 	if(f->args() != 0) {
@@ -459,11 +476,11 @@ MathStructure *Calculator::calculateRPN(MathFunction *f, const EvaluationOptions
 		f->appendDefaultValues(*mstruct);
 	}
 	if(parsed_struct) parsed_struct->set(*mstruct);
-	current_stage = MESSAGE_STAGE_CALCULATION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CALCULATION;
 	mstruct->eval(eo);
-	current_stage = MESSAGE_STAGE_CONVERSION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 	autoConvert(*mstruct, *mstruct, eo);
-	current_stage = MESSAGE_STAGE_UNSET;
+	CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 	if(iregs == 0) {
 		rpn_stack.push_back(mstruct);
 	} else {
@@ -478,7 +495,7 @@ MathStructure *Calculator::calculateRPN(MathFunction *f, const EvaluationOptions
 	return rpn_stack.back();
 }
 MathStructure *Calculator::calculateRPNBitwiseNot(const EvaluationOptions &eo, MathStructure *parsed_struct) {
-	current_stage = MESSAGE_STAGE_PARSING;
+	CONTEXT->current_stage = MESSAGE_STAGE_PARSING;
 	MathStructure *mstruct;
 	if(rpn_stack.size() == 0) {
 		mstruct = new MathStructure();
@@ -488,11 +505,11 @@ MathStructure *Calculator::calculateRPNBitwiseNot(const EvaluationOptions &eo, M
 		mstruct->setBitwiseNot();
 	}
 	if(parsed_struct) parsed_struct->set(*mstruct);
-	current_stage = MESSAGE_STAGE_CALCULATION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CALCULATION;
 	mstruct->eval(eo);
-	current_stage = MESSAGE_STAGE_CONVERSION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 	autoConvert(*mstruct, *mstruct, eo);
-	current_stage = MESSAGE_STAGE_UNSET;
+	CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 	if(rpn_stack.size() == 0) {
 		rpn_stack.push_back(mstruct);
 	} else {
@@ -502,7 +519,7 @@ MathStructure *Calculator::calculateRPNBitwiseNot(const EvaluationOptions &eo, M
 	return rpn_stack.back();
 }
 MathStructure *Calculator::calculateRPNLogicalNot(const EvaluationOptions &eo, MathStructure *parsed_struct) {
-	current_stage = MESSAGE_STAGE_PARSING;
+	CONTEXT->current_stage = MESSAGE_STAGE_PARSING;
 	MathStructure *mstruct;
 	if(rpn_stack.size() == 0) {
 		mstruct = new MathStructure();
@@ -512,11 +529,11 @@ MathStructure *Calculator::calculateRPNLogicalNot(const EvaluationOptions &eo, M
 		mstruct->setLogicalNot();
 	}
 	if(parsed_struct) parsed_struct->set(*mstruct);
-	current_stage = MESSAGE_STAGE_CALCULATION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CALCULATION;
 	mstruct->eval(eo);
-	current_stage = MESSAGE_STAGE_CONVERSION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 	autoConvert(*mstruct, *mstruct, eo);
-	current_stage = MESSAGE_STAGE_UNSET;
+	CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 	if(rpn_stack.size() == 0) {
 		rpn_stack.push_back(mstruct);
 	} else {
@@ -538,11 +555,11 @@ bool Calculator::RPNStackEnter(string str, int msecs, const EvaluationOptions &e
 }
 void Calculator::RPNStackEnter(MathStructure *mstruct, bool eval, const EvaluationOptions &eo) {
 	if(eval) {
-		current_stage = MESSAGE_STAGE_CALCULATION;
+		CONTEXT->current_stage = MESSAGE_STAGE_CALCULATION;
 		mstruct->eval(eo);
-		current_stage = MESSAGE_STAGE_CONVERSION;
+		CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 		autoConvert(*mstruct, *mstruct, eo);
-		current_stage = MESSAGE_STAGE_UNSET;
+		CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 	}
 	rpn_stack.push_back(mstruct);
 }
@@ -569,11 +586,11 @@ void Calculator::setRPNRegister(size_t index, MathStructure *mstruct, bool eval,
 		return;
 	}
 	if(eval) {
-		current_stage = MESSAGE_STAGE_CALCULATION;
+		CONTEXT->current_stage = MESSAGE_STAGE_CALCULATION;
 		mstruct->eval(eo);
-		current_stage = MESSAGE_STAGE_CONVERSION;
+		CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 		autoConvert(*mstruct, *mstruct, eo);
-		current_stage = MESSAGE_STAGE_UNSET;
+		CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 	}
 	if(index <= 0 || index > rpn_stack.size()) return;
 	index = rpn_stack.size() - index;
@@ -1518,6 +1535,120 @@ bool contains_no_recalculate_exact_object(const MathStructure &m, int dual_appro
 	return false;
 }
 
+// maximum depth of user functions and variables referring to other functions and variables, checked by evaluation_cacheable_function()
+#define EVALUATION_CACHE_MAX_DEPTH 10
+
+bool evaluation_cacheable_function(MathFunction *f, int depth);
+bool evaluation_cacheable_variable(Variable *v, int depth);
+// checks the functions and variables named in a formula or expression
+bool evaluation_cacheable_formula(const string &formula, int depth) {
+	size_t i = 0;
+	while(i < formula.length()) {
+		i = formula.find_first_not_of(NOT_IN_NAMES NUMBERS, i);
+		if(i == string::npos) break;
+		size_t i2 = formula.find_first_of(NOT_IN_NAMES, i);
+		string name = formula.substr(i, i2 == string::npos ? string::npos : i2 - i);
+		MathFunction *f = CALCULATOR->getActiveFunction(name);
+		if(f && !evaluation_cacheable_function(f, depth + 1)) return false;
+		Variable *v = CALCULATOR->getActiveVariable(name);
+		if(v && !evaluation_cacheable_variable(v, depth + 1)) return false;
+		if(i2 == string::npos) break;
+		i = i2;
+	}
+	return true;
+}
+// random and time dependent functions, and functions with side effects, including user functions which use these functions
+bool evaluation_cacheable_function(MathFunction *f, int depth) {
+	if(depth > EVALUATION_CACHE_MAX_DEPTH) return false;
+	switch(f->id()) {
+		case FUNCTION_ID_RAND: {}
+		case FUNCTION_ID_RANDN: {}
+		case FUNCTION_ID_RAND_POISSON: {}
+		case FUNCTION_ID_TIME: {}
+		case FUNCTION_ID_SAVE: {}
+		case FUNCTION_ID_LOAD: {}
+		case FUNCTION_ID_EXPORT: {}
+		case FUNCTION_ID_PLOT: {}
+		case FUNCTION_ID_COMMAND: {return false;}
+	}
+	for(int i = 1; i <= f->maxargs() || i <= f->minargs() + 1; i++) {
+		const string &sdefault = f->getDefaultValue(i);
+		if(sdefault == "now" || sdefault == "today") return false;
+	}
+	if(f->subtype() == SUBTYPE_USER_FUNCTION) {
+		UserFunction *uf = (UserFunction*) f;
+		if(!evaluation_cacheable_formula(uf->formula(), depth)) return false;
+		for(size_t i = 1; i <= uf->countSubfunctions(); i++) {
+			if(!evaluation_cacheable_formula(uf->getSubfunction(i), depth)) return false;
+		}
+	}
+	return true;
+}
+// time dependent variables and variables with assigned values (which do not change the definitions generation), including variables with expressions which use these variables
+bool evaluation_cacheable_variable(Variable *v, int depth) {
+	if(depth > EVALUATION_CACHE_MAX_DEPTH) return false;
+	if(v->id() >= VARIABLE_ID_TODAY && v->id() <= VARIABLE_ID_UPTIME) return false;
+	if(v->isKnown() && v->id() == 0) {
+		if(!((KnownVariable*) v)->isExpression()) return false;
+		if(!evaluation_cacheable_formula(((KnownVariable*) v)->expression(), depth)) return false;
+	}
+	return true;
+}
+
+// checks if the result of the evaluation of the structure can be stored in the evaluation cache and appends assumptions of unknown variables to the key
+bool add_evaluation_cache_key(const MathStructure &m, string &key) {
+	if(m.isFunction()) {
+		if(!evaluation_cacheable_function(m.function(), 0)) return false;
+	} else if(m.isVariable()) {
+		if(!evaluation_cacheable_variable(m.variable(), 0)) return false;
+		if(!m.variable()->isKnown() && ((UnknownVariable*) m.variable())->assumptions()) {
+			Assumptions *ass = ((UnknownVariable*) m.variable())->assumptions();
+			if(ass->min() || ass->max() || !((UnknownVariable*) m.variable())->interval().isUndefined()) return false;
+			key += (char) ass->type();
+			key += (char) ass->sign();
+		}
+	} else if(m.isSymbolic()) {
+		if(equalsIgnoreCase(m.symbol(), "now") || equalsIgnoreCase(m.symbol(), "today") || equalsIgnoreCase(m.symbol(), "tomorrow") || equalsIgnoreCase(m.symbol(), "yesterday")) return false;
+	}
+	for(size_t i = 0; i < m.size(); i++) {
+		if(!add_evaluation_cache_key(m[i], key)) return false;
+	}
+	return true;
+}
+void Calculator::evalCached(MathStructure &mstruct, const EvaluationOptions &eo) {
+	if(priv->eval_cache.maxSize() == 0 || eo.isolate_var || CONTEXT->disable_errors_ref > 0 || contains_no_recalculate_exact_object(mstruct, 0)) {
+		mstruct.eval(eo);
+		return;
+	}
+	string key;
+	APPEND_CACHE_KEY(key, eo.approximation) APPEND_CACHE_KEY(key, eo.sync_units) APPEND_CACHE_KEY(key, eo.sync_nonlinear_unit_relations) APPEND_CACHE_KEY(key, eo.keep_prefixes)
+	APPEND_CACHE_KEY(key, eo.calculate_variables) APPEND_CACHE_KEY(key, eo.calculate_functions) APPEND_CACHE_KEY(key, eo.test_comparisons) APPEND_CACHE_KEY(key, eo.isolate_x)
+	APPEND_CACHE_KEY(key, eo.expand) APPEND_CACHE_KEY(key, eo.combine_divisions) APPEND_CACHE_KEY(key, eo.reduce_divisions) APPEND_CACHE_KEY(key, eo.allow_complex)
+	APPEND_CACHE_KEY(key, eo.allow_infinite) APPEND_CACHE_KEY(key, eo.assume_denominators_nonzero) APPEND_CACHE_KEY(key, eo.warn_about_denominators_assumed_nonzero) APPEND_CACHE_KEY(key, eo.split_squares)
+	APPEND_CACHE_KEY(key, eo.keep_zero_units) APPEND_CACHE_KEY(key, eo.auto_post_conversion) APPEND_CACHE_KEY(key, eo.mixed_units_conversion) APPEND_CACHE_KEY(key, eo.structuring)
+	APPEND_CACHE_KEY(key, eo.do_polynomial_division) APPEND_CACHE_KEY(key, (size_t) eo.protected_function) APPEND_CACHE_KEY(key, eo.complex_number_form) APPEND_CACHE_KEY(key, eo.local_currency_conversion)
+	APPEND_CACHE_KEY(key, eo.transform_trigonometric_functions) APPEND_CACHE_KEY(key, eo.interval_calculation)
+	append_parse_options_cache_key(key, eo.parse_options);
+	APPEND_CACHE_KEY(key, getPrecision()) APPEND_CACHE_KEY(key, usesIntervalArithmetic()) APPEND_CACHE_KEY(key, priv->temperature_calculation) APPEND_CACHE_KEY(key, default_assumptions->type())
+	APPEND_CACHE_KEY(key, default_assumptions->sign()) APPEND_CACHE_KEY(key, (size_t) priv->custom_angle_unit) APPEND_CACHE_KEY(key, priv->fixed_denominator) APPEND_CACHE_KEY(key, priv->simplified_percentage_used)
+	APPEND_CACHE_KEY(key, variableUnitsEnabled())
+	if(!add_evaluation_cache_key(mstruct, key)) {
+		mstruct.eval(eo);
+		return;
+	}
+	size_t hash = mstruct.structuralHash();
+	size_t generation = priv->definitions_generation;
+	// messages generated during the original calculation are added to the current messages
+	if(priv->eval_cache.get(hash, key, &mstruct, mstruct, &CONTEXT->messages, generation)) return;
+	MathStructure mkey(mstruct);
+	size_t n_messages = CONTEXT->messages.size();
+	mstruct.eval(eo);
+	if(aborted() || priv->definitions_generation != generation) return;
+	vector<CalculatorMessage> messages;
+	messages.insert(messages.end(), CONTEXT->messages.begin() + n_messages, CONTEXT->messages.end());
+	priv->eval_cache.add(hash, key, &mkey, mstruct, &messages, generation);
+}
+
 void calculate_dual_exact(MathStructure &mstruct_exact, MathStructure *mstruct, const string &original_expression, const MathStructure *parsed_mstruct, EvaluationOptions &evalops, AutomaticApproximation auto_approx, int msecs, int max_size) {
 	int dual_approximation = 0;
 	if(auto_approx == AUTOMATIC_APPROXIMATION_AUTO || auto_approx == AUTOMATIC_APPROXIMATION_SINGLE) dual_approximation = -1;
@@ -2220,7 +2351,7 @@ string Calculator::calculateAndPrint(string str, int msecs, const EvaluationOpti
 			sec = tv.tv_sec;
 			if(usec > 1000000L) {sec += usec / 1000000L; usec = usec % 1000000L;}
 #endif
-			if(sec > t_end.tv_sec || (sec == t_end.tv_sec && usec > t_end.tv_usec)) {
+			if(sec > CONTEXT->t_end.tv_sec || (sec == CONTEXT->t_end.tv_sec && usec > CONTEXT->t_end.tv_usec)) {
 				b = false;
 			}
 		}
@@ -3354,7 +3485,6 @@ void replace_unregistered_variables(MathStructure &m) {
 void Calculator::parseExpressionAndWhere(MathStructure *mstruct, MathStructure *mwhere, string str, string str_where, const ParseOptions &po) {
 	vector<Variable*> where_vars;
 	vector<bool> repeat;
-	vector<vector<size_t>::iterator> where_its;
 	vector<string> wheres;
 	mwhere->clear();
 	if(!str_where.empty()) {
@@ -3436,25 +3566,8 @@ void Calculator::parseExpressionAndWhere(MathStructure *mstruct, MathStructure *
 					}
 					if(v) {
 						repeat.push_back(false);
-						size_t l = sname.length() - 1;
-						if(l > UFV_LENGTHS) {
-							ufvl.insert(ufvl.begin(), (void*) v);
-							ufvl_t.insert(ufvl_t.begin(), 'v');
-							priv->ufvl_us.insert(priv->ufvl_us.begin(), 0);
-							ufvl_i.insert(ufvl_i.begin(), 1);
-						} else {
-							ufv[3][l].insert(ufv[3][l].begin(), (void*) v);
-							ufv_i[3][l].insert(ufv_i[3][l].begin(), 1);
-							priv->ufv_us[3][l].insert(priv->ufv_us[3][l].begin(), 0);
-							for(size_t i = 0; i < ufv[2][l].size(); i++) {
-								const ExpressionName *ename = &((ExpressionItem*) ufv[2][l][i])->getName(ufv_i[2][l][i]);
-								if(priv->ufv_us[2][l][i] == 0 && ((ename->case_sensitive && ename->name == sname) || (!ename->case_sensitive && equalsIgnoreCase(ename->name, sname)))) {
-									ufv_i[2][l][i] += 10000;
-									where_its.push_back(ufv_i[2][l].begin() + i);
-									break;
-								}
-							}
-						}
+						// temporary variables are only visible to parse() in the current calculation context
+						CONTEXT->where_variables.insert(CONTEXT->where_variables.begin(), v);
 						where_vars.push_back(v);
 					}
 				}
@@ -3518,34 +3631,13 @@ void Calculator::parseExpressionAndWhere(MathStructure *mstruct, MathStructure *
 	if(!where_vars.empty()) {
 		for(size_t i = where_vars.size() - 1; ; i--) {
 			if(!repeat[i] && where_vars[i] && where_vars[i]->category() == "\x14") {
-				size_t l = where_vars[i]->name().length() - 1;
-				if(l > UFV_LENGTHS) {
-					for(size_t i2 = 0; i2 < ufvl.size(); i2++) {
-						if(ufvl_t[i2] == 'v' && ((ExpressionItem*) ufvl[i2])->name() == where_vars[i]->name() && ((ExpressionItem*) ufvl[i2])->category() == "\x14") {
-							ufvl.erase(ufvl.begin() + i2);
-							ufvl_t.erase(ufvl_t.begin() + i2);
-							priv->ufvl_us.erase(priv->ufvl_us.begin() + i2);
-							ufvl_i.erase(ufvl_i.begin() + i2);
-							break;
-						}
-					}
-				} else {
-					for(size_t i2 = 0; i2 < ufv[3][i].size(); i2++) {
-						if(((ExpressionItem*) ufv[3][l][i2])->name() == where_vars[i]->name() && ((ExpressionItem*) ufv[3][l][i2])->category() == "\x14") {
-							ufv[3][l].erase(ufv[3][l].begin() + i2);
-							ufv_i[3][l].erase(ufv_i[3][l].begin() + i2);
-							priv->ufv_us[3][l].erase(priv->ufv_us[3][l].begin() + i2);
-							break;
-						}
-					}
+				for(vector<Variable*>::iterator it = CONTEXT->where_variables.begin(); it != CONTEXT->where_variables.end(); ++it) {
+					if(*it == where_vars[i]) {CONTEXT->where_variables.erase(it); break;}
 				}
 				where_vars[i]->destroy();
 			}
 			if(i == 0) break;
 		}
-		for(size_t i = 0; i < where_its.size(); i++) {
-			*where_its[i] -= 10000;
-		}
 	}
 }
 
@@ -3620,11 +3712,10 @@ MathStructure Calculator::calculate(string str, const EvaluationOptions &eo, Mat
 	}
 
 	MathStructure mstruct;
-	current_stage = MESSAGE_STAGE_PARSING;
-	size_t n_messages = messages.size();
+	CONTEXT->current_stage = MESSAGE_STAGE_PARSING;
+	size_t n_messages = CONTEXT->messages.size();
 
 	vector<Variable*> where_vars;
-	vector<vector<size_t>::iterator> where_its;
 
 	if(!str_where.empty()) {
 		parseSigns(str_where, false);
@@ -3840,25 +3931,8 @@ MathStructure Calculator::calculate(string str, const EvaluationOptions &eo, Mat
 						}
 					}
 					if(v) {
-						size_t l = sname.length() - 1;
-						if(l > UFV_LENGTHS) {
-							ufvl.insert(ufvl.begin(), (void*) v);
-							ufvl_t.insert(ufvl_t.begin(), 'v');
-							priv->ufvl_us.insert(priv->ufvl_us.begin(), 0);
-							ufvl_i.insert(ufvl_i.begin(), 1);
-						} else {
-							ufv[3][l].insert(ufv[3][l].begin(), (void*) v);
-							ufv_i[3][l].insert(ufv_i[3][l].begin(), 1);
-							priv->ufv_us[3][l].insert(priv->ufv_us[3][l].begin(), 0);
-							for(size_t i = 0; i < ufv[2][l].size(); i++) {
-								const ExpressionName *ename = &((ExpressionItem*) ufv[2][l][i])->getName(ufv_i[2][l][i]);
-								if(priv->ufv_us[2][l][i] == 0 && ((ename->case_sensitive && ename->name == sname) || (!ename->case_sensitive && equalsIgnoreCase(ename->name, sname)))) {
-									ufv_i[2][l][i] += 10000;
-									where_its.push_back(ufv_i[2][l].begin() + i);
-									break;
-								}
-							}
-						}
+						// temporary variables are only visible to parse() in the current calculation context
+						CONTEXT->where_variables.insert(CONTEXT->where_variables.begin(), v);
 						where_vars.push_back(v);
 					}
 				}
@@ -3905,7 +3979,7 @@ MathStructure Calculator::calculate(string str, const EvaluationOptions &eo, Mat
 		MathStructure where_struct;
 		parse(&where_struct, str_where, eo.parse_options);
 
-		current_stage = MESSAGE_STAGE_CALCULATION;
+		CONTEXT->current_stage = MESSAGE_STAGE_CALCULATION;
 
 		// replace answer variables and functions in expression before performing any replacements from "where" expression
 		calculate_ans(mstruct, eo);
@@ -3943,33 +4017,12 @@ MathStructure Calculator::calculate(string str, const EvaluationOptions &eo, Mat
 	if(!where_vars.empty()) {
 		for(size_t i = where_vars.size() - 1; ; i--) {
 			if(where_vars[i]->category() == "\x14") {
-				size_t l = where_vars[i]->name().length() - 1;
-				if(l > UFV_LENGTHS) {
-					for(size_t i2 = 0; i2 < ufvl.size(); i2++) {
-						if(ufvl_t[i2] == 'v' && ((ExpressionItem*) ufvl[i2])->name() == where_vars[i]->name() && ((ExpressionItem*) ufvl[i2])->category() == "\x14") {
-							ufvl.erase(ufvl.begin() + i2);
-							ufvl_t.erase(ufvl_t.begin() + i2);
-							priv->ufvl_us.erase(priv->ufvl_us.begin() + i2);
-							ufvl_i.erase(ufvl_i.begin() + i2);
-							break;
-						}
-					}
-				} else {
-					for(size_t i2 = 0; i2 < ufv[3][i].size(); i2++) {
-						if(((ExpressionItem*) ufv[3][l][i2])->name() == where_vars[i]->name() && ((ExpressionItem*) ufv[3][l][i2])->category() == "\x14") {
-							ufv[3][l].erase(ufv[3][l].begin() + i2);
-							ufv_i[3][l].erase(ufv_i[3][l].begin() + i2);
-							priv->ufv_us[3][l].erase(priv->ufv_us[3][l].begin() + i2);
-							break;
-						}
-					}
+				for(vector<Variable*>::iterator it = CONTEXT->where_variables.begin(); it != CONTEXT->where_variables.end(); ++it) {
+					if(*it == where_vars[i]) {CONTEXT->where_variables.erase(it); break;}
 				}
 			}
 			if(i == 0) break;
 		}
-		for(size_t i = 0; i < where_its.size(); i++) {
-			*where_its[i] -= 10000;
-		}
 		if(str_where.empty()) calculate_ans(mstruct, eo);
 		for(size_t i = 0; i < where_vars.size(); i++) {
 			if(where_vars[i]->category() != "\x14") continue;
@@ -3977,12 +4030,12 @@ MathStructure Calculator::calculate(string str, const EvaluationOptions &eo, Mat
 		}
 	}
 
-	current_stage = MESSAGE_STAGE_CALCULATION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CALCULATION;
 
 	// perform calculation
-	mstruct.eval(eo);
+	evalCached(mstruct, eo);
 
-	current_stage = MESSAGE_STAGE_UNSET;
+	CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 
 	if(!aborted()) {
 		// do unit conversion
@@ -3991,7 +4044,7 @@ MathStructure Calculator::calculate(string str, const EvaluationOptions &eo, Mat
 			// convert to unit provided in to_struct
 			if(to_struct) to_struct->set(u);
 			if(b_units) {
-				current_stage = MESSAGE_STAGE_CONVERSION;
+				CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 				mstruct.set(convert(mstruct, u, eo, false, false, true, parsed_struct));
 				if(eo.mixed_units_conversion != MIXED_UNITS_CONVERSION_NONE) mstruct.set(convertToMixedUnits(mstruct, eo));
 			}
@@ -4030,7 +4083,7 @@ MathStructure Calculator::calculate(string str, const EvaluationOptions &eo, Mat
 			}
 		} else if(b_units) {
 			// do automatic conversion
-			current_stage = MESSAGE_STAGE_CONVERSION;
+			CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 			switch(eo.auto_post_conversion) {
 				case POST_CONVERSION_OPTIMAL: {
 					mstruct.set(convertToOptimalUnit(mstruct, eo, false));
@@ -4053,7 +4106,7 @@ MathStructure Calculator::calculate(string str, const EvaluationOptions &eo, Mat
 	// clean up all new messages (removes "wide interval" warning if final value does not contains any wide interval)
 	cleanMessages(mstruct, n_messages + 1);
 
-	current_stage = MESSAGE_STAGE_UNSET;
+	CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 
 	// replace variables generated from "where" expression
 	for(size_t i = 0; i < where_vars.size(); i++) {
@@ -4073,6 +4126,8 @@ MathStructure Calculator::calculate(string str, const EvaluationOptions &eo, Mat
 
 	if(aborted()) replace_unregistered_variables(mstruct);
 
+	clear_node_pools();
+
 	return mstruct;
 
 }
@@ -4080,11 +4135,11 @@ MathStructure Calculator::calculate(const MathStructure &mstruct_to_calculate, c
 
 	remove_blank_ends(to_str);
 	MathStructure mstruct(mstruct_to_calculate);
-	current_stage = MESSAGE_STAGE_CALCULATION;
-	size_t n_messages = messages.size();
-	mstruct.eval(eo);
+	CONTEXT->current_stage = MESSAGE_STAGE_CALCULATION;
+	size_t n_messages = CONTEXT->messages.size();
+	evalCached(mstruct, eo);
 
-	current_stage = MESSAGE_STAGE_CONVERSION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 	if(!to_str.empty()) {
 		mstruct.set(convert(mstruct, to_str, eo));
 	} else {
@@ -4108,7 +4163,8 @@ MathStructure Calculator::calculate(const MathStructure &mstruct_to_calculate, c
 
 	cleanMessages(mstruct, n_messages + 1);
 
-	current_stage = MESSAGE_STAGE_UNSET;
+	CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
+	clear_node_pools();
 	return mstruct;
 }
 
@@ -4165,53 +4221,90 @@ void Calculator::stopPrintControl() {
 	stopControl();
 }
 
+CalculatorTimer::CalculatorTimer() : b_quit(false) {}
+CalculatorTimer::~CalculatorTimer() {
+	if(timer_thread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			b_quit = true;
+		}
+		condition.notify_one();
+		timer_thread.join();
+	}
+}
+void CalculatorTimer::run() {
+	std::unique_lock<std::mutex> lock(mutex);
+	while(!b_quit) {
+		if(deadlines.empty()) {
+			condition.wait(lock);
+			continue;
+		}
+		if(condition.wait_until(lock, deadlines.begin()->first) == std::cv_status::timeout) {
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+			while(!deadlines.empty() && deadlines.begin()->first <= now) {
+				int i_zero = 0;
+				deadlines.begin()->second->i_aborted.compare_exchange_strong(i_zero, 2);
+				deadlines.erase(deadlines.begin());
+			}
+		}
+	}
+}
+void CalculatorTimer::add(CalculatorContext *ctx, int milliseconds) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for(std::multimap<std::chrono::steady_clock::time_point, CalculatorContext*>::iterator it = deadlines.begin(); it != deadlines.end(); ++it) {
+			if(it->second == ctx) {deadlines.erase(it); break;}
+		}
+		deadlines.insert(std::make_pair(std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds), ctx));
+		if(!timer_thread.joinable()) timer_thread = std::thread(&CalculatorTimer::run, this);
+	}
+	condition.notify_one();
+}
+void CalculatorTimer::remove(CalculatorContext *ctx) {
+	std::lock_guard<std::mutex> lock(mutex);
+	for(std::multimap<std::chrono::steady_clock::time_point, CalculatorContext*>::iterator it = deadlines.begin(); it != deadlines.end(); ++it) {
+		if(it->second == ctx) {deadlines.erase(it); break;}
+	}
+}
+
 void Calculator::startControl(int milli_timeout) {
-	b_controlled = true;
-	i_aborted = 0;
-	i_timeout = milli_timeout;
-	if(i_timeout > 0) {
+	CalculatorContext *ctx = CONTEXT;
+	if(ctx->i_timeout > 0) priv->timer.remove(ctx);
+	ctx->b_controlled = true;
+	ctx->i_aborted = 0;
+	ctx->i_timeout = milli_timeout;
+	if(ctx->i_timeout > 0) {
 #ifndef CLOCK_MONOTONIC
-		gettimeofday(&t_end, NULL);
+		gettimeofday(&ctx->t_end, NULL);
 #else
 		struct timespec ts;
 		clock_gettime(CLOCK_MONOTONIC, &ts);
-		t_end.tv_sec = ts.tv_sec;
-		t_end.tv_usec = ts.tv_nsec / 1000;
+		ctx->t_end.tv_sec = ts.tv_sec;
+		ctx->t_end.tv_usec = ts.tv_nsec / 1000;
 #endif
-		long int usecs = t_end.tv_usec + (long int) milli_timeout * 1000;
-		t_end.tv_usec = usecs % 1000000;
-		t_end.tv_sec += usecs / 1000000;
+		long int usecs = ctx->t_end.tv_usec + (long int) milli_timeout * 1000;
+		ctx->t_end.tv_usec = usecs % 1000000;
+		ctx->t_end.tv_sec += usecs / 1000000;
+		priv->timer.add(ctx, milli_timeout);
 	}
 }
 bool Calculator::aborted() {
-	if(!b_controlled) return false;
-	if(i_aborted > 0) return true;
-	if(i_timeout > 0) {
-#ifndef CLOCK_MONOTONIC
-		struct timeval tv;
-		gettimeofday(&tv, NULL);
-		if(tv.tv_sec > t_end.tv_sec || (tv.tv_sec == t_end.tv_sec && tv.tv_usec > t_end.tv_usec)) {
-#else
-		struct timespec tv;
-		clock_gettime(CLOCK_MONOTONIC, &tv);
-		if(tv.tv_sec > t_end.tv_sec || (tv.tv_sec == t_end.tv_sec && tv.tv_nsec / 1000 > t_end.tv_usec)) {
-#endif
-			i_aborted = 2;
-			return true;
-		}
-	}
-	return false;
+	// the time limit is checked by priv->timer
+	CalculatorContext *ctx = CONTEXT;
+	return ctx->b_controlled && ctx->i_aborted.load(std::memory_order_relaxed) > 0;
 }
 string Calculator::abortedMessage() const {
-	if(i_aborted == 2) return _("timed out");
+	if(CONTEXT->i_aborted == 2) return _("timed out");
 	return _("aborted");
 }
 bool Calculator::isControlled() const {
-	return b_controlled;
+	return CONTEXT->b_controlled;
 }
 void Calculator::stopControl() {
-	b_controlled = false;
-	i_aborted = 0;
-	i_timeout = 0;
+	CalculatorContext *ctx = CONTEXT;
+	if(ctx->i_timeout > 0) priv->timer.remove(ctx);
+	ctx->b_controlled = false;
+	ctx->i_aborted = 0;
+	ctx->i_timeout = 0;
 }
 
@@ -45,7 +45,7 @@ MathStructure Calculator::convertToMixedUnits(const MathStructure &mstruct, cons
 	if(eo.mixed_units_conversion == MIXED_UNITS_CONVERSION_NONE) return mstruct;
 	if(!mstruct.isMultiplication()) return mstruct;
 	if(mstruct.size() != 2) return mstruct;
-	size_t n_messages = messages.size();
+	size_t n_messages = CONTEXT->messages.size();
 	if(mstruct[1].isUnit() && (!mstruct[1].prefix() || mstruct[1].prefix() == decimal_null_prefix) && mstruct[0].isNumber()) {
 		Prefix *p = mstruct[1].prefix();
 		MathStructure mstruct_new(mstruct);
@@ -217,7 +217,7 @@ MathStructure Calculator::convertToMixedUnits(const MathStructure &mstruct, cons
 }
 
 MathStructure Calculator::convert(double value, Unit *from_unit, Unit *to_unit, const EvaluationOptions &eo) {
-	size_t n_messages = messages.size();
+	size_t n_messages = CONTEXT->messages.size();
 	MathStructure mstruct(value);
 	mstruct *= from_unit;
 	mstruct.eval(eo);
@@ -291,7 +291,7 @@ MathStructure Calculator::convertTimeOut(string str, Unit *from_unit, Unit *to_u
 	return mstruct;
 }
 MathStructure Calculator::convert(string str, Unit *from_unit, Unit *to_unit, const EvaluationOptions &eo) {
-	size_t n_messages = messages.size();
+	size_t n_messages = CONTEXT->messages.size();
 	MathStructure mstruct;
 	parse(&mstruct, str, eo.parse_options);
 	mstruct *= from_unit;
@@ -310,7 +310,7 @@ MathStructure Calculator::convert(string str, Unit *from_unit, Unit *to_unit, co
 }
 MathStructure Calculator::convert(const MathStructure &mstruct, KnownVariable *to_var, const EvaluationOptions &eo) {
 	if(mstruct.contains(to_var, true) > 0) return mstruct;
-	size_t n_messages = messages.size();
+	size_t n_messages = CONTEXT->messages.size();
 	if(!to_var->unit().empty() && to_var->isExpression()) {
 		int b = mstruct.containsRepresentativeOfType(STRUCT_UNIT, true, true);
 		if(b > 0 || (b < 0 && b_var_units)) {
@@ -925,7 +925,7 @@ MathStructure Calculator::convert(const MathStructure &mstruct, Unit *to_unit, c
 		if(!b_angle) return mstruct;
 	}
 	MathStructure mstruct_new(mstruct);
-	size_t n_messages = messages.size();
+	size_t n_messages = CONTEXT->messages.size();
 	if(to_unit->hasNonlinearRelationTo(to_unit->baseUnit()) && to_unit->baseUnit()->subtype() == SUBTYPE_COMPOSITE_UNIT) {
 		if(mstruct_new.isComparison() || (mstruct_new.isLogicalAnd() && mstruct_new.size() > 0 && mstruct_new[0].isComparison()) || (mstruct_new.isLogicalOr() && mstruct_new.size() > 0 && (mstruct_new[0].isComparison() || (mstruct_new[0].isLogicalAnd() && mstruct_new[0].size() > 0 && mstruct_new[0][0].isComparison())))) {
 			if(mstruct_new.isLogicalOr()) {
@@ -1365,7 +1365,7 @@ MathStructure Calculator::convertToBaseUnits(const MathStructure &mstruct, const
 		}
 		return mstruct_new;
 	}
-	size_t n_messages = messages.size();
+	size_t n_messages = CONTEXT->messages.size();
 	mstruct_new.convertToBaseUnits(true, NULL, true, eo);
 	if(!mstruct_new.equals(mstruct, true, true)) {
 		EvaluationOptions eo2 = eo;
@@ -1600,6 +1600,8 @@ Unit *Calculator::getOptimalUnit(Unit *u, bool allow_only_div, bool convert_to_l
 						if(cu2->countUnits() <= cu->countUnits()) {
 							for(size_t i2 = 1; i2 <= cu2->countUnits(); i2++) {
 								if(cu2->get(i2)->baseUnit()->subtype() == SUBTYPE_COMPOSITE_UNIT || cu2->get(i2)->baseExponent() != 1) {
+									// the cached base unit structures are shared between threads
+									std::lock_guard<std::recursive_mutex> lock(definitions_mutex);
 									MathStructure *cu_mstruct = NULL;
 									unordered_map<Unit*, MathStructure*>::iterator it = priv->composite_unit_base.find(cu2);
 									if(!cu2->hasChanged() && it != priv->composite_unit_base.end()) {
@@ -1696,6 +1698,7 @@ Unit *Calculator::getOptimalUnit(Unit *u, bool allow_only_div, bool convert_to_l
 								}
 							}
 						} else if(au->firstBaseExponent() != 1 || au->firstBaseUnit()->subtype() == SUBTYPE_COMPOSITE_UNIT) {
+							std::lock_guard<std::recursive_mutex> lock(definitions_mutex);
 							MathStructure *cu_mstruct = NULL;
 							unordered_map<Unit*, MathStructure*>::iterator it = priv->composite_unit_base.find(bu);
 							if(!bu->hasChanged() && it != priv->composite_unit_base.end()) {
@@ -2281,7 +2284,7 @@ MathStructure Calculator::convert(const MathStructure &mstruct_to_convert, strin
 	if(to_struct) to_struct->setUndefined();
 	remove_blank_ends(str2);
 	if(str2.empty()) return mstruct_to_convert;
-	current_stage = MESSAGE_STAGE_CONVERSION;
+	CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 	int do_prefix = 0;
 	if(str2.length() > 1 && str2[1] == '?' && (str2[0] == 'b' || str2[0] == 'a' || str2[0] == 'd')) {
 		do_prefix = 2;
@@ -2300,7 +2303,7 @@ MathStructure Calculator::convert(const MathStructure &mstruct_to_convert, strin
 		str2 = str2.substr(do_prefix > 1 ? 2 : 1, str2.length() - (do_prefix > 1 ? 2 : 1));
 		remove_blank_ends(str2);
 		if(str2.empty()) {
-			current_stage = MESSAGE_STAGE_UNSET;
+			CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 			return convertToMixedUnits(mstruct_to_convert, eo2);
 		}
 	}
@@ -2344,7 +2347,7 @@ MathStructure Calculator::convert(const MathStructure &mstruct_to_convert, strin
 				KnownVariable *v = new KnownVariable("", str2, p->value());
 				mstruct.multiply(v);
 				v->destroy();
-				current_stage = MESSAGE_STAGE_UNSET;
+				CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 				return mstruct;
 			}
 		}
@@ -2358,11 +2361,11 @@ MathStructure Calculator::convert(const MathStructure &mstruct_to_convert, strin
 		mstruct.set(convert(mstruct_to_convert, (KnownVariable*) v, eo2));
 		b = true;
 	} else {
-		current_stage = MESSAGE_STAGE_CONVERSION_PARSING;
+		CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION_PARSING;
 		beginTemporaryStopMessages();
 		CompositeUnit cu("", eo.parse_options.limit_implicit_multiplication ? "01" : "00", "", str2);
 		MathStructure munits;
-		if(stopped_errors_count[disable_errors_ref - 1] > 0) {
+		if(CONTEXT->stopped_errors_count[CONTEXT->disable_errors_ref - 1] > 0) {
 			endTemporaryStopMessages();
 			ParseOptions po = eo.parse_options;
 			po.units_enabled = true;
@@ -2388,7 +2391,7 @@ MathStructure Calculator::convert(const MathStructure &mstruct_to_convert, strin
 				}
 			}
 		}
-		current_stage = MESSAGE_STAGE_CONVERSION;
+		CONTEXT->current_stage = MESSAGE_STAGE_CONVERSION;
 		if(to_struct) {
 			if(!munits.isUndefined()) to_struct->set(munits);
 			else to_struct->set(cu.generateMathStructure(true));
@@ -2422,7 +2425,7 @@ MathStructure Calculator::convert(const MathStructure &mstruct_to_convert, strin
 	}
 	if(!b) return mstruct_to_convert;
 	if(!v && eo2.mixed_units_conversion != MIXED_UNITS_CONVERSION_NONE) mstruct.set(convertToMixedUnits(mstruct, eo2));
-	current_stage = MESSAGE_STAGE_UNSET;
+	CONTEXT->current_stage = MESSAGE_STAGE_UNSET;
 	return mstruct;
 }
 
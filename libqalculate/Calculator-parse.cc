@@ -24,6 +24,7 @@
 #include "Prefix.h"
 #include "Number.h"
 
+#include <functional>
 #include <locale.h>
 #ifndef _MSC_VER
 #	include <unistd.h>
@@ -62,81 +63,81 @@ bool is_not_number(char c, int base) {
 
 size_t Calculator::addId(MathStructure *mstruct, bool persistent) {
 	size_t id = 0;
-	if(!priv->freed_ids.empty()) {
-		id = priv->freed_ids.back();
-		priv->freed_ids.pop_back();
+	if(!CONTEXT->freed_ids.empty()) {
+		id = CONTEXT->freed_ids.back();
+		CONTEXT->freed_ids.pop_back();
 	} else {
-		priv->ids_i++;
-		id = priv->ids_i;
+		CONTEXT->ids_i++;
+		id = CONTEXT->ids_i;
 	}
-	priv->ids_p[id] = persistent;
-	priv->ids_ref[id] = 1;
-	priv->id_structs[id] = mstruct;
+	CONTEXT->ids_p[id] = persistent;
+	CONTEXT->ids_ref[id] = 1;
+	CONTEXT->id_structs[id] = mstruct;
 	return id;
 }
 size_t Calculator::parseAddId(MathFunction *f, const string &str, const ParseOptions &po, bool persistent) {
 	size_t id = 0;
-	if(!priv->freed_ids.empty()) {
-		id = priv->freed_ids.back();
-		priv->freed_ids.pop_back();
+	if(!CONTEXT->freed_ids.empty()) {
+		id = CONTEXT->freed_ids.back();
+		CONTEXT->freed_ids.pop_back();
 	} else {
-		priv->ids_i++;
-		id = priv->ids_i;
+		CONTEXT->ids_i++;
+		id = CONTEXT->ids_i;
 	}
-	priv->ids_p[id] = persistent;
-	priv->ids_ref[id] = 1;
-	priv->id_structs[id] = new MathStructure();
-	f->parse(*priv->id_structs[id], str, po);
+	CONTEXT->ids_p[id] = persistent;
+	CONTEXT->ids_ref[id] = 1;
+	CONTEXT->id_structs[id] = new MathStructure();
+	f->parse(*CONTEXT->id_structs[id], str, po);
 	return id;
 }
 size_t Calculator::parseAddIdAppend(MathFunction *f, const MathStructure &append_mstruct, const string &str, const ParseOptions &po, bool persistent) {
 	size_t id = 0;
-	if(!priv->freed_ids.empty()) {
-		id = priv->freed_ids.back();
-		priv->freed_ids.pop_back();
+	if(!CONTEXT->freed_ids.empty()) {
+		id = CONTEXT->freed_ids.back();
+		CONTEXT->freed_ids.pop_back();
 	} else {
-		priv->ids_i++;
-		id = priv->ids_i;
+		CONTEXT->ids_i++;
+		id = CONTEXT->ids_i;
 	}
-	priv->ids_p[id] = persistent;
-	priv->ids_ref[id] = 1;
-	priv->id_structs[id] = new MathStructure();
-	f->parse(*priv->id_structs[id], str, po);
-	priv->id_structs[id]->addChild(append_mstruct);
+	CONTEXT->ids_p[id] = persistent;
+	CONTEXT->ids_ref[id] = 1;
+	CONTEXT->id_structs[id] = new MathStructure();
+	f->parse(*CONTEXT->id_structs[id], str, po);
+	CONTEXT->id_structs[id]->addChild(append_mstruct);
 	return id;
 }
 size_t Calculator::parseAddVectorId(const string &str, const ParseOptions &po, bool persistent) {
 	size_t id = 0;
-	if(priv->freed_ids.size() > 0) {
-		id = priv->freed_ids.back();
-		priv->freed_ids.pop_back();
+	if(CONTEXT->freed_ids.size() > 0) {
+		id = CONTEXT->freed_ids.back();
+		CONTEXT->freed_ids.pop_back();
 	} else {
-		priv->ids_i++;
-		id = priv->ids_i;
+		CONTEXT->ids_i++;
+		id = CONTEXT->ids_i;
 	}
-	priv->ids_p[id] = persistent;
-	priv->ids_ref[id] = 1;
-	priv->id_structs[id] = new MathStructure();
-	f_vector->args(str, *priv->id_structs[id], po);
+	CONTEXT->ids_p[id] = persistent;
+	CONTEXT->ids_ref[id] = 1;
+	CONTEXT->id_structs[id] = new MathStructure();
+	f_vector->args(str, *CONTEXT->id_structs[id], po);
 	return id;
 }
 MathStructure *Calculator::getId(size_t id) {
-	if(priv->id_structs.find(id) != priv->id_structs.end()) {
-		if(priv->ids_p[id] || priv->ids_ref[id] > 1) {
-			if(!priv->ids_p[id]) priv->ids_ref[id]--;
-			return new MathStructure(*priv->id_structs[id]);
+	if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end()) {
+		if(CONTEXT->ids_p[id] || CONTEXT->ids_ref[id] > 1) {
+			if(!CONTEXT->ids_p[id]) CONTEXT->ids_ref[id]--;
+			return new MathStructure(*CONTEXT->id_structs[id]);
 		} else {
-			MathStructure *mstruct = priv->id_structs[id];
-			priv->id_structs.erase(id);
-			priv->ids_p.erase(id);
-			priv->ids_ref.erase(id);
-			if(priv->id_structs.empty()) {
-				priv->ids_i = 0;
-				priv->freed_ids.clear();
-			} else if(id == priv->ids_i) {
-				priv->ids_i--;
+			MathStructure *mstruct = CONTEXT->id_structs[id];
+			CONTEXT->id_structs.erase(id);
+			CONTEXT->ids_p.erase(id);
+			CONTEXT->ids_ref.erase(id);
+			if(CONTEXT->id_structs.empty()) {
+				CONTEXT->ids_i = 0;
+				CONTEXT->freed_ids.clear();
+			} else if(id == CONTEXT->ids_i) {
+				CONTEXT->ids_i--;
 			} else {
-				priv->freed_ids.push_back(id);
+				CONTEXT->freed_ids.push_back(id);
 			}
 			return mstruct;
 		}
@@ -144,22 +145,22 @@ MathStructure *Calculator::getId(size_t id) {
 	return NULL;
 }
 void Calculator::delId(size_t id) {
-	unordered_map<size_t, size_t>::iterator it = priv->ids_ref.find(id);
-	if(it != priv->ids_ref.end()) {
+	unordered_map<size_t, size_t>::iterator it = CONTEXT->ids_ref.find(id);
+	if(it != CONTEXT->ids_ref.end()) {
 		if(it->second > 1) {
 			it->second--;
 		} else {
-			priv->id_structs[id]->unref();
-			priv->id_structs.erase(id);
-			priv->ids_p.erase(id);
-			priv->ids_ref.erase(it);
-			if(priv->id_structs.empty()) {
-				priv->ids_i = 0;
-				priv->freed_ids.clear();
-			} else if(id == priv->ids_i) {
-				priv->ids_i--;
+			CONTEXT->id_structs[id]->unref();
+			CONTEXT->id_structs.erase(id);
+			CONTEXT->ids_p.erase(id);
+			CONTEXT->ids_ref.erase(it);
+			if(CONTEXT->id_structs.empty()) {
+				CONTEXT->ids_i = 0;
+				CONTEXT->freed_ids.clear();
+			} else if(id == CONTEXT->ids_i) {
+				CONTEXT->ids_i--;
 			} else {
-				priv->freed_ids.push_back(id);
+				CONTEXT->freed_ids.push_back(id);
 			}
 		}
 	}
@@ -1451,10 +1452,57 @@ MathStructure *last_is_function(MathStructure &m) {
 	return last_is_function(m.last());
 }
 
+// units with the same name as a temporary variable from a where expression are ignored
+bool hidden_by_where_variable(const ExpressionName &ename, size_t underscore, const vector<Variable*> &where_vars) {
+	if(underscore > 0) return false;
+	for(size_t i = 0; i < where_vars.size(); i++) {
+		const string &sname = where_vars[i]->getName(1).name;
+		if((ename.case_sensitive && ename.name == sname) || (!ename.case_sensitive && equalsIgnoreCase(ename.name, sname))) return true;
+	}
+	return false;
+}
+
 #define PARSING_MODE (po.parsing_mode & ~PARSE_PERCENT_AS_ORDINARY_CONSTANT)
 #define BASE_2_10 ((po.base >= 2 && po.base <= 10) || (po.base < BASE_CUSTOM && po.base != BASE_UNICODE && po.base != BASE_BIJECTIVE_26) || (po.base == BASE_CUSTOM && priv->custom_input_base_i <= 10))
 
-void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &parseoptions) {
+void append_parse_options_cache_key(string &key, const ParseOptions &po) {
+	APPEND_CACHE_KEY(key, po.variables_enabled) APPEND_CACHE_KEY(key, po.functions_enabled) APPEND_CACHE_KEY(key, po.unknowns_enabled) APPEND_CACHE_KEY(key, po.units_enabled)
+	APPEND_CACHE_KEY(key, po.rpn) APPEND_CACHE_KEY(key, po.base) APPEND_CACHE_KEY(key, po.limit_implicit_multiplication) APPEND_CACHE_KEY(key, po.read_precision)
+	APPEND_CACHE_KEY(key, po.dot_as_separator) APPEND_CACHE_KEY(key, po.comma_as_separator) APPEND_CACHE_KEY(key, po.brackets_as_parentheses) APPEND_CACHE_KEY(key, po.angle_unit)
+	APPEND_CACHE_KEY(key, po.preserve_format) APPEND_CACHE_KEY(key, (size_t) po.default_dataset) APPEND_CACHE_KEY(key, po.parsing_mode) APPEND_CACHE_KEY(key, po.twos_complement)
+	APPEND_CACHE_KEY(key, po.hexadecimal_twos_complement) APPEND_CACHE_KEY(key, po.binary_bits)
+}
+
+void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &po) {
+	// only top level expressions are cached; the parse cache is bypassed when the unended function is requested
+	if(priv->parse_cache.maxSize() == 0 || CONTEXT->parse_depth > 0 || po.unended_function || CONTEXT->disable_errors_ref > 0) {
+		CONTEXT->parse_depth++;
+		parseUncached(mstruct, str, po);
+		CONTEXT->parse_depth--;
+		return;
+	}
+	string key = str;
+	key += '\0';
+	append_parse_options_cache_key(key, po);
+	key += DOT_STR; key += '\0'; key += COMMA_STR; key += '\0';
+	APPEND_CACHE_KEY(key, getPrecision()) APPEND_CACHE_KEY(key, usesIntervalArithmetic()) APPEND_CACHE_KEY(key, priv->concise_uncertainty_input) APPEND_CACHE_KEY(key, priv->matlab_matrices)
+	if(po.angle_unit == ANGLE_UNIT_CUSTOM) APPEND_CACHE_KEY(key, (size_t) priv->custom_angle_unit)
+	if(po.base == BASE_CUSTOM) key += priv->custom_input_base.print();
+	size_t hash = std::hash<string>()(key);
+	size_t generation = priv->definitions_generation;
+	// messages generated during the original parsing are added to the current messages
+	if(priv->parse_cache.get(hash, key, NULL, *mstruct, &CONTEXT->messages, generation)) return;
+	size_t n_messages = CONTEXT->messages.size();
+	CONTEXT->parse_depth++;
+	parseUncached(mstruct, str, po);
+	CONTEXT->parse_depth--;
+	if(aborted() || priv->definitions_generation != generation) return;
+	vector<CalculatorMessage> messages;
+	messages.insert(messages.end(), CONTEXT->messages.begin() + n_messages, CONTEXT->messages.end());
+	priv->parse_cache.add(hash, key, NULL, *mstruct, &messages, generation);
+}
+
+void Calculator::parseUncached(MathStructure *mstruct, string str, const ParseOptions &parseoptions) {
 
 	initialize_global_variables();
 
@@ -2260,9 +2308,9 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 							} else {
 								for(size_t i_id = 0; i_id < saved_ids.size(); i_id++) {
 									size_t id = saved_ids[i_id];
-									if(priv->id_structs.find(id) != priv->id_structs.end() && !priv->ids_p[id]) {
-										if(priv->ids_ref[id] <= 1) delId(id);
-										else priv->ids_ref[id]--;
+									if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end() && !CONTEXT->ids_p[id]) {
+										if(CONTEXT->ids_ref[id] <= 1) delId(id);
+										else CONTEXT->ids_ref[id]--;
 									}
 								}
 								saved_ids.clear();
@@ -2271,8 +2319,8 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 										size_t i_id2 = stmp2.find(INTERNAL_ID_R_CH, i_id + 1);
 										if(i_id2 == string::npos) break;
 										int id = s2i(stmp2.substr(i_id + 1, i_id2 - (i_id + 1)));
-										if(priv->id_structs.find(id) != priv->id_structs.end() && !priv->ids_p[id]) {
-											priv->ids_ref[id]++;
+										if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end() && !CONTEXT->ids_p[id]) {
+											CONTEXT->ids_ref[id]++;
 											saved_ids.push_back(id);
 										}
 									}
@@ -2315,9 +2363,9 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 								first_not_unit = false;
 								for(size_t i_id = 0; i_id < saved_ids.size(); i_id++) {
 									size_t id = saved_ids[i_id];
-									if(priv->id_structs.find(id) != priv->id_structs.end() && !priv->ids_p[id]) {
-										if(priv->ids_ref[id] <= 1) delId(id);
-										else priv->ids_ref[id]--;
+									if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end() && !CONTEXT->ids_p[id]) {
+										if(CONTEXT->ids_ref[id] <= 1) delId(id);
+										else CONTEXT->ids_ref[id]--;
 									}
 								}
 								saved_ids.clear();
@@ -2336,9 +2384,9 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 				}
 				for(size_t i_id = 0; i_id < saved_ids.size(); i_id++) {
 					size_t id = saved_ids[i_id];
-					if(priv->id_structs.find(id) != priv->id_structs.end() && !priv->ids_p[id]) {
-						if(priv->ids_ref[id] <= 1) delId(id);
-						else priv->ids_ref[id]--;
+					if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end() && !CONTEXT->ids_p[id]) {
+						if(CONTEXT->ids_ref[id] <= 1) delId(id);
+						else CONTEXT->ids_ref[id]--;
 					}
 				}
 				saved_ids.clear();
@@ -2906,13 +2954,38 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 			} else {
 				ufv_index = 0;
 			}
+			// name lists which might contain a name matching the beginning of str
+			unsigned int name_lists[4];
+			priv->name_index.match(str, str_index, name_chars_left, name_lists);
+			// temporary variables from where expressions, which are not included in the name lists
+			const vector<Variable*> &where_vars = CONTEXT->where_variables;
+			size_t where_index = 0;
 			Prefix *p = NULL;
 			while(vt2 < 4) {
 				name = NULL;
 				p = NULL;
 				switch(vt2) {
 					case -1: {
-						if(ufv_index < ufvl.size()) {
+						if(where_index < where_vars.size()) {
+							object = where_vars[where_index];
+							where_index++;
+							if(po.variables_enabled && !p_mode && ((Variable*) object)->getName(1).name.length() > UFV_LENGTHS) {
+								ufvt = 'v';
+								name = &((Variable*) object)->getName(1).name;
+								case_sensitive = ((Variable*) object)->getName(1).case_sensitive;
+								name_length = name->length();
+								underscore = 0;
+								if(name_length < found_function_name_length) {
+									name = NULL;
+								} else if(po.limit_implicit_multiplication) {
+									if(name_length != name_chars_left && name_length != unit_chars_left) name = NULL;
+								} else if(name_length > name_chars_left) {
+									name = NULL;
+								}
+							}
+							break;
+						}
+						if(ufv_index < ufvl.size() && ((name_lists[0] | name_lists[1] | name_lists[2] | name_lists[3]) & NAME_INDEX_BIT(UFV_LENGTHS + 1))) {
 							switch(ufvl_t[ufv_index]) {
 								case 'v': {
 									if(po.variables_enabled && !p_mode) {
@@ -2996,6 +3069,7 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 							}
 							vt2 = 0;
 							vt3 = 0;
+							where_index = 0;
 							if(po.limit_implicit_multiplication && unit_chars_left <= UFV_LENGTHS) {
 								ufv_index = unit_chars_left - 1;
 							} else {
@@ -3004,7 +3078,7 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 						}
 					}
 					case 0: {
-						if(po.units_enabled && vt3 < ufv[vt2][ufv_index].size()) {
+						if(po.units_enabled && (name_lists[vt2] & NAME_INDEX_BIT(ufv_index + 1)) && vt3 < ufv[vt2][ufv_index].size()) {
 							object = ufv[vt2][ufv_index][vt3];
 							if(((Prefix*) object)->getName(ufv_i[vt2][ufv_index][vt3]).abbreviation) {
 								if(ufv_index < unit_chars_left - 1) {
@@ -3028,7 +3102,7 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 						vt3 = 0;
 					}
 					case 1: {
-						if(!found_function_name && po.functions_enabled && !p_mode && (!po.limit_implicit_multiplication || ufv_index + 1 == unit_chars_left || ufv_index + 1 == name_chars_left) && vt3 < ufv[vt2][ufv_index].size()) {
+						if(!found_function_name && po.functions_enabled && !p_mode && (name_lists[vt2] & NAME_INDEX_BIT(ufv_index + 1)) && (!po.limit_implicit_multiplication || ufv_index + 1 == unit_chars_left || ufv_index + 1 == name_chars_left) && vt3 < ufv[vt2][ufv_index].size()) {
 							object = ufv[vt2][ufv_index][vt3];
 							ufvt = 'f';
 							name = &((MathFunction*) object)->getName(ufv_i[vt2][ufv_index][vt3]).name;
@@ -3042,9 +3116,9 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 						vt3 = 0;
 					}
 					case 2: {
-						if(po.units_enabled && !p_mode && (!po.limit_implicit_multiplication || ufv_index + 1 == unit_chars_left) && ufv_index < unit_chars_left && vt3 < ufv[vt2][ufv_index].size()) {
+						if(po.units_enabled && !p_mode && (name_lists[vt2] & NAME_INDEX_BIT(ufv_index + 1)) && (!po.limit_implicit_multiplication || ufv_index + 1 == unit_chars_left) && ufv_index < unit_chars_left && vt3 < ufv[vt2][ufv_index].size()) {
 							object = ufv[vt2][ufv_index][vt3];
-							if(ufv_index + 1 == unit_chars_left || !((Unit*) object)->getName(ufv_i[vt2][ufv_index][vt3]).plural) {
+							if((ufv_index + 1 == unit_chars_left || !((Unit*) object)->getName(ufv_i[vt2][ufv_index][vt3]).plural) && (where_vars.empty() || !hidden_by_where_variable(((Unit*) object)->getName(ufv_i[vt2][ufv_index][vt3]), priv->ufv_us[vt2][ufv_index][vt3], where_vars))) {
 								ufvt = 'u';
 								name = &((Unit*) object)->getName(ufv_i[vt2][ufv_index][vt3]).name;
 								name_length = name->length();
@@ -3058,7 +3132,20 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 						vt3 = 0;
 					}
 					case 3: {
-						if(po.variables_enabled && !p_mode && (!po.limit_implicit_multiplication || ufv_index + 1 == unit_chars_left || ufv_index + 1 == name_chars_left) && vt3 < ufv[vt2][ufv_index].size()) {
+						if(where_index < where_vars.size() && po.variables_enabled && !p_mode && (!po.limit_implicit_multiplication || ufv_index + 1 == unit_chars_left || ufv_index + 1 == name_chars_left)) {
+							// temporary where variables are matched before other variables with names of the same length
+							object = where_vars[where_index];
+							where_index++;
+							if(((Variable*) object)->getName(1).name.length() == ufv_index + 1) {
+								ufvt = 'v';
+								name = &((Variable*) object)->getName(1).name;
+								name_length = name->length();
+								underscore = 0;
+								case_sensitive = ((Variable*) object)->getName(1).case_sensitive;
+							}
+							break;
+						}
+						if(po.variables_enabled && !p_mode && (name_lists[vt2] & NAME_INDEX_BIT(ufv_index + 1)) && (!po.limit_implicit_multiplication || ufv_index + 1 == unit_chars_left || ufv_index + 1 == name_chars_left) && vt3 < ufv[vt2][ufv_index].size()) {
 							object = ufv[vt2][ufv_index][vt3];
 							ufvt = 'v';
 							name = &((Variable*) object)->getName(ufv_i[vt2][ufv_index][vt3]).name;
@@ -3074,17 +3161,19 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 							ufv_index--;
 							vt3 = 0;
 							vt2 = 0;
+							where_index = 0;
 						}
 					}
 				}
 				if(name && name_length >= found_function_name_length && ((case_sensitive && (name_length = compare_name(*name, str, name_length, str_index, base, underscore))) || (!case_sensitive && (name_length = compare_name_no_case(*name, str, name_length, str_index, base, underscore))))) {
-					if(ufvt != 'p' && po.units_enabled && name_length < name_chars_left && name_chars_left > 2 && name_chars_left - 1 <= UFV_LENGTHS) {
+					if(ufvt != 'p' && po.units_enabled && name_length < name_chars_left && name_chars_left > 2 && name_chars_left - 1 <= UFV_LENGTHS && priv->name_index.contains(str.substr(str_index + 1, name_chars_left - 1), 2)) {
 						for(size_t i7 = 0; i7 < ufv[0][0].size(); i7++) {
 							if(((Prefix*) ufv[0][0][i7])->getName(ufv_i[0][0][i7]).name[0] == str[str_index]) {
 								for(size_t i8 = 0; i8 < ufv[2][name_chars_left - 2].size(); i8++) {
 									const ExpressionName *name_u = &((ExpressionItem*) ufv[2][name_chars_left - 2][i8])->getName(ufv_i[2][name_chars_left - 2][i8]);
 									size_t name_length_u = name_u->name.length();
 									bool underscore_u = priv->ufv_us[2][name_chars_left - 2][i8];
+									if(!where_vars.empty() && hidden_by_where_variable(*name_u, underscore_u, where_vars)) continue;
 									name_length_u -= underscore_u;
 									if(((name_u->case_sensitive && (name_length_u = compare_name(name_u->name, str, name_length_u, str_index + 1, base, underscore_u))) || (!name_u->case_sensitive && (name_length_u = compare_name_no_case(name_u->name, str, name_length_u, str_index + 1, base, underscore_u)))) && name_length_u + 1 == name_chars_left) {
 										ufvt = 'u';
@@ -3581,7 +3670,9 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 							unit_chars_left = last_unit_char - str_index + 1;
 							size_t name_length_old = name_length;
 							int index = 0;
-							if(unit_chars_left > UFV_LENGTHS) {
+							unsigned int unit_lists[4];
+							priv->name_index.match(str, str_index, unit_chars_left, unit_lists);
+							if(unit_chars_left > UFV_LENGTHS && (unit_lists[2] & NAME_INDEX_BIT(UFV_LENGTHS + 1))) {
 								for(size_t ufv_index2 = 0; ufv_index2 < ufvl.size(); ufv_index2++) {
 									name = NULL;
 									switch(ufvl_t[ufv_index2]) {
@@ -3628,12 +3719,12 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 								index = UFV_LENGTHS - 1;
 							}
 							for(; index >= 0; index--) {
-								for(size_t ufv_index2 = 0; ufv_index2 < ufv[2][index].size(); ufv_index2++) {
+								for(size_t ufv_index2 = 0; (unit_lists[2] & NAME_INDEX_BIT(index + 1)) && ufv_index2 < ufv[2][index].size(); ufv_index2++) {
 									name = &((Unit*) ufv[2][index][ufv_index2])->getName(ufv_i[2][index][ufv_index2]).name;
 									case_sensitive = ((Unit*) ufv[2][index][ufv_index2])->getName(ufv_i[2][index][ufv_index2]).case_sensitive;
 									name_length = name->length();
 									underscore = priv->ufv_us[2][index][ufv_index2]; name_length -= underscore;
-									if(index + 1 == (int) unit_chars_left || !((Unit*) ufv[2][index][ufv_index2])->getName(ufv_i[2][index][ufv_index2]).plural) {
+									if((index + 1 == (int) unit_chars_left || !((Unit*) ufv[2][index][ufv_index2])->getName(ufv_i[2][index][ufv_index2]).plural) && (where_vars.empty() || !hidden_by_where_variable(((Unit*) ufv[2][index][ufv_index2])->getName(ufv_i[2][index][ufv_index2]), underscore, where_vars))) {
 										if(name_length <= unit_chars_left && ((case_sensitive && (name_length = compare_name(*name, str, name_length, str_index, base, underscore))) || (!case_sensitive && (name_length = compare_name_no_case(*name, str, name_length, str_index, base, underscore))))) {
 											if((!p_mode && name_length_old > 1) || (p_mode && (name_length + name_length_old > best_pl || ((ufvt != 'P' || !((Unit*) ufv[2][index][ufv_index2])->getName(ufv_i[2][index][ufv_index2]).abbreviation) && name_length + name_length_old == best_pl)))) {
 												p_mode = true;
@@ -3966,8 +4057,8 @@ void Calculator::parse(MathStructure *mstruct, string str, const ParseOptions &p
 
 	if(test_or_parallel) {
 		beginTemporaryStopMessages();
-		unordered_map<size_t, size_t> ids_ref_bak = priv->ids_ref;
-		for(unordered_map<size_t, size_t>::iterator it = priv->ids_ref.begin(); it != priv->ids_ref.end(); ++it) {
+		unordered_map<size_t, size_t> ids_ref_bak = CONTEXT->ids_ref;
+		for(unordered_map<size_t, size_t>::iterator it = CONTEXT->ids_ref.begin(); it != CONTEXT->ids_ref.end(); ++it) {
 			it->second++;
 		}
 		parseOperators(mstruct, str, po);
@@ -5584,7 +5675,7 @@ bool Calculator::parseOperators(MathStructure *mstruct, string str, const ParseO
 						m_temp = NULL;
 						if(i2 != string::npos) {
 							int id = s2i(str.substr(i2 + 1, (i4 - 1) - (i2 + 1)));
-							if(priv->id_structs.find(id) != priv->id_structs.end()) m_temp = priv->id_structs[id];
+							if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end()) m_temp = CONTEXT->id_structs[id];
 						}
 						if(m_temp && m_temp->isInteger() && i2 > 3 && (str[i2 - 1] == POWER_CH || str[i2 - 1] == INTERNAL_UPOW_CH) && str[i2 - 2] == INTERNAL_ID_R_CH) {
 							i4 = i2 - 1;
@@ -5592,7 +5683,7 @@ bool Calculator::parseOperators(MathStructure *mstruct, string str, const ParseO
 							m_temp = NULL;
 							if(i2 != string::npos) {
 								int id = s2i(str.substr(i2 + 1, (i4 - 1) - (i2 + 1)));
-								if(priv->id_structs.find(id) != priv->id_structs.end()) m_temp = priv->id_structs[id];
+								if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end()) m_temp = CONTEXT->id_structs[id];
 							}
 						}
 						if(!m_temp || !m_temp->isUnit()) {
@@ -5610,7 +5701,7 @@ bool Calculator::parseOperators(MathStructure *mstruct, string str, const ParseO
 						m_temp2 = NULL;
 						if(i3 != string::npos) {
 							int id = s2i(str.substr(i4 + 2, (i3 - 1) - (i4 + 1)));
-							if(priv->id_structs.find(id) != priv->id_structs.end()) m_temp2 = priv->id_structs[id];
+							if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end()) m_temp2 = CONTEXT->id_structs[id];
 						}
 						if(!m_temp2 || !m_temp2->isUnit()) {
 							b = false;
@@ -5628,7 +5719,7 @@ bool Calculator::parseOperators(MathStructure *mstruct, string str, const ParseO
 							m_temp2 = NULL;
 							if(i4 != string::npos && i4 < str.length() - 3 && str[i4 + 1] == INTERNAL_ID_L_CH) {
 								int id = s2i(str.substr(i3 + 3, i4 - (i3 + 3)));
-								if(priv->id_structs.find(id) != priv->id_structs.end()) m_temp2 = priv->id_structs[id];
+								if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end()) m_temp2 = CONTEXT->id_structs[id];
 							}
 							if(m_temp2 && m_temp2->isInteger()) {
 								b = true;
@@ -5646,7 +5737,7 @@ bool Calculator::parseOperators(MathStructure *mstruct, string str, const ParseO
 							m_temp2 = NULL;
 							if(i4 != string::npos) {
 								int id = s2i(str.substr(i3 + 3, i4 - (i3 + 3)));
-								if(priv->id_structs.find(id) != priv->id_structs.end()) m_temp2 = priv->id_structs[id];
+								if(CONTEXT->id_structs.find(id) != CONTEXT->id_structs.end()) m_temp2 = CONTEXT->id_structs[id];
 							}
 							if(m_temp2 && m_temp2->isInteger()) {
 								i3 = i4;
@@ -6092,7 +6183,7 @@ bool Calculator::parseOperators(MathStructure *mstruct, string str, const ParseO
 					i3 = str2.rfind(INTERNAL_ID_L, i2);
 					if(i3 != string::npos) {
 						i3 = s2i(str2.substr(i3 + 1, i2 - i3 - 1));
-						if(priv->id_structs.find(i3) != priv->id_structs.end() && is_unit_multiexp(*priv->id_structs[i3])) {
+						if(CONTEXT->id_structs.find(i3) != CONTEXT->id_structs.end() && is_unit_multiexp(*CONTEXT->id_structs[i3])) {
 							b = true;
 						}
 					}
@@ -30,6 +30,8 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <vector>
+#include <math.h>
+#include <float.h>
 
 using std::string;
 using std::vector;
@@ -226,6 +228,18 @@ MathStructure Calculator::expressionToPlotVector(string expression, const MathSt
 	return y_vector;
 }
 
+void print_plot_value(string &plot_data, const Number &nr, const PrintOptions &po) {
+	// printf is much faster than Number::print() and gnuplot reads the data using double precision anyway
+	if(nr.isReal() && !nr.isInterval()) {
+		double d = nr.floatValue();
+		if(isfinite(d) && (d == 0.0 ? nr.isZero() : fabs(d) >= DBL_MIN)) {
+			plot_data += d2s(d, PRECISION > 17 ? 17 : PRECISION);
+			return;
+		}
+	}
+	plot_data += nr.print(po);
+}
+
 #ifdef HAVE_GNUPLOT_CALL
 bool Calculator::invokeGnuplot(string commands, string commandline_extra, bool persistent) {
 	if(priv->persistent_plot) persistent = true;
@@ -713,8 +727,8 @@ bool Calculator::plotVectors(PlotParameters *param, const vector<MathStructure>
 						}
 					}
 					if(!invalid_nr) {
-						if(b_imagzero_x) plot_data += x_vectors[serie].getChild(i)->number().realPart().print(po);
-						else plot_data += x_vectors[serie].getChild(i)->print(po);
+						if(b_imagzero_x) print_plot_value(plot_data, x_vectors[serie].getChild(i)->number().realPart(), po);
+						else print_plot_value(plot_data, x_vectors[serie].getChild(i)->number(), po);
 						plot_data += " ";
 						point_count++;
 					}
@@ -747,8 +761,8 @@ bool Calculator::plotVectors(PlotParameters *param, const vector<MathStructure>
 							}
 						}
 					}
-					if(b_imagzero_y) plot_data += yvalue->number().realPart().print(po);
-					else plot_data += yvalue->print(po);
+					if(b_imagzero_y) print_plot_value(plot_data, yvalue->number().realPart(), po);
+					else print_plot_value(plot_data, yvalue->number(), po);
 					plot_data += "\n";
 					prev_failed = false;
 				} else if(!prev_failed) {
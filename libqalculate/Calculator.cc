@@ -51,6 +51,9 @@ using std::iterator;
 
 Calculator *calculator = NULL;
 
+thread_local CalculatorContext *calculator_thread_context = NULL;
+std::recursive_mutex definitions_mutex;
+
 MathStructure m_undefined, m_empty_vector, m_empty_matrix, m_zero, m_one, m_minus_one, m_one_i;
 Number nr_zero, nr_one, nr_two, nr_three, nr_minus_one, nr_one_i, nr_minus_i, nr_half, nr_minus_half, nr_plus_inf, nr_minus_inf;
 EvaluationOptions no_evaluation;
@@ -117,6 +120,29 @@ long int usecs, secs, usecs2, usecs3;
 
 typedef void (*CREATEPLUG_PROC)();
 
+CalculatorContext::CalculatorContext() : disable_errors_ref(0), current_stage(MESSAGE_STAGE_UNSET), i_precision(DEFAULT_PRECISION), b_interval(true), i_stop_interval(0), i_start_interval(0), i_timeout(0), i_aborted(0), b_controlled(false), ids_i(0), parse_depth(0) {}
+CalculatorContext::~CalculatorContext() {
+	for(unordered_map<size_t, MathStructure*>::iterator it = id_structs.begin(); it != id_structs.end(); ++it) it->second->unref();
+	for(std::map<std::pair<const KnownVariable*, bool>, CalculatorVariableValue>::iterator it = variable_values.begin(); it != variable_values.end(); ++it) {
+		if(it->second.m) it->second.m->unref();
+	}
+}
+
+MathStructure **thread_variable_value(const KnownVariable *v, bool b_alt, bool b_dynamic) {
+	if(!calculator_thread_context) return NULL;
+	CalculatorVariableValue &value = calculator_thread_context->variable_values[std::make_pair(v, b_alt)];
+	if(value.m && (value.generation != CALCULATOR->definitionsGeneration() || (b_dynamic && (value.precision != CALCULATOR->getPrecision() || value.interval != CALCULATOR->usesIntervalArithmetic())))) {
+		value.m->unref();
+		value.m = NULL;
+	}
+	if(!value.m) {
+		value.generation = CALCULATOR->definitionsGeneration();
+		value.precision = CALCULATOR->getPrecision();
+		value.interval = CALCULATOR->usesIntervalArithmetic();
+	}
+	return &value.m;
+}
+
 CalculatorMessage::CalculatorMessage(string message_, MessageType type_, int cat_, int stage_) {
 	mtype = type_;
 	i_stage = stage_;
@@ -222,7 +248,6 @@ Calculator::Calculator() {
 
 	priv = new Calculator_p;
 	priv->custom_input_base_i = 0;
-	priv->ids_i = 0;
 	priv->local_currency = NULL;
 	priv->use_binary_prefixes = 0;
 	priv->temperature_calculation = TEMPERATURE_CALCULATION_HYBRID;
@@ -232,6 +257,7 @@ Calculator::Calculator() {
 	priv->concise_uncertainty_input = false;
 	priv->fixed_denominator = 2;
 	priv->definitions_locale_set = false;
+	priv->definitions_generation = 0;
 
 #ifdef HAVE_ICU
 	UErrorCode err = U_ZERO_ERROR;
@@ -252,14 +278,7 @@ Calculator::Calculator() {
 	b_exchange_rates_used = 0;
 	priv->exchange_rates_url3 = 0;
 
-	i_aborted = 0;
-	b_controlled = false;
-	i_timeout = 0;
-
 	setPrecision(DEFAULT_PRECISION);
-	b_interval = true;
-	i_stop_interval = 0;
-	i_start_interval = 0;
 
 	b_var_units = true;
 
@@ -403,7 +422,6 @@ Calculator::Calculator() {
 	ILLEGAL_IN_NAMES_MINUS_SPACE_STR = "\a\b" + DOT_S + RESERVED OPERATORS SEXADOT PARENTHESISS VECTOR_WRAPS COMMAS INTERNAL_ID_LR;
 	ILLEGAL_IN_UNITNAMES = ILLEGAL_IN_NAMES + NUMBERS;
 	b_argument_errors = true;
-	current_stage = MESSAGE_STAGE_UNSET;
 	calculator = this;
 	srand48(time(0));
 
@@ -411,7 +429,6 @@ Calculator::Calculator() {
 	addBuiltinFunctions();
 	addBuiltinUnits();
 
-	disable_errors_ref = 0;
 	b_busy = false;
 	b_gnuplot_open = false;
 	gnuplot_pipe = NULL;
@@ -474,7 +491,6 @@ Calculator::Calculator(bool ignore_locale) {
 
 	priv = new Calculator_p;
 	priv->custom_input_base_i = 0;
-	priv->ids_i = 0;
 	priv->local_currency = NULL;
 	priv->use_binary_prefixes = 0;
 	priv->temperature_calculation = TEMPERATURE_CALCULATION_HYBRID;
@@ -504,14 +520,7 @@ Calculator::Calculator(bool ignore_locale) {
 	b_exchange_rates_used = 0;
 	priv->exchange_rates_url3 = 0;
 
-	i_aborted = 0;
-	b_controlled = false;
-	i_timeout = 0;
-
 	setPrecision(DEFAULT_PRECISION);
-	b_interval = true;
-	i_stop_interval = 0;
-	i_start_interval = 0;
 
 	b_var_units = true;
 
@@ -649,7 +658,6 @@ Calculator::Calculator(bool ignore_locale) {
 	ILLEGAL_IN_NAMES_MINUS_SPACE_STR = "\a\b" + DOT_S + RESERVED OPERATORS SEXADOT PARENTHESISS VECTOR_WRAPS COMMAS INTERNAL_ID_LR;
 	ILLEGAL_IN_UNITNAMES = ILLEGAL_IN_NAMES + NUMBERS;
 	b_argument_errors = true;
-	current_stage = MESSAGE_STAGE_UNSET;
 	calculator = this;
 	srand48(time(0));
 
@@ -657,7 +665,6 @@ Calculator::Calculator(bool ignore_locale) {
 	addBuiltinFunctions();
 	addBuiltinUnits();
 
-	disable_errors_ref = 0;
 	b_busy = false;
 	b_gnuplot_open = false;
 	gnuplot_pipe = NULL;
@@ -670,8 +677,9 @@ Calculator::~Calculator() {
 	abort();
 	terminateThreads();
 	clearRPNStack();
+	priv->eval_cache.clear();
+	priv->parse_cache.clear();
 	for(unordered_map<Unit*, MathStructure*>::iterator it = priv->composite_unit_base.begin(); it != priv->composite_unit_base.end(); ++it) it->second->unref();
-	for(unordered_map<size_t, MathStructure*>::iterator it = priv->id_structs.begin(); it != priv->id_structs.end(); ++it) it->second->unref();
 #define REMOVE_EXPRESSION_ITEM(o) o->setRegistered(false); o->destroy();
 	for(size_t i = 0; i < functions.size(); i++) {REMOVE_EXPRESSION_ITEM(functions[i])}
 	for(size_t i = 0; i < variables.size(); i++) {REMOVE_EXPRESSION_ITEM(variables[i])}
@@ -775,66 +783,66 @@ bool Calculator::showArgumentErrors() const {
 	return b_argument_errors;
 }
 void Calculator::beginTemporaryStopMessages() {
-	disable_errors_ref++;
-	stopped_errors_count.push_back(0);
-	stopped_warnings_count.push_back(0);
-	stopped_messages_count.push_back(0);
+	CONTEXT->disable_errors_ref++;
+	CONTEXT->stopped_errors_count.push_back(0);
+	CONTEXT->stopped_warnings_count.push_back(0);
+	CONTEXT->stopped_messages_count.push_back(0);
 	vector<CalculatorMessage> vcm;
-	stopped_messages.push_back(vcm);
+	CONTEXT->stopped_messages.push_back(vcm);
 }
 int Calculator::endTemporaryStopMessages(int *message_count, int *warning_count, int release_messages_if_no_equal_or_greater_than_message_type) {
-	if(disable_errors_ref <= 0) return -1;
-	disable_errors_ref--;
-	int ret = stopped_errors_count[disable_errors_ref];
+	if(CONTEXT->disable_errors_ref <= 0) return -1;
+	CONTEXT->disable_errors_ref--;
+	int ret = CONTEXT->stopped_errors_count[CONTEXT->disable_errors_ref];
 	bool release_messages = false;
 	if(release_messages_if_no_equal_or_greater_than_message_type >= MESSAGE_INFORMATION) {
 		release_messages = true;
 		if(release_messages_if_no_equal_or_greater_than_message_type <= MESSAGE_ERROR && ret > 0) release_messages = false;
-		else if(release_messages_if_no_equal_or_greater_than_message_type == MESSAGE_INFORMATION && stopped_messages_count[disable_errors_ref] > 0) release_messages = false;
-		else if(release_messages_if_no_equal_or_greater_than_message_type == MESSAGE_WARNING && stopped_warnings_count[disable_errors_ref] > 0) release_messages = false;
-	}
-	if(message_count) *message_count = stopped_messages_count[disable_errors_ref];
-	if(warning_count) *warning_count = stopped_warnings_count[disable_errors_ref];
-	stopped_errors_count.pop_back();
-	stopped_warnings_count.pop_back();
-	stopped_messages_count.pop_back();
-	if(release_messages) addMessages(&stopped_messages[disable_errors_ref]);
-	stopped_messages.pop_back();
+		else if(release_messages_if_no_equal_or_greater_than_message_type == MESSAGE_INFORMATION && CONTEXT->stopped_messages_count[CONTEXT->disable_errors_ref] > 0) release_messages = false;
+		else if(release_messages_if_no_equal_or_greater_than_message_type == MESSAGE_WARNING && CONTEXT->stopped_warnings_count[CONTEXT->disable_errors_ref] > 0) release_messages = false;
+	}
+	if(message_count) *message_count = CONTEXT->stopped_messages_count[CONTEXT->disable_errors_ref];
+	if(warning_count) *warning_count = CONTEXT->stopped_warnings_count[CONTEXT->disable_errors_ref];
+	CONTEXT->stopped_errors_count.pop_back();
+	CONTEXT->stopped_warnings_count.pop_back();
+	CONTEXT->stopped_messages_count.pop_back();
+	if(release_messages) addMessages(&CONTEXT->stopped_messages[CONTEXT->disable_errors_ref]);
+	CONTEXT->stopped_messages.pop_back();
 	return ret;
 }
 void Calculator::endTemporaryStopMessages(bool release_messages, vector<CalculatorMessage> *blocked_messages) {
-	if(disable_errors_ref <= 0) return;
-	disable_errors_ref--;
-	stopped_errors_count.pop_back();
-	stopped_warnings_count.pop_back();
-	stopped_messages_count.pop_back();
-	if(blocked_messages) *blocked_messages = stopped_messages[disable_errors_ref];
-	if(release_messages) addMessages(&stopped_messages[disable_errors_ref]);
-	stopped_messages.pop_back();
+	if(CONTEXT->disable_errors_ref <= 0) return;
+	CONTEXT->disable_errors_ref--;
+	CONTEXT->stopped_errors_count.pop_back();
+	CONTEXT->stopped_warnings_count.pop_back();
+	CONTEXT->stopped_messages_count.pop_back();
+	if(blocked_messages) *blocked_messages = CONTEXT->stopped_messages[CONTEXT->disable_errors_ref];
+	if(release_messages) addMessages(&CONTEXT->stopped_messages[CONTEXT->disable_errors_ref]);
+	CONTEXT->stopped_messages.pop_back();
 }
 void Calculator::addMessages(vector<CalculatorMessage> *message_vector) {
 	for(size_t i3 = 0; i3 < message_vector->size(); i3++) {
 		string error_str = (*message_vector)[i3].message();
 		bool dup_error = false;
-		for(size_t i = 0; i < messages.size(); i++) {
-			if(error_str == messages[i].message()) {
+		for(size_t i = 0; i < CONTEXT->messages.size(); i++) {
+			if(error_str == CONTEXT->messages[i].message()) {
 				dup_error = true;
 				break;
 			}
 		}
 		if(!dup_error) {
-			if(disable_errors_ref > 0) {
-				for(size_t i2 = 0; !dup_error && i2 < (size_t) disable_errors_ref; i2++) {
-					for(size_t i = 0; i < stopped_messages[i2].size(); i++) {
-						if(error_str == stopped_messages[i2][i].message()) {
+			if(CONTEXT->disable_errors_ref > 0) {
+				for(size_t i2 = 0; !dup_error && i2 < (size_t) CONTEXT->disable_errors_ref; i2++) {
+					for(size_t i = 0; i < CONTEXT->stopped_messages[i2].size(); i++) {
+						if(error_str == CONTEXT->stopped_messages[i2][i].message()) {
 							dup_error = true;
 							break;
 						}
 					}
 				}
-				if(!dup_error) stopped_messages[disable_errors_ref - 1].push_back((*message_vector)[i3]);
+				if(!dup_error) CONTEXT->stopped_messages[CONTEXT->disable_errors_ref - 1].push_back((*message_vector)[i3]);
 			} else {
-				messages.push_back((*message_vector)[i3]);
+				CONTEXT->messages.push_back((*message_vector)[i3]);
 			}
 		}
 	}
@@ -984,6 +992,9 @@ ExpressionItem *Calculator::getActiveExpressionItem(string name_, ExpressionItem
 }
 ExpressionItem *Calculator::getActiveExpressionItem(string name_, ExpressionItem *item) {
 	if(name_.empty()) return NULL;
+	unsigned int lists[4];
+	priv->name_index.match(name_, 0, name_.length(), lists);
+	if(!((lists[1] | lists[2] | lists[3]) & NAME_INDEX_BIT(name_.length()))) return NULL;
 	size_t l = name_.length();
 	if(l > UFV_LENGTHS) {
 		for(size_t i = 0; i < ufvl.size(); i++) {
@@ -1403,11 +1414,14 @@ Prefix *Calculator::addPrefix(Prefix *p) {
 	return p;
 }
 void Calculator::prefixNameChanged(Prefix *p, bool new_item) {
+	std::lock_guard<std::recursive_mutex> lock(definitions_mutex);
+	priv->definitions_generation++;
 	size_t l2;
 	if(!new_item) delPrefixUFV(p);
 	for(size_t i2 = 1; i2 <= p->countNames(); i2++) {
 		const ExpressionName &ename = p->getName(i2);
 		l2 = ename.name.length();
+		priv->name_index.add(p, 0, ename, 0);
 		if(l2 > UFV_LENGTHS) {
 			size_t i = 0, l;
 			for(vector<void*>::iterator it = ufvl.begin(); ; ++it) {
@@ -1448,30 +1462,30 @@ void Calculator::setPrecision(int precision) {
 	initialize_global_variables();
 	if(precision <= 0) precision = DEFAULT_PRECISION;
 	if(PRECISION_TO_BITS(precision) > (double) MPFR_PREC_MAX - 1000L) {
-		if(BITS_TO_PRECISION(MPFR_PREC_MAX) > INT_MAX) i_precision = INT_MAX;
-		else i_precision = (int) BITS_TO_PRECISION(MPFR_PREC_MAX - 1000L);
+		if(BITS_TO_PRECISION(MPFR_PREC_MAX) > INT_MAX) CONTEXT->i_precision = INT_MAX;
+		else CONTEXT->i_precision = (int) BITS_TO_PRECISION(MPFR_PREC_MAX - 1000L);
 		mpfr_set_default_prec(MPFR_PREC_MAX - 1000L);
 	} else {
-		i_precision = precision;
-		mpfr_set_default_prec(PRECISION_TO_BITS(i_precision));
+		CONTEXT->i_precision = precision;
+		mpfr_set_default_prec(PRECISION_TO_BITS(CONTEXT->i_precision));
 	}
 }
 int Calculator::getPrecision() const {
-	return i_precision;
+	return CONTEXT->i_precision;
 }
-void Calculator::useIntervalArithmetic(bool use_interval_arithmetic) {b_interval = use_interval_arithmetic;}
-bool Calculator::usesIntervalArithmetic() const {return i_start_interval > 0 || (b_interval && i_stop_interval <= 0);}
+void Calculator::useIntervalArithmetic(bool use_interval_arithmetic) {CONTEXT->b_interval = use_interval_arithmetic;}
+bool Calculator::usesIntervalArithmetic() const {return CONTEXT->i_start_interval > 0 || (CONTEXT->b_interval && CONTEXT->i_stop_interval <= 0);}
 void Calculator::beginTemporaryStopIntervalArithmetic() {
-	i_stop_interval++;
+	CONTEXT->i_stop_interval++;
 }
 void Calculator::endTemporaryStopIntervalArithmetic() {
-	i_stop_interval--;
+	CONTEXT->i_stop_interval--;
 }
 void Calculator::beginTemporaryEnableIntervalArithmetic() {
-	i_start_interval++;
+	CONTEXT->i_start_interval++;
 }
 void Calculator::endTemporaryEnableIntervalArithmetic() {
-	i_start_interval--;
+	CONTEXT->i_start_interval--;
 }
 
 bool Calculator::usesMatlabStyleMatrices() const {return priv->matlab_matrices;}
@@ -1526,6 +1540,7 @@ string Calculator::localWhereString() const {
 }
 void Calculator::setLocale() {
 	if(b_ignore_locale) return;
+	priv->definitions_generation++;
 	if(saved_locale) setlocale(LC_NUMERIC, saved_locale);
 	lconv *locale = localeconv();
 	if(strcmp(locale->decimal_point, ",") == 0) {
@@ -1581,12 +1596,14 @@ bool Calculator::getIgnoreLocale() {
 	return b_ignore_locale;
 }
 void Calculator::useDecimalComma() {
+	priv->definitions_generation++;
 	DOT_STR = ",";
 	DOT_S = ".,";
 	COMMA_STR = ";";
 	COMMA_S = ";";
 }
 void Calculator::useDecimalPoint(bool use_comma_as_separator) {
+	priv->definitions_generation++;
 	DOT_STR = ".";
 	DOT_S = ".";
 	if(use_comma_as_separator) {
@@ -1598,6 +1615,7 @@ void Calculator::useDecimalPoint(bool use_comma_as_separator) {
 	}
 }
 void Calculator::unsetLocale() {
+	priv->definitions_generation++;
 	COMMA_STR = ",";
 	COMMA_S = ",;";
 	DOT_STR = ".";
@@ -2039,12 +2057,12 @@ void Calculator::message(MessageType mtype, const char *TEMPLATE, ...) {
 	va_end(ap);
 }
 void Calculator::message(MessageType mtype, int message_category, const char *TEMPLATE, va_list ap) {
-	if(disable_errors_ref > 0) {
-		stopped_messages_count[disable_errors_ref - 1]++;
+	if(CONTEXT->disable_errors_ref > 0) {
+		CONTEXT->stopped_messages_count[CONTEXT->disable_errors_ref - 1]++;
 		if(mtype == MESSAGE_ERROR) {
-			stopped_errors_count[disable_errors_ref - 1]++;
+			CONTEXT->stopped_errors_count[CONTEXT->disable_errors_ref - 1]++;
 		} else if(mtype == MESSAGE_WARNING) {
-			stopped_warnings_count[disable_errors_ref - 1]++;
+			CONTEXT->stopped_warnings_count[CONTEXT->disable_errors_ref - 1]++;
 		}
 	}
 	string error_str = TEMPLATE;
@@ -2078,16 +2096,16 @@ void Calculator::message(MessageType mtype, int message_category, const char *TE
 		}
 	}
 	bool dup_error = false;
-	for(i = 0; i < messages.size(); i++) {
-		if(error_str == messages[i].message()) {
+	for(i = 0; i < CONTEXT->messages.size(); i++) {
+		if(error_str == CONTEXT->messages[i].message()) {
 			dup_error = true;
 			break;
 		}
 	}
-	if(disable_errors_ref > 0) {
-		for(size_t i2 = 0; !dup_error && i2 < (size_t) disable_errors_ref; i2++) {
-			for(i = 0; i < stopped_messages[i2].size(); i++) {
-				if(error_str == stopped_messages[i2][i].message()) {
+	if(CONTEXT->disable_errors_ref > 0) {
+		for(size_t i2 = 0; !dup_error && i2 < (size_t) CONTEXT->disable_errors_ref; i2++) {
+			for(i = 0; i < CONTEXT->stopped_messages[i2].size(); i++) {
+				if(error_str == CONTEXT->stopped_messages[i2][i].message()) {
 					dup_error = true;
 					break;
 				}
@@ -2095,35 +2113,35 @@ void Calculator::message(MessageType mtype, int message_category, const char *TE
 		}
 	}
 	if(!dup_error) {
-		if(disable_errors_ref > 0) stopped_messages[disable_errors_ref - 1].push_back(CalculatorMessage(error_str, mtype, message_category, current_stage));
-		else messages.push_back(CalculatorMessage(error_str, mtype, message_category, current_stage));
+		if(CONTEXT->disable_errors_ref > 0) CONTEXT->stopped_messages[CONTEXT->disable_errors_ref - 1].push_back(CalculatorMessage(error_str, mtype, message_category, CONTEXT->current_stage));
+		else CONTEXT->messages.push_back(CalculatorMessage(error_str, mtype, message_category, CONTEXT->current_stage));
 	}
 }
 CalculatorMessage* Calculator::message() {
-	if(!messages.empty()) {
-		return &messages[0];
+	if(!CONTEXT->messages.empty()) {
+		return &CONTEXT->messages[0];
 	}
 	return NULL;
 }
 CalculatorMessage* Calculator::nextMessage() {
-	if(!messages.empty()) {
-		messages.erase(messages.begin());
-		if(!messages.empty()) {
-			return &messages[0];
+	if(!CONTEXT->messages.empty()) {
+		CONTEXT->messages.erase(CONTEXT->messages.begin());
+		if(!CONTEXT->messages.empty()) {
+			return &CONTEXT->messages[0];
 		}
 	}
 	return NULL;
 }
 void Calculator::clearMessages() {
-	messages.clear();
+	CONTEXT->messages.clear();
 }
 void Calculator::cleanMessages(const MathStructure &mstruct, size_t first_message) {
 	if(first_message > 0) first_message--;
-	if(messages.size() <= first_message) return;
+	if(CONTEXT->messages.size() <= first_message) return;
 	if(mstruct.containsInterval(true, false, false, -2, true) <= 0) {
-		for(size_t i = messages.size() - 1; ; i--) {
-			if(messages[i].category() == MESSAGE_CATEGORY_WIDE_INTERVAL) {
-				messages.erase(messages.begin() + i);
+		for(size_t i = CONTEXT->messages.size() - 1; ; i--) {
+			if(CONTEXT->messages[i].category() == MESSAGE_CATEGORY_WIDE_INTERVAL) {
+				CONTEXT->messages.erase(CONTEXT->messages.begin() + i);
 			}
 			if(i == first_message) break;
 		}
@@ -2187,6 +2205,9 @@ Unit* Calculator::addUnit(Unit *u, bool force, bool check_names) {
 	return u;
 }
 void Calculator::delPrefixUFV(Prefix *object) {
+	std::lock_guard<std::recursive_mutex> lock(definitions_mutex);
+	priv->definitions_generation++;
+	priv->name_index.remove(object);
 	int i = 0;
 	for(vector<void*>::iterator it = ufvl.begin(); ; ++it) {
 		del_ufvl:
@@ -2221,7 +2242,22 @@ void Calculator::delPrefixUFV(Prefix *object) {
 		}
 	}
 }
+size_t Calculator::definitionsGeneration() const {return priv->definitions_generation;}
+void Calculator::definitionsChanged() {priv->definitions_generation++;}
+void Calculator::setEvaluationCacheSize(size_t max_entries) {priv->eval_cache.setMaxSize(max_entries);}
+size_t Calculator::evaluationCacheSize() const {return priv->eval_cache.maxSize();}
+void Calculator::clearEvaluationCache() {priv->eval_cache.clear();}
+size_t Calculator::evaluationCacheHits() const {return priv->eval_cache.hits;}
+size_t Calculator::evaluationCacheMisses() const {return priv->eval_cache.misses;}
+void Calculator::setParseCacheSize(size_t max_entries) {priv->parse_cache.setMaxSize(max_entries);}
+size_t Calculator::parseCacheSize() const {return priv->parse_cache.maxSize();}
+void Calculator::clearParseCache() {priv->parse_cache.clear();}
+size_t Calculator::parseCacheHits() const {return priv->parse_cache.hits;}
+size_t Calculator::parseCacheMisses() const {return priv->parse_cache.misses;}
 void Calculator::delUFV(ExpressionItem *object) {
+	std::lock_guard<std::recursive_mutex> lock(definitions_mutex);
+	priv->definitions_generation++;
+	priv->name_index.remove(object);
 	int i = 0;
 	for(vector<void*>::iterator it = ufvl.begin(); ; ++it) {
 		del_ufvl:
@@ -2298,7 +2334,7 @@ Unit *Calculator::getActiveUnit(string name_, bool ignore_us) {
 	return getActiveUnit(name_);
 }
 Unit* Calculator::getActiveUnit(string name_) {
-	if(name_.empty()) return NULL;
+	if(name_.empty() || !priv->name_index.contains(name_, 2)) return NULL;
 	size_t l = name_.length();
 	if(l > UFV_LENGTHS) {
 		for(size_t i = 0; i < ufvl.size(); i++) {
@@ -2473,7 +2509,206 @@ void Calculator::expressionItemDeleted(ExpressionItem *item) {
 		}
 	}
 }
+ExpressionNameIndex::ExpressionNameIndex() {
+	// root nodes for case sensitive and lower case names
+	nodes.resize(2);
+}
+size_t ExpressionNameIndex::child(size_t node, char c) const {
+	const vector<std::pair<char, size_t> > &children = nodes[node].children;
+	for(size_t i = 0; i < children.size(); i++) {
+		if(children[i].first == c) return children[i].second;
+	}
+	return string::npos;
+}
+void ExpressionNameIndex::add(void *object, int type, const ExpressionName &ename, size_t ignore_us) {
+	const string &name = ename.name;
+	if(name.length() <= ignore_us) return;
+	size_t l = name.length() - ignore_us;
+	ExpressionNameIndexEntry entry;
+	entry.object = object;
+	entry.type = type;
+	entry.length_bit = NAME_INDEX_BIT(l);
+	// the string comparison functions do not agree on whether a leading underscore should be ignored
+	bool b_unindexed = (ignore_us > 0 && name[0] == '_');
+	if(!ename.case_sensitive) {
+		for(size_t i = 0; !b_unindexed && i < name.length(); i++) {
+			if((signed char) name[i] < 0) b_unindexed = true;
+		}
+	}
+	if(b_unindexed) {
+		unindexed.push_back(entry);
+		object_nodes[object].push_back(string::npos);
+		return;
+	}
+	size_t node = (ename.case_sensitive ? 0 : 1);
+	// skip underscores in the same way as compare_name()
+	for(size_t i = 0, ip = 0; i < l; i++) {
+		if(i > 0 && ignore_us > 0 && name[i + ip] == '_') {ip++; ignore_us--;}
+		char c = name[i + ip];
+		if(!ename.case_sensitive && c >= 'A' && c <= 'Z') c += 32;
+		size_t node2 = child(node, c);
+		if(node2 == string::npos) {
+			node2 = nodes.size();
+			nodes[node].children.push_back(std::pair<char, size_t>(c, node2));
+			nodes.resize(nodes.size() + 1);
+		}
+		node = node2;
+	}
+	nodes[node].entries.push_back(entry);
+	object_nodes[object].push_back(node);
+}
+void ExpressionNameIndex::remove(void *object) {
+	unordered_map<void*, vector<size_t> >::iterator it = object_nodes.find(object);
+	if(it == object_nodes.end()) return;
+	for(size_t i = 0; i < it->second.size(); i++) {
+		vector<ExpressionNameIndexEntry> &entries = (it->second[i] == string::npos ? unindexed : nodes[it->second[i]].entries);
+		for(size_t i2 = 0; i2 < entries.size();) {
+			if(entries[i2].object == object) entries.erase(entries.begin() + i2);
+			else i2++;
+		}
+	}
+	object_nodes.erase(it);
+}
+void ExpressionNameIndex::match(const string &str, size_t index, size_t max_length, unsigned int *lists) const {
+	for(size_t i = 0; i < 4; i++) lists[i] = 0;
+	for(size_t i = 0; i < unindexed.size(); i++) lists[unindexed[i].type] |= unindexed[i].length_bit;
+	size_t node_cs = 0, node_ci = 1;
+	for(size_t i = 0; i < max_length && index + i < str.length(); i++) {
+		char c = str[index + i];
+		if((signed char) c < 0) {
+			// non-ASCII characters might be equal to ASCII characters when case is ignored (e.g. Kelvin sign and k), include all longer names
+			unsigned int bits = (i >= UFV_LENGTHS ? NAME_INDEX_BIT(UFV_LENGTHS + 1) : ~(NAME_INDEX_BIT(i + 1) - 1));
+			for(size_t i2 = 0; i2 < 4; i2++) lists[i2] |= bits;
+			break;
+		}
+		if(node_cs != string::npos) node_cs = child(node_cs, c);
+		if(node_ci != string::npos) node_ci = child(node_ci, (c >= 'A' && c <= 'Z') ? c + 32 : c);
+		if(node_cs == string::npos && node_ci == string::npos) break;
+		if(node_cs != string::npos) {
+			const vector<ExpressionNameIndexEntry> &entries = nodes[node_cs].entries;
+			for(size_t i2 = 0; i2 < entries.size(); i2++) lists[entries[i2].type] |= entries[i2].length_bit;
+		}
+		if(node_ci != string::npos) {
+			const vector<ExpressionNameIndexEntry> &entries = nodes[node_ci].entries;
+			for(size_t i2 = 0; i2 < entries.size(); i2++) lists[entries[i2].type] |= entries[i2].length_bit;
+		}
+	}
+}
+bool ExpressionNameIndex::contains(const string &name, int type) const {
+	if(name.empty()) return false;
+	unsigned int lists[4];
+	match(name, 0, name.length(), lists);
+	return lists[type] & NAME_INDEX_BIT(name.length());
+}
+// stricter than MathStructure::equals(): also compares number types, approximation, precision and protection
+bool cache_structures_identical(const MathStructure &m1, const MathStructure &m2) {
+	if(m1.type() != m2.type() || m1.size() != m2.size() || m1.isApproximate() != m2.isApproximate() || m1.precision() != m2.precision() || m1.isProtected() != m2.isProtected()) return false;
+	switch(m1.type()) {
+		case STRUCT_NUMBER: {
+			const Number &nr1 = m1.number(), &nr2 = m2.number();
+			if(nr1.internalType() != nr2.internalType() || nr1.hasImaginaryPart() != nr2.hasImaginaryPart()) return false;
+			if(nr1.hasImaginaryPart() && nr1.internalImaginary()->internalType() != nr2.internalImaginary()->internalType()) return false;
+			return nr1.equals(nr2, true, true);
+		}
+		case STRUCT_ABORTED: {}
+		case STRUCT_SYMBOLIC: {return m1.symbol() == m2.symbol();}
+		case STRUCT_DATETIME: {return *m1.datetime() == *m2.datetime();}
+		case STRUCT_VARIABLE: {return m1.variable() == m2.variable();}
+		case STRUCT_UNIT: {return m1.unit() == m2.unit() && m1.prefix() == m2.prefix();}
+		case STRUCT_FUNCTION: {if(m1.function() != m2.function()) return false; break;}
+		case STRUCT_COMPARISON: {if(m1.comparisonType() != m2.comparisonType()) return false; break;}
+		default: {}
+	}
+	for(size_t i = 0; i < m1.size(); i++) {
+		if(!cache_structures_identical(m1[i], m2[i])) return false;
+	}
+	return true;
+}
+
+StructureCache::StructureCache() : max_size(0), generation(0), hits(0), misses(0) {}
+StructureCache::~StructureCache() {
+	clear();
+}
+size_t StructureCache::maxSize() const {
+	return max_size;
+}
+void StructureCache::setMaxSize(size_t size) {
+	std::lock_guard<std::mutex> lock(mutex);
+	max_size = size;
+	while(entries.size() > max_size) removeEntry(--entries.end());
+}
+void StructureCache::removeEntry(std::list<Entry>::iterator it) {
+	std::pair<std::multimap<size_t, std::list<Entry>::iterator>::iterator, std::multimap<size_t, std::list<Entry>::iterator>::iterator> range = index.equal_range(it->hash);
+	for(std::multimap<size_t, std::list<Entry>::iterator>::iterator it2 = range.first; it2 != range.second; ++it2) {
+		if(it2->second == it) {
+			index.erase(it2);
+			break;
+		}
+	}
+	if(it->mkey) it->mkey->unref();
+	it->mvalue->unref();
+	entries.erase(it);
+}
+void StructureCache::clear() {
+	std::lock_guard<std::mutex> lock(mutex);
+	for(std::list<Entry>::iterator it = entries.begin(); it != entries.end(); ++it) {
+		if(it->mkey) it->mkey->unref();
+		it->mvalue->unref();
+	}
+	entries.clear();
+	index.clear();
+}
+bool StructureCache::get(size_t hash, const string &key, const MathStructure *mkey, MathStructure &mvalue, vector<CalculatorMessage> *messages, size_t current_generation) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if(current_generation != generation) {
+		while(!entries.empty()) removeEntry(entries.begin());
+		generation = current_generation;
+	}
+	std::pair<std::multimap<size_t, std::list<Entry>::iterator>::iterator, std::multimap<size_t, std::list<Entry>::iterator>::iterator> range = index.equal_range(hash);
+	for(std::multimap<size_t, std::list<Entry>::iterator>::iterator it = range.first; it != range.second; ++it) {
+		Entry &e = *it->second;
+		if(e.key == key && (!mkey || cache_structures_identical(*mkey, *e.mkey))) {
+			// move to front of the list of recently used entries
+			entries.splice(entries.begin(), entries, it->second);
+			mvalue.set(*e.mvalue);
+			if(messages) {
+				// append messages which have not already been added
+				for(size_t i = 0; i < e.messages.size(); i++) {
+					bool b_dup = false;
+					for(size_t i2 = 0; i2 < messages->size(); i2++) {
+						if((*messages)[i2].message() == e.messages[i].message()) {b_dup = true; break;}
+					}
+					if(!b_dup) messages->push_back(e.messages[i]);
+				}
+			}
+			hits++;
+			return true;
+		}
+	}
+	misses++;
+	return false;
+}
+void StructureCache::add(size_t hash, const string &key, const MathStructure *mkey, const MathStructure &mvalue, const vector<CalculatorMessage> *messages, size_t current_generation) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if(max_size == 0) return;
+	if(current_generation != generation) {
+		while(!entries.empty()) removeEntry(entries.begin());
+		generation = current_generation;
+	}
+	Entry e;
+	e.hash = hash;
+	e.key = key;
+	e.mkey = mkey ? new MathStructure(*mkey) : NULL;
+	e.mvalue = new MathStructure(mvalue);
+	if(messages) e.messages = *messages;
+	entries.push_front(e);
+	index.insert(std::pair<size_t, std::list<Entry>::iterator>(hash, entries.begin()));
+	while(entries.size() > max_size) removeEntry(--entries.end());
+}
+
 void Calculator::nameChanged(ExpressionItem *item, bool new_item) {
+	std::lock_guard<std::recursive_mutex> lock(definitions_mutex);
+	priv->definitions_generation++;
 	if(!item->isActive() || item->countNames() == 0) return;
 	if(item->type() == TYPE_UNIT && ((Unit*) item)->subtype() == SUBTYPE_COMPOSITE_UNIT) {
 		return;
@@ -2487,6 +2722,7 @@ void Calculator::nameChanged(ExpressionItem *item, bool new_item) {
 		l2 = item->getName(i2).name.length();
 		size_t i_us = 0;
 		while(true) {
+			if(l2 > 0) priv->name_index.add(item, itype, item->getName(i2), i_us);
 			if(l2 > UFV_LENGTHS) {
 				size_t i = 0, l = 0;
 				for(vector<void*>::iterator it = ufvl.begin(); ; ++it) {
@@ -2612,7 +2848,7 @@ Variable *Calculator::getActiveVariable(string name_, bool ignore_us) {
 	return getActiveVariable(name_);
 }
 Variable* Calculator::getActiveVariable(string name_) {
-	if(name_.empty()) return NULL;
+	if(name_.empty() || !priv->name_index.contains(name_, 3)) return NULL;
 	size_t l = name_.length();
 	if(l > UFV_LENGTHS) {
 		for(size_t i = 0; i < ufvl.size(); i++) {
@@ -2783,7 +3019,7 @@ MathFunction *Calculator::getActiveFunction(string name_, bool ignore_us) {
 	return getActiveFunction(name_);
 }
 MathFunction* Calculator::getActiveFunction(string name_) {
-	if(name_.empty()) return NULL;
+	if(name_.empty() || !priv->name_index.contains(name_, 1)) return NULL;
 	size_t l = name_.length();
 	if(l > UFV_LENGTHS) {
 		for(size_t i = 0; i < ufvl.size(); i++) {
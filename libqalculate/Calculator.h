@@ -272,13 +272,7 @@ class Calculator {
 
   protected:
 
-	std::vector<CalculatorMessage> messages;
-
 	int ianglemode;
-	int i_precision;
-	bool b_interval;
-	int i_stop_interval;
-	int i_start_interval;
 	char vbuffer[200];
 	std::vector<void*> ufvl;
 	std::vector<char> ufvl_t;
@@ -296,18 +290,12 @@ class Calculator {
 	std::vector<std::string> default_real_signs;
 	bool b_ignore_locale;
 	char *saved_locale;
-	int disable_errors_ref;
-	std::vector<int> stopped_errors_count;
-	std::vector<int> stopped_warnings_count;
-	std::vector<int> stopped_messages_count;
-	std::vector<std::vector<CalculatorMessage> > stopped_messages;
 
 	Thread *calculate_thread;
 
 	std::string NAME_NUMBER_PRE_S, NAME_NUMBER_PRE_STR, DOT_STR, DOT_S, COMMA_S, COMMA_STR, ILLEGAL_IN_NAMES, ILLEGAL_IN_UNITNAMES, ILLEGAL_IN_NAMES_MINUS_SPACE_STR;
 
 	bool b_argument_errors;
-	int current_stage;
 
 	time_t exchange_rates_time[3], exchange_rates_check_time[3];
 	int b_exchange_rates_used;
@@ -329,11 +317,6 @@ class Calculator {
 
 	bool b_save_called;
 
-	int i_timeout;
-	struct timeval t_end;
-	int i_aborted;
-	bool b_controlled;
-
 	std::string per_str, times_str, plus_str, minus_str, and_str, AND_str, or_str, OR_str, XOR_str;
 	size_t per_str_len, times_str_len, plus_str_len, minus_str_len, and_str_len, AND_str_len, or_str_len, OR_str_len, XOR_str_len;
 
@@ -341,6 +324,8 @@ class Calculator {
 
 	bool calculateRPN(MathStructure *mstruct, int command, size_t index, int msecs, const EvaluationOptions &eo, int function_arguments = 0);
 	bool calculateRPN(std::string str, int command, size_t index, int msecs, const EvaluationOptions &eo, MathStructure *parsed_struct, MathStructure *to_struct, bool make_to_division, int function_arguments = 0);
+	void evalCached(MathStructure &mstruct, const EvaluationOptions &eo);
+	void parseUncached(MathStructure *mstruct, std::string str, const ParseOptions &po);
 
   public:
 
@@ -549,6 +534,68 @@ class Calculator {
 	void clearBuffers();
 	/** Terminate calculation and print threads if started. Do not use to terminate calculation. */
 	void terminateThreads();
+	/** Creates a separate calculation state for the calling thread, allowing calculations in multiple threads simultaneously.
+	* The calculation state includes precision, interval arithmetic, abort and timeout control (startControl()), messages, and temporary ids (addId()). The initial precision and interval arithmetic setting are copied from the main calculation state.
+	* Definitions (variables, functions, units, etc.) and other settings are shared by all threads and must not be changed while calculations are running in other threads.
+	*
+	* Use only synchronous calculation functions (e.g. calculate(std::string, const EvaluationOptions&, ...) and calculateAndPrint()) from threads with a separate state. Always call endThreadContext() before the thread exits.
+	*
+	* @returns false if the calling thread already has a separate calculation state.
+	* \since 5.12.0
+	*/
+	bool beginThreadContext();
+	/** Removes the separate calculation state of the calling thread, created by beginThreadContext().
+	* \since 5.12.0
+	*/
+	void endThreadContext();
+	//@}
+
+	/** @name Functions for caching of parsed expressions and calculation results */
+	//@{
+	/** Sets the maximum number of evaluation results stored in the evaluation cache. When enabled, calculate() looks up the parsed expression, together with the evaluation options, precision and interval arithmetic setting, in the cache before evaluating it. The least recently used result is removed when the cache is full. The cache is emptied when definitions are changed (see definitionsGeneration()). Expressions with random or time dependent values, with side effects, or with variables with assigned values (e.g. the last answer), also through user functions and variable expressions, are never cached.
+	*
+	* @param max_entries Maximum number of cached results (zero disables the cache, which is the default).
+	* \since 5.12.0
+	*/
+	void setEvaluationCacheSize(size_t max_entries);
+	/** Returns the maximum number of cached evaluation results (zero if the evaluation cache is disabled).
+	* \since 5.12.0
+	*/
+	size_t evaluationCacheSize() const;
+	/** Removes all results from the evaluation cache.
+	* \since 5.12.0
+	*/
+	void clearEvaluationCache();
+	/** Returns the number of times an evaluation result has been found in the evaluation cache.
+	* \since 5.12.0
+	*/
+	size_t evaluationCacheHits() const;
+	/** Returns the number of times an evaluation result has not been found in the evaluation cache.
+	* \since 5.12.0
+	*/
+	size_t evaluationCacheMisses() const;
+	/** Sets the maximum number of parsed expressions stored in the parse cache. When enabled, parse() looks up the expression string, together with the parse options, decimal and digit separators, precision and interval arithmetic setting, in the cache before parsing it. The least recently used expression is removed when the cache is full. The cache is emptied when definitions are changed (see definitionsGeneration()).
+	*
+	* @param max_entries Maximum number of cached expressions (zero disables the cache, which is the default).
+	* \since 5.12.0
+	*/
+	void setParseCacheSize(size_t max_entries);
+	/** Returns the maximum number of cached parsed expressions (zero if the parse cache is disabled).
+	* \since 5.12.0
+	*/
+	size_t parseCacheSize() const;
+	/** Removes all expressions from the parse cache.
+	* \since 5.12.0
+	*/
+	void clearParseCache();
+	/** Returns the number of times a parsed expression has been found in the parse cache.
+	* \since 5.12.0
+	*/
+	size_t parseCacheHits() const;
+	/** Returns the number of times a parsed expression has not been found in the parse cache.
+	* \since 5.12.0
+	*/
+	size_t parseCacheMisses() const;
 	//@}
 
 	/** @name Functions for manipulation of the RPN stack. */
@@ -916,6 +963,10 @@ class Calculator {
 	Unit* addUnit(Unit *u, bool force = true, bool check_names = true);
 	void delPrefixUFV(Prefix *object);
 	void delUFV(ExpressionItem *object);
+	/** Returns a counter which is increased whenever names of functions, variables, units or prefixes, or other definitions which might affect parsing or calculation, have been changed. Used for invalidation of pre-parsed expressions and cached results.*/
+	size_t definitionsGeneration() const;
+	/** Used internally. Increases the counter returned by definitionsGeneration(). */
+	void definitionsChanged();
 	/** Checks if a variable exists/is registered in the calculator. */
 	bool hasVariable(Variable *v);
 	/** Checks if a unit exists/is registered in the calculator. */
@@ -44,6 +44,14 @@
 #ifndef CALCULATOR_P_H
 #define CALCULATOR_P_H
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+
 enum {
 	PROC_RPN_ADD,
 	PROC_RPN_SET,
@@ -56,15 +64,135 @@ enum {
 #define DO_NOT_TOUCH_EXPRESSION_C(str, po)	(po.base == BASE_UNICODE || (po.base == BASE_CUSTOM && CALCULATOR->customInputBase() > 62) || (str.length() > 3 && str[0] == '$' && str[str.length() - 1] == '$' && str.find("\\") != string::npos))
 #define DO_NOT_TOUCH_EXPRESSION(str, po)	(po.base == BASE_UNICODE || (po.base == BASE_CUSTOM && priv->custom_input_base_i > 62) || (str.length() > 3 && str[0] == '$' && str[str.length() - 1] == '$' && str.find("\\") != string::npos))
 
-class Calculator_p {
+// value of a known variable calculated in a thread with a separate calculation context
+struct CalculatorVariableValue {
+	MathStructure *m;
+	int precision;
+	bool interval;
+	size_t generation;
+	CalculatorVariableValue() : m(NULL), precision(-1), interval(false), generation(0) {}
+};
+
+// state of the current calculation (see Calculator::beginThreadContext())
+class CalculatorContext {
 	public:
+		std::vector<CalculatorMessage> messages;
+		int disable_errors_ref;
+		std::vector<int> stopped_errors_count;
+		std::vector<int> stopped_warnings_count;
+		std::vector<int> stopped_messages_count;
+		std::vector<std::vector<CalculatorMessage> > stopped_messages;
+		int current_stage;
+		int i_precision;
+		bool b_interval;
+		int i_stop_interval;
+		int i_start_interval;
+		int i_timeout;
+		struct timeval t_end;
+		// 1 if aborted, 2 if timed out (set by CalculatorTimer)
+		std::atomic<int> i_aborted;
+		bool b_controlled;
 		unordered_map<size_t, MathStructure*> id_structs;
 		unordered_map<size_t, bool> ids_p;
 		unordered_map<size_t, size_t> ids_ref;
-		std::vector<size_t> ufvl_us;
-		std::vector<size_t> ufv_us[4][20];
 		std::vector<size_t> freed_ids;
 		size_t ids_i;
+		int parse_depth;
+		// values of known variables calculated in this context (see thread_variable_value())
+		std::map<std::pair<const KnownVariable*, bool>, CalculatorVariableValue> variable_values;
+		// temporary variables from where expressions, matched by parse() before names in the shared lists (the most recently added first)
+		std::vector<Variable*> where_variables;
+		CalculatorContext();
+		~CalculatorContext();
+};
+
+// separate calculation state of the current thread, or NULL if the state of the Calculator is used
+extern thread_local CalculatorContext *calculator_thread_context;
+
+#define CONTEXT (calculator_thread_context ? calculator_thread_context : &priv->context)
+
+// sets the abort flag of calculation contexts when the time limit has been reached, allowing Calculator::aborted() to only check the flag
+class CalculatorTimer {
+	protected:
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::thread timer_thread;
+		std::multimap<std::chrono::steady_clock::time_point, CalculatorContext*> deadlines;
+		bool b_quit;
+		void run();
+	public:
+		CalculatorTimer();
+		~CalculatorTimer();
+		void add(CalculatorContext *ctx, int milliseconds);
+		void remove(CalculatorContext *ctx);
+};
+
+struct ExpressionNameIndexEntry {
+	void *object;
+	// index of ufv (0 = prefix, 1 = function, 2 = unit, 3 = variable)
+	int type;
+	unsigned int length_bit;
+};
+
+// bit representing names of length l (excluding ignored underscores) in the masks of ExpressionNameIndex::match(); names longer than UFV_LENGTHS share the same bit
+#define NAME_INDEX_BIT(l) ((l) > UFV_LENGTHS ? (1U << UFV_LENGTHS) : (1U << ((l) - 1)))
+
+// prefix tree of the active names in ufv and ufvl (case sensitive names and, separately, lower case versions of case insensitive names), used to skip name lists that cannot contain a match
+class ExpressionNameIndex {
+	protected:
+		struct Node {
+			std::vector<std::pair<char, size_t> > children;
+			std::vector<ExpressionNameIndexEntry> entries;
+		};
+		std::vector<Node> nodes;
+		// case insensitive names with non-ASCII characters, which are always included in matches
+		std::vector<ExpressionNameIndexEntry> unindexed;
+		unordered_map<void*, std::vector<size_t> > object_nodes;
+		size_t child(size_t node, char c) const;
+	public:
+		ExpressionNameIndex();
+		void add(void *object, int type, const ExpressionName &ename, size_t ignore_us);
+		void remove(void *object);
+		// sets lists[type] to NAME_INDEX_BIT() of the length of each name that might match the beginning of str (from index, using at most max_length characters)
+		void match(const std::string &str, size_t index, size_t max_length, unsigned int *lists) const;
+		bool contains(const std::string &name, int type) const;
+};
+
+// bounded cache of structures, identified by a hash value and a key string (and optionally a structure), where the least recently used entry is removed first when the cache is full
+class StructureCache {
+	protected:
+		struct Entry {
+			size_t hash;
+			std::string key;
+			MathStructure *mkey, *mvalue;
+			std::vector<CalculatorMessage> messages;
+		};
+		std::list<Entry> entries;
+		std::multimap<size_t, std::list<Entry>::iterator> index;
+		size_t max_size, generation;
+		std::mutex mutex;
+		void removeEntry(std::list<Entry>::iterator it);
+	public:
+		std::atomic<size_t> hits, misses;
+		StructureCache();
+		~StructureCache();
+		size_t maxSize() const;
+		void setMaxSize(size_t size);
+		void clear();
+		// entries added with a different generation (definitions generation) are removed; stored messages are appended to messages, unless already present
+		bool get(size_t hash, const std::string &key, const MathStructure *mkey, MathStructure &mvalue, std::vector<CalculatorMessage> *messages, size_t current_generation);
+		void add(size_t hash, const std::string &key, const MathStructure *mkey, const MathStructure &mvalue, const std::vector<CalculatorMessage> *messages, size_t current_generation);
+};
+
+#define APPEND_CACHE_KEY(key, x) {long int cache_key_value = (long int) (x); key.append((const char*) &cache_key_value, sizeof(long int));}
+
+class Calculator_p {
+	public:
+		CalculatorContext context;
+		CalculatorTimer timer;
+		ExpressionNameIndex name_index;
+		std::vector<size_t> ufvl_us;
+		std::vector<size_t> ufv_us[4][20];
 		Number custom_input_base, custom_output_base;
 		long int custom_input_base_i;
 		Unit *local_currency;
@@ -88,6 +216,9 @@ class Calculator_p {
 		long int fixed_denominator;
 		std::vector<std::string> definitions_locales;
 		bool definitions_locale_set;
+		// read by calculations in other threads
+		std::atomic<size_t> definitions_generation;
+		StructureCache eval_cache, parse_cache;
 };
 
 class CalculateThread : public Thread {
@@ -96,5 +227,6 @@ class CalculateThread : public Thread {
 };
 
 bool is_not_number(char c, int base);
+void append_parse_options_cache_key(std::string &key, const ParseOptions &po);
 
 #endif
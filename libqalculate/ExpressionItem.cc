@@ -553,6 +553,8 @@ bool ExpressionItem::hasChanged() const {
 }
 void ExpressionItem::setChanged(bool has_changed) {
 	b_changed = has_changed;
+	// invalidates cached results
+	if(has_changed && b_registered && CALCULATOR) CALCULATOR->definitionsChanged();
 }
 bool ExpressionItem::isApproximate() const {
 	return b_approx;
@@ -65,6 +65,23 @@ class MathFunction_p {
 	public:
 		unordered_map<size_t, Argument*> argdefs;
 		std::vector<std::string> v_subs_calc;
+		// pre-parsed user function formula and precalculated subfunctions
+		MathStructure *m_formula;
+		std::vector<MathStructure*> v_subs_formula;
+		size_t formula_generation;
+		int formula_angle_unit;
+		bool formula_matlab, formula_concise, formula_v, formula_w, formula_failed;
+		MathFunction_p() : m_formula(NULL), formula_generation(0), formula_angle_unit(0), formula_matlab(false), formula_concise(false), formula_v(false), formula_w(false), formula_failed(false) {}
+		~MathFunction_p() {clearFormula();}
+		void clearFormula() {
+			if(m_formula) m_formula->unref();
+			m_formula = NULL;
+			for(size_t i = 0; i < v_subs_formula.size(); i++) v_subs_formula[i]->unref();
+			v_subs_formula.clear();
+			formula_v = false;
+			formula_w = false;
+			formula_failed = false;
+		}
 };
 
 MathFunction::MathFunction(string name_, int argc_, int max_argc_, string cat_, string title_, string descr_, bool is_active) : ExpressionItem(cat_, name_, title_, descr_, false, true, is_active) {
@@ -111,6 +128,7 @@ void MathFunction::set(const ExpressionItem *item) {
 		}
 		last_argdef_index = f->lastArgumentDefinitionIndex();
 		scondition = f->condition();
+		priv->clearFormula();
 		clearArgumentDefinitions();
 		for(size_t i = 1; i <= f->lastArgumentDefinitionIndex(); i++) {
 			if(f->getArgumentDefinition(i)) {
@@ -478,6 +496,7 @@ void MathFunction::clearArgumentDefinitions() {
 	priv->argdefs.clear();
 	last_argdef_index = 0;
 	setChanged(true);
+	if(CALCULATOR) CALCULATOR->definitionsChanged();
 }
 void MathFunction::setArgumentDefinition(size_t index, Argument *argdef) {
 	if(priv->argdefs.find(index) != priv->argdefs.end()) {
@@ -504,6 +523,7 @@ void MathFunction::setArgumentDefinition(size_t index, Argument *argdef) {
 		}
 	}
 	setChanged(true);
+	if(CALCULATOR) CALCULATOR->definitionsChanged();
 }
 bool MathFunction::testArgumentCount(int itmp) {
 	if(itmp >= minargs()) {
@@ -949,16 +969,382 @@ bool replace_f_interval(MathStructure &mstruct, const EvaluationOptions &eo) {
 	}
 	return b;
 }
+string user_function_slot(size_t index) {
+	string str = INTERNAL_ID_L;
+	str += i2s(index);
+	str += INTERNAL_ID_R;
+	return str;
+}
+int user_function_slot_index(const MathStructure &m) {
+	if(!m.isSymbolic() || m.symbol().length() < 3 || m.symbol()[0] != INTERNAL_ID_L_CH || m.symbol()[m.symbol().length() - 1] != INTERNAL_ID_R_CH || m.symbol().find_first_not_of(NUMBERS, 1) != m.symbol().length() - 1) return -1;
+	return s2i(m.symbol().substr(1, m.symbol().length() - 2));
+}
+bool contains_user_function_slot(const MathStructure &m) {
+	if(user_function_slot_index(m) >= 0) return true;
+	for(size_t i = 0; i < m.size(); i++) {
+		if(contains_user_function_slot(m[i])) return true;
+	}
+	return false;
+}
+bool user_function_slot_argument_allowed(const Argument *arg, const ParseOptions &po) {
+	// only arguments which are parsed without regard to the value of the argument can contain a slot
+	if(!arg) return true;
+	switch(arg->type()) {
+		case ARGUMENT_TYPE_FREE: {}
+		case ARGUMENT_TYPE_SYMBOLIC: {}
+		case ARGUMENT_TYPE_INTEGER: {}
+		case ARGUMENT_TYPE_NUMBER: {}
+		case ARGUMENT_TYPE_VECTOR: {}
+		case ARGUMENT_TYPE_MATRIX: {}
+		case ARGUMENT_TYPE_BOOLEAN: {return true;}
+		case ARGUMENT_TYPE_ANGLE: {return !HAS_DEFAULT_ANGLE_UNIT(po.angle_unit);}
+		case ARGUMENT_TYPE_SET: {
+			for(size_t i = 1; i <= ((ArgumentSet*) arg)->countArguments(); i++) {
+				if(!user_function_slot_argument_allowed(((ArgumentSet*) arg)->getArgument(i), po)) return false;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+bool test_user_function_template(const MathStructure &m, const ParseOptions &po, size_t n_slots) {
+	if(m.isSymbolic()) {
+		if(m.symbol().find(INTERNAL_ID_L) == string::npos) return true;
+		int index = user_function_slot_index(m);
+		return index >= 0 && (size_t) index < n_slots;
+	}
+	if(m.isFunction()) {
+		MathFunction *f = m.function();
+		if(f->id() == FUNCTION_ID_PLOT && contains_user_function_slot(m)) return false;
+		Argument *arg = NULL;
+		if(f->maxargs() > 0) arg = f->getArgumentDefinition(f->maxargs());
+		bool last_is_vctr = arg && ((arg->type() == ARGUMENT_TYPE_VECTOR) || (f->maxargs() == 1 && arg->handlesVector()));
+		for(size_t i = 0; i < m.size(); i++) {
+			if(contains_user_function_slot(m[i])) {
+				arg = f->getArgumentDefinition(i + 1);
+				if(!arg && (int) i + 1 > f->minargs() && f->maxargs() < 0 && i + 1 > f->lastArgumentDefinitionIndex() && (int) f->lastArgumentDefinitionIndex() > f->minargs()) arg = f->getArgumentDefinition(f->lastArgumentDefinitionIndex());
+				if(!user_function_slot_argument_allowed(arg, po)) return false;
+				// additional arguments are appended to the last vector argument depending on the value of the first element
+				if(last_is_vctr && (int) i + 1 == f->maxargs() && m[i].isVector() && m[i].size() > 0 && contains_user_function_slot(m[i][0])) return false;
+			}
+		}
+	}
+	for(size_t i = 0; i < m.size(); i++) {
+		if(!test_user_function_template(m[i], po, n_slots)) return false;
+	}
+	return true;
+}
+bool set_user_function_slots(MathStructure &m, const vector<MathStructure*> &v_slots) {
+	int index = user_function_slot_index(m);
+	if(index >= 0) {
+		if((size_t) index < v_slots.size() && v_slots[index]) m.set(*v_slots[index]);
+		else m.setUndefined();
+		return true;
+	}
+	bool b = false;
+	for(size_t i = 0; i < m.size(); i++) {
+		if(set_user_function_slots(m[i], v_slots)) {
+			m.childUpdated(i + 1);
+			b = true;
+		}
+	}
+	return b;
+}
+string user_function_expression(UserFunction *f, const vector<string> &v_subs_calc, int i_args, const vector<string> &v_strs, const string &v_str, const string &w_str, vector<size_t> &v_id, const ParseOptions &po, const EvaluationOptions &eo, vector<MathStructure*> *v_subs_mstruct) {
+	// if v_subs_mstruct is not NULL, precalculated subfunctions are parsed (but not calculated) and added to v_subs_mstruct, and placeholders are inserted in the expression
+	string stmp = f->internalFormula();
+	string svar;
+	size_t i2 = 0;
+	for(size_t i = 0; i < v_subs_calc.size(); i++) {
+		if(f->subfunctionPrecalculated(i + 1)) {
+			string str = v_subs_calc[i];
+			for(int i3 = 0; i3 < i_args; i3++) {
+				svar = '\\';
+				if('x' + i3 > 'z') {
+					svar += (char) ('a' + i3 - 3);
+				} else {
+					svar += 'x' + i3;
+				}
+				i2 = 0;
+				while(true) {
+					if((i2 = str.find(svar, i2)) != string::npos) {
+						if(i2 != 0 && str[i2 - 1] == '\\') {
+							i2 += 2;
+						} else {
+							str.replace(i2, 2, v_strs[i3]);
+						}
+					} else {
+						break;
+					}
+				}
+			}
+			size_t v_id_i = v_id.size() - 1;
+			string str2;
+			for(int i3 = i - 1; i3 >= 0; i3--) {
+				i2 = 0;
+				svar = '\\';
+				svar += i2s(i3 + 1);
+				while(true) {
+					if((i2 = str.find(svar, i2)) != string::npos) {
+						if(i2 != 0 && str[i2 - 1] == '\\') {
+							i2 += 2;
+						} else {
+							if(f->subfunctionPrecalculated(i3 + 1)) {
+								if(str2.empty()) {
+									str2 = LEFT_PARENTHESIS INTERNAL_ID_L;
+									str2 += i2s(v_id[v_id_i]);
+									str2 += INTERNAL_ID_R RIGHT_PARENTHESIS;
+								}
+								str.replace(i2, svar.size(), str2);
+							} else {
+								str.replace(i2, svar.size(), string("(") + v_subs_calc[i] + ")");
+								i2 += v_subs_calc[i].size() + 2;
+								i2 -= svar.size();
+							}
+						}
+					} else {
+						break;
+					}
+				}
+				if(f->subfunctionPrecalculated(i3 + 1)) {
+					v_id_i--;
+					str2 = "";
+				}
+			}
+			if(f->maxargs() < 0) {
+				i2 = 0;
+				while(true) {
+					if((i2 = str.find("\\v")) != string::npos) {
+						if(i2 != 0 && str[i2 - 1] == '\\') {
+							i2 += 2;
+						} else {
+							str.replace(i2, 2, v_str);
+						}
+					} else {
+						break;
+					}
+				}
+				i2 = 0;
+				while(true) {
+					if((i2 = str.find("\\w")) != string::npos) {
+						if(i2 != 0 && str[i2 - 1] == '\\') {
+							i2 += 2;
+						} else {
+							str.replace(i2, 2, w_str);
+						}
+					} else {
+						break;
+					}
+				}
+			}
+			MathStructure *v_mstruct = new MathStructure();
+			if(v_subs_mstruct) {
+				CALCULATOR->parse(v_mstruct, str, po);
+				v_subs_mstruct->push_back(v_mstruct);
+				v_mstruct = new MathStructure(user_function_slot(i_args + 1 + v_subs_mstruct->size()), true);
+			} else {
+				CALCULATOR->parse(v_mstruct, str, po);
+				v_mstruct->eval(eo);
+			}
+			v_id.push_back(CALCULATOR->addId(v_mstruct, true));
+			str = LEFT_PARENTHESIS INTERNAL_ID_L;
+			str += i2s(v_id[v_id.size() - 1]);
+			str += INTERNAL_ID_R RIGHT_PARENTHESIS;
+			i2 = 0;
+			svar = '\\';
+			svar += i2s(i + 1);
+			while(true) {
+				if((i2 = stmp.find(svar, i2)) != string::npos) {
+					if(i2 != 0 && stmp[i2 - 1] == '\\') {
+						i2 += 2;
+					} else {
+						stmp.replace(i2, svar.size(), str);
+						i2 += str.size() + 2;
+						i2 -= svar.size();
+					}
+				} else {
+					break;
+				}
+			}
+		} else {
+			size_t v_id_i = v_id.size() - 1;
+			string str = v_subs_calc[i];
+			string str2;
+			for(int i3 = i - 1; i3 >= 0; i3--) {
+				i2 = 0;
+				svar = '\\';
+				svar += i2s(i3 + 1);
+				while(true) {
+					if((i2 = str.find(svar, i2)) != string::npos) {
+						if(i2 != 0 && str[i2 - 1] == '\\') {
+							i2 += 2;
+						} else {
+							if(f->subfunctionPrecalculated(i3 + 1)) {
+								if(str2.empty()) {
+									str2 = LEFT_PARENTHESIS INTERNAL_ID_L;
+									str2 += i2s(v_id[v_id_i]);
+									str2 += INTERNAL_ID_R RIGHT_PARENTHESIS;
+								}
+								str.replace(i2, svar.size(), str2);
+							} else {
+								str.replace(i2, svar.size(), string("(") + v_subs_calc[i] + ")");
+								i2 += v_subs_calc[i].size() + 2;
+								i2 -= svar.size();
+							}
+						}
+					} else {
+						break;
+					}
+				}
+				if(f->subfunctionPrecalculated(i3 + 1)) {
+					v_id_i--;
+					str2 = "";
+				}
+			}
+			i2 = 0;
+			svar = '\\';
+			svar += i2s(i + 1);
+			while(true) {
+				if((i2 = stmp.find(svar, i2)) != string::npos) {
+					if(i2 != 0 && stmp[i2 - 1] == '\\') {
+						i2 += svar.size();
+					} else {
+						stmp.replace(i2, svar.size(), string("(") + str + ")");
+						i2 += str.size() + 2;
+						i2 -= svar.size();
+					}
+				} else {
+					break;
+				}
+			}
+		}
+	}
+	for(int i = 0; i < i_args; i++) {
+		svar = '\\';
+		if('x' + i > 'z') {
+			svar += (char) ('a' + i - 3);
+		} else {
+			svar += 'x' + i;
+		}
+		i2 = 0;
+		while(true) {
+			if((i2 = stmp.find(svar, i2)) != string::npos) {
+				if(i2 != 0 && stmp[i2 - 1] == '\\') {
+					i2 += 2;
+				} else {
+					stmp.replace(i2, 2, v_strs[i]);
+				}
+			} else {
+				break;
+			}
+		}
+	}
+	if(f->maxargs() < 0) {
+		i2 = 0;
+		while(true) {
+			if((i2 = stmp.find("\\v")) != string::npos) {
+				if(i2 != 0 && stmp[i2 - 1] == '\\') {
+					i2 += 2;
+				} else {
+					stmp.replace(i2, 2, v_str);
+				}
+			} else {
+				break;
+			}
+		}
+		i2 = 0;
+		while(true) {
+			if((i2 = stmp.find("\\w")) != string::npos) {
+				if(i2 != 0 && stmp[i2 - 1] == '\\') {
+					i2 += 2;
+				} else {
+					stmp.replace(i2, 2, w_str);
+				}
+			} else {
+				break;
+			}
+		}
+	}
+	while(true) {
+		if((i2 = stmp.find("\\\\")) != string::npos) {
+			stmp.replace(i2, 2, "\\");
+		} else {
+			break;
+		}
+	}
+	return stmp;
+}
+bool compile_user_function(UserFunction *f, MathFunction_p *priv, int i_args, const ParseOptions &po) {
+	// parse the formula once, with placeholder symbols for arguments and precalculated subfunctions
+	priv->clearFormula();
+	priv->formula_generation = CALCULATOR->definitionsGeneration();
+	priv->formula_angle_unit = po.angle_unit;
+	priv->formula_matlab = CALCULATOR->usesMatlabStyleMatrices();
+	priv->formula_concise = CALCULATOR->conciseUncertaintyInputEnabled();
+	priv->formula_failed = true;
+	// vectors and matrices are parsed differently depending on the values of the elements
+	if(f->internalFormula().find(LEFT_VECTOR_WRAP) != string::npos) return false;
+	for(size_t i = 0; i < priv->v_subs_calc.size(); i++) {
+		if(priv->v_subs_calc[i].find(LEFT_VECTOR_WRAP) != string::npos) return false;
+	}
+	vector<size_t> v_id;
+	vector<string> v_strs;
+	string v_str, w_str;
+	for(int i = 0; i < i_args; i++) {
+		v_id.push_back(CALCULATOR->addId(new MathStructure(user_function_slot(i), true), true));
+		v_strs.push_back(LEFT_PARENTHESIS INTERNAL_ID_L);
+		v_strs[i] += i2s(v_id[i]);
+		v_strs[i] += INTERNAL_ID_R RIGHT_PARENTHESIS;
+	}
+	if(f->maxargs() < 0) {
+		if(f->internalFormula().find("\\v") != string::npos) {
+			v_id.push_back(CALCULATOR->addId(new MathStructure(user_function_slot(i_args), true), true));
+			v_str = LEFT_PARENTHESIS INTERNAL_ID_L;
+			v_str += i2s(v_id[v_id.size() - 1]);
+			v_str += INTERNAL_ID_R RIGHT_PARENTHESIS;
+			priv->formula_v = true;
+		}
+		if(f->internalFormula().find("\\w") != string::npos) {
+			v_id.push_back(CALCULATOR->addId(new MathStructure(user_function_slot(i_args + 1), true), true));
+			w_str = LEFT_PARENTHESIS INTERNAL_ID_L;
+			w_str += i2s(v_id[v_id.size() - 1]);
+			w_str += INTERNAL_ID_R RIGHT_PARENTHESIS;
+			priv->formula_w = true;
+		}
+	}
+	CALCULATOR->beginTemporaryStopMessages();
+	string stmp = user_function_expression(f, priv->v_subs_calc, i_args, v_strs, v_str, w_str, v_id, po, default_evaluation_options, &priv->v_subs_formula);
+	priv->m_formula = new MathStructure();
+	CALCULATOR->parse(priv->m_formula, stmp, po);
+	for(size_t i = 0; i < v_id.size(); i++) {
+		CALCULATOR->delId(v_id[i]);
+	}
+	int message_count = 0;
+	CALCULATOR->endTemporaryStopMessages(&message_count);
+	if(CALCULATOR->aborted()) {
+		priv->clearFormula();
+		return false;
+	}
+	// fall back to parsing of the full expression on each call if the formula generates messages or placeholders can not be safely replaced
+	bool b_valid = (message_count == 0);
+	size_t n_slots = i_args + 2 + priv->v_subs_formula.size();
+	if(b_valid) b_valid = test_user_function_template(*priv->m_formula, po, n_slots);
+	for(size_t i = 0; b_valid && i < priv->v_subs_formula.size(); i++) {
+		b_valid = test_user_function_template(*priv->v_subs_formula[i], po, n_slots);
+	}
+	if(!b_valid) {
+		priv->clearFormula();
+		return false;
+	}
+	priv->formula_failed = false;
+	return true;
+}
 int UserFunction::calculate(MathStructure &mstruct, const MathStructure &vargs, const EvaluationOptions &eo) {
 	ParseOptions po;
 	if(b_local) po.angle_unit = eo.parse_options.angle_unit;
 	if(args() != 0) {
-		string stmp = sformula_calc;
 		string svar;
-		string v_str, w_str;
-		vector<string> v_strs;
-		vector<size_t> v_id;
-		size_t i2 = 0;
+		vector<MathStructure*> v_args;
 		int i_args = maxargs();
 		if(i_args < 0) {
 			i_args = minargs();
@@ -969,6 +1355,7 @@ int UserFunction::calculate(MathStructure &mstruct, const MathStructure &vargs,
 			for(; i < v_subs.size(); i++) {
 				priv->v_subs_calc.push_back(v_subs[i]);
 			}
+			priv->clearFormula();
 		}
 		for(int i = 0; i < i_args; i++) {
 			MathStructure *mv = new MathStructure(vargs[i]);
@@ -1015,241 +1402,69 @@ int UserFunction::calculate(MathStructure &mstruct, const MathStructure &vargs,
 					replace_intervals_f(*mv);
 				}
 			}
-			v_id.push_back(CALCULATOR->addId(mv, true));
-			v_strs.push_back(LEFT_PARENTHESIS INTERNAL_ID_L);
-			v_strs[i] += i2s(v_id[i]);
-			v_strs[i] += INTERNAL_ID_R RIGHT_PARENTHESIS;
-		}
-		if(maxargs() < 0) {
-			if(stmp.find("\\v") != string::npos) {
-				v_id.push_back(CALCULATOR->addId(new MathStructure(produceVector(vargs)), true));
-				v_str = LEFT_PARENTHESIS INTERNAL_ID_L;
-				v_str += i2s(v_id[v_id.size() - 1]);
-				v_str += INTERNAL_ID_R RIGHT_PARENTHESIS;
-			}
-			if(stmp.find("\\w") != string::npos) {
-				v_id.push_back(CALCULATOR->addId(new MathStructure(produceArgumentsVector(vargs)), true));
-				w_str = LEFT_PARENTHESIS INTERNAL_ID_L;
-				w_str += i2s(v_id[v_id.size() - 1]);
-				w_str += INTERNAL_ID_R RIGHT_PARENTHESIS;
+			v_args.push_back(mv);
+		}
+		bool b_formula = false, b_formula_v = false, b_formula_w = false;
+		vector<MathStructure*> v_subs_mstruct;
+		{
+			// the pre-parsed formula is shared between threads
+			std::lock_guard<std::recursive_mutex> lock(definitions_mutex);
+			if(priv->m_formula || priv->formula_failed) {
+				if(priv->formula_generation != CALCULATOR->definitionsGeneration() || priv->formula_angle_unit != po.angle_unit || priv->formula_matlab != CALCULATOR->usesMatlabStyleMatrices() || priv->formula_concise != CALCULATOR->conciseUncertaintyInputEnabled()) priv->clearFormula();
 			}
-		}
-
-		for(size_t i = 0; i < priv->v_subs_calc.size(); i++) {
-			if(subfunctionPrecalculated(i + 1)) {
-				string str = priv->v_subs_calc[i];
-				for(int i3 = 0; i3 < i_args; i3++) {
-					svar = '\\';
-					if('x' + i3 > 'z') {
-						svar += (char) ('a' + i3 - 3);
-					} else {
-						svar += 'x' + i3;
-					}
-					i2 = 0;
-					while(true) {
-						if((i2 = str.find(svar, i2)) != string::npos) {
-							if(i2 != 0 && str[i2 - 1] == '\\') {
-								i2 += 2;
-							} else {
-								str.replace(i2, 2, v_strs[i3]);
-							}
-						} else {
-							break;
-						}
-					}
-				}
-				size_t v_id_i = v_id.size() - 1;
-				string str2;
-				for(int i3 = i - 1; i3 >= 0; i3--) {
-					i2 = 0;
-					svar = '\\';
-					svar += i2s(i3 + 1);
-					while(true) {
-						if((i2 = str.find(svar, i2)) != string::npos) {
-							if(i2 != 0 && str[i2 - 1] == '\\') {
-								i2 += 2;
-							} else {
-								if(subfunctionPrecalculated(i3 + 1)) {
-									if(str2.empty()) {
-										str2 = LEFT_PARENTHESIS INTERNAL_ID_L;
-										str2 += i2s(v_id[v_id_i]);
-										str2 += INTERNAL_ID_R RIGHT_PARENTHESIS;
-									}
-									str.replace(i2, svar.size(), str2);
-								} else {
-									str.replace(i2, svar.size(), string("(") + priv->v_subs_calc[i] + ")");
-									i2 += priv->v_subs_calc[i].size() + 2;
-									i2 -= svar.size();
-								}
-							}
-						} else {
-							break;
-						}
-					}
-					if(subfunctionPrecalculated(i3 + 1)) {
-						v_id_i--;
-						str2 = "";
-					}
-				}
-				if(maxargs() < 0) {
-					i2 = 0;
-					while(true) {
-						if((i2 = str.find("\\v")) != string::npos) {
-							if(i2 != 0 && str[i2 - 1] == '\\') {
-								i2 += 2;
-							} else {
-								str.replace(i2, 2, v_str);
-							}
-						} else {
-							break;
-						}
-					}
-					i2 = 0;
-					while(true) {
-						if((i2 = str.find("\\w")) != string::npos) {
-							if(i2 != 0 && str[i2 - 1] == '\\') {
-								i2 += 2;
-							} else {
-								str.replace(i2, 2, w_str);
-							}
-						} else {
-							break;
-						}
-					}
-				}
-				MathStructure *v_mstruct = new MathStructure();
-				CALCULATOR->parse(v_mstruct, str, po);
-				v_mstruct->eval(eo);
-				v_id.push_back(CALCULATOR->addId(v_mstruct, true));
-				str = LEFT_PARENTHESIS INTERNAL_ID_L;
-				str += i2s(v_id[v_id.size() - 1]);
-				str += INTERNAL_ID_R RIGHT_PARENTHESIS;
-				i2 = 0;
-				svar = '\\';
-				svar += i2s(i + 1);
-				while(true) {
-					if((i2 = stmp.find(svar, i2)) != string::npos) {
-						if(i2 != 0 && stmp[i2 - 1] == '\\') {
-							i2 += 2;
-						} else {
-							stmp.replace(i2, svar.size(), str);
-							i2 += str.size() + 2;
-							i2 -= svar.size();
-						}
-					} else {
-						break;
-					}
-				}
-			} else {
-				size_t v_id_i = v_id.size() - 1;
-				string str = priv->v_subs_calc[i];
-				string str2;
-				for(int i3 = i - 1; i3 >= 0; i3--) {
-					i2 = 0;
-					svar = '\\';
-					svar += i2s(i3 + 1);
-					while(true) {
-						if((i2 = str.find(svar, i2)) != string::npos) {
-							if(i2 != 0 && str[i2 - 1] == '\\') {
-								i2 += 2;
-							} else {
-								if(subfunctionPrecalculated(i3 + 1)) {
-									if(str2.empty()) {
-										str2 = LEFT_PARENTHESIS INTERNAL_ID_L;
-										str2 += i2s(v_id[v_id_i]);
-										str2 += INTERNAL_ID_R RIGHT_PARENTHESIS;
-									}
-									str.replace(i2, svar.size(), str2);
-								} else {
-									str.replace(i2, svar.size(), string("(") + priv->v_subs_calc[i] + ")");
-									i2 += priv->v_subs_calc[i].size() + 2;
-									i2 -= svar.size();
-								}
-							}
-						} else {
-							break;
-						}
-					}
-					if(subfunctionPrecalculated(i3 + 1)) {
-						v_id_i--;
-						str2 = "";
-					}
-				}
-				i2 = 0;
-				svar = '\\';
-				svar += i2s(i + 1);
-				while(true) {
-					if((i2 = stmp.find(svar, i2)) != string::npos) {
-						if(i2 != 0 && stmp[i2 - 1] == '\\') {
-							i2 += svar.size();
-						} else {
-							stmp.replace(i2, svar.size(), string("(") + str + ")");
-							i2 += str.size() + 2;
-							i2 -= svar.size();
-						}
-					} else {
-						break;
-					}
+			if(!priv->m_formula && !priv->formula_failed) compile_user_function(this, priv, i_args, po);
+			if(priv->m_formula) {
+				b_formula = true;
+				b_formula_v = priv->formula_v;
+				b_formula_w = priv->formula_w;
+				for(size_t i = 0; i < priv->v_subs_formula.size(); i++) {
+					v_subs_mstruct.push_back(new MathStructure(*priv->v_subs_formula[i]));
 				}
+				mstruct.set(*priv->m_formula);
 			}
 		}
-		for(int i = 0; i < i_args; i++) {
-			svar = '\\';
-			if('x' + i > 'z') {
-				svar += (char) ('a' + i - 3);
-			} else {
-				svar += 'x' + i;
+		if(b_formula) {
+			// bind arguments to the pre-parsed formula
+			v_args.push_back(maxargs() < 0 && b_formula_v ? new MathStructure(produceVector(vargs)) : NULL);
+			v_args.push_back(maxargs() < 0 && b_formula_w ? new MathStructure(produceArgumentsVector(vargs)) : NULL);
+			for(size_t i = 0; i < v_subs_mstruct.size(); i++) {
+				set_user_function_slots(*v_subs_mstruct[i], v_args);
+				v_subs_mstruct[i]->eval(eo);
+				v_args.push_back(v_subs_mstruct[i]);
 			}
-			i2 = 0;
-			while(true) {
-				if((i2 = stmp.find(svar, i2)) != string::npos) {
-					if(i2 != 0 && stmp[i2 - 1] == '\\') {
-						i2 += 2;
-					} else {
-						stmp.replace(i2, 2, v_strs[i]);
-					}
-				} else {
-					break;
-				}
+			set_user_function_slots(mstruct, v_args);
+			for(size_t i = 0; i < v_args.size(); i++) {
+				if(v_args[i]) v_args[i]->unref();
 			}
-		}
-		if(maxargs() < 0) {
-			i2 = 0;
-			while(true) {
-				if((i2 = stmp.find("\\v")) != string::npos) {
-					if(i2 != 0 && stmp[i2 - 1] == '\\') {
-						i2 += 2;
-					} else {
-						stmp.replace(i2, 2, v_str);
-					}
-				} else {
-					break;
-				}
+		} else {
+			vector<size_t> v_id;
+			vector<string> v_strs;
+			string v_str, w_str;
+			for(int i = 0; i < i_args; i++) {
+				v_id.push_back(CALCULATOR->addId(v_args[i], true));
+				v_strs.push_back(LEFT_PARENTHESIS INTERNAL_ID_L);
+				v_strs[i] += i2s(v_id[i]);
+				v_strs[i] += INTERNAL_ID_R RIGHT_PARENTHESIS;
 			}
-			i2 = 0;
-			while(true) {
-				if((i2 = stmp.find("\\w")) != string::npos) {
-					if(i2 != 0 && stmp[i2 - 1] == '\\') {
-						i2 += 2;
-					} else {
-						stmp.replace(i2, 2, w_str);
-					}
-				} else {
-					break;
+			if(maxargs() < 0) {
+				if(sformula_calc.find("\\v") != string::npos) {
+					v_id.push_back(CALCULATOR->addId(new MathStructure(produceVector(vargs)), true));
+					v_str = LEFT_PARENTHESIS INTERNAL_ID_L;
+					v_str += i2s(v_id[v_id.size() - 1]);
+					v_str += INTERNAL_ID_R RIGHT_PARENTHESIS;
+				}
+				if(sformula_calc.find("\\w") != string::npos) {
+					v_id.push_back(CALCULATOR->addId(new MathStructure(produceArgumentsVector(vargs)), true));
+					w_str = LEFT_PARENTHESIS INTERNAL_ID_L;
+					w_str += i2s(v_id[v_id.size() - 1]);
+					w_str += INTERNAL_ID_R RIGHT_PARENTHESIS;
 				}
 			}
-		}
-		while(true) {
-			if((i2 = stmp.find("\\\\")) != string::npos) {
-				stmp.replace(i2, 2, "\\");
-			} else {
-				break;
+			CALCULATOR->parse(&mstruct, user_function_expression(this, priv->v_subs_calc, i_args, v_strs, v_str, w_str, v_id, po, eo, NULL), po);
+			for(size_t i = 0; i < v_id.size(); i++) {
+				CALCULATOR->delId(v_id[i]);
 			}
 		}
-		CALCULATOR->parse(&mstruct, stmp, po);
-		for(size_t i = 0; i < v_id.size(); i++) {
-			CALCULATOR->delId(v_id[i]);
-		}
 		if(precision() >= 0) mstruct.setPrecision(precision(), true);
 		if(isApproximate()) mstruct.setApproximate(true, true);
 	} else {
@@ -1264,6 +1479,7 @@ void UserFunction::setFormula(string new_formula, int argc_, int max_argc_) {
 	sformula = new_formula;
 	default_values.clear();
 	priv->v_subs_calc.clear();
+	priv->clearFormula();
 	if(sformula.empty() && v_subs.empty()) {
 		sformula_calc = new_formula;
 		argc = 0;
@@ -1417,11 +1633,13 @@ void UserFunction::addSubfunction(string subfunction, bool precalculate) {
 	setChanged(true);
 	v_subs.push_back(subfunction);
 	v_precalculate.push_back(precalculate);
+	priv->clearFormula();
 }
 void UserFunction::setSubfunction(size_t index, string subfunction) {
 	if(index > 0 && index <= v_subs.size()) {
 		setChanged(true);
 		v_subs[index - 1] = subfunction;
+		priv->clearFormula();
 	}
 }
 void UserFunction::delSubfunction(size_t index) {
@@ -1429,6 +1647,7 @@ void UserFunction::delSubfunction(size_t index) {
 		setChanged(true);
 		v_subs.erase(v_subs.begin() + (index - 1));
 		if(index <= priv->v_subs_calc.size()) priv->v_subs_calc.erase(priv->v_subs_calc.begin() + (index - 1));
+		priv->clearFormula();
 	}
 	if(index > 0 && index <= v_precalculate.size()) {
 		setChanged(true);
@@ -1440,11 +1659,13 @@ void UserFunction::clearSubfunctions() {
 	v_subs.clear();
 	priv->v_subs_calc.clear();
 	v_precalculate.clear();
+	priv->clearFormula();
 }
 void UserFunction::setSubfunctionPrecalculated(size_t index, bool precalculate) {
 	if(index > 0 && index <= v_precalculate.size()) {
 		setChanged(true);
 		v_precalculate[index - 1] = precalculate;
+		priv->clearFormula();
 	}
 }
 size_t UserFunction::countSubfunctions() const {
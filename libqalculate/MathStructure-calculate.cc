@@ -19,6 +19,39 @@
 #include "Variable.h"
 #include "Unit.h"
 #include "Prefix.h"
+
+#if HAVE_UNORDERED_MAP
+#	include <unordered_map>
+	using std::unordered_map;
+#elif 	defined(__GNUC__)
+
+#	ifndef __has_include
+#	define __has_include(x) 0
+#	endif
+
+#	if (defined(__clang__) && __has_include(<tr1/unordered_map>)) || (__GNUC__ >= 4 && __GNUC_MINOR__ >= 3)
+#		include <tr1/unordered_map>
+		namespace Sgi = std;
+#		define unordered_map std::tr1::unordered_map
+#	else
+#		if __GNUC__ < 3
+#			include <hash_map.h>
+			namespace Sgi { using ::hash_map; }; // inherit globals
+#		else
+#			include <ext/hash_map>
+#			if __GNUC__ == 3 && __GNUC_MINOR__ == 0
+				namespace Sgi = std;               // GCC 3.0
+#			else
+				namespace Sgi = ::__gnu_cxx;       // GCC 3.1 and later
+#			endif
+#		endif
+#		define unordered_map Sgi::hash_map
+#	endif
+#else      // ...  there are other compilers, right?
+	namespace Sgi = std;
+#	define unordered_map Sgi::hash_map
+#endif
+
 #include "MathStructure-support.h"
 
 using std::string;
@@ -160,11 +193,11 @@ int MathStructure::merge_addition(MathStructure &mstruct, const EvaluationOption
 		Number nr(o_number);
 		if(nr.add(mstruct.number()) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || mstruct.number().isApproximate())) {
 			if(o_number == nr) {
-				o_number = nr;
+				o_number = std::move(nr);
 				numberUpdated();
 				return 2;
 			}
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return 1;
 		}
@@ -1267,11 +1300,11 @@ int MathStructure::merge_multiplication(MathStructure &mstruct, const Evaluation
 		Number nr(o_number);
 		if(nr.multiply(mstruct.number()) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || mstruct.number().isApproximate()) && (eo.allow_complex || !nr.isComplex() || o_number.isComplex() || mstruct.number().isComplex()) && (eo.allow_infinite || !nr.includesInfinity() || o_number.includesInfinity() || mstruct.number().includesInfinity())) {
 			if(o_number == nr) {
-				o_number = nr;
+				o_number = std::move(nr);
 				numberUpdated();
 				return 2;
 			}
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return 1;
 		}
@@ -1861,6 +1894,32 @@ int MathStructure::merge_multiplication(MathStructure &mstruct, const Evaluation
 			switch(mstruct.type()) {
 				case STRUCT_ADDITION: {
 					// multiplication of polynomials
+					// polynomials with rational coefficients (with the same limit as below, unless expansion has been explicitly requested)
+					if(eo.expand > 0 && SIZE * mstruct.size() >= 16 && SIZE <= 300 && mstruct.size() <= 300 && (eo.expand > 1 || SIZE * mstruct.size() < 500)) {
+						// univariate polynomials: multiply coefficient vectors (result with at most 300 terms)
+						MathStructure x_var;
+						vector<Number> v1, v2, v;
+						if(get_dense_polynomial(*this, x_var, v1, 299) && dense_polynomial_from_mathstructure(mstruct, x_var, v2, 299) && v1.size() + v2.size() <= 301) {
+							dense_polynomial_multiply(v1, v2, v);
+							dense_polynomial_to_mathstructure(v, x_var, *this);
+							MERGE_APPROX_AND_PREC(mstruct)
+							calculatesub(eo, eo, false, mparent, index_this);
+							return 1;
+						}
+						// multivariate polynomials: multiply sparse polynomials
+						vector<MathStructure> vars;
+						collect_symbols(*this, vars);
+						collect_symbols(mstruct, vars);
+						bool b_poly = vars.size() > 1;
+						for(size_t i = 0; b_poly && i < vars.size(); i++) b_poly = is_polynomial_variable(vars[i]);
+						SparsePolynomial p1, p2, p;
+						if(b_poly && p1.set(*this, vars) && p2.set(mstruct, vars) && p.multiply(p1, p2)) {
+							p.get(*this, vars);
+							MERGE_APPROX_AND_PREC(mstruct)
+							calculatesub(eo, eo, false, mparent, index_this);
+							return 1;
+						}
+					}
 					// avoid multiplication of very long polynomials
 					if(eo.expand != 0 && SIZE < 1000 && mstruct.size() < 1000 && (SIZE * mstruct.size() < (eo.expand == -1 ? 50 : 500))) {
 						// avoid multiplication of polynomials with intervals (if factors might be negitive)
@@ -3077,6 +3136,72 @@ bool is_negation(const MathStructure &m1, const MathStructure &m2) {
 	return false;
 }
 
+// maximum number of terms in the multinomial expansion of polynomials in plain variables, when expansion has been explicitly requested (otherwise the limit is 300 terms)
+#define MULTINOMIAL_EXPANSION_MAX_TERMS 2000
+
+// (a1+a2+...+am)^n = sum of n!/(k1!*k2!*...*km!)*a1^k1*a2^k2*...*am^km, for all k1+k2+...+km=n
+// the powers of each term are calculated once and the product of a prefix (a1^k1*...*ai^ki) is shared by all following terms
+bool multinomial_expansion(MathStructure &mstruct, unsigned long int n, const EvaluationOptions &eo) {
+	size_t m = mstruct.size();
+	if(!mstruct.isAddition() || m < 2 || n < 2) return false;
+	vector<vector<MathStructure> > vpow(m);
+	for(size_t i = 0; i < m; i++) {
+		vpow[i].resize(n + 1);
+		vpow[i][0].set(1, 1, 0);
+		vpow[i][1] = mstruct[i];
+		for(unsigned long int k = 2; k <= n; k++) {
+			if(CALCULATOR->aborted()) return false;
+			vpow[i][k] = mstruct[i];
+			vpow[i][k].calculateRaise(Number((long int) k, 1L, 0L), eo);
+		}
+	}
+	MathStructure mnew;
+	mnew.setType(STRUCT_ADDITION);
+	// depth-first enumeration of (k1, k2, ..., km), with ki from the remaining exponent down to zero;
+	// the binomial coefficient of each level is updated incrementally (C(r, k-1) = C(r, k)*k/(r-k+1))
+	vector<unsigned long int> k(m), r(m);
+	vector<Number> bn(m), mc(m);
+	vector<MathStructure> mprefix(m);
+	size_t i = 0;
+	r[0] = n; k[0] = n;
+	bn[0].set(1, 1, 0); mc[0].set(1, 1, 0); mprefix[0].set(1, 1, 0);
+	while(true) {
+		if(i < m - 1) {
+			mc[i + 1] = mc[i];
+			mc[i + 1].multiply(bn[i]);
+			mprefix[i + 1] = mprefix[i];
+			if(k[i] > 0) mprefix[i + 1].calculateMultiply(vpow[i][k[i]], eo);
+			r[i + 1] = r[i] - k[i];
+			i++;
+			k[i] = r[i];
+			bn[i].set(1, 1, 0);
+			continue;
+		}
+		// the last exponent is the remainder
+		MathStructure *mterm = new MathStructure(mprefix[i]);
+		if(r[i] > 0) mterm->calculateMultiply(vpow[i][r[i]], eo);
+		if(!mc[i].isOne()) mterm->calculateMultiply(mc[i], eo);
+		mnew.addChild_nocopy(mterm);
+		// backtrack to the last level with a non-zero exponent
+		bool b_done = true;
+		while(i > 0) {
+			i--;
+			if(k[i] > 0) {
+				b_done = false;
+				break;
+			}
+		}
+		if(b_done) break;
+		if(CALCULATOR->aborted()) return false;
+		bn[i].multiply((long int) k[i]);
+		bn[i].divide((long int) (r[i] - k[i] + 1));
+		k[i]--;
+	}
+	mstruct.set_nocopy(mnew);
+	mstruct.calculatesub(eo, eo, false);
+	return true;
+}
+
 int MathStructure::merge_power(MathStructure &mstruct, const EvaluationOptions &eo, MathStructure *mparent, size_t index_this, size_t, bool) {
 	// test if base and exponent can be merged
 	if(mstruct.type() == STRUCT_NUMBER && m_type == STRUCT_NUMBER) {
@@ -3085,11 +3210,11 @@ int MathStructure::merge_power(MathStructure &mstruct, const EvaluationOptions &
 		if(nr.raise(mstruct.number(), eo.approximation < APPROXIMATION_APPROXIMATE) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || mstruct.number().isApproximate()) && (eo.allow_complex || !nr.isComplex() || o_number.isComplex() || mstruct.number().isComplex()) && (eo.allow_infinite || !nr.includesInfinity() || o_number.includesInfinity() || mstruct.number().includesInfinity())) {
 			// Exponentiation succeeded without inappropriate change in approximation status
 			if(o_number == nr) {
-				o_number = nr;
+				o_number = std::move(nr);
 				numberUpdated();
 				return 2;
 			}
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return 1;
 		}
@@ -3116,7 +3241,7 @@ int MathStructure::merge_power(MathStructure &mstruct, const EvaluationOptions &
 				// (-a)^b=(-1)^b*a^b
 				MathStructure mtest(*this);
 				if(mtest.number().negate() && mtest.calculateRaise(mstruct, eo)) {
-					set(mtest);
+					set_nocopy(mtest);
 					MathStructure *mmul = new MathStructure(-1, 1, 0);
 					mmul->calculateRaise(mstruct, eo);
 					multiply_nocopy(mmul);
@@ -3656,6 +3781,10 @@ int MathStructure::merge_power(MathStructure &mstruct, const EvaluationOptions &
 					bool neg = mstruct.number().isNegative();
 					Number m(mstruct.number());
 					m.setNegative(false);
+					// base converted to a multivariate polynomial with rational coefficients
+					vector<MathStructure> vars;
+					SparsePolynomial p1;
+					bool b_poly = false;
 					if(SIZE > 1) {
 						// determine if addition exponentiation should be expanded
 						// if number of terms and exponent is small enough to allow reasonably fast calculation
@@ -3681,11 +3810,21 @@ int MathStructure::merge_power(MathStructure &mstruct, const EvaluationOptions &
 									if(tc <= 4) tc = 0;
 									else tc -= 4;
 									b = num_terms.isLessThanOrEqualTo(tc > 1 ? 300 / tc : 300);
+									if(b || (eo.expand > 1 && num_terms.isLessThanOrEqualTo(MULTINOMIAL_EXPANSION_MAX_TERMS))) {
+										// polynomials in plain variables are expanded directly, without intermediate structures, allowing a larger number of terms when expansion has been explicitly requested
+										collect_symbols(*this, vars);
+										b_poly = !vars.empty();
+										for(size_t i = 0; b_poly && i < vars.size(); i++) b_poly = is_polynomial_variable(vars[i]);
+										if(b_poly) b_poly = p1.set(*this, vars);
+										if(b_poly) b = true;
+									}
 								}
 							}
 						}
 					}
 					if(b) {
+						MathStructure x_var;
+						vector<Number> v1, v;
 						if(!representsNonMatrix()) {
 							// use simple expansion for base which might be/inlcude matrix(es): (a+b)^n=(a+b)(a+b)...
 							MathStructure mthis(*this);
@@ -3697,47 +3836,18 @@ int MathStructure::merge_power(MathStructure &mstruct, const EvaluationOptions &
 								calculateMultiply(mthis, eo);
 								m--;
 							}
+						} else if(get_dense_polynomial(*this, x_var, v1) && (v1.size() - 1) * m.ulintValue() <= DENSE_POLYNOMIAL_MAX_DEGREE) {
+							// univariate polynomial with rational coefficients: binary exponentiation of coefficient vector
+							dense_polynomial_power(v1, m.ulintValue(), v);
+							dense_polynomial_to_mathstructure(v, x_var, *this);
 						} else {
-							// use binomial theorem
-							MathStructure mstruct1(CHILD(0));
-							MathStructure mstruct2(CHILD(1));
-							for(size_t i = 2; i < SIZE; i++) {
-								if(CALCULATOR->aborted()) goto default_power_merge;
-								mstruct2.add(CHILD(i), true);
-							}
-							Number k(1);
-							Number p1(m);
-							Number p2(1);
-							p1--;
-							Number bn;
-							MathStructure msave(*this);
-							CLEAR
-							APPEND(mstruct1);
-							CHILD(0).calculateRaise(m, eo);
-							while(k.isLessThan(m)) {
-								if(CALCULATOR->aborted() || !bn.binomial(m, k)) {
-									set(msave);
-									goto default_power_merge;
-								}
-								APPEND_NEW(bn);
-								LAST.multiply(mstruct1);
-								if(!p1.isOne()) {
-									LAST[1].raise_nocopy(new MathStructure(p1));
-									LAST[1].calculateRaiseExponent(eo);
-								}
-								LAST.multiply(mstruct2, true);
-								if(!p2.isOne()) {
-									LAST[2].raise_nocopy(new MathStructure(p2));
-									LAST[2].calculateRaiseExponent(eo);
-								}
-								LAST.calculatesub(eo, eo, false);
-								k++;
-								p1--;
-								p2++;
+							SparsePolynomial p;
+							if(b_poly && p.power(p1, m.ulintValue())) {
+								// multivariate polynomial with rational coefficients: multinomial expansion with each monomial added directly to the resulting polynomial
+								p.get(*this, vars);
+							} else if(CALCULATOR->aborted() || !multinomial_expansion(*this, m.ulintValue(), eo)) {
+								goto default_power_merge;
 							}
-							APPEND(mstruct2);
-							LAST.calculateRaise(m, eo);
-							calculatesub(eo, eo, false);
 						}
 						// negative exponent: inverse after expansion (using absolute exponent)
 						if(neg) calculateInverse(eo);
@@ -4078,7 +4188,7 @@ int MathStructure::merge_power(MathStructure &mstruct, const EvaluationOptions &
 							if(b && mtest.isPower() && mtest[1] == -mstruct.number().numerator()) b = false;
 							if(!b) break;
 							// (-x)^(-n/d)=(x^n)^(-1/d)
-							set(mtest, true);
+							set_nocopy(mtest, true);
 							raise(m_minus_one);
 							CHILD(1).number() /= mstruct.number().denominator();
 						} else {
@@ -4088,7 +4198,7 @@ int MathStructure::merge_power(MathStructure &mstruct, const EvaluationOptions &
 							if(b && mtest.isPower() && mtest[1] == mstruct.number().numerator()) b = false;
 							if(!b) break;
 							// (-x)^(n/d)=(x^n)^(1/d)
-							set(mtest, true);
+							set_nocopy(mtest, true);
 							raise(m_one);
 							CHILD(1).number() /= mstruct.number().denominator();
 						}
@@ -5073,11 +5183,11 @@ int MathStructure::merge_bitwise_and(MathStructure &mstruct, const EvaluationOpt
 		Number nr(o_number);
 		if(nr.bitAnd(mstruct.number()) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || mstruct.number().isApproximate()) && (eo.allow_complex || !nr.isComplex() || o_number.isComplex() || mstruct.number().isComplex()) && (eo.allow_infinite || !nr.includesInfinity() || o_number.includesInfinity() || mstruct.number().includesInfinity())) {
 			if(o_number == nr) {
-				o_number = nr;
+				o_number = std::move(nr);
 				numberUpdated();
 				return 2;
 			}
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return 1;
 		}
@@ -5152,11 +5262,11 @@ int MathStructure::merge_bitwise_or(MathStructure &mstruct, const EvaluationOpti
 		Number nr(o_number);
 		if(nr.bitOr(mstruct.number()) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || mstruct.number().isApproximate()) && (eo.allow_complex || !nr.isComplex() || o_number.isComplex() || mstruct.number().isComplex()) && (eo.allow_infinite || !nr.includesInfinity() || o_number.includesInfinity() || mstruct.number().includesInfinity())) {
 			if(o_number == nr) {
-				o_number = nr;
+				o_number = std::move(nr);
 				numberUpdated();
 				return 2;
 			}
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return 1;
 		}
@@ -5220,11 +5330,11 @@ int MathStructure::merge_bitwise_xor(MathStructure &mstruct, const EvaluationOpt
 		Number nr(o_number);
 		if(nr.bitXor(mstruct.number()) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || mstruct.number().isApproximate()) && (eo.allow_complex || !nr.isComplex() || o_number.isComplex() || mstruct.number().isComplex()) && (eo.allow_infinite || !nr.includesInfinity() || o_number.includesInfinity() || mstruct.number().includesInfinity())) {
 			if(o_number == nr) {
-				o_number = nr;
+				o_number = std::move(nr);
 				numberUpdated();
 				return 2;
 			}
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return 1;
 		}
@@ -5247,6 +5357,103 @@ int MathStructure::merge_bitwise_xor(MathStructure &mstruct, const EvaluationOpt
 	return -1;
 }
 
+// minimum number of terms for which like terms are grouped using hash table before pairwise merge (see MathStructure::merge_like_terms())
+#define LIKE_TERMS_MIN_SIZE 10
+
+bool like_term_factor_signature(const MathStructure &m, size_t &h) {
+	// only symbols and unknown variables, optionally raised to a positive integer, are allowed in the non-numeric part of a term with signature
+	// merge_addition() will never merge two such terms unless the non-numeric parts are equal
+	const MathStructure *mbase = &m;
+	long int i_exp = 1;
+	if(m.isPower()) {
+		if(!m[1].isNumber() || !m[1].number().isInteger() || !m[1].number().isPositive() || !m[1].number().isLessThan(LONG_MAX)) return false;
+		i_exp = m[1].number().lintValue();
+		mbase = &m[0];
+	}
+	if(!mbase->isSymbolic() && (!mbase->isVariable() || mbase->variable()->isKnown())) return false;
+	HASH_COMBINE(h, mbase->structuralHash());
+	HASH_COMBINE(h, i_exp);
+	return true;
+}
+// Returns a hash of the non-numeric part of a term, or zero if the term can not be merged using hash table.
+size_t like_term_signature(const MathStructure &m) {
+	if(m.isNumber()) {
+		// all finite numbers can be merged with each other
+		if(m.number().isInfinite(false) || m.number().isUndefined()) return 0;
+		return 1;
+	}
+	size_t h = 0;
+	if(m.isMultiplication()) {
+		size_t i = 0;
+		if(m[0].isNumber()) {
+			if(m[0].number().isInfinite(false) || m[0].number().isUndefined()) return 0;
+			i++;
+		}
+		if(i >= m.size()) return 0;
+		for(; i < m.size(); i++) {
+			if(!like_term_factor_signature(m[i], h)) return 0;
+		}
+	} else if(!like_term_factor_signature(m, h)) {
+		return 0;
+	}
+	if(h <= 1) h += 2;
+	return h;
+}
+
+// Merges terms with equal non-numeric parts (e.g. 2xy^2 and 3xy^2) in a large sum, using a hash table of term signatures, in near-linear time.
+// Returns true if all terms had a signature and no further pairwise merging is necessary.
+bool MathStructure::merge_like_terms(const EvaluationOptions &eo, bool &b_merged) {
+	if(!isAddition()) return false;
+	bool b_complete = true;
+	vector<bool> erased(SIZE, false);
+	unordered_map<size_t, vector<size_t> > buckets;
+	for(size_t i = 0; i < SIZE; i++) {
+		if(CALCULATOR->aborted()) {
+			// terms already merged into another term must still be removed
+			b_complete = false;
+			break;
+		}
+		size_t h = like_term_signature(CHILD(i));
+		if(h == 0) {
+			b_complete = false;
+			continue;
+		}
+		size_t i_cur = i;
+		while(true) {
+			vector<size_t> &bucket = buckets[h];
+			size_t i_merged = bucket.size();
+			for(size_t i2 = 0; i2 < bucket.size(); i2++) {
+				if(CHILD(bucket[i2]).merge_addition(CHILD(i_cur), eo, this, bucket[i2], i_cur) >= 1) {
+					i_merged = i2;
+					break;
+				}
+			}
+			if(i_merged == bucket.size()) {
+				// different terms with the same hash value (or terms which for some reason could not be merged)
+				if(!bucket.empty()) b_complete = false;
+				bucket.push_back(i_cur);
+				break;
+			}
+			erased[i_cur] = true;
+			b_merged = true;
+			// the signature of the merged term changes if, for example, the coefficient becomes zero
+			i_cur = bucket[i_merged];
+			size_t h2 = like_term_signature(CHILD(i_cur));
+			if(h2 == h) break;
+			bucket.erase(bucket.begin() + i_merged);
+			if(h2 == 0) {
+				b_complete = false;
+				break;
+			}
+			h = h2;
+		}
+	}
+	for(size_t i = SIZE; i > 0; i--) {
+		if(erased[i - 1]) ERASE(i - 1)
+	}
+	return b_complete;
+}
+
 #define MERGE_RECURSE			if(recursive) {\
 						for(size_t i = 0; i < SIZE; i++) {\
 							if(CALCULATOR->aborted()) break;\
@@ -5480,14 +5687,18 @@ bool MathStructure::factorizeUnits() {
 					mstruct_units[i].setUndefined();
 				}
 			}
+			vector<size_t> units_hash;
+			units_hash.reserve(mstruct_units.size());
+			for(size_t i = 0; i < mstruct_units.size(); i++) units_hash.push_back(mstruct_units[i].structuralHash());
 			for(size_t i = 0; i < mstruct_units.size(); i++) {
 				if(CALCULATOR->aborted()) break;
 				if(!mstruct_units[i].isUndefined()) {
 					for(size_t i2 = i + 1; i2 < mstruct_units.size();) {
-						if(mstruct_units[i2] == mstruct_units[i]) {
+						if(units_hash[i2] == units_hash[i] && mstruct_units[i2] == mstruct_units[i]) {
 							mstruct_new[i].add(mstruct_new[i2], true);
 							mstruct_new.delChild(i2 + 1);
 							mstruct_units.delChild(i2 + 1);
+							units_hash.erase(units_hash.begin() + i2);
 							b = true;
 						} else {
 							i2++;
@@ -5622,7 +5833,7 @@ bool MathStructure::calculatesub(const EvaluationOptions &eo, const EvaluationOp
 					CHILD(1).calculatesub(eo, feo, true, this, 1);
 					CALCULATOR->endTemporaryStopMessages(!CHILD(1).isZero());
 					if(CHILD(1).isZero()) {
-						CHILD(1).set(mbak);
+						CHILD(1).set_nocopy(mbak);
 						break;
 					}
 				} else {
@@ -5670,7 +5881,10 @@ bool MathStructure::calculatesub(const EvaluationOptions &eo, const EvaluationOp
 				unformat(eo);
 				MERGE_RECURSE
 			}
-			MERGE_ALL(merge_addition, try_add)
+			// terms in large sums are first merged using hash table, pairwise merging is only necessary if one or more terms could not be handled
+			if(SIZE < LIKE_TERMS_MIN_SIZE || !merge_like_terms(eo, b)) {
+				MERGE_ALL(merge_addition, try_add)
+			}
 			MERGE_ALL2
 			break;
 		}
@@ -6237,7 +6451,7 @@ bool MathStructure::calculatesub(const EvaluationOptions &eo, const EvaluationOp
 				mtest.calculatesub(eo2, feo, true);
 				if(mtest.isNumber()) {
 					CALCULATOR->endTemporaryStopMessages(true);
-					set(mtest);
+					set_nocopy(mtest);
 					b = true;
 					break;
 				}
@@ -6868,7 +7082,7 @@ bool MathStructure::calculateNegate(const EvaluationOptions &eo, MathStructure *
 	if(m_type == STRUCT_NUMBER) {
 		Number nr(o_number);
 		if(nr.negate() && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate())) {
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return true;
 		}
@@ -6904,7 +7118,7 @@ bool MathStructure::calculateRaise(const MathStructure &mexp, const EvaluationOp
 	if(mexp.type() == STRUCT_NUMBER && m_type == STRUCT_NUMBER) {
 		Number nr(o_number);
 		if(nr.raise(mexp.number(), eo.approximation < APPROXIMATION_APPROXIMATE) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || mexp.number().isApproximate()) && (eo.allow_complex || !nr.isComplex() || o_number.isComplex() || mexp.number().isComplex()) && (eo.allow_infinite || !nr.includesInfinity() || o_number.includesInfinity() || mexp.number().includesInfinity())) {
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return true;
 		}
@@ -7054,7 +7268,7 @@ bool MathStructure::calculateMultiply(const MathStructure &mmul, const Evaluatio
 	if(mmul.type() == STRUCT_NUMBER && m_type == STRUCT_NUMBER) {
 		Number nr(o_number);
 		if(nr.multiply(mmul.number()) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || mmul.number().isApproximate()) && (eo.allow_complex || !nr.isComplex() || o_number.isComplex() || mmul.number().isComplex()) && (eo.allow_infinite || !nr.includesInfinity() || o_number.includesInfinity() || mmul.number().includesInfinity())) {
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return true;
 		}
@@ -7063,11 +7277,17 @@ bool MathStructure::calculateMultiply(const MathStructure &mmul, const Evaluatio
 	LAST.evalSort();
 	return calculateMultiplyIndex(SIZE - 1, eo, true, mparent, index_this);
 }
+bool MathStructure::calculateMultiply(MathStructure &&mmul, const EvaluationOptions &eo, MathStructure *mparent, size_t index_this) {
+	if(mmul.type() == STRUCT_NUMBER && m_type == STRUCT_NUMBER) return calculateMultiply((const MathStructure&) mmul, eo, mparent, index_this);
+	multiply_nocopy(new MathStructure(std::move(mmul)), true);
+	LAST.evalSort();
+	return calculateMultiplyIndex(SIZE - 1, eo, true, mparent, index_this);
+}
 bool MathStructure::calculateDivide(const MathStructure &mdiv, const EvaluationOptions &eo, MathStructure *mparent, size_t index_this) {
 	if(mdiv.type() == STRUCT_NUMBER && m_type == STRUCT_NUMBER) {
 		Number nr(o_number);
 		if(nr.divide(mdiv.number()) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || mdiv.number().isApproximate()) && (eo.allow_complex || !nr.isComplex() || o_number.isComplex() || mdiv.number().isComplex()) && (eo.allow_infinite || !nr.includesInfinity() || o_number.includesInfinity() || mdiv.number().includesInfinity())) {
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return true;
 		}
@@ -7096,7 +7316,7 @@ bool MathStructure::calculateAdd(const MathStructure &madd, const EvaluationOpti
 	if(madd.type() == STRUCT_NUMBER && m_type == STRUCT_NUMBER) {
 		Number nr(o_number);
 		if(nr.add(madd.number()) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || madd.number().isApproximate())) {
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return true;
 		}
@@ -7105,11 +7325,17 @@ bool MathStructure::calculateAdd(const MathStructure &madd, const EvaluationOpti
 	LAST.evalSort();
 	return calculateAddIndex(SIZE - 1, eo, true, mparent, index_this);
 }
+bool MathStructure::calculateAdd(MathStructure &&madd, const EvaluationOptions &eo, MathStructure *mparent, size_t index_this) {
+	if(madd.type() == STRUCT_NUMBER && m_type == STRUCT_NUMBER) return calculateAdd((const MathStructure&) madd, eo, mparent, index_this);
+	add_nocopy(new MathStructure(std::move(madd)), true);
+	LAST.evalSort();
+	return calculateAddIndex(SIZE - 1, eo, true, mparent, index_this);
+}
 bool MathStructure::calculateSubtract(const MathStructure &msub, const EvaluationOptions &eo, MathStructure *mparent, size_t index_this) {
 	if(msub.type() == STRUCT_NUMBER && m_type == STRUCT_NUMBER) {
 		Number nr(o_number);
 		if(nr.subtract(msub.number()) && (eo.approximation >= APPROXIMATION_APPROXIMATE || !nr.isApproximate() || o_number.isApproximate() || msub.number().isApproximate())) {
-			o_number = nr;
+			o_number = std::move(nr);
 			numberUpdated();
 			return true;
 		}
@@ -7671,29 +7897,32 @@ void MathStructure::evalSort(bool recursive, bool b_abs) {
 	sorted.reserve(SIZE);
 	for(size_t i = 0; i < SIZE; i++) {
 		if(i == 0) {
-			sorted.push_back(v_order[i]);
+			sorted.push_back(i);
 		} else {
 			if(evalSortCompare(CHILD(i), *v_subs[sorted.back()], *this, b_abs) >= 0) {
-				sorted.push_back(v_order[i]);
+				sorted.push_back(i);
 			} else if(sorted.size() == 1) {
-				sorted.insert(sorted.begin(), v_order[i]);
+				sorted.insert(sorted.begin(), i);
 			} else {
 				for(size_t i2 = sorted.size() - 2; ; i2--) {
 					if(evalSortCompare(CHILD(i), *v_subs[sorted[i2]], *this, b_abs) >= 0) {
-						sorted.insert(sorted.begin() + i2 + 1, v_order[i]);
+						sorted.insert(sorted.begin() + i2 + 1, i);
 						break;
 					}
 					if(i2 == 0) {
-						sorted.insert(sorted.begin(), v_order[i]);
+						sorted.insert(sorted.begin(), i);
 						break;
 					}
 				}
 			}
 		}
 	}
+	vector<MathStructure*> v_subs_sorted;
+	v_subs_sorted.reserve(sorted.size());
 	for(size_t i2 = 0; i2 < sorted.size(); i2++) {
-		v_order[i2] = sorted[i2];
+		v_subs_sorted.push_back(v_subs[sorted[i2]]);
 	}
+	v_subs.swap(v_subs_sorted);
 }
 
 
@@ -0,0 +1,372 @@
+/*
+    Qalculate (library)
+
+    Copyright (C) 2024  Hanna Knutsson (hanna.knutsson@protonmail.com)
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+*/
+
+#include "support.h"
+
+#include "MathStructure.h"
+#include "Calculator.h"
+#include "BuiltinFunctions.h"
+#include "Number.h"
+#include "Function.h"
+#include "Variable.h"
+#include "Unit.h"
+#include "MathStructure-support.h"
+
+#include <math.h>
+#include <float.h>
+
+using std::string;
+using std::cout;
+using std::vector;
+using std::endl;
+
+enum {
+	COMPILED_SET,
+	COMPILED_ADD,
+	COMPILED_MULTIPLY,
+	COMPILED_DIVIDE,
+	COMPILED_RAISE,
+	COMPILED_NEGATE,
+	COMPILED_RECIP,
+	COMPILED_FUNCTION
+};
+
+#define COMPILE_FAILED ((size_t) -1)
+#define COMPILED_BLOCK_SIZE 256
+
+bool contains_known_variable(const MathStructure &m) {
+	if(m.isVariable() && m.variable()->isKnown()) return true;
+	for(size_t i = 0; i < m.size(); i++) {
+		if(contains_known_variable(m[i])) return true;
+	}
+	return false;
+}
+
+CompiledExpression::CompiledExpression(const MathStructure &m, const MathStructure &x_mstruct, const EvaluationOptions &eo2, bool allow_double) : m_expr(m), x_var(x_mstruct), eo(eo2) {
+	i_result = 0;
+	b_compiled = false;
+	i_double = (allow_double ? -1 : 0);
+	d_cancel_limit = 0.0;
+	// exact calculation might produce symbolic results which are not reproduced by number operations
+	if(eo.approximation != APPROXIMATION_APPROXIMATE || eo.interval_calculation == INTERVAL_CALCULATION_INTERVAL_ARITHMETIC || eo.interval_calculation == INTERVAL_CALCULATION_VARIANCE_FORMULA || !m_expr.contains(x_var)) return;
+	// register 0 is reserved for the value of x
+	regs.resize(1);
+	CALCULATOR->beginTemporaryStopMessages();
+	i_result = compileSub(m_expr);
+	b_compiled = (CALCULATOR->endTemporaryStopMessages() == 0 && i_result != COMPILE_FAILED && !CALCULATOR->aborted());
+	if(!b_compiled) {
+		ops.clear();
+		regs.clear();
+	}
+}
+bool CompiledExpression::isCompiled() const {
+	return b_compiled;
+}
+size_t CompiledExpression::addOperation(int type, size_t r, size_t r2) {
+	Operation op;
+	op.type = type;
+	op.r = r;
+	op.r2 = r2;
+	ops.push_back(op);
+	return r;
+}
+size_t CompiledExpression::compileSub(const MathStructure &m, bool in_angle) {
+	if(m == x_var) return 0;
+	if(m.isNumber()) {
+		if(m.number().isInterval() || m.number().includesInfinity() || m.number().isUndefined()) return COMPILE_FAILED;
+		regs.push_back(m.number());
+		return regs.size() - 1;
+	}
+	if(in_angle && m.isUnit() && m.unit() == CALCULATOR->getRadUnit() && !m.prefix()) {
+		regs.push_back(nr_one);
+		return regs.size() - 1;
+	}
+	if(!m.contains(x_var)) {
+		// calculate constant sub-expressions once
+		if(m.containsType(STRUCT_UNIT, false, true, true) != 0) return COMPILE_FAILED;
+		if(in_angle && contains_known_variable(m)) return COMPILE_FAILED;
+		MathStructure mtest(m);
+		mtest.eval(eo);
+		if(!mtest.isNumber()) return COMPILE_FAILED;
+		return compileSub(mtest, in_angle);
+	}
+	switch(m.type()) {
+		case STRUCT_ADDITION: {}
+		case STRUCT_MULTIPLICATION: {
+			size_t r = regs.size();
+			regs.push_back(nr_zero);
+			for(size_t i = 0; i < m.size(); i++) {
+				size_t r2 = compileSub(m[i], in_angle);
+				if(r2 == COMPILE_FAILED) return COMPILE_FAILED;
+				addOperation(i == 0 ? COMPILED_SET : (m.isAddition() ? COMPILED_ADD : COMPILED_MULTIPLY), r, r2);
+			}
+			return r;
+		}
+		case STRUCT_DIVISION: {}
+		case STRUCT_POWER: {
+			size_t r = regs.size();
+			regs.push_back(nr_zero);
+			size_t r2 = compileSub(m[0], in_angle);
+			if(r2 == COMPILE_FAILED) return COMPILE_FAILED;
+			addOperation(COMPILED_SET, r, r2);
+			r2 = compileSub(m[1], in_angle);
+			if(r2 == COMPILE_FAILED) return COMPILE_FAILED;
+			return addOperation(m.isPower() ? COMPILED_RAISE : COMPILED_DIVIDE, r, r2);
+		}
+		case STRUCT_NEGATE: {}
+		case STRUCT_INVERSE: {
+			size_t r = regs.size();
+			regs.push_back(nr_zero);
+			size_t r2 = compileSub(m[0], in_angle);
+			if(r2 == COMPILE_FAILED) return COMPILE_FAILED;
+			addOperation(COMPILED_SET, r, r2);
+			return addOperation(m.type() == STRUCT_NEGATE ? COMPILED_NEGATE : COMPILED_RECIP, r);
+		}
+		case STRUCT_FUNCTION: {
+			if(!eo.calculate_functions || m.size() != 1) return COMPILE_FAILED;
+			int id = m.function()->id();
+			bool b_angle = false;
+			switch(id) {
+				case FUNCTION_ID_SIN: {}
+				case FUNCTION_ID_COS: {}
+				case FUNCTION_ID_TAN: {
+					// exact values for multiples of pi and angle conversions are handled by the functions
+					if(!DEFAULT_RADIANS(eo.parse_options.angle_unit) || contains_known_variable(m[0])) return COMPILE_FAILED;
+					b_angle = true;
+					break;
+				}
+				case FUNCTION_ID_ASIN: {}
+				case FUNCTION_ID_ACOS: {}
+				case FUNCTION_ID_ATAN: {
+					// the result is multiplied by the radian unit if no default angle unit is set
+					if(!DEFAULT_RADIANS(eo.parse_options.angle_unit) || NO_DEFAULT_ANGLE_UNIT(eo.parse_options.angle_unit)) return COMPILE_FAILED;
+					break;
+				}
+				case FUNCTION_ID_SINH: {}
+				case FUNCTION_ID_COSH: {}
+				case FUNCTION_ID_TANH: {}
+				case FUNCTION_ID_ASINH: {}
+				case FUNCTION_ID_ACOSH: {}
+				case FUNCTION_ID_ATANH: {}
+				case FUNCTION_ID_EXP: {}
+				case FUNCTION_ID_LOG: {}
+				case FUNCTION_ID_SQRT: {}
+				case FUNCTION_ID_CBRT: {}
+				case FUNCTION_ID_ABS: {break;}
+				default: {return COMPILE_FAILED;}
+			}
+			size_t r = regs.size();
+			regs.push_back(nr_zero);
+			size_t r2 = compileSub(m[0], b_angle);
+			if(r2 == COMPILE_FAILED) return COMPILE_FAILED;
+			addOperation(COMPILED_SET, r, r2);
+			return addOperation(COMPILED_FUNCTION, r, (size_t) id);
+		}
+		default: {}
+	}
+	return COMPILE_FAILED;
+}
+bool CompiledExpression::calculateNumber(const Number &x_value, Number &result) {
+	if(!b_compiled || x_value.isInterval()) return false;
+	regs[0] = x_value;
+	for(size_t i = 0; i < ops.size(); i++) {
+		Number &nr = regs[ops[i].r];
+		switch(ops[i].type) {
+			case COMPILED_SET: {nr = regs[ops[i].r2]; break;}
+			case COMPILED_ADD: {if(!nr.add(regs[ops[i].r2])) return false; break;}
+			case COMPILED_MULTIPLY: {if(!nr.multiply(regs[ops[i].r2])) return false; break;}
+			case COMPILED_DIVIDE: {if(!nr.divide(regs[ops[i].r2])) return false; break;}
+			case COMPILED_RAISE: {if(!nr.raise(regs[ops[i].r2])) return false; break;}
+			case COMPILED_NEGATE: {if(!nr.negate()) return false; break;}
+			case COMPILED_RECIP: {if(!nr.recip()) return false; break;}
+			case COMPILED_FUNCTION: {
+				bool b = false;
+				switch(ops[i].r2) {
+					case FUNCTION_ID_SIN: {b = nr.sin(); break;}
+					case FUNCTION_ID_COS: {b = nr.cos(); break;}
+					case FUNCTION_ID_TAN: {b = nr.tan(); break;}
+					case FUNCTION_ID_ASIN: {b = nr.asin(); break;}
+					case FUNCTION_ID_ACOS: {b = nr.acos(); break;}
+					case FUNCTION_ID_ATAN: {b = nr.atan(); break;}
+					case FUNCTION_ID_SINH: {b = nr.sinh(); break;}
+					case FUNCTION_ID_COSH: {b = nr.cosh(); break;}
+					case FUNCTION_ID_TANH: {b = nr.tanh(); break;}
+					case FUNCTION_ID_ASINH: {b = nr.asinh(); break;}
+					case FUNCTION_ID_ACOSH: {b = nr.acosh(); break;}
+					case FUNCTION_ID_ATANH: {b = nr.atanh(); break;}
+					case FUNCTION_ID_EXP: {b = nr.exp(); break;}
+					case FUNCTION_ID_LOG: {b = nr.ln(); break;}
+					case FUNCTION_ID_SQRT: {b = nr.sqrt(); break;}
+					case FUNCTION_ID_CBRT: {b = nr.cbrt(); break;}
+					case FUNCTION_ID_ABS: {b = nr.abs(); break;}
+				}
+				if(!b) return false;
+				break;
+			}
+		}
+	}
+	const Number &nr = regs[i_result];
+	// leave special values and complex numbers (if not allowed) to eval()
+	if(nr.isUndefined() || nr.includesInfinity() || nr.isInterval() || (!eo.allow_complex && nr.hasImaginaryPart())) return false;
+	result = nr;
+	return true;
+}
+bool CompiledExpression::initDoubles() {
+	if(i_double >= 0) return i_double > 0;
+	i_double = 0;
+	// double precision floating point leaves no margin for higher precision
+	if(!b_compiled || PRECISION > 14) return false;
+	vector<bool> is_constant(regs.size(), true);
+	is_constant[0] = false;
+	for(size_t i = 0; i < ops.size(); i++) is_constant[ops[i].r] = false;
+	dregs.resize(regs.size() * COMPILED_BLOCK_SIZE);
+	for(size_t i = 1; i < regs.size(); i++) {
+		if(is_constant[i]) {
+			if(!regs[i].isReal() || regs[i].isInterval()) return false;
+			double d = regs[i].floatValue();
+			if(!isfinite(d) || (d == 0.0 && !regs[i].isZero()) || (d != 0.0 && fabs(d) < DBL_MIN)) return false;
+			std::fill(dregs.begin() + i * COMPILED_BLOCK_SIZE, dregs.begin() + (i + 1) * COMPILED_BLOCK_SIZE, d);
+		}
+	}
+	dfailed.resize(COMPILED_BLOCK_SIZE);
+	// maximum relative magnitude of the result of an addition (sum of absolute values of the terms), before too many significant digits are lost
+	d_cancel_limit = pow(10.0, PRECISION - 15);
+	i_double = 1;
+	return true;
+}
+void CompiledExpression::calculateDoubleBlock(const double *x_values, double *y_values, size_t n) {
+	// each operation is applied to the whole block before the next operation, in simple loops which can be vectorized by the compiler
+	double *dx = &dregs[0];
+	char *failed = &dfailed[0];
+	for(size_t i = 0; i < n; i++) {
+		dx[i] = x_values[i];
+		failed[i] = 0;
+	}
+	// arguments of trigonometric functions must be well within the precision of double
+	double d_trig_limit = d_cancel_limit / DBL_EPSILON;
+	for(size_t i_op = 0; i_op < ops.size(); i_op++) {
+		double *r = &dregs[ops[i_op].r * COMPILED_BLOCK_SIZE];
+		const double *r2 = (ops[i_op].type == COMPILED_FUNCTION ? NULL : &dregs[ops[i_op].r2 * COMPILED_BLOCK_SIZE]);
+		switch(ops[i_op].type) {
+			case COMPILED_SET: {
+				for(size_t i = 0; i < n; i++) r[i] = r2[i];
+				break;
+			}
+			case COMPILED_ADD: {
+				for(size_t i = 0; i < n; i++) {
+					double d = fabs(r[i]) + fabs(r2[i]);
+					r[i] += r2[i];
+					failed[i] |= (fabs(r[i]) < d * d_cancel_limit);
+				}
+				break;
+			}
+			case COMPILED_MULTIPLY: {
+				for(size_t i = 0; i < n; i++) {
+					bool b_zero = (r[i] == 0.0 || r2[i] == 0.0);
+					r[i] *= r2[i];
+					failed[i] |= (r[i] == 0.0 && !b_zero);
+				}
+				break;
+			}
+			case COMPILED_DIVIDE: {
+				for(size_t i = 0; i < n; i++) {
+					bool b_zero = (r[i] == 0.0);
+					r[i] /= r2[i];
+					failed[i] |= (r[i] == 0.0 && !b_zero);
+				}
+				break;
+			}
+			case COMPILED_RAISE: {
+				for(size_t i = 0; i < n; i++) {
+					bool b_zero = (r[i] == 0.0);
+					r[i] = pow(r[i], r2[i]);
+					failed[i] |= (r[i] == 0.0 && !b_zero);
+				}
+				break;
+			}
+			case COMPILED_NEGATE: {
+				for(size_t i = 0; i < n; i++) r[i] = -r[i];
+				break;
+			}
+			case COMPILED_RECIP: {
+				for(size_t i = 0; i < n; i++) r[i] = 1.0 / r[i];
+				break;
+			}
+			case COMPILED_FUNCTION: {
+				switch(ops[i_op].r2) {
+					case FUNCTION_ID_SIN: {}
+					case FUNCTION_ID_COS: {}
+					case FUNCTION_ID_TAN: {
+						for(size_t i = 0; i < n; i++) failed[i] |= (fabs(r[i]) > d_trig_limit);
+						if(ops[i_op].r2 == FUNCTION_ID_SIN) {for(size_t i = 0; i < n; i++) r[i] = sin(r[i]);}
+						else if(ops[i_op].r2 == FUNCTION_ID_COS) {for(size_t i = 0; i < n; i++) r[i] = cos(r[i]);}
+						else {for(size_t i = 0; i < n; i++) r[i] = tan(r[i]);}
+						break;
+					}
+					case FUNCTION_ID_ASIN: {for(size_t i = 0; i < n; i++) r[i] = asin(r[i]); break;}
+					case FUNCTION_ID_ACOS: {for(size_t i = 0; i < n; i++) r[i] = acos(r[i]); break;}
+					case FUNCTION_ID_ATAN: {for(size_t i = 0; i < n; i++) r[i] = atan(r[i]); break;}
+					case FUNCTION_ID_SINH: {for(size_t i = 0; i < n; i++) r[i] = sinh(r[i]); break;}
+					case FUNCTION_ID_COSH: {for(size_t i = 0; i < n; i++) r[i] = cosh(r[i]); break;}
+					case FUNCTION_ID_TANH: {for(size_t i = 0; i < n; i++) r[i] = tanh(r[i]); break;}
+					case FUNCTION_ID_ASINH: {for(size_t i = 0; i < n; i++) r[i] = asinh(r[i]); break;}
+					case FUNCTION_ID_ACOSH: {for(size_t i = 0; i < n; i++) r[i] = acosh(r[i]); break;}
+					case FUNCTION_ID_ATANH: {for(size_t i = 0; i < n; i++) r[i] = atanh(r[i]); break;}
+					case FUNCTION_ID_EXP: {
+						for(size_t i = 0; i < n; i++) {
+							r[i] = exp(r[i]);
+							failed[i] |= (r[i] == 0.0);
+						}
+						break;
+					}
+					case FUNCTION_ID_LOG: {for(size_t i = 0; i < n; i++) r[i] = log(r[i]); break;}
+					case FUNCTION_ID_SQRT: {for(size_t i = 0; i < n; i++) r[i] = sqrt(r[i]); break;}
+					case FUNCTION_ID_CBRT: {for(size_t i = 0; i < n; i++) r[i] = cbrt(r[i]); break;}
+					case FUNCTION_ID_ABS: {for(size_t i = 0; i < n; i++) r[i] = fabs(r[i]); break;}
+				}
+				break;
+			}
+		}
+		// overflow, underflow and undefined or complex results
+		for(size_t i = 0; i < n; i++) failed[i] |= (!isfinite(r[i]) || (r[i] != 0.0 && fabs(r[i]) < DBL_MIN));
+	}
+	const double *dresult = &dregs[i_result * COMPILED_BLOCK_SIZE];
+	for(size_t i = 0; i < n; i++) y_values[i] = (failed[i] ? NAN : dresult[i]);
+}
+bool CompiledExpression::calculateDoubles(const vector<double> &x_values, vector<double> &y_values) {
+	if(!initDoubles()) return false;
+	y_values.resize(x_values.size());
+	for(size_t i = 0; i < x_values.size(); i += COMPILED_BLOCK_SIZE) {
+		if(CALCULATOR->aborted()) return false;
+		calculateDoubleBlock(&x_values[i], &y_values[i], x_values.size() - i < COMPILED_BLOCK_SIZE ? x_values.size() - i : COMPILED_BLOCK_SIZE);
+	}
+	return true;
+}
+void CompiledExpression::calculate(const MathStructure &x_value, MathStructure &result) {
+	if(i_double != 0 && x_value.isNumber() && x_value.number().isReal() && !x_value.number().isInterval() && initDoubles()) {
+		double x_d = x_value.number().floatValue(), y_d;
+		calculateDoubleBlock(&x_d, &y_d, 1);
+		if(!isnan(y_d)) {
+			result.set(y_d);
+			return;
+		}
+	}
+	if(b_compiled && x_value.isNumber()) {
+		Number nr;
+		if(calculateNumber(x_value.number(), nr)) {
+			result.set(nr);
+			return;
+		}
+	}
+	result = m_expr;
+	result.replace(x_var, x_value);
+	result.eval(eo);
+}
@@ -92,7 +92,7 @@ bool MathStructure::differentiate(const MathStructure &x_var, const EvaluationOp
 				MathStructure mtest(*this);
 				mtest.setType(STRUCT_MULTIPLICATION);
 				if(mtest.differentiate(x_var, eo) && mtest.containsFunctionId(FUNCTION_ID_DIFFERENTIATE, true) <= 0) {
-					set(mtest);
+					set_nocopy(mtest);
 					break;
 				}
 			}
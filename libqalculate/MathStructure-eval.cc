@@ -2331,7 +2331,8 @@ bool MathStructure::expand(const EvaluationOptions &eo, bool unfactorize) {
 	if(SIZE == 0) return false;
 	EvaluationOptions eo2 = eo;
 	eo2.sync_units = false;
-	eo2.expand = true;
+	// explicitly requested expansion: larger polynomial products and powers are expanded
+	eo2.expand = 2;
 	if(unfactorize) calculatesub(eo2, eo2);
 	do_simplification(*this, eo2, true, false, false);
 	return false;
@@ -2952,7 +2953,7 @@ MathStructure &MathStructure::eval(const EvaluationOptions &eo) {
 				}
 				CALCULATOR->endTemporaryStopMessages(!b_failed);
 				if(b_failed) {
-					set(mbak);
+					set_nocopy(mbak);
 					if(CALCULATOR->aborted()) {replace_aborted_variables(*this); return *this;}
 					CALCULATOR->error(false, _("Calculation of uncertainty propagation failed (using interval arithmetic instead)."), NULL);
 					EvaluationOptions eo3 = eo;
@@ -978,6 +978,506 @@ bool polynomial_divide_integers(const vector<Number> &vnum, const vector<Number>
 	return false;
 }
 
+// Univariate integer polynomial factorization (Zassenhaus): factorization modulo a small prime using distinct degree and Cantor-Zassenhaus equal degree factorization, quadratic Hensel lifting of the modular factors and recombination of the lifted factors using trial division.
+// Polynomials modulo p are stored as vector<long int>, and polynomials with integer coefficients as vector<Number>, lowest degree first and without leading zeroes.
+
+#define FACTOR_MODP_GOOD_PRIMES 5
+#define FACTOR_MODP_MAX_BAD_PRIMES 200
+
+long int modp_inv(long int a, long int p) {
+	// products of residues are calculated using long long int, since long int might only have 32 bits
+	long long int t = 0, t2 = 1, r = p, r2 = a % p, q, tmp;
+	while(r2 != 0) {
+		q = r / r2;
+		tmp = t - q * t2; t = t2; t2 = tmp;
+		tmp = r - q * r2; r = r2; r2 = tmp;
+	}
+	if(t < 0) t += p;
+	return (long int) t;
+}
+void modp_trim(vector<long int> &a) {
+	while(!a.empty() && a.back() == 0) a.pop_back();
+}
+void modp_monic(vector<long int> &a, long int p) {
+	modp_trim(a);
+	if(a.empty() || a.back() == 1) return;
+	long int inv = modp_inv(a.back(), p);
+	for(size_t i = 0; i < a.size(); i++) a[i] = ((long long int) a[i] * inv) % p;
+}
+void modp_sub(vector<long int> &a, const vector<long int> &b, long int p) {
+	if(a.size() < b.size()) a.resize(b.size(), 0);
+	for(size_t i = 0; i < b.size(); i++) a[i] = (a[i] + p - b[i]) % p;
+	modp_trim(a);
+}
+void modp_mul(const vector<long int> &a, const vector<long int> &b, vector<long int> &c, long int p) {
+	c.clear();
+	if(a.empty() || b.empty()) return;
+	vector<long long int> v(a.size() + b.size() - 1, 0);
+	for(size_t i = 0; i < a.size(); i++) {
+		if(a[i] == 0) continue;
+		for(size_t i2 = 0; i2 < b.size(); i2++) v[i + i2] += (long long int) a[i] * b[i2];
+		if(i % 1024 == 1023) {
+			for(size_t i2 = 0; i2 < v.size(); i2++) v[i2] %= p;
+		}
+	}
+	c.resize(v.size());
+	for(size_t i = 0; i < v.size(); i++) c[i] = v[i] % p;
+	modp_trim(c);
+}
+// a = a mod b
+void modp_rem(vector<long int> &a, const vector<long int> &b, long int p) {
+	modp_trim(a);
+	if(a.size() < b.size()) return;
+	long int inv = modp_inv(b.back(), p);
+	size_t db = b.size() - 1;
+	// the reduction modulo p is delayed, since p^2 * deg(a) fits in a long long int
+	vector<long long int> v(a.begin(), a.end());
+	for(size_t i = v.size() - 1; i >= db; i--) {
+		long long int c = ((v[i] % p) * inv) % p;
+		if(c != 0) {
+			c = p - c;
+			size_t shift = i - db;
+			for(size_t i2 = 0; i2 < db; i2++) v[shift + i2] += c * b[i2];
+		}
+		if(i == 0) break;
+	}
+	a.resize(db);
+	for(size_t i = 0; i < db; i++) a[i] = v[i] % p;
+	modp_trim(a);
+}
+void modp_divrem(const vector<long int> &a, const vector<long int> &b, vector<long int> &q, vector<long int> &r, long int p) {
+	r = a;
+	modp_trim(r);
+	q.clear();
+	if(r.size() < b.size()) return;
+	q.resize(r.size() - b.size() + 1, 0);
+	long int inv = modp_inv(b.back(), p);
+	size_t db = b.size() - 1;
+	vector<long long int> v(r.begin(), r.end());
+	for(size_t i = v.size() - 1; i >= db; i--) {
+		long long int c = ((v[i] % p) * inv) % p;
+		size_t shift = i - db;
+		q[shift] = c;
+		if(c != 0) {
+			c = p - c;
+			for(size_t i2 = 0; i2 < db; i2++) v[shift + i2] += c * b[i2];
+		}
+		if(i == 0) break;
+	}
+	r.resize(db);
+	for(size_t i = 0; i < db; i++) r[i] = v[i] % p;
+	modp_trim(r);
+	modp_trim(q);
+}
+// monic greatest common divisor
+void modp_gcd(const vector<long int> &a, const vector<long int> &b, vector<long int> &g, long int p) {
+	vector<long int> r(b);
+	g = a;
+	modp_trim(g);
+	modp_trim(r);
+	while(!r.empty()) {
+		modp_rem(g, r, p);
+		g.swap(r);
+	}
+	modp_monic(g, p);
+}
+// s * a + t * b = 1, with deg(s) < deg(b) and deg(t) < deg(a), for coprime a and b
+void modp_xgcd(const vector<long int> &a, const vector<long int> &b, vector<long int> &s, vector<long int> &t, long int p) {
+	vector<long int> r0(a), r1(b), s1, t1, q, r, tmp;
+	s.clear(); s.push_back(1);
+	t.clear();
+	t1.push_back(1);
+	modp_trim(r0); modp_trim(r1);
+	while(!r1.empty()) {
+		modp_divrem(r0, r1, q, r, p);
+		r0.swap(r1); r1.swap(r);
+		modp_mul(q, s1, tmp, p); modp_sub(s, tmp, p); s.swap(s1);
+		modp_mul(q, t1, tmp, p); modp_sub(t, tmp, p); t.swap(t1);
+	}
+	if(r0.empty()) return;
+	long int inv = modp_inv(r0[0], p);
+	for(size_t i = 0; i < s.size(); i++) s[i] = ((long long int) s[i] * inv) % p;
+	for(size_t i = 0; i < t.size(); i++) t[i] = ((long long int) t[i] * inv) % p;
+}
+// r = a^e mod f
+void modp_powmod(const vector<long int> &a, const mpz_t e, const vector<long int> &f, vector<long int> &r, long int p) {
+	vector<long int> base(a), tmp;
+	modp_rem(base, f, p);
+	r.clear(); r.push_back(1);
+	for(long int i = mpz_sizeinbase(e, 2) - 1; i >= 0; i--) {
+		modp_mul(r, r, tmp, p);
+		modp_rem(tmp, f, p);
+		if(mpz_tstbit(e, i)) {
+			modp_mul(tmp, base, r, p);
+			modp_rem(r, f, p);
+		} else {
+			r.swap(tmp);
+		}
+	}
+}
+// Cantor-Zassenhaus splitting of a monic polynomial whose irreducible factors all have degree d (p must be odd)
+void modp_equal_degree_factorize(const vector<long int> &g, size_t d, long int p, vector<vector<long int> > &factors, unsigned long int &seed) {
+	if(g.size() - 1 <= d) {
+		factors.push_back(g);
+		return;
+	}
+	mpz_t e;
+	mpz_init(e);
+	mpz_ui_pow_ui(e, p, d);
+	mpz_sub_ui(e, e, 1);
+	mpz_divexact_ui(e, e, 2);
+	vector<long int> a, b, c, q, r;
+	while(!CALCULATOR->aborted()) {
+		a.resize(g.size() - 1);
+		for(size_t i = 0; i < a.size(); i++) {
+			seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+			a[i] = (seed >> 8) % p;
+		}
+		modp_trim(a);
+		if(a.size() < 2) continue;
+		modp_powmod(a, e, g, b, p);
+		if(b.empty()) b.push_back(p - 1);
+		else b[0] = (b[0] + p - 1) % p;
+		modp_trim(b);
+		modp_gcd(g, b, c, p);
+		if(c.size() > 1 && c.size() < g.size()) {
+			modp_divrem(g, c, q, r, p);
+			modp_equal_degree_factorize(c, d, p, factors, seed);
+			modp_equal_degree_factorize(q, d, p, factors, seed);
+			break;
+		}
+	}
+	mpz_clear(e);
+}
+// distinct degree factorization of a monic square-free polynomial modulo p; ddf_factors[i] is the product of all irreducible factors of degree ddf_degrees[i]
+void modp_distinct_degree_factorize(const vector<long int> &f, long int p, vector<vector<long int> > &ddf_factors, vector<size_t> &ddf_degrees) {
+	size_t n = f.size() - 1;
+	mpz_t e;
+	mpz_init_set_si(e, p);
+	vector<long int> x, h, hx, g, q, r;
+	x.push_back(0); x.push_back(1);
+	// x^p mod f, and the rows of the Frobenius matrix, x^(i*p) mod f
+	modp_powmod(x, e, f, h, p);
+	mpz_clear(e);
+	vector<vector<long int> > frob(n);
+	frob[0].push_back(1);
+	for(size_t i = 1; i < n; i++) {
+		modp_mul(frob[i - 1], h, frob[i], p);
+		modp_rem(frob[i], f, p);
+	}
+	// h = x^(p^d) mod f
+	vector<long int> fr(f);
+	vector<long long int> v;
+	for(size_t d = 1; 2 * d <= fr.size() - 1; d++) {
+		if(CALCULATOR->aborted()) return;
+		hx = h;
+		if(hx.size() < 2) hx.resize(2, 0);
+		hx[1] = (hx[1] + p - 1) % p;
+		modp_trim(hx);
+		modp_gcd(fr, hx, g, p);
+		if(g.size() > 1) {
+			modp_divrem(fr, g, q, r, p);
+			fr.swap(q);
+			ddf_factors.push_back(g);
+			ddf_degrees.push_back(d);
+		}
+		// h^p = sum(h_i * x^(i*p))
+		v.assign(n, 0);
+		for(size_t i = 0; i < h.size(); i++) {
+			if(h[i] == 0) continue;
+			for(size_t i2 = 0; i2 < frob[i].size(); i2++) v[i2] += (long long int) h[i] * frob[i][i2];
+			if(i % 1024 == 1023) {
+				for(size_t i2 = 0; i2 < v.size(); i2++) v[i2] %= p;
+			}
+		}
+		h.resize(n);
+		for(size_t i = 0; i < n; i++) h[i] = v[i] % p;
+		modp_trim(h);
+	}
+	if(fr.size() > 1) {
+		ddf_factors.push_back(fr);
+		ddf_degrees.push_back(fr.size() - 1);
+	}
+}
+
+// coefficients modulo m in the range [0, m)
+void zpoly_mod(vector<Number> &a, const Number &m) {
+	for(size_t i = 0; i < a.size(); i++) mpz_fdiv_r(ZCOEFF(a, i), ZCOEFF(a, i), mpq_numref(m.internalRational()));
+	zpoly_trim(a);
+}
+void zpoly_add(vector<Number> &a, const vector<Number> &b) {
+	if(a.size() < b.size()) a.resize(b.size(), nr_zero);
+	for(size_t i = 0; i < b.size(); i++) mpz_add(ZCOEFF(a, i), ZCOEFF(a, i), ZCOEFF(b, i));
+	zpoly_trim(a);
+}
+void zpoly_sub(vector<Number> &a, const vector<Number> &b) {
+	if(a.size() < b.size()) a.resize(b.size(), nr_zero);
+	for(size_t i = 0; i < b.size(); i++) mpz_sub(ZCOEFF(a, i), ZCOEFF(a, i), ZCOEFF(b, i));
+	zpoly_trim(a);
+}
+// division by h, with leading coefficient 1, modulo m
+void zpoly_divrem_monic(const vector<Number> &a, const vector<Number> &h, vector<Number> &q, vector<Number> &r, const Number &m) {
+	r = a;
+	q.clear();
+	if(r.size() < h.size()) return;
+	q.resize(r.size() - h.size() + 1, nr_zero);
+	size_t dh = h.size() - 1;
+	for(size_t i = r.size() - 1; i >= dh; i--) {
+		size_t qi = i - dh;
+		mpz_fdiv_r(ZCOEFF(q, qi), ZCOEFF(r, i), mpq_numref(m.internalRational()));
+		if(!q[qi].isZero()) {
+			for(size_t i2 = 0; i2 < dh; i2++) mpz_submul(ZCOEFF(r, qi + i2), ZCOEFF(q, qi), ZCOEFF(h, i2));
+		}
+		if(i == 0) break;
+	}
+	r.resize(dh);
+	zpoly_mod(r, m);
+	zpoly_trim(q);
+}
+// Lifts f = g * h, s * g + t * h = 1 (with monic h) from modulo m to modulo m2 = m^2 (von zur Gathen & Gerhard, Modern Computer Algebra, algorithm 15.10)
+void hensel_step(const Number &m2, const vector<Number> &f, vector<Number> &g, vector<Number> &h, vector<Number> &s, vector<Number> &t) {
+	vector<Number> e, b, q, r, c, d, tmp;
+	zpoly_mul(g, h, tmp);
+	e = f;
+	zpoly_sub(e, tmp);
+	zpoly_mod(e, m2);
+	zpoly_mul(s, e, tmp);
+	zpoly_mod(tmp, m2);
+	zpoly_divrem_monic(tmp, h, q, r, m2);
+	zpoly_mul(q, g, tmp);
+	zpoly_add(g, tmp);
+	zpoly_mul(t, e, tmp);
+	zpoly_add(g, tmp);
+	zpoly_mod(g, m2);
+	zpoly_add(h, r);
+	zpoly_mod(h, m2);
+	zpoly_mul(s, g, b);
+	zpoly_mul(t, h, tmp);
+	zpoly_add(b, tmp);
+	if(b.empty()) b.push_back(nr_zero);
+	mpz_sub_ui(ZCOEFF(b, 0), ZCOEFF(b, 0), 1);
+	zpoly_mod(b, m2);
+	zpoly_mul(s, b, tmp);
+	zpoly_mod(tmp, m2);
+	zpoly_divrem_monic(tmp, h, c, d, m2);
+	zpoly_sub(s, d);
+	zpoly_mod(s, m2);
+	zpoly_mul(t, b, tmp);
+	zpoly_sub(t, tmp);
+	zpoly_mul(c, g, tmp);
+	zpoly_sub(t, tmp);
+	zpoly_mod(t, m2);
+}
+
+// binary factor tree for multifactor Hensel lifting; the leaves are the modular factors (with the leading coefficient of the polynomial included in the leftmost leaf), and internal nodes hold the product of their children and the Bezout coefficients for the children
+struct hensel_node {
+	vector<Number> v, s, t;
+	size_t left, right;
+	bool leaf;
+};
+size_t hensel_build_tree(vector<hensel_node> &nodes, const vector<vector<long int> > &vfp, size_t i_begin, size_t i_end, long int lc_p, long int p, vector<long int> &vp) {
+	size_t index = nodes.size();
+	nodes.push_back(hensel_node());
+	if(i_end - i_begin == 1) {
+		vp = vfp[i_begin];
+		if(i_begin == 0) {
+			for(size_t i = 0; i < vp.size(); i++) vp[i] = ((long long int) vp[i] * lc_p) % p;
+		}
+		nodes[index].leaf = true;
+	} else {
+		vector<long int> vl, vr, s, t;
+		size_t i_mid = (i_begin + i_end) / 2;
+		size_t i_left = hensel_build_tree(nodes, vfp, i_begin, i_mid, lc_p, p, vl);
+		size_t i_right = hensel_build_tree(nodes, vfp, i_mid, i_end, lc_p, p, vr);
+		modp_mul(vl, vr, vp, p);
+		modp_xgcd(vl, vr, s, t, p);
+		nodes[index].leaf = false;
+		nodes[index].left = i_left;
+		nodes[index].right = i_right;
+		for(size_t i = 0; i < s.size(); i++) nodes[index].s.push_back(Number(s[i], 1L, 0L));
+		for(size_t i = 0; i < t.size(); i++) nodes[index].t.push_back(Number(t[i], 1L, 0L));
+	}
+	for(size_t i = 0; i < vp.size(); i++) nodes[index].v.push_back(Number(vp[i], 1L, 0L));
+	return index;
+}
+
+// Factorizes a primitive and square-free polynomial with integer coefficients (lowest degree first) and a positive leading coefficient into irreducible factors with positive leading coefficients. If max_factor_degree > 0, only factors of at most this degree are searched for. Returns false if the polynomial is not square-free or if the calculation was aborted.
+bool factorize_integer_polynomial(const vector<Number> &vnum, vector<vector<Number> > &vfactors, int max_factor_degree) {
+	size_t n = vnum.size() - 1;
+	if(n < 2) {
+		vfactors.push_back(vnum);
+		return true;
+	}
+	const Number &lc = vnum[n];
+
+	// factorize modulo a few primes and use the prime with the fewest factors; degrees not possible modulo all primes are excluded from the recombination
+	vector<bool> allowed_degrees(n + 1, true);
+	vector<vector<long int> > ddf_best;
+	vector<size_t> ddf_degrees_best;
+	long int p_best = 0;
+	size_t n_good = 0, n_bad = 0, n_factors_best = 0;
+	for(size_t i_prime = 1; i_prime < NR_OF_PRIMES && n_good < FACTOR_MODP_GOOD_PRIMES; i_prime++) {
+		if(CALCULATOR->aborted()) return false;
+		long int p = PRIMES[i_prime];
+		long int lc_p = mpz_fdiv_ui(mpq_numref(lc.internalRational()), p);
+		if(lc_p == 0) continue;
+		vector<long int> fp(n + 1), fd, g;
+		for(size_t i = 0; i <= n; i++) fp[i] = mpz_fdiv_ui(ZCOEFF(vnum, i), p);
+		modp_monic(fp, p);
+		for(size_t i = 1; i <= n; i++) fd.push_back(((long long int) fp[i] * (long int) (i % p)) % p);
+		modp_trim(fd);
+		modp_gcd(fp, fd, g, p);
+		if(g.size() != 1) {
+			n_bad++;
+			if(n_good == 0 && n_bad >= FACTOR_MODP_MAX_BAD_PRIMES) return false;
+			continue;
+		}
+		vector<vector<long int> > ddf_factors;
+		vector<size_t> ddf_degrees;
+		modp_distinct_degree_factorize(fp, p, ddf_factors, ddf_degrees);
+		if(CALCULATOR->aborted()) return false;
+		size_t n_factors = 0;
+		vector<bool> degree_sums(n + 1, false);
+		degree_sums[0] = true;
+		for(size_t i = 0; i < ddf_factors.size(); i++) {
+			size_t d = ddf_degrees[i];
+			for(size_t i3 = (ddf_factors[i].size() - 1) / d; i3 > 0; i3--) {
+				n_factors++;
+				for(size_t i2 = n; i2 >= d; i2--) {
+					if(degree_sums[i2 - d]) degree_sums[i2] = true;
+				}
+			}
+		}
+		bool b_reducible = false;
+		for(size_t i = 1; i < n; i++) {
+			if(!degree_sums[i]) allowed_degrees[i] = false;
+			else if(allowed_degrees[i]) b_reducible = true;
+		}
+		if(!b_reducible) {
+			vfactors.push_back(vnum);
+			return true;
+		}
+		if(n_good == 0 || n_factors < n_factors_best) {
+			ddf_best.swap(ddf_factors);
+			ddf_degrees_best.swap(ddf_degrees);
+			n_factors_best = n_factors;
+			p_best = p;
+		}
+		n_good++;
+	}
+	if(n_good == 0) return false;
+	long int p = p_best;
+	vector<vector<long int> > vfp;
+	unsigned long int seed = 1;
+	for(size_t i = 0; i < ddf_best.size(); i++) {
+		modp_equal_degree_factorize(ddf_best[i], ddf_degrees_best[i], p, vfp, seed);
+	}
+	if(CALCULATOR->aborted()) return false;
+	size_t r = vfp.size();
+
+	// bound for the coefficients of a factor multiplied by the leading coefficient (Mignotte): lc * 2^n * ||f||_2; lift until p^k > 2 * bound
+	Number bound;
+	mpz_ptr zbound = mpq_numref(bound.internalRational());
+	for(size_t i = 0; i <= n; i++) mpz_addmul(zbound, ZCOEFF(vnum, i), ZCOEFF(vnum, i));
+	mpz_sqrt(zbound, zbound);
+	mpz_add_ui(zbound, zbound, 1);
+	mpz_mul(zbound, zbound, mpq_numref(lc.internalRational()));
+	mpz_mul_2exp(zbound, zbound, n + 1);
+
+	vector<hensel_node> nodes;
+	vector<long int> vp;
+	hensel_build_tree(nodes, vfp, 0, r, mpz_fdiv_ui(mpq_numref(lc.internalRational()), p), p, vp);
+	Number m(p, 1L, 0L);
+	while(m <= bound) {
+		if(CALCULATOR->aborted()) return false;
+		m.square();
+		nodes[0].v = vnum;
+		zpoly_mod(nodes[0].v, m);
+		for(size_t i = 0; i < nodes.size(); i++) {
+			if(!nodes[i].leaf) hensel_step(m, nodes[i].v, nodes[nodes[i].left].v, nodes[nodes[i].right].v, nodes[i].s, nodes[i].t);
+		}
+	}
+	mpz_srcptr zm = mpq_numref(m.internalRational());
+
+	// lifted monic factors
+	vector<vector<Number> > u;
+	for(size_t i = 0; i < nodes.size(); i++) {
+		if(nodes[i].leaf) u.push_back(nodes[i].v);
+	}
+	Number lc_inv;
+	mpz_invert(mpq_numref(lc_inv.internalRational()), mpq_numref(lc.internalRational()), zm);
+	for(size_t i = 0; i < u[0].size(); i++) mpz_mul(ZCOEFF(u[0], i), ZCOEFF(u[0], i), mpq_numref(lc_inv.internalRational()));
+	zpoly_mod(u[0], m);
+	nodes.clear();
+
+	// recombination: test products of s lifted factors, for increasing s
+	Number m_half(m);
+	m_half.iquo(2);
+	vector<Number> fcur(vnum), g, q, tmp;
+	Number b(lc), c0, bf0;
+	vector<size_t> remaining;
+	for(size_t i = 0; i < r; i++) remaining.push_back(i);
+	vector<size_t> comb;
+	size_t s = 1;
+	size_t n_tests = 0;
+	while(2 * s <= remaining.size()) {
+		bool b_found = false;
+		comb.clear();
+		for(size_t i = 0; i < s; i++) comb.push_back(i);
+		bf0 = b;
+		bf0 *= fcur[0];
+		while(true) {
+			n_tests++;
+			if(n_tests % 1000 == 0 && CALCULATOR->aborted()) return false;
+			size_t deg = 0;
+			for(size_t i = 0; i < s; i++) deg += u[remaining[comb[i]]].size() - 1;
+			if(allowed_degrees[deg] && (max_factor_degree <= 0 || deg <= (size_t) max_factor_degree)) {
+				// the constant term of the candidate must divide lc * f(0)
+				c0 = b;
+				for(size_t i = 0; i < s; i++) {
+					mpz_mul(mpq_numref(c0.internalRational()), mpq_numref(c0.internalRational()), ZCOEFF(u[remaining[comb[i]]], 0));
+					mpz_fdiv_r(mpq_numref(c0.internalRational()), mpq_numref(c0.internalRational()), zm);
+				}
+				if(c0 > m_half) c0 -= m;
+				if(!c0.isZero() && bf0.isIntegerDivisible(c0)) {
+					g.clear();
+					g.push_back(b);
+					for(size_t i = 0; i < s; i++) {
+						zpoly_mul(g, u[remaining[comb[i]]], tmp);
+						zpoly_mod(tmp, m);
+						g.swap(tmp);
+					}
+					Number gcontent;
+					for(size_t i = 0; i < g.size(); i++) {
+						if(g[i] > m_half) g[i] -= m;
+						gcontent.gcd(g[i]);
+					}
+					if(!gcontent.isOne()) {
+						for(size_t i = 0; i < g.size(); i++) mpz_divexact(ZCOEFF(g, i), ZCOEFF(g, i), mpq_numref(gcontent.internalRational()));
+					}
+					if(polynomial_divide_integers(fcur, g, q)) {
+						vfactors.push_back(g);
+						fcur.swap(q);
+						b = fcur.back();
+						for(size_t i = s; i > 0; i--) remaining.erase(remaining.begin() + comb[i - 1]);
+						b_found = true;
+						break;
+					}
+				}
+			}
+			// next combination
+			size_t i = s;
+			while(i > 0 && comb[i - 1] == remaining.size() - s + i - 1) i--;
+			if(i == 0) break;
+			comb[i - 1]++;
+			for(; i < s; i++) comb[i] = comb[i - 1] + 1;
+		}
+		if(!b_found) s++;
+	}
+	vfactors.push_back(fcur);
+	return true;
+}
+
 bool combination_factorize_is_complicated(MathStructure &m) {
 	if(m.isPower()) {
 		return combination_factorize_is_complicated(m[0]) || combination_factorize_is_complicated(m[1]);
@@ -1832,7 +2332,7 @@ bool MathStructure::factorize(const EvaluationOptions &eo_pre, bool unfactorize,
 					MathStructure *xvar = NULL;
 					Number qnr(1, 1);
 					int degree = 1;
-					bool overflow = false;
+					bool overflow = false, coeff_overflow = false;
 					int qcof = 1;
 					if(CHILD(0).isPower() && !CHILD(0)[0].isNumber() && CHILD(0)[0].size() == 0 && CHILD(0)[1].isNumber() && CHILD(0)[1].number().isInteger() && CHILD(0)[1].number().isPositive()) {
 						xvar = &CHILD(0)[0];
@@ -1841,19 +2341,17 @@ bool MathStructure::factorize(const EvaluationOptions &eo_pre, bool unfactorize,
 						if(CHILD(0)[1].isPower()) {
 							if(CHILD(0)[1][0].size() == 0 && !CHILD(0)[1][0].isNumber() && CHILD(0)[1][1].isNumber() && CHILD(0)[1][1].number().isInteger() && CHILD(0)[1][1].number().isPositive()) {
 								xvar = &CHILD(0)[1][0];
-								qcof = CHILD(0)[0].number().intValue(&overflow);
-								if(!overflow) {
-									if(qcof < 0) qcof = -qcof;
-									degree = CHILD(0)[1][1].number().intValue(&overflow);
-								}
+								qcof = CHILD(0)[0].number().intValue(&coeff_overflow);
+								if(!coeff_overflow && qcof < 0) qcof = -qcof;
+								degree = CHILD(0)[1][1].number().intValue(&overflow);
 							}
 						}
 					}
 
 					int pcof = 1;
 					if(!overflow) {
-						pcof = CHILD(SIZE - 1).number().intValue(&overflow);
-						if(pcof < 0) pcof = -pcof;
+						pcof = CHILD(SIZE - 1).number().intValue(&coeff_overflow);
+						if(!coeff_overflow && pcof < 0) pcof = -pcof;
 					}
 
 					if(xvar && !overflow && degree <= 1000 && degree > 2 && qcof != 0 && pcof != 0) {
@@ -1931,7 +2429,7 @@ bool MathStructure::factorize(const EvaluationOptions &eo_pre, bool unfactorize,
 								prevdeg = curdeg;
 							}
 
-							while(b && degree > 2) {
+							while(b && !coeff_overflow && degree > 2) {
 								for(int i = 1; i <= 1000; i++) {
 									if(i > pcof) break;
 									if(pcof % i == 0) ps.push_back(i);
@@ -2165,281 +2663,61 @@ bool MathStructure::factorize(const EvaluationOptions &eo_pre, bool unfactorize,
 							}
 						}
 
-						if(b && b2 && (max_factor_degree < 0 || max_factor_degree >= 2) && degree > 3 && degree < 50) {
-							// Kronecker method
+						// the rational root search above only finds linear factors with coefficients up to 1000 (and only if the coefficients fit in an int)
+						if(b && b2 && (max_factor_degree < 0 || max_factor_degree >= 2) && (degree > 3 || (degree == 3 && (coeff_overflow || pcof > 1000 || qcof > 1000)))) {
+							// Zassenhaus method
 							vector<Number> vnum;
 							vnum.resize(degree + 1, nr_zero);
 							bool overflow = false;
 							for(size_t i = 0; b && i < SIZE; i++) {
-								switch(CHILD(i).type()) {
-									case STRUCT_POWER: {
-										if(CHILD(i)[0] == *xvar && CHILD(i)[1].isInteger()) {
-											int curdeg = CHILD(i)[1].number().intValue(&overflow);
-											if(curdeg < 0 || overflow || curdeg > degree) b = false;
-											else vnum[curdeg] += 1;
-										} else {
-											b = false;
-										}
-										break;
-									}
-									case STRUCT_MULTIPLICATION: {
-										if(CHILD(i).size() == 2 && CHILD(i)[0].isInteger()) {
-											long int icoeff = CHILD(i)[0].number().intValue(&overflow);
-											if(!overflow && CHILD(i)[1].isPower() && CHILD(i)[1][0] == *xvar && CHILD(i)[1][1].isInteger()) {
-												int curdeg = CHILD(i)[1][1].number().intValue(&overflow);
-												if(curdeg < 0 || overflow || curdeg > degree) b = false;
-												else vnum[curdeg] += icoeff;
-											} else if(!overflow && CHILD(i)[1] == *xvar) {
-												vnum[1] += icoeff;
-											} else {
-												b = false;
-											}
-										} else {
-											b = false;
-										}
-										break;
-									}
-									default: {
-										if(CHILD(i).isInteger()) {
-											long int icoeff = CHILD(i).number().intValue(&overflow);
-											if(overflow) b = false;
-											else vnum[0] += icoeff;
-										} else if(CHILD(i) == *xvar) {
-											vnum[1] += 1;
-										} else {
-											b = false;
-										}
+								const MathStructure *mterm = &CHILD(i);
+								if(mterm->isNumber()) {
+									if(mterm->number().isInteger()) vnum[0] += mterm->number();
+									else b = false;
+									continue;
+								}
+								Number ncoeff(1, 1, 0);
+								if(mterm->isMultiplication()) {
+									if(mterm->size() != 2 || !(*mterm)[0].isNumber() || !(*mterm)[0].number().isInteger()) {
+										b = false;
 										break;
 									}
+									ncoeff = (*mterm)[0].number();
+									mterm = &(*mterm)[1];
 								}
-							}
-
-							long int lcoeff = vnum[degree].lintValue();
-							vector<int> vs;
-							if(b && lcoeff != 0) {
-								degree /= 2;
-								if(max_factor_degree > 0 && degree > max_factor_degree) degree = max_factor_degree;
-								for(int i = 0; i <= degree; i++) {
-									if(CALCULATOR->aborted()) return false;
-									MathStructure mcalc(*this);
-									mcalc.calculateReplace(*xvar, Number((i / 2 + i % 2) * (i % 2 == 0 ? -1 : 1), 1), eo);
-									mcalc.calculatesub(eo, eo, false);
-									if(!mcalc.isInteger()) break;
-									bool overflow = false;
-									int v = ::abs(mcalc.number().intValue(&overflow));
-									if(overflow) {
-										if(i > 2) degree = i;
-										else b = false;
-										break;
-									}
-									vs.push_back(v);
+								int curdeg = 1;
+								if(mterm->isPower() && (*mterm)[0] == *xvar && (*mterm)[1].isInteger()) {
+									curdeg = (*mterm)[1].number().intValue(&overflow);
+								} else if(*mterm != *xvar) {
+									b = false;
 								}
+								if(overflow || curdeg < 1 || curdeg > degree) b = false;
+								else vnum[curdeg] += ncoeff;
 							}
-
-							if(b) {
-								vector<int> factors0, factorsl;
-								factors0.push_back(1);
-								for(int i = 2; i < vs[0] / 3 && i < 1000; i++) {
-									if(vs[0] % i == 0) factors0.push_back(i);
-								}
-								if(vs[0] % 3 == 0) factors0.push_back(vs[0] / 3);
-								if(vs[0] % 2 == 0) factors0.push_back(vs[0] / 2);
-								factors0.push_back(vs[0]);
-								for(int i = 2; i < lcoeff / 3 && i < 1000; i++) {
-									if(lcoeff % i == 0) factorsl.push_back(i);
-								}
-								factorsl.push_back(1);
-								if(lcoeff % 3 == 0) factorsl.push_back(lcoeff / 3);
-								if(lcoeff % 2 == 0) factorsl.push_back(lcoeff / 2);
-								factorsl.push_back(lcoeff);
-
-								int64_t cmax = 500000LL / (factors0.size() * factorsl.size());
-								if(term_combination_levels != 0) cmax *= 10;
-								if(degree >= 2 && cmax > 10) {
-									vector<Number> vden;
-									vector<Number> vquo;
-									vden.resize(3, nr_zero);
-									int64_t c0;
-									for(size_t i = 0; i < factors0.size() * 2; i++) {
-										c0 = factors0[i / 2];
-										if(i % 2 == 1) c0 = -c0;
-										int64_t c2;
-										for(size_t i2 = 0; i2 < factorsl.size(); i2++) {
-											c2 = factorsl[i2];
-											int64_t c1max = vs[1] - c0 - c2, c1min;
-											if(c1max < 0) {c1min = c1max; c1max = -vs[1] - c0 - c2;}
-											else {c1min = -vs[1] - c0 - c2;}
-											if(-(vs[2] - c0 - c2) < -(-vs[2] - c0 - c2)) {
-												if(c1max > -(-vs[2] - c0 - c2)) c1max = -(-vs[2] - c0 - c2);
-												if(c1min < -(vs[2] - c0 - c2)) c1min = -(vs[2] - c0 - c2);
-											} else {
-												if(c1max > -(vs[2] - c0 - c2)) c1max = -(vs[2] - c0 - c2);
-												if(c1min < -(-vs[2] - c0 - c2)) c1min = -(-vs[2] - c0 - c2);
-											}
-											if(c1min < -cmax / 2) c1min = -cmax / 2;
-											for(long int c1 = c1min; c1 <= c1max && c1 <= cmax / 2; c1++) {
-												int64_t v1 = ::llabs(c2 + c1 + c0);
-												int64_t v2 = ::llabs(c2 - c1 + c0);
-												if(v1 != 0 && v2 != 0 && v1 <= vs[1] && v2 <= vs[2] && (c1 != 0 || c2 != 0) && vs[1] % v1 == 0 && vs[2] % v2 == 0) {
-													vden[0] = c0; vden[1] = c1; vden[2] = c2;
-													if(CALCULATOR->aborted()) return false;
-													if(polynomial_divide_integers(vnum, vden, vquo)) {
-														MathStructure mtest;
-														mtest.setType(STRUCT_ADDITION);
-														if(c2 != 0) {
-															MathStructure *mpow = new MathStructure();
-															mpow->setType(STRUCT_POWER);
-															mpow->addChild(*xvar);
-															mpow->addChild_nocopy(new MathStructure(2, 1, 0));
-															if(c2 == 1) {
-																mtest.addChild_nocopy(mpow);
-															} else {
-																MathStructure *mterm = new MathStructure();
-																mterm->setType(STRUCT_MULTIPLICATION);
-																mterm->addChild_nocopy(new MathStructure(c2, 1L, 0L));
-																mterm->addChild_nocopy(mpow);
-																mtest.addChild_nocopy(mterm);
-															}
-														}
-														if(c1 == 1) {
-															mtest.addChild(*xvar);
-														} else if(c1 != 0) {
-															MathStructure *mterm = new MathStructure();
-															mterm->setType(STRUCT_MULTIPLICATION);
-															mterm->addChild_nocopy(new MathStructure(c1, 1L, 0L));
-															mterm->addChild(*xvar);
-															mtest.addChild_nocopy(mterm);
-														}
-														mtest.addChild_nocopy(new MathStructure(c0, 1L, 0L));
-														MathStructure mthis(*this);
-														MathStructure mquo;
-														if(mtest.size() > 1 && polynomialDivide(mthis, mtest, mquo, eo, false)) {
-															mquo.factorize(eo, false, 0, 0, only_integers, recursive, endtime_p, force_factorization, complete_square, only_sqrfree, max_factor_degree);
-															set(mquo, true);
-															multiply(mtest, true);
-															return true;
-														}
-													}
-												}
-											}
-										}
-									}
+							if(b && !vnum[degree].isZero() && !vnum[0].isZero()) {
+								Number ncontent;
+								for(size_t i = 0; i < vnum.size(); i++) ncontent.gcd(vnum[i]);
+								if(vnum[degree].isNegative()) ncontent.negate();
+								if(!ncontent.isOne()) {
+									for(size_t i = 0; i < vnum.size(); i++) vnum[i] /= ncontent;
 								}
-								for(int i_d = 3; i_d <= degree; i_d++) {
-									if(CALCULATOR->aborted()) return false;
-									int64_t t1max = ::pow(cmax / (i_d - 1), 1.0 / (i_d - 1));
-									if(t1max < 1) break;
-									if(t1max > 1000) t1max = 1000;
-									int64_t c2totalmax = t1max;
-									int64_t c2cur;
-									for(int i = 0; i < i_d - 3; i++) {
-										c2totalmax *= t1max;
-									}
-									vector<Number> vden;
-									vector<Number> vquo;
-									int64_t *vc = (int64_t*) malloc(sizeof(int64_t) * (i_d + 1));
-									vden.resize(i_d + 1, nr_zero);
-									for(size_t i = 0; i < factors0.size() * 2; i++) {
-										vc[0] = factors0[i / 2] * (i % 2 == 1 ? -1 : 1);
-										for(size_t i2 = 0; i2 < factorsl.size(); i2++) {
-											vc[i_d] = factorsl[i2];
-											for(int64_t c2p = 0; c2p <= c2totalmax; c2p++) {
-												c2cur = c2p;
-												for(int i = 2; i < i_d; i++) {
-													vc[i] = c2cur % t1max;
-													if(vc[i] % 2 == 1) vc[i] = -vc[i];
-													vc[i] = vc[i] / 2 + vc[i] % 2;
-													c2cur /= t1max;
-												}
-												int64_t c1max = t1max / 2 + t1max % 2, c1min = -t1max / 2 - t1max % 2;
-												for(size_t i = 1; i < vs.size(); i++) {
-													int64_t vsmax = vs[i] - vc[0];
-													int64_t vsmin = -vs[i] - vc[0];
-													int ix = (i / 2 + i % 2) * (i % 2 == 0 ? -1 : 1);
-													int ixi = ix;
-													for(int i2 = 2; i2 <= i_d; i2++) {
-														ixi *= ix;
-														vsmax -= vc[i2] * ixi;
-													}
-													vsmax /= ix;
-													vsmin /= ix;
-													if(vsmax < vsmin) {
-														if(c1max > vsmin) c1max = vsmin;
-														if(c1min < vsmax) c1min = vsmax;
-													} else {
-														if(c1max > vsmax) c1max = vsmax;
-														if(c1min < vsmin) c1min = vsmin;
-													}
-												}
-												for(long int c1 = c1min; c1 <= c1max; c1++) {
-													vc[1] = c1;
-													bool b = true;
-													for(size_t i = 1; i < vs.size(); i++) {
-														long int v = vc[0];
-														int ix = (i / 2 + i % 2) * (i % 2 == 0 ? -1 : 1);
-														int ixi = 1;
-														for(int i2 = 1; i2 <= i_d; i2++) {
-															ixi *= ix;
-															v += vc[i2] * ixi;
-														}
-														if(v < 0) v = -v;
-														if(v == 0 || v > vs[i] || vs[i] % v != 0) {
-															b = false;
-															break;
-														}
-													}
-													if(b) {
-														if(CALCULATOR->aborted()) return false;
-														for(size_t iden = 0; iden < vden.size(); iden++) {
-															vden[iden] = vc[iden];
-														}
-														if(polynomial_divide_integers(vnum, vden, vquo)) {
-															MathStructure mtest;
-															mtest.setType(STRUCT_ADDITION);
-															for(int i2 = i_d; i2 >= 2; i2--) {
-																if(vc[i2] != 0) {
-																	MathStructure *mpow = new MathStructure();
-																	mpow->setType(STRUCT_POWER);
-																	mpow->addChild(*xvar);
-																	mpow->addChild_nocopy(new MathStructure(i2, 1, 0));
-																	if(vc[i2] == 1) {
-																		mtest.addChild_nocopy(mpow);
-																	} else {
-																		MathStructure *mterm = new MathStructure();
-																		mterm->setType(STRUCT_MULTIPLICATION);
-																		mterm->addChild_nocopy(new MathStructure(vc[i2], 1L, 0L));
-																		mterm->addChild_nocopy(mpow);
-																		mtest.addChild_nocopy(mterm);
-																	}
-																}
-															}
-															if(vc[1] == 1) {
-																mtest.addChild(*xvar);
-															} else if(vc[1] != 0) {
-																MathStructure *mterm = new MathStructure();
-																mterm->setType(STRUCT_MULTIPLICATION);
-																mterm->addChild_nocopy(new MathStructure(vc[1], 1L, 0L));
-																mterm->addChild(*xvar);
-																mtest.addChild_nocopy(mterm);
-															}
-															mtest.addChild_nocopy(new MathStructure(vc[0], 1L, 0L));
-															MathStructure mthis(*this);
-															MathStructure mquo;
-															if(mtest.size() > 1 && polynomialDivide(mthis, mtest, mquo, eo, false)) {
-																mquo.factorize(eo, false, 0, 0, only_integers, recursive, endtime_p, force_factorization, complete_square, only_sqrfree, max_factor_degree);
-																free(vc);
-																set(mquo, true);
-																multiply(mtest, true);
-																return true;
-															}
-														}
-													}
-												}
-											}
-										}
+								vector<vector<Number> > vfactors;
+								if(factorize_integer_polynomial(vnum, vfactors, max_factor_degree) && vfactors.size() > 1) {
+									MathStructure xvar2(*xvar);
+									clear(true);
+									m_type = STRUCT_MULTIPLICATION;
+									if(!ncontent.isOne()) {
+										APPEND_NEW(ncontent);
+									}
+									for(size_t i = 0; i < vfactors.size(); i++) {
+										MathStructure *mfactor = new MathStructure();
+										dense_polynomial_to_mathstructure(vfactors[i], xvar2, *mfactor);
+										APPEND_POINTER(mfactor);
 									}
-									free(vc);
+									evalSort(true);
+									return true;
 								}
+								if(CALCULATOR->aborted()) return false;
 							}
 						}
 
@@ -19,6 +19,7 @@
 #include "Variable.h"
 #include "Unit.h"
 #include "Prefix.h"
+#include <map>
 
 #if HAVE_UNORDERED_MAP
 #	include <unordered_map>
@@ -295,6 +296,523 @@ bool heur_gcd(const MathStructure &m1, const MathStructure &m2, MathStructure &m
 
 }
 
+// interpolate() for sparse polynomials: gamma = sum(g_i * xi^i), with the coefficients of g_i in the range (-xi/2, xi/2], and minterp = sum(g_i * x^i)
+bool interpolate(const SparsePolynomial &gamma, const Number &xi, size_t var_i, SparsePolynomial &minterp) {
+	SparsePolynomial e(gamma);
+	minterp.setVariableCount(gamma.variableCount());
+	vector<unsigned long int> exps(gamma.variableCount(), 0);
+	mpz_t b2, r;
+	mpz_init(b2);
+	mpz_init(r);
+	mpz_div_ui(b2, mpq_numref(xi.internalRational()), 2);
+	mpz_sub_ui(b2, b2, 1);
+	bool b = true;
+	for(unsigned long int i = 0; !e.isZero(); i++) {
+		unsigned long long xkey, k;
+		exps[var_i] = i;
+		if(CALCULATOR->aborted() || !e.makeKey(exps, xkey)) {b = false; break;}
+		for(size_t slot = 0; slot < e.slotCount(); slot++) {
+			if(!e.hasTerm(slot)) continue;
+			mpz_ptr c = mpq_numref(e.coefficient(slot).internalRational());
+			mpz_add(r, c, b2);
+			mpz_fdiv_r(r, r, mpq_numref(xi.internalRational()));
+			mpz_sub(r, r, b2);
+			if(mpz_sgn(r) != 0) {
+				if(!e.multiplyKeys(e.key(slot), xkey, k)) {b = false; break;}
+				mpz_set(mpq_numref(minterp.term(k).internalRational()), r);
+				mpz_sub(c, c, r);
+			}
+			mpz_divexact(c, c, mpq_numref(xi.internalRational()));
+		}
+		if(!b) break;
+	}
+	mpz_clear(b2);
+	mpz_clear(r);
+	return b;
+}
+
+// heur_gcd() for sparse polynomials with integer coefficients
+bool heur_gcd(const SparsePolynomial &m1, const SparsePolynomial &m2, SparsePolynomial &mgcd, SparsePolynomial *ca, SparsePolynomial *cb, size_t var_i) {
+
+	if(m1.isZero() || m2.isZero()) return false;
+
+	if(m1.isConstant() && m2.isConstant()) {
+		Number n1(m1.constant()), n2(m2.constant()), g(n1);
+		if(!n1.isInteger() || !n2.isInteger() || !g.gcd(n2)) g.set(1, 1, 0);
+		mgcd.setVariableCount(m1.variableCount());
+		mgcd.addTerm(0, g);
+		if(ca) {
+			n1 /= g;
+			ca->setVariableCount(m1.variableCount());
+			ca->addTerm(0, n1);
+		}
+		if(cb) {
+			n2 /= g;
+			cb->setVariableCount(m1.variableCount());
+			cb->addTerm(0, n2);
+		}
+		return true;
+	}
+
+	if(var_i >= m1.variableCount() || !m1.isInteger() || !m2.isInteger()) return false;
+
+	Number nr_gc;
+	m1.integerContent(nr_gc);
+	Number nr_rgc;
+	m2.integerContent(nr_rgc);
+	nr_gc.gcd(nr_rgc);
+	nr_rgc = nr_gc;
+	nr_rgc.recip();
+	SparsePolynomial p(m1);
+	p.multiply(nr_rgc);
+	SparsePolynomial q(m2);
+	q.multiply(nr_rgc);
+	Number maxdeg(p.degree(var_i), 1);
+	Number maxdeg2(q.degree(var_i), 1);
+	if(maxdeg2.isGreaterThan(maxdeg)) maxdeg = maxdeg2;
+	Number mp(p.maxCoefficient());
+	Number mq(q.maxCoefficient());
+	Number xi;
+	if(mp.isGreaterThan(mq)) {
+		xi = mq;
+	} else {
+		xi = mp;
+	}
+	xi *= 2;
+	xi += 2;
+
+	for(int t = 0; t < 6; t++) {
+
+		if(CALCULATOR->aborted()) return false;
+
+		if(!xi.isInteger() || (maxdeg * xi.integerLength()).isGreaterThan(100000L)) {
+			return false;
+		}
+
+		SparsePolynomial cp, cq, gamma, psub, qsub;
+		p.evaluate(var_i, xi, psub);
+		q.evaluate(var_i, xi, qsub);
+
+		if(heur_gcd(psub, qsub, gamma, &cp, &cq, var_i + 1)) {
+
+			if(!interpolate(gamma, xi, var_i, mgcd)) return false;
+
+			Number ig;
+			mgcd.integerContent(ig);
+			ig.recip();
+			mgcd.multiply(ig);
+
+			SparsePolynomial dummy;
+
+			if(p.divide(mgcd, ca ? *ca : dummy, true) && q.divide(mgcd, cb ? *cb : dummy, true)) {
+				mgcd.multiply(nr_gc);
+				return true;
+			}
+		}
+
+		Number xi2(xi);
+		xi2.isqrt();
+		xi2.isqrt();
+		xi *= xi2;
+		xi *= 73794L;
+		xi.iquo(27011L);
+
+	}
+
+	return false;
+
+}
+
+// Modular gcd (Brown's algorithm) for multivariate polynomials with integer coefficients. Images modulo primes below 2^24 (small enough for the delayed reductions in the univariate modp_*() functions; products of residues are calculated using long long int) are calculated by evaluating one variable at a time, with dense interpolation of the gcds of the evaluated polynomials, and combined using the Chinese remainder theorem until the result is stable and divides both polynomials.
+// Polynomials modulo p are stored as a map from packed exponents (using the key layout of the SparsePolynomial) to coefficients.
+
+#define MODULAR_GCD_MAX_DEGREE 10000
+#define MODULAR_GCD_MAX_BAD_PRIMES 20
+
+typedef std::map<unsigned long long, long int> modp_mpoly;
+typedef std::map<unsigned long long, vector<long int> > modp_mpoly_grouped;
+
+long int modp_eval(const vector<long int> &v, long int x, long int p) {
+	long int r = 0;
+	for(size_t i = v.size(); i > 0; i--) r = ((long long int) r * x + v[i - 1]) % p;
+	return r;
+}
+// coefficients as dense polynomials in the variable with index var_i, for each monomial in the other variables
+void modp_mpoly_group(const modp_mpoly &a, size_t var_i, unsigned long long xkey, const SparsePolynomial &layout, modp_mpoly_grouped &groups) {
+	groups.clear();
+	for(modp_mpoly::const_iterator it = a.begin(); it != a.end(); ++it) {
+		unsigned long int e = layout.exponent(it->first, var_i);
+		vector<long int> &v = groups[it->first - e * xkey];
+		if(v.size() <= e) v.resize(e + 1, 0);
+		v[e] = it->second;
+	}
+}
+// gcd of the dense coefficients and division by the gcd
+void modp_mpoly_primpart(modp_mpoly_grouped &groups, vector<long int> &cont, long int p) {
+	vector<long int> tmp, q, r;
+	cont.clear();
+	for(modp_mpoly_grouped::iterator it = groups.begin(); it != groups.end(); ++it) {
+		modp_gcd(cont, it->second, tmp, p);
+		cont.swap(tmp);
+		if(cont.size() == 1) return;
+	}
+	for(modp_mpoly_grouped::iterator it = groups.begin(); it != groups.end(); ++it) {
+		modp_divrem(it->second, cont, q, r, p);
+		it->second.swap(q);
+	}
+}
+// g = groups * c (with c in the variable used for grouping), with leading coefficient (in lexicographical order) one
+void modp_mpoly_ungroup(const modp_mpoly_grouped &groups, const vector<long int> &c, unsigned long long xkey, long int p, modp_mpoly &g) {
+	vector<long int> tmp;
+	g.clear();
+	for(modp_mpoly_grouped::const_iterator it = groups.begin(); it != groups.end(); ++it) {
+		modp_mul(it->second, c, tmp, p);
+		for(size_t i = 0; i < tmp.size(); i++) {
+			if(tmp[i] != 0) g[it->first + i * xkey] = tmp[i];
+		}
+	}
+	if(g.empty()) return;
+	long int inv = modp_inv(g.rbegin()->second, p);
+	for(modp_mpoly::iterator it = g.begin(); it != g.end(); ++it) it->second = ((long long int) it->second * inv) % p;
+}
+// returns true if b divides a (a and b are nonzero)
+bool modp_mpoly_divides(const modp_mpoly &a, const modp_mpoly &b, long int p, const SparsePolynomial &layout) {
+	// the degree of the quotient in each variable is known if the division is exact
+	size_t nvars = layout.variableCount();
+	vector<unsigned long int> dega(nvars, 0), degb(nvars, 0);
+	for(modp_mpoly::const_iterator it = a.begin(); it != a.end(); ++it) {
+		for(size_t i = 0; i < nvars; i++) {
+			if(layout.exponent(it->first, i) > dega[i]) dega[i] = layout.exponent(it->first, i);
+		}
+	}
+	for(modp_mpoly::const_iterator it = b.begin(); it != b.end(); ++it) {
+		for(size_t i = 0; i < nvars; i++) {
+			if(layout.exponent(it->first, i) > degb[i]) degb[i] = layout.exponent(it->first, i);
+		}
+	}
+	for(size_t i = 0; i < nvars; i++) {
+		if(degb[i] > dega[i]) return false;
+		dega[i] -= degb[i];
+	}
+	unsigned long long qbound, qk, k;
+	layout.makeKey(dega, qbound);
+	modp_mpoly r(a);
+	unsigned long long lk = b.rbegin()->first;
+	long int inv = modp_inv(b.rbegin()->second, p);
+	while(!r.empty()) {
+		if(CALCULATOR->aborted()) return false;
+		modp_mpoly::iterator it = r.end();
+		--it;
+		if(!layout.divideKeys(it->first, lk, qk) || !layout.divideKeys(qbound, qk, k)) return false;
+		long int qc = ((long long int) it->second * inv) % p;
+		r.erase(it);
+		modp_mpoly::const_reverse_iterator it_b = b.rbegin();
+		for(++it_b; it_b != b.rend(); ++it_b) {
+			k = qk + it_b->first;
+			long int c = (r[k] - (long long int) qc * it_b->second) % p;
+			if(c == 0) r.erase(k);
+			else r[k] = (c < 0 ? c + p : c);
+		}
+	}
+	return true;
+}
+// gcd of polynomials in the variables with index 0 to var_i, with leading coefficient one
+bool modp_mpoly_gcd(const modp_mpoly &a, const modp_mpoly &b, size_t var_i, long int p, const SparsePolynomial &layout, modp_mpoly &g) {
+	g.clear();
+	if(CALCULATOR->aborted()) return false;
+	vector<unsigned long int> exps(layout.variableCount(), 0);
+	exps[var_i] = 1;
+	unsigned long long xkey;
+	layout.makeKey(exps, xkey);
+	modp_mpoly_grouped ga, gb;
+	modp_mpoly_group(a, var_i, xkey, layout, ga);
+	modp_mpoly_group(b, var_i, xkey, layout, gb);
+	vector<long int> conta, contb, cont;
+	modp_mpoly_primpart(ga, conta, p);
+	modp_mpoly_primpart(gb, contb, p);
+	modp_gcd(conta, contb, cont, p);
+	if(var_i == 0) {
+		// univariate: the primitive parts are constants
+		modp_mpoly_grouped gc;
+		gc[0].push_back(1);
+		modp_mpoly_ungroup(gc, cont, xkey, p, g);
+		return true;
+	}
+	// the leading coefficients, in lexicographical order of the remaining variables, must not vanish at the evaluation points
+	const vector<long int> &lca = ga.rbegin()->second, &lcb = gb.rbegin()->second;
+	vector<long int> gam, tmp, xa(2, 1);
+	modp_gcd(lca, lcb, gam, p);
+	size_t dega = 0, degb = 0;
+	for(modp_mpoly_grouped::const_iterator it = ga.begin(); it != ga.end(); ++it) {
+		if(it->second.size() - 1 > dega) dega = it->second.size() - 1;
+	}
+	for(modp_mpoly_grouped::const_iterator it = gb.begin(); it != gb.end(); ++it) {
+		if(it->second.size() - 1 > degb) degb = it->second.size() - 1;
+	}
+	// degree bound of the interpolated gcd (multiplied by gam)
+	size_t bound = gam.size() - 1 + (dega < degb ? dega : degb);
+	modp_mpoly_grouped gi;
+	vector<long int> m(1, 1);
+	unsigned long long lm = 0;
+	size_t n = 0;
+	modp_mpoly ea, eb, ec;
+	for(long int alpha = 1; alpha < p && (size_t) alpha < bound * 4 + 100; alpha++) {
+		long int gam_a = modp_eval(gam, alpha, p);
+		if(gam_a == 0 || modp_eval(lca, alpha, p) == 0 || modp_eval(lcb, alpha, p) == 0) continue;
+		ea.clear();
+		eb.clear();
+		for(modp_mpoly_grouped::const_iterator it = ga.begin(); it != ga.end(); ++it) {
+			long int c = modp_eval(it->second, alpha, p);
+			if(c != 0) ea[it->first] = c;
+		}
+		for(modp_mpoly_grouped::const_iterator it = gb.begin(); it != gb.end(); ++it) {
+			long int c = modp_eval(it->second, alpha, p);
+			if(c != 0) eb[it->first] = c;
+		}
+		if(!modp_mpoly_gcd(ea, eb, var_i - 1, p, layout, ec)) return false;
+		unsigned long long lm_c = ec.rbegin()->first;
+		if(lm_c == 0) {
+			// coprime primitive parts
+			modp_mpoly_grouped gc;
+			gc[0].push_back(1);
+			modp_mpoly_ungroup(gc, cont, xkey, p, g);
+			return true;
+		}
+		if(n > 0 && lm_c > lm) {
+			// unlucky evaluation point
+			continue;
+		}
+		for(modp_mpoly::iterator it = ec.begin(); it != ec.end(); ++it) it->second = ((long long int) it->second * gam_a) % p;
+		xa[0] = p - alpha;
+		if(n == 0 || lm_c < lm) {
+			// first image or all previous evaluation points were unlucky
+			gi.clear();
+			for(modp_mpoly::iterator it = ec.begin(); it != ec.end(); ++it) gi[it->first].push_back(it->second);
+			m = xa;
+			lm = lm_c;
+			n = 1;
+		} else {
+			// Newton interpolation: gi = gi + (ec - gi(alpha)) * m / m(alpha)
+			long int minv = modp_inv(modp_eval(m, alpha, p), p);
+			bool b_changed = false;
+			for(modp_mpoly::iterator it = ec.begin(); it != ec.end(); ++it) gi[it->first];
+			for(modp_mpoly_grouped::iterator it = gi.begin(); it != gi.end(); ++it) {
+				modp_mpoly::const_iterator it_c = ec.find(it->first);
+				long int d = ((it_c == ec.end() ? 0 : it_c->second) - modp_eval(it->second, alpha, p) + p) % p;
+				d = ((long long int) d * minv) % p;
+				if(d == 0) continue;
+				b_changed = true;
+				if(it->second.size() < m.size()) it->second.resize(m.size(), 0);
+				for(size_t i = 0; i < m.size(); i++) it->second[i] = (it->second[i] + (long long int) d * m[i]) % p;
+			}
+			modp_mul(m, xa, tmp, p);
+			m.swap(tmp);
+			n++;
+			// the degree bound is usually much larger than the actual degree: test the result using trial division if the new image did not change the interpolated gcd
+			if(!b_changed && n <= bound) {
+				modp_mpoly_grouped gtest(gi);
+				vector<long int> contg;
+				for(modp_mpoly_grouped::iterator it = gtest.begin(); it != gtest.end();) {
+					modp_trim(it->second);
+					if(it->second.empty()) gtest.erase(it++);
+					else ++it;
+				}
+				modp_mpoly_primpart(gtest, contg, p);
+				modp_mpoly_ungroup(gtest, cont, xkey, p, g);
+				if(modp_mpoly_divides(a, g, p, layout) && modp_mpoly_divides(b, g, p, layout)) return true;
+				if(CALCULATOR->aborted()) return false;
+			}
+		}
+		if(n > bound) {
+			for(modp_mpoly_grouped::iterator it = gi.begin(); it != gi.end();) {
+				modp_trim(it->second);
+				if(it->second.empty()) gi.erase(it++);
+				else ++it;
+			}
+			vector<long int> contg;
+			modp_mpoly_primpart(gi, contg, p);
+			modp_mpoly_ungroup(gi, cont, xkey, p, g);
+			return true;
+		}
+	}
+	g.clear();
+	return false;
+}
+// c = h (mod m) and c = cp (mod p), with c in the range (-m*p/2, m*p/2], using minv = 1/m (mod p); returns false if c = h
+bool modp_crt(const Number &h, long int cp, const mpz_t m, long int p, long int minv, Number &c) {
+	long int d = ((cp - (long int) mpz_fdiv_ui(mpq_numref(h.internalRational()), p)) % p + p) % p;
+	d = ((long long int) d * minv) % p;
+	c = h;
+	if(d == 0) return false;
+	mpz_ptr cz = mpq_numref(c.internalRational());
+	mpz_addmul_ui(cz, m, d);
+	mpz_t mp, c2;
+	mpz_init(mp);
+	mpz_init(c2);
+	mpz_mul_ui(mp, m, p);
+	mpz_mul_2exp(c2, cz, 1);
+	if(mpz_cmp(c2, mp) > 0) mpz_sub(cz, cz, mp);
+	mpz_clear(mp);
+	mpz_clear(c2);
+	return true;
+}
+// heur_gcd() returns a gcd which is positive when large values are inserted for the variables, with the largest value for the last variable
+// returns true if the coefficient of the leading term in this order (the last variable is most significant) is negative
+bool sparse_polynomial_reverse_leading_negative(const SparsePolynomial &p) {
+	size_t i_lead = p.slotCount();
+	for(size_t i = 0; i < p.slotCount(); i++) {
+		if(!p.hasTerm(i) || p.coefficient(i).isZero()) continue;
+		if(i_lead == p.slotCount()) {
+			i_lead = i;
+			continue;
+		}
+		for(size_t i2 = p.variableCount(); i2 > 0; i2--) {
+			unsigned long int e1 = p.exponent(p.key(i), i2 - 1), e2 = p.exponent(p.key(i_lead), i2 - 1);
+			if(e1 != e2) {
+				if(e1 > e2) i_lead = i;
+				break;
+			}
+		}
+	}
+	return i_lead < p.slotCount() && p.coefficient(i_lead).isNegative();
+}
+bool modular_gcd(const SparsePolynomial &m1, const SparsePolynomial &m2, SparsePolynomial &mgcd, SparsePolynomial *ca, SparsePolynomial *cb) {
+	if(m1.isZero() || m2.isZero() || !m1.isInteger() || !m2.isInteger()) return false;
+	size_t nvars = m1.variableCount();
+	for(size_t i = 0; i < nvars; i++) {
+		if(m1.degree(i) > MODULAR_GCD_MAX_DEGREE || m2.degree(i) > MODULAR_GCD_MAX_DEGREE) return false;
+	}
+	Number c1, c2, cg, nr;
+	m1.integerContent(c1);
+	m2.integerContent(c2);
+	cg = c1;
+	cg.gcd(c2);
+	SparsePolynomial a(m1), b(m2);
+	nr = c1; nr.recip(); a.multiply(nr);
+	nr = c2; nr.recip(); b.multiply(nr);
+	// the leading coefficient of the gcd divides gcd(lc(a), lc(b))
+	Number lca(a.termCoefficient(a.leadingKey())), lcb(b.termCoefficient(b.leadingKey())), gam(lca);
+	gam.gcd(lcb);
+	SparsePolynomial h(nvars), hnew(nvars);
+	unsigned long long lm_h = 0;
+	mpz_t mod, t;
+	mpz_init(mod);
+	mpz_init(t);
+	size_t n_bad = 0;
+	bool b_ret = false;
+	modp_mpoly ap, bp, cp;
+	long int p = (1L << 24) - 1;
+	while(true) {
+		if(CALCULATOR->aborted() || n_bad > MODULAR_GCD_MAX_BAD_PRIMES || p < 1000 || mpz_sizeinbase(mod, 2) > 100000) break;
+		// next prime
+		do {
+			p -= 2;
+			mpz_set_si(t, p);
+		} while(!mpz_probab_prime_p(t, 20));
+		if(mpz_fdiv_ui(mpq_numref(lca.internalRational()), p) == 0 || mpz_fdiv_ui(mpq_numref(lcb.internalRational()), p) == 0) continue;
+		ap.clear();
+		bp.clear();
+		for(size_t i = 0; i < a.slotCount(); i++) {
+			if(!a.hasTerm(i)) continue;
+			long int c = mpz_fdiv_ui(mpq_numref(a.coefficient(i).internalRational()), p);
+			if(c != 0) ap[a.key(i)] = c;
+		}
+		for(size_t i = 0; i < b.slotCount(); i++) {
+			if(!b.hasTerm(i)) continue;
+			long int c = mpz_fdiv_ui(mpq_numref(b.coefficient(i).internalRational()), p);
+			if(c != 0) bp[b.key(i)] = c;
+		}
+		if(!modp_mpoly_gcd(ap, bp, nvars - 1, p, a, cp)) {
+			n_bad++;
+			continue;
+		}
+		unsigned long long lm_c = cp.rbegin()->first;
+		if(lm_c == 0) {
+			// only the integer content is common
+			mgcd.setVariableCount(nvars);
+			mgcd.addTerm(0, cg);
+			if(ca) {
+				*ca = m1;
+				nr = cg; nr.recip(); ca->multiply(nr);
+			}
+			if(cb) {
+				*cb = m2;
+				nr = cg; nr.recip(); cb->multiply(nr);
+			}
+			b_ret = true;
+			break;
+		}
+		if(mpz_sgn(mod) != 0 && lm_c > lm_h) {
+			// unlucky prime
+			n_bad++;
+			continue;
+		}
+		long int gam_p = mpz_fdiv_ui(mpq_numref(gam.internalRational()), p);
+		for(modp_mpoly::iterator it = cp.begin(); it != cp.end(); ++it) it->second = ((long long int) it->second * gam_p) % p;
+		if(mpz_sgn(mod) == 0 || lm_c < lm_h) {
+			// first image or all previous primes were unlucky
+			h.setVariableCount(nvars);
+			for(modp_mpoly::iterator it = cp.begin(); it != cp.end(); ++it) {
+				nr.set(it->second > p / 2 ? it->second - p : it->second, 1, 0);
+				h.addTerm(it->first, nr);
+			}
+			mpz_set_si(mod, p);
+			lm_h = lm_c;
+			continue;
+		}
+		// Chinese remainder theorem
+		hnew.setVariableCount(nvars);
+		bool b_changed = false;
+		long int minv = modp_inv(mpz_fdiv_ui(mod, p), p);
+		for(size_t i = 0; i < h.slotCount(); i++) {
+			if(!h.hasTerm(i)) continue;
+			modp_mpoly::const_iterator it_c = cp.find(h.key(i));
+			if(modp_crt(h.coefficient(i), it_c == cp.end() ? 0 : it_c->second, mod, p, minv, nr)) b_changed = true;
+			hnew.addTerm(h.key(i), nr);
+		}
+		for(modp_mpoly::iterator it = cp.begin(); it != cp.end(); ++it) {
+			if(!h.termCoefficient(it->first).isZero()) continue;
+			modp_crt(nr_zero, it->second, mod, p, minv, nr);
+			hnew.addTerm(it->first, nr);
+			b_changed = true;
+		}
+		mpz_mul_ui(mod, mod, p);
+		h = hnew;
+		if(!b_changed) {
+			// trial division
+			SparsePolynomial hp(h), qa, qb;
+			hp.integerContent(nr);
+			nr.recip();
+			hp.multiply(nr);
+			if(a.divide(hp, qa, true) && b.divide(hp, qb, true)) {
+				// use the same sign as heur_gcd()
+				if(sparse_polynomial_reverse_leading_negative(hp)) {
+					hp.multiply(nr_minus_one);
+					qa.multiply(nr_minus_one);
+					qb.multiply(nr_minus_one);
+				}
+				mgcd = hp;
+				mgcd.multiply(cg);
+				if(ca) {
+					*ca = qa;
+					nr = c1; nr /= cg; ca->multiply(nr);
+				}
+				if(cb) {
+					*cb = qb;
+					nr = c2; nr /= cg; cb->multiply(nr);
+				}
+				b_ret = true;
+				break;
+			}
+			if(CALCULATOR->aborted()) break;
+			n_bad++;
+		}
+	}
+	mpz_clear(mod);
+	mpz_clear(t);
+	return b_ret;
+}
+
 bool MathStructure::lcm(const MathStructure &m1, const MathStructure &m2, MathStructure &mlcm, const EvaluationOptions &eo, bool check_args) {
 	if(m1.isNumber() && m2.isNumber()) {
 		mlcm = m1;
@@ -677,7 +1195,28 @@ factored_2:
 		return true;
 	}
 
-	if(!heur_gcd(m1, m2, mresult, eo, ca, cb, sym_stats, var_i)) {
+	// polynomials in symbols only: use modular gcd, or heur_gcd() as fallback, on sparse distributed polynomials instead of expression trees
+	vector<MathStructure> vars;
+	for(size_t i = 0; i < sym_stats.size(); i++) vars.push_back(sym_stats[i].sym);
+	SparsePolynomial p1, p2;
+	bool b_sparse = p1.set(m1, vars) && p2.set(m2, vars);
+	if(b_sparse) {
+		SparsePolynomial pgcd, pca, pcb;
+		if(modular_gcd(p1, p2, pgcd, ca ? &pca : NULL, cb ? &pcb : NULL) || (!CALCULATOR->aborted() && heur_gcd(p1, p2, pgcd, ca ? &pca : NULL, cb ? &pcb : NULL, var_i))) {
+			pgcd.get(mresult, vars);
+			if(ca) pca.get(*ca, vars);
+			if(cb) pcb.get(*cb, vars);
+			return true;
+		}
+		if(CALCULATOR->aborted()) {
+			if(ca) *ca = m1;
+			if(cb) *cb = m2;
+			mresult.set(1, 1, 0);
+			return false;
+		}
+	}
+
+	if(b_sparse || !heur_gcd(m1, m2, mresult, eo, ca, cb, sym_stats, var_i)) {
 		if(!sr_gcd(m1, m2, mresult, sym_stats, var_i, eo)) {
 			if(ca) *ca = m1;
 			if(cb) *cb = m2;
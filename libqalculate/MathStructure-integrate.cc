@@ -2314,7 +2314,7 @@ int integrate_function(MathStructure &mstruct, const MathStructure &x_var, const
 			CALCULATOR->beginTemporaryStopMessages();
 			if(mtest.integrate(x_var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 				CALCULATOR->endTemporaryStopMessages(true);
-				mstruct.set(mtest, true);
+				mstruct.set_nocopy(mtest, true);
 				return true;
 			}
 			CALCULATOR->endTemporaryStopMessages();
@@ -2531,7 +2531,7 @@ int integrate_function(MathStructure &mstruct, const MathStructure &x_var, const
 			CALCULATOR->beginTemporaryStopMessages();
 			if(mtest.integrate(x_var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 				CALCULATOR->endTemporaryStopMessages(true);
-				mstruct.set(mtest, true);
+				mstruct.set_nocopy(mtest, true);
 				return true;
 			}
 			CALCULATOR->endTemporaryStopMessages();
@@ -2754,7 +2754,7 @@ int integrate_function(MathStructure &mstruct, const MathStructure &x_var, const
 			CALCULATOR->beginTemporaryStopMessages();
 			if(mtest.integrate(x_var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 				CALCULATOR->endTemporaryStopMessages(true);
-				mstruct.set(mtest, true);
+				mstruct.set_nocopy(mtest, true);
 				return true;
 			}
 			CALCULATOR->endTemporaryStopMessages();
@@ -3590,7 +3590,7 @@ int integrate_function(MathStructure &mstruct, const MathStructure &x_var, const
 				CALCULATOR->beginTemporaryStopMessages();
 				if(mtest.integrate(var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 					CALCULATOR->endTemporaryStopMessages(true);
-					mstruct.set(mtest, true);
+					mstruct.set_nocopy(mtest, true);
 					mstruct.replace(var, morig);
 					if(!morig[0].isVariable() || morig[0].variable()->id() != VARIABLE_ID_E) mstruct.divide_nocopy(new MathStructure(CALCULATOR->getFunctionById(FUNCTION_ID_LOG), &morig[0], NULL));
 					if(morig[1].isMultiplication()) {
@@ -3629,7 +3629,7 @@ int integrate_function(MathStructure &mstruct, const MathStructure &x_var, const
 			CALCULATOR->beginTemporaryStopMessages();
 			if(mtest.integrate(var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 				CALCULATOR->endTemporaryStopMessages(true);
-				mstruct.set(mtest, true);
+				mstruct.set_nocopy(mtest, true);
 				mstruct.replace(var, morig);
 				if(!mmul.isOne()) mstruct /= mmul;
 				var->destroy();
@@ -3670,7 +3670,7 @@ int integrate_function(MathStructure &mstruct, const MathStructure &x_var, const
 				CALCULATOR->beginTemporaryStopMessages();
 				if(mtest.integrate(var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 					CALCULATOR->endTemporaryStopMessages(true);
-					mstruct.set(mtest, true);
+					mstruct.set_nocopy(mtest, true);
 					mstruct.replace(var, morig);
 					mstruct.multiply(den);
 					var->destroy();
@@ -3710,7 +3710,7 @@ int integrate_function(MathStructure &mstruct, const MathStructure &x_var, const
 				CALCULATOR->beginTemporaryStopMessages();
 				if(mtest.integrate(var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 					CALCULATOR->endTemporaryStopMessages(true);
-					mstruct.set(mtest, true);
+					mstruct.set_nocopy(mtest, true);
 					mstruct.replace(var, mexp[0]);
 					if(!mmul2.isOne()) {
 		 				mstruct /= mmul2;
@@ -3828,7 +3828,7 @@ int integrate_function(MathStructure &mstruct, const MathStructure &x_var, const
 				CALCULATOR->beginTemporaryStopMessages();
 				if(mtest.integrate(var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 					CALCULATOR->endTemporaryStopMessages(true);
-					mstruct.set(mtest, true);
+					mstruct.set_nocopy(mtest, true);
 					mstruct.replace(var, m_orig);
 					if(!mmul.isOne()) mstruct /= mmul;
 					var->destroy();
@@ -3859,7 +3859,7 @@ int integrate_function(MathStructure &mstruct, const MathStructure &x_var, const
 				CALCULATOR->beginTemporaryStopMessages();
 				if(mtest.integrate(var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 					CALCULATOR->endTemporaryStopMessages(true);
-					mstruct.set(mtest, true);
+					mstruct.set_nocopy(mtest, true);
 					mstruct.replace(var, m_orig);
 					MathStructure m_ln(CALCULATOR->getFunctionById(FUNCTION_ID_LOG), &m_orig[0], NULL);
 					mstruct /= m_ln;
@@ -3988,7 +3988,7 @@ bool fix_sgn_x(MathStructure &mstruct, const MathStructure &x_var, const Evaluat
 		mtest.eval(eo);
 		var->destroy();
 		if(!CALCULATOR->endTemporaryStopMessages() && !mtest.isFunction()) {
-			mstruct.set(mtest);
+			mstruct.set_nocopy(mtest);
 			return true;
 		}
 	}
@@ -4234,7 +4234,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 		for(size_t i = 0; i < SIZE; i++) {
 			int bint = CHILD(i).integrate(x_var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts);
 			if(bint < 0) {
-				set(mbak);
+				set_nocopy(mbak);
 				CANNOT_INTEGRATE_INTERVAL
 			}
 			if(bint > 0) b = true;
@@ -4429,7 +4429,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 			}
 			int b_int = integrate(x_var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts);
 			if(b_int <= 0) {
-				set(mbak);
+				set_nocopy(mbak);
 				if(b_int < 0) CANNOT_INTEGRATE_INTERVAL
 				CANNOT_INTEGRATE
 			}
@@ -4662,7 +4662,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 							if(!mmul2.isOne()) multiply(mmulsqrt2);
 							add(x_var);
 							if(!mmul2.isOne()) LAST.multiply(mmul2);
-							if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+							if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 							if(!mmul2.isOne()) divide(mmulsqrt2);
 							return true;
 						} else if(num == -3) {
@@ -4730,7 +4730,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 							multiply(m2axpb);
 							LAST += mb2m4ac;
 							LAST ^= nr_minus_one;
-							if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+							if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 							divide(mb2m4ac);
 							return true;
 						}
@@ -4803,7 +4803,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 							CALCULATOR->beginTemporaryStopMessages();
 							if(mtest.integrate(x_var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 								CALCULATOR->endTemporaryStopMessages(true);
-								set(mtest, true);
+								set_nocopy(mtest, true);
 								return true;
 							}
 							CALCULATOR->endTemporaryStopMessages();
@@ -4841,7 +4841,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 						CALCULATOR->beginTemporaryStopMessages();
 						if(mtest.integrate(var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 							CALCULATOR->endTemporaryStopMessages(true);
-							set(mtest, true);
+							set_nocopy(mtest, true);
 							replace(var, morig);
 							multiply(den);
 							var->destroy();
@@ -4878,7 +4878,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 							CALCULATOR->beginTemporaryStopMessages();
 							if(mtest.integrate(var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 								CALCULATOR->endTemporaryStopMessages(true);
-								set(mtest, true);
+								set_nocopy(mtest, true);
 								replace(var, mbase);
 								if(!mmul.isOne()) divide(mmul);
 								var->destroy();
@@ -4963,7 +4963,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 						CALCULATOR->beginTemporaryStopMessages();
 						if(mtest.integrate(x_var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0) {
 							CALCULATOR->endTemporaryStopMessages(true);
-							set(mtest, true);
+							set_nocopy(mtest, true);
 							if(!mmul.isOne()) multiply(mmul);
 							return true;
 						}
@@ -5062,7 +5062,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 							CALCULATOR->beginTemporaryStopMessages();
 							if(mtest.integrate(var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 								CALCULATOR->endTemporaryStopMessages(true);
-								set(mtest, true);
+								set_nocopy(mtest, true);
 								replace(var, morig);
 								multiply(den);
 								var->destroy();
@@ -5156,7 +5156,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 									MathStructure mterm(x_var);
 									if(!mmul.isOne()) mterm /= mmul;
 									if(!madd.isZero()) {
-										if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+										if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 										multiply(madd);
 										if(!mmul.isOne()) {
 											MathStructure a2(mmul);
@@ -5170,7 +5170,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 									}
 								} else if(mexp.number() == -2) {
 									MathStructure mterm(*this);
-									if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+									if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 									MathStructure a2(mmul);
 									if(!mmul.isOne()) {
 										a2 ^= nr_two;
@@ -5247,7 +5247,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 										mterm /= nr_two;
 									}
 									if(!madd.isZero()) {
-										if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+										if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 										MathStructure b2(madd);
 										b2 ^= nr_two;
 										multiply(b2);
@@ -5265,7 +5265,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 									if(!mmul.isOne()) mterm1 *= mmul;
 									if(!madd.isZero()) {
 										MathStructure mterm2(*this);
-										if(!transform_absln(mterm2, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+										if(!transform_absln(mterm2, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 										mterm2 *= madd;
 										mterm2 *= -2;
 										MathStructure mterm3(*this);
@@ -5297,11 +5297,11 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 										madd ^= nr_two;
 										mterm3 *= madd;
 										mterm3.negate();
-										if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+										if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 										add(mterm2);
 										add(mterm3);
 									} else {
-										if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+										if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 									}
 									if(!mmul.isOne()) {
 										MathStructure a3(mmul);
@@ -5347,7 +5347,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 									SET_CHILD_MAP(1)
 									SET_CHILD_MAP(0)
 									divide(x_var);
-									if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+									if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 									divide(madd);
 									negate();
 									return true;
@@ -5399,7 +5399,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 									SET_CHILD_MAP(1)
 									SET_CHILD_MAP(0)
 									divide(x_var);
-									if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+									if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 									MathStructure madd2(madd);
 									madd2 ^= nr_two;
 									divide(madd2);
@@ -5418,7 +5418,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 									mterm2 *= *this;
 									mterm2.inverse();
 									divide(x_var);
-									if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+									if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 									MathStructure madd3(madd);
 									madd3 ^= nr_three;
 									divide(madd3);
@@ -5457,7 +5457,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 										}
 										mterm2 += x_var;
 										if(!mmul2.isOne()) mterm2.last() *= mmul2;
-										if(!transform_absln(mterm2, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+										if(!transform_absln(mterm2, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 										mterm2.multiply(madd);
 										mterm2.last() ^= nr_two;
 										multiply(x_var);
@@ -5490,7 +5490,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 										transformById(FUNCTION_ID_LOG);
 										negate();
 										add(x_var);
-										if(!transform_absln(LAST, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+										if(!transform_absln(LAST, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 										multiply(madd);
 										LAST ^= nr_minus_half;
 										return true;
@@ -5505,7 +5505,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 										mterm2 *= madd;
 										mterm2.last() ^= nr_half;
 										MathStructure mterm3(x_var);
-										if(!transform_absln(mterm3, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+										if(!transform_absln(mterm3, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 										mterm3 *= madd;
 										mterm3.last() ^= nr_half;
 										subtract(mterm2);
@@ -5541,7 +5541,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 							multiply(mmul);
 							divide(mmul2);
 							multiply(Number(-1, 2));
-							if(!transform_absln(mterm2, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+							if(!transform_absln(mterm2, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 							mterm2 /= mmul2;
 							mterm2 *= nr_half;
 							add(mterm2);
@@ -5557,7 +5557,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 							mterm2.inverse();
 							mterm2 *= x_var;
 							mterm2.last() ^= nr_two;
-							if(!transform_absln(mterm2, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+							if(!transform_absln(mterm2, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 							mterm2 /= madd;
 							mterm2 *= nr_half;
 							add(mterm2);
@@ -5598,7 +5598,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 							mnp1.number().negate();
 							mnp1.number().recip();
 							MathStructure mthis(*this);
-							if(integrate(x_var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts) < 0) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+							if(integrate(x_var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts) < 0) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 							MathStructure m4acmb2(madd);
 							m4acmb2 *= mmul2;
 							m4acmb2 *= Number(4, 1);
@@ -5640,15 +5640,15 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 												raise(mpow);
 												if(!madd.isOne()) multiply(madd);
 												add(mmul);
-												if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+												if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 												divide(mpow);
 												if(!madd.isOne()) divide(madd);
 											} else {
 												SET_CHILD_MAP(1)
 												SET_CHILD_MAP(0)
-												if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+												if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 												add(x_var);
-												if(!transform_absln(LAST, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+												if(!transform_absln(LAST, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 												LAST *= mpow;
 												LAST.negate();
 												negate();
@@ -5668,11 +5668,11 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 													raise(mpow);
 													if(!madd.isOne()) multiply(madd);
 													add(mmul);
-													if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+													if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 													divide(mpow);
 													divide(madd);
 													add(x_var);
-													if(!transform_absln(LAST, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+													if(!transform_absln(LAST, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 													LAST.negate();
 													divide(mpow);
 													divide(madd);
@@ -5680,7 +5680,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 												} else {
 													SET_CHILD_MAP(1)
 													SET_CHILD_MAP(0)
-													if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set(mbak); CANNOT_INTEGRATE_INTERVAL}
+													if(!transform_absln(*this, use_abs, definite_integral, x_var, eo)) {set_nocopy(mbak); CANNOT_INTEGRATE_INTERVAL}
 													divide(mpow);
 													if(!mmul.isOne()) divide(mmul);
 												}
@@ -5760,7 +5760,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 												if(mtest.integrate(var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0) {
 													CALCULATOR->endTemporaryStopMessages(true);
 													mtest.replace(var, m_replace);
-													set(mtest, true);
+													set_nocopy(mtest, true);
 													divide(m_replace[1]);
 													var->destroy();
 													return true;
@@ -5797,7 +5797,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 									CALCULATOR->beginTemporaryStopMessages();
 									if(mtest.integrate(var, eo, true, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 										CALCULATOR->endTemporaryStopMessages(true);
-										set(mtest, true);
+										set_nocopy(mtest, true);
 										replace(var, mbase);
 										if(!mmul.isOne()) {
 											nexp++;
@@ -5925,7 +5925,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 								CALCULATOR->beginTemporaryStopMessages();
 								if(mtest.integrate(var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 									CALCULATOR->endTemporaryStopMessages(true);
-									set(mtest, true);
+									set_nocopy(mtest, true);
 									replace(var, morig);
 									if(!morig[0].isVariable() || morig[0].variable()->id() != VARIABLE_ID_E) divide_nocopy(new MathStructure(CALCULATOR->getFunctionById(FUNCTION_ID_LOG), &morig[0], NULL));
 									if(morig[1].isMultiplication()) {
@@ -5990,7 +5990,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 								CALCULATOR->beginTemporaryStopMessages();
 								if(mtest.integrate(x_var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0) {
 									CALCULATOR->endTemporaryStopMessages(true);
-									set(mtest, true);
+									set_nocopy(mtest, true);
 									return true;
 								}
 								CALCULATOR->endTemporaryStopMessages();
@@ -6093,7 +6093,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 							CALCULATOR->beginTemporaryStopMessages();
 							if(mtest.integrate(x_var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0) {
 								CALCULATOR->endTemporaryStopMessages(true);
-								set(mtest);
+								set_nocopy(mtest);
 								if(!mmul.isOne()) multiply(mmul);
 								return true;
 							}
@@ -6468,7 +6468,7 @@ int MathStructure::integrate(const MathStructure &x_var, const EvaluationOptions
 								if(mtest.integrate(var, eo, false, use_abs, definite_integral, true, max_part_depth, parent_parts) > 0 && mtest.containsFunctionId(FUNCTION_ID_INTEGRATE) <= 0) {
 									CALCULATOR->endTemporaryStopMessages(true);
 									mtest.replace(var, m_replace);
-									set(mtest, true);
+									set_nocopy(mtest, true);
 									if(m_replace.isPower()) divide(m_replace[1]);
 									var->destroy();
 									return true;
@@ -7474,7 +7474,7 @@ bool MathStructure::integrate(const MathStructure &lower_limit, const MathStruct
 				CALCULATOR->endTemporaryStopMessages();
 				CALCULATOR->endTemporaryStopMessages();
 				CALCULATOR->error(false, _("Unable to integrate the expression."), NULL);
-				if(simplify_first) set(mbak);
+				if(simplify_first) set_nocopy(mbak);
 				return false;
 			}
 			if(mstruct[i].isNumber()) {
@@ -7659,10 +7659,10 @@ bool MathStructure::integrate(const MathStructure &lower_limit, const MathStruct
 						mbak.replace(x_var, x_var_pre, false, false, true);
 						CALCULATOR->endTemporaryStopMessages(true);
 						if(mbak.integrate(lower_limit, upper_limit, x_var_pre, eo, false, true)) {
-							set(mbak);
+							set_nocopy(mbak);
 							return true;
 						}
-						if(simplify_first) set(mbak);
+						if(simplify_first) set_nocopy(mbak);
 						return false;
 					}
 				} else if(COMPARISON_IS_EQUAL_OR_GREATER(cr1)) {
@@ -7670,10 +7670,10 @@ bool MathStructure::integrate(const MathStructure &lower_limit, const MathStruct
 						mbak.replace(x_var, x_var_pre, false, false, true);
 						CALCULATOR->endTemporaryStopMessages(true);
 						if(mbak.integrate(lower_limit, upper_limit, x_var_pre, eo, false, true)) {
-							set(mbak);
+							set_nocopy(mbak);
 							return true;
 						}
-						if(simplify_first) set(mbak);
+						if(simplify_first) set_nocopy(mbak);
 						return false;
 					}
 				}
@@ -7693,10 +7693,10 @@ bool MathStructure::integrate(const MathStructure &lower_limit, const MathStruct
 							mbak.replace(x_var, x_var_pre, false, false, true);
 							CALCULATOR->endTemporaryStopMessages(true);
 							if(mbak.integrate(lower_limit, upper_limit, x_var_pre, eo, false, true)) {
-								set(mbak);
+								set_nocopy(mbak);
 								return true;
 							}
-							if(simplify_first) set(mbak);
+							if(simplify_first) set_nocopy(mbak);
 							return false;
 						}
 					} else if(COMPARISON_IS_EQUAL_OR_GREATER(cr)) {
@@ -7704,10 +7704,10 @@ bool MathStructure::integrate(const MathStructure &lower_limit, const MathStruct
 							mbak.replace(x_var, x_var_pre, false, false, true);
 							CALCULATOR->endTemporaryStopMessages(true);
 							if(mbak.integrate(lower_limit, upper_limit, x_var_pre, eo, false, true)) {
-								set(mbak);
+								set_nocopy(mbak);
 								return true;
 							}
-							if(simplify_first) set(mbak);
+							if(simplify_first) set_nocopy(mbak);
 							return false;
 						}
 					}
@@ -1741,7 +1741,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 							calculateReplace(u_var, mv, eo2);
 							var->destroy();
 							if(b && contains(mbak, true, false, false, true)) {
-								set(mbak);
+								set_nocopy(mbak);
 								return false;
 							}
 							if(b) isolate_x(eo, eo2, x_var, false, depth + 1);
@@ -1871,7 +1871,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 							if(mtest.isolate_x_sub(eo, eo2, x_var, morig, depth + 1)) {
 								mtest.calculatesub(eo, eo2, true);
 								if(mtest.isComparison() && mtest[0] == x_var) {
-									set(mtest);
+									set_nocopy(mtest);
 									return true;
 								}
 							}
@@ -2231,7 +2231,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 								mtest.calculateFunctions(eo);
 								mtest.calculatesub(eo2, eo, true);
 							}
-							set(mtest);
+							set_nocopy(mtest);
 							return true;
 						}
 					}
@@ -2565,7 +2565,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 								}
 							} else {
 								CALCULATOR->endTemporaryStopMessages(true);
-								set(mtest);
+								set_nocopy(mtest);
 								return true;
 							}
 						}
@@ -2609,7 +2609,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 					return true;
 				}
 				CALCULATOR->endTemporaryStopIntervalArithmetic();
-				set(mbak);
+				set_nocopy(mbak);
 			} else if(!mdiv.isUndefined()) {
 				if(mdiv[1].isMinusOne()) {
 					mdiv_inv = mdiv[0];
@@ -2810,7 +2810,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 				if(!nr_root.isZero()) {
 					MathStructure mbak(*this);
 					for(size_t i = 0; i < CHILD(0).size(); i++) {
-						if(CALCULATOR->aborted()) {set(mbak); return false;}
+						if(CALCULATOR->aborted()) {set_nocopy(mbak); return false;}
 						if(CHILD(0)[i] == mbase) {
 							CHILD(0)[i] = var;
 							CHILD(0)[i].raise(nr_root);
@@ -2874,7 +2874,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 					calculateReplace(u_var, mvar, eo2);
 					var->destroy();
 					if(b && contains(mbak, true, false, false, true)) {
-						set(mbak);
+						set_nocopy(mbak);
 						return false;
 					}
 					if(b) isolate_x(eo, eo2, x_var, false, depth + 1);
@@ -2889,7 +2889,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 					calculateReplace(u_var, mvar, eo2);
 					var->destroy();
 					if(b && contains(mbak, true, false, false, true)) {
-						set(mbak);
+						set_nocopy(mbak);
 						return false;
 					}
 					if(b) isolate_x(eo, eo2, x_var, false, depth + 1);
@@ -3076,7 +3076,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 						mdelta.add_nocopy(mdelta_e, true);
 						mdelta.calculatesub(eo3, eo);
 
-						if(CALCULATOR->aborted()) {CALCULATOR->endTemporaryStopMessages(); if(stop_iv) CALCULATOR->endTemporaryStopIntervalArithmetic(); set(mbak); return false;}
+						if(CALCULATOR->aborted()) {CALCULATOR->endTemporaryStopMessages(); if(stop_iv) CALCULATOR->endTemporaryStopIntervalArithmetic(); set_nocopy(mbak); return false;}
 
 						int b_zero = -1;
 						int b_real = -1;
@@ -3107,7 +3107,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 						MathStructure mdelta0;
 						int b0_zero = -1;
 
-						if(CALCULATOR->aborted()) {CALCULATOR->endTemporaryStopMessages(); if(stop_iv) CALCULATOR->endTemporaryStopIntervalArithmetic(); set(mbak); return false;}
+						if(CALCULATOR->aborted()) {CALCULATOR->endTemporaryStopMessages(); if(stop_iv) CALCULATOR->endTemporaryStopIntervalArithmetic(); set_nocopy(mbak); return false;}
 
 						if(b_zero >= 0) {
 							// b^2 - 3ac
@@ -3130,7 +3130,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 							}
 						}
 
-						if(CALCULATOR->aborted()) {CALCULATOR->endTemporaryStopMessages(); if(stop_iv) CALCULATOR->endTemporaryStopIntervalArithmetic(); set(mbak); return false;}
+						if(CALCULATOR->aborted()) {CALCULATOR->endTemporaryStopMessages(); if(stop_iv) CALCULATOR->endTemporaryStopIntervalArithmetic(); set_nocopy(mbak); return false;}
 
 						if(b_zero == 1) {
 							if(b0_zero == 1) {
@@ -3312,7 +3312,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 							if(b_neg) md1_2->calculateNegate(eo3);
 							md1_2->calculatesub(eo3, eo, true);
 
-							if(CALCULATOR->aborted()) {CALCULATOR->endTemporaryStopMessages(); if(stop_iv) CALCULATOR->endTemporaryStopIntervalArithmetic(); set(mbak); return false;}
+							if(CALCULATOR->aborted()) {CALCULATOR->endTemporaryStopMessages(); if(stop_iv) CALCULATOR->endTemporaryStopIntervalArithmetic(); set_nocopy(mbak); return false;}
 
 							mC = mdelta1;
 							mC.add_nocopy(md1_2);
@@ -3630,7 +3630,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 					calculatesub(eo2, eo, false);
 					if((isLogicalAnd() || isLogicalOr() || isComparison()) && test_comparisons(mbak, *this, x_var, eo, false, eo2.expand ? 1 : 2) < 0) {
 						CALCULATOR->endTemporaryStopMessages();
-						set(mbak);
+						set_nocopy(mbak);
 					} else {
 						CALCULATOR->endTemporaryStopMessages(true);
 						return true;
@@ -4000,7 +4000,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 					collect_nonzero_checks(*this, mcheckpowers);
 					for(size_t i = 0; i < SIZE;) {
 						if(CALCULATOR->aborted()) {
-							set(mbak);
+							set_nocopy(mbak);
 							if(mcheckpowers) mcheckpowers->unref();
 							return false;
 						}
@@ -4232,7 +4232,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 			ComparisonType ct_orig = ct_comp;
 			for(size_t i = 0; i < CHILD(0).size(); i++) {
 				if(CALCULATOR->aborted()) {
-					set(mbak);
+					set_nocopy(mbak);
 					if(mcheckmulti) mcheckmulti->unref();
 					if(mtryzero) mcheckmulti->unref();
 					if(mchecknegative) mcheckmulti->unref();
@@ -4351,7 +4351,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 			if(!b && (ct_comp == COMPARISON_EQUALS || ct_comp == COMPARISON_NOT_EQUALS) && CHILD(0).size() >= 2) {
 				// (x+a)*b^(c*x)=d => x=(lambertw(b^(a*c)*c*d*ln(b))-a*c*ln(b)))/(c*ln(b))
 				if(CALCULATOR->aborted()) {
-					set(mbak);
+					set_nocopy(mbak);
 					if(mcheckmulti) mcheckmulti->unref();
 					if(mtryzero) mcheckmulti->unref();
 					if(mchecknegative) mcheckmulti->unref();
@@ -4783,7 +4783,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 									return true;
 								}
 							} else {
-								set(mtest);
+								set_nocopy(mtest);
 								return true;
 							}
 						}
@@ -5325,7 +5325,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 									return true;
 								}
 							} else {
-								set(mtest);
+								set_nocopy(mtest);
 								var->destroy();
 								return true;
 							}
@@ -5537,18 +5537,18 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 							Number nr_i;
 							while(nr_i.isLessThan(mdeg.number())) {
 								MathStructure mroot;
-								if(CALCULATOR->aborted()) {set(mbak); return false;}
+								if(CALCULATOR->aborted()) {set_nocopy(mbak); return false;}
 								MathStructure mexp;
 								Number nexp;
 								if(!nr_i.isZero()) {
 									nexp.set(2, 1, 0);
-									if(!nexp.multiply(nr_i)) {set(mbak); return false;}
+									if(!nexp.multiply(nr_i)) {set_nocopy(mbak); return false;}
 								}
 								b_set = false;
 								if(!marg_pi.isZero()) {
 									if(nexp.isZero()) nexp = marg_pi;
-									else if(!nexp.add(marg_pi)) {set(mbak); return false;}
-									if(!nexp.divide(mdeg.number())) {set(mbak); return false;}
+									else if(!nexp.add(marg_pi)) {set_nocopy(mbak); return false;}
+									if(!nexp.divide(mdeg.number())) {set_nocopy(mbak); return false;}
 									if(nexp.isInteger()) {
 										mroot.set(mmul);
 										if(nexp.isOdd()) {
@@ -5556,7 +5556,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 										}
 										b_set = true;
 									} else if(nexp.isRational() && nexp.denominatorIsTwo()) {
-										if(!nexp.floor()) {set(mbak); return false;}
+										if(!nexp.floor()) {set_nocopy(mbak); return false;}
 										mroot.set(mmul);
 										if(nexp.isEven()) {
 											mroot.calculateMultiply(nr_one_i, eo2);
@@ -6106,7 +6106,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 					isolate_x_sub(eo, eo2, x_var, morig, depth + 1);
 					if(!isZero() && test_comparisons(mbak, *this, x_var, eo) < 0) {
 						CALCULATOR->endTemporaryStopMessages();
-						set(mbak);
+						set_nocopy(mbak);
 						return false;
 					}
 					CALCULATOR->endTemporaryStopMessages(true);
@@ -6237,7 +6237,7 @@ bool MathStructure::isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions
 						mtest.isolate_x_sub(eo, eo2, x_var, morig, depth + 1);
 					}
 					if(!b_test || (!mtest.isLogicalAnd() && !mtest.isLogicalOr() && !mtest.isComparison()) || test_comparisons(*this, mtest, x_var, eo, false, eo2.expand ? 1 : 2) >= 0) {
-						set(mtest);
+						set_nocopy(mtest);
 						return true;
 					}
 				}
@@ -7256,7 +7256,7 @@ bool MathStructure::isolate_x(const EvaluationOptions &eo, const EvaluationOptio
 				if(CALCULATOR->aborted()) return !check_result && b;
 				if(mtest.isComparison() && mtest.isolate_x_sub(feo, eo2, x_var, NULL, depth + 1) && !contains_unsolved_equals(mtest, x_var)) {
 					b = true;
-					set(mtest);
+					set_nocopy(mtest);
 				}
 			}
 		}
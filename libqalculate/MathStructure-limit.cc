@@ -1217,7 +1217,7 @@ bool MathStructure::calculateLimit(const MathStructure &x_var, const MathStructu
 		}
 		if(!b || CALCULATOR->aborted() || (containsInfinity(true) && !isInfinite(true)) || limit_contains_undefined(*this) || containsFunctionId(FUNCTION_ID_FLOOR) || containsFunctionId(FUNCTION_ID_CEIL) || containsFunctionId(FUNCTION_ID_TRUNC)) {
 			if(retry) CALCULATOR->endTemporaryStopMessages();
-			set(mbak);
+			set_nocopy(mbak);
 			replace(var, munit.isZero() ? x_var : munit);
 			var->destroy();
 			return false;
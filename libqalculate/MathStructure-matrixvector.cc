@@ -22,6 +22,7 @@
 
 #include <map>
 #include <algorithm>
+#include <math.h>
 
 #include "MathStructure-support.h"
 
@@ -49,7 +50,7 @@ MathStructure &MathStructure::flattenVector(MathStructure &mstruct) const {
 	}
 	return mstruct;
 }
-bool sort_vector_comparison_failed = false;
+thread_local bool sort_vector_comparison_failed = false;
 bool m_nr_cmp_ar(const MathStructure *m1, const MathStructure *m2) {
 	if(sort_vector_comparison_failed || CALCULATOR->aborted()) return false;
 	ComparisonResult cmp = m1->compare(*m2);
@@ -172,9 +173,6 @@ bool MathStructure::sortVector(bool ascending) {
 		}
 	}
 	v_subs = v_subs_new;
-	for(size_t i = 0; i < v_order.size(); i++) {
-		v_order[i] = i;
-	}
 	return true;
 }
 void MathStructure::flipVector() {
@@ -1045,14 +1043,25 @@ void generate_plotvector(const MathStructure &m, MathStructure x_mstruct, const
 	MathStructure mthis(m);
 	mthis.unformat();
 	calculate_userfunctions(mthis, x_mstruct, eo, true);
+	CompiledExpression mcomp(mthis, x_mstruct, eo, true);
+	// calculate all data points at once using double precision floating point, if possible
+	vector<double> x_grid, y_grid;
+	if(mcomp.isCompiled() && y_vector.size() > 0 && min.isNumber() && step.isNumber() && min.number().isReal() && step.number().isReal()) {
+		x_grid.resize(y_vector.size() + 1);
+		Number nr_x(min.number());
+		for(size_t i = 0; i < x_grid.size(); i++) {
+			x_grid[i] = nr_x.floatValue();
+			nr_x.add(step.number());
+		}
+		if(!mcomp.calculateDoubles(x_grid, y_grid)) y_grid.clear();
+	}
 	ComparisonResult cr = max.compare(x_value);
 	size_t i = 0;
 	while(COMPARISON_IS_EQUAL_OR_LESS(cr)) {
 		if(i >= x_vector.size()) x_vector.addChild(x_value);
 		else x_vector[i] = x_value;
-		y_value = mthis;
-		y_value.replace(x_mstruct, x_value);
-		y_value.eval(eo);
+		if(i < y_grid.size() && !isnan(y_grid[i])) y_value.set(y_grid[i]);
+		else mcomp.calculate(x_value, y_value);
 		if(!eo2.allow_complex && y_value.isNumber() && y_value.number().hasImaginaryPart()) {
 			if(testComplexZero(&y_value.number(), y_value.number().internalImaginary())) y_value.number().clearImaginary();
 			else y_value.setUndefined();
@@ -1103,14 +1112,28 @@ void generate_plotvector(const MathStructure &m, MathStructure x_mstruct, const
 	MathStructure mthis(m);
 	mthis.unformat();
 	calculate_userfunctions(mthis, x_mstruct, eo, true);
+	CompiledExpression mcomp(mthis, x_mstruct, eo, true);
+	// calculate all evenly spaced data points at once using double precision floating point, if possible
+	vector<double> x_grid, y_grid;
+	if(mcomp.isCompiled() && min.isNumber() && max.isNumber() && min.number().isReal() && max.number().isReal()) {
+		x_grid.resize(steps);
+		Number nr_x(min.number());
+		for(int i = 0; i < steps; i++) {
+			x_grid[i] = nr_x.floatValue();
+			if(i + 2 == steps) nr_x = max.number();
+			else nr_x.add(step.number());
+		}
+		if(!mcomp.calculateDoubles(x_grid, y_grid)) y_grid.clear();
+	}
+	size_t i_grid = 0;
 	MathStructure meval;
 	MathStructure mdiff;
 	int prev_illegal = -1;
 	int prev_diff_sgn = 0;
 	for(int i = 0; i < steps; i++) {
-		y_value = mthis;
-		y_value.replace(x_mstruct, x_value);
-		y_value.eval(eo);
+		if(i_grid < y_grid.size() && !isnan(y_grid[i_grid])) y_value.set(y_grid[i_grid]);
+		else mcomp.calculate(x_value, y_value);
+		i_grid++;
 		x_vector[i] = x_value;
 		y_vector[i] = y_value;
 		int find_x = 0;
@@ -1155,9 +1178,7 @@ void generate_plotvector(const MathStructure &m, MathStructure x_mstruct, const
 							if(i >= 2 && x_value2.number() < x_vector[i - 1].number()) {
 								new_i = i - 1;
 							}
-							y_value2 = mthis;
-							y_value2.replace(x_mstruct, x_value2);
-							y_value2.eval(eo);
+							mcomp.calculate(x_value2, y_value2);
 							if(y_value2.isNumber() && y_value2.number().hasImaginaryPart() && testComplexZero(&y_value2.number(), y_value2.number().internalImaginary())) y_value2.number().clearImaginary();
 							x_vector.insertChild(x_value2, new_i + 1);
 							y_vector.insertChild(y_value2, new_i + 1);
@@ -1227,9 +1248,7 @@ void generate_plotvector(const MathStructure &m, MathStructure x_mstruct, const
 			if(find_legal_point(meval, x_mstruct, x_value2, x_vector[i - 1], x_value, eo, prev_illegal == 1)) {
 				if(x_value2.number().precision() > 0) x_value2.number() += step.number() * Number(find_x == 1 ? -1 : 1, 1, -x_value2.number().precision());
 				if(x_value2.number() > x_vector[i - 1].number() && x_value2.number() < x_vector[i].number()) {
-					y_value = mthis;
-					y_value.replace(x_mstruct, x_value2);
-					y_value.eval(eo);
+					mcomp.calculate(x_value2, y_value);
 					if(y_value.isNumber()) {
 						if(y_value.number().hasImaginaryPart() && testComplexZero(&y_value.number(), y_value.number().internalImaginary())) y_value.number().clearImaginary();
 						if(y_value.number().isReal()) {
@@ -1289,22 +1308,27 @@ void generate_plotvector(const MathStructure &m, MathStructure x_mstruct, const
 		}
 	}
 	if(adaptive && x_vector.size() > 0) {
+		// build new vectors, since insertion of children in large vectors is slow
+		MathStructure x_vector_new, y_vector_new;
+		x_vector_new.clearVector();
+		y_vector_new.clearVector();
+		x_vector_new.addChild(x_vector[0]);
+		y_vector_new.addChild(y_vector[0]);
 		if(ydiff_total.isZero()) {
 			x_value = x_vector[0];
 			x_value.number() += step.number() / 2;
-			for(int i = 1; i < (int) x_vector.size(); i += 2) {
-				if(CALCULATOR->aborted()) break;
-				x_vector.insertChild(x_value, i + 1);
-				y_value = mthis;
-				y_value.replace(x_mstruct, x_value);
-				y_value.eval(eo);
-				y_vector.insertChild(y_value, i + 1);
+		}
+		Number new_step_size;
+		bool b_aborted = false;
+		for(size_t i = 1; i < x_vector.size(); i++) {
+			if(!b_aborted && CALCULATOR->aborted()) b_aborted = true;
+			if(b_aborted) {
+			} else if(ydiff_total.isZero()) {
+				x_vector_new.addChild(x_value);
+				mcomp.calculate(x_value, y_value);
+				y_vector_new.addChild(y_value);
 				x_value.number() += step.number();
-			}
-		} else {
-			Number new_step_size;
-			for(int i = 1; i < (int) x_vector.size(); i++) {
-				if(CALCULATOR->aborted()) break;
+			} else {
 				int new_steps = 0;
 				if(!ydiff[i].number().isZero()) {
 					ydiff[i].number() /= ydiff_total;
@@ -1316,32 +1340,31 @@ void generate_plotvector(const MathStructure &m, MathStructure x_mstruct, const
 					x_value = x_vector[i];
 					x_value.number() += x_vector[i - 1].number();
 					x_value.number() /= 2;
-					x_vector.insertChild(x_value, i + 1);
-					y_value = mthis;
-					y_value.replace(x_mstruct, x_value);
-					y_value.eval(eo);
-					y_vector.insertChild(y_value, i + 1);
-					ydiff.insertChild(m_zero, i + 1);
-					i++;
+					x_vector_new.addChild(x_value);
+					mcomp.calculate(x_value, y_value);
+					y_vector_new.addChild(y_value);
 				} else if(new_steps > 0) {
 					new_step_size = x_vector[i].number();
 					new_step_size -= x_vector[i - 1].number();
 					new_step_size /= (new_steps + 1);
 					x_value = x_vector[i - 1].number();
 					for(int i2 = 0; i2 < new_steps; i2++) {
-						if(CALCULATOR->aborted()) break;
+						if(CALCULATOR->aborted()) {
+							b_aborted = true;
+							break;
+						}
 						x_value.number() += new_step_size;
-						x_vector.insertChild(x_value, i + i2 + 1);
-						y_value = mthis;
-						y_value.replace(x_mstruct, x_value);
-						y_value.eval(eo);
-						y_vector.insertChild(y_value, i + i2 + 1);
-						ydiff.insertChild(m_zero, i + i2 + 1);
+						x_vector_new.addChild(x_value);
+						mcomp.calculate(x_value, y_value);
+						y_vector_new.addChild(y_value);
 					}
-					i += new_steps;
 				}
 			}
+			x_vector_new.addChild(x_vector[i]);
+			y_vector_new.addChild(y_vector[i]);
 		}
+		x_vector.set_nocopy(x_vector_new);
+		y_vector.set_nocopy(y_vector_new);
 	}
 }
 MathStructure MathStructure::generateVector(MathStructure x_mstruct, const MathStructure &min, const MathStructure &max, int steps, MathStructure *x_vector, const EvaluationOptions &eo) const {
@@ -1371,13 +1394,12 @@ MathStructure MathStructure::generateVector(MathStructure x_mstruct, const MathS
 	MathStructure mthis(*this);
 	mthis.unformat();
 	calculate_userfunctions(mthis, x_mstruct, eo, true);
+	CompiledExpression mcomp(mthis, x_mstruct, eo);
 	for(int i = 0; i < steps; i++) {
 		if(x_vector) {
 			(*x_vector)[i] = x_value;
 		}
-		y_value = mthis;
-		y_value.replace(x_mstruct, x_value);
-		y_value.eval(eo);
+		mcomp.calculate(x_value, y_value);
 		y_vector[i] = y_value;
 		if(i == steps - 1) {}
 		else if(i + 2 == steps) x_value = max;
@@ -1436,6 +1458,7 @@ MathStructure MathStructure::generateVector(MathStructure x_mstruct, const MathS
 	MathStructure mthis(*this);
 	mthis.unformat();
 	calculate_userfunctions(mthis, x_mstruct, eo, true);
+	CompiledExpression mcomp(mthis, x_mstruct, eo);
 	bool b_neg = (cr == COMPARISON_RESULT_LESS);
 	cr = max.compare(x_value);
 	size_t i = 0;
@@ -1444,9 +1467,7 @@ MathStructure MathStructure::generateVector(MathStructure x_mstruct, const MathS
 			if(i >= x_vector->size()) x_vector->addChild(x_value);
 			else (*x_vector)[i] = x_value;
 		}
-		y_value = mthis;
-		y_value.replace(x_mstruct, x_value);
-		y_value.eval(eo);
+		mcomp.calculate(x_value, y_value);
 		if(i >= y_vector.size()) y_vector.addChild(y_value);
 		else y_vector[i] = y_value;
 		if(step.isZero()) {
@@ -1479,14 +1500,13 @@ MathStructure MathStructure::generateVector(MathStructure x_mstruct, const MathS
 	MathStructure mthis(*this);
 	mthis.unformat();
 	calculate_userfunctions(mthis, x_mstruct, eo, true);
+	CompiledExpression mcomp(mthis, x_mstruct, eo);
 	for(size_t i = 1; i <= x_vector.countChildren(); i++) {
 		if(CALCULATOR->aborted()) {
 			y_vector.clearVector();
 			return y_vector;
 		}
-		y_value = mthis;
-		y_value.replace(x_mstruct, x_vector.getChild(i));
-		y_value.eval(eo);
+		mcomp.calculate(x_vector.getChild(i), y_value);
 		y_vector.addChild(y_value);
 	}
 	return y_vector;
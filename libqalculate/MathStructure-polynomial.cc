@@ -20,6 +20,7 @@
 #include "Unit.h"
 #include "Prefix.h"
 #include <algorithm>
+#include <map>
 #include "MathStructure-support.h"
 
 using std::string;
@@ -402,6 +403,15 @@ bool MathStructure::polynomialQuotient(const MathStructure &mnum, const MathStru
 		return false;
 	}
 
+	vector<Number> vnum, vden;
+	if(dense_polynomial_from_mathstructure(mden, xvar, vden) && vden.size() > 1 && dense_polynomial_from_mathstructure(mnum, xvar, vnum)) {
+		// univariate polynomials with rational coefficients
+		vector<Number> vquo, vrem;
+		if(!dense_polynomial_divide(vnum, vden, vquo, vrem)) return false;
+		dense_polynomial_to_mathstructure(vquo, xvar, mquotient);
+		return true;
+	}
+
 	EvaluationOptions eo2 = eo;
 	eo2.keep_zero_units = false;
 
@@ -544,6 +554,745 @@ bool get_first_symbol(const MathStructure &mpoly, MathStructure &xvar) {
 	return false;
 }
 
+// Dense univariate polynomials: coefficients (lowest degree first, without leading zeroes) in a vector of rational numbers.
+// Integer polynomials are multiplied using Kronecker substitution (the polynomials are evaluated at a large enough power of two and the resulting integers multiplied using GMP).
+
+#define DENSE_POLYNOMIAL_KRONECKER_MIN_SIZE 8
+
+void zpoly_trim(vector<Number> &a) {
+	while(!a.empty() && a.back().isZero()) a.pop_back();
+}
+// z = a(2^k) for coefficients i1 to i2 - 1
+void zpoly_pack(const vector<Number> &a, size_t i1, size_t i2, mp_bitcnt_t k, mpz_t z) {
+	if(i2 - i1 == 1) {
+		mpz_set(z, ZCOEFF(a, i1));
+		return;
+	}
+	size_t mid = (i1 + i2) / 2;
+	mpz_t zhigh;
+	mpz_init(zhigh);
+	zpoly_pack(a, i1, mid, k, z);
+	zpoly_pack(a, mid, i2, k, zhigh);
+	mpz_mul_2exp(zhigh, zhigh, k * (mid - i1));
+	mpz_add(z, z, zhigh);
+	mpz_clear(zhigh);
+}
+// coefficients i1 to i2 - 1 from z = c(2^k), with |c_i| < 2^(k-1) (z is overwritten)
+void zpoly_unpack(mpz_t z, size_t i1, size_t i2, mp_bitcnt_t k, vector<Number> &c) {
+	if(i2 - i1 == 1) {
+		mpz_swap(ZCOEFF(c, i1), z);
+		return;
+	}
+	size_t mid = (i1 + i2) / 2;
+	mp_bitcnt_t bits = k * (mid - i1);
+	mpz_t zhigh;
+	mpz_init(zhigh);
+	// the lower half is in the range (-2^(bits-1), 2^(bits-1))
+	if(mpz_tstbit(z, bits - 1)) {
+		mpz_cdiv_q_2exp(zhigh, z, bits);
+		mpz_cdiv_r_2exp(z, z, bits);
+	} else {
+		mpz_fdiv_q_2exp(zhigh, z, bits);
+		mpz_fdiv_r_2exp(z, z, bits);
+	}
+	zpoly_unpack(z, i1, mid, k, c);
+	zpoly_unpack(zhigh, mid, i2, k, c);
+	mpz_clear(zhigh);
+}
+void zpoly_mul(const vector<Number> &a, const vector<Number> &b, vector<Number> &c) {
+	c.clear();
+	if(a.empty() || b.empty()) return;
+	c.resize(a.size() + b.size() - 1, nr_zero);
+	if(a.size() >= DENSE_POLYNOMIAL_KRONECKER_MIN_SIZE && b.size() >= DENSE_POLYNOMIAL_KRONECKER_MIN_SIZE) {
+		size_t bits_a = 0, bits_b = 0, bits_n = 1;
+		for(size_t i = 0; i < a.size(); i++) {
+			size_t n = mpz_sizeinbase(ZCOEFF(a, i), 2);
+			if(n > bits_a) bits_a = n;
+		}
+		for(size_t i = 0; i < b.size(); i++) {
+			size_t n = mpz_sizeinbase(ZCOEFF(b, i), 2);
+			if(n > bits_b) bits_b = n;
+		}
+		for(size_t n = (a.size() < b.size() ? a.size() : b.size()); n > 1; n >>= 1) bits_n++;
+		// |c_i| <= min(deg(a), deg(b)) * max(|a_i|) * max(|b_i|) < 2^(k-1)
+		mp_bitcnt_t k = bits_a + bits_b + bits_n + 1;
+		mpz_t za, zb;
+		mpz_init(za);
+		zpoly_pack(a, 0, a.size(), k, za);
+		if(&a == &b) {
+			mpz_mul(za, za, za);
+		} else {
+			mpz_init(zb);
+			zpoly_pack(b, 0, b.size(), k, zb);
+			mpz_mul(za, za, zb);
+			mpz_clear(zb);
+		}
+		zpoly_unpack(za, 0, c.size(), k, c);
+		mpz_clear(za);
+	} else {
+		for(size_t i = 0; i < a.size(); i++) {
+			if(a[i].isZero()) continue;
+			for(size_t i2 = 0; i2 < b.size(); i2++) mpz_addmul(ZCOEFF(c, i + i2), ZCOEFF(a, i), ZCOEFF(b, i2));
+		}
+	}
+	zpoly_trim(c);
+}
+// integer polynomial z and positive integer den, with a = z / den
+void dense_polynomial_integer(const vector<Number> &a, vector<Number> &z, mpz_t den) {
+	mpz_set_ui(den, 1);
+	for(size_t i = 0; i < a.size(); i++) mpz_lcm(den, den, mpq_denref(a[i].internalRational()));
+	z = a;
+	if(mpz_cmp_ui(den, 1) == 0) return;
+	mpz_t f;
+	mpz_init(f);
+	for(size_t i = 0; i < z.size(); i++) {
+		mpz_divexact(f, den, mpq_denref(z[i].internalRational()));
+		mpz_mul(ZCOEFF(z, i), ZCOEFF(z, i), f);
+		mpz_set_ui(mpq_denref(z[i].internalRational()), 1);
+	}
+	mpz_clear(f);
+}
+// c = z / den
+void dense_polynomial_divide_integer(vector<Number> &c, const mpz_t den) {
+	if(mpz_cmp_ui(den, 1) == 0) return;
+	for(size_t i = 0; i < c.size(); i++) {
+		if(c[i].isZero()) continue;
+		mpz_set(mpq_denref(c[i].internalRational()), den);
+		mpq_canonicalize(c[i].internalRational());
+	}
+}
+// adds a term (c, x, x^n, c*x or c*x^n, with rational c) to v
+bool dense_polynomial_add_term(const MathStructure &mterm, const MathStructure &xvar, vector<Number> &v, size_t max_degree) {
+	const Number *coeff = &nr_one;
+	const MathStructure *mx = &mterm;
+	if(mterm.isNumber()) {
+		coeff = &mterm.number();
+		mx = NULL;
+	} else if(mterm.isMultiplication()) {
+		if(mterm.size() != 2 || !mterm[0].isNumber()) return false;
+		coeff = &mterm[0].number();
+		mx = &mterm[1];
+	}
+	if(!coeff->isRational() || coeff->isApproximate()) return false;
+	size_t deg = 0;
+	if(mx) {
+		if(mx->isPower() && (*mx)[1].isNumber() && (*mx)[1].number().isInteger() && (*mx)[1].number().isPositive() && (*mx)[1].number().isLessThanOrEqualTo((long int) max_degree) && (*mx)[0] == xvar) {
+			deg = (size_t) (*mx)[1].number().lintValue();
+		} else if(*mx == xvar) {
+			deg = 1;
+		} else {
+			return false;
+		}
+	}
+	if(deg >= v.size()) v.resize(deg + 1, nr_zero);
+	mpq_add(v[deg].internalRational(), v[deg].internalRational(), coeff->internalRational());
+	return true;
+}
+// coefficients of mpoly, if mpoly is a polynomial in xvar (and no other variable) with rational coefficients
+bool dense_polynomial_from_mathstructure(const MathStructure &mpoly, const MathStructure &xvar, vector<Number> &v, size_t max_degree) {
+	v.clear();
+	if(mpoly.isAddition()) {
+		for(size_t i = 0; i < mpoly.size(); i++) {
+			if(!dense_polynomial_add_term(mpoly[i], xvar, v, max_degree)) return false;
+		}
+	} else if(!dense_polynomial_add_term(mpoly, xvar, v, max_degree)) {
+		return false;
+	}
+	zpoly_trim(v);
+	return true;
+}
+// symbols and unknown variables, which can be multiplied and raised without further simplification
+bool is_polynomial_variable(const MathStructure &m) {
+	return (m.isSymbolic() || (m.isVariable() && !m.variable()->isKnown())) && m.representsNonMatrix();
+}
+// as dense_polynomial_from_mathstructure(), but also finds the variable
+bool get_dense_polynomial(const MathStructure &mpoly, MathStructure &xvar, vector<Number> &v, size_t max_degree) {
+	if(!get_first_symbol(mpoly, xvar) || !is_polynomial_variable(xvar)) return false;
+	return dense_polynomial_from_mathstructure(mpoly, xvar, v, max_degree);
+}
+// sum of coefficient * xvar^i, for the coefficients in v
+void dense_polynomial_to_mathstructure(const vector<Number> &v, const MathStructure &xvar, MathStructure &mpoly) {
+	mpoly.clear();
+	mpoly.setType(STRUCT_ADDITION);
+	for(size_t i = v.size(); i > 0; i--) {
+		if(v[i - 1].isZero()) continue;
+		if(i == 1) {
+			mpoly.addChild_nocopy(new MathStructure(v[0]));
+			continue;
+		}
+		MathStructure *mterm;
+		if(i == 2) {
+			mterm = new MathStructure(xvar);
+		} else {
+			mterm = new MathStructure();
+			mterm->setType(STRUCT_POWER);
+			mterm->addChild(xvar);
+			mterm->addChild_nocopy(new MathStructure((long int) i - 1, 1L, 0L));
+		}
+		if(!v[i - 1].isOne()) {
+			MathStructure *mmul = new MathStructure();
+			mmul->setType(STRUCT_MULTIPLICATION);
+			mmul->addChild_nocopy(new MathStructure(v[i - 1]));
+			mmul->addChild_nocopy(mterm);
+			mterm = mmul;
+		}
+		mpoly.addChild_nocopy(mterm);
+	}
+	if(mpoly.size() == 0) mpoly.clear();
+	else if(mpoly.size() == 1) mpoly.setToChild(1, true);
+}
+void dense_polynomial_multiply(const vector<Number> &a, const vector<Number> &b, vector<Number> &c) {
+	vector<Number> za, zb;
+	mpz_t den_a, den_b;
+	mpz_init(den_a);
+	dense_polynomial_integer(a, za, den_a);
+	if(&a == &b) {
+		zpoly_mul(za, za, c);
+		mpz_mul(den_a, den_a, den_a);
+	} else {
+		mpz_init(den_b);
+		dense_polynomial_integer(b, zb, den_b);
+		zpoly_mul(za, zb, c);
+		mpz_mul(den_a, den_a, den_b);
+		mpz_clear(den_b);
+	}
+	dense_polynomial_divide_integer(c, den_a);
+	mpz_clear(den_a);
+}
+// c = a^n, using binary exponentiation
+void dense_polynomial_power(const vector<Number> &a, unsigned long int n, vector<Number> &c) {
+	vector<Number> zbase, tmp;
+	mpz_t den;
+	mpz_init(den);
+	dense_polynomial_integer(a, zbase, den);
+	mpz_pow_ui(den, den, n);
+	c.clear();
+	c.push_back(nr_one);
+	while(n > 0) {
+		if(n & 1) {
+			zpoly_mul(c, zbase, tmp);
+			c.swap(tmp);
+		}
+		n >>= 1;
+		if(n > 0) {
+			zpoly_mul(zbase, zbase, tmp);
+			zbase.swap(tmp);
+		}
+	}
+	dense_polynomial_divide_integer(c, den);
+	mpz_clear(den);
+}
+// polynomial division with remainder: a = q * b + r, deg(r) < deg(b); returns false if aborted
+bool dense_polynomial_divide(const vector<Number> &a, const vector<Number> &b, vector<Number> &q, vector<Number> &r) {
+	r = a;
+	q.clear();
+	if(b.empty() || r.size() < b.size()) return true;
+	q.resize(r.size() - b.size() + 1, nr_zero);
+	size_t db = b.size() - 1;
+	mpq_t lc_inv, t;
+	mpq_init(lc_inv);
+	mpq_init(t);
+	mpq_inv(lc_inv, b.back().internalRational());
+	for(size_t i = r.size() - 1; i >= db; i--) {
+		if(CALCULATOR->aborted()) {
+			mpq_clear(lc_inv);
+			mpq_clear(t);
+			return false;
+		}
+		size_t qi = i - db;
+		if(!r[i].isZero()) {
+			mpq_mul(q[qi].internalRational(), r[i].internalRational(), lc_inv);
+			for(size_t i2 = 0; i2 < db; i2++) {
+				if(b[i2].isZero()) continue;
+				mpq_mul(t, q[qi].internalRational(), b[i2].internalRational());
+				mpq_sub(r[qi + i2].internalRational(), r[qi + i2].internalRational(), t);
+			}
+		}
+		if(i == 0) break;
+	}
+	mpq_clear(lc_inv);
+	mpq_clear(t);
+	r.resize(db);
+	zpoly_trim(r);
+	zpoly_trim(q);
+	return true;
+}
+
+SparsePolynomial::SparsePolynomial(size_t nr_of_vars) : i_used(0) {
+	setVariableCount(nr_of_vars);
+}
+void SparsePolynomial::clear() {
+	v_keys.clear();
+	v_coeffs.clear();
+	v_used.clear();
+	i_used = 0;
+}
+// the exponent of each variable uses an equal number of bits (at most 32), with the highest bit used for overflow detection
+void SparsePolynomial::setVariableCount(size_t nr_of_vars) {
+	clear();
+	i_vars = nr_of_vars == 0 ? 1 : nr_of_vars;
+	i_bits = 64 / i_vars;
+	if(i_bits > 32) i_bits = 32;
+	i_guard = 0;
+	if(i_bits < 2) return;
+	for(size_t i = 0; i < i_vars; i++) i_guard |= 1ULL << ((i_vars - i - 1) * i_bits + i_bits - 1);
+}
+size_t SparsePolynomial::variableCount() const {return i_vars;}
+bool SparsePolynomial::makeKey(const vector<unsigned long int> &exponents, unsigned long long &key) const {
+	key = 0;
+	for(size_t i = 0; i < i_vars && i < exponents.size(); i++) {
+		if(i_bits < 2 || exponents[i] >= (1UL << (i_bits - 1))) return false;
+		key |= ((unsigned long long) exponents[i]) << ((i_vars - i - 1) * i_bits);
+	}
+	return true;
+}
+unsigned long int SparsePolynomial::exponent(unsigned long long key, size_t var_i) const {
+	return (unsigned long int) ((key >> ((i_vars - var_i - 1) * i_bits)) & ((1ULL << i_bits) - 1));
+}
+bool SparsePolynomial::multiplyKeys(unsigned long long key1, unsigned long long key2, unsigned long long &key) const {
+	key = key1 + key2;
+	return (key & i_guard) == 0;
+}
+bool SparsePolynomial::divideKeys(unsigned long long key1, unsigned long long key2, unsigned long long &key) const {
+	// with the guard bits set, no borrow crosses into the next exponent, and a guard bit is cleared if the exponent of key2 is larger
+	key = (key1 | i_guard) - key2;
+	if((key & i_guard) != i_guard) return false;
+	key ^= i_guard;
+	return true;
+}
+size_t SparsePolynomial::findSlot(unsigned long long key) const {
+	unsigned long long h = key * 0x9E3779B97F4A7C15ULL;
+	size_t mask = v_keys.size() - 1;
+	size_t i = (size_t) (h ^ (h >> 32)) & mask;
+	while(v_used[i] && v_keys[i] != key) i = (i + 1) & mask;
+	return i;
+}
+void SparsePolynomial::rehash(size_t new_size) {
+	vector<unsigned long long> keys_old;
+	vector<Number> coeffs_old;
+	vector<char> used_old;
+	keys_old.swap(v_keys);
+	coeffs_old.swap(v_coeffs);
+	used_old.swap(v_used);
+	v_keys.resize(new_size, 0);
+	v_coeffs.resize(new_size);
+	v_used.resize(new_size, 0);
+	i_used = 0;
+	for(size_t i = 0; i < keys_old.size(); i++) {
+		if(used_old[i] && !coeffs_old[i].isZero()) {
+			size_t i2 = findSlot(keys_old[i]);
+			v_used[i2] = 1;
+			v_keys[i2] = keys_old[i];
+			std::swap(v_coeffs[i2], coeffs_old[i]);
+			i_used++;
+		}
+	}
+}
+size_t SparsePolynomial::slotCount() const {return v_keys.size();}
+bool SparsePolynomial::hasTerm(size_t slot) const {return v_used[slot] && !v_coeffs[slot].isZero();}
+unsigned long long SparsePolynomial::key(size_t slot) const {return v_keys[slot];}
+const Number &SparsePolynomial::coefficient(size_t slot) const {return v_coeffs[slot];}
+Number &SparsePolynomial::coefficient(size_t slot) {return v_coeffs[slot];}
+Number &SparsePolynomial::term(unsigned long long key) {
+	if((i_used + 1) * 2 > v_keys.size()) {
+		// zero coefficients are removed when rehashing
+		size_t n = countTerms() * 4;
+		size_t new_size = 16;
+		while(new_size < n) new_size *= 2;
+		rehash(new_size);
+	}
+	size_t i = findSlot(key);
+	if(!v_used[i]) {
+		v_used[i] = 1;
+		v_keys[i] = key;
+		i_used++;
+	}
+	return v_coeffs[i];
+}
+void SparsePolynomial::sortedTerms(vector<size_t> &slots) const {
+	vector<std::pair<unsigned long long, size_t> > v;
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(hasTerm(i)) v.push_back(std::pair<unsigned long long, size_t>(v_keys[i], i));
+	}
+	std::sort(v.begin(), v.end());
+	slots.clear();
+	for(size_t i = v.size(); i > 0; i--) slots.push_back(v[i - 1].second);
+}
+size_t SparsePolynomial::countTerms() const {
+	size_t n = 0;
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(hasTerm(i)) n++;
+	}
+	return n;
+}
+bool SparsePolynomial::isZero() const {
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(hasTerm(i)) return false;
+	}
+	return true;
+}
+bool SparsePolynomial::isConstant() const {
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(hasTerm(i) && v_keys[i] != 0) return false;
+	}
+	return true;
+}
+Number SparsePolynomial::termCoefficient(unsigned long long key) const {
+	if(v_keys.empty()) return nr_zero;
+	size_t i = findSlot(key);
+	if(!v_used[i]) return nr_zero;
+	return v_coeffs[i];
+}
+Number SparsePolynomial::constant() const {
+	return termCoefficient(0);
+}
+long int SparsePolynomial::degree(size_t var_i) const {
+	unsigned long int deg = 0;
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(hasTerm(i) && exponent(v_keys[i], var_i) > deg) deg = exponent(v_keys[i], var_i);
+	}
+	return (long int) deg;
+}
+unsigned long long SparsePolynomial::leadingKey() const {
+	unsigned long long key = 0;
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(hasTerm(i) && v_keys[i] > key) key = v_keys[i];
+	}
+	return key;
+}
+void SparsePolynomial::addTerm(unsigned long long key, const Number &nr) {
+	if(nr.isZero()) return;
+	Number &c = term(key);
+	mpq_add(c.internalRational(), c.internalRational(), nr.internalRational());
+}
+void SparsePolynomial::add(const SparsePolynomial &p, const Number &factor) {
+	if(&p == this) {
+		SparsePolynomial p2(p);
+		add(p2, factor);
+		return;
+	}
+	if(factor.isZero()) return;
+	mpq_t t;
+	mpq_init(t);
+	for(size_t i = 0; i < p.slotCount(); i++) {
+		if(!p.hasTerm(i)) continue;
+		Number &c = term(p.key(i));
+		if(factor.isOne()) {
+			mpq_add(c.internalRational(), c.internalRational(), p.coefficient(i).internalRational());
+		} else {
+			mpq_mul(t, p.coefficient(i).internalRational(), factor.internalRational());
+			mpq_add(c.internalRational(), c.internalRational(), t);
+		}
+	}
+	mpq_clear(t);
+}
+bool SparsePolynomial::multiply(const SparsePolynomial &p1, const SparsePolynomial &p2) {
+	if(&p1 == this || &p2 == this) {
+		SparsePolynomial p(p1.variableCount());
+		if(!p.multiply(p1, p2)) return false;
+		*this = p;
+		return true;
+	}
+	setVariableCount(p1.variableCount());
+	vector<size_t> slots1, slots2;
+	for(size_t i = 0; i < p1.slotCount(); i++) {
+		if(p1.hasTerm(i)) slots1.push_back(i);
+	}
+	for(size_t i = 0; i < p2.slotCount(); i++) {
+		if(p2.hasTerm(i)) slots2.push_back(i);
+	}
+	mpq_t t;
+	mpq_init(t);
+	for(size_t i = 0; i < slots1.size(); i++) {
+		if(CALCULATOR->aborted()) {
+			mpq_clear(t);
+			clear();
+			return false;
+		}
+		for(size_t i2 = 0; i2 < slots2.size(); i2++) {
+			unsigned long long k;
+			if(!multiplyKeys(p1.key(slots1[i]), p2.key(slots2[i2]), k)) {
+				mpq_clear(t);
+				clear();
+				return false;
+			}
+			mpq_mul(t, p1.coefficient(slots1[i]).internalRational(), p2.coefficient(slots2[i2]).internalRational());
+			Number &c = term(k);
+			mpq_add(c.internalRational(), c.internalRational(), t);
+		}
+	}
+	mpq_clear(t);
+	return true;
+}
+void SparsePolynomial::multiply(const Number &nr) {
+	if(nr.isZero()) {
+		clear();
+		return;
+	}
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(hasTerm(i)) mpq_mul(v_coeffs[i].internalRational(), v_coeffs[i].internalRational(), nr.internalRational());
+	}
+}
+// multinomial theorem: (c1*t1+c2*t2+...+cm*tm)^n = sum of n!/(k1!*k2!*...*km!)*(c1*t1)^k1*(c2*t2)^k2*...*(cm*tm)^km, for all k1+k2+...+km=n
+bool SparsePolynomial::power(const SparsePolynomial &p, unsigned long int n) {
+	if(&p == this) {
+		SparsePolynomial p2(p);
+		return power(p2, n);
+	}
+	setVariableCount(p.variableCount());
+	if(n == 0) {
+		addTerm(0, nr_one);
+		return true;
+	}
+	vector<size_t> slots;
+	for(size_t i = 0; i < p.slotCount(); i++) {
+		if(p.hasTerm(i)) slots.push_back(i);
+	}
+	if(slots.empty()) return true;
+	size_t m = slots.size();
+	// keys and coefficients of k-th power of each term
+	vector<vector<unsigned long long> > kpow(m);
+	vector<vector<Number> > cpow(m);
+	for(size_t i = 0; i < m; i++) {
+		kpow[i].resize(n + 1, 0);
+		cpow[i].resize(n + 1, nr_one);
+		for(unsigned long int k = 1; k <= n; k++) {
+			if(!multiplyKeys(kpow[i][k - 1], p.key(slots[i]), kpow[i][k])) {
+				clear();
+				return false;
+			}
+			mpq_mul(cpow[i][k].internalRational(), cpow[i][k - 1].internalRational(), p.coefficient(slots[i]).internalRational());
+		}
+	}
+	// depth-first enumeration of (k1, k2, ..., km), with ki from the remaining exponent down to zero;
+	// the binomial coefficient of each level is updated incrementally (C(r, k-1) = C(r, k)*k/(r-k+1)),
+	// and the multinomial coefficient, the coefficient product, and the key are kept for each prefix
+	// (the exponents of the result are not larger than the checked n-th powers of the terms)
+	vector<unsigned long int> k(m), r(m);
+	vector<unsigned long long> kf(m);
+	vector<Number> bn(m), mf(m), cf(m);
+	mpq_t t;
+	mpq_init(t);
+	size_t i = 0;
+	r[0] = n; k[0] = n; kf[0] = 0;
+	bn[0].set(1, 1, 0); mf[0].set(1, 1, 0); cf[0].set(1, 1, 0);
+	while(true) {
+		if(i < m - 1) {
+			mpq_mul(mf[i + 1].internalRational(), mf[i].internalRational(), bn[i].internalRational());
+			mpq_mul(cf[i + 1].internalRational(), cf[i].internalRational(), cpow[i][k[i]].internalRational());
+			kf[i + 1] = kf[i] + kpow[i][k[i]];
+			r[i + 1] = r[i] - k[i];
+			i++;
+			k[i] = r[i];
+			bn[i].set(1, 1, 0);
+			continue;
+		}
+		// the last exponent is the remainder
+		mpq_mul(t, mf[i].internalRational(), cf[i].internalRational());
+		mpq_mul(t, t, cpow[i][r[i]].internalRational());
+		Number &c = term(kf[i] + kpow[i][r[i]]);
+		mpq_add(c.internalRational(), c.internalRational(), t);
+		// backtrack to the last level with a non-zero exponent
+		bool b_done = true;
+		while(i > 0) {
+			i--;
+			if(k[i] > 0) {
+				b_done = false;
+				break;
+			}
+		}
+		if(b_done) break;
+		if(CALCULATOR->aborted()) {
+			mpq_clear(t);
+			clear();
+			return false;
+		}
+		mpz_mul_ui(mpq_numref(bn[i].internalRational()), mpq_numref(bn[i].internalRational()), k[i]);
+		mpz_divexact_ui(mpq_numref(bn[i].internalRational()), mpq_numref(bn[i].internalRational()), r[i] - k[i] + 1);
+		k[i]--;
+	}
+	mpq_clear(t);
+	return true;
+}
+// multivariate division in lexicographical order: the leading term of the remainder is repeatedly eliminated using the leading term of p
+bool SparsePolynomial::divide(const SparsePolynomial &p, SparsePolynomial &q, bool integer_quotient) const {
+	q.setVariableCount(i_vars);
+	vector<size_t> slots;
+	p.sortedTerms(slots);
+	if(slots.empty()) return false;
+	if(isZero()) return true;
+	// the degree of the quotient in each variable is known if the division is exact
+	vector<unsigned long int> qdeg;
+	for(size_t i = 0; i < i_vars; i++) {
+		long int d = degree(i) - p.degree(i);
+		if(d < 0) return false;
+		qdeg.push_back(d);
+	}
+	unsigned long long qbound, k;
+	makeKey(qdeg, qbound);
+	std::map<unsigned long long, Number> r;
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(hasTerm(i)) r[v_keys[i]] = v_coeffs[i];
+	}
+	unsigned long long lk = p.key(slots[0]);
+	const Number &lc = p.coefficient(slots[0]);
+	mpq_t qc, t;
+	mpq_init(qc);
+	mpq_init(t);
+	bool b = true;
+	while(!r.empty()) {
+		if(CALCULATOR->aborted()) {b = false; break;}
+		std::map<unsigned long long, Number>::iterator it = r.end();
+		--it;
+		unsigned long long qk;
+		if(!divideKeys(it->first, lk, qk) || !divideKeys(qbound, qk, k)) {b = false; break;}
+		mpq_div(qc, it->second.internalRational(), lc.internalRational());
+		if(integer_quotient && mpz_cmp_ui(mpq_denref(qc), 1) != 0) {b = false; break;}
+		mpq_set(q.term(qk).internalRational(), qc);
+		r.erase(it);
+		for(size_t i = 1; i < slots.size(); i++) {
+			k = qk + p.key(slots[i]);
+			mpq_mul(t, qc, p.coefficient(slots[i]).internalRational());
+			it = r.find(k);
+			if(it == r.end()) {
+				mpq_neg(t, t);
+				mpq_set(r[k].internalRational(), t);
+			} else {
+				mpq_sub(it->second.internalRational(), it->second.internalRational(), t);
+				if(it->second.isZero()) r.erase(it);
+			}
+		}
+	}
+	mpq_clear(qc);
+	mpq_clear(t);
+	if(!b) q.clear();
+	return b;
+}
+void SparsePolynomial::evaluate(size_t var_i, const Number &value, SparsePolynomial &p) const {
+	p.setVariableCount(i_vars);
+	vector<Number> pows;
+	pows.push_back(nr_one);
+	unsigned long long mask = ((1ULL << i_bits) - 1) << ((i_vars - var_i - 1) * i_bits);
+	mpq_t t;
+	mpq_init(t);
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(!hasTerm(i)) continue;
+		unsigned long int e = exponent(v_keys[i], var_i);
+		while(pows.size() <= e) {
+			pows.push_back(pows.back());
+			mpq_mul(pows.back().internalRational(), pows.back().internalRational(), value.internalRational());
+		}
+		mpq_mul(t, v_coeffs[i].internalRational(), pows[e].internalRational());
+		Number &c = p.term(v_keys[i] & ~mask);
+		mpq_add(c.internalRational(), c.internalRational(), t);
+	}
+	mpq_clear(t);
+}
+bool SparsePolynomial::isInteger() const {
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(hasTerm(i) && mpz_cmp_ui(mpq_denref(v_coeffs[i].internalRational()), 1) != 0) return false;
+	}
+	return true;
+}
+// gcd of numerators divided by lcm of denominators
+void SparsePolynomial::integerContent(Number &nr) const {
+	mpz_t g, l;
+	mpz_init(g);
+	mpz_init_set_ui(l, 1);
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(!hasTerm(i)) continue;
+		mpz_gcd(g, g, mpq_numref(v_coeffs[i].internalRational()));
+		mpz_lcm(l, l, mpq_denref(v_coeffs[i].internalRational()));
+	}
+	nr.clear();
+	mpq_set_num(nr.internalRational(), g);
+	mpq_set_den(nr.internalRational(), l);
+	mpq_canonicalize(nr.internalRational());
+	mpz_clear(g);
+	mpz_clear(l);
+}
+Number SparsePolynomial::maxCoefficient() const {
+	Number nr, nr_abs;
+	for(size_t i = 0; i < v_keys.size(); i++) {
+		if(!hasTerm(i)) continue;
+		mpq_abs(nr_abs.internalRational(), v_coeffs[i].internalRational());
+		if(mpq_cmp(nr_abs.internalRational(), nr.internalRational()) > 0) nr = nr_abs;
+	}
+	return nr;
+}
+bool sparse_polynomial_add_factor(const MathStructure &m, const vector<MathStructure> &vars, vector<unsigned long int> &exps, Number &coeff) {
+	if(m.isNumber()) {
+		if(!m.number().isRational() || m.number().isApproximate()) return false;
+		mpq_mul(coeff.internalRational(), coeff.internalRational(), m.number().internalRational());
+		return true;
+	}
+	const MathStructure *mbase = &m;
+	unsigned long int e = 1;
+	if(m.isPower()) {
+		if(!m[1].isNumber() || !m[1].number().isInteger() || !m[1].number().isPositive() || !m[1].number().isLessThan(1L << 30)) return false;
+		e = (unsigned long int) m[1].number().lintValue();
+		mbase = &m[0];
+	}
+	for(size_t i = 0; i < vars.size(); i++) {
+		if(vars[i] == *mbase) {
+			exps[i] += e;
+			return true;
+		}
+	}
+	return false;
+}
+bool SparsePolynomial::set(const MathStructure &mpoly, const vector<MathStructure> &vars) {
+	setVariableCount(vars.size());
+	if(i_bits < 4) return false;
+	if(mpoly.isZero()) return true;
+	vector<unsigned long int> exps;
+	Number coeff;
+	unsigned long long k;
+	for(size_t i = 0; i < (mpoly.isAddition() ? mpoly.size() : 1); i++) {
+		const MathStructure &mterm = (mpoly.isAddition() ? mpoly[i] : mpoly);
+		exps.assign(vars.size(), 0);
+		coeff.set(1, 1, 0);
+		if(mterm.isMultiplication()) {
+			for(size_t i2 = 0; i2 < mterm.size(); i2++) {
+				if(!sparse_polynomial_add_factor(mterm[i2], vars, exps, coeff)) return false;
+			}
+		} else if(!sparse_polynomial_add_factor(mterm, vars, exps, coeff)) {
+			return false;
+		}
+		if(!makeKey(exps, k)) return false;
+		addTerm(k, coeff);
+	}
+	return true;
+}
+void SparsePolynomial::get(MathStructure &mpoly, const vector<MathStructure> &vars) const {
+	vector<size_t> slots;
+	sortedTerms(slots);
+	mpoly.clear();
+	mpoly.setType(STRUCT_ADDITION);
+	for(size_t i = 0; i < slots.size(); i++) {
+		MathStructure *mterm = new MathStructure();
+		mterm->setType(STRUCT_MULTIPLICATION);
+		if(v_keys[slots[i]] == 0 || !v_coeffs[slots[i]].isOne()) mterm->addChild_nocopy(new MathStructure(v_coeffs[slots[i]]));
+		for(size_t i2 = 0; i2 < vars.size() && i2 < i_vars; i2++) {
+			unsigned long int e = exponent(v_keys[slots[i]], i2);
+			if(e == 0) continue;
+			if(e == 1) {
+				mterm->addChild(vars[i2]);
+			} else {
+				MathStructure *mpow = new MathStructure(vars[i2]);
+				mpow->raise_nocopy(new MathStructure((long int) e, 1L, 0L));
+				mterm->addChild_nocopy(mpow);
+			}
+		}
+		// factors in the same order as in evaluated products (not in the order of vars), so that the term can be merged with equal terms
+		if(mterm->size() == 1) mterm->setToChild(1, true);
+		else mterm->evalSort();
+		mpoly.addChild_nocopy(mterm);
+	}
+	if(mpoly.size() == 0) mpoly.clear();
+	else if(mpoly.size() == 1) mpoly.setToChild(1, true);
+}
+
 bool MathStructure::polynomialDivide(const MathStructure &mnum, const MathStructure &mden, MathStructure &mquotient, const EvaluationOptions &eo, bool check_args) {
 
 	mquotient.clear();
@@ -583,6 +1332,16 @@ bool MathStructure::polynomialDivide(const MathStructure &mnum, const MathStruct
 	MathStructure xvar;
 	if(!get_first_symbol(mnum, xvar) && !get_first_symbol(mden, xvar)) return false;
 
+	vector<Number> vnum, vden;
+	if(dense_polynomial_from_mathstructure(mden, xvar, vden) && vden.size() > 1 && dense_polynomial_from_mathstructure(mnum, xvar, vnum)) {
+		// univariate polynomials with rational coefficients
+		vector<Number> vquo, vrem;
+		if(!dense_polynomial_divide(vnum, vden, vquo, vrem)) return false;
+		if(!vrem.empty()) return false;
+		dense_polynomial_to_mathstructure(vquo, xvar, mquotient);
+		return true;
+	}
+
 	EvaluationOptions eo2 = eo;
 	eo2.keep_zero_units = false;
 
@@ -950,6 +1709,16 @@ bool polynomial_long_division(const MathStructure &mnum, const MathStructure &md
 		return true;
 	}
 
+	vector<Number> vnum, vden;
+	if(dense_polynomial_from_mathstructure(mden, xvar, vden) && vden.size() > 1 && dense_polynomial_from_mathstructure(mnum, xvar, vnum)) {
+		// univariate polynomials with rational coefficients
+		vector<Number> vquo, vrem;
+		if(!dense_polynomial_divide(vnum, vden, vquo, vrem)) return false;
+		dense_polynomial_to_mathstructure(vquo, xvar, mquotient);
+		dense_polynomial_to_mathstructure(vrem, xvar, mrem);
+		return true;
+	}
+
 	EvaluationOptions eo2 = eo;
 	eo2.keep_zero_units = false;
 	eo2.do_polynomial_division = false;
@@ -585,12 +585,12 @@ void MathStructure::sort(const PrintOptions &po, bool recursive) {
 		b = false;
 		for(size_t i2 = 0; i2 < sorted.size(); i2++) {
 			if(sortCompare(CHILD(i), *v_subs[sorted[i2]], *this, po2) < 0) {
-				sorted.insert(sorted.begin() + i2, v_order[i]);
+				sorted.insert(sorted.begin() + i2, i);
 				b = true;
 				break;
 			}
 		}
-		if(!b) sorted.push_back(v_order[i]);
+		if(!b) sorted.push_back(i);
 	}
 	if(CALCULATOR->aborted()) return;
 	if(m_type == STRUCT_ADDITION && SIZE > 2 && po.sort_options.minus_last && v_subs[sorted[0]]->hasNegativeSign()) {
@@ -604,9 +604,12 @@ void MathStructure::sort(const PrintOptions &po, bool recursive) {
 		}
 	}
 	if(CALCULATOR->aborted()) return;
+	vector<MathStructure*> v_subs_sorted;
+	v_subs_sorted.reserve(sorted.size());
 	for(size_t i2 = 0; i2 < sorted.size(); i2++) {
-		v_order[i2] = sorted[i2];
+		v_subs_sorted.push_back(v_subs[sorted[i2]]);
 	}
+	v_subs.swap(v_subs_sorted);
 }
 
 void MathStructure::unformat(const EvaluationOptions &eo) {
@@ -2045,8 +2048,7 @@ void MathStructure::prefixCurrencies(const PrintOptions &po) {
 			}
 		}
 		if(index >= 0) {
-			v_order.insert(v_order.begin(), v_order[index]);
-			v_order.erase(v_order.begin() + (index + 1));
+			CHILD_TO_FRONT(index)
 		}
 	} else {
 		for(size_t i = 0; i < SIZE; i++) {
@@ -4196,23 +4198,23 @@ string MathStructure::print(const PrintOptions &po, bool format, int colorize, i
 		}
 		case STRUCT_ABORTED: {}
 		case STRUCT_SYMBOLIC: {
-			if(m_type == STRUCT_SYMBOLIC && po.allow_non_usable && format && (tagtype == TAG_TYPE_HTML || (tagtype == TAG_TYPE_TERMINAL && po.use_unicode_signs)) && unicode_length(s_sym) == 3 && s_sym.find('_', 1) < s_sym.length() - 1) {
+			if(m_type == STRUCT_SYMBOLIC && po.allow_non_usable && format && (tagtype == TAG_TYPE_HTML || (tagtype == TAG_TYPE_TERMINAL && po.use_unicode_signs)) && unicode_length(symbol()) == 3 && symbol().find('_', 1) < symbol().length() - 1) {
 				if(tagtype == TAG_TYPE_HTML) {
-					print_str = sub_suffix_html(s_sym);
+					print_str = sub_suffix_html(symbol());
 				} else {
-					print_str = s_sym;
+					print_str = symbol();
 					sub_suffix_unicode(print_str, 1);
 				}
 			} else if(po.allow_non_usable) {
-				print_str = s_sym;
+				print_str = symbol();
 			} else {
-				if((text_length_is_one(s_sym) && s_sym.find("\'") == string::npos) || s_sym.find("\"") != string::npos) {
+				if((text_length_is_one(symbol()) && symbol().find("\'") == string::npos) || symbol().find("\"") != string::npos) {
 					print_str = "\'";
-					print_str += s_sym;
+					print_str += symbol();
 					print_str += "\'";
 				} else {
 					print_str = "\"";
-					print_str += s_sym;
+					print_str += symbol();
 					print_str += "\"";
 				}
 			}
@@ -16,8 +16,10 @@
 
 #include "MathStructure.h"
 
-#define SWAP_CHILDREN(i1, i2)		{MathStructure *swap_mstruct = v_subs[v_order[i1]]; v_subs[v_order[i1]] = v_subs[v_order[i2]]; v_subs[v_order[i2]] = swap_mstruct;}
-#define CHILD_TO_FRONT(i)		v_order.insert(v_order.begin(), v_order[i]); v_order.erase(v_order.begin() + (i + 1));
+#include <mutex>
+
+#define SWAP_CHILDREN(i1, i2)		{MathStructure *swap_mstruct = v_subs[i1]; v_subs[i1] = v_subs[i2]; v_subs[i2] = swap_mstruct;}
+#define CHILD_TO_FRONT(i)		{MathStructure *m_front = v_subs[i]; v_subs.erase(v_subs.begin() + (i)); v_subs.insert(v_subs.begin(), m_front);}
 #define SET_CHILD_MAP(i)		setToChild(i + 1, true);
 #define SET_MAP(o)			set(o, true);
 #define SET_MAP_NOCOPY(o)		set_nocopy(o, true);
@@ -25,55 +27,30 @@
 #define CHILD_UPDATED(i)		if(!b_approx && CHILD(i).isApproximate()) b_approx = true; if(CHILD(i).precision() > 0 && (i_precision < 1 || CHILD(i).precision() < i_precision)) i_precision = CHILD(i).precision();
 #define CHILDREN_UPDATED		for(size_t child_i = 0; child_i < SIZE; child_i++) {if(!b_approx && CHILD(child_i).isApproximate()) b_approx = true; if(CHILD(child_i).precision() > 0 && (i_precision < 1 || CHILD(child_i).precision() < i_precision)) i_precision = CHILD(child_i).precision();}
 
-#define APPEND(o)		v_order.push_back(v_subs.size()); v_subs.push_back(new MathStructure(o)); if(!b_approx && o.isApproximate()) b_approx = true; if(o.precision() > 0 && (i_precision < 1 || o.precision() < i_precision)) i_precision = o.precision();
-#define APPEND_NEW(o)		{v_order.push_back(v_subs.size()); MathStructure *m_append_new = new MathStructure(o); v_subs.push_back(m_append_new); if(!b_approx && m_append_new->isApproximate())	b_approx = true; if(m_append_new->precision() > 0 && (i_precision < 1 || m_append_new->precision() < i_precision)) i_precision = m_append_new->precision();}
-#define APPEND_COPY(o)		v_order.push_back(v_subs.size()); v_subs.push_back(new MathStructure(*(o))); if(!b_approx && (o)->isApproximate()) b_approx = true; if((o)->precision() > 0 && (i_precision < 1 || (o)->precision() < i_precision)) i_precision = (o)->precision();
-#define APPEND_POINTER(o)	{MathStructure *m_append = o; v_order.push_back(v_subs.size()); v_subs.push_back(m_append); if(!b_approx && m_append->isApproximate()) b_approx = true; if(m_append->precision() > 0 && (i_precision < 1 || m_append->precision() < i_precision)) i_precision = m_append->precision();}
-#define APPEND_REF(o)		{MathStructure *m_append = o; v_order.push_back(v_subs.size()); v_subs.push_back(m_append); m_append->ref(); if(!b_approx && m_append->isApproximate()) b_approx = true; if(m_append->precision() > 0 && (i_precision < 1 || m_append->precision() < i_precision)) i_precision = m_append->precision();}
-#define PREPEND(o)		v_order.insert(v_order.begin(), v_subs.size()); v_subs.push_back(new MathStructure(o)); if(!b_approx && o.isApproximate()) b_approx = true; if(o.precision() > 0 && (i_precision < 1 || o.precision() < i_precision)) i_precision = o.precision();
-#define PREPEND_REF(o)		{MathStructure *m_append = o; v_order.insert(v_order.begin(), v_subs.size()); v_subs.push_back(m_append); m_append->ref(); if(!b_approx && m_append->isApproximate()) b_approx = true; if(m_append->precision() > 0 && (i_precision < 1 || m_append->precision() < i_precision)) i_precision = m_append->precision();}
-#define INSERT_REF(o, i)	{MathStructure *m_append = o; v_order.insert(v_order.begin() + i, v_subs.size()); v_subs.push_back(m_append); m_append->ref(); if(!b_approx && m_append->isApproximate()) b_approx = true; if(m_append->precision() > 0 && (i_precision < 1 || m_append->precision() < i_precision)) i_precision = m_append->precision();}
-#define CLEAR			v_order.clear(); for(size_t i = 0; i < v_subs.size(); i++) {v_subs[i]->unref();} v_subs.clear();
+#define APPEND(o)		v_subs.push_back(new MathStructure(o)); if(!b_approx && o.isApproximate()) b_approx = true; if(o.precision() > 0 && (i_precision < 1 || o.precision() < i_precision)) i_precision = o.precision();
+#define APPEND_NEW(o)		{MathStructure *m_append_new = new MathStructure(o); v_subs.push_back(m_append_new); if(!b_approx && m_append_new->isApproximate())	b_approx = true; if(m_append_new->precision() > 0 && (i_precision < 1 || m_append_new->precision() < i_precision)) i_precision = m_append_new->precision();}
+#define APPEND_COPY(o)		v_subs.push_back(new MathStructure(*(o))); if(!b_approx && (o)->isApproximate()) b_approx = true; if((o)->precision() > 0 && (i_precision < 1 || (o)->precision() < i_precision)) i_precision = (o)->precision();
+#define APPEND_POINTER(o)	{MathStructure *m_append = o; v_subs.push_back(m_append); if(!b_approx && m_append->isApproximate()) b_approx = true; if(m_append->precision() > 0 && (i_precision < 1 || m_append->precision() < i_precision)) i_precision = m_append->precision();}
+#define APPEND_REF(o)		{MathStructure *m_append = o; v_subs.push_back(m_append); m_append->ref(); if(!b_approx && m_append->isApproximate()) b_approx = true; if(m_append->precision() > 0 && (i_precision < 1 || m_append->precision() < i_precision)) i_precision = m_append->precision();}
+#define PREPEND(o)		v_subs.insert(v_subs.begin(), new MathStructure(o)); if(!b_approx && o.isApproximate()) b_approx = true; if(o.precision() > 0 && (i_precision < 1 || o.precision() < i_precision)) i_precision = o.precision();
+#define PREPEND_REF(o)		{MathStructure *m_append = o; v_subs.insert(v_subs.begin(), m_append); m_append->ref(); if(!b_approx && m_append->isApproximate()) b_approx = true; if(m_append->precision() > 0 && (i_precision < 1 || m_append->precision() < i_precision)) i_precision = m_append->precision();}
+#define INSERT_REF(o, i)	{MathStructure *m_append = o; v_subs.insert(v_subs.begin() + (i), m_append); m_append->ref(); if(!b_approx && m_append->isApproximate()) b_approx = true; if(m_append->precision() > 0 && (i_precision < 1 || m_append->precision() < i_precision)) i_precision = m_append->precision();}
+#define CLEAR			for(size_t i = 0; i < v_subs.size(); i++) {v_subs[i]->unref();} v_subs.clear();
 #define REDUCE(v_size)          {\
-	for(size_t v_index = v_size; v_index < v_order.size(); v_index++) {\
-		v_subs[v_order[v_index]]->unref();\
-	}\
-	v_order.resize(v_size, 0);\
-	bool b_reorder_subs = false;\
-	for(size_t v_index = 0; v_index < v_order.size(); v_index++) {\
-		if(v_order[v_index] != v_index) {\
-			b_reorder_subs = true;\
-			break;\
-		}\
-	}\
-	if(b_reorder_subs) {\
-		std::vector<MathStructure*> v_subs_new;\
-		v_subs_new.resize(v_order.size(), NULL);\
-		for(size_t v_index = 0; v_index < v_order.size(); v_index++) {\
-			v_subs_new[v_index] = v_subs[v_order[v_index]];\
-		}\
-		v_subs = v_subs_new;\
-		for(size_t v_index = 0; v_index < v_order.size(); v_index++) {\
-			v_order[v_index] = v_index;\
-		}\
-	} else {\
-		v_subs.resize(v_order.size(), NULL);\
+	for(size_t v_index = v_size; v_index < v_subs.size(); v_index++) {\
+		v_subs[v_index]->unref();\
 	}\
+	v_subs.resize(v_size, NULL);\
 }
-#define CHILD(v_index)		(*v_subs[v_order[v_index]])
-#define SIZE			v_order.size()
-#define LAST			(*v_subs[v_order[v_order.size() - 1]])
+#define CHILD(v_index)		(*v_subs[v_index])
+#define SIZE			v_subs.size()
+#define LAST			(*v_subs.back())
 #define ERASE(v_index)		{\
-	size_t i_order = v_order[v_index];\
-	v_subs[i_order]->unref();\
-	v_subs.erase(v_subs.begin() + i_order);\
-	if(i_order < v_subs.size()) {\
-		for(std::vector<size_t>::iterator it = v_order.begin(); it != v_order.end(); ++it) {\
-			if(*it > i_order) (*it)--;\
-		}\
-	}\
-	v_order.erase(v_order.begin() + (v_index));\
+	v_subs[v_index]->unref();\
+	v_subs.erase(v_subs.begin() + (v_index));\
 }
+// used by MathStructure::structuralHash() and for like term signatures
+#define HASH_COMBINE(h, v)	h ^= (size_t) (v) + 0x9e3779b9 + (h << 6) + (h >> 2)
 
 #define IS_REAL(o)		(o.isNumber() && o.number().isReal())
 #define IS_RATIONAL(o)		(o.isNumber() && o.number().isRational())
@@ -171,6 +148,17 @@ void collect_symbols(const MathStructure &mpoly, sym_desc_vec &v);
 void add_symbol(const MathStructure &mpoly, std::vector<MathStructure> &v);
 void collect_symbols(const MathStructure &mpoly, std::vector<MathStructure> &v);
 void get_symbol_stats(const MathStructure &m1, const MathStructure &m2, sym_desc_vec &v);
+#define ZCOEFF(v, i) mpq_numref((v)[i].internalRational())
+#define DENSE_POLYNOMIAL_MAX_DEGREE 10000
+void zpoly_trim(std::vector<Number> &a);
+void zpoly_mul(const std::vector<Number> &a, const std::vector<Number> &b, std::vector<Number> &c);
+bool dense_polynomial_from_mathstructure(const MathStructure &mpoly, const MathStructure &xvar, std::vector<Number> &v, size_t max_degree = DENSE_POLYNOMIAL_MAX_DEGREE);
+bool is_polynomial_variable(const MathStructure &m);
+bool get_dense_polynomial(const MathStructure &mpoly, MathStructure &xvar, std::vector<Number> &v, size_t max_degree = DENSE_POLYNOMIAL_MAX_DEGREE);
+void dense_polynomial_to_mathstructure(const std::vector<Number> &v, const MathStructure &xvar, MathStructure &mpoly);
+void dense_polynomial_multiply(const std::vector<Number> &a, const std::vector<Number> &b, std::vector<Number> &c);
+void dense_polynomial_power(const std::vector<Number> &a, unsigned long int n, std::vector<Number> &c);
+bool dense_polynomial_divide(const std::vector<Number> &a, const std::vector<Number> &b, std::vector<Number> &q, std::vector<Number> &r);
 bool sqrfree(MathStructure &mpoly, const EvaluationOptions &eo);
 bool sqrfree(MathStructure &mpoly, const std::vector<MathStructure> &symbols, const EvaluationOptions &eo);
 bool simplify_functions(MathStructure &mstruct, const EvaluationOptions &eo, const EvaluationOptions &feo, const MathStructure &x_var = m_undefined);
@@ -235,6 +223,103 @@ bool represents_loose_matrix(const MathStructure &m);
 void fix_user_function_expression(std::string &str, const EvaluationOptions &eo);
 void generate_plotvector(const MathStructure &m, MathStructure x_mstruct, const MathStructure &min, const MathStructure &max, int steps, MathStructure &x_vector, MathStructure &y_vector, const EvaluationOptions &eo, bool adaptive = true);
 void generate_plotvector(const MathStructure &m, MathStructure x_mstruct, const MathStructure &min, const MathStructure &max, const MathStructure &step, MathStructure &x_vector, MathStructure &y_vector, const EvaluationOptions &eo);
+
+// Lowers an evaluated expression, with x_var as the only unknown, to a sequence of number operations, for repeated calculation with different values of x_var (used by generateVector(), plotting, sum() and product())
+class CompiledExpression {
+  protected:
+	struct Operation {
+		int type;
+		size_t r, r2;
+	};
+	MathStructure m_expr, x_var;
+	EvaluationOptions eo;
+	std::vector<Operation> ops;
+	std::vector<Number> regs;
+	size_t i_result;
+	bool b_compiled;
+	int i_double;
+	std::vector<double> dregs;
+	std::vector<char> dfailed;
+	double d_cancel_limit;
+	size_t compileSub(const MathStructure &m, bool in_angle = false);
+	size_t addOperation(int type, size_t r, size_t r2 = 0);
+	bool initDoubles();
+	void calculateDoubleBlock(const double *x_values, double *y_values, size_t n);
+  public:
+	CompiledExpression(const MathStructure &m, const MathStructure &x_mstruct, const EvaluationOptions &eo, bool allow_double = false);
+	bool isCompiled() const;
+	// Calculates the value of the expression with x_var replaced by x_value. MathStructure::eval() is used if the expression could not be compiled or if the number operations fail.
+	void calculate(const MathStructure &x_value, MathStructure &result);
+	bool calculateNumber(const Number &x_value, Number &result);
+	// Calculates the values for x_values using double precision floating point (only if allow_double was set). Returns false if this is not possible. Values which overflow or lose too much precision are set to NaN and must be calculated using calculate().
+	bool calculateDoubles(const std::vector<double> &x_values, std::vector<double> &y_values);
+};
+// Sparse distributed multivariate polynomial with rational coefficients (used by the polynomial gcd functions and for expansion of polynomials).
+// The exponents of a monomial are packed into a single integer key, with the first variable in the most significant bits (the numerical order of keys is the lexicographical order of monomials and a product of monomials is the sum of their keys), and the terms are stored in an open addressing hash table from keys to coefficients.
+class SparsePolynomial {
+  protected:
+	std::vector<unsigned long long> v_keys;
+	std::vector<Number> v_coeffs;
+	std::vector<char> v_used;
+	size_t i_used, i_vars, i_bits;
+	unsigned long long i_guard;
+	size_t findSlot(unsigned long long key) const;
+	void rehash(size_t new_size);
+  public:
+	SparsePolynomial(size_t nr_of_vars = 1);
+	void clear();
+	void setVariableCount(size_t nr_of_vars);
+	size_t variableCount() const;
+	// Returns false if an exponent does not fit in the key
+	bool makeKey(const std::vector<unsigned long int> &exponents, unsigned long long &key) const;
+	unsigned long int exponent(unsigned long long key, size_t var_i) const;
+	// Returns false if the exponents of the product overflow
+	bool multiplyKeys(unsigned long long key1, unsigned long long key2, unsigned long long &key) const;
+	// Returns false if key2 does not divide key1
+	bool divideKeys(unsigned long long key1, unsigned long long key2, unsigned long long &key) const;
+	// Slots of the hash table; slots without a term are skipped using hasTerm()
+	size_t slotCount() const;
+	bool hasTerm(size_t slot) const;
+	unsigned long long key(size_t slot) const;
+	const Number &coefficient(size_t slot) const;
+	Number &coefficient(size_t slot);
+	// Coefficient of the monomial (a new term with zero coefficient is inserted if not found)
+	Number &term(unsigned long long key);
+	// Coefficient of the monomial (zero if not found)
+	Number termCoefficient(unsigned long long key) const;
+	// Slots of all terms, in decreasing (lexicographical) order
+	void sortedTerms(std::vector<size_t> &slots) const;
+	size_t countTerms() const;
+	bool isZero() const;
+	bool isConstant() const;
+	Number constant() const;
+	long int degree(size_t var_i) const;
+	unsigned long long leadingKey() const;
+	void addTerm(unsigned long long key, const Number &nr);
+	void add(const SparsePolynomial &p, const Number &factor = nr_one);
+	bool multiply(const SparsePolynomial &p1, const SparsePolynomial &p2);
+	void multiply(const Number &nr);
+	// this = p^n, using the multinomial theorem. Returns false if the exponents overflow
+	bool power(const SparsePolynomial &p, unsigned long int n);
+	// Exact division (q = this / p), with integer coefficients in q if integer_quotient is true. Returns false if the division is not exact.
+	bool divide(const SparsePolynomial &p, SparsePolynomial &q, bool integer_quotient = false) const;
+	// The variable with index var_i replaced by an integer value
+	void evaluate(size_t var_i, const Number &value, SparsePolynomial &p) const;
+	bool isInteger() const;
+	void integerContent(Number &nr) const;
+	Number maxCoefficient() const;
+	// Conversion from a polynomial with rational coefficients in the specified variables
+	bool set(const MathStructure &mpoly, const std::vector<MathStructure> &vars);
+	void get(MathStructure &mpoly, const std::vector<MathStructure> &vars) const;
+};
+bool heur_gcd(const SparsePolynomial &m1, const SparsePolynomial &m2, SparsePolynomial &mgcd, SparsePolynomial *ca, SparsePolynomial *cb, size_t var_i);
+bool interpolate(const SparsePolynomial &gamma, const Number &xi, size_t var_i, SparsePolynomial &minterp);
+bool modular_gcd(const SparsePolynomial &m1, const SparsePolynomial &m2, SparsePolynomial &mgcd, SparsePolynomial *ca, SparsePolynomial *cb);
+long int modp_inv(long int a, long int p);
+void modp_trim(std::vector<long int> &a);
+void modp_mul(const std::vector<long int> &a, const std::vector<long int> &b, std::vector<long int> &c, long int p);
+void modp_divrem(const std::vector<long int> &a, const std::vector<long int> &b, std::vector<long int> &q, std::vector<long int> &r, long int p);
+void modp_gcd(const std::vector<long int> &a, const std::vector<long int> &b, std::vector<long int> &g, long int p);
 bool has_predominately_negative_sign(const MathStructure &mstruct);
 void negate_struct(MathStructure &mstruct);
 void recursive_zero_vector(MathStructure &m, const MathStructure &m2);
@@ -268,5 +353,10 @@ void clear_randstate();
 
 void initialize_global_variables(bool = false);
 
+// protects values which are calculated on demand and stored in shared definitions, and changes of the shared name lists (see Calculator::beginThreadContext())
+extern std::recursive_mutex definitions_mutex;
+// returns the value of a known variable (b_alt selects the value without units) stored in the separate calculation context of the current thread, or NULL if the thread uses the state of the Calculator. Since a value stored in the variable might be replaced by another thread while in use, values calculated on demand in other threads are stored in the context. The value is reset if definitions have been changed or, if b_dynamic is true, if the precision or interval arithmetic setting has been changed.
+MathStructure **thread_variable_value(const KnownVariable *v, bool b_alt, bool b_dynamic);
+
 #endif
 
@@ -22,6 +22,9 @@
 #include "DataSet.h"
 #include <map>
 #include <algorithm>
+#include <utility>
+#include <float.h>
+#include <functional>
 #include "MathStructure-support.h"
 
 using std::string;
@@ -52,6 +55,70 @@ size_t MathStructure::refcount() const {
 	return i_ref;
 }
 
+#define NODE_POOL_MAX_FREE 10000
+#define SET_SYMBOL(x)		if(s_sym) {*s_sym = x;} else {s_sym = new string(x);}
+
+// set when the node pools of the current thread have been cleared at thread exit; blocks released after this (e.g. during destruction of static objects) are freed directly
+thread_local bool node_pools_destroyed = false;
+// frees the unused blocks of the node pools of the current thread at thread exit
+struct NodePoolCleaner {
+	bool b_used;
+	~NodePoolCleaner();
+};
+thread_local NodePoolCleaner node_pool_cleaner;
+
+void *NodePool::allocate(size_t size) {
+	if(size == node_size && free_nodes) {
+		FreeNode *node = free_nodes;
+		free_nodes = node->next;
+		n_free--;
+		return node;
+	}
+	return ::operator new(size);
+}
+void NodePool::release(void *ptr, size_t size) {
+	if(!ptr) return;
+	if(size != node_size || node_pools_destroyed || n_free >= NODE_POOL_MAX_FREE) {
+		::operator delete(ptr);
+		return;
+	}
+	// makes sure that the cleaner is constructed, and destroyed at thread exit, in this thread
+	if(!free_nodes) node_pool_cleaner.b_used = true;
+	FreeNode *node = (FreeNode*) ptr;
+	node->next = free_nodes;
+	free_nodes = node;
+	n_free++;
+}
+void NodePool::clear() {
+	while(free_nodes) {
+		FreeNode *node = free_nodes;
+		free_nodes = node->next;
+		::operator delete(node);
+	}
+	n_free = 0;
+}
+
+thread_local NodePool mathstructure_pool(sizeof(MathStructure));
+thread_local NodePool number_pool(sizeof(Number));
+
+NodePoolCleaner::~NodePoolCleaner() {
+	mathstructure_pool.clear();
+	number_pool.clear();
+	node_pools_destroyed = true;
+}
+
+void clear_node_pools() {
+	mathstructure_pool.clear();
+	number_pool.clear();
+}
+
+void *MathStructure::operator new(size_t size) {
+	return mathstructure_pool.allocate(size);
+}
+void MathStructure::operator delete(void *ptr, size_t size) {
+	mathstructure_pool.release(ptr, size);
+}
+
 
 inline void MathStructure::init() {
 	m_type = STRUCT_NUMBER;
@@ -67,6 +134,7 @@ inline void MathStructure::init() {
 	o_unit = NULL;
 	o_prefix = NULL;
 	o_datetime = NULL;
+	s_sym = NULL;
 	b_parentheses = false;
 }
 
@@ -82,7 +150,7 @@ MathStructure::MathStructure(const MathStructure &o) {
 		}
 		case STRUCT_ABORTED: {}
 		case STRUCT_SYMBOLIC: {
-			s_sym = o.symbol();
+			SET_SYMBOL(o.symbol())
 			break;
 		}
 		case STRUCT_DATETIME: {
@@ -122,6 +190,10 @@ MathStructure::MathStructure(const MathStructure &o) {
 	m_type = o.type();
 	b_parentheses = o.inParentheses();
 }
+MathStructure::MathStructure(MathStructure &&o) {
+	init();
+	set(std::move(o));
+}
 MathStructure::MathStructure(long int num, long int den, long int exp10) {
 	init();
 	o_number.set(num, den, exp10);
@@ -145,7 +217,7 @@ MathStructure::MathStructure(string sym, bool force_symbol) {
 		delete o_datetime;
 		o_datetime = NULL;
 	}
-	s_sym = sym;
+	SET_SYMBOL(sym)
 	m_type = STRUCT_SYMBOLIC;
 }
 MathStructure::MathStructure(const QalculateDateTime &o_dt) {
@@ -213,6 +285,7 @@ MathStructure::~MathStructure() {
 	if(o_variable) o_variable->unref();
 	if(o_unit) o_unit->unref();
 	if(o_datetime) delete o_datetime;
+	if(s_sym) delete s_sym;
 	for(size_t i = 0; i < v_subs.size(); i++) {v_subs[i]->unref();}
 }
 
@@ -227,7 +300,7 @@ void MathStructure::set(const MathStructure &o, bool merge_precision) {
 		}
 		case STRUCT_ABORTED: {}
 		case STRUCT_SYMBOLIC: {
-			s_sym = o.symbol();
+			SET_SYMBOL(o.symbol())
 			break;
 		}
 		case STRUCT_DATETIME: {
@@ -272,6 +345,41 @@ void MathStructure::set(const MathStructure &o, bool merge_precision) {
 	m_type = o.type();
 	if(var_bak) var_bak->unref();
 }
+void MathStructure::set(MathStructure &&o, bool merge_precision) {
+	if(&o == this) return;
+	Variable *var_bak = o_variable;
+	if(var_bak) var_bak->ref();
+	o.ref();
+	clear(merge_precision);
+	if(o.type() == STRUCT_NUMBER) o_number = std::move(o.number());
+	std::swap(s_sym, o.s_sym);
+	o_datetime = o.o_datetime;
+	o.o_datetime = NULL;
+	o_function = o.o_function;
+	o.o_function = NULL;
+	function_value = o.function_value;
+	o.function_value = NULL;
+	o_variable = o.o_variable;
+	o.o_variable = NULL;
+	o_unit = o.o_unit;
+	o.o_unit = NULL;
+	o_prefix = o.prefix();
+	b_plural = o.isPlural();
+	ct_comp = o.comparisonType();
+	b_protected = o.isProtected();
+	v_subs.swap(o.v_subs);
+	if(merge_precision) {
+		MERGE_APPROX_AND_PREC(o);
+	} else {
+		b_approx = o.isApproximate();
+		i_precision = o.precision();
+	}
+	b_parentheses = o.inParentheses();
+	m_type = o.type();
+	o.clear();
+	o.unref();
+	if(var_bak) var_bak->unref();
+}
 void MathStructure::set_nocopy(MathStructure &o, bool merge_precision) {
 	Variable *var_bak = o_variable;
 	if(var_bak) var_bak->ref();
@@ -284,7 +392,7 @@ void MathStructure::set_nocopy(MathStructure &o, bool merge_precision) {
 		}
 		case STRUCT_ABORTED: {}
 		case STRUCT_SYMBOLIC: {
-			s_sym = o.symbol();
+			SET_SYMBOL(o.symbol())
 			break;
 		}
 		case STRUCT_DATETIME: {
@@ -387,7 +495,7 @@ void MathStructure::set(string sym, bool preserve_precision, bool force_symbol)
 		delete o_datetime;
 		o_datetime = NULL;
 	}
-	s_sym = sym;
+	SET_SYMBOL(sym)
 	m_type = STRUCT_SYMBOLIC;
 }
 void MathStructure::set(const QalculateDateTime &o_dt, bool preserve_precision) {
@@ -455,13 +563,14 @@ void MathStructure::setUndefined(bool preserve_precision) {
 void MathStructure::setAborted(bool preserve_precision) {
 	clear(preserve_precision);
 	m_type = STRUCT_ABORTED;
-	s_sym = _("aborted");
+	SET_SYMBOL(_("aborted"))
 }
 
 void MathStructure::setProtected(bool do_protect) {b_protected = do_protect;}
 bool MathStructure::isProtected() const {return b_protected;}
 
 void MathStructure::operator = (const MathStructure &o) {set(o);}
+void MathStructure::operator = (MathStructure &&o) {set(std::move(o));}
 void MathStructure::operator = (const Number &o) {set(o);}
 void MathStructure::operator = (int i) {set(i, 1, 0);}
 void MathStructure::operator = (Unit *u) {set(u);}
@@ -626,7 +735,8 @@ void MathStructure::childrenUpdated(bool recursive) {
 	}
 }
 const string &MathStructure::symbol() const {
-	return s_sym;
+	if(!s_sym) return empty_string;
+	return *s_sym;
 }
 const QalculateDateTime *MathStructure::datetime() const {
 	return o_datetime;
@@ -710,7 +820,7 @@ bool MathStructure::isPower() const {return m_type == STRUCT_POWER;}
 bool MathStructure::isSymbolic() const {return m_type == STRUCT_SYMBOLIC;}
 bool MathStructure::isDateTime() const {return m_type == STRUCT_DATETIME;}
 bool MathStructure::isAborted() const {return m_type == STRUCT_ABORTED;}
-bool MathStructure::isEmptySymbol() const {return m_type == STRUCT_SYMBOLIC && s_sym.empty();}
+bool MathStructure::isEmptySymbol() const {return m_type == STRUCT_SYMBOLIC && symbol().empty();}
 bool MathStructure::isVector() const {return m_type == STRUCT_VECTOR;}
 bool MathStructure::isMatrix() const {
 	if(m_type != STRUCT_VECTOR || SIZE < 1) return false;
@@ -1933,7 +2043,7 @@ bool MathStructure::equals(const MathStructure &o, bool allow_interval, bool all
 	if(SIZE != o.size()) return false;
 	switch(m_type) {
 		case STRUCT_UNDEFINED: {return true;}
-		case STRUCT_SYMBOLIC: {return s_sym == o.symbol();}
+		case STRUCT_SYMBOLIC: {return symbol() == o.symbol();}
 		case STRUCT_DATETIME: {return *o_datetime == *o.datetime();}
 		case STRUCT_NUMBER: {return o_number.equals(o.number(), allow_interval, allow_infinite);}
 		case STRUCT_VARIABLE: {return o_variable == o.variable();}
@@ -1992,6 +2102,60 @@ bool MathStructure::equals(const MathStructure &o, bool allow_interval, bool all
 	}
 	return true;
 }
+size_t number_hash(const Number &nr) {
+	size_t h = 0;
+	if(nr.hasImaginaryPart()) h = number_hash(*nr.internalImaginary());
+	// infinite numbers are only equal with allow_infinite
+	if(nr.includesInfinity(true)) {HASH_COMBINE(h, 1); return h;}
+	// floating point numbers which are equal to a rational number must give the same hash as the rational number (mpq_get_d() truncates)
+	double d;
+	if(nr.isFloatingPoint()) d = mpfr_get_d(nr.internalLowerFloat(), MPFR_RNDZ);
+	else d = mpq_get_d(nr.internalRational());
+	if(d == 0.0 || !(d < DBL_MAX && d > -DBL_MAX)) d = 0.0;
+	HASH_COMBINE(h, std::hash<double>()(d));
+	return h;
+}
+size_t MathStructure::structuralHash() const {
+	size_t h = m_type;
+	switch(m_type) {
+		case STRUCT_SYMBOLIC: {HASH_COMBINE(h, std::hash<string>()(symbol())); return h;}
+		case STRUCT_NUMBER: {HASH_COMBINE(h, number_hash(o_number)); return h;}
+		case STRUCT_VARIABLE: {HASH_COMBINE(h, std::hash<void*>()(o_variable)); return h;}
+		case STRUCT_UNIT: {
+			HASH_COMBINE(h, std::hash<void*>()(o_unit));
+			if(o_prefix && o_prefix != CALCULATOR->getDecimalNullPrefix() && o_prefix != CALCULATOR->getBinaryNullPrefix()) HASH_COMBINE(h, std::hash<void*>()(o_prefix));
+			return h;
+		}
+		case STRUCT_COMPARISON: {HASH_COMBINE(h, ct_comp); break;}
+		case STRUCT_FUNCTION: {
+			HASH_COMBINE(h, std::hash<void*>()(o_function));
+			// data set properties and objects with different names might be equal
+			if(o_function->subtype() == SUBTYPE_DATA_SET) {
+				for(size_t i = 0; i < SIZE; i++) {
+					if(CHILD(i).isSymbolic()) HASH_COMBINE(h, STRUCT_SYMBOLIC);
+					else HASH_COMBINE(h, CHILD(i).structuralHash());
+				}
+				return h;
+			}
+			break;
+		}
+		case STRUCT_LOGICAL_OR: {}
+		case STRUCT_LOGICAL_XOR: {}
+		case STRUCT_LOGICAL_AND: {
+			// order of children is ignored by equals()
+			size_t h2 = 0;
+			for(size_t i = 0; i < SIZE; i++) h2 += CHILD(i).structuralHash();
+			HASH_COMBINE(h, h2);
+			return h;
+		}
+		default: {}
+	}
+	HASH_COMBINE(h, SIZE);
+	for(size_t i = 0; i < SIZE; i++) {
+		HASH_COMBINE(h, CHILD(i).structuralHash());
+	}
+	return h;
+}
 bool MathStructure::equals(const Number &o, bool allow_interval, bool allow_infinite) const {
 	if(m_type != STRUCT_NUMBER) return false;
 	return o_number.equals(o, allow_interval, allow_infinite);
@@ -2010,7 +2174,7 @@ bool MathStructure::equals(Variable *v) const {
 }
 bool MathStructure::equals(string sym) const {
 	if(m_type != STRUCT_SYMBOLIC) return false;
-	return s_sym == sym;
+	return symbol() == sym;
 }
 
 bool remove_rad_unit_cf(MathStructure &m) {
@@ -2439,6 +2603,9 @@ void MathStructure::childToFront(size_t index) {
 void MathStructure::addChild(const MathStructure &o) {
 	APPEND(o);
 }
+void MathStructure::addChild(MathStructure &&o) {
+	APPEND_POINTER(new MathStructure(std::move(o)));
+}
 void MathStructure::addChild_nocopy(MathStructure *o) {
 	APPEND_POINTER(o);
 }
@@ -2453,8 +2620,7 @@ void MathStructure::delChild(size_t index, bool check_size) {
 }
 void MathStructure::insertChild(const MathStructure &o, size_t index) {
 	if(index > 0 && index <= v_subs.size()) {
-		v_order.insert(v_order.begin() + (index - 1), v_subs.size());
-		v_subs.push_back(new MathStructure(o));
+		v_subs.insert(v_subs.begin() + (index - 1), new MathStructure(o));
 		CHILD_UPDATED(index - 1);
 	} else {
 		addChild(o);
@@ -2462,8 +2628,7 @@ void MathStructure::insertChild(const MathStructure &o, size_t index) {
 }
 void MathStructure::insertChild_nocopy(MathStructure *o, size_t index) {
 	if(index > 0 && index <= v_subs.size()) {
-		v_order.insert(v_order.begin() + (index - 1), v_subs.size());
-		v_subs.push_back(o);
+		v_subs.insert(v_subs.begin() + (index - 1), o);
 		CHILD_UPDATED(index - 1);
 	} else {
 		addChild_nocopy(o);
@@ -2477,24 +2642,24 @@ void MathStructure::setChild(const MathStructure &o, size_t index, bool merge_pr
 }
 void MathStructure::setChild_nocopy(MathStructure *o, size_t index, bool merge_precision) {
 	if(index > 0 && index <= SIZE) {
-		MathStructure *o_prev = v_subs[v_order[index - 1]];
+		MathStructure *o_prev = v_subs[index - 1];
 		if(merge_precision) {
 			if(!o->isApproximate() && o_prev->isApproximate()) o->setApproximate(true);
 			if(o_prev->precision() >= 0 && (o->precision() < 0 || o_prev->precision() < o->precision())) o->setPrecision(o_prev->precision());
 		}
 		o_prev->unref();
-		v_subs[v_order[index - 1]] = o;
+		v_subs[index - 1] = o;
 		CHILD_UPDATED(index - 1);
 	}
 }
 const MathStructure *MathStructure::getChild(size_t index) const {
-	if(index > 0 && index <= v_order.size()) {
+	if(index > 0 && index <= SIZE) {
 		return &CHILD(index - 1);
 	}
 	return NULL;
 }
 MathStructure *MathStructure::getChild(size_t index) {
-	if(index > 0 && index <= v_order.size()) {
+	if(index > 0 && index <= SIZE) {
 		return &CHILD(index - 1);
 	}
 	return NULL;
@@ -154,27 +154,23 @@ class MathStructure {
 
 		size_t i_ref;
 
-		StructureType m_type;
-		bool b_approx;
-		int i_precision;
-
 		std::vector<MathStructure*> v_subs;
-		std::vector<size_t> v_order;
-		std::string s_sym;
 		Number o_number;
-		Variable *o_variable;
+		std::string *s_sym;
 
+		Variable *o_variable;
 		Unit *o_unit;
 		Prefix *o_prefix;
-		bool b_plural;
-
 		MathFunction *o_function;
 		MathStructure *function_value;
 		QalculateDateTime *o_datetime;
 
+		StructureType m_type;
 		ComparisonType ct_comp;
+		int i_precision;
+		bool b_approx;
+		bool b_plural;
 		bool b_protected;
-
 		bool b_parentheses;
 
 		bool isolate_x_sub(const EvaluationOptions &eo, EvaluationOptions &eo2, const MathStructure &x_var, MathStructure *morig = NULL);
@@ -182,6 +178,7 @@ class MathStructure {
 		bool isolate_x(const EvaluationOptions &eo, const EvaluationOptions &feo, const MathStructure &x_var, bool check_result, size_t depth);
 
 		bool calculateFunctions(const EvaluationOptions &eo, bool recursive, bool do_unformat, size_t depth);
+		bool merge_like_terms(const EvaluationOptions &eo, bool &b_merged);
 
 		void init();
 
@@ -198,6 +195,12 @@ class MathStructure {
 		* @param o The structure to copy.
 		*/
 		MathStructure(const MathStructure &o);
+		/** Create a structure taking over the content and child structures of another structure. The other structure is left as zero.
+		*
+		* @param o The structure to move.
+		* \since 5.12.0
+		*/
+		MathStructure(MathStructure &&o);
 		/** Create a new numeric structure (value=num/den*10^exp10). Equivalent to MathStructure(Number(num, den, exp10)).
 		*
 		* @param num The numerator of the numeric value.
@@ -253,6 +256,15 @@ class MathStructure {
 		~MathStructure();
 		//@}
 
+		/** @name Memory allocation */
+		//@{
+		/** Allocates memory for a new structure. Memory of deleted structures is kept for reuse by the same thread until the current calculation ends.
+		* \since 5.12.0
+		*/
+		static void *operator new(size_t size);
+		static void operator delete(void *ptr, size_t size);
+		//@}
+
 		/** @name Functions/operators for setting type and content */
 		//@{
 		/** Set the structure to a copy of another structure. Child structures are copied.
@@ -261,6 +273,13 @@ class MathStructure {
 		* @param merge_precision Preserve the current precision (unless the new value has a lower precision).
 		*/
 		void set(const MathStructure &o, bool merge_precision = false);
+		/** Set the structure to the content of another structure, without copying child structures. The other structure is left as zero.
+		*
+		* @param o The structure to move.
+		* @param merge_precision Preserve the current precision (unless the new value has a lower precision).
+		* \since 5.12.0
+		*/
+		void set(MathStructure &&o, bool merge_precision = false);
 		/** Set the structure to a copy of another structure. Pointers to child structures are copied.
 		*
 		* @param o The structure to copy.
@@ -360,6 +379,7 @@ class MathStructure {
 		void setType(StructureType mtype);
 
 		void operator = (const MathStructure &o);
+		void operator = (MathStructure &&o);
 		void operator = (const Number &o);
 		void operator = (int i);
 		void operator = (Unit *u);
@@ -447,6 +467,7 @@ class MathStructure {
 		void swapChildren(size_t index1, size_t index2);
 		void childToFront(size_t index);
 		void addChild(const MathStructure &o);
+		void addChild(MathStructure &&o);
 		void addChild_nocopy(MathStructure *o);
 		void delChild(size_t index, bool check_size = false);
 		void insertChild(const MathStructure &o, size_t index);
@@ -675,6 +696,15 @@ class MathStructure {
 		bool equals(Variable *v) const;
 		bool equals(std::string sym) const;
 
+		/** Returns a hash value computed from the structure and its children. Structures that are equal according to equals() (with default arguments) always have the same hash value, while different hash values mean that the structures are not equal. Use to avoid repeated pairwise comparisons of large structures.
+		*
+		* The hash value is not cached and a call traverses the whole structure.
+		*
+		* @returns Structural hash value.
+		* \since 5.12.0
+		*/
+		size_t structuralHash() const;
+
 		ComparisonResult compare(const MathStructure &o) const;
 		ComparisonResult compareApproximately(const MathStructure &o, const EvaluationOptions &eo = default_evaluation_options) const;
 
@@ -721,10 +751,12 @@ class MathStructure {
 		bool calculateMultiplyLast(const EvaluationOptions &eo, bool check_size = true, MathStructure *mparent = NULL, size_t index_this = 1);
 		bool calculateMultiplyIndex(size_t index, const EvaluationOptions &eo, bool check_size = true, MathStructure *mparent = NULL, size_t index_this = 1);
 		bool calculateMultiply(const MathStructure &mmul, const EvaluationOptions &eo, MathStructure *mparent = NULL, size_t index_this = 1);
+		bool calculateMultiply(MathStructure &&mmul, const EvaluationOptions &eo, MathStructure *mparent = NULL, size_t index_this = 1);
 		bool calculateDivide(const MathStructure &mdiv, const EvaluationOptions &eo, MathStructure *mparent = NULL, size_t index_this = 1);
 		bool calculateAddLast(const EvaluationOptions &eo, bool check_size = true, MathStructure *mparent = NULL, size_t index_this = 1);
 		bool calculateAddIndex(size_t index, const EvaluationOptions &eo, bool check_size = true, MathStructure *mparent = NULL, size_t index_this = 1);
 		bool calculateAdd(const MathStructure &madd, const EvaluationOptions &eo, MathStructure *mparent = NULL, size_t index_this = 1);
+		bool calculateAdd(MathStructure &&madd, const EvaluationOptions &eo, MathStructure *mparent = NULL, size_t index_this = 1);
 		bool calculateSubtract(const MathStructure &msub, const EvaluationOptions &eo, MathStructure *mparent = NULL, size_t index_this = 1);
 		bool calculateFunctions(const EvaluationOptions &eo, bool recursive = true, bool do_unformat = true);
 		int merge_addition(MathStructure &mstruct, const EvaluationOptions &eo, MathStructure *mparent = NULL, size_t index_this = 1, size_t index_that = 2, bool reversed = false);
@@ -15,5 +15,29 @@
 class MathStructure_p {
 };
 
+// list of freed memory blocks of a fixed size (used for MathStructure and Number), reused by later allocations in the same thread
+// trivially destructible, so that the thread local pools can still be accessed when other objects are destroyed at thread exit (the blocks are freed by a separate thread local object)
+class NodePool {
+	protected:
+		struct FreeNode {
+			FreeNode *next;
+		};
+		size_t node_size;
+		FreeNode *free_nodes;
+		size_t n_free;
+	public:
+		constexpr NodePool(size_t size) : node_size(size), free_nodes(NULL), n_free(0) {}
+		void *allocate(size_t size);
+		void release(void *ptr, size_t size);
+		// frees all unused blocks
+		void clear();
+};
+
+extern thread_local NodePool mathstructure_pool;
+extern thread_local NodePool number_pool;
+
+// frees unused blocks of the node pools of the current thread (called when a calculation ends)
+void clear_node_pools();
+
 
 #endif
@@ -21,7 +21,10 @@
 #include <limits.h>
 #include <sstream>
 #include <string.h>
+#include <algorithm>
+#include <utility>
 #include "util.h"
+#include "MathStructure_p.h"
 
 using std::string;
 using std::cout;
@@ -43,6 +46,10 @@ using std::endl;
 
 #define CREATE_INTERVAL (CALCULATOR ? CALCULATOR->usesIntervalArithmetic() : true)
 
+// real, non-interval floating point value (and operand), and interval arithmetic deactivated (see testPointFloatResult())
+#define POINT_FLOAT_VALUE (n_type == NUMBER_TYPE_FLOAT && !CREATE_INTERVAL && !hasImaginaryPart() && mpfr_get_prec(fl_value) == mpfr_get_prec(fu_value) && !isInterval())
+#define POINT_FLOAT_OPERATION(o) (POINT_FLOAT_VALUE && !o.hasImaginaryPart() && (o.isRational() || (o.isFloatingPoint() && !o.isInterval())))
+
 #define INTERVAL_FLOOR(x) x.floor(); if(x.isInterval()) {x = x.lowerEndPoint(); x.floor();}
 #define INTERVAL_CEIL(x) x.ceil(); if(x.isInterval()) {x = x.upperEndPoint(); x.ceil();}
 
@@ -56,6 +63,50 @@ RoundingMode get_rounding_mode(const PrintOptions &po) {
 	return po.rounding;
 }
 
+// machine word fast paths for rational arithmetic: operands that are integers fitting in an int are combined using long long int, and the result is stored directly if it fits in a long int
+#define IS_SMALL_INTEGER(q) (mpz_cmp_ui(mpq_denref(q), 1) == 0 && mpz_fits_sint_p(mpq_numref(q)))
+
+void rational_add(mpq_ptr r, mpq_srcptr a, mpq_srcptr b) {
+	if(IS_SMALL_INTEGER(a) && IS_SMALL_INTEGER(b)) {
+		long long int l = (long long int) mpz_get_si(mpq_numref(a)) + mpz_get_si(mpq_numref(b));
+		if(l >= LONG_MIN && l <= LONG_MAX) {
+			mpz_set_si(mpq_numref(r), (long int) l);
+			mpz_set_ui(mpq_denref(r), 1);
+			return;
+		}
+	}
+	mpq_add(r, a, b);
+}
+void rational_sub(mpq_ptr r, mpq_srcptr a, mpq_srcptr b) {
+	if(IS_SMALL_INTEGER(a) && IS_SMALL_INTEGER(b)) {
+		long long int l = (long long int) mpz_get_si(mpq_numref(a)) - mpz_get_si(mpq_numref(b));
+		if(l >= LONG_MIN && l <= LONG_MAX) {
+			mpz_set_si(mpq_numref(r), (long int) l);
+			mpz_set_ui(mpq_denref(r), 1);
+			return;
+		}
+	}
+	mpq_sub(r, a, b);
+}
+void rational_mul(mpq_ptr r, mpq_srcptr a, mpq_srcptr b) {
+	if(IS_SMALL_INTEGER(a) && IS_SMALL_INTEGER(b)) {
+		long long int l = (long long int) mpz_get_si(mpq_numref(a)) * mpz_get_si(mpq_numref(b));
+		if(l >= LONG_MIN && l <= LONG_MAX) {
+			mpz_set_si(mpq_numref(r), (long int) l);
+			mpz_set_ui(mpq_denref(r), 1);
+			return;
+		}
+	}
+	mpq_mul(r, a, b);
+}
+int rational_cmp(mpq_srcptr a, mpq_srcptr b) {
+	if(IS_SMALL_INTEGER(a) && IS_SMALL_INTEGER(b)) {
+		long int la = mpz_get_si(mpq_numref(a)), lb = mpz_get_si(mpq_numref(b));
+		return la < lb ? -1 : (la > lb ? 1 : 0);
+	}
+	return mpq_cmp(a, b);
+}
+
 
 gmp_randstate_t randstate;
 bool randstate_initialized = false;
@@ -442,6 +493,13 @@ string printMPZ(mpz_srcptr integ_pre, int base = 10, bool display_sign = true, b
 	return str;
 }
 
+void *Number::operator new(size_t size) {
+	return number_pool.allocate(size);
+}
+void Number::operator delete(void *ptr, size_t size) {
+	number_pool.release(ptr, size);
+}
+
 Number::Number() {
 	b_imag = false;
 	i_value = NULL;
@@ -470,6 +528,13 @@ Number::Number(const Number &o) {
 	mpq_init(r_value);
 	set(o);
 }
+Number::Number(Number &&o) {
+	b_imag = false;
+	i_value = NULL;
+	n_type = NUMBER_TYPE_RATIONAL;
+	mpq_init(r_value);
+	*this = std::move(o);
+}
 Number::~Number() {
 	mpq_clear(r_value);
 	if(n_type == NUMBER_TYPE_FLOAT) mpfr_clears(fu_value, fl_value, NULL);
@@ -1251,7 +1316,7 @@ void Number::set(long int numerator, long int denominator, long int exp_10, bool
 		numerator = -numerator;
 	}
 	mpq_set_si(r_value, numerator, denominator == 0 ? 1 : denominator);
-	mpq_canonicalize(r_value);
+	if(denominator > 1) mpq_canonicalize(r_value);
 	if(n_type == NUMBER_TYPE_FLOAT) mpfr_clears(fu_value, fl_value, NULL);
 	n_type = NUMBER_TYPE_RATIONAL;
 	if(exp_10 != 0) {
@@ -2105,6 +2170,32 @@ Number Number::complexDenominator() const {
 }
 
 void Number::operator = (const Number &o) {set(o);}
+void Number::operator = (Number &&o) {
+	if(&o == this) return;
+	// set() rounds floating point values to the current precision
+	if(b_imag || (o.internalType() == NUMBER_TYPE_FLOAT && mpfr_get_prec(o.internalLowerFloat()) != BIT_PRECISION) || (o.hasImaginaryPart() && o.internalImaginary()->internalType() == NUMBER_TYPE_FLOAT && mpfr_get_prec(o.internalImaginary()->internalLowerFloat()) != BIT_PRECISION)) {
+		set(o);
+		return;
+	}
+	if(n_type == NUMBER_TYPE_FLOAT) mpfr_clears(fu_value, fl_value, NULL);
+	mpq_swap(r_value, o.r_value);
+	if(o.n_type == NUMBER_TYPE_FLOAT) {
+		mpfr_swap(fu_value, o.fu_value);
+		mpfr_swap(fl_value, o.fl_value);
+	}
+	n_type = o.n_type;
+	o.n_type = NUMBER_TYPE_RATIONAL;
+	b_approx = o.isApproximate();
+	i_precision = o.precision();
+	if(o.hasImaginaryPart()) {
+		Number *i_bak = i_value;
+		i_value = o.i_value;
+		o.i_value = i_bak;
+		setPrecisionAndApproximateFrom(*i_value);
+	} else if(i_value) {
+		i_value->clear();
+	}
+}
 void Number::operator = (long int i) {set(i, 1);}
 void Number::operator -- (int) {
 	if(n_type == NUMBER_TYPE_RATIONAL) {
@@ -2414,6 +2505,22 @@ bool Number::testFloatResult(bool allow_infinite_result, int error_level, bool t
 	if(!b_imag) testComplex(this, i_value);
 	return true;
 }
+bool Number::testPointFloatResult() {
+	// fast path for operations on non-interval floating point values: the result is stored in fu_value and the original value is still available in fl_value, which makes a backup copy of the number unnecessary
+	// returns false, after restoring fu_value, if the result is not a normal number; the operation should then be repeated using the generic code path
+	if(mpfr_underflow_p() || mpfr_overflow_p() || mpfr_divby0_p() || mpfr_erangeflag_p() || mpfr_nanflag_p() || !mpfr_number_p(fu_value)) {
+		mpfr_set(fu_value, fl_value, MPFR_RNDN);
+		return false;
+	}
+	if(mpfr_inexflag_p()) {
+		b_approx = true;
+		if(i_precision < 0 || i_precision > FROM_BIT_PRECISION(BIT_PRECISION)) i_precision = FROM_BIT_PRECISION(BIT_PRECISION);
+	}
+	mpfr_clear_flags();
+	mpfr_set(fl_value, fu_value, MPFR_RNDN);
+	testInteger();
+	return true;
+}
 void Number::testInteger() {
 	if(isFloatingPoint()) {
 		if(mpfr_equal_p(fu_value, fl_value)) {
@@ -2623,7 +2730,7 @@ bool Number::equals(const Number &o, bool allow_interval, bool allow_infinite) c
 		if(o.isFloatingPoint()) return (allow_interval || mpfr_equal_p(fu_value, fl_value)) && mpfr_equal_p(fl_value, o.internalLowerFloat()) && mpfr_equal_p(fu_value, o.internalUpperFloat());
 		else return mpfr_cmp_q(fu_value, o.internalRational()) == 0 && mpfr_cmp_q(fl_value, o.internalRational()) == 0;
 	}
-	return mpq_cmp(r_value, o.internalRational()) == 0;
+	return mpq_equal(r_value, o.internalRational()) != 0;
 }
 bool Number::equals(long int i) const {
 	if(hasImaginaryPart()) return false;
@@ -2748,6 +2855,12 @@ int Number::equalsApproximately(const Number &o, int prec) const {
 }
 ComparisonResult Number::compare(long int i) const {return compare(Number(i, 1));}
 ComparisonResult Number::compare(const Number &o, bool ignore_imag) const {
+	if(n_type == NUMBER_TYPE_RATIONAL && o.internalType() == NUMBER_TYPE_RATIONAL && ((!hasImaginaryPart() && !o.hasImaginaryPart()) || ignore_imag)) {
+		int i = rational_cmp(o.internalRational(), r_value);
+		if(i == 0) return COMPARISON_RESULT_EQUAL;
+		else if(i > 0) return COMPARISON_RESULT_GREATER;
+		else return COMPARISON_RESULT_LESS;
+	}
 	if(isPlusInfinity()) {
 		if((!ignore_imag && o.hasImaginaryPart()) || o.includesPlusInfinity()) return COMPARISON_RESULT_UNKNOWN;
 		else return COMPARISON_RESULT_LESS;
@@ -2796,7 +2909,7 @@ ComparisonResult Number::compare(const Number &o, bool ignore_imag) const {
 				if(i != i2) return COMPARISON_RESULT_CONTAINED;
 			}
 		} else {
-			i = mpq_cmp(o.internalRational(), r_value);
+			i = rational_cmp(o.internalRational(), r_value);
 			i2 = i;
 		}
 		if(i2 == 0 || i == 0) {
@@ -2903,7 +3016,7 @@ ComparisonResult Number::compareApproximately(const Number &o, int prec) const {
 				if(i != i2) return COMPARISON_RESULT_CONTAINED;
 			}
 		} else {
-			i = mpq_cmp(o.internalRational(), r_value);
+			i = rational_cmp(o.internalRational(), r_value);
 			i2 = i;
 		}
 		if(i2 == 0 || i == 0) {
@@ -3110,13 +3223,22 @@ int Number::integerLength() const {
 
 
 bool Number::add(const Number &o) {
+	if(POINT_FLOAT_OPERATION(o) && (o.isFloatingPoint() || mpfr_get_exp(fl_value) <= 1000000L || mpz_cmp_ui(mpq_denref(o.internalRational()), 1) == 0)) {
+		mpfr_clear_flags();
+		if(o.isFloatingPoint()) mpfr_add(fu_value, fl_value, o.internalLowerFloat(), MPFR_RNDN);
+		else mpfr_add_q(fu_value, fl_value, o.internalRational(), MPFR_RNDN);
+		if(testPointFloatResult()) {
+			setPrecisionAndApproximateFrom(o);
+			return true;
+		}
+	}
 	if(n_type == NUMBER_TYPE_RATIONAL && o.realPartIsRational()) {
 		if(o.hasImaginaryPart()) {
 			if(!i_value) {i_value = new Number(*o.internalImaginary()); i_value->markAsImaginaryPart();}
 			else if(!i_value->add(*o.internalImaginary())) return false;
 			setPrecisionAndApproximateFrom(*i_value);
 		}
-		mpq_add(r_value, r_value, o.internalRational());
+		rational_add(r_value, r_value, o.internalRational());
 		setPrecisionAndApproximateFrom(o);
 		return true;
 	}
@@ -3218,13 +3340,22 @@ bool Number::add(long int i) {
 }
 
 bool Number::subtract(const Number &o) {
+	if(POINT_FLOAT_OPERATION(o) && (o.isFloatingPoint() || mpfr_get_exp(fl_value) <= 1000000L || mpz_cmp_ui(mpq_denref(o.internalRational()), 1) == 0)) {
+		mpfr_clear_flags();
+		if(o.isFloatingPoint()) mpfr_sub(fu_value, fl_value, o.internalLowerFloat(), MPFR_RNDN);
+		else mpfr_sub_q(fu_value, fl_value, o.internalRational(), MPFR_RNDN);
+		if(testPointFloatResult()) {
+			setPrecisionAndApproximateFrom(o);
+			return true;
+		}
+	}
 	if(n_type == NUMBER_TYPE_RATIONAL && o.realPartIsRational()) {
 		if(o.hasImaginaryPart()) {
 			if(!i_value) {i_value = new Number(); i_value->markAsImaginaryPart();}
 			if(!i_value->subtract(*o.internalImaginary())) return false;
 			setPrecisionAndApproximateFrom(*i_value);
 		}
-		mpq_sub(r_value, r_value, o.internalRational());
+		rational_sub(r_value, r_value, o.internalRational());
 		setPrecisionAndApproximateFrom(o);
 		return true;
 	}
@@ -3329,11 +3460,75 @@ bool Number::subtract(long int i) {
 }
 
 bool Number::multiply(const Number &o) {
+	if(POINT_FLOAT_OPERATION(o) && !mpfr_zero_p(fl_value) && !o.isZero()) {
+		mpfr_clear_flags();
+		if(o.isFloatingPoint()) mpfr_mul(fu_value, fl_value, o.internalLowerFloat(), MPFR_RNDN);
+		else mpfr_mul_q(fu_value, fl_value, o.internalRational(), MPFR_RNDN);
+		if(testPointFloatResult()) {
+			setPrecisionAndApproximateFrom(o);
+			return true;
+		}
+	}
 	if(o.hasImaginaryPart()) {
 		if(o.hasRealPart()) {
 			Number nr_copy;
 			if(hasImaginaryPart()) {
 				if(hasRealPart()) {
+					// (a+bi)(c+di) = (ac-bd)+(ad+bc)i
+					Number *o_imag = o.internalImaginary();
+					if(n_type == NUMBER_TYPE_RATIONAL && i_value->internalType() == NUMBER_TYPE_RATIONAL && o.internalType() == NUMBER_TYPE_RATIONAL && o_imag->internalType() == NUMBER_TYPE_RATIONAL) {
+						// exact values: calculate directly without temporary numbers
+						mpq_t q_tmp1, q_tmp2;
+						mpq_init(q_tmp1);
+						mpq_init(q_tmp2);
+						rational_mul(q_tmp1, r_value, o.internalRational());
+						rational_mul(q_tmp2, i_value->internalRational(), o_imag->internalRational());
+						rational_sub(q_tmp1, q_tmp1, q_tmp2);
+						rational_mul(q_tmp2, r_value, o_imag->internalRational());
+						rational_mul(i_value->internalRational(), i_value->internalRational(), o.internalRational());
+						rational_add(i_value->internalRational(), i_value->internalRational(), q_tmp2);
+						mpq_swap(r_value, q_tmp1);
+						mpq_clear(q_tmp1);
+						mpq_clear(q_tmp2);
+						setPrecisionAndApproximateFrom(o);
+						i_value->setPrecisionAndApproximateFrom(*this);
+						setPrecisionAndApproximateFrom(*i_value);
+						return true;
+					}
+					if(n_type == NUMBER_TYPE_FLOAT && i_value->internalType() == NUMBER_TYPE_FLOAT && o.internalType() == NUMBER_TYPE_FLOAT && o_imag->internalType() == NUMBER_TYPE_FLOAT && !CREATE_INTERVAL && !isInterval(false) && !o.isInterval(false) && mpfr_get_prec(fl_value) == mpfr_get_prec(fu_value) && mpfr_get_prec(i_value->internalLowerFloat()) == mpfr_get_prec(i_value->internalUpperFloat())) {
+						// non-interval floating point values: calculate using four mpfr_t temporaries, with the same rounding as the generic code below, and without backup copies
+						mpfr_t f_tmp1, f_tmp2, f_r, f_i;
+						mpfr_inits2(BIT_PRECISION, f_tmp1, f_tmp2, f_r, f_i, NULL);
+						mpfr_clear_flags();
+						mpfr_mul(f_tmp1, fl_value, o.internalLowerFloat(), MPFR_RNDN);
+						mpfr_mul(f_tmp2, i_value->internalLowerFloat(), o_imag->internalLowerFloat(), MPFR_RNDN);
+						mpfr_sub(f_r, f_tmp1, f_tmp2, MPFR_RNDN);
+						mpfr_mul(f_tmp1, i_value->internalLowerFloat(), o.internalLowerFloat(), MPFR_RNDN);
+						mpfr_mul(f_tmp2, fl_value, o_imag->internalLowerFloat(), MPFR_RNDN);
+						mpfr_add(f_i, f_tmp1, f_tmp2, MPFR_RNDN);
+						bool b_valid = !mpfr_underflow_p() && !mpfr_overflow_p() && !mpfr_erangeflag_p() && !mpfr_nanflag_p() && mpfr_number_p(f_r) && mpfr_number_p(f_i);
+						if(b_valid) {
+							if(mpfr_inexflag_p()) {
+								b_approx = true;
+								if(i_precision < 0 || i_precision > FROM_BIT_PRECISION(BIT_PRECISION)) i_precision = FROM_BIT_PRECISION(BIT_PRECISION);
+							}
+							mpfr_set(fl_value, f_r, MPFR_RNDN);
+							mpfr_set(fu_value, fl_value, MPFR_RNDN);
+							mpfr_set(i_value->internalLowerFloat(), f_i, MPFR_RNDN);
+							mpfr_set(i_value->internalUpperFloat(), i_value->internalLowerFloat(), MPFR_RNDN);
+						}
+						mpfr_clears(f_tmp1, f_tmp2, f_r, f_i, NULL);
+						mpfr_clear_flags();
+						if(b_valid) {
+							testInteger();
+							i_value->testInteger();
+							setPrecisionAndApproximateFrom(o);
+							i_value->setPrecisionAndApproximateFrom(*this);
+							setPrecisionAndApproximateFrom(*i_value);
+							testComplex(this, i_value);
+							return true;
+						}
+					}
 					Number nr_real;
 					nr_real.set(*this, false, true);
 					nr_copy.set(*i_value);
@@ -3530,7 +3725,7 @@ bool Number::multiply(const Number &o) {
 			if(!i_value->multiply(o)) return false;
 			setPrecisionAndApproximateFrom(*i_value);
 		}
-		mpq_mul(r_value, r_value, o.internalRational());
+		rational_mul(r_value, r_value, o.internalRational());
 	}
 	setPrecisionAndApproximateFrom(o);
 	return true;
@@ -3582,16 +3777,28 @@ bool Number::multiply(long int i) {
 			if(!i_value->multiply(i)) return false;
 			setPrecisionAndApproximateFrom(*i_value);
 		}
-		mpq_t r_i;
-		mpq_init(r_i);
-		mpz_set_si(mpq_numref(r_i), i);
-		mpq_mul(r_value, r_value, r_i);
-		mpq_clear(r_i);
+		if(mpz_cmp_ui(mpq_denref(r_value), 1) == 0) {
+			mpz_mul_si(mpq_numref(r_value), mpq_numref(r_value), i);
+		} else {
+			mpq_t r_i;
+			mpq_init(r_i);
+			mpz_set_si(mpq_numref(r_i), i);
+			mpq_mul(r_value, r_value, r_i);
+			mpq_clear(r_i);
+		}
 	}
 	return true;
 }
 
 bool Number::divide(const Number &o) {
+	if(POINT_FLOAT_OPERATION(o) && o.isInteger() && !mpfr_zero_p(fl_value) && !o.isZero()) {
+		mpfr_clear_flags();
+		mpfr_div_z(fu_value, fl_value, mpq_numref(o.internalRational()), MPFR_RNDN);
+		if(testPointFloatResult()) {
+			setPrecisionAndApproximateFrom(o);
+			return true;
+		}
+	}
 	if(isInfinite() || o.isInfinite() || o.hasImaginaryPart() || o.isFloatingPoint() || n_type == NUMBER_TYPE_FLOAT) {
 		Number oinv(o);
 		if(!oinv.recip()) return false;
@@ -3789,6 +3996,20 @@ bool Number::recip() {
 					return false;
 				}
 				return true;
+			} else if(n_type == NUMBER_TYPE_RATIONAL && i_value->internalType() == NUMBER_TYPE_RATIONAL) {
+				// 1/(a+bi) = (a-bi)/(a^2+b^2)
+				mpq_t q_den, q_tmp;
+				mpq_init(q_den);
+				mpq_init(q_tmp);
+				mpq_mul(q_den, r_value, r_value);
+				mpq_mul(q_tmp, i_value->internalRational(), i_value->internalRational());
+				mpq_add(q_den, q_den, q_tmp);
+				mpq_div(r_value, r_value, q_den);
+				mpq_div(i_value->internalRational(), i_value->internalRational(), q_den);
+				mpq_neg(i_value->internalRational(), i_value->internalRational());
+				mpq_clear(q_den);
+				mpq_clear(q_tmp);
+				setPrecisionAndApproximateFrom(*i_value);
 			} else {
 				Number den1(*i_value);
 				Number den2;
@@ -4419,6 +4640,11 @@ bool Number::sqrt() {
 			return true;
 		}
 	}
+	if(POINT_FLOAT_VALUE && mpfr_sgn(fl_value) > 0) {
+		mpfr_clear_flags();
+		mpfr_sqrt(fu_value, fl_value, MPFR_RNDN);
+		if(testPointFloatResult()) return true;
+	}
 	Number nr_bak(*this);
 	if(!setToFloatingPoint()) return false;
 	mpfr_clear_flags();
@@ -7727,6 +7953,11 @@ bool Number::exp() {
 		set(e_base);
 		return true;
 	}
+	if(POINT_FLOAT_VALUE) {
+		mpfr_clear_flags();
+		mpfr_exp(fu_value, fl_value, MPFR_RNDN);
+		if(testPointFloatResult()) return true;
+	}
 	Number nr_bak(*this);
 	if(!setToFloatingPoint()) return false;
 	mpfr_clear_flags();
@@ -10158,6 +10389,269 @@ bool Number::binomial(const Number &m, const Number &k) {
 	return true;
 }
 
+#define FACTORIZE_TRIAL_DIVISION_LIMIT 100000L
+
+void sieve_primes(vector<bool> &is_prime, unsigned long int limit) {
+	is_prime.assign(limit + 1, true);
+	is_prime[0] = false;
+	if(limit >= 1) is_prime[1] = false;
+	for(unsigned long int i = 2; i * i <= limit; i++) {
+		if(is_prime[i]) {
+			for(unsigned long int i2 = i * i; i2 <= limit; i2 += i) is_prime[i2] = false;
+		}
+	}
+}
+
+// Pollard's rho with Brent's cycle detection and batched gcd
+bool integer_factor_rho(mpz_t d, const mpz_t n, unsigned long int c, unsigned long int max_iterations) {
+	mpz_t x, y, ys, q, t;
+	mpz_inits(x, y, ys, q, t, NULL);
+	mpz_set_ui(y, 2);
+	mpz_set_ui(q, 1);
+	mpz_set_ui(d, 1);
+	unsigned long int r = 1, m = 128;
+	while(mpz_cmp_ui(d, 1) == 0 && r <= max_iterations) {
+		if(CALCULATOR->aborted()) break;
+		mpz_set(x, y);
+		for(unsigned long int i = 0; i < r; i++) {
+			mpz_mul(y, y, y); mpz_add_ui(y, y, c); mpz_mod(y, y, n);
+		}
+		for(unsigned long int k = 0; k < r && mpz_cmp_ui(d, 1) == 0; k += m) {
+			mpz_set(ys, y);
+			for(unsigned long int i = 0; i < m && i < r - k; i++) {
+				mpz_mul(y, y, y); mpz_add_ui(y, y, c); mpz_mod(y, y, n);
+				mpz_sub(t, x, y);
+				mpz_mul(q, q, t); mpz_mod(q, q, n);
+			}
+			mpz_gcd(d, q, n);
+		}
+		r *= 2;
+	}
+	if(mpz_cmp(d, n) == 0) {
+		// backtrack from the last saved value
+		do {
+			mpz_mul(ys, ys, ys); mpz_add_ui(ys, ys, c); mpz_mod(ys, ys, n);
+			mpz_sub(t, x, ys);
+			mpz_gcd(d, t, n);
+		} while(mpz_cmp_ui(d, 1) == 0);
+	}
+	mpz_clears(x, y, ys, q, t, NULL);
+	return mpz_cmp_ui(d, 1) > 0 && mpz_cmp(d, n) < 0;
+}
+
+// Pollard's p - 1 method (stage 1)
+bool integer_factor_pm1(mpz_t d, const mpz_t n, const vector<bool> &is_prime, unsigned long int b1) {
+	mpz_t a;
+	mpz_init_set_ui(a, 2);
+	for(unsigned long int p = 2; p <= b1; p++) {
+		if(!is_prime[p]) continue;
+		if(p % 1000 == 1 && CALCULATOR->aborted()) break;
+		unsigned long int q = p;
+		while(q <= b1 / p) q *= p;
+		mpz_powm_ui(a, a, q, n);
+	}
+	mpz_sub_ui(a, a, 1);
+	mpz_gcd(d, a, n);
+	mpz_clear(a);
+	return mpz_cmp_ui(d, 1) > 0 && mpz_cmp(d, n) < 0;
+}
+
+// x-only arithmetic on a Montgomery curve, By^2 = x^3 + Ax^2 + x, with projective coordinates (X:Z)
+class MontgomeryCurve {
+  public:
+	mpz_t n, a24, t1, t2, t3, t4;
+	MontgomeryCurve(const mpz_t n_mod) {
+		mpz_init_set(n, n_mod);
+		mpz_inits(a24, t1, t2, t3, t4, NULL);
+	}
+	~MontgomeryCurve() {
+		mpz_clears(n, a24, t1, t2, t3, t4, NULL);
+	}
+	void dbl(mpz_t X2, mpz_t Z2, const mpz_t X, const mpz_t Z) {
+		mpz_add(t1, X, Z); mpz_mul(t1, t1, t1); mpz_mod(t1, t1, n);
+		mpz_sub(t2, X, Z); mpz_mul(t2, t2, t2); mpz_mod(t2, t2, n);
+		mpz_sub(t3, t1, t2);
+		mpz_mul(X2, t1, t2); mpz_mod(X2, X2, n);
+		mpz_mul(t1, a24, t3); mpz_add(t1, t1, t2); mpz_mod(t1, t1, n);
+		mpz_mul(Z2, t3, t1); mpz_mod(Z2, Z2, n);
+	}
+	// (X3:Z3) = P + Q, with (Xd:Zd) = P - Q
+	void add(mpz_t X3, mpz_t Z3, const mpz_t XP, const mpz_t ZP, const mpz_t XQ, const mpz_t ZQ, const mpz_t Xd, const mpz_t Zd) {
+		mpz_sub(t1, XP, ZP); mpz_add(t2, XQ, ZQ); mpz_mul(t1, t1, t2); mpz_mod(t1, t1, n);
+		mpz_add(t2, XP, ZP); mpz_sub(t3, XQ, ZQ); mpz_mul(t2, t2, t3); mpz_mod(t2, t2, n);
+		mpz_add(t3, t1, t2); mpz_mul(t3, t3, t3); mpz_mod(t3, t3, n);
+		mpz_sub(t4, t1, t2); mpz_mul(t4, t4, t4); mpz_mod(t4, t4, n);
+		mpz_mul(t1, Zd, t3);
+		mpz_mul(Z3, Xd, t4); mpz_mod(Z3, Z3, n);
+		mpz_mod(X3, t1, n);
+	}
+	// (X:Z) = k(X:Z), using the Montgomery ladder
+	void mul(mpz_t X, mpz_t Z, unsigned long int k) {
+		if(k == 1) return;
+		mpz_t X0, Z0, X1, Z1;
+		mpz_init_set(X0, X); mpz_init_set(Z0, Z); mpz_inits(X1, Z1, NULL);
+		dbl(X1, Z1, X, Z);
+		int bit = 0;
+		while((k >> bit) > 1) bit++;
+		for(bit--; bit >= 0; bit--) {
+			if((k >> bit) & 1) {
+				add(X0, Z0, X1, Z1, X0, Z0, X, Z);
+				dbl(X1, Z1, X1, Z1);
+			} else {
+				add(X1, Z1, X1, Z1, X0, Z0, X, Z);
+				dbl(X0, Z0, X0, Z0);
+			}
+		}
+		mpz_set(X, X0); mpz_set(Z, Z0);
+		mpz_clears(X0, Z0, X1, Z1, NULL);
+	}
+};
+
+#define ECM_D 2310
+
+// Lenstra's elliptic curve method with Suyama's parametrization, a prime by prime stage 1 and a baby-step giant-step stage 2
+bool integer_factor_ecm_curve(mpz_t d, const mpz_t n, unsigned long int sigma, const vector<bool> &is_prime, unsigned long int b1, unsigned long int b2) {
+	MontgomeryCurve curve(n);
+	mpz_t u, v, X, Z, t;
+	mpz_inits(u, v, X, Z, t, NULL);
+	bool b = false;
+	// u = sigma^2 - 5, v = 4sigma, x = u^3 / v^3, a24 = (v - u)^3(3u + v) / (16u^3v)
+	mpz_set_ui(u, sigma); mpz_mul(u, u, u); mpz_sub_ui(u, u, 5); mpz_mod(u, u, n);
+	mpz_set_ui(v, sigma); mpz_mul_ui(v, v, 4); mpz_mod(v, v, n);
+	mpz_powm_ui(X, u, 3, n);
+	mpz_powm_ui(Z, v, 3, n);
+	mpz_sub(t, v, u); mpz_powm_ui(t, t, 3, n);
+	mpz_mul_ui(curve.a24, u, 3); mpz_add(curve.a24, curve.a24, v); mpz_mul(curve.a24, curve.a24, t);
+	mpz_mul(t, X, v); mpz_mul_ui(t, t, 16); mpz_mod(t, t, n);
+	if(!mpz_invert(t, t, n)) {
+		mpz_gcd(d, t, n);
+		b = mpz_cmp_ui(d, 1) > 0 && mpz_cmp(d, n) < 0;
+		mpz_clears(u, v, X, Z, t, NULL);
+		return b;
+	}
+	mpz_mul(curve.a24, curve.a24, t); mpz_mod(curve.a24, curve.a24, n);
+	for(unsigned long int p = 2; p <= b1; p++) {
+		if(!is_prime[p]) continue;
+		if(p % 1000 == 1 && CALCULATOR->aborted()) break;
+		unsigned long int q = p;
+		while(q <= b1 / p) q *= p;
+		curve.mul(X, Z, q);
+	}
+	mpz_gcd(d, Z, n);
+	if(mpz_cmp_ui(d, 1) == 0 && !CALCULATOR->aborted()) {
+		// stage 2: for each prime q = mD ± j, b1 < q <= b2, x(mDQ) = x(jQ) modulo the unknown factor if the order of Q divides q
+		vector<size_t> baby_j;
+		vector<mpz_t*> baby_X, baby_Z;
+		mpz_t X2, Z2, Xa, Za, Xb, Zb, Xc, Zc, g;
+		mpz_inits(X2, Z2, Xa, Za, Xb, Zb, Xc, Zc, g, NULL);
+		mpz_set_ui(g, 1);
+		curve.dbl(X2, Z2, X, Z);
+		// odd multiples jQ, j < D/2, coprime to D; (j + 2)Q = jQ + 2Q, with difference (j - 2)Q (x(-Q) = x(Q))
+		mpz_set(Xa, X); mpz_set(Za, Z);
+		mpz_set(Xb, X); mpz_set(Zb, Z);
+		for(size_t j = 1; j < ECM_D / 2; j += 2) {
+			if(j % 3 != 0 && j % 5 != 0 && j % 7 != 0 && j % 11 != 0) {
+				mpz_t *Xs = new mpz_t[1], *Zs = new mpz_t[1];
+				mpz_init_set(*Xs, Xa); mpz_init_set(*Zs, Za);
+				baby_j.push_back(j);
+				baby_X.push_back(Xs);
+				baby_Z.push_back(Zs);
+			}
+			curve.add(Xc, Zc, Xa, Za, X2, Z2, Xb, Zb);
+			mpz_swap(Xb, Xa); mpz_swap(Zb, Za);
+			mpz_swap(Xa, Xc); mpz_swap(Za, Zc);
+		}
+		// giant steps mDQ
+		unsigned long int m = b1 / ECM_D;
+		if(m < 1) m = 1;
+		mpz_set(Xc, X); mpz_set(Zc, Z); curve.mul(Xc, Zc, ECM_D);
+		mpz_set(Xa, X); mpz_set(Za, Z); curve.mul(Xa, Za, m * ECM_D);
+		mpz_set(Xb, X); mpz_set(Zb, Z); curve.mul(Xb, Zb, (m + 1) * ECM_D);
+		for(; m * ECM_D <= b2 + ECM_D; m++) {
+			if(m % 100 == 0 && CALCULATOR->aborted()) break;
+			for(size_t i = 0; i < baby_j.size(); i++) {
+				unsigned long int q1 = m * ECM_D - baby_j[i], q2 = m * ECM_D + baby_j[i];
+				if((q1 > b1 && q1 <= b2 && is_prime[q1]) || (q2 > b1 && q2 <= b2 && is_prime[q2])) {
+					mpz_mul(t, Xa, *baby_Z[i]);
+					mpz_submul(t, *baby_X[i], Za);
+					mpz_mul(g, g, t); mpz_mod(g, g, n);
+				}
+			}
+			curve.add(X2, Z2, Xb, Zb, Xc, Zc, Xa, Za);
+			mpz_swap(Xa, Xb); mpz_swap(Za, Zb);
+			mpz_swap(Xb, X2); mpz_swap(Zb, Z2);
+		}
+		mpz_gcd(d, g, n);
+		for(size_t i = 0; i < baby_j.size(); i++) {
+			mpz_clear(*baby_X[i]); mpz_clear(*baby_Z[i]);
+			delete[] baby_X[i]; delete[] baby_Z[i];
+		}
+		mpz_clears(X2, Z2, Xa, Za, Xb, Zb, Xc, Zc, g, NULL);
+	}
+	b = mpz_cmp_ui(d, 1) > 0 && mpz_cmp(d, n) < 0;
+	mpz_clears(u, v, X, Z, t, NULL);
+	return b;
+}
+
+// Finds a non-trivial factor of n, which must be composite and not a perfect power
+bool integer_find_factor(mpz_t d, const mpz_t n) {
+	// small factors are found fastest using Pollard's rho
+	if(integer_factor_rho(d, n, 1, 1 << 16)) return true;
+	if(CALCULATOR->aborted()) return false;
+	if(mpz_sizeinbase(n, 2) <= 64 && integer_factor_rho(d, n, 3, ULONG_MAX / 4)) return true;
+	// ECM with increasing bounds (optimal for factors of about 15, 20, 25, 30, 35 and 40 digits)
+	static const unsigned long int ecm_b1[] = {2000, 11000, 50000, 250000, 1000000, 3000000};
+	static const size_t ecm_curves[] = {25, 90, 300, 700, 1800, 5100};
+	vector<bool> is_prime;
+	unsigned long int sigma = 6;
+	for(size_t level = 0; ; level++) {
+		if(CALCULATOR->aborted()) return false;
+		unsigned long int b1 = ecm_b1[level < 6 ? level : 5], b2 = b1 * 50;
+		if(is_prime.size() <= b2) sieve_primes(is_prime, b2);
+		if(level == 0 && integer_factor_pm1(d, n, is_prime, b2)) return true;
+		for(size_t i = 0; i < ecm_curves[level < 6 ? level : 5]; i++) {
+			if(CALCULATOR->aborted()) return false;
+			if(integer_factor_ecm_curve(d, n, sigma, is_prime, b1, b2)) return true;
+			sigma++;
+		}
+	}
+	return false;
+}
+
+// Appends the prime factors of n (> 1) to factors, in no particular order
+bool integer_factorize_sub(const mpz_t n, vector<Number> &factors) {
+	if(mpz_probab_prime_p(n, 25)) {
+		Number fac;
+		fac.setInternal(n);
+		factors.push_back(fac);
+		return true;
+	}
+	mpz_t d;
+	mpz_init(d);
+	if(mpz_perfect_power_p(n)) {
+		for(unsigned long int k = 2; ; k++) {
+			if(mpz_root(d, n, k)) {
+				vector<Number> factors_root;
+				bool b = integer_factorize_sub(d, factors_root);
+				for(unsigned long int i = 0; b && i < k; i++) factors.insert(factors.end(), factors_root.begin(), factors_root.end());
+				mpz_clear(d);
+				return b;
+			}
+		}
+	}
+	if(!integer_find_factor(d, n)) {
+		mpz_clear(d);
+		return false;
+	}
+	bool b = integer_factorize_sub(d, factors);
+	if(b) {
+		mpz_divexact(d, n, d);
+		b = integer_factorize_sub(d, factors);
+	}
+	mpz_clear(d);
+	return b;
+}
+
 bool Number::factorize(vector<Number> &factors) {
 	if(isZero() || !isInteger()) return false;
 	if(mpz_cmp_si(mpq_numref(r_value), 1) == 0) {
@@ -10187,9 +10681,9 @@ bool Number::factorize(vector<Number> &factors) {
 		}
 		if(b) mpz_sqrt(facmax, inr);
 	}
+	mpz_set_si(last_prime, PRIMES[NR_OF_PRIMES - 1] + 2);
 	if(mpz_cmp_si(inr, 1) > 0) {
-		mpz_set_si(last_prime, PRIMES[NR_OF_PRIMES - 1] + 2);
-		while(mpz_cmp(facmax, last_prime) >= 0) {
+		while(mpz_cmp(facmax, last_prime) >= 0 && mpz_cmp_si(last_prime, FACTORIZE_TRIAL_DIVISION_LIMIT) <= 0) {
 			if(CALCULATOR->aborted()) {mpz_clears(inr, last_prime, facmax, NULL); return false;}
 			bool b = false;
 			while(mpz_divisible_p(inr, last_prime)) {
@@ -10203,7 +10697,12 @@ bool Number::factorize(vector<Number> &factors) {
 			mpz_add_ui(last_prime, last_prime, 2);
 		}
 	}
-	if(mpz_cmp_si(inr, 1) > 0) {
+	if(mpz_cmp(facmax, last_prime) >= 0) {
+		// the remaining factors are larger than the trial division limit
+		size_t i_start = factors.size();
+		if(!integer_factorize_sub(inr, factors)) {mpz_clears(inr, last_prime, facmax, NULL); return false;}
+		std::sort(factors.begin() + i_start, factors.end());
+	} else if(mpz_cmp_si(inr, 1) > 0) {
 		Number fac;
 		fac.setInternal(inr);
 		factors.push_back(fac);
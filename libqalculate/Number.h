@@ -54,6 +54,7 @@ class Number {
 		void testInteger();
 		bool testErrors(int error_level = 1) const;
 		bool testFloatResult(bool allow_infinite_result = true, int error_level = 1, bool test_integer = true);
+		bool testPointFloatResult();
 
 		mpq_t r_value;
 		mpfr_t fu_value;
@@ -91,8 +92,20 @@ class Number {
 		* Constructs a copy of a number.
  		*/
 		Number(const Number &o);
+		/**
+		* Constructs a number taking over the value of another number. The other number is left in a valid, but unspecified, state.
+		* \since 5.12.0
+ 		*/
+		Number(Number &&o);
 		virtual ~Number();
 
+		/**
+		* Allocates memory for a new number. Memory of deleted numbers is kept for reuse by the same thread until the current calculation ends.
+		* \since 5.12.0
+		*/
+		static void *operator new(size_t size);
+		static void operator delete(void *ptr, size_t size);
+
 		void set(std::string number, const ParseOptions &po = default_parse_options);
 		void set(long int numerator, long int denominator = 1, long int exp_10 = 0, bool keep_precision = false, bool keep_imag = false);
 		void setPlusInfinity(bool keep_precision = false, bool keep_imag = false);
@@ -216,6 +229,7 @@ class Number {
 		Number upperEndPoint(bool include_imag = false) const;
 
 		void operator = (const Number &o);
+		void operator = (Number &&o);
 		void operator = (long int i);
 		void operator -- (int);
 		void operator ++ (int);
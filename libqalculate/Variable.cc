@@ -345,7 +345,8 @@ void KnownVariable::set(const MathStructure &o) {
 	b_expression = false;
 	sexpression = "";
 	setApproximate(o.isApproximate());
-	setChanged(true);
+	// the definitions generation is not increased when a value is assigned (e.g. the last answer), since results with such variables are never cached
+	b_changed = true;
 }
 void KnownVariable::set(string expression_) {
 	if(b_expression && sexpression == expression_) return;
@@ -442,11 +443,20 @@ bool replace_f_interval(MathStructure &mstruct) {
 	return false;
 }
 const MathStructure &KnownVariable::get() {
-	MathStructure *m = mstruct;
-	if(b_expression && !CALCULATOR->variableUnitsEnabled() && !sunit.empty()) m = mstruct_alt;
+	std::lock_guard<std::recursive_mutex> lock(definitions_mutex);
+	bool b_alt = b_expression && !CALCULATOR->variableUnitsEnabled() && !sunit.empty();
+	MathStructure *m = b_alt ? mstruct_alt : mstruct;
+	MathStructure **m_thread = NULL;
+	if(b_expression && (!m || m->isAborted())) {
+		m_thread = thread_variable_value(this, b_alt, false);
+		if(m_thread) m = *m_thread;
+	}
 	if(b_expression && (!m || m->isAborted())) {
 		if(m) m->unref();
-		if(!CALCULATOR->variableUnitsEnabled() && !sunit.empty()) {
+		if(m_thread) {
+			m = new MathStructure();
+			*m_thread = m;
+		} else if(b_alt) {
 			mstruct_alt = new MathStructure();
 			m = mstruct_alt;
 		} else {
@@ -570,6 +580,17 @@ void DynamicVariable::set(const ExpressionItem *item) {
 void DynamicVariable::set(const MathStructure&) {}
 void DynamicVariable::set(string) {}
 const MathStructure &DynamicVariable::get() {
+	std::lock_guard<std::recursive_mutex> lock(definitions_mutex);
+	MathStructure **m_thread = thread_variable_value(this, false, true);
+	if(m_thread) {
+		if(always_recalculate || !*m_thread || (*m_thread)->isAborted()) {
+			if(*m_thread) (*m_thread)->unref();
+			*m_thread = new MathStructure();
+			(*m_thread)->setAborted();
+			calculate(**m_thread);
+		}
+		return **m_thread;
+	}
 	MathStructure *m = mstruct;
 	if(!always_recalculate && !CALCULATOR->usesIntervalArithmetic()) m = mstruct_alt;
 	if(always_recalculate || calculated_precision != CALCULATOR->getPrecision() || !m || m->isAborted()) {
@@ -762,7 +762,7 @@ struct EvaluationOptions {
 	int test_comparisons;
 	/// If a variable will be isolated to the left side in equations/comparisons (ex. x+y=2 => x=2-y). Default: true
 	bool isolate_x;
-	/// If factors (and bases) containing addition will be expanded (ex. z(x+y)=zx+zy). Default: true
+	/// If factors (and bases) containing addition will be expanded (ex. z(x+y)=zx+zy). Larger polynomials are expanded if the value is higher than one (used by MathStructure::expand()). Default: true
 	int expand;
 	/// Use behaviour from version <= 0.9.12 which returns (x+y)/z instead of x/y+y/z if expand = true
 	bool combine_divisions;
@@ -1,11119 +1,9 @@
 #define NR_OF_PRIMES_L 100000
+#define LAST_PRIME_L 1299709L
 
-static const long int PRIMES_L[] = {
-2L, 3L, 5L, 7L, 11L, 13L, 17L, 19L, 23L,
-29L, 31L, 37L, 41L, 43L, 47L, 53L, 59L, 61L,
-67L, 71L, 73L, 79L, 83L, 89L, 97L, 101L, 103L,
-107L, 109L, 113L, 127L, 131L, 137L, 139L, 149L, 151L,
-157L, 163L, 167L, 173L, 179L, 181L, 191L, 193L, 197L,
-199L, 211L, 223L, 227L, 229L, 233L, 239L, 241L, 251L,
-257L, 263L, 269L, 271L, 277L, 281L, 283L, 293L, 307L,
-311L, 313L, 317L, 331L, 337L, 347L, 349L, 353L, 359L,
-367L, 373L, 379L, 383L, 389L, 397L, 401L, 409L, 419L,
-421L, 431L, 433L, 439L, 443L, 449L, 457L, 461L, 463L,
-467L, 479L, 487L, 491L, 499L, 503L, 509L, 521L, 523L,
-541L, 547L, 557L, 563L, 569L, 571L, 577L, 587L, 593L,
-599L, 601L, 607L, 613L, 617L, 619L, 631L, 641L, 643L,
-647L, 653L, 659L, 661L, 673L, 677L, 683L, 691L, 701L,
-709L, 719L, 727L, 733L, 739L, 743L, 751L, 757L, 761L,
-769L, 773L, 787L, 797L, 809L, 811L, 821L, 823L, 827L,
-829L, 839L, 853L, 857L, 859L, 863L, 877L, 881L, 883L,
-887L, 907L, 911L, 919L, 929L, 937L, 941L, 947L, 953L,
-967L, 971L, 977L, 983L, 991L, 997L, 1009L, 1013L, 1019L,
-1021L, 1031L, 1033L, 1039L, 1049L, 1051L, 1061L, 1063L, 1069L,
-1087L, 1091L, 1093L, 1097L, 1103L, 1109L, 1117L, 1123L, 1129L,
-1151L, 1153L, 1163L, 1171L, 1181L, 1187L, 1193L, 1201L, 1213L,
-1217L, 1223L, 1229L, 1231L, 1237L, 1249L, 1259L, 1277L, 1279L,
-1283L, 1289L, 1291L, 1297L, 1301L, 1303L, 1307L, 1319L, 1321L,
-1327L, 1361L, 1367L, 1373L, 1381L, 1399L, 1409L, 1423L, 1427L,
-1429L, 1433L, 1439L, 1447L, 1451L, 1453L, 1459L, 1471L, 1481L,
-1483L, 1487L, 1489L, 1493L, 1499L, 1511L, 1523L, 1531L, 1543L,
-1549L, 1553L, 1559L, 1567L, 1571L, 1579L, 1583L, 1597L, 1601L,
-1607L, 1609L, 1613L, 1619L, 1621L, 1627L, 1637L, 1657L, 1663L,
-1667L, 1669L, 1693L, 1697L, 1699L, 1709L, 1721L, 1723L, 1733L,
-1741L, 1747L, 1753L, 1759L, 1777L, 1783L, 1787L, 1789L, 1801L,
-1811L, 1823L, 1831L, 1847L, 1861L, 1867L, 1871L, 1873L, 1877L,
-1879L, 1889L, 1901L, 1907L, 1913L, 1931L, 1933L, 1949L, 1951L,
-1973L, 1979L, 1987L, 1993L, 1997L, 1999L, 2003L, 2011L, 2017L,
-2027L, 2029L, 2039L, 2053L, 2063L, 2069L, 2081L, 2083L, 2087L,
-2089L, 2099L, 2111L, 2113L, 2129L, 2131L, 2137L, 2141L, 2143L,
-2153L, 2161L, 2179L, 2203L, 2207L, 2213L, 2221L, 2237L, 2239L,
-2243L, 2251L, 2267L, 2269L, 2273L, 2281L, 2287L, 2293L, 2297L,
-2309L, 2311L, 2333L, 2339L, 2341L, 2347L, 2351L, 2357L, 2371L,
-2377L, 2381L, 2383L, 2389L, 2393L, 2399L, 2411L, 2417L, 2423L,
-2437L, 2441L, 2447L, 2459L, 2467L, 2473L, 2477L, 2503L, 2521L,
-2531L, 2539L, 2543L, 2549L, 2551L, 2557L, 2579L, 2591L, 2593L,
-2609L, 2617L, 2621L, 2633L, 2647L, 2657L, 2659L, 2663L, 2671L,
-2677L, 2683L, 2687L, 2689L, 2693L, 2699L, 2707L, 2711L, 2713L,
-2719L, 2729L, 2731L, 2741L, 2749L, 2753L, 2767L, 2777L, 2789L,
-2791L, 2797L, 2801L, 2803L, 2819L, 2833L, 2837L, 2843L, 2851L,
-2857L, 2861L, 2879L, 2887L, 2897L, 2903L, 2909L, 2917L, 2927L,
-2939L, 2953L, 2957L, 2963L, 2969L, 2971L, 2999L, 3001L, 3011L,
-3019L, 3023L, 3037L, 3041L, 3049L, 3061L, 3067L, 3079L, 3083L,
-3089L, 3109L, 3119L, 3121L, 3137L, 3163L, 3167L, 3169L, 3181L,
-3187L, 3191L, 3203L, 3209L, 3217L, 3221L, 3229L, 3251L, 3253L,
-3257L, 3259L, 3271L, 3299L, 3301L, 3307L, 3313L, 3319L, 3323L,
-3329L, 3331L, 3343L, 3347L, 3359L, 3361L, 3371L, 3373L, 3389L,
-3391L, 3407L, 3413L, 3433L, 3449L, 3457L, 3461L, 3463L, 3467L,
-3469L, 3491L, 3499L, 3511L, 3517L, 3527L, 3529L, 3533L, 3539L,
-3541L, 3547L, 3557L, 3559L, 3571L, 3581L, 3583L, 3593L, 3607L,
-3613L, 3617L, 3623L, 3631L, 3637L, 3643L, 3659L, 3671L, 3673L,
-3677L, 3691L, 3697L, 3701L, 3709L, 3719L, 3727L, 3733L, 3739L,
-3761L, 3767L, 3769L, 3779L, 3793L, 3797L, 3803L, 3821L, 3823L,
-3833L, 3847L, 3851L, 3853L, 3863L, 3877L, 3881L, 3889L, 3907L,
-3911L, 3917L, 3919L, 3923L, 3929L, 3931L, 3943L, 3947L, 3967L,
-3989L, 4001L, 4003L, 4007L, 4013L, 4019L, 4021L, 4027L, 4049L,
-4051L, 4057L, 4073L, 4079L, 4091L, 4093L, 4099L, 4111L, 4127L,
-4129L, 4133L, 4139L, 4153L, 4157L, 4159L, 4177L, 4201L, 4211L,
-4217L, 4219L, 4229L, 4231L, 4241L, 4243L, 4253L, 4259L, 4261L,
-4271L, 4273L, 4283L, 4289L, 4297L, 4327L, 4337L, 4339L, 4349L,
-4357L, 4363L, 4373L, 4391L, 4397L, 4409L, 4421L, 4423L, 4441L,
-4447L, 4451L, 4457L, 4463L, 4481L, 4483L, 4493L, 4507L, 4513L,
-4517L, 4519L, 4523L, 4547L, 4549L, 4561L, 4567L, 4583L, 4591L,
-4597L, 4603L, 4621L, 4637L, 4639L, 4643L, 4649L, 4651L, 4657L,
-4663L, 4673L, 4679L, 4691L, 4703L, 4721L, 4723L, 4729L, 4733L,
-4751L, 4759L, 4783L, 4787L, 4789L, 4793L, 4799L, 4801L, 4813L,
-4817L, 4831L, 4861L, 4871L, 4877L, 4889L, 4903L, 4909L, 4919L,
-4931L, 4933L, 4937L, 4943L, 4951L, 4957L, 4967L, 4969L, 4973L,
-4987L, 4993L, 4999L, 5003L, 5009L, 5011L, 5021L, 5023L, 5039L,
-5051L, 5059L, 5077L, 5081L, 5087L, 5099L, 5101L, 5107L, 5113L,
-5119L, 5147L, 5153L, 5167L, 5171L, 5179L, 5189L, 5197L, 5209L,
-5227L, 5231L, 5233L, 5237L, 5261L, 5273L, 5279L, 5281L, 5297L,
-5303L, 5309L, 5323L, 5333L, 5347L, 5351L, 5381L, 5387L, 5393L,
-5399L, 5407L, 5413L, 5417L, 5419L, 5431L, 5437L, 5441L, 5443L,
-5449L, 5471L, 5477L, 5479L, 5483L, 5501L, 5503L, 5507L, 5519L,
-5521L, 5527L, 5531L, 5557L, 5563L, 5569L, 5573L, 5581L, 5591L,
-5623L, 5639L, 5641L, 5647L, 5651L, 5653L, 5657L, 5659L, 5669L,
-5683L, 5689L, 5693L, 5701L, 5711L, 5717L, 5737L, 5741L, 5743L,
-5749L, 5779L, 5783L, 5791L, 5801L, 5807L, 5813L, 5821L, 5827L,
-5839L, 5843L, 5849L, 5851L, 5857L, 5861L, 5867L, 5869L, 5879L,
-5881L, 5897L, 5903L, 5923L, 5927L, 5939L, 5953L, 5981L, 5987L,
-6007L, 6011L, 6029L, 6037L, 6043L, 6047L, 6053L, 6067L, 6073L,
-6079L, 6089L, 6091L, 6101L, 6113L, 6121L, 6131L, 6133L, 6143L,
-6151L, 6163L, 6173L, 6197L, 6199L, 6203L, 6211L, 6217L, 6221L,
-6229L, 6247L, 6257L, 6263L, 6269L, 6271L, 6277L, 6287L, 6299L,
-6301L, 6311L, 6317L, 6323L, 6329L, 6337L, 6343L, 6353L, 6359L,
-6361L, 6367L, 6373L, 6379L, 6389L, 6397L, 6421L, 6427L, 6449L,
-6451L, 6469L, 6473L, 6481L, 6491L, 6521L, 6529L, 6547L, 6551L,
-6553L, 6563L, 6569L, 6571L, 6577L, 6581L, 6599L, 6607L, 6619L,
-6637L, 6653L, 6659L, 6661L, 6673L, 6679L, 6689L, 6691L, 6701L,
-6703L, 6709L, 6719L, 6733L, 6737L, 6761L, 6763L, 6779L, 6781L,
-6791L, 6793L, 6803L, 6823L, 6827L, 6829L, 6833L, 6841L, 6857L,
-6863L, 6869L, 6871L, 6883L, 6899L, 6907L, 6911L, 6917L, 6947L,
-6949L, 6959L, 6961L, 6967L, 6971L, 6977L, 6983L, 6991L, 6997L,
-7001L, 7013L, 7019L, 7027L, 7039L, 7043L, 7057L, 7069L, 7079L,
-7103L, 7109L, 7121L, 7127L, 7129L, 7151L, 7159L, 7177L, 7187L,
-7193L, 7207L, 7211L, 7213L, 7219L, 7229L, 7237L, 7243L, 7247L,
-7253L, 7283L, 7297L, 7307L, 7309L, 7321L, 7331L, 7333L, 7349L,
-7351L, 7369L, 7393L, 7411L, 7417L, 7433L, 7451L, 7457L, 7459L,
-7477L, 7481L, 7487L, 7489L, 7499L, 7507L, 7517L, 7523L, 7529L,
-7537L, 7541L, 7547L, 7549L, 7559L, 7561L, 7573L, 7577L, 7583L,
-7589L, 7591L, 7603L, 7607L, 7621L, 7639L, 7643L, 7649L, 7669L,
-7673L, 7681L, 7687L, 7691L, 7699L, 7703L, 7717L, 7723L, 7727L,
-7741L, 7753L, 7757L, 7759L, 7789L, 7793L, 7817L, 7823L, 7829L,
-7841L, 7853L, 7867L, 7873L, 7877L, 7879L, 7883L, 7901L, 7907L,
-7919L, 7927L, 7933L, 7937L, 7949L, 7951L, 7963L, 7993L, 8009L,
-8011L, 8017L, 8039L, 8053L, 8059L, 8069L, 8081L, 8087L, 8089L,
-8093L, 8101L, 8111L, 8117L, 8123L, 8147L, 8161L, 8167L, 8171L,
-8179L, 8191L, 8209L, 8219L, 8221L, 8231L, 8233L, 8237L, 8243L,
-8263L, 8269L, 8273L, 8287L, 8291L, 8293L, 8297L, 8311L, 8317L,
-8329L, 8353L, 8363L, 8369L, 8377L, 8387L, 8389L, 8419L, 8423L,
-8429L, 8431L, 8443L, 8447L, 8461L, 8467L, 8501L, 8513L, 8521L,
-8527L, 8537L, 8539L, 8543L, 8563L, 8573L, 8581L, 8597L, 8599L,
-8609L, 8623L, 8627L, 8629L, 8641L, 8647L, 8663L, 8669L, 8677L,
-8681L, 8689L, 8693L, 8699L, 8707L, 8713L, 8719L, 8731L, 8737L,
-8741L, 8747L, 8753L, 8761L, 8779L, 8783L, 8803L, 8807L, 8819L,
-8821L, 8831L, 8837L, 8839L, 8849L, 8861L, 8863L, 8867L, 8887L,
-8893L, 8923L, 8929L, 8933L, 8941L, 8951L, 8963L, 8969L, 8971L,
-8999L, 9001L, 9007L, 9011L, 9013L, 9029L, 9041L, 9043L, 9049L,
-9059L, 9067L, 9091L, 9103L, 9109L, 9127L, 9133L, 9137L, 9151L,
-9157L, 9161L, 9173L, 9181L, 9187L, 9199L, 9203L, 9209L, 9221L,
-9227L, 9239L, 9241L, 9257L, 9277L, 9281L, 9283L, 9293L, 9311L,
-9319L, 9323L, 9337L, 9341L, 9343L, 9349L, 9371L, 9377L, 9391L,
-9397L, 9403L, 9413L, 9419L, 9421L, 9431L, 9433L, 9437L, 9439L,
-9461L, 9463L, 9467L, 9473L, 9479L, 9491L, 9497L, 9511L, 9521L,
-9533L, 9539L, 9547L, 9551L, 9587L, 9601L, 9613L, 9619L, 9623L,
-9629L, 9631L, 9643L, 9649L, 9661L, 9677L, 9679L, 9689L, 9697L,
-9719L, 9721L, 9733L, 9739L, 9743L, 9749L, 9767L, 9769L, 9781L,
-9787L, 9791L, 9803L, 9811L, 9817L, 9829L, 9833L, 9839L, 9851L,
-9857L, 9859L, 9871L, 9883L, 9887L, 9901L, 9907L, 9923L, 9929L,
-9931L, 9941L, 9949L, 9967L, 9973L, 10007L, 10009L, 10037L, 10039L,
-10061L, 10067L, 10069L, 10079L, 10091L, 10093L, 10099L, 10103L, 10111L,
-10133L, 10139L, 10141L, 10151L, 10159L, 10163L, 10169L, 10177L, 10181L,
-10193L, 10211L, 10223L, 10243L, 10247L, 10253L, 10259L, 10267L, 10271L,
-10273L, 10289L, 10301L, 10303L, 10313L, 10321L, 10331L, 10333L, 10337L,
-10343L, 10357L, 10369L, 10391L, 10399L, 10427L, 10429L, 10433L, 10453L,
-10457L, 10459L, 10463L, 10477L, 10487L, 10499L, 10501L, 10513L, 10529L,
-10531L, 10559L, 10567L, 10589L, 10597L, 10601L, 10607L, 10613L, 10627L,
-10631L, 10639L, 10651L, 10657L, 10663L, 10667L, 10687L, 10691L, 10709L,
-10711L, 10723L, 10729L, 10733L, 10739L, 10753L, 10771L, 10781L, 10789L,
-10799L, 10831L, 10837L, 10847L, 10853L, 10859L, 10861L, 10867L, 10883L,
-10889L, 10891L, 10903L, 10909L, 10937L, 10939L, 10949L, 10957L, 10973L,
-10979L, 10987L, 10993L, 11003L, 11027L, 11047L, 11057L, 11059L, 11069L,
-11071L, 11083L, 11087L, 11093L, 11113L, 11117L, 11119L, 11131L, 11149L,
-11159L, 11161L, 11171L, 11173L, 11177L, 11197L, 11213L, 11239L, 11243L,
-11251L, 11257L, 11261L, 11273L, 11279L, 11287L, 11299L, 11311L, 11317L,
-11321L, 11329L, 11351L, 11353L, 11369L, 11383L, 11393L, 11399L, 11411L,
-11423L, 11437L, 11443L, 11447L, 11467L, 11471L, 11483L, 11489L, 11491L,
-11497L, 11503L, 11519L, 11527L, 11549L, 11551L, 11579L, 11587L, 11593L,
-11597L, 11617L, 11621L, 11633L, 11657L, 11677L, 11681L, 11689L, 11699L,
-11701L, 11717L, 11719L, 11731L, 11743L, 11777L, 11779L, 11783L, 11789L,
-11801L, 11807L, 11813L, 11821L, 11827L, 11831L, 11833L, 11839L, 11863L,
-11867L, 11887L, 11897L, 11903L, 11909L, 11923L, 11927L, 11933L, 11939L,
-11941L, 11953L, 11959L, 11969L, 11971L, 11981L, 11987L, 12007L, 12011L,
-12037L, 12041L, 12043L, 12049L, 12071L, 12073L, 12097L, 12101L, 12107L,
-12109L, 12113L, 12119L, 12143L, 12149L, 12157L, 12161L, 12163L, 12197L,
-12203L, 12211L, 12227L, 12239L, 12241L, 12251L, 12253L, 12263L, 12269L,
-12277L, 12281L, 12289L, 12301L, 12323L, 12329L, 12343L, 12347L, 12373L,
-12377L, 12379L, 12391L, 12401L, 12409L, 12413L, 12421L, 12433L, 12437L,
-12451L, 12457L, 12473L, 12479L, 12487L, 12491L, 12497L, 12503L, 12511L,
-12517L, 12527L, 12539L, 12541L, 12547L, 12553L, 12569L, 12577L, 12583L,
-12589L, 12601L, 12611L, 12613L, 12619L, 12637L, 12641L, 12647L, 12653L,
-12659L, 12671L, 12689L, 12697L, 12703L, 12713L, 12721L, 12739L, 12743L,
-12757L, 12763L, 12781L, 12791L, 12799L, 12809L, 12821L, 12823L, 12829L,
-12841L, 12853L, 12889L, 12893L, 12899L, 12907L, 12911L, 12917L, 12919L,
-12923L, 12941L, 12953L, 12959L, 12967L, 12973L, 12979L, 12983L, 13001L,
-13003L, 13007L, 13009L, 13033L, 13037L, 13043L, 13049L, 13063L, 13093L,
-13099L, 13103L, 13109L, 13121L, 13127L, 13147L, 13151L, 13159L, 13163L,
-13171L, 13177L, 13183L, 13187L, 13217L, 13219L, 13229L, 13241L, 13249L,
-13259L, 13267L, 13291L, 13297L, 13309L, 13313L, 13327L, 13331L, 13337L,
-13339L, 13367L, 13381L, 13397L, 13399L, 13411L, 13417L, 13421L, 13441L,
-13451L, 13457L, 13463L, 13469L, 13477L, 13487L, 13499L, 13513L, 13523L,
-13537L, 13553L, 13567L, 13577L, 13591L, 13597L, 13613L, 13619L, 13627L,
-13633L, 13649L, 13669L, 13679L, 13681L, 13687L, 13691L, 13693L, 13697L,
-13709L, 13711L, 13721L, 13723L, 13729L, 13751L, 13757L, 13759L, 13763L,
-13781L, 13789L, 13799L, 13807L, 13829L, 13831L, 13841L, 13859L, 13873L,
-13877L, 13879L, 13883L, 13901L, 13903L, 13907L, 13913L, 13921L, 13931L,
-13933L, 13963L, 13967L, 13997L, 13999L, 14009L, 14011L, 14029L, 14033L,
-14051L, 14057L, 14071L, 14081L, 14083L, 14087L, 14107L, 14143L, 14149L,
-14153L, 14159L, 14173L, 14177L, 14197L, 14207L, 14221L, 14243L, 14249L,
-14251L, 14281L, 14293L, 14303L, 14321L, 14323L, 14327L, 14341L, 14347L,
-14369L, 14387L, 14389L, 14401L, 14407L, 14411L, 14419L, 14423L, 14431L,
-14437L, 14447L, 14449L, 14461L, 14479L, 14489L, 14503L, 14519L, 14533L,
-14537L, 14543L, 14549L, 14551L, 14557L, 14561L, 14563L, 14591L, 14593L,
-14621L, 14627L, 14629L, 14633L, 14639L, 14653L, 14657L, 14669L, 14683L,
-14699L, 14713L, 14717L, 14723L, 14731L, 14737L, 14741L, 14747L, 14753L,
-14759L, 14767L, 14771L, 14779L, 14783L, 14797L, 14813L, 14821L, 14827L,
-14831L, 14843L, 14851L, 14867L, 14869L, 14879L, 14887L, 14891L, 14897L,
-14923L, 14929L, 14939L, 14947L, 14951L, 14957L, 14969L, 14983L, 15013L,
-15017L, 15031L, 15053L, 15061L, 15073L, 15077L, 15083L, 15091L, 15101L,
-15107L, 15121L, 15131L, 15137L, 15139L, 15149L, 15161L, 15173L, 15187L,
-15193L, 15199L, 15217L, 15227L, 15233L, 15241L, 15259L, 15263L, 15269L,
-15271L, 15277L, 15287L, 15289L, 15299L, 15307L, 15313L, 15319L, 15329L,
-15331L, 15349L, 15359L, 15361L, 15373L, 15377L, 15383L, 15391L, 15401L,
-15413L, 15427L, 15439L, 15443L, 15451L, 15461L, 15467L, 15473L, 15493L,
-15497L, 15511L, 15527L, 15541L, 15551L, 15559L, 15569L, 15581L, 15583L,
-15601L, 15607L, 15619L, 15629L, 15641L, 15643L, 15647L, 15649L, 15661L,
-15667L, 15671L, 15679L, 15683L, 15727L, 15731L, 15733L, 15737L, 15739L,
-15749L, 15761L, 15767L, 15773L, 15787L, 15791L, 15797L, 15803L, 15809L,
-15817L, 15823L, 15859L, 15877L, 15881L, 15887L, 15889L, 15901L, 15907L,
-15913L, 15919L, 15923L, 15937L, 15959L, 15971L, 15973L, 15991L, 16001L,
-16007L, 16033L, 16057L, 16061L, 16063L, 16067L, 16069L, 16073L, 16087L,
-16091L, 16097L, 16103L, 16111L, 16127L, 16139L, 16141L, 16183L, 16187L,
-16189L, 16193L, 16217L, 16223L, 16229L, 16231L, 16249L, 16253L, 16267L,
-16273L, 16301L, 16319L, 16333L, 16339L, 16349L, 16361L, 16363L, 16369L,
-16381L, 16411L, 16417L, 16421L, 16427L, 16433L, 16447L, 16451L, 16453L,
-16477L, 16481L, 16487L, 16493L, 16519L, 16529L, 16547L, 16553L, 16561L,
-16567L, 16573L, 16603L, 16607L, 16619L, 16631L, 16633L, 16649L, 16651L,
-16657L, 16661L, 16673L, 16691L, 16693L, 16699L, 16703L, 16729L, 16741L,
-16747L, 16759L, 16763L, 16787L, 16811L, 16823L, 16829L, 16831L, 16843L,
-16871L, 16879L, 16883L, 16889L, 16901L, 16903L, 16921L, 16927L, 16931L,
-16937L, 16943L, 16963L, 16979L, 16981L, 16987L, 16993L, 17011L, 17021L,
-17027L, 17029L, 17033L, 17041L, 17047L, 17053L, 17077L, 17093L, 17099L,
-17107L, 17117L, 17123L, 17137L, 17159L, 17167L, 17183L, 17189L, 17191L,
-17203L, 17207L, 17209L, 17231L, 17239L, 17257L, 17291L, 17293L, 17299L,
-17317L, 17321L, 17327L, 17333L, 17341L, 17351L, 17359L, 17377L, 17383L,
-17387L, 17389L, 17393L, 17401L, 17417L, 17419L, 17431L, 17443L, 17449L,
-17467L, 17471L, 17477L, 17483L, 17489L, 17491L, 17497L, 17509L, 17519L,
-17539L, 17551L, 17569L, 17573L, 17579L, 17581L, 17597L, 17599L, 17609L,
-17623L, 17627L, 17657L, 17659L, 17669L, 17681L, 17683L, 17707L, 17713L,
-17729L, 17737L, 17747L, 17749L, 17761L, 17783L, 17789L, 17791L, 17807L,
-17827L, 17837L, 17839L, 17851L, 17863L, 17881L, 17891L, 17903L, 17909L,
-17911L, 17921L, 17923L, 17929L, 17939L, 17957L, 17959L, 17971L, 17977L,
-17981L, 17987L, 17989L, 18013L, 18041L, 18043L, 18047L, 18049L, 18059L,
-18061L, 18077L, 18089L, 18097L, 18119L, 18121L, 18127L, 18131L, 18133L,
-18143L, 18149L, 18169L, 18181L, 18191L, 18199L, 18211L, 18217L, 18223L,
-18229L, 18233L, 18251L, 18253L, 18257L, 18269L, 18287L, 18289L, 18301L,
-18307L, 18311L, 18313L, 18329L, 18341L, 18353L, 18367L, 18371L, 18379L,
-18397L, 18401L, 18413L, 18427L, 18433L, 18439L, 18443L, 18451L, 18457L,
-18461L, 18481L, 18493L, 18503L, 18517L, 18521L, 18523L, 18539L, 18541L,
-18553L, 18583L, 18587L, 18593L, 18617L, 18637L, 18661L, 18671L, 18679L,
-18691L, 18701L, 18713L, 18719L, 18731L, 18743L, 18749L, 18757L, 18773L,
-18787L, 18793L, 18797L, 18803L, 18839L, 18859L, 18869L, 18899L, 18911L,
-18913L, 18917L, 18919L, 18947L, 18959L, 18973L, 18979L, 19001L, 19009L,
-19013L, 19031L, 19037L, 19051L, 19069L, 19073L, 19079L, 19081L, 19087L,
-19121L, 19139L, 19141L, 19157L, 19163L, 19181L, 19183L, 19207L, 19211L,
-19213L, 19219L, 19231L, 19237L, 19249L, 19259L, 19267L, 19273L, 19289L,
-19301L, 19309L, 19319L, 19333L, 19373L, 19379L, 19381L, 19387L, 19391L,
-19403L, 19417L, 19421L, 19423L, 19427L, 19429L, 19433L, 19441L, 19447L,
-19457L, 19463L, 19469L, 19471L, 19477L, 19483L, 19489L, 19501L, 19507L,
-19531L, 19541L, 19543L, 19553L, 19559L, 19571L, 19577L, 19583L, 19597L,
-19603L, 19609L, 19661L, 19681L, 19687L, 19697L, 19699L, 19709L, 19717L,
-19727L, 19739L, 19751L, 19753L, 19759L, 19763L, 19777L, 19793L, 19801L,
-19813L, 19819L, 19841L, 19843L, 19853L, 19861L, 19867L, 19889L, 19891L,
-19913L, 19919L, 19927L, 19937L, 19949L, 19961L, 19963L, 19973L, 19979L,
-19991L, 19993L, 19997L, 20011L, 20021L, 20023L, 20029L, 20047L, 20051L,
-20063L, 20071L, 20089L, 20101L, 20107L, 20113L, 20117L, 20123L, 20129L,
-20143L, 20147L, 20149L, 20161L, 20173L, 20177L, 20183L, 20201L, 20219L,
-20231L, 20233L, 20249L, 20261L, 20269L, 20287L, 20297L, 20323L, 20327L,
-20333L, 20341L, 20347L, 20353L, 20357L, 20359L, 20369L, 20389L, 20393L,
-20399L, 20407L, 20411L, 20431L, 20441L, 20443L, 20477L, 20479L, 20483L,
-20507L, 20509L, 20521L, 20533L, 20543L, 20549L, 20551L, 20563L, 20593L,
-20599L, 20611L, 20627L, 20639L, 20641L, 20663L, 20681L, 20693L, 20707L,
-20717L, 20719L, 20731L, 20743L, 20747L, 20749L, 20753L, 20759L, 20771L,
-20773L, 20789L, 20807L, 20809L, 20849L, 20857L, 20873L, 20879L, 20887L,
-20897L, 20899L, 20903L, 20921L, 20929L, 20939L, 20947L, 20959L, 20963L,
-20981L, 20983L, 21001L, 21011L, 21013L, 21017L, 21019L, 21023L, 21031L,
-21059L, 21061L, 21067L, 21089L, 21101L, 21107L, 21121L, 21139L, 21143L,
-21149L, 21157L, 21163L, 21169L, 21179L, 21187L, 21191L, 21193L, 21211L,
-21221L, 21227L, 21247L, 21269L, 21277L, 21283L, 21313L, 21317L, 21319L,
-21323L, 21341L, 21347L, 21377L, 21379L, 21383L, 21391L, 21397L, 21401L,
-21407L, 21419L, 21433L, 21467L, 21481L, 21487L, 21491L, 21493L, 21499L,
-21503L, 21517L, 21521L, 21523L, 21529L, 21557L, 21559L, 21563L, 21569L,
-21577L, 21587L, 21589L, 21599L, 21601L, 21611L, 21613L, 21617L, 21647L,
-21649L, 21661L, 21673L, 21683L, 21701L, 21713L, 21727L, 21737L, 21739L,
-21751L, 21757L, 21767L, 21773L, 21787L, 21799L, 21803L, 21817L, 21821L,
-21839L, 21841L, 21851L, 21859L, 21863L, 21871L, 21881L, 21893L, 21911L,
-21929L, 21937L, 21943L, 21961L, 21977L, 21991L, 21997L, 22003L, 22013L,
-22027L, 22031L, 22037L, 22039L, 22051L, 22063L, 22067L, 22073L, 22079L,
-22091L, 22093L, 22109L, 22111L, 22123L, 22129L, 22133L, 22147L, 22153L,
-22157L, 22159L, 22171L, 22189L, 22193L, 22229L, 22247L, 22259L, 22271L,
-22273L, 22277L, 22279L, 22283L, 22291L, 22303L, 22307L, 22343L, 22349L,
-22367L, 22369L, 22381L, 22391L, 22397L, 22409L, 22433L, 22441L, 22447L,
-22453L, 22469L, 22481L, 22483L, 22501L, 22511L, 22531L, 22541L, 22543L,
-22549L, 22567L, 22571L, 22573L, 22613L, 22619L, 22621L, 22637L, 22639L,
-22643L, 22651L, 22669L, 22679L, 22691L, 22697L, 22699L, 22709L, 22717L,
-22721L, 22727L, 22739L, 22741L, 22751L, 22769L, 22777L, 22783L, 22787L,
-22807L, 22811L, 22817L, 22853L, 22859L, 22861L, 22871L, 22877L, 22901L,
-22907L, 22921L, 22937L, 22943L, 22961L, 22963L, 22973L, 22993L, 23003L,
-23011L, 23017L, 23021L, 23027L, 23029L, 23039L, 23041L, 23053L, 23057L,
-23059L, 23063L, 23071L, 23081L, 23087L, 23099L, 23117L, 23131L, 23143L,
-23159L, 23167L, 23173L, 23189L, 23197L, 23201L, 23203L, 23209L, 23227L,
-23251L, 23269L, 23279L, 23291L, 23293L, 23297L, 23311L, 23321L, 23327L,
-23333L, 23339L, 23357L, 23369L, 23371L, 23399L, 23417L, 23431L, 23447L,
-23459L, 23473L, 23497L, 23509L, 23531L, 23537L, 23539L, 23549L, 23557L,
-23561L, 23563L, 23567L, 23581L, 23593L, 23599L, 23603L, 23609L, 23623L,
-23627L, 23629L, 23633L, 23663L, 23669L, 23671L, 23677L, 23687L, 23689L,
-23719L, 23741L, 23743L, 23747L, 23753L, 23761L, 23767L, 23773L, 23789L,
-23801L, 23813L, 23819L, 23827L, 23831L, 23833L, 23857L, 23869L, 23873L,
-23879L, 23887L, 23893L, 23899L, 23909L, 23911L, 23917L, 23929L, 23957L,
-23971L, 23977L, 23981L, 23993L, 24001L, 24007L, 24019L, 24023L, 24029L,
-24043L, 24049L, 24061L, 24071L, 24077L, 24083L, 24091L, 24097L, 24103L,
-24107L, 24109L, 24113L, 24121L, 24133L, 24137L, 24151L, 24169L, 24179L,
-24181L, 24197L, 24203L, 24223L, 24229L, 24239L, 24247L, 24251L, 24281L,
-24317L, 24329L, 24337L, 24359L, 24371L, 24373L, 24379L, 24391L, 24407L,
-24413L, 24419L, 24421L, 24439L, 24443L, 24469L, 24473L, 24481L, 24499L,
-24509L, 24517L, 24527L, 24533L, 24547L, 24551L, 24571L, 24593L, 24611L,
-24623L, 24631L, 24659L, 24671L, 24677L, 24683L, 24691L, 24697L, 24709L,
-24733L, 24749L, 24763L, 24767L, 24781L, 24793L, 24799L, 24809L, 24821L,
-24841L, 24847L, 24851L, 24859L, 24877L, 24889L, 24907L, 24917L, 24919L,
-24923L, 24943L, 24953L, 24967L, 24971L, 24977L, 24979L, 24989L, 25013L,
-25031L, 25033L, 25037L, 25057L, 25073L, 25087L, 25097L, 25111L, 25117L,
-25121L, 25127L, 25147L, 25153L, 25163L, 25169L, 25171L, 25183L, 25189L,
-25219L, 25229L, 25237L, 25243L, 25247L, 25253L, 25261L, 25301L, 25303L,
-25307L, 25309L, 25321L, 25339L, 25343L, 25349L, 25357L, 25367L, 25373L,
-25391L, 25409L, 25411L, 25423L, 25439L, 25447L, 25453L, 25457L, 25463L,
-25469L, 25471L, 25523L, 25537L, 25541L, 25561L, 25577L, 25579L, 25583L,
-25589L, 25601L, 25603L, 25609L, 25621L, 25633L, 25639L, 25643L, 25657L,
-25667L, 25673L, 25679L, 25693L, 25703L, 25717L, 25733L, 25741L, 25747L,
-25759L, 25763L, 25771L, 25793L, 25799L, 25801L, 25819L, 25841L, 25847L,
-25849L, 25867L, 25873L, 25889L, 25903L, 25913L, 25919L, 25931L, 25933L,
-25939L, 25943L, 25951L, 25969L, 25981L, 25997L, 25999L, 26003L, 26017L,
-26021L, 26029L, 26041L, 26053L, 26083L, 26099L, 26107L, 26111L, 26113L,
-26119L, 26141L, 26153L, 26161L, 26171L, 26177L, 26183L, 26189L, 26203L,
-26209L, 26227L, 26237L, 26249L, 26251L, 26261L, 26263L, 26267L, 26293L,
-26297L, 26309L, 26317L, 26321L, 26339L, 26347L, 26357L, 26371L, 26387L,
-26393L, 26399L, 26407L, 26417L, 26423L, 26431L, 26437L, 26449L, 26459L,
-26479L, 26489L, 26497L, 26501L, 26513L, 26539L, 26557L, 26561L, 26573L,
-26591L, 26597L, 26627L, 26633L, 26641L, 26647L, 26669L, 26681L, 26683L,
-26687L, 26693L, 26699L, 26701L, 26711L, 26713L, 26717L, 26723L, 26729L,
-26731L, 26737L, 26759L, 26777L, 26783L, 26801L, 26813L, 26821L, 26833L,
-26839L, 26849L, 26861L, 26863L, 26879L, 26881L, 26891L, 26893L, 26903L,
-26921L, 26927L, 26947L, 26951L, 26953L, 26959L, 26981L, 26987L, 26993L,
-27011L, 27017L, 27031L, 27043L, 27059L, 27061L, 27067L, 27073L, 27077L,
-27091L, 27103L, 27107L, 27109L, 27127L, 27143L, 27179L, 27191L, 27197L,
-27211L, 27239L, 27241L, 27253L, 27259L, 27271L, 27277L, 27281L, 27283L,
-27299L, 27329L, 27337L, 27361L, 27367L, 27397L, 27407L, 27409L, 27427L,
-27431L, 27437L, 27449L, 27457L, 27479L, 27481L, 27487L, 27509L, 27527L,
-27529L, 27539L, 27541L, 27551L, 27581L, 27583L, 27611L, 27617L, 27631L,
-27647L, 27653L, 27673L, 27689L, 27691L, 27697L, 27701L, 27733L, 27737L,
-27739L, 27743L, 27749L, 27751L, 27763L, 27767L, 27773L, 27779L, 27791L,
-27793L, 27799L, 27803L, 27809L, 27817L, 27823L, 27827L, 27847L, 27851L,
-27883L, 27893L, 27901L, 27917L, 27919L, 27941L, 27943L, 27947L, 27953L,
-27961L, 27967L, 27983L, 27997L, 28001L, 28019L, 28027L, 28031L, 28051L,
-28057L, 28069L, 28081L, 28087L, 28097L, 28099L, 28109L, 28111L, 28123L,
-28151L, 28163L, 28181L, 28183L, 28201L, 28211L, 28219L, 28229L, 28277L,
-28279L, 28283L, 28289L, 28297L, 28307L, 28309L, 28319L, 28349L, 28351L,
-28387L, 28393L, 28403L, 28409L, 28411L, 28429L, 28433L, 28439L, 28447L,
-28463L, 28477L, 28493L, 28499L, 28513L, 28517L, 28537L, 28541L, 28547L,
-28549L, 28559L, 28571L, 28573L, 28579L, 28591L, 28597L, 28603L, 28607L,
-28619L, 28621L, 28627L, 28631L, 28643L, 28649L, 28657L, 28661L, 28663L,
-28669L, 28687L, 28697L, 28703L, 28711L, 28723L, 28729L, 28751L, 28753L,
-28759L, 28771L, 28789L, 28793L, 28807L, 28813L, 28817L, 28837L, 28843L,
-28859L, 28867L, 28871L, 28879L, 28901L, 28909L, 28921L, 28927L, 28933L,
-28949L, 28961L, 28979L, 29009L, 29017L, 29021L, 29023L, 29027L, 29033L,
-29059L, 29063L, 29077L, 29101L, 29123L, 29129L, 29131L, 29137L, 29147L,
-29153L, 29167L, 29173L, 29179L, 29191L, 29201L, 29207L, 29209L, 29221L,
-29231L, 29243L, 29251L, 29269L, 29287L, 29297L, 29303L, 29311L, 29327L,
-29333L, 29339L, 29347L, 29363L, 29383L, 29387L, 29389L, 29399L, 29401L,
-29411L, 29423L, 29429L, 29437L, 29443L, 29453L, 29473L, 29483L, 29501L,
-29527L, 29531L, 29537L, 29567L, 29569L, 29573L, 29581L, 29587L, 29599L,
-29611L, 29629L, 29633L, 29641L, 29663L, 29669L, 29671L, 29683L, 29717L,
-29723L, 29741L, 29753L, 29759L, 29761L, 29789L, 29803L, 29819L, 29833L,
-29837L, 29851L, 29863L, 29867L, 29873L, 29879L, 29881L, 29917L, 29921L,
-29927L, 29947L, 29959L, 29983L, 29989L, 30011L, 30013L, 30029L, 30047L,
-30059L, 30071L, 30089L, 30091L, 30097L, 30103L, 30109L, 30113L, 30119L,
-30133L, 30137L, 30139L, 30161L, 30169L, 30181L, 30187L, 30197L, 30203L,
-30211L, 30223L, 30241L, 30253L, 30259L, 30269L, 30271L, 30293L, 30307L,
-30313L, 30319L, 30323L, 30341L, 30347L, 30367L, 30389L, 30391L, 30403L,
-30427L, 30431L, 30449L, 30467L, 30469L, 30491L, 30493L, 30497L, 30509L,
-30517L, 30529L, 30539L, 30553L, 30557L, 30559L, 30577L, 30593L, 30631L,
-30637L, 30643L, 30649L, 30661L, 30671L, 30677L, 30689L, 30697L, 30703L,
-30707L, 30713L, 30727L, 30757L, 30763L, 30773L, 30781L, 30803L, 30809L,
-30817L, 30829L, 30839L, 30841L, 30851L, 30853L, 30859L, 30869L, 30871L,
-30881L, 30893L, 30911L, 30931L, 30937L, 30941L, 30949L, 30971L, 30977L,
-30983L, 31013L, 31019L, 31033L, 31039L, 31051L, 31063L, 31069L, 31079L,
-31081L, 31091L, 31121L, 31123L, 31139L, 31147L, 31151L, 31153L, 31159L,
-31177L, 31181L, 31183L, 31189L, 31193L, 31219L, 31223L, 31231L, 31237L,
-31247L, 31249L, 31253L, 31259L, 31267L, 31271L, 31277L, 31307L, 31319L,
-31321L, 31327L, 31333L, 31337L, 31357L, 31379L, 31387L, 31391L, 31393L,
-31397L, 31469L, 31477L, 31481L, 31489L, 31511L, 31513L, 31517L, 31531L,
-31541L, 31543L, 31547L, 31567L, 31573L, 31583L, 31601L, 31607L, 31627L,
-31643L, 31649L, 31657L, 31663L, 31667L, 31687L, 31699L, 31721L, 31723L,
-31727L, 31729L, 31741L, 31751L, 31769L, 31771L, 31793L, 31799L, 31817L,
-31847L, 31849L, 31859L, 31873L, 31883L, 31891L, 31907L, 31957L, 31963L,
-31973L, 31981L, 31991L, 32003L, 32009L, 32027L, 32029L, 32051L, 32057L,
-32059L, 32063L, 32069L, 32077L, 32083L, 32089L, 32099L, 32117L, 32119L,
-32141L, 32143L, 32159L, 32173L, 32183L, 32189L, 32191L, 32203L, 32213L,
-32233L, 32237L, 32251L, 32257L, 32261L, 32297L, 32299L, 32303L, 32309L,
-32321L, 32323L, 32327L, 32341L, 32353L, 32359L, 32363L, 32369L, 32371L,
-32377L, 32381L, 32401L, 32411L, 32413L, 32423L, 32429L, 32441L, 32443L,
-32467L, 32479L, 32491L, 32497L, 32503L, 32507L, 32531L, 32533L, 32537L,
-32561L, 32563L, 32569L, 32573L, 32579L, 32587L, 32603L, 32609L, 32611L,
-32621L, 32633L, 32647L, 32653L, 32687L, 32693L, 32707L, 32713L, 32717L,
-32719L, 32749L, 32771L, 32779L, 32783L, 32789L, 32797L, 32801L, 32803L,
-32831L, 32833L, 32839L, 32843L, 32869L, 32887L, 32909L, 32911L, 32917L,
-32933L, 32939L, 32941L, 32957L, 32969L, 32971L, 32983L, 32987L, 32993L,
-32999L, 33013L, 33023L, 33029L, 33037L, 33049L, 33053L, 33071L, 33073L,
-33083L, 33091L, 33107L, 33113L, 33119L, 33149L, 33151L, 33161L, 33179L,
-33181L, 33191L, 33199L, 33203L, 33211L, 33223L, 33247L, 33287L, 33289L,
-33301L, 33311L, 33317L, 33329L, 33331L, 33343L, 33347L, 33349L, 33353L,
-33359L, 33377L, 33391L, 33403L, 33409L, 33413L, 33427L, 33457L, 33461L,
-33469L, 33479L, 33487L, 33493L, 33503L, 33521L, 33529L, 33533L, 33547L,
-33563L, 33569L, 33577L, 33581L, 33587L, 33589L, 33599L, 33601L, 33613L,
-33617L, 33619L, 33623L, 33629L, 33637L, 33641L, 33647L, 33679L, 33703L,
-33713L, 33721L, 33739L, 33749L, 33751L, 33757L, 33767L, 33769L, 33773L,
-33791L, 33797L, 33809L, 33811L, 33827L, 33829L, 33851L, 33857L, 33863L,
-33871L, 33889L, 33893L, 33911L, 33923L, 33931L, 33937L, 33941L, 33961L,
-33967L, 33997L, 34019L, 34031L, 34033L, 34039L, 34057L, 34061L, 34123L,
-34127L, 34129L, 34141L, 34147L, 34157L, 34159L, 34171L, 34183L, 34211L,
-34213L, 34217L, 34231L, 34253L, 34259L, 34261L, 34267L, 34273L, 34283L,
-34297L, 34301L, 34303L, 34313L, 34319L, 34327L, 34337L, 34351L, 34361L,
-34367L, 34369L, 34381L, 34403L, 34421L, 34429L, 34439L, 34457L, 34469L,
-34471L, 34483L, 34487L, 34499L, 34501L, 34511L, 34513L, 34519L, 34537L,
-34543L, 34549L, 34583L, 34589L, 34591L, 34603L, 34607L, 34613L, 34631L,
-34649L, 34651L, 34667L, 34673L, 34679L, 34687L, 34693L, 34703L, 34721L,
-34729L, 34739L, 34747L, 34757L, 34759L, 34763L, 34781L, 34807L, 34819L,
-34841L, 34843L, 34847L, 34849L, 34871L, 34877L, 34883L, 34897L, 34913L,
-34919L, 34939L, 34949L, 34961L, 34963L, 34981L, 35023L, 35027L, 35051L,
-35053L, 35059L, 35069L, 35081L, 35083L, 35089L, 35099L, 35107L, 35111L,
-35117L, 35129L, 35141L, 35149L, 35153L, 35159L, 35171L, 35201L, 35221L,
-35227L, 35251L, 35257L, 35267L, 35279L, 35281L, 35291L, 35311L, 35317L,
-35323L, 35327L, 35339L, 35353L, 35363L, 35381L, 35393L, 35401L, 35407L,
-35419L, 35423L, 35437L, 35447L, 35449L, 35461L, 35491L, 35507L, 35509L,
-35521L, 35527L, 35531L, 35533L, 35537L, 35543L, 35569L, 35573L, 35591L,
-35593L, 35597L, 35603L, 35617L, 35671L, 35677L, 35729L, 35731L, 35747L,
-35753L, 35759L, 35771L, 35797L, 35801L, 35803L, 35809L, 35831L, 35837L,
-35839L, 35851L, 35863L, 35869L, 35879L, 35897L, 35899L, 35911L, 35923L,
-35933L, 35951L, 35963L, 35969L, 35977L, 35983L, 35993L, 35999L, 36007L,
-36011L, 36013L, 36017L, 36037L, 36061L, 36067L, 36073L, 36083L, 36097L,
-36107L, 36109L, 36131L, 36137L, 36151L, 36161L, 36187L, 36191L, 36209L,
-36217L, 36229L, 36241L, 36251L, 36263L, 36269L, 36277L, 36293L, 36299L,
-36307L, 36313L, 36319L, 36341L, 36343L, 36353L, 36373L, 36383L, 36389L,
-36433L, 36451L, 36457L, 36467L, 36469L, 36473L, 36479L, 36493L, 36497L,
-36523L, 36527L, 36529L, 36541L, 36551L, 36559L, 36563L, 36571L, 36583L,
-36587L, 36599L, 36607L, 36629L, 36637L, 36643L, 36653L, 36671L, 36677L,
-36683L, 36691L, 36697L, 36709L, 36713L, 36721L, 36739L, 36749L, 36761L,
-36767L, 36779L, 36781L, 36787L, 36791L, 36793L, 36809L, 36821L, 36833L,
-36847L, 36857L, 36871L, 36877L, 36887L, 36899L, 36901L, 36913L, 36919L,
-36923L, 36929L, 36931L, 36943L, 36947L, 36973L, 36979L, 36997L, 37003L,
-37013L, 37019L, 37021L, 37039L, 37049L, 37057L, 37061L, 37087L, 37097L,
-37117L, 37123L, 37139L, 37159L, 37171L, 37181L, 37189L, 37199L, 37201L,
-37217L, 37223L, 37243L, 37253L, 37273L, 37277L, 37307L, 37309L, 37313L,
-37321L, 37337L, 37339L, 37357L, 37361L, 37363L, 37369L, 37379L, 37397L,
-37409L, 37423L, 37441L, 37447L, 37463L, 37483L, 37489L, 37493L, 37501L,
-37507L, 37511L, 37517L, 37529L, 37537L, 37547L, 37549L, 37561L, 37567L,
-37571L, 37573L, 37579L, 37589L, 37591L, 37607L, 37619L, 37633L, 37643L,
-37649L, 37657L, 37663L, 37691L, 37693L, 37699L, 37717L, 37747L, 37781L,
-37783L, 37799L, 37811L, 37813L, 37831L, 37847L, 37853L, 37861L, 37871L,
-37879L, 37889L, 37897L, 37907L, 37951L, 37957L, 37963L, 37967L, 37987L,
-37991L, 37993L, 37997L, 38011L, 38039L, 38047L, 38053L, 38069L, 38083L,
-38113L, 38119L, 38149L, 38153L, 38167L, 38177L, 38183L, 38189L, 38197L,
-38201L, 38219L, 38231L, 38237L, 38239L, 38261L, 38273L, 38281L, 38287L,
-38299L, 38303L, 38317L, 38321L, 38327L, 38329L, 38333L, 38351L, 38371L,
-38377L, 38393L, 38431L, 38447L, 38449L, 38453L, 38459L, 38461L, 38501L,
-38543L, 38557L, 38561L, 38567L, 38569L, 38593L, 38603L, 38609L, 38611L,
-38629L, 38639L, 38651L, 38653L, 38669L, 38671L, 38677L, 38693L, 38699L,
-38707L, 38711L, 38713L, 38723L, 38729L, 38737L, 38747L, 38749L, 38767L,
-38783L, 38791L, 38803L, 38821L, 38833L, 38839L, 38851L, 38861L, 38867L,
-38873L, 38891L, 38903L, 38917L, 38921L, 38923L, 38933L, 38953L, 38959L,
-38971L, 38977L, 38993L, 39019L, 39023L, 39041L, 39043L, 39047L, 39079L,
-39089L, 39097L, 39103L, 39107L, 39113L, 39119L, 39133L, 39139L, 39157L,
-39161L, 39163L, 39181L, 39191L, 39199L, 39209L, 39217L, 39227L, 39229L,
-39233L, 39239L, 39241L, 39251L, 39293L, 39301L, 39313L, 39317L, 39323L,
-39341L, 39343L, 39359L, 39367L, 39371L, 39373L, 39383L, 39397L, 39409L,
-39419L, 39439L, 39443L, 39451L, 39461L, 39499L, 39503L, 39509L, 39511L,
-39521L, 39541L, 39551L, 39563L, 39569L, 39581L, 39607L, 39619L, 39623L,
-39631L, 39659L, 39667L, 39671L, 39679L, 39703L, 39709L, 39719L, 39727L,
-39733L, 39749L, 39761L, 39769L, 39779L, 39791L, 39799L, 39821L, 39827L,
-39829L, 39839L, 39841L, 39847L, 39857L, 39863L, 39869L, 39877L, 39883L,
-39887L, 39901L, 39929L, 39937L, 39953L, 39971L, 39979L, 39983L, 39989L,
-40009L, 40013L, 40031L, 40037L, 40039L, 40063L, 40087L, 40093L, 40099L,
-40111L, 40123L, 40127L, 40129L, 40151L, 40153L, 40163L, 40169L, 40177L,
-40189L, 40193L, 40213L, 40231L, 40237L, 40241L, 40253L, 40277L, 40283L,
-40289L, 40343L, 40351L, 40357L, 40361L, 40387L, 40423L, 40427L, 40429L,
-40433L, 40459L, 40471L, 40483L, 40487L, 40493L, 40499L, 40507L, 40519L,
-40529L, 40531L, 40543L, 40559L, 40577L, 40583L, 40591L, 40597L, 40609L,
-40627L, 40637L, 40639L, 40693L, 40697L, 40699L, 40709L, 40739L, 40751L,
-40759L, 40763L, 40771L, 40787L, 40801L, 40813L, 40819L, 40823L, 40829L,
-40841L, 40847L, 40849L, 40853L, 40867L, 40879L, 40883L, 40897L, 40903L,
-40927L, 40933L, 40939L, 40949L, 40961L, 40973L, 40993L, 41011L, 41017L,
-41023L, 41039L, 41047L, 41051L, 41057L, 41077L, 41081L, 41113L, 41117L,
-41131L, 41141L, 41143L, 41149L, 41161L, 41177L, 41179L, 41183L, 41189L,
-41201L, 41203L, 41213L, 41221L, 41227L, 41231L, 41233L, 41243L, 41257L,
-41263L, 41269L, 41281L, 41299L, 41333L, 41341L, 41351L, 41357L, 41381L,
-41387L, 41389L, 41399L, 41411L, 41413L, 41443L, 41453L, 41467L, 41479L,
-41491L, 41507L, 41513L, 41519L, 41521L, 41539L, 41543L, 41549L, 41579L,
-41593L, 41597L, 41603L, 41609L, 41611L, 41617L, 41621L, 41627L, 41641L,
-41647L, 41651L, 41659L, 41669L, 41681L, 41687L, 41719L, 41729L, 41737L,
-41759L, 41761L, 41771L, 41777L, 41801L, 41809L, 41813L, 41843L, 41849L,
-41851L, 41863L, 41879L, 41887L, 41893L, 41897L, 41903L, 41911L, 41927L,
-41941L, 41947L, 41953L, 41957L, 41959L, 41969L, 41981L, 41983L, 41999L,
-42013L, 42017L, 42019L, 42023L, 42043L, 42061L, 42071L, 42073L, 42083L,
-42089L, 42101L, 42131L, 42139L, 42157L, 42169L, 42179L, 42181L, 42187L,
-42193L, 42197L, 42209L, 42221L, 42223L, 42227L, 42239L, 42257L, 42281L,
-42283L, 42293L, 42299L, 42307L, 42323L, 42331L, 42337L, 42349L, 42359L,
-42373L, 42379L, 42391L, 42397L, 42403L, 42407L, 42409L, 42433L, 42437L,
-42443L, 42451L, 42457L, 42461L, 42463L, 42467L, 42473L, 42487L, 42491L,
-42499L, 42509L, 42533L, 42557L, 42569L, 42571L, 42577L, 42589L, 42611L,
-42641L, 42643L, 42649L, 42667L, 42677L, 42683L, 42689L, 42697L, 42701L,
-42703L, 42709L, 42719L, 42727L, 42737L, 42743L, 42751L, 42767L, 42773L,
-42787L, 42793L, 42797L, 42821L, 42829L, 42839L, 42841L, 42853L, 42859L,
-42863L, 42899L, 42901L, 42923L, 42929L, 42937L, 42943L, 42953L, 42961L,
-42967L, 42979L, 42989L, 43003L, 43013L, 43019L, 43037L, 43049L, 43051L,
-43063L, 43067L, 43093L, 43103L, 43117L, 43133L, 43151L, 43159L, 43177L,
-43189L, 43201L, 43207L, 43223L, 43237L, 43261L, 43271L, 43283L, 43291L,
-43313L, 43319L, 43321L, 43331L, 43391L, 43397L, 43399L, 43403L, 43411L,
-43427L, 43441L, 43451L, 43457L, 43481L, 43487L, 43499L, 43517L, 43541L,
-43543L, 43573L, 43577L, 43579L, 43591L, 43597L, 43607L, 43609L, 43613L,
-43627L, 43633L, 43649L, 43651L, 43661L, 43669L, 43691L, 43711L, 43717L,
-43721L, 43753L, 43759L, 43777L, 43781L, 43783L, 43787L, 43789L, 43793L,
-43801L, 43853L, 43867L, 43889L, 43891L, 43913L, 43933L, 43943L, 43951L,
-43961L, 43963L, 43969L, 43973L, 43987L, 43991L, 43997L, 44017L, 44021L,
-44027L, 44029L, 44041L, 44053L, 44059L, 44071L, 44087L, 44089L, 44101L,
-44111L, 44119L, 44123L, 44129L, 44131L, 44159L, 44171L, 44179L, 44189L,
-44201L, 44203L, 44207L, 44221L, 44249L, 44257L, 44263L, 44267L, 44269L,
-44273L, 44279L, 44281L, 44293L, 44351L, 44357L, 44371L, 44381L, 44383L,
-44389L, 44417L, 44449L, 44453L, 44483L, 44491L, 44497L, 44501L, 44507L,
-44519L, 44531L, 44533L, 44537L, 44543L, 44549L, 44563L, 44579L, 44587L,
-44617L, 44621L, 44623L, 44633L, 44641L, 44647L, 44651L, 44657L, 44683L,
-44687L, 44699L, 44701L, 44711L, 44729L, 44741L, 44753L, 44771L, 44773L,
-44777L, 44789L, 44797L, 44809L, 44819L, 44839L, 44843L, 44851L, 44867L,
-44879L, 44887L, 44893L, 44909L, 44917L, 44927L, 44939L, 44953L, 44959L,
-44963L, 44971L, 44983L, 44987L, 45007L, 45013L, 45053L, 45061L, 45077L,
-45083L, 45119L, 45121L, 45127L, 45131L, 45137L, 45139L, 45161L, 45179L,
-45181L, 45191L, 45197L, 45233L, 45247L, 45259L, 45263L, 45281L, 45289L,
-45293L, 45307L, 45317L, 45319L, 45329L, 45337L, 45341L, 45343L, 45361L,
-45377L, 45389L, 45403L, 45413L, 45427L, 45433L, 45439L, 45481L, 45491L,
-45497L, 45503L, 45523L, 45533L, 45541L, 45553L, 45557L, 45569L, 45587L,
-45589L, 45599L, 45613L, 45631L, 45641L, 45659L, 45667L, 45673L, 45677L,
-45691L, 45697L, 45707L, 45737L, 45751L, 45757L, 45763L, 45767L, 45779L,
-45817L, 45821L, 45823L, 45827L, 45833L, 45841L, 45853L, 45863L, 45869L,
-45887L, 45893L, 45943L, 45949L, 45953L, 45959L, 45971L, 45979L, 45989L,
-46021L, 46027L, 46049L, 46051L, 46061L, 46073L, 46091L, 46093L, 46099L,
-46103L, 46133L, 46141L, 46147L, 46153L, 46171L, 46181L, 46183L, 46187L,
-46199L, 46219L, 46229L, 46237L, 46261L, 46271L, 46273L, 46279L, 46301L,
-46307L, 46309L, 46327L, 46337L, 46349L, 46351L, 46381L, 46399L, 46411L,
-46439L, 46441L, 46447L, 46451L, 46457L, 46471L, 46477L, 46489L, 46499L,
-46507L, 46511L, 46523L, 46549L, 46559L, 46567L, 46573L, 46589L, 46591L,
-46601L, 46619L, 46633L, 46639L, 46643L, 46649L, 46663L, 46679L, 46681L,
-46687L, 46691L, 46703L, 46723L, 46727L, 46747L, 46751L, 46757L, 46769L,
-46771L, 46807L, 46811L, 46817L, 46819L, 46829L, 46831L, 46853L, 46861L,
-46867L, 46877L, 46889L, 46901L, 46919L, 46933L, 46957L, 46993L, 46997L,
-47017L, 47041L, 47051L, 47057L, 47059L, 47087L, 47093L, 47111L, 47119L,
-47123L, 47129L, 47137L, 47143L, 47147L, 47149L, 47161L, 47189L, 47207L,
-47221L, 47237L, 47251L, 47269L, 47279L, 47287L, 47293L, 47297L, 47303L,
-47309L, 47317L, 47339L, 47351L, 47353L, 47363L, 47381L, 47387L, 47389L,
-47407L, 47417L, 47419L, 47431L, 47441L, 47459L, 47491L, 47497L, 47501L,
-47507L, 47513L, 47521L, 47527L, 47533L, 47543L, 47563L, 47569L, 47581L,
-47591L, 47599L, 47609L, 47623L, 47629L, 47639L, 47653L, 47657L, 47659L,
-47681L, 47699L, 47701L, 47711L, 47713L, 47717L, 47737L, 47741L, 47743L,
-47777L, 47779L, 47791L, 47797L, 47807L, 47809L, 47819L, 47837L, 47843L,
-47857L, 47869L, 47881L, 47903L, 47911L, 47917L, 47933L, 47939L, 47947L,
-47951L, 47963L, 47969L, 47977L, 47981L, 48017L, 48023L, 48029L, 48049L,
-48073L, 48079L, 48091L, 48109L, 48119L, 48121L, 48131L, 48157L, 48163L,
-48179L, 48187L, 48193L, 48197L, 48221L, 48239L, 48247L, 48259L, 48271L,
-48281L, 48299L, 48311L, 48313L, 48337L, 48341L, 48353L, 48371L, 48383L,
-48397L, 48407L, 48409L, 48413L, 48437L, 48449L, 48463L, 48473L, 48479L,
-48481L, 48487L, 48491L, 48497L, 48523L, 48527L, 48533L, 48539L, 48541L,
-48563L, 48571L, 48589L, 48593L, 48611L, 48619L, 48623L, 48647L, 48649L,
-48661L, 48673L, 48677L, 48679L, 48731L, 48733L, 48751L, 48757L, 48761L,
-48767L, 48779L, 48781L, 48787L, 48799L, 48809L, 48817L, 48821L, 48823L,
-48847L, 48857L, 48859L, 48869L, 48871L, 48883L, 48889L, 48907L, 48947L,
-48953L, 48973L, 48989L, 48991L, 49003L, 49009L, 49019L, 49031L, 49033L,
-49037L, 49043L, 49057L, 49069L, 49081L, 49103L, 49109L, 49117L, 49121L,
-49123L, 49139L, 49157L, 49169L, 49171L, 49177L, 49193L, 49199L, 49201L,
-49207L, 49211L, 49223L, 49253L, 49261L, 49277L, 49279L, 49297L, 49307L,
-49331L, 49333L, 49339L, 49363L, 49367L, 49369L, 49391L, 49393L, 49409L,
-49411L, 49417L, 49429L, 49433L, 49451L, 49459L, 49463L, 49477L, 49481L,
-49499L, 49523L, 49529L, 49531L, 49537L, 49547L, 49549L, 49559L, 49597L,
-49603L, 49613L, 49627L, 49633L, 49639L, 49663L, 49667L, 49669L, 49681L,
-49697L, 49711L, 49727L, 49739L, 49741L, 49747L, 49757L, 49783L, 49787L,
-49789L, 49801L, 49807L, 49811L, 49823L, 49831L, 49843L, 49853L, 49871L,
-49877L, 49891L, 49919L, 49921L, 49927L, 49937L, 49939L, 49943L, 49957L,
-49991L, 49993L, 49999L, 50021L, 50023L, 50033L, 50047L, 50051L, 50053L,
-50069L, 50077L, 50087L, 50093L, 50101L, 50111L, 50119L, 50123L, 50129L,
-50131L, 50147L, 50153L, 50159L, 50177L, 50207L, 50221L, 50227L, 50231L,
-50261L, 50263L, 50273L, 50287L, 50291L, 50311L, 50321L, 50329L, 50333L,
-50341L, 50359L, 50363L, 50377L, 50383L, 50387L, 50411L, 50417L, 50423L,
-50441L, 50459L, 50461L, 50497L, 50503L, 50513L, 50527L, 50539L, 50543L,
-50549L, 50551L, 50581L, 50587L, 50591L, 50593L, 50599L, 50627L, 50647L,
-50651L, 50671L, 50683L, 50707L, 50723L, 50741L, 50753L, 50767L, 50773L,
-50777L, 50789L, 50821L, 50833L, 50839L, 50849L, 50857L, 50867L, 50873L,
-50891L, 50893L, 50909L, 50923L, 50929L, 50951L, 50957L, 50969L, 50971L,
-50989L, 50993L, 51001L, 51031L, 51043L, 51047L, 51059L, 51061L, 51071L,
-51109L, 51131L, 51133L, 51137L, 51151L, 51157L, 51169L, 51193L, 51197L,
-51199L, 51203L, 51217L, 51229L, 51239L, 51241L, 51257L, 51263L, 51283L,
-51287L, 51307L, 51329L, 51341L, 51343L, 51347L, 51349L, 51361L, 51383L,
-51407L, 51413L, 51419L, 51421L, 51427L, 51431L, 51437L, 51439L, 51449L,
-51461L, 51473L, 51479L, 51481L, 51487L, 51503L, 51511L, 51517L, 51521L,
-51539L, 51551L, 51563L, 51577L, 51581L, 51593L, 51599L, 51607L, 51613L,
-51631L, 51637L, 51647L, 51659L, 51673L, 51679L, 51683L, 51691L, 51713L,
-51719L, 51721L, 51749L, 51767L, 51769L, 51787L, 51797L, 51803L, 51817L,
-51827L, 51829L, 51839L, 51853L, 51859L, 51869L, 51871L, 51893L, 51899L,
-51907L, 51913L, 51929L, 51941L, 51949L, 51971L, 51973L, 51977L, 51991L,
-52009L, 52021L, 52027L, 52051L, 52057L, 52067L, 52069L, 52081L, 52103L,
-52121L, 52127L, 52147L, 52153L, 52163L, 52177L, 52181L, 52183L, 52189L,
-52201L, 52223L, 52237L, 52249L, 52253L, 52259L, 52267L, 52289L, 52291L,
-52301L, 52313L, 52321L, 52361L, 52363L, 52369L, 52379L, 52387L, 52391L,
-52433L, 52453L, 52457L, 52489L, 52501L, 52511L, 52517L, 52529L, 52541L,
-52543L, 52553L, 52561L, 52567L, 52571L, 52579L, 52583L, 52609L, 52627L,
-52631L, 52639L, 52667L, 52673L, 52691L, 52697L, 52709L, 52711L, 52721L,
-52727L, 52733L, 52747L, 52757L, 52769L, 52783L, 52807L, 52813L, 52817L,
-52837L, 52859L, 52861L, 52879L, 52883L, 52889L, 52901L, 52903L, 52919L,
-52937L, 52951L, 52957L, 52963L, 52967L, 52973L, 52981L, 52999L, 53003L,
-53017L, 53047L, 53051L, 53069L, 53077L, 53087L, 53089L, 53093L, 53101L,
-53113L, 53117L, 53129L, 53147L, 53149L, 53161L, 53171L, 53173L, 53189L,
-53197L, 53201L, 53231L, 53233L, 53239L, 53267L, 53269L, 53279L, 53281L,
-53299L, 53309L, 53323L, 53327L, 53353L, 53359L, 53377L, 53381L, 53401L,
-53407L, 53411L, 53419L, 53437L, 53441L, 53453L, 53479L, 53503L, 53507L,
-53527L, 53549L, 53551L, 53569L, 53591L, 53593L, 53597L, 53609L, 53611L,
-53617L, 53623L, 53629L, 53633L, 53639L, 53653L, 53657L, 53681L, 53693L,
-53699L, 53717L, 53719L, 53731L, 53759L, 53773L, 53777L, 53783L, 53791L,
-53813L, 53819L, 53831L, 53849L, 53857L, 53861L, 53881L, 53887L, 53891L,
-53897L, 53899L, 53917L, 53923L, 53927L, 53939L, 53951L, 53959L, 53987L,
-53993L, 54001L, 54011L, 54013L, 54037L, 54049L, 54059L, 54083L, 54091L,
-54101L, 54121L, 54133L, 54139L, 54151L, 54163L, 54167L, 54181L, 54193L,
-54217L, 54251L, 54269L, 54277L, 54287L, 54293L, 54311L, 54319L, 54323L,
-54331L, 54347L, 54361L, 54367L, 54371L, 54377L, 54401L, 54403L, 54409L,
-54413L, 54419L, 54421L, 54437L, 54443L, 54449L, 54469L, 54493L, 54497L,
-54499L, 54503L, 54517L, 54521L, 54539L, 54541L, 54547L, 54559L, 54563L,
-54577L, 54581L, 54583L, 54601L, 54617L, 54623L, 54629L, 54631L, 54647L,
-54667L, 54673L, 54679L, 54709L, 54713L, 54721L, 54727L, 54751L, 54767L,
-54773L, 54779L, 54787L, 54799L, 54829L, 54833L, 54851L, 54869L, 54877L,
-54881L, 54907L, 54917L, 54919L, 54941L, 54949L, 54959L, 54973L, 54979L,
-54983L, 55001L, 55009L, 55021L, 55049L, 55051L, 55057L, 55061L, 55073L,
-55079L, 55103L, 55109L, 55117L, 55127L, 55147L, 55163L, 55171L, 55201L,
-55207L, 55213L, 55217L, 55219L, 55229L, 55243L, 55249L, 55259L, 55291L,
-55313L, 55331L, 55333L, 55337L, 55339L, 55343L, 55351L, 55373L, 55381L,
-55399L, 55411L, 55439L, 55441L, 55457L, 55469L, 55487L, 55501L, 55511L,
-55529L, 55541L, 55547L, 55579L, 55589L, 55603L, 55609L, 55619L, 55621L,
-55631L, 55633L, 55639L, 55661L, 55663L, 55667L, 55673L, 55681L, 55691L,
-55697L, 55711L, 55717L, 55721L, 55733L, 55763L, 55787L, 55793L, 55799L,
-55807L, 55813L, 55817L, 55819L, 55823L, 55829L, 55837L, 55843L, 55849L,
-55871L, 55889L, 55897L, 55901L, 55903L, 55921L, 55927L, 55931L, 55933L,
-55949L, 55967L, 55987L, 55997L, 56003L, 56009L, 56039L, 56041L, 56053L,
-56081L, 56087L, 56093L, 56099L, 56101L, 56113L, 56123L, 56131L, 56149L,
-56167L, 56171L, 56179L, 56197L, 56207L, 56209L, 56237L, 56239L, 56249L,
-56263L, 56267L, 56269L, 56299L, 56311L, 56333L, 56359L, 56369L, 56377L,
-56383L, 56393L, 56401L, 56417L, 56431L, 56437L, 56443L, 56453L, 56467L,
-56473L, 56477L, 56479L, 56489L, 56501L, 56503L, 56509L, 56519L, 56527L,
-56531L, 56533L, 56543L, 56569L, 56591L, 56597L, 56599L, 56611L, 56629L,
-56633L, 56659L, 56663L, 56671L, 56681L, 56687L, 56701L, 56711L, 56713L,
-56731L, 56737L, 56747L, 56767L, 56773L, 56779L, 56783L, 56807L, 56809L,
-56813L, 56821L, 56827L, 56843L, 56857L, 56873L, 56891L, 56893L, 56897L,
-56909L, 56911L, 56921L, 56923L, 56929L, 56941L, 56951L, 56957L, 56963L,
-56983L, 56989L, 56993L, 56999L, 57037L, 57041L, 57047L, 57059L, 57073L,
-57077L, 57089L, 57097L, 57107L, 57119L, 57131L, 57139L, 57143L, 57149L,
-57163L, 57173L, 57179L, 57191L, 57193L, 57203L, 57221L, 57223L, 57241L,
-57251L, 57259L, 57269L, 57271L, 57283L, 57287L, 57301L, 57329L, 57331L,
-57347L, 57349L, 57367L, 57373L, 57383L, 57389L, 57397L, 57413L, 57427L,
-57457L, 57467L, 57487L, 57493L, 57503L, 57527L, 57529L, 57557L, 57559L,
-57571L, 57587L, 57593L, 57601L, 57637L, 57641L, 57649L, 57653L, 57667L,
-57679L, 57689L, 57697L, 57709L, 57713L, 57719L, 57727L, 57731L, 57737L,
-57751L, 57773L, 57781L, 57787L, 57791L, 57793L, 57803L, 57809L, 57829L,
-57839L, 57847L, 57853L, 57859L, 57881L, 57899L, 57901L, 57917L, 57923L,
-57943L, 57947L, 57973L, 57977L, 57991L, 58013L, 58027L, 58031L, 58043L,
-58049L, 58057L, 58061L, 58067L, 58073L, 58099L, 58109L, 58111L, 58129L,
-58147L, 58151L, 58153L, 58169L, 58171L, 58189L, 58193L, 58199L, 58207L,
-58211L, 58217L, 58229L, 58231L, 58237L, 58243L, 58271L, 58309L, 58313L,
-58321L, 58337L, 58363L, 58367L, 58369L, 58379L, 58391L, 58393L, 58403L,
-58411L, 58417L, 58427L, 58439L, 58441L, 58451L, 58453L, 58477L, 58481L,
-58511L, 58537L, 58543L, 58549L, 58567L, 58573L, 58579L, 58601L, 58603L,
-58613L, 58631L, 58657L, 58661L, 58679L, 58687L, 58693L, 58699L, 58711L,
-58727L, 58733L, 58741L, 58757L, 58763L, 58771L, 58787L, 58789L, 58831L,
-58889L, 58897L, 58901L, 58907L, 58909L, 58913L, 58921L, 58937L, 58943L,
-58963L, 58967L, 58979L, 58991L, 58997L, 59009L, 59011L, 59021L, 59023L,
-59029L, 59051L, 59053L, 59063L, 59069L, 59077L, 59083L, 59093L, 59107L,
-59113L, 59119L, 59123L, 59141L, 59149L, 59159L, 59167L, 59183L, 59197L,
-59207L, 59209L, 59219L, 59221L, 59233L, 59239L, 59243L, 59263L, 59273L,
-59281L, 59333L, 59341L, 59351L, 59357L, 59359L, 59369L, 59377L, 59387L,
-59393L, 59399L, 59407L, 59417L, 59419L, 59441L, 59443L, 59447L, 59453L,
-59467L, 59471L, 59473L, 59497L, 59509L, 59513L, 59539L, 59557L, 59561L,
-59567L, 59581L, 59611L, 59617L, 59621L, 59627L, 59629L, 59651L, 59659L,
-59663L, 59669L, 59671L, 59693L, 59699L, 59707L, 59723L, 59729L, 59743L,
-59747L, 59753L, 59771L, 59779L, 59791L, 59797L, 59809L, 59833L, 59863L,
-59879L, 59887L, 59921L, 59929L, 59951L, 59957L, 59971L, 59981L, 59999L,
-60013L, 60017L, 60029L, 60037L, 60041L, 60077L, 60083L, 60089L, 60091L,
-60101L, 60103L, 60107L, 60127L, 60133L, 60139L, 60149L, 60161L, 60167L,
-60169L, 60209L, 60217L, 60223L, 60251L, 60257L, 60259L, 60271L, 60289L,
-60293L, 60317L, 60331L, 60337L, 60343L, 60353L, 60373L, 60383L, 60397L,
-60413L, 60427L, 60443L, 60449L, 60457L, 60493L, 60497L, 60509L, 60521L,
-60527L, 60539L, 60589L, 60601L, 60607L, 60611L, 60617L, 60623L, 60631L,
-60637L, 60647L, 60649L, 60659L, 60661L, 60679L, 60689L, 60703L, 60719L,
-60727L, 60733L, 60737L, 60757L, 60761L, 60763L, 60773L, 60779L, 60793L,
-60811L, 60821L, 60859L, 60869L, 60887L, 60889L, 60899L, 60901L, 60913L,
-60917L, 60919L, 60923L, 60937L, 60943L, 60953L, 60961L, 61001L, 61007L,
-61027L, 61031L, 61043L, 61051L, 61057L, 61091L, 61099L, 61121L, 61129L,
-61141L, 61151L, 61153L, 61169L, 61211L, 61223L, 61231L, 61253L, 61261L,
-61283L, 61291L, 61297L, 61331L, 61333L, 61339L, 61343L, 61357L, 61363L,
-61379L, 61381L, 61403L, 61409L, 61417L, 61441L, 61463L, 61469L, 61471L,
-61483L, 61487L, 61493L, 61507L, 61511L, 61519L, 61543L, 61547L, 61553L,
-61559L, 61561L, 61583L, 61603L, 61609L, 61613L, 61627L, 61631L, 61637L,
-61643L, 61651L, 61657L, 61667L, 61673L, 61681L, 61687L, 61703L, 61717L,
-61723L, 61729L, 61751L, 61757L, 61781L, 61813L, 61819L, 61837L, 61843L,
-61861L, 61871L, 61879L, 61909L, 61927L, 61933L, 61949L, 61961L, 61967L,
-61979L, 61981L, 61987L, 61991L, 62003L, 62011L, 62017L, 62039L, 62047L,
-62053L, 62057L, 62071L, 62081L, 62099L, 62119L, 62129L, 62131L, 62137L,
-62141L, 62143L, 62171L, 62189L, 62191L, 62201L, 62207L, 62213L, 62219L,
-62233L, 62273L, 62297L, 62299L, 62303L, 62311L, 62323L, 62327L, 62347L,
-62351L, 62383L, 62401L, 62417L, 62423L, 62459L, 62467L, 62473L, 62477L,
-62483L, 62497L, 62501L, 62507L, 62533L, 62539L, 62549L, 62563L, 62581L,
-62591L, 62597L, 62603L, 62617L, 62627L, 62633L, 62639L, 62653L, 62659L,
-62683L, 62687L, 62701L, 62723L, 62731L, 62743L, 62753L, 62761L, 62773L,
-62791L, 62801L, 62819L, 62827L, 62851L, 62861L, 62869L, 62873L, 62897L,
-62903L, 62921L, 62927L, 62929L, 62939L, 62969L, 62971L, 62981L, 62983L,
-62987L, 62989L, 63029L, 63031L, 63059L, 63067L, 63073L, 63079L, 63097L,
-63103L, 63113L, 63127L, 63131L, 63149L, 63179L, 63197L, 63199L, 63211L,
-63241L, 63247L, 63277L, 63281L, 63299L, 63311L, 63313L, 63317L, 63331L,
-63337L, 63347L, 63353L, 63361L, 63367L, 63377L, 63389L, 63391L, 63397L,
-63409L, 63419L, 63421L, 63439L, 63443L, 63463L, 63467L, 63473L, 63487L,
-63493L, 63499L, 63521L, 63527L, 63533L, 63541L, 63559L, 63577L, 63587L,
-63589L, 63599L, 63601L, 63607L, 63611L, 63617L, 63629L, 63647L, 63649L,
-63659L, 63667L, 63671L, 63689L, 63691L, 63697L, 63703L, 63709L, 63719L,
-63727L, 63737L, 63743L, 63761L, 63773L, 63781L, 63793L, 63799L, 63803L,
-63809L, 63823L, 63839L, 63841L, 63853L, 63857L, 63863L, 63901L, 63907L,
-63913L, 63929L, 63949L, 63977L, 63997L, 64007L, 64013L, 64019L, 64033L,
-64037L, 64063L, 64067L, 64081L, 64091L, 64109L, 64123L, 64151L, 64153L,
-64157L, 64171L, 64187L, 64189L, 64217L, 64223L, 64231L, 64237L, 64271L,
-64279L, 64283L, 64301L, 64303L, 64319L, 64327L, 64333L, 64373L, 64381L,
-64399L, 64403L, 64433L, 64439L, 64451L, 64453L, 64483L, 64489L, 64499L,
-64513L, 64553L, 64567L, 64577L, 64579L, 64591L, 64601L, 64609L, 64613L,
-64621L, 64627L, 64633L, 64661L, 64663L, 64667L, 64679L, 64693L, 64709L,
-64717L, 64747L, 64763L, 64781L, 64783L, 64793L, 64811L, 64817L, 64849L,
-64853L, 64871L, 64877L, 64879L, 64891L, 64901L, 64919L, 64921L, 64927L,
-64937L, 64951L, 64969L, 64997L, 65003L, 65011L, 65027L, 65029L, 65033L,
-65053L, 65063L, 65071L, 65089L, 65099L, 65101L, 65111L, 65119L, 65123L,
-65129L, 65141L, 65147L, 65167L, 65171L, 65173L, 65179L, 65183L, 65203L,
-65213L, 65239L, 65257L, 65267L, 65269L, 65287L, 65293L, 65309L, 65323L,
-65327L, 65353L, 65357L, 65371L, 65381L, 65393L, 65407L, 65413L, 65419L,
-65423L, 65437L, 65447L, 65449L, 65479L, 65497L, 65519L, 65521L, 65537L,
-65539L, 65543L, 65551L, 65557L, 65563L, 65579L, 65581L, 65587L, 65599L,
-65609L, 65617L, 65629L, 65633L, 65647L, 65651L, 65657L, 65677L, 65687L,
-65699L, 65701L, 65707L, 65713L, 65717L, 65719L, 65729L, 65731L, 65761L,
-65777L, 65789L, 65809L, 65827L, 65831L, 65837L, 65839L, 65843L, 65851L,
-65867L, 65881L, 65899L, 65921L, 65927L, 65929L, 65951L, 65957L, 65963L,
-65981L, 65983L, 65993L, 66029L, 66037L, 66041L, 66047L, 66067L, 66071L,
-66083L, 66089L, 66103L, 66107L, 66109L, 66137L, 66161L, 66169L, 66173L,
-66179L, 66191L, 66221L, 66239L, 66271L, 66293L, 66301L, 66337L, 66343L,
-66347L, 66359L, 66361L, 66373L, 66377L, 66383L, 66403L, 66413L, 66431L,
-66449L, 66457L, 66463L, 66467L, 66491L, 66499L, 66509L, 66523L, 66529L,
-66533L, 66541L, 66553L, 66569L, 66571L, 66587L, 66593L, 66601L, 66617L,
-66629L, 66643L, 66653L, 66683L, 66697L, 66701L, 66713L, 66721L, 66733L,
-66739L, 66749L, 66751L, 66763L, 66791L, 66797L, 66809L, 66821L, 66841L,
-66851L, 66853L, 66863L, 66877L, 66883L, 66889L, 66919L, 66923L, 66931L,
-66943L, 66947L, 66949L, 66959L, 66973L, 66977L, 67003L, 67021L, 67033L,
-67043L, 67049L, 67057L, 67061L, 67073L, 67079L, 67103L, 67121L, 67129L,
-67139L, 67141L, 67153L, 67157L, 67169L, 67181L, 67187L, 67189L, 67211L,
-67213L, 67217L, 67219L, 67231L, 67247L, 67261L, 67271L, 67273L, 67289L,
-67307L, 67339L, 67343L, 67349L, 67369L, 67391L, 67399L, 67409L, 67411L,
-67421L, 67427L, 67429L, 67433L, 67447L, 67453L, 67477L, 67481L, 67489L,
-67493L, 67499L, 67511L, 67523L, 67531L, 67537L, 67547L, 67559L, 67567L,
-67577L, 67579L, 67589L, 67601L, 67607L, 67619L, 67631L, 67651L, 67679L,
-67699L, 67709L, 67723L, 67733L, 67741L, 67751L, 67757L, 67759L, 67763L,
-67777L, 67783L, 67789L, 67801L, 67807L, 67819L, 67829L, 67843L, 67853L,
-67867L, 67883L, 67891L, 67901L, 67927L, 67931L, 67933L, 67939L, 67943L,
-67957L, 67961L, 67967L, 67979L, 67987L, 67993L, 68023L, 68041L, 68053L,
-68059L, 68071L, 68087L, 68099L, 68111L, 68113L, 68141L, 68147L, 68161L,
-68171L, 68207L, 68209L, 68213L, 68219L, 68227L, 68239L, 68261L, 68279L,
-68281L, 68311L, 68329L, 68351L, 68371L, 68389L, 68399L, 68437L, 68443L,
-68447L, 68449L, 68473L, 68477L, 68483L, 68489L, 68491L, 68501L, 68507L,
-68521L, 68531L, 68539L, 68543L, 68567L, 68581L, 68597L, 68611L, 68633L,
-68639L, 68659L, 68669L, 68683L, 68687L, 68699L, 68711L, 68713L, 68729L,
-68737L, 68743L, 68749L, 68767L, 68771L, 68777L, 68791L, 68813L, 68819L,
-68821L, 68863L, 68879L, 68881L, 68891L, 68897L, 68899L, 68903L, 68909L,
-68917L, 68927L, 68947L, 68963L, 68993L, 69001L, 69011L, 69019L, 69029L,
-69031L, 69061L, 69067L, 69073L, 69109L, 69119L, 69127L, 69143L, 69149L,
-69151L, 69163L, 69191L, 69193L, 69197L, 69203L, 69221L, 69233L, 69239L,
-69247L, 69257L, 69259L, 69263L, 69313L, 69317L, 69337L, 69341L, 69371L,
-69379L, 69383L, 69389L, 69401L, 69403L, 69427L, 69431L, 69439L, 69457L,
-69463L, 69467L, 69473L, 69481L, 69491L, 69493L, 69497L, 69499L, 69539L,
-69557L, 69593L, 69623L, 69653L, 69661L, 69677L, 69691L, 69697L, 69709L,
-69737L, 69739L, 69761L, 69763L, 69767L, 69779L, 69809L, 69821L, 69827L,
-69829L, 69833L, 69847L, 69857L, 69859L, 69877L, 69899L, 69911L, 69929L,
-69931L, 69941L, 69959L, 69991L, 69997L, 70001L, 70003L, 70009L, 70019L,
-70039L, 70051L, 70061L, 70067L, 70079L, 70099L, 70111L, 70117L, 70121L,
-70123L, 70139L, 70141L, 70157L, 70163L, 70177L, 70181L, 70183L, 70199L,
-70201L, 70207L, 70223L, 70229L, 70237L, 70241L, 70249L, 70271L, 70289L,
-70297L, 70309L, 70313L, 70321L, 70327L, 70351L, 70373L, 70379L, 70381L,
-70393L, 70423L, 70429L, 70439L, 70451L, 70457L, 70459L, 70481L, 70487L,
-70489L, 70501L, 70507L, 70529L, 70537L, 70549L, 70571L, 70573L, 70583L,
-70589L, 70607L, 70619L, 70621L, 70627L, 70639L, 70657L, 70663L, 70667L,
-70687L, 70709L, 70717L, 70729L, 70753L, 70769L, 70783L, 70793L, 70823L,
-70841L, 70843L, 70849L, 70853L, 70867L, 70877L, 70879L, 70891L, 70901L,
-70913L, 70919L, 70921L, 70937L, 70949L, 70951L, 70957L, 70969L, 70979L,
-70981L, 70991L, 70997L, 70999L, 71011L, 71023L, 71039L, 71059L, 71069L,
-71081L, 71089L, 71119L, 71129L, 71143L, 71147L, 71153L, 71161L, 71167L,
-71171L, 71191L, 71209L, 71233L, 71237L, 71249L, 71257L, 71261L, 71263L,
-71287L, 71293L, 71317L, 71327L, 71329L, 71333L, 71339L, 71341L, 71347L,
-71353L, 71359L, 71363L, 71387L, 71389L, 71399L, 71411L, 71413L, 71419L,
-71429L, 71437L, 71443L, 71453L, 71471L, 71473L, 71479L, 71483L, 71503L,
-71527L, 71537L, 71549L, 71551L, 71563L, 71569L, 71593L, 71597L, 71633L,
-71647L, 71663L, 71671L, 71693L, 71699L, 71707L, 71711L, 71713L, 71719L,
-71741L, 71761L, 71777L, 71789L, 71807L, 71809L, 71821L, 71837L, 71843L,
-71849L, 71861L, 71867L, 71879L, 71881L, 71887L, 71899L, 71909L, 71917L,
-71933L, 71941L, 71947L, 71963L, 71971L, 71983L, 71987L, 71993L, 71999L,
-72019L, 72031L, 72043L, 72047L, 72053L, 72073L, 72077L, 72089L, 72091L,
-72101L, 72103L, 72109L, 72139L, 72161L, 72167L, 72169L, 72173L, 72211L,
-72221L, 72223L, 72227L, 72229L, 72251L, 72253L, 72269L, 72271L, 72277L,
-72287L, 72307L, 72313L, 72337L, 72341L, 72353L, 72367L, 72379L, 72383L,
-72421L, 72431L, 72461L, 72467L, 72469L, 72481L, 72493L, 72497L, 72503L,
-72533L, 72547L, 72551L, 72559L, 72577L, 72613L, 72617L, 72623L, 72643L,
-72647L, 72649L, 72661L, 72671L, 72673L, 72679L, 72689L, 72701L, 72707L,
-72719L, 72727L, 72733L, 72739L, 72763L, 72767L, 72797L, 72817L, 72823L,
-72859L, 72869L, 72871L, 72883L, 72889L, 72893L, 72901L, 72907L, 72911L,
-72923L, 72931L, 72937L, 72949L, 72953L, 72959L, 72973L, 72977L, 72997L,
-73009L, 73013L, 73019L, 73037L, 73039L, 73043L, 73061L, 73063L, 73079L,
-73091L, 73121L, 73127L, 73133L, 73141L, 73181L, 73189L, 73237L, 73243L,
-73259L, 73277L, 73291L, 73303L, 73309L, 73327L, 73331L, 73351L, 73361L,
-73363L, 73369L, 73379L, 73387L, 73417L, 73421L, 73433L, 73453L, 73459L,
-73471L, 73477L, 73483L, 73517L, 73523L, 73529L, 73547L, 73553L, 73561L,
-73571L, 73583L, 73589L, 73597L, 73607L, 73609L, 73613L, 73637L, 73643L,
-73651L, 73673L, 73679L, 73681L, 73693L, 73699L, 73709L, 73721L, 73727L,
-73751L, 73757L, 73771L, 73783L, 73819L, 73823L, 73847L, 73849L, 73859L,
-73867L, 73877L, 73883L, 73897L, 73907L, 73939L, 73943L, 73951L, 73961L,
-73973L, 73999L, 74017L, 74021L, 74027L, 74047L, 74051L, 74071L, 74077L,
-74093L, 74099L, 74101L, 74131L, 74143L, 74149L, 74159L, 74161L, 74167L,
-74177L, 74189L, 74197L, 74201L, 74203L, 74209L, 74219L, 74231L, 74257L,
-74279L, 74287L, 74293L, 74297L, 74311L, 74317L, 74323L, 74353L, 74357L,
-74363L, 74377L, 74381L, 74383L, 74411L, 74413L, 74419L, 74441L, 74449L,
-74453L, 74471L, 74489L, 74507L, 74509L, 74521L, 74527L, 74531L, 74551L,
-74561L, 74567L, 74573L, 74587L, 74597L, 74609L, 74611L, 74623L, 74653L,
-74687L, 74699L, 74707L, 74713L, 74717L, 74719L, 74729L, 74731L, 74747L,
-74759L, 74761L, 74771L, 74779L, 74797L, 74821L, 74827L, 74831L, 74843L,
-74857L, 74861L, 74869L, 74873L, 74887L, 74891L, 74897L, 74903L, 74923L,
-74929L, 74933L, 74941L, 74959L, 75011L, 75013L, 75017L, 75029L, 75037L,
-75041L, 75079L, 75083L, 75109L, 75133L, 75149L, 75161L, 75167L, 75169L,
-75181L, 75193L, 75209L, 75211L, 75217L, 75223L, 75227L, 75239L, 75253L,
-75269L, 75277L, 75289L, 75307L, 75323L, 75329L, 75337L, 75347L, 75353L,
-75367L, 75377L, 75389L, 75391L, 75401L, 75403L, 75407L, 75431L, 75437L,
-75479L, 75503L, 75511L, 75521L, 75527L, 75533L, 75539L, 75541L, 75553L,
-75557L, 75571L, 75577L, 75583L, 75611L, 75617L, 75619L, 75629L, 75641L,
-75653L, 75659L, 75679L, 75683L, 75689L, 75703L, 75707L, 75709L, 75721L,
-75731L, 75743L, 75767L, 75773L, 75781L, 75787L, 75793L, 75797L, 75821L,
-75833L, 75853L, 75869L, 75883L, 75913L, 75931L, 75937L, 75941L, 75967L,
-75979L, 75983L, 75989L, 75991L, 75997L, 76001L, 76003L, 76031L, 76039L,
-76079L, 76081L, 76091L, 76099L, 76103L, 76123L, 76129L, 76147L, 76157L,
-76159L, 76163L, 76207L, 76213L, 76231L, 76243L, 76249L, 76253L, 76259L,
-76261L, 76283L, 76289L, 76303L, 76333L, 76343L, 76367L, 76369L, 76379L,
-76387L, 76403L, 76421L, 76423L, 76441L, 76463L, 76471L, 76481L, 76487L,
-76493L, 76507L, 76511L, 76519L, 76537L, 76541L, 76543L, 76561L, 76579L,
-76597L, 76603L, 76607L, 76631L, 76649L, 76651L, 76667L, 76673L, 76679L,
-76697L, 76717L, 76733L, 76753L, 76757L, 76771L, 76777L, 76781L, 76801L,
-76819L, 76829L, 76831L, 76837L, 76847L, 76871L, 76873L, 76883L, 76907L,
-76913L, 76919L, 76943L, 76949L, 76961L, 76963L, 76991L, 77003L, 77017L,
-77023L, 77029L, 77041L, 77047L, 77069L, 77081L, 77093L, 77101L, 77137L,
-77141L, 77153L, 77167L, 77171L, 77191L, 77201L, 77213L, 77237L, 77239L,
-77243L, 77249L, 77261L, 77263L, 77267L, 77269L, 77279L, 77291L, 77317L,
-77323L, 77339L, 77347L, 77351L, 77359L, 77369L, 77377L, 77383L, 77417L,
-77419L, 77431L, 77447L, 77471L, 77477L, 77479L, 77489L, 77491L, 77509L,
-77513L, 77521L, 77527L, 77543L, 77549L, 77551L, 77557L, 77563L, 77569L,
-77573L, 77587L, 77591L, 77611L, 77617L, 77621L, 77641L, 77647L, 77659L,
-77681L, 77687L, 77689L, 77699L, 77711L, 77713L, 77719L, 77723L, 77731L,
-77743L, 77747L, 77761L, 77773L, 77783L, 77797L, 77801L, 77813L, 77839L,
-77849L, 77863L, 77867L, 77893L, 77899L, 77929L, 77933L, 77951L, 77969L,
-77977L, 77983L, 77999L, 78007L, 78017L, 78031L, 78041L, 78049L, 78059L,
-78079L, 78101L, 78121L, 78137L, 78139L, 78157L, 78163L, 78167L, 78173L,
-78179L, 78191L, 78193L, 78203L, 78229L, 78233L, 78241L, 78259L, 78277L,
-78283L, 78301L, 78307L, 78311L, 78317L, 78341L, 78347L, 78367L, 78401L,
-78427L, 78437L, 78439L, 78467L, 78479L, 78487L, 78497L, 78509L, 78511L,
-78517L, 78539L, 78541L, 78553L, 78569L, 78571L, 78577L, 78583L, 78593L,
-78607L, 78623L, 78643L, 78649L, 78653L, 78691L, 78697L, 78707L, 78713L,
-78721L, 78737L, 78779L, 78781L, 78787L, 78791L, 78797L, 78803L, 78809L,
-78823L, 78839L, 78853L, 78857L, 78877L, 78887L, 78889L, 78893L, 78901L,
-78919L, 78929L, 78941L, 78977L, 78979L, 78989L, 79031L, 79039L, 79043L,
-79063L, 79087L, 79103L, 79111L, 79133L, 79139L, 79147L, 79151L, 79153L,
-79159L, 79181L, 79187L, 79193L, 79201L, 79229L, 79231L, 79241L, 79259L,
-79273L, 79279L, 79283L, 79301L, 79309L, 79319L, 79333L, 79337L, 79349L,
-79357L, 79367L, 79379L, 79393L, 79397L, 79399L, 79411L, 79423L, 79427L,
-79433L, 79451L, 79481L, 79493L, 79531L, 79537L, 79549L, 79559L, 79561L,
-79579L, 79589L, 79601L, 79609L, 79613L, 79621L, 79627L, 79631L, 79633L,
-79657L, 79669L, 79687L, 79691L, 79693L, 79697L, 79699L, 79757L, 79769L,
-79777L, 79801L, 79811L, 79813L, 79817L, 79823L, 79829L, 79841L, 79843L,
-79847L, 79861L, 79867L, 79873L, 79889L, 79901L, 79903L, 79907L, 79939L,
-79943L, 79967L, 79973L, 79979L, 79987L, 79997L, 79999L, 80021L, 80039L,
-80051L, 80071L, 80077L, 80107L, 80111L, 80141L, 80147L, 80149L, 80153L,
-80167L, 80173L, 80177L, 80191L, 80207L, 80209L, 80221L, 80231L, 80233L,
-80239L, 80251L, 80263L, 80273L, 80279L, 80287L, 80309L, 80317L, 80329L,
-80341L, 80347L, 80363L, 80369L, 80387L, 80407L, 80429L, 80447L, 80449L,
-80471L, 80473L, 80489L, 80491L, 80513L, 80527L, 80537L, 80557L, 80567L,
-80599L, 80603L, 80611L, 80621L, 80627L, 80629L, 80651L, 80657L, 80669L,
-80671L, 80677L, 80681L, 80683L, 80687L, 80701L, 80713L, 80737L, 80747L,
-80749L, 80761L, 80777L, 80779L, 80783L, 80789L, 80803L, 80809L, 80819L,
-80831L, 80833L, 80849L, 80863L, 80897L, 80909L, 80911L, 80917L, 80923L,
-80929L, 80933L, 80953L, 80963L, 80989L, 81001L, 81013L, 81017L, 81019L,
-81023L, 81031L, 81041L, 81043L, 81047L, 81049L, 81071L, 81077L, 81083L,
-81097L, 81101L, 81119L, 81131L, 81157L, 81163L, 81173L, 81181L, 81197L,
-81199L, 81203L, 81223L, 81233L, 81239L, 81281L, 81283L, 81293L, 81299L,
-81307L, 81331L, 81343L, 81349L, 81353L, 81359L, 81371L, 81373L, 81401L,
-81409L, 81421L, 81439L, 81457L, 81463L, 81509L, 81517L, 81527L, 81533L,
-81547L, 81551L, 81553L, 81559L, 81563L, 81569L, 81611L, 81619L, 81629L,
-81637L, 81647L, 81649L, 81667L, 81671L, 81677L, 81689L, 81701L, 81703L,
-81707L, 81727L, 81737L, 81749L, 81761L, 81769L, 81773L, 81799L, 81817L,
-81839L, 81847L, 81853L, 81869L, 81883L, 81899L, 81901L, 81919L, 81929L,
-81931L, 81937L, 81943L, 81953L, 81967L, 81971L, 81973L, 82003L, 82007L,
-82009L, 82013L, 82021L, 82031L, 82037L, 82039L, 82051L, 82067L, 82073L,
-82129L, 82139L, 82141L, 82153L, 82163L, 82171L, 82183L, 82189L, 82193L,
-82207L, 82217L, 82219L, 82223L, 82231L, 82237L, 82241L, 82261L, 82267L,
-82279L, 82301L, 82307L, 82339L, 82349L, 82351L, 82361L, 82373L, 82387L,
-82393L, 82421L, 82457L, 82463L, 82469L, 82471L, 82483L, 82487L, 82493L,
-82499L, 82507L, 82529L, 82531L, 82549L, 82559L, 82561L, 82567L, 82571L,
-82591L, 82601L, 82609L, 82613L, 82619L, 82633L, 82651L, 82657L, 82699L,
-82721L, 82723L, 82727L, 82729L, 82757L, 82759L, 82763L, 82781L, 82787L,
-82793L, 82799L, 82811L, 82813L, 82837L, 82847L, 82883L, 82889L, 82891L,
-82903L, 82913L, 82939L, 82963L, 82981L, 82997L, 83003L, 83009L, 83023L,
-83047L, 83059L, 83063L, 83071L, 83077L, 83089L, 83093L, 83101L, 83117L,
-83137L, 83177L, 83203L, 83207L, 83219L, 83221L, 83227L, 83231L, 83233L,
-83243L, 83257L, 83267L, 83269L, 83273L, 83299L, 83311L, 83339L, 83341L,
-83357L, 83383L, 83389L, 83399L, 83401L, 83407L, 83417L, 83423L, 83431L,
-83437L, 83443L, 83449L, 83459L, 83471L, 83477L, 83497L, 83537L, 83557L,
-83561L, 83563L, 83579L, 83591L, 83597L, 83609L, 83617L, 83621L, 83639L,
-83641L, 83653L, 83663L, 83689L, 83701L, 83717L, 83719L, 83737L, 83761L,
-83773L, 83777L, 83791L, 83813L, 83833L, 83843L, 83857L, 83869L, 83873L,
-83891L, 83903L, 83911L, 83921L, 83933L, 83939L, 83969L, 83983L, 83987L,
-84011L, 84017L, 84047L, 84053L, 84059L, 84061L, 84067L, 84089L, 84121L,
-84127L, 84131L, 84137L, 84143L, 84163L, 84179L, 84181L, 84191L, 84199L,
-84211L, 84221L, 84223L, 84229L, 84239L, 84247L, 84263L, 84299L, 84307L,
-84313L, 84317L, 84319L, 84347L, 84349L, 84377L, 84389L, 84391L, 84401L,
-84407L, 84421L, 84431L, 84437L, 84443L, 84449L, 84457L, 84463L, 84467L,
-84481L, 84499L, 84503L, 84509L, 84521L, 84523L, 84533L, 84551L, 84559L,
-84589L, 84629L, 84631L, 84649L, 84653L, 84659L, 84673L, 84691L, 84697L,
-84701L, 84713L, 84719L, 84731L, 84737L, 84751L, 84761L, 84787L, 84793L,
-84809L, 84811L, 84827L, 84857L, 84859L, 84869L, 84871L, 84913L, 84919L,
-84947L, 84961L, 84967L, 84977L, 84979L, 84991L, 85009L, 85021L, 85027L,
-85037L, 85049L, 85061L, 85081L, 85087L, 85091L, 85093L, 85103L, 85109L,
-85121L, 85133L, 85147L, 85159L, 85193L, 85199L, 85201L, 85213L, 85223L,
-85229L, 85237L, 85243L, 85247L, 85259L, 85297L, 85303L, 85313L, 85331L,
-85333L, 85361L, 85363L, 85369L, 85381L, 85411L, 85427L, 85429L, 85439L,
-85447L, 85451L, 85453L, 85469L, 85487L, 85513L, 85517L, 85523L, 85531L,
-85549L, 85571L, 85577L, 85597L, 85601L, 85607L, 85619L, 85621L, 85627L,
-85639L, 85643L, 85661L, 85667L, 85669L, 85691L, 85703L, 85711L, 85717L,
-85733L, 85751L, 85781L, 85793L, 85817L, 85819L, 85829L, 85831L, 85837L,
-85843L, 85847L, 85853L, 85889L, 85903L, 85909L, 85931L, 85933L, 85991L,
-85999L, 86011L, 86017L, 86027L, 86029L, 86069L, 86077L, 86083L, 86111L,
-86113L, 86117L, 86131L, 86137L, 86143L, 86161L, 86171L, 86179L, 86183L,
-86197L, 86201L, 86209L, 86239L, 86243L, 86249L, 86257L, 86263L, 86269L,
-86287L, 86291L, 86293L, 86297L, 86311L, 86323L, 86341L, 86351L, 86353L,
-86357L, 86369L, 86371L, 86381L, 86389L, 86399L, 86413L, 86423L, 86441L,
-86453L, 86461L, 86467L, 86477L, 86491L, 86501L, 86509L, 86531L, 86533L,
-86539L, 86561L, 86573L, 86579L, 86587L, 86599L, 86627L, 86629L, 86677L,
-86689L, 86693L, 86711L, 86719L, 86729L, 86743L, 86753L, 86767L, 86771L,
-86783L, 86813L, 86837L, 86843L, 86851L, 86857L, 86861L, 86869L, 86923L,
-86927L, 86929L, 86939L, 86951L, 86959L, 86969L, 86981L, 86993L, 87011L,
-87013L, 87037L, 87041L, 87049L, 87071L, 87083L, 87103L, 87107L, 87119L,
-87121L, 87133L, 87149L, 87151L, 87179L, 87181L, 87187L, 87211L, 87221L,
-87223L, 87251L, 87253L, 87257L, 87277L, 87281L, 87293L, 87299L, 87313L,
-87317L, 87323L, 87337L, 87359L, 87383L, 87403L, 87407L, 87421L, 87427L,
-87433L, 87443L, 87473L, 87481L, 87491L, 87509L, 87511L, 87517L, 87523L,
-87539L, 87541L, 87547L, 87553L, 87557L, 87559L, 87583L, 87587L, 87589L,
-87613L, 87623L, 87629L, 87631L, 87641L, 87643L, 87649L, 87671L, 87679L,
-87683L, 87691L, 87697L, 87701L, 87719L, 87721L, 87739L, 87743L, 87751L,
-87767L, 87793L, 87797L, 87803L, 87811L, 87833L, 87853L, 87869L, 87877L,
-87881L, 87887L, 87911L, 87917L, 87931L, 87943L, 87959L, 87961L, 87973L,
-87977L, 87991L, 88001L, 88003L, 88007L, 88019L, 88037L, 88069L, 88079L,
-88093L, 88117L, 88129L, 88169L, 88177L, 88211L, 88223L, 88237L, 88241L,
-88259L, 88261L, 88289L, 88301L, 88321L, 88327L, 88337L, 88339L, 88379L,
-88397L, 88411L, 88423L, 88427L, 88463L, 88469L, 88471L, 88493L, 88499L,
-88513L, 88523L, 88547L, 88589L, 88591L, 88607L, 88609L, 88643L, 88651L,
-88657L, 88661L, 88663L, 88667L, 88681L, 88721L, 88729L, 88741L, 88747L,
-88771L, 88789L, 88793L, 88799L, 88801L, 88807L, 88811L, 88813L, 88817L,
-88819L, 88843L, 88853L, 88861L, 88867L, 88873L, 88883L, 88897L, 88903L,
-88919L, 88937L, 88951L, 88969L, 88993L, 88997L, 89003L, 89009L, 89017L,
-89021L, 89041L, 89051L, 89057L, 89069L, 89071L, 89083L, 89087L, 89101L,
-89107L, 89113L, 89119L, 89123L, 89137L, 89153L, 89189L, 89203L, 89209L,
-89213L, 89227L, 89231L, 89237L, 89261L, 89269L, 89273L, 89293L, 89303L,
-89317L, 89329L, 89363L, 89371L, 89381L, 89387L, 89393L, 89399L, 89413L,
-89417L, 89431L, 89443L, 89449L, 89459L, 89477L, 89491L, 89501L, 89513L,
-89519L, 89521L, 89527L, 89533L, 89561L, 89563L, 89567L, 89591L, 89597L,
-89599L, 89603L, 89611L, 89627L, 89633L, 89653L, 89657L, 89659L, 89669L,
-89671L, 89681L, 89689L, 89753L, 89759L, 89767L, 89779L, 89783L, 89797L,
-89809L, 89819L, 89821L, 89833L, 89839L, 89849L, 89867L, 89891L, 89897L,
-89899L, 89909L, 89917L, 89923L, 89939L, 89959L, 89963L, 89977L, 89983L,
-89989L, 90001L, 90007L, 90011L, 90017L, 90019L, 90023L, 90031L, 90053L,
-90059L, 90067L, 90071L, 90073L, 90089L, 90107L, 90121L, 90127L, 90149L,
-90163L, 90173L, 90187L, 90191L, 90197L, 90199L, 90203L, 90217L, 90227L,
-90239L, 90247L, 90263L, 90271L, 90281L, 90289L, 90313L, 90353L, 90359L,
-90371L, 90373L, 90379L, 90397L, 90401L, 90403L, 90407L, 90437L, 90439L,
-90469L, 90473L, 90481L, 90499L, 90511L, 90523L, 90527L, 90529L, 90533L,
-90547L, 90583L, 90599L, 90617L, 90619L, 90631L, 90641L, 90647L, 90659L,
-90677L, 90679L, 90697L, 90703L, 90709L, 90731L, 90749L, 90787L, 90793L,
-90803L, 90821L, 90823L, 90833L, 90841L, 90847L, 90863L, 90887L, 90901L,
-90907L, 90911L, 90917L, 90931L, 90947L, 90971L, 90977L, 90989L, 90997L,
-91009L, 91019L, 91033L, 91079L, 91081L, 91097L, 91099L, 91121L, 91127L,
-91129L, 91139L, 91141L, 91151L, 91153L, 91159L, 91163L, 91183L, 91193L,
-91199L, 91229L, 91237L, 91243L, 91249L, 91253L, 91283L, 91291L, 91297L,
-91303L, 91309L, 91331L, 91367L, 91369L, 91373L, 91381L, 91387L, 91393L,
-91397L, 91411L, 91423L, 91433L, 91453L, 91457L, 91459L, 91463L, 91493L,
-91499L, 91513L, 91529L, 91541L, 91571L, 91573L, 91577L, 91583L, 91591L,
-91621L, 91631L, 91639L, 91673L, 91691L, 91703L, 91711L, 91733L, 91753L,
-91757L, 91771L, 91781L, 91801L, 91807L, 91811L, 91813L, 91823L, 91837L,
-91841L, 91867L, 91873L, 91909L, 91921L, 91939L, 91943L, 91951L, 91957L,
-91961L, 91967L, 91969L, 91997L, 92003L, 92009L, 92033L, 92041L, 92051L,
-92077L, 92083L, 92107L, 92111L, 92119L, 92143L, 92153L, 92173L, 92177L,
-92179L, 92189L, 92203L, 92219L, 92221L, 92227L, 92233L, 92237L, 92243L,
-92251L, 92269L, 92297L, 92311L, 92317L, 92333L, 92347L, 92353L, 92357L,
-92363L, 92369L, 92377L, 92381L, 92383L, 92387L, 92399L, 92401L, 92413L,
-92419L, 92431L, 92459L, 92461L, 92467L, 92479L, 92489L, 92503L, 92507L,
-92551L, 92557L, 92567L, 92569L, 92581L, 92593L, 92623L, 92627L, 92639L,
-92641L, 92647L, 92657L, 92669L, 92671L, 92681L, 92683L, 92693L, 92699L,
-92707L, 92717L, 92723L, 92737L, 92753L, 92761L, 92767L, 92779L, 92789L,
-92791L, 92801L, 92809L, 92821L, 92831L, 92849L, 92857L, 92861L, 92863L,
-92867L, 92893L, 92899L, 92921L, 92927L, 92941L, 92951L, 92957L, 92959L,
-92987L, 92993L, 93001L, 93047L, 93053L, 93059L, 93077L, 93083L, 93089L,
-93097L, 93103L, 93113L, 93131L, 93133L, 93139L, 93151L, 93169L, 93179L,
-93187L, 93199L, 93229L, 93239L, 93241L, 93251L, 93253L, 93257L, 93263L,
-93281L, 93283L, 93287L, 93307L, 93319L, 93323L, 93329L, 93337L, 93371L,
-93377L, 93383L, 93407L, 93419L, 93427L, 93463L, 93479L, 93481L, 93487L,
-93491L, 93493L, 93497L, 93503L, 93523L, 93529L, 93553L, 93557L, 93559L,
-93563L, 93581L, 93601L, 93607L, 93629L, 93637L, 93683L, 93701L, 93703L,
-93719L, 93739L, 93761L, 93763L, 93787L, 93809L, 93811L, 93827L, 93851L,
-93871L, 93887L, 93889L, 93893L, 93901L, 93911L, 93913L, 93923L, 93937L,
-93941L, 93949L, 93967L, 93971L, 93979L, 93983L, 93997L, 94007L, 94009L,
-94033L, 94049L, 94057L, 94063L, 94079L, 94099L, 94109L, 94111L, 94117L,
-94121L, 94151L, 94153L, 94169L, 94201L, 94207L, 94219L, 94229L, 94253L,
-94261L, 94273L, 94291L, 94307L, 94309L, 94321L, 94327L, 94331L, 94343L,
-94349L, 94351L, 94379L, 94397L, 94399L, 94421L, 94427L, 94433L, 94439L,
-94441L, 94447L, 94463L, 94477L, 94483L, 94513L, 94529L, 94531L, 94541L,
-94543L, 94547L, 94559L, 94561L, 94573L, 94583L, 94597L, 94603L, 94613L,
-94621L, 94649L, 94651L, 94687L, 94693L, 94709L, 94723L, 94727L, 94747L,
-94771L, 94777L, 94781L, 94789L, 94793L, 94811L, 94819L, 94823L, 94837L,
-94841L, 94847L, 94849L, 94873L, 94889L, 94903L, 94907L, 94933L, 94949L,
-94951L, 94961L, 94993L, 94999L, 95003L, 95009L, 95021L, 95027L, 95063L,
-95071L, 95083L, 95087L, 95089L, 95093L, 95101L, 95107L, 95111L, 95131L,
-95143L, 95153L, 95177L, 95189L, 95191L, 95203L, 95213L, 95219L, 95231L,
-95233L, 95239L, 95257L, 95261L, 95267L, 95273L, 95279L, 95287L, 95311L,
-95317L, 95327L, 95339L, 95369L, 95383L, 95393L, 95401L, 95413L, 95419L,
-95429L, 95441L, 95443L, 95461L, 95467L, 95471L, 95479L, 95483L, 95507L,
-95527L, 95531L, 95539L, 95549L, 95561L, 95569L, 95581L, 95597L, 95603L,
-95617L, 95621L, 95629L, 95633L, 95651L, 95701L, 95707L, 95713L, 95717L,
-95723L, 95731L, 95737L, 95747L, 95773L, 95783L, 95789L, 95791L, 95801L,
-95803L, 95813L, 95819L, 95857L, 95869L, 95873L, 95881L, 95891L, 95911L,
-95917L, 95923L, 95929L, 95947L, 95957L, 95959L, 95971L, 95987L, 95989L,
-96001L, 96013L, 96017L, 96043L, 96053L, 96059L, 96079L, 96097L, 96137L,
-96149L, 96157L, 96167L, 96179L, 96181L, 96199L, 96211L, 96221L, 96223L,
-96233L, 96259L, 96263L, 96269L, 96281L, 96289L, 96293L, 96323L, 96329L,
-96331L, 96337L, 96353L, 96377L, 96401L, 96419L, 96431L, 96443L, 96451L,
-96457L, 96461L, 96469L, 96479L, 96487L, 96493L, 96497L, 96517L, 96527L,
-96553L, 96557L, 96581L, 96587L, 96589L, 96601L, 96643L, 96661L, 96667L,
-96671L, 96697L, 96703L, 96731L, 96737L, 96739L, 96749L, 96757L, 96763L,
-96769L, 96779L, 96787L, 96797L, 96799L, 96821L, 96823L, 96827L, 96847L,
-96851L, 96857L, 96893L, 96907L, 96911L, 96931L, 96953L, 96959L, 96973L,
-96979L, 96989L, 96997L, 97001L, 97003L, 97007L, 97021L, 97039L, 97073L,
-97081L, 97103L, 97117L, 97127L, 97151L, 97157L, 97159L, 97169L, 97171L,
-97177L, 97187L, 97213L, 97231L, 97241L, 97259L, 97283L, 97301L, 97303L,
-97327L, 97367L, 97369L, 97373L, 97379L, 97381L, 97387L, 97397L, 97423L,
-97429L, 97441L, 97453L, 97459L, 97463L, 97499L, 97501L, 97511L, 97523L,
-97547L, 97549L, 97553L, 97561L, 97571L, 97577L, 97579L, 97583L, 97607L,
-97609L, 97613L, 97649L, 97651L, 97673L, 97687L, 97711L, 97729L, 97771L,
-97777L, 97787L, 97789L, 97813L, 97829L, 97841L, 97843L, 97847L, 97849L,
-97859L, 97861L, 97871L, 97879L, 97883L, 97919L, 97927L, 97931L, 97943L,
-97961L, 97967L, 97973L, 97987L, 98009L, 98011L, 98017L, 98041L, 98047L,
-98057L, 98081L, 98101L, 98123L, 98129L, 98143L, 98179L, 98207L, 98213L,
-98221L, 98227L, 98251L, 98257L, 98269L, 98297L, 98299L, 98317L, 98321L,
-98323L, 98327L, 98347L, 98369L, 98377L, 98387L, 98389L, 98407L, 98411L,
-98419L, 98429L, 98443L, 98453L, 98459L, 98467L, 98473L, 98479L, 98491L,
-98507L, 98519L, 98533L, 98543L, 98561L, 98563L, 98573L, 98597L, 98621L,
-98627L, 98639L, 98641L, 98663L, 98669L, 98689L, 98711L, 98713L, 98717L,
-98729L, 98731L, 98737L, 98773L, 98779L, 98801L, 98807L, 98809L, 98837L,
-98849L, 98867L, 98869L, 98873L, 98887L, 98893L, 98897L, 98899L, 98909L,
-98911L, 98927L, 98929L, 98939L, 98947L, 98953L, 98963L, 98981L, 98993L,
-98999L, 99013L, 99017L, 99023L, 99041L, 99053L, 99079L, 99083L, 99089L,
-99103L, 99109L, 99119L, 99131L, 99133L, 99137L, 99139L, 99149L, 99173L,
-99181L, 99191L, 99223L, 99233L, 99241L, 99251L, 99257L, 99259L, 99277L,
-99289L, 99317L, 99347L, 99349L, 99367L, 99371L, 99377L, 99391L, 99397L,
-99401L, 99409L, 99431L, 99439L, 99469L, 99487L, 99497L, 99523L, 99527L,
-99529L, 99551L, 99559L, 99563L, 99571L, 99577L, 99581L, 99607L, 99611L,
-99623L, 99643L, 99661L, 99667L, 99679L, 99689L, 99707L, 99709L, 99713L,
-99719L, 99721L, 99733L, 99761L, 99767L, 99787L, 99793L, 99809L, 99817L,
-99823L, 99829L, 99833L, 99839L, 99859L, 99871L, 99877L, 99881L, 99901L,
-99907L, 99923L, 99929L, 99961L, 99971L, 99989L, 99991L, 100003L, 100019L,
-100043L, 100049L, 100057L, 100069L, 100103L, 100109L, 100129L, 100151L, 100153L,
-100169L, 100183L, 100189L, 100193L, 100207L, 100213L, 100237L, 100267L, 100271L,
-100279L, 100291L, 100297L, 100313L, 100333L, 100343L, 100357L, 100361L, 100363L,
-100379L, 100391L, 100393L, 100403L, 100411L, 100417L, 100447L, 100459L, 100469L,
-100483L, 100493L, 100501L, 100511L, 100517L, 100519L, 100523L, 100537L, 100547L,
-100549L, 100559L, 100591L, 100609L, 100613L, 100621L, 100649L, 100669L, 100673L,
-100693L, 100699L, 100703L, 100733L, 100741L, 100747L, 100769L, 100787L, 100799L,
-100801L, 100811L, 100823L, 100829L, 100847L, 100853L, 100907L, 100913L, 100927L,
-100931L, 100937L, 100943L, 100957L, 100981L, 100987L, 100999L, 101009L, 101021L,
-101027L, 101051L, 101063L, 101081L, 101089L, 101107L, 101111L, 101113L, 101117L,
-101119L, 101141L, 101149L, 101159L, 101161L, 101173L, 101183L, 101197L, 101203L,
-101207L, 101209L, 101221L, 101267L, 101273L, 101279L, 101281L, 101287L, 101293L,
-101323L, 101333L, 101341L, 101347L, 101359L, 101363L, 101377L, 101383L, 101399L,
-101411L, 101419L, 101429L, 101449L, 101467L, 101477L, 101483L, 101489L, 101501L,
-101503L, 101513L, 101527L, 101531L, 101533L, 101537L, 101561L, 101573L, 101581L,
-101599L, 101603L, 101611L, 101627L, 101641L, 101653L, 101663L, 101681L, 101693L,
-101701L, 101719L, 101723L, 101737L, 101741L, 101747L, 101749L, 101771L, 101789L,
-101797L, 101807L, 101833L, 101837L, 101839L, 101863L, 101869L, 101873L, 101879L,
-101891L, 101917L, 101921L, 101929L, 101939L, 101957L, 101963L, 101977L, 101987L,
-101999L, 102001L, 102013L, 102019L, 102023L, 102031L, 102043L, 102059L, 102061L,
-102071L, 102077L, 102079L, 102101L, 102103L, 102107L, 102121L, 102139L, 102149L,
-102161L, 102181L, 102191L, 102197L, 102199L, 102203L, 102217L, 102229L, 102233L,
-102241L, 102251L, 102253L, 102259L, 102293L, 102299L, 102301L, 102317L, 102329L,
-102337L, 102359L, 102367L, 102397L, 102407L, 102409L, 102433L, 102437L, 102451L,
-102461L, 102481L, 102497L, 102499L, 102503L, 102523L, 102533L, 102539L, 102547L,
-102551L, 102559L, 102563L, 102587L, 102593L, 102607L, 102611L, 102643L, 102647L,
-102653L, 102667L, 102673L, 102677L, 102679L, 102701L, 102761L, 102763L, 102769L,
-102793L, 102797L, 102811L, 102829L, 102841L, 102859L, 102871L, 102877L, 102881L,
-102911L, 102913L, 102929L, 102931L, 102953L, 102967L, 102983L, 103001L, 103007L,
-103043L, 103049L, 103067L, 103069L, 103079L, 103087L, 103091L, 103093L, 103099L,
-103123L, 103141L, 103171L, 103177L, 103183L, 103217L, 103231L, 103237L, 103289L,
-103291L, 103307L, 103319L, 103333L, 103349L, 103357L, 103387L, 103391L, 103393L,
-103399L, 103409L, 103421L, 103423L, 103451L, 103457L, 103471L, 103483L, 103511L,
-103529L, 103549L, 103553L, 103561L, 103567L, 103573L, 103577L, 103583L, 103591L,
-103613L, 103619L, 103643L, 103651L, 103657L, 103669L, 103681L, 103687L, 103699L,
-103703L, 103723L, 103769L, 103787L, 103801L, 103811L, 103813L, 103837L, 103841L,
-103843L, 103867L, 103889L, 103903L, 103913L, 103919L, 103951L, 103963L, 103967L,
-103969L, 103979L, 103981L, 103991L, 103993L, 103997L, 104003L, 104009L, 104021L,
-104033L, 104047L, 104053L, 104059L, 104087L, 104089L, 104107L, 104113L, 104119L,
-104123L, 104147L, 104149L, 104161L, 104173L, 104179L, 104183L, 104207L, 104231L,
-104233L, 104239L, 104243L, 104281L, 104287L, 104297L, 104309L, 104311L, 104323L,
-104327L, 104347L, 104369L, 104381L, 104383L, 104393L, 104399L, 104417L, 104459L,
-104471L, 104473L, 104479L, 104491L, 104513L, 104527L, 104537L, 104543L, 104549L,
-104551L, 104561L, 104579L, 104593L, 104597L, 104623L, 104639L, 104651L, 104659L,
-104677L, 104681L, 104683L, 104693L, 104701L, 104707L, 104711L, 104717L, 104723L,
-104729L, 104743L, 104759L, 104761L, 104773L, 104779L, 104789L, 104801L, 104803L,
-104827L, 104831L, 104849L, 104851L, 104869L, 104879L, 104891L, 104911L, 104917L,
-104933L, 104947L, 104953L, 104959L, 104971L, 104987L, 104999L, 105019L, 105023L,
-105031L, 105037L, 105071L, 105097L, 105107L, 105137L, 105143L, 105167L, 105173L,
-105199L, 105211L, 105227L, 105229L, 105239L, 105251L, 105253L, 105263L, 105269L,
-105277L, 105319L, 105323L, 105331L, 105337L, 105341L, 105359L, 105361L, 105367L,
-105373L, 105379L, 105389L, 105397L, 105401L, 105407L, 105437L, 105449L, 105467L,
-105491L, 105499L, 105503L, 105509L, 105517L, 105527L, 105529L, 105533L, 105541L,
-105557L, 105563L, 105601L, 105607L, 105613L, 105619L, 105649L, 105653L, 105667L,
-105673L, 105683L, 105691L, 105701L, 105727L, 105733L, 105751L, 105761L, 105767L,
-105769L, 105817L, 105829L, 105863L, 105871L, 105883L, 105899L, 105907L, 105913L,
-105929L, 105943L, 105953L, 105967L, 105971L, 105977L, 105983L, 105997L, 106013L,
-106019L, 106031L, 106033L, 106087L, 106103L, 106109L, 106121L, 106123L, 106129L,
-106163L, 106181L, 106187L, 106189L, 106207L, 106213L, 106217L, 106219L, 106243L,
-106261L, 106273L, 106277L, 106279L, 106291L, 106297L, 106303L, 106307L, 106319L,
-106321L, 106331L, 106349L, 106357L, 106363L, 106367L, 106373L, 106391L, 106397L,
-106411L, 106417L, 106427L, 106433L, 106441L, 106451L, 106453L, 106487L, 106501L,
-106531L, 106537L, 106541L, 106543L, 106591L, 106619L, 106621L, 106627L, 106637L,
-106649L, 106657L, 106661L, 106663L, 106669L, 106681L, 106693L, 106699L, 106703L,
-106721L, 106727L, 106739L, 106747L, 106751L, 106753L, 106759L, 106781L, 106783L,
-106787L, 106801L, 106823L, 106853L, 106859L, 106861L, 106867L, 106871L, 106877L,
-106903L, 106907L, 106921L, 106937L, 106949L, 106957L, 106961L, 106963L, 106979L,
-106993L, 107021L, 107033L, 107053L, 107057L, 107069L, 107071L, 107077L, 107089L,
-107099L, 107101L, 107119L, 107123L, 107137L, 107171L, 107183L, 107197L, 107201L,
-107209L, 107227L, 107243L, 107251L, 107269L, 107273L, 107279L, 107309L, 107323L,
-107339L, 107347L, 107351L, 107357L, 107377L, 107441L, 107449L, 107453L, 107467L,
-107473L, 107507L, 107509L, 107563L, 107581L, 107599L, 107603L, 107609L, 107621L,
-107641L, 107647L, 107671L, 107687L, 107693L, 107699L, 107713L, 107717L, 107719L,
-107741L, 107747L, 107761L, 107773L, 107777L, 107791L, 107827L, 107837L, 107839L,
-107843L, 107857L, 107867L, 107873L, 107881L, 107897L, 107903L, 107923L, 107927L,
-107941L, 107951L, 107971L, 107981L, 107999L, 108007L, 108011L, 108013L, 108023L,
-108037L, 108041L, 108061L, 108079L, 108089L, 108107L, 108109L, 108127L, 108131L,
-108139L, 108161L, 108179L, 108187L, 108191L, 108193L, 108203L, 108211L, 108217L,
-108223L, 108233L, 108247L, 108263L, 108271L, 108287L, 108289L, 108293L, 108301L,
-108343L, 108347L, 108359L, 108377L, 108379L, 108401L, 108413L, 108421L, 108439L,
-108457L, 108461L, 108463L, 108497L, 108499L, 108503L, 108517L, 108529L, 108533L,
-108541L, 108553L, 108557L, 108571L, 108587L, 108631L, 108637L, 108643L, 108649L,
-108677L, 108707L, 108709L, 108727L, 108739L, 108751L, 108761L, 108769L, 108791L,
-108793L, 108799L, 108803L, 108821L, 108827L, 108863L, 108869L, 108877L, 108881L,
-108883L, 108887L, 108893L, 108907L, 108917L, 108923L, 108929L, 108943L, 108947L,
-108949L, 108959L, 108961L, 108967L, 108971L, 108991L, 109001L, 109013L, 109037L,
-109049L, 109063L, 109073L, 109097L, 109103L, 109111L, 109121L, 109133L, 109139L,
-109141L, 109147L, 109159L, 109169L, 109171L, 109199L, 109201L, 109211L, 109229L,
-109253L, 109267L, 109279L, 109297L, 109303L, 109313L, 109321L, 109331L, 109357L,
-109363L, 109367L, 109379L, 109387L, 109391L, 109397L, 109423L, 109433L, 109441L,
-109451L, 109453L, 109469L, 109471L, 109481L, 109507L, 109517L, 109519L, 109537L,
-109541L, 109547L, 109567L, 109579L, 109583L, 109589L, 109597L, 109609L, 109619L,
-109621L, 109639L, 109661L, 109663L, 109673L, 109717L, 109721L, 109741L, 109751L,
-109789L, 109793L, 109807L, 109819L, 109829L, 109831L, 109841L, 109843L, 109847L,
-109849L, 109859L, 109873L, 109883L, 109891L, 109897L, 109903L, 109913L, 109919L,
-109937L, 109943L, 109961L, 109987L, 110017L, 110023L, 110039L, 110051L, 110059L,
-110063L, 110069L, 110083L, 110119L, 110129L, 110161L, 110183L, 110221L, 110233L,
-110237L, 110251L, 110261L, 110269L, 110273L, 110281L, 110291L, 110311L, 110321L,
-110323L, 110339L, 110359L, 110419L, 110431L, 110437L, 110441L, 110459L, 110477L,
-110479L, 110491L, 110501L, 110503L, 110527L, 110533L, 110543L, 110557L, 110563L,
-110567L, 110569L, 110573L, 110581L, 110587L, 110597L, 110603L, 110609L, 110623L,
-110629L, 110641L, 110647L, 110651L, 110681L, 110711L, 110729L, 110731L, 110749L,
-110753L, 110771L, 110777L, 110807L, 110813L, 110819L, 110821L, 110849L, 110863L,
-110879L, 110881L, 110899L, 110909L, 110917L, 110921L, 110923L, 110927L, 110933L,
-110939L, 110947L, 110951L, 110969L, 110977L, 110989L, 111029L, 111031L, 111043L,
-111049L, 111053L, 111091L, 111103L, 111109L, 111119L, 111121L, 111127L, 111143L,
-111149L, 111187L, 111191L, 111211L, 111217L, 111227L, 111229L, 111253L, 111263L,
-111269L, 111271L, 111301L, 111317L, 111323L, 111337L, 111341L, 111347L, 111373L,
-111409L, 111427L, 111431L, 111439L, 111443L, 111467L, 111487L, 111491L, 111493L,
-111497L, 111509L, 111521L, 111533L, 111539L, 111577L, 111581L, 111593L, 111599L,
-111611L, 111623L, 111637L, 111641L, 111653L, 111659L, 111667L, 111697L, 111721L,
-111731L, 111733L, 111751L, 111767L, 111773L, 111779L, 111781L, 111791L, 111799L,
-111821L, 111827L, 111829L, 111833L, 111847L, 111857L, 111863L, 111869L, 111871L,
-111893L, 111913L, 111919L, 111949L, 111953L, 111959L, 111973L, 111977L, 111997L,
-112019L, 112031L, 112061L, 112067L, 112069L, 112087L, 112097L, 112103L, 112111L,
-112121L, 112129L, 112139L, 112153L, 112163L, 112181L, 112199L, 112207L, 112213L,
-112223L, 112237L, 112241L, 112247L, 112249L, 112253L, 112261L, 112279L, 112289L,
-112291L, 112297L, 112303L, 112327L, 112331L, 112337L, 112339L, 112349L, 112361L,
-112363L, 112397L, 112403L, 112429L, 112459L, 112481L, 112501L, 112507L, 112543L,
-112559L, 112571L, 112573L, 112577L, 112583L, 112589L, 112601L, 112603L, 112621L,
-112643L, 112657L, 112663L, 112687L, 112691L, 112741L, 112757L, 112759L, 112771L,
-112787L, 112799L, 112807L, 112831L, 112843L, 112859L, 112877L, 112901L, 112909L,
-112913L, 112919L, 112921L, 112927L, 112939L, 112951L, 112967L, 112979L, 112997L,
-113011L, 113017L, 113021L, 113023L, 113027L, 113039L, 113041L, 113051L, 113063L,
-113081L, 113083L, 113089L, 113093L, 113111L, 113117L, 113123L, 113131L, 113143L,
-113147L, 113149L, 113153L, 113159L, 113161L, 113167L, 113171L, 113173L, 113177L,
-113189L, 113209L, 113213L, 113227L, 113233L, 113279L, 113287L, 113327L, 113329L,
-113341L, 113357L, 113359L, 113363L, 113371L, 113381L, 113383L, 113417L, 113437L,
-113453L, 113467L, 113489L, 113497L, 113501L, 113513L, 113537L, 113539L, 113557L,
-113567L, 113591L, 113621L, 113623L, 113647L, 113657L, 113683L, 113717L, 113719L,
-113723L, 113731L, 113749L, 113759L, 113761L, 113777L, 113779L, 113783L, 113797L,
-113809L, 113819L, 113837L, 113843L, 113891L, 113899L, 113903L, 113909L, 113921L,
-113933L, 113947L, 113957L, 113963L, 113969L, 113983L, 113989L, 114001L, 114013L,
-114031L, 114041L, 114043L, 114067L, 114073L, 114077L, 114083L, 114089L, 114113L,
-114143L, 114157L, 114161L, 114167L, 114193L, 114197L, 114199L, 114203L, 114217L,
-114221L, 114229L, 114259L, 114269L, 114277L, 114281L, 114299L, 114311L, 114319L,
-114329L, 114343L, 114371L, 114377L, 114407L, 114419L, 114451L, 114467L, 114473L,
-114479L, 114487L, 114493L, 114547L, 114553L, 114571L, 114577L, 114593L, 114599L,
-114601L, 114613L, 114617L, 114641L, 114643L, 114649L, 114659L, 114661L, 114671L,
-114679L, 114689L, 114691L, 114713L, 114743L, 114749L, 114757L, 114761L, 114769L,
-114773L, 114781L, 114797L, 114799L, 114809L, 114827L, 114833L, 114847L, 114859L,
-114883L, 114889L, 114901L, 114913L, 114941L, 114967L, 114973L, 114997L, 115001L,
-115013L, 115019L, 115021L, 115057L, 115061L, 115067L, 115079L, 115099L, 115117L,
-115123L, 115127L, 115133L, 115151L, 115153L, 115163L, 115183L, 115201L, 115211L,
-115223L, 115237L, 115249L, 115259L, 115279L, 115301L, 115303L, 115309L, 115319L,
-115321L, 115327L, 115331L, 115337L, 115343L, 115361L, 115363L, 115399L, 115421L,
-115429L, 115459L, 115469L, 115471L, 115499L, 115513L, 115523L, 115547L, 115553L,
-115561L, 115571L, 115589L, 115597L, 115601L, 115603L, 115613L, 115631L, 115637L,
-115657L, 115663L, 115679L, 115693L, 115727L, 115733L, 115741L, 115751L, 115757L,
-115763L, 115769L, 115771L, 115777L, 115781L, 115783L, 115793L, 115807L, 115811L,
-115823L, 115831L, 115837L, 115849L, 115853L, 115859L, 115861L, 115873L, 115877L,
-115879L, 115883L, 115891L, 115901L, 115903L, 115931L, 115933L, 115963L, 115979L,
-115981L, 115987L, 116009L, 116027L, 116041L, 116047L, 116089L, 116099L, 116101L,
-116107L, 116113L, 116131L, 116141L, 116159L, 116167L, 116177L, 116189L, 116191L,
-116201L, 116239L, 116243L, 116257L, 116269L, 116273L, 116279L, 116293L, 116329L,
-116341L, 116351L, 116359L, 116371L, 116381L, 116387L, 116411L, 116423L, 116437L,
-116443L, 116447L, 116461L, 116471L, 116483L, 116491L, 116507L, 116531L, 116533L,
-116537L, 116539L, 116549L, 116579L, 116593L, 116639L, 116657L, 116663L, 116681L,
-116687L, 116689L, 116707L, 116719L, 116731L, 116741L, 116747L, 116789L, 116791L,
-116797L, 116803L, 116819L, 116827L, 116833L, 116849L, 116867L, 116881L, 116903L,
-116911L, 116923L, 116927L, 116929L, 116933L, 116953L, 116959L, 116969L, 116981L,
-116989L, 116993L, 117017L, 117023L, 117037L, 117041L, 117043L, 117053L, 117071L,
-117101L, 117109L, 117119L, 117127L, 117133L, 117163L, 117167L, 117191L, 117193L,
-117203L, 117209L, 117223L, 117239L, 117241L, 117251L, 117259L, 117269L, 117281L,
-117307L, 117319L, 117329L, 117331L, 117353L, 117361L, 117371L, 117373L, 117389L,
-117413L, 117427L, 117431L, 117437L, 117443L, 117497L, 117499L, 117503L, 117511L,
-117517L, 117529L, 117539L, 117541L, 117563L, 117571L, 117577L, 117617L, 117619L,
-117643L, 117659L, 117671L, 117673L, 117679L, 117701L, 117703L, 117709L, 117721L,
-117727L, 117731L, 117751L, 117757L, 117763L, 117773L, 117779L, 117787L, 117797L,
-117809L, 117811L, 117833L, 117839L, 117841L, 117851L, 117877L, 117881L, 117883L,
-117889L, 117899L, 117911L, 117917L, 117937L, 117959L, 117973L, 117977L, 117979L,
-117989L, 117991L, 118033L, 118037L, 118043L, 118051L, 118057L, 118061L, 118081L,
-118093L, 118127L, 118147L, 118163L, 118169L, 118171L, 118189L, 118211L, 118213L,
-118219L, 118247L, 118249L, 118253L, 118259L, 118273L, 118277L, 118297L, 118343L,
-118361L, 118369L, 118373L, 118387L, 118399L, 118409L, 118411L, 118423L, 118429L,
-118453L, 118457L, 118463L, 118471L, 118493L, 118529L, 118543L, 118549L, 118571L,
-118583L, 118589L, 118603L, 118619L, 118621L, 118633L, 118661L, 118669L, 118673L,
-118681L, 118687L, 118691L, 118709L, 118717L, 118739L, 118747L, 118751L, 118757L,
-118787L, 118799L, 118801L, 118819L, 118831L, 118843L, 118861L, 118873L, 118891L,
-118897L, 118901L, 118903L, 118907L, 118913L, 118927L, 118931L, 118967L, 118973L,
-119027L, 119033L, 119039L, 119047L, 119057L, 119069L, 119083L, 119087L, 119089L,
-119099L, 119101L, 119107L, 119129L, 119131L, 119159L, 119173L, 119179L, 119183L,
-119191L, 119227L, 119233L, 119237L, 119243L, 119267L, 119291L, 119293L, 119297L,
-119299L, 119311L, 119321L, 119359L, 119363L, 119389L, 119417L, 119419L, 119429L,
-119447L, 119489L, 119503L, 119513L, 119533L, 119549L, 119551L, 119557L, 119563L,
-119569L, 119591L, 119611L, 119617L, 119627L, 119633L, 119653L, 119657L, 119659L,
-119671L, 119677L, 119687L, 119689L, 119699L, 119701L, 119723L, 119737L, 119747L,
-119759L, 119771L, 119773L, 119783L, 119797L, 119809L, 119813L, 119827L, 119831L,
-119839L, 119849L, 119851L, 119869L, 119881L, 119891L, 119921L, 119923L, 119929L,
-119953L, 119963L, 119971L, 119981L, 119983L, 119993L, 120011L, 120017L, 120041L,
-120047L, 120049L, 120067L, 120077L, 120079L, 120091L, 120097L, 120103L, 120121L,
-120157L, 120163L, 120167L, 120181L, 120193L, 120199L, 120209L, 120223L, 120233L,
-120247L, 120277L, 120283L, 120293L, 120299L, 120319L, 120331L, 120349L, 120371L,
-120383L, 120391L, 120397L, 120401L, 120413L, 120427L, 120431L, 120473L, 120503L,
-120511L, 120539L, 120551L, 120557L, 120563L, 120569L, 120577L, 120587L, 120607L,
-120619L, 120623L, 120641L, 120647L, 120661L, 120671L, 120677L, 120689L, 120691L,
-120709L, 120713L, 120721L, 120737L, 120739L, 120749L, 120763L, 120767L, 120779L,
-120811L, 120817L, 120823L, 120829L, 120833L, 120847L, 120851L, 120863L, 120871L,
-120877L, 120889L, 120899L, 120907L, 120917L, 120919L, 120929L, 120937L, 120941L,
-120943L, 120947L, 120977L, 120997L, 121001L, 121007L, 121013L, 121019L, 121021L,
-121039L, 121061L, 121063L, 121067L, 121081L, 121123L, 121139L, 121151L, 121157L,
-121169L, 121171L, 121181L, 121189L, 121229L, 121259L, 121267L, 121271L, 121283L,
-121291L, 121309L, 121313L, 121321L, 121327L, 121333L, 121343L, 121349L, 121351L,
-121357L, 121367L, 121369L, 121379L, 121403L, 121421L, 121439L, 121441L, 121447L,
-121453L, 121469L, 121487L, 121493L, 121501L, 121507L, 121523L, 121531L, 121547L,
-121553L, 121559L, 121571L, 121577L, 121579L, 121591L, 121607L, 121609L, 121621L,
-121631L, 121633L, 121637L, 121661L, 121687L, 121697L, 121711L, 121721L, 121727L,
-121763L, 121787L, 121789L, 121843L, 121853L, 121867L, 121883L, 121889L, 121909L,
-121921L, 121931L, 121937L, 121949L, 121951L, 121963L, 121967L, 121993L, 121997L,
-122011L, 122021L, 122027L, 122029L, 122033L, 122039L, 122041L, 122051L, 122053L,
-122069L, 122081L, 122099L, 122117L, 122131L, 122147L, 122149L, 122167L, 122173L,
-122201L, 122203L, 122207L, 122209L, 122219L, 122231L, 122251L, 122263L, 122267L,
-122273L, 122279L, 122299L, 122321L, 122323L, 122327L, 122347L, 122363L, 122387L,
-122389L, 122393L, 122399L, 122401L, 122443L, 122449L, 122453L, 122471L, 122477L,
-122489L, 122497L, 122501L, 122503L, 122509L, 122527L, 122533L, 122557L, 122561L,
-122579L, 122597L, 122599L, 122609L, 122611L, 122651L, 122653L, 122663L, 122693L,
-122701L, 122719L, 122741L, 122743L, 122753L, 122761L, 122777L, 122789L, 122819L,
-122827L, 122833L, 122839L, 122849L, 122861L, 122867L, 122869L, 122887L, 122891L,
-122921L, 122929L, 122939L, 122953L, 122957L, 122963L, 122971L, 123001L, 123007L,
-123017L, 123031L, 123049L, 123059L, 123077L, 123083L, 123091L, 123113L, 123121L,
-123127L, 123143L, 123169L, 123191L, 123203L, 123209L, 123217L, 123229L, 123239L,
-123259L, 123269L, 123289L, 123307L, 123311L, 123323L, 123341L, 123373L, 123377L,
-123379L, 123397L, 123401L, 123407L, 123419L, 123427L, 123433L, 123439L, 123449L,
-123457L, 123479L, 123491L, 123493L, 123499L, 123503L, 123517L, 123527L, 123547L,
-123551L, 123553L, 123581L, 123583L, 123593L, 123601L, 123619L, 123631L, 123637L,
-123653L, 123661L, 123667L, 123677L, 123701L, 123707L, 123719L, 123727L, 123731L,
-123733L, 123737L, 123757L, 123787L, 123791L, 123803L, 123817L, 123821L, 123829L,
-123833L, 123853L, 123863L, 123887L, 123911L, 123923L, 123931L, 123941L, 123953L,
-123973L, 123979L, 123983L, 123989L, 123997L, 124001L, 124021L, 124067L, 124087L,
-124097L, 124121L, 124123L, 124133L, 124139L, 124147L, 124153L, 124171L, 124181L,
-124183L, 124193L, 124199L, 124213L, 124231L, 124247L, 124249L, 124277L, 124291L,
-124297L, 124301L, 124303L, 124309L, 124337L, 124339L, 124343L, 124349L, 124351L,
-124363L, 124367L, 124427L, 124429L, 124433L, 124447L, 124459L, 124471L, 124477L,
-124489L, 124493L, 124513L, 124529L, 124541L, 124543L, 124561L, 124567L, 124577L,
-124601L, 124633L, 124643L, 124669L, 124673L, 124679L, 124693L, 124699L, 124703L,
-124717L, 124721L, 124739L, 124753L, 124759L, 124769L, 124771L, 124777L, 124781L,
-124783L, 124793L, 124799L, 124819L, 124823L, 124847L, 124853L, 124897L, 124907L,
-124909L, 124919L, 124951L, 124979L, 124981L, 124987L, 124991L, 125003L, 125017L,
-125029L, 125053L, 125063L, 125093L, 125101L, 125107L, 125113L, 125117L, 125119L,
-125131L, 125141L, 125149L, 125183L, 125197L, 125201L, 125207L, 125219L, 125221L,
-125231L, 125243L, 125261L, 125269L, 125287L, 125299L, 125303L, 125311L, 125329L,
-125339L, 125353L, 125371L, 125383L, 125387L, 125399L, 125407L, 125423L, 125429L,
-125441L, 125453L, 125471L, 125497L, 125507L, 125509L, 125527L, 125539L, 125551L,
-125591L, 125597L, 125617L, 125621L, 125627L, 125639L, 125641L, 125651L, 125659L,
-125669L, 125683L, 125687L, 125693L, 125707L, 125711L, 125717L, 125731L, 125737L,
-125743L, 125753L, 125777L, 125789L, 125791L, 125803L, 125813L, 125821L, 125863L,
-125887L, 125897L, 125899L, 125921L, 125927L, 125929L, 125933L, 125941L, 125959L,
-125963L, 126001L, 126011L, 126013L, 126019L, 126023L, 126031L, 126037L, 126041L,
-126047L, 126067L, 126079L, 126097L, 126107L, 126127L, 126131L, 126143L, 126151L,
-126173L, 126199L, 126211L, 126223L, 126227L, 126229L, 126233L, 126241L, 126257L,
-126271L, 126307L, 126311L, 126317L, 126323L, 126337L, 126341L, 126349L, 126359L,
-126397L, 126421L, 126433L, 126443L, 126457L, 126461L, 126473L, 126481L, 126487L,
-126491L, 126493L, 126499L, 126517L, 126541L, 126547L, 126551L, 126583L, 126601L,
-126611L, 126613L, 126631L, 126641L, 126653L, 126683L, 126691L, 126703L, 126713L,
-126719L, 126733L, 126739L, 126743L, 126751L, 126757L, 126761L, 126781L, 126823L,
-126827L, 126839L, 126851L, 126857L, 126859L, 126913L, 126923L, 126943L, 126949L,
-126961L, 126967L, 126989L, 127031L, 127033L, 127037L, 127051L, 127079L, 127081L,
-127103L, 127123L, 127133L, 127139L, 127157L, 127163L, 127189L, 127207L, 127217L,
-127219L, 127241L, 127247L, 127249L, 127261L, 127271L, 127277L, 127289L, 127291L,
-127297L, 127301L, 127321L, 127331L, 127343L, 127363L, 127373L, 127399L, 127403L,
-127423L, 127447L, 127453L, 127481L, 127487L, 127493L, 127507L, 127529L, 127541L,
-127549L, 127579L, 127583L, 127591L, 127597L, 127601L, 127607L, 127609L, 127637L,
-127643L, 127649L, 127657L, 127663L, 127669L, 127679L, 127681L, 127691L, 127703L,
-127709L, 127711L, 127717L, 127727L, 127733L, 127739L, 127747L, 127763L, 127781L,
-127807L, 127817L, 127819L, 127837L, 127843L, 127849L, 127859L, 127867L, 127873L,
-127877L, 127913L, 127921L, 127931L, 127951L, 127973L, 127979L, 127997L, 128021L,
-128033L, 128047L, 128053L, 128099L, 128111L, 128113L, 128119L, 128147L, 128153L,
-128159L, 128173L, 128189L, 128201L, 128203L, 128213L, 128221L, 128237L, 128239L,
-128257L, 128273L, 128287L, 128291L, 128311L, 128321L, 128327L, 128339L, 128341L,
-128347L, 128351L, 128377L, 128389L, 128393L, 128399L, 128411L, 128413L, 128431L,
-128437L, 128449L, 128461L, 128467L, 128473L, 128477L, 128483L, 128489L, 128509L,
-128519L, 128521L, 128549L, 128551L, 128563L, 128591L, 128599L, 128603L, 128621L,
-128629L, 128657L, 128659L, 128663L, 128669L, 128677L, 128683L, 128693L, 128717L,
-128747L, 128749L, 128761L, 128767L, 128813L, 128819L, 128831L, 128833L, 128837L,
-128857L, 128861L, 128873L, 128879L, 128903L, 128923L, 128939L, 128941L, 128951L,
-128959L, 128969L, 128971L, 128981L, 128983L, 128987L, 128993L, 129001L, 129011L,
-129023L, 129037L, 129049L, 129061L, 129083L, 129089L, 129097L, 129113L, 129119L,
-129121L, 129127L, 129169L, 129187L, 129193L, 129197L, 129209L, 129221L, 129223L,
-129229L, 129263L, 129277L, 129281L, 129287L, 129289L, 129293L, 129313L, 129341L,
-129347L, 129361L, 129379L, 129401L, 129403L, 129419L, 129439L, 129443L, 129449L,
-129457L, 129461L, 129469L, 129491L, 129497L, 129499L, 129509L, 129517L, 129527L,
-129529L, 129533L, 129539L, 129553L, 129581L, 129587L, 129589L, 129593L, 129607L,
-129629L, 129631L, 129641L, 129643L, 129671L, 129707L, 129719L, 129733L, 129737L,
-129749L, 129757L, 129763L, 129769L, 129793L, 129803L, 129841L, 129853L, 129887L,
-129893L, 129901L, 129917L, 129919L, 129937L, 129953L, 129959L, 129967L, 129971L,
-130003L, 130021L, 130027L, 130043L, 130051L, 130057L, 130069L, 130073L, 130079L,
-130087L, 130099L, 130121L, 130127L, 130147L, 130171L, 130183L, 130199L, 130201L,
-130211L, 130223L, 130241L, 130253L, 130259L, 130261L, 130267L, 130279L, 130303L,
-130307L, 130337L, 130343L, 130349L, 130363L, 130367L, 130369L, 130379L, 130399L,
-130409L, 130411L, 130423L, 130439L, 130447L, 130457L, 130469L, 130477L, 130483L,
-130489L, 130513L, 130517L, 130523L, 130531L, 130547L, 130553L, 130579L, 130589L,
-130619L, 130621L, 130631L, 130633L, 130639L, 130643L, 130649L, 130651L, 130657L,
-130681L, 130687L, 130693L, 130699L, 130729L, 130769L, 130783L, 130787L, 130807L,
-130811L, 130817L, 130829L, 130841L, 130843L, 130859L, 130873L, 130927L, 130957L,
-130969L, 130973L, 130981L, 130987L, 131009L, 131011L, 131023L, 131041L, 131059L,
-131063L, 131071L, 131101L, 131111L, 131113L, 131129L, 131143L, 131149L, 131171L,
-131203L, 131213L, 131221L, 131231L, 131249L, 131251L, 131267L, 131293L, 131297L,
-131303L, 131311L, 131317L, 131321L, 131357L, 131363L, 131371L, 131381L, 131413L,
-131431L, 131437L, 131441L, 131447L, 131449L, 131477L, 131479L, 131489L, 131497L,
-131501L, 131507L, 131519L, 131543L, 131561L, 131581L, 131591L, 131611L, 131617L,
-131627L, 131639L, 131641L, 131671L, 131687L, 131701L, 131707L, 131711L, 131713L,
-131731L, 131743L, 131749L, 131759L, 131771L, 131777L, 131779L, 131783L, 131797L,
-131837L, 131839L, 131849L, 131861L, 131891L, 131893L, 131899L, 131909L, 131927L,
-131933L, 131939L, 131941L, 131947L, 131959L, 131969L, 132001L, 132019L, 132047L,
-132049L, 132059L, 132071L, 132103L, 132109L, 132113L, 132137L, 132151L, 132157L,
-132169L, 132173L, 132199L, 132229L, 132233L, 132241L, 132247L, 132257L, 132263L,
-132283L, 132287L, 132299L, 132313L, 132329L, 132331L, 132347L, 132361L, 132367L,
-132371L, 132383L, 132403L, 132409L, 132421L, 132437L, 132439L, 132469L, 132491L,
-132499L, 132511L, 132523L, 132527L, 132529L, 132533L, 132541L, 132547L, 132589L,
-132607L, 132611L, 132619L, 132623L, 132631L, 132637L, 132647L, 132661L, 132667L,
-132679L, 132689L, 132697L, 132701L, 132707L, 132709L, 132721L, 132739L, 132749L,
-132751L, 132757L, 132761L, 132763L, 132817L, 132833L, 132851L, 132857L, 132859L,
-132863L, 132887L, 132893L, 132911L, 132929L, 132947L, 132949L, 132953L, 132961L,
-132967L, 132971L, 132989L, 133013L, 133033L, 133039L, 133051L, 133069L, 133073L,
-133087L, 133097L, 133103L, 133109L, 133117L, 133121L, 133153L, 133157L, 133169L,
-133183L, 133187L, 133201L, 133213L, 133241L, 133253L, 133261L, 133271L, 133277L,
-133279L, 133283L, 133303L, 133319L, 133321L, 133327L, 133337L, 133349L, 133351L,
-133379L, 133387L, 133391L, 133403L, 133417L, 133439L, 133447L, 133451L, 133481L,
-133493L, 133499L, 133519L, 133541L, 133543L, 133559L, 133571L, 133583L, 133597L,
-133631L, 133633L, 133649L, 133657L, 133669L, 133673L, 133691L, 133697L, 133709L,
-133711L, 133717L, 133723L, 133733L, 133769L, 133781L, 133801L, 133811L, 133813L,
-133831L, 133843L, 133853L, 133873L, 133877L, 133919L, 133949L, 133963L, 133967L,
-133979L, 133981L, 133993L, 133999L, 134033L, 134039L, 134047L, 134053L, 134059L,
-134077L, 134081L, 134087L, 134089L, 134093L, 134129L, 134153L, 134161L, 134171L,
-134177L, 134191L, 134207L, 134213L, 134219L, 134227L, 134243L, 134257L, 134263L,
-134269L, 134287L, 134291L, 134293L, 134327L, 134333L, 134339L, 134341L, 134353L,
-134359L, 134363L, 134369L, 134371L, 134399L, 134401L, 134417L, 134437L, 134443L,
-134471L, 134489L, 134503L, 134507L, 134513L, 134581L, 134587L, 134591L, 134593L,
-134597L, 134609L, 134639L, 134669L, 134677L, 134681L, 134683L, 134699L, 134707L,
-134731L, 134741L, 134753L, 134777L, 134789L, 134807L, 134837L, 134839L, 134851L,
-134857L, 134867L, 134873L, 134887L, 134909L, 134917L, 134921L, 134923L, 134947L,
-134951L, 134989L, 134999L, 135007L, 135017L, 135019L, 135029L, 135043L, 135049L,
-135059L, 135077L, 135089L, 135101L, 135119L, 135131L, 135151L, 135173L, 135181L,
-135193L, 135197L, 135209L, 135211L, 135221L, 135241L, 135257L, 135271L, 135277L,
-135281L, 135283L, 135301L, 135319L, 135329L, 135347L, 135349L, 135353L, 135367L,
-135389L, 135391L, 135403L, 135409L, 135427L, 135431L, 135433L, 135449L, 135461L,
-135463L, 135467L, 135469L, 135479L, 135497L, 135511L, 135533L, 135559L, 135571L,
-135581L, 135589L, 135593L, 135599L, 135601L, 135607L, 135613L, 135617L, 135623L,
-135637L, 135647L, 135649L, 135661L, 135671L, 135697L, 135701L, 135719L, 135721L,
-135727L, 135731L, 135743L, 135757L, 135781L, 135787L, 135799L, 135829L, 135841L,
-135851L, 135859L, 135887L, 135893L, 135899L, 135911L, 135913L, 135929L, 135937L,
-135977L, 135979L, 136013L, 136027L, 136033L, 136043L, 136057L, 136067L, 136069L,
-136093L, 136099L, 136111L, 136133L, 136139L, 136163L, 136177L, 136189L, 136193L,
-136207L, 136217L, 136223L, 136237L, 136247L, 136261L, 136273L, 136277L, 136303L,
-136309L, 136319L, 136327L, 136333L, 136337L, 136343L, 136351L, 136361L, 136373L,
-136379L, 136393L, 136397L, 136399L, 136403L, 136417L, 136421L, 136429L, 136447L,
-136453L, 136463L, 136471L, 136481L, 136483L, 136501L, 136511L, 136519L, 136523L,
-136531L, 136537L, 136541L, 136547L, 136559L, 136573L, 136601L, 136603L, 136607L,
-136621L, 136649L, 136651L, 136657L, 136691L, 136693L, 136709L, 136711L, 136727L,
-136733L, 136739L, 136751L, 136753L, 136769L, 136777L, 136811L, 136813L, 136841L,
-136849L, 136859L, 136861L, 136879L, 136883L, 136889L, 136897L, 136943L, 136949L,
-136951L, 136963L, 136973L, 136979L, 136987L, 136991L, 136993L, 136999L, 137029L,
-137077L, 137087L, 137089L, 137117L, 137119L, 137131L, 137143L, 137147L, 137153L,
-137177L, 137183L, 137191L, 137197L, 137201L, 137209L, 137219L, 137239L, 137251L,
-137273L, 137279L, 137303L, 137321L, 137339L, 137341L, 137353L, 137359L, 137363L,
-137369L, 137383L, 137387L, 137393L, 137399L, 137413L, 137437L, 137443L, 137447L,
-137453L, 137477L, 137483L, 137491L, 137507L, 137519L, 137537L, 137567L, 137573L,
-137587L, 137593L, 137597L, 137623L, 137633L, 137639L, 137653L, 137659L, 137699L,
-137707L, 137713L, 137723L, 137737L, 137743L, 137771L, 137777L, 137791L, 137803L,
-137827L, 137831L, 137849L, 137867L, 137869L, 137873L, 137909L, 137911L, 137927L,
-137933L, 137941L, 137947L, 137957L, 137983L, 137993L, 137999L, 138007L, 138041L,
-138053L, 138059L, 138071L, 138077L, 138079L, 138101L, 138107L, 138113L, 138139L,
-138143L, 138157L, 138163L, 138179L, 138181L, 138191L, 138197L, 138209L, 138239L,
-138241L, 138247L, 138251L, 138283L, 138289L, 138311L, 138319L, 138323L, 138337L,
-138349L, 138371L, 138373L, 138389L, 138401L, 138403L, 138407L, 138427L, 138433L,
-138449L, 138451L, 138461L, 138469L, 138493L, 138497L, 138511L, 138517L, 138547L,
-138559L, 138563L, 138569L, 138571L, 138577L, 138581L, 138587L, 138599L, 138617L,
-138629L, 138637L, 138641L, 138647L, 138661L, 138679L, 138683L, 138727L, 138731L,
-138739L, 138763L, 138793L, 138797L, 138799L, 138821L, 138829L, 138841L, 138863L,
-138869L, 138883L, 138889L, 138893L, 138899L, 138917L, 138923L, 138937L, 138959L,
-138967L, 138977L, 139021L, 139033L, 139067L, 139079L, 139091L, 139109L, 139121L,
-139123L, 139133L, 139169L, 139177L, 139187L, 139199L, 139201L, 139241L, 139267L,
-139273L, 139291L, 139297L, 139301L, 139303L, 139309L, 139313L, 139333L, 139339L,
-139343L, 139361L, 139367L, 139369L, 139387L, 139393L, 139397L, 139409L, 139423L,
-139429L, 139439L, 139457L, 139459L, 139483L, 139487L, 139493L, 139501L, 139511L,
-139537L, 139547L, 139571L, 139589L, 139591L, 139597L, 139609L, 139619L, 139627L,
-139661L, 139663L, 139681L, 139697L, 139703L, 139709L, 139721L, 139729L, 139739L,
-139747L, 139753L, 139759L, 139787L, 139801L, 139813L, 139831L, 139837L, 139861L,
-139871L, 139883L, 139891L, 139901L, 139907L, 139921L, 139939L, 139943L, 139967L,
-139969L, 139981L, 139987L, 139991L, 139999L, 140009L, 140053L, 140057L, 140069L,
-140071L, 140111L, 140123L, 140143L, 140159L, 140167L, 140171L, 140177L, 140191L,
-140197L, 140207L, 140221L, 140227L, 140237L, 140249L, 140263L, 140269L, 140281L,
-140297L, 140317L, 140321L, 140333L, 140339L, 140351L, 140363L, 140381L, 140401L,
-140407L, 140411L, 140417L, 140419L, 140423L, 140443L, 140449L, 140453L, 140473L,
-140477L, 140521L, 140527L, 140533L, 140549L, 140551L, 140557L, 140587L, 140593L,
-140603L, 140611L, 140617L, 140627L, 140629L, 140639L, 140659L, 140663L, 140677L,
-140681L, 140683L, 140689L, 140717L, 140729L, 140731L, 140741L, 140759L, 140761L,
-140773L, 140779L, 140797L, 140813L, 140827L, 140831L, 140837L, 140839L, 140863L,
-140867L, 140869L, 140891L, 140893L, 140897L, 140909L, 140929L, 140939L, 140977L,
-140983L, 140989L, 141023L, 141041L, 141061L, 141067L, 141073L, 141079L, 141101L,
-141107L, 141121L, 141131L, 141157L, 141161L, 141179L, 141181L, 141199L, 141209L,
-141221L, 141223L, 141233L, 141241L, 141257L, 141263L, 141269L, 141277L, 141283L,
-141301L, 141307L, 141311L, 141319L, 141353L, 141359L, 141371L, 141397L, 141403L,
-141413L, 141439L, 141443L, 141461L, 141481L, 141497L, 141499L, 141509L, 141511L,
-141529L, 141539L, 141551L, 141587L, 141601L, 141613L, 141619L, 141623L, 141629L,
-141637L, 141649L, 141653L, 141667L, 141671L, 141677L, 141679L, 141689L, 141697L,
-141707L, 141709L, 141719L, 141731L, 141761L, 141767L, 141769L, 141773L, 141793L,
-141803L, 141811L, 141829L, 141833L, 141851L, 141853L, 141863L, 141871L, 141907L,
-141917L, 141931L, 141937L, 141941L, 141959L, 141961L, 141971L, 141991L, 142007L,
-142019L, 142031L, 142039L, 142049L, 142057L, 142061L, 142067L, 142097L, 142099L,
-142111L, 142123L, 142151L, 142157L, 142159L, 142169L, 142183L, 142189L, 142193L,
-142211L, 142217L, 142223L, 142231L, 142237L, 142271L, 142297L, 142319L, 142327L,
-142357L, 142369L, 142381L, 142391L, 142403L, 142421L, 142427L, 142433L, 142453L,
-142469L, 142501L, 142529L, 142537L, 142543L, 142547L, 142553L, 142559L, 142567L,
-142573L, 142589L, 142591L, 142601L, 142607L, 142609L, 142619L, 142657L, 142673L,
-142697L, 142699L, 142711L, 142733L, 142757L, 142759L, 142771L, 142787L, 142789L,
-142799L, 142811L, 142837L, 142841L, 142867L, 142871L, 142873L, 142897L, 142903L,
-142907L, 142939L, 142949L, 142963L, 142969L, 142973L, 142979L, 142981L, 142993L,
-143053L, 143063L, 143093L, 143107L, 143111L, 143113L, 143137L, 143141L, 143159L,
-143177L, 143197L, 143239L, 143243L, 143249L, 143257L, 143261L, 143263L, 143281L,
-143287L, 143291L, 143329L, 143333L, 143357L, 143387L, 143401L, 143413L, 143419L,
-143443L, 143461L, 143467L, 143477L, 143483L, 143489L, 143501L, 143503L, 143509L,
-143513L, 143519L, 143527L, 143537L, 143551L, 143567L, 143569L, 143573L, 143593L,
-143609L, 143617L, 143629L, 143651L, 143653L, 143669L, 143677L, 143687L, 143699L,
-143711L, 143719L, 143729L, 143743L, 143779L, 143791L, 143797L, 143807L, 143813L,
-143821L, 143827L, 143831L, 143833L, 143873L, 143879L, 143881L, 143909L, 143947L,
-143953L, 143971L, 143977L, 143981L, 143999L, 144013L, 144031L, 144037L, 144061L,
-144071L, 144073L, 144103L, 144139L, 144161L, 144163L, 144167L, 144169L, 144173L,
-144203L, 144223L, 144241L, 144247L, 144253L, 144259L, 144271L, 144289L, 144299L,
-144307L, 144311L, 144323L, 144341L, 144349L, 144379L, 144383L, 144407L, 144409L,
-144413L, 144427L, 144439L, 144451L, 144461L, 144479L, 144481L, 144497L, 144511L,
-144539L, 144541L, 144563L, 144569L, 144577L, 144583L, 144589L, 144593L, 144611L,
-144629L, 144659L, 144667L, 144671L, 144701L, 144709L, 144719L, 144731L, 144737L,
-144751L, 144757L, 144763L, 144773L, 144779L, 144791L, 144817L, 144829L, 144839L,
-144847L, 144883L, 144887L, 144889L, 144899L, 144917L, 144931L, 144941L, 144961L,
-144967L, 144973L, 144983L, 145007L, 145009L, 145021L, 145031L, 145037L, 145043L,
-145063L, 145069L, 145091L, 145109L, 145121L, 145133L, 145139L, 145177L, 145193L,
-145207L, 145213L, 145219L, 145253L, 145259L, 145267L, 145283L, 145289L, 145303L,
-145307L, 145349L, 145361L, 145381L, 145391L, 145399L, 145417L, 145423L, 145433L,
-145441L, 145451L, 145459L, 145463L, 145471L, 145477L, 145487L, 145501L, 145511L,
-145513L, 145517L, 145531L, 145543L, 145547L, 145549L, 145577L, 145589L, 145601L,
-145603L, 145633L, 145637L, 145643L, 145661L, 145679L, 145681L, 145687L, 145703L,
-145709L, 145721L, 145723L, 145753L, 145757L, 145759L, 145771L, 145777L, 145799L,
-145807L, 145819L, 145823L, 145829L, 145861L, 145879L, 145897L, 145903L, 145931L,
-145933L, 145949L, 145963L, 145967L, 145969L, 145987L, 145991L, 146009L, 146011L,
-146021L, 146023L, 146033L, 146051L, 146057L, 146059L, 146063L, 146077L, 146093L,
-146099L, 146117L, 146141L, 146161L, 146173L, 146191L, 146197L, 146203L, 146213L,
-146221L, 146239L, 146249L, 146273L, 146291L, 146297L, 146299L, 146309L, 146317L,
-146323L, 146347L, 146359L, 146369L, 146381L, 146383L, 146389L, 146407L, 146417L,
-146423L, 146437L, 146449L, 146477L, 146513L, 146519L, 146521L, 146527L, 146539L,
-146543L, 146563L, 146581L, 146603L, 146609L, 146617L, 146639L, 146647L, 146669L,
-146677L, 146681L, 146683L, 146701L, 146719L, 146743L, 146749L, 146767L, 146777L,
-146801L, 146807L, 146819L, 146833L, 146837L, 146843L, 146849L, 146857L, 146891L,
-146893L, 146917L, 146921L, 146933L, 146941L, 146953L, 146977L, 146983L, 146987L,
-146989L, 147011L, 147029L, 147031L, 147047L, 147073L, 147083L, 147089L, 147097L,
-147107L, 147137L, 147139L, 147151L, 147163L, 147179L, 147197L, 147209L, 147211L,
-147221L, 147227L, 147229L, 147253L, 147263L, 147283L, 147289L, 147293L, 147299L,
-147311L, 147319L, 147331L, 147341L, 147347L, 147353L, 147377L, 147391L, 147397L,
-147401L, 147409L, 147419L, 147449L, 147451L, 147457L, 147481L, 147487L, 147503L,
-147517L, 147541L, 147547L, 147551L, 147557L, 147571L, 147583L, 147607L, 147613L,
-147617L, 147629L, 147647L, 147661L, 147671L, 147673L, 147689L, 147703L, 147709L,
-147727L, 147739L, 147743L, 147761L, 147769L, 147773L, 147779L, 147787L, 147793L,
-147799L, 147811L, 147827L, 147853L, 147859L, 147863L, 147881L, 147919L, 147937L,
-147949L, 147977L, 147997L, 148013L, 148021L, 148061L, 148063L, 148073L, 148079L,
-148091L, 148123L, 148139L, 148147L, 148151L, 148153L, 148157L, 148171L, 148193L,
-148199L, 148201L, 148207L, 148229L, 148243L, 148249L, 148279L, 148301L, 148303L,
-148331L, 148339L, 148361L, 148367L, 148381L, 148387L, 148399L, 148403L, 148411L,
-148429L, 148439L, 148457L, 148469L, 148471L, 148483L, 148501L, 148513L, 148517L,
-148531L, 148537L, 148549L, 148573L, 148579L, 148609L, 148627L, 148633L, 148639L,
-148663L, 148667L, 148669L, 148691L, 148693L, 148711L, 148721L, 148723L, 148727L,
-148747L, 148763L, 148781L, 148783L, 148793L, 148817L, 148829L, 148853L, 148859L,
-148861L, 148867L, 148873L, 148891L, 148913L, 148921L, 148927L, 148931L, 148933L,
-148949L, 148957L, 148961L, 148991L, 148997L, 149011L, 149021L, 149027L, 149033L,
-149053L, 149057L, 149059L, 149069L, 149077L, 149087L, 149099L, 149101L, 149111L,
-149113L, 149119L, 149143L, 149153L, 149159L, 149161L, 149173L, 149183L, 149197L,
-149213L, 149239L, 149249L, 149251L, 149257L, 149269L, 149287L, 149297L, 149309L,
-149323L, 149333L, 149341L, 149351L, 149371L, 149377L, 149381L, 149393L, 149399L,
-149411L, 149417L, 149419L, 149423L, 149441L, 149459L, 149489L, 149491L, 149497L,
-149503L, 149519L, 149521L, 149531L, 149533L, 149543L, 149551L, 149561L, 149563L,
-149579L, 149603L, 149623L, 149627L, 149629L, 149689L, 149711L, 149713L, 149717L,
-149729L, 149731L, 149749L, 149759L, 149767L, 149771L, 149791L, 149803L, 149827L,
-149837L, 149839L, 149861L, 149867L, 149873L, 149893L, 149899L, 149909L, 149911L,
-149921L, 149939L, 149953L, 149969L, 149971L, 149993L, 150001L, 150011L, 150041L,
-150053L, 150061L, 150067L, 150077L, 150083L, 150089L, 150091L, 150097L, 150107L,
-150131L, 150151L, 150169L, 150193L, 150197L, 150203L, 150209L, 150211L, 150217L,
-150221L, 150223L, 150239L, 150247L, 150287L, 150299L, 150301L, 150323L, 150329L,
-150343L, 150373L, 150377L, 150379L, 150383L, 150401L, 150407L, 150413L, 150427L,
-150431L, 150439L, 150473L, 150497L, 150503L, 150517L, 150523L, 150533L, 150551L,
-150559L, 150571L, 150583L, 150587L, 150589L, 150607L, 150611L, 150617L, 150649L,
-150659L, 150697L, 150707L, 150721L, 150743L, 150767L, 150769L, 150779L, 150791L,
-150797L, 150827L, 150833L, 150847L, 150869L, 150881L, 150883L, 150889L, 150893L,
-150901L, 150907L, 150919L, 150929L, 150959L, 150961L, 150967L, 150979L, 150989L,
-150991L, 151007L, 151009L, 151013L, 151027L, 151049L, 151051L, 151057L, 151091L,
-151121L, 151141L, 151153L, 151157L, 151163L, 151169L, 151171L, 151189L, 151201L,
-151213L, 151237L, 151241L, 151243L, 151247L, 151253L, 151273L, 151279L, 151289L,
-151303L, 151337L, 151339L, 151343L, 151357L, 151379L, 151381L, 151391L, 151397L,
-151423L, 151429L, 151433L, 151451L, 151471L, 151477L, 151483L, 151499L, 151507L,
-151517L, 151523L, 151531L, 151537L, 151549L, 151553L, 151561L, 151573L, 151579L,
-151597L, 151603L, 151607L, 151609L, 151631L, 151637L, 151643L, 151651L, 151667L,
-151673L, 151681L, 151687L, 151693L, 151703L, 151717L, 151729L, 151733L, 151769L,
-151771L, 151783L, 151787L, 151799L, 151813L, 151817L, 151841L, 151847L, 151849L,
-151871L, 151883L, 151897L, 151901L, 151903L, 151909L, 151937L, 151939L, 151967L,
-151969L, 152003L, 152017L, 152027L, 152029L, 152039L, 152041L, 152063L, 152077L,
-152081L, 152083L, 152093L, 152111L, 152123L, 152147L, 152183L, 152189L, 152197L,
-152203L, 152213L, 152219L, 152231L, 152239L, 152249L, 152267L, 152287L, 152293L,
-152297L, 152311L, 152363L, 152377L, 152381L, 152389L, 152393L, 152407L, 152417L,
-152419L, 152423L, 152429L, 152441L, 152443L, 152459L, 152461L, 152501L, 152519L,
-152531L, 152533L, 152539L, 152563L, 152567L, 152597L, 152599L, 152617L, 152623L,
-152629L, 152639L, 152641L, 152657L, 152671L, 152681L, 152717L, 152723L, 152729L,
-152753L, 152767L, 152777L, 152783L, 152791L, 152809L, 152819L, 152821L, 152833L,
-152837L, 152839L, 152843L, 152851L, 152857L, 152879L, 152897L, 152899L, 152909L,
-152939L, 152941L, 152947L, 152953L, 152959L, 152981L, 152989L, 152993L, 153001L,
-153059L, 153067L, 153071L, 153073L, 153077L, 153089L, 153107L, 153113L, 153133L,
-153137L, 153151L, 153191L, 153247L, 153259L, 153269L, 153271L, 153277L, 153281L,
-153287L, 153313L, 153319L, 153337L, 153343L, 153353L, 153359L, 153371L, 153379L,
-153407L, 153409L, 153421L, 153427L, 153437L, 153443L, 153449L, 153457L, 153469L,
-153487L, 153499L, 153509L, 153511L, 153521L, 153523L, 153529L, 153533L, 153557L,
-153563L, 153589L, 153607L, 153611L, 153623L, 153641L, 153649L, 153689L, 153701L,
-153719L, 153733L, 153739L, 153743L, 153749L, 153757L, 153763L, 153817L, 153841L,
-153871L, 153877L, 153887L, 153889L, 153911L, 153913L, 153929L, 153941L, 153947L,
-153949L, 153953L, 153991L, 153997L, 154001L, 154027L, 154043L, 154057L, 154061L,
-154067L, 154073L, 154079L, 154081L, 154087L, 154097L, 154111L, 154127L, 154153L,
-154157L, 154159L, 154181L, 154183L, 154211L, 154213L, 154229L, 154243L, 154247L,
-154267L, 154277L, 154279L, 154291L, 154303L, 154313L, 154321L, 154333L, 154339L,
-154351L, 154369L, 154373L, 154387L, 154409L, 154417L, 154423L, 154439L, 154459L,
-154487L, 154493L, 154501L, 154523L, 154543L, 154571L, 154573L, 154579L, 154589L,
-154591L, 154613L, 154619L, 154621L, 154643L, 154667L, 154669L, 154681L, 154691L,
-154699L, 154723L, 154727L, 154733L, 154747L, 154753L, 154769L, 154787L, 154789L,
-154799L, 154807L, 154823L, 154841L, 154849L, 154871L, 154873L, 154877L, 154883L,
-154897L, 154927L, 154933L, 154937L, 154943L, 154981L, 154991L, 155003L, 155009L,
-155017L, 155027L, 155047L, 155069L, 155081L, 155083L, 155087L, 155119L, 155137L,
-155153L, 155161L, 155167L, 155171L, 155191L, 155201L, 155203L, 155209L, 155219L,
-155231L, 155251L, 155269L, 155291L, 155299L, 155303L, 155317L, 155327L, 155333L,
-155371L, 155377L, 155381L, 155383L, 155387L, 155399L, 155413L, 155423L, 155443L,
-155453L, 155461L, 155473L, 155501L, 155509L, 155521L, 155537L, 155539L, 155557L,
-155569L, 155579L, 155581L, 155593L, 155599L, 155609L, 155621L, 155627L, 155653L,
-155657L, 155663L, 155671L, 155689L, 155693L, 155699L, 155707L, 155717L, 155719L,
-155723L, 155731L, 155741L, 155747L, 155773L, 155777L, 155783L, 155797L, 155801L,
-155809L, 155821L, 155833L, 155849L, 155851L, 155861L, 155863L, 155887L, 155891L,
-155893L, 155921L, 156007L, 156011L, 156019L, 156041L, 156059L, 156061L, 156071L,
-156089L, 156109L, 156119L, 156127L, 156131L, 156139L, 156151L, 156157L, 156217L,
-156227L, 156229L, 156241L, 156253L, 156257L, 156259L, 156269L, 156307L, 156319L,
-156329L, 156347L, 156353L, 156361L, 156371L, 156419L, 156421L, 156437L, 156467L,
-156487L, 156491L, 156493L, 156511L, 156521L, 156539L, 156577L, 156589L, 156593L,
-156601L, 156619L, 156623L, 156631L, 156641L, 156659L, 156671L, 156677L, 156679L,
-156683L, 156691L, 156703L, 156707L, 156719L, 156727L, 156733L, 156749L, 156781L,
-156797L, 156799L, 156817L, 156823L, 156833L, 156841L, 156887L, 156899L, 156901L,
-156913L, 156941L, 156943L, 156967L, 156971L, 156979L, 157007L, 157013L, 157019L,
-157037L, 157049L, 157051L, 157057L, 157061L, 157081L, 157103L, 157109L, 157127L,
-157133L, 157141L, 157163L, 157177L, 157181L, 157189L, 157207L, 157211L, 157217L,
-157219L, 157229L, 157231L, 157243L, 157247L, 157253L, 157259L, 157271L, 157273L,
-157277L, 157279L, 157291L, 157303L, 157307L, 157321L, 157327L, 157349L, 157351L,
-157363L, 157393L, 157411L, 157427L, 157429L, 157433L, 157457L, 157477L, 157483L,
-157489L, 157513L, 157519L, 157523L, 157543L, 157559L, 157561L, 157571L, 157579L,
-157627L, 157637L, 157639L, 157649L, 157667L, 157669L, 157679L, 157721L, 157733L,
-157739L, 157747L, 157769L, 157771L, 157793L, 157799L, 157813L, 157823L, 157831L,
-157837L, 157841L, 157867L, 157877L, 157889L, 157897L, 157901L, 157907L, 157931L,
-157933L, 157951L, 157991L, 157999L, 158003L, 158009L, 158017L, 158029L, 158047L,
-158071L, 158077L, 158113L, 158129L, 158141L, 158143L, 158161L, 158189L, 158201L,
-158209L, 158227L, 158231L, 158233L, 158243L, 158261L, 158269L, 158293L, 158303L,
-158329L, 158341L, 158351L, 158357L, 158359L, 158363L, 158371L, 158393L, 158407L,
-158419L, 158429L, 158443L, 158449L, 158489L, 158507L, 158519L, 158527L, 158537L,
-158551L, 158563L, 158567L, 158573L, 158581L, 158591L, 158597L, 158611L, 158617L,
-158621L, 158633L, 158647L, 158657L, 158663L, 158699L, 158731L, 158747L, 158749L,
-158759L, 158761L, 158771L, 158777L, 158791L, 158803L, 158843L, 158849L, 158863L,
-158867L, 158881L, 158909L, 158923L, 158927L, 158941L, 158959L, 158981L, 158993L,
-159013L, 159017L, 159023L, 159059L, 159073L, 159079L, 159097L, 159113L, 159119L,
-159157L, 159161L, 159167L, 159169L, 159179L, 159191L, 159193L, 159199L, 159209L,
-159223L, 159227L, 159233L, 159287L, 159293L, 159311L, 159319L, 159337L, 159347L,
-159349L, 159361L, 159389L, 159403L, 159407L, 159421L, 159431L, 159437L, 159457L,
-159463L, 159469L, 159473L, 159491L, 159499L, 159503L, 159521L, 159539L, 159541L,
-159553L, 159563L, 159569L, 159571L, 159589L, 159617L, 159623L, 159629L, 159631L,
-159667L, 159671L, 159673L, 159683L, 159697L, 159701L, 159707L, 159721L, 159737L,
-159739L, 159763L, 159769L, 159773L, 159779L, 159787L, 159791L, 159793L, 159799L,
-159811L, 159833L, 159839L, 159853L, 159857L, 159869L, 159871L, 159899L, 159911L,
-159931L, 159937L, 159977L, 159979L, 160001L, 160009L, 160019L, 160031L, 160033L,
-160049L, 160073L, 160079L, 160081L, 160087L, 160091L, 160093L, 160117L, 160141L,
-160159L, 160163L, 160169L, 160183L, 160201L, 160207L, 160217L, 160231L, 160243L,
-160253L, 160309L, 160313L, 160319L, 160343L, 160357L, 160367L, 160373L, 160387L,
-160397L, 160403L, 160409L, 160423L, 160441L, 160453L, 160481L, 160483L, 160499L,
-160507L, 160541L, 160553L, 160579L, 160583L, 160591L, 160603L, 160619L, 160621L,
-160627L, 160637L, 160639L, 160649L, 160651L, 160663L, 160669L, 160681L, 160687L,
-160697L, 160709L, 160711L, 160723L, 160739L, 160751L, 160753L, 160757L, 160781L,
-160789L, 160807L, 160813L, 160817L, 160829L, 160841L, 160861L, 160877L, 160879L,
-160883L, 160903L, 160907L, 160933L, 160967L, 160969L, 160981L, 160997L, 161009L,
-161017L, 161033L, 161039L, 161047L, 161053L, 161059L, 161071L, 161087L, 161093L,
-161123L, 161137L, 161141L, 161149L, 161159L, 161167L, 161201L, 161221L, 161233L,
-161237L, 161263L, 161267L, 161281L, 161303L, 161309L, 161323L, 161333L, 161339L,
-161341L, 161363L, 161377L, 161387L, 161407L, 161411L, 161453L, 161459L, 161461L,
-161471L, 161503L, 161507L, 161521L, 161527L, 161531L, 161543L, 161561L, 161563L,
-161569L, 161573L, 161591L, 161599L, 161611L, 161627L, 161639L, 161641L, 161659L,
-161683L, 161717L, 161729L, 161731L, 161741L, 161743L, 161753L, 161761L, 161771L,
-161773L, 161779L, 161783L, 161807L, 161831L, 161839L, 161869L, 161873L, 161879L,
-161881L, 161911L, 161921L, 161923L, 161947L, 161957L, 161969L, 161971L, 161977L,
-161983L, 161999L, 162007L, 162011L, 162017L, 162053L, 162059L, 162079L, 162091L,
-162109L, 162119L, 162143L, 162209L, 162221L, 162229L, 162251L, 162257L, 162263L,
-162269L, 162277L, 162287L, 162289L, 162293L, 162343L, 162359L, 162389L, 162391L,
-162413L, 162419L, 162439L, 162451L, 162457L, 162473L, 162493L, 162499L, 162517L,
-162523L, 162527L, 162529L, 162553L, 162557L, 162563L, 162577L, 162593L, 162601L,
-162611L, 162623L, 162629L, 162641L, 162649L, 162671L, 162677L, 162683L, 162691L,
-162703L, 162709L, 162713L, 162727L, 162731L, 162739L, 162749L, 162751L, 162779L,
-162787L, 162791L, 162821L, 162823L, 162829L, 162839L, 162847L, 162853L, 162859L,
-162881L, 162889L, 162901L, 162907L, 162917L, 162937L, 162947L, 162971L, 162973L,
-162989L, 162997L, 163003L, 163019L, 163021L, 163027L, 163061L, 163063L, 163109L,
-163117L, 163127L, 163129L, 163147L, 163151L, 163169L, 163171L, 163181L, 163193L,
-163199L, 163211L, 163223L, 163243L, 163249L, 163259L, 163307L, 163309L, 163321L,
-163327L, 163337L, 163351L, 163363L, 163367L, 163393L, 163403L, 163409L, 163411L,
-163417L, 163433L, 163469L, 163477L, 163481L, 163483L, 163487L, 163517L, 163543L,
-163561L, 163567L, 163573L, 163601L, 163613L, 163621L, 163627L, 163633L, 163637L,
-163643L, 163661L, 163673L, 163679L, 163697L, 163729L, 163733L, 163741L, 163753L,
-163771L, 163781L, 163789L, 163811L, 163819L, 163841L, 163847L, 163853L, 163859L,
-163861L, 163871L, 163883L, 163901L, 163909L, 163927L, 163973L, 163979L, 163981L,
-163987L, 163991L, 163993L, 163997L, 164011L, 164023L, 164039L, 164051L, 164057L,
-164071L, 164089L, 164093L, 164113L, 164117L, 164147L, 164149L, 164173L, 164183L,
-164191L, 164201L, 164209L, 164231L, 164233L, 164239L, 164249L, 164251L, 164267L,
-164279L, 164291L, 164299L, 164309L, 164321L, 164341L, 164357L, 164363L, 164371L,
-164377L, 164387L, 164413L, 164419L, 164429L, 164431L, 164443L, 164447L, 164449L,
-164471L, 164477L, 164503L, 164513L, 164531L, 164569L, 164581L, 164587L, 164599L,
-164617L, 164621L, 164623L, 164627L, 164653L, 164663L, 164677L, 164683L, 164701L,
-164707L, 164729L, 164743L, 164767L, 164771L, 164789L, 164809L, 164821L, 164831L,
-164837L, 164839L, 164881L, 164893L, 164911L, 164953L, 164963L, 164987L, 164999L,
-165001L, 165037L, 165041L, 165047L, 165049L, 165059L, 165079L, 165083L, 165089L,
-165103L, 165133L, 165161L, 165173L, 165181L, 165203L, 165211L, 165229L, 165233L,
-165247L, 165287L, 165293L, 165311L, 165313L, 165317L, 165331L, 165343L, 165349L,
-165367L, 165379L, 165383L, 165391L, 165397L, 165437L, 165443L, 165449L, 165457L,
-165463L, 165469L, 165479L, 165511L, 165523L, 165527L, 165533L, 165541L, 165551L,
-165553L, 165559L, 165569L, 165587L, 165589L, 165601L, 165611L, 165617L, 165653L,
-165667L, 165673L, 165701L, 165703L, 165707L, 165709L, 165713L, 165719L, 165721L,
-165749L, 165779L, 165799L, 165811L, 165817L, 165829L, 165833L, 165857L, 165877L,
-165883L, 165887L, 165901L, 165931L, 165941L, 165947L, 165961L, 165983L, 166013L,
-166021L, 166027L, 166031L, 166043L, 166063L, 166081L, 166099L, 166147L, 166151L,
-166157L, 166169L, 166183L, 166189L, 166207L, 166219L, 166237L, 166247L, 166259L,
-166273L, 166289L, 166297L, 166301L, 166303L, 166319L, 166349L, 166351L, 166357L,
-166363L, 166393L, 166399L, 166403L, 166409L, 166417L, 166429L, 166457L, 166471L,
-166487L, 166541L, 166561L, 166567L, 166571L, 166597L, 166601L, 166603L, 166609L,
-166613L, 166619L, 166627L, 166631L, 166643L, 166657L, 166667L, 166669L, 166679L,
-166693L, 166703L, 166723L, 166739L, 166741L, 166781L, 166783L, 166799L, 166807L,
-166823L, 166841L, 166843L, 166847L, 166849L, 166853L, 166861L, 166867L, 166871L,
-166909L, 166919L, 166931L, 166949L, 166967L, 166973L, 166979L, 166987L, 167009L,
-167017L, 167021L, 167023L, 167033L, 167039L, 167047L, 167051L, 167071L, 167077L,
-167081L, 167087L, 167099L, 167107L, 167113L, 167117L, 167119L, 167149L, 167159L,
-167173L, 167177L, 167191L, 167197L, 167213L, 167221L, 167249L, 167261L, 167267L,
-167269L, 167309L, 167311L, 167317L, 167329L, 167339L, 167341L, 167381L, 167393L,
-167407L, 167413L, 167423L, 167429L, 167437L, 167441L, 167443L, 167449L, 167471L,
-167483L, 167491L, 167521L, 167537L, 167543L, 167593L, 167597L, 167611L, 167621L,
-167623L, 167627L, 167633L, 167641L, 167663L, 167677L, 167683L, 167711L, 167729L,
-167747L, 167759L, 167771L, 167777L, 167779L, 167801L, 167809L, 167861L, 167863L,
-167873L, 167879L, 167887L, 167891L, 167899L, 167911L, 167917L, 167953L, 167971L,
-167987L, 168013L, 168023L, 168029L, 168037L, 168043L, 168067L, 168071L, 168083L,
-168089L, 168109L, 168127L, 168143L, 168151L, 168193L, 168197L, 168211L, 168227L,
-168247L, 168253L, 168263L, 168269L, 168277L, 168281L, 168293L, 168323L, 168331L,
-168347L, 168353L, 168391L, 168409L, 168433L, 168449L, 168451L, 168457L, 168463L,
-168481L, 168491L, 168499L, 168523L, 168527L, 168533L, 168541L, 168559L, 168599L,
-168601L, 168617L, 168629L, 168631L, 168643L, 168673L, 168677L, 168697L, 168713L,
-168719L, 168731L, 168737L, 168743L, 168761L, 168769L, 168781L, 168803L, 168851L,
-168863L, 168869L, 168887L, 168893L, 168899L, 168901L, 168913L, 168937L, 168943L,
-168977L, 168991L, 169003L, 169007L, 169009L, 169019L, 169049L, 169063L, 169067L,
-169069L, 169079L, 169093L, 169097L, 169111L, 169129L, 169151L, 169159L, 169177L,
-169181L, 169199L, 169217L, 169219L, 169241L, 169243L, 169249L, 169259L, 169283L,
-169307L, 169313L, 169319L, 169321L, 169327L, 169339L, 169343L, 169361L, 169369L,
-169373L, 169399L, 169409L, 169427L, 169457L, 169471L, 169483L, 169489L, 169493L,
-169501L, 169523L, 169531L, 169553L, 169567L, 169583L, 169591L, 169607L, 169627L,
-169633L, 169639L, 169649L, 169657L, 169661L, 169667L, 169681L, 169691L, 169693L,
-169709L, 169733L, 169751L, 169753L, 169769L, 169777L, 169783L, 169789L, 169817L,
-169823L, 169831L, 169837L, 169843L, 169859L, 169889L, 169891L, 169909L, 169913L,
-169919L, 169933L, 169937L, 169943L, 169951L, 169957L, 169987L, 169991L, 170003L,
-170021L, 170029L, 170047L, 170057L, 170063L, 170081L, 170099L, 170101L, 170111L,
-170123L, 170141L, 170167L, 170179L, 170189L, 170197L, 170207L, 170213L, 170227L,
-170231L, 170239L, 170243L, 170249L, 170263L, 170267L, 170279L, 170293L, 170299L,
-170327L, 170341L, 170347L, 170351L, 170353L, 170363L, 170369L, 170371L, 170383L,
-170389L, 170393L, 170413L, 170441L, 170447L, 170473L, 170483L, 170497L, 170503L,
-170509L, 170537L, 170539L, 170551L, 170557L, 170579L, 170603L, 170609L, 170627L,
-170633L, 170641L, 170647L, 170669L, 170689L, 170701L, 170707L, 170711L, 170741L,
-170749L, 170759L, 170761L, 170767L, 170773L, 170777L, 170801L, 170809L, 170813L,
-170827L, 170837L, 170843L, 170851L, 170857L, 170873L, 170881L, 170887L, 170899L,
-170921L, 170927L, 170953L, 170957L, 170971L, 171007L, 171023L, 171029L, 171043L,
-171047L, 171049L, 171053L, 171077L, 171079L, 171091L, 171103L, 171131L, 171161L,
-171163L, 171167L, 171169L, 171179L, 171203L, 171233L, 171251L, 171253L, 171263L,
-171271L, 171293L, 171299L, 171317L, 171329L, 171341L, 171383L, 171401L, 171403L,
-171427L, 171439L, 171449L, 171467L, 171469L, 171473L, 171481L, 171491L, 171517L,
-171529L, 171539L, 171541L, 171553L, 171559L, 171571L, 171583L, 171617L, 171629L,
-171637L, 171641L, 171653L, 171659L, 171671L, 171673L, 171679L, 171697L, 171707L,
-171713L, 171719L, 171733L, 171757L, 171761L, 171763L, 171793L, 171799L, 171803L,
-171811L, 171823L, 171827L, 171851L, 171863L, 171869L, 171877L, 171881L, 171889L,
-171917L, 171923L, 171929L, 171937L, 171947L, 172001L, 172009L, 172021L, 172027L,
-172031L, 172049L, 172069L, 172079L, 172093L, 172097L, 172127L, 172147L, 172153L,
-172157L, 172169L, 172171L, 172181L, 172199L, 172213L, 172217L, 172219L, 172223L,
-172243L, 172259L, 172279L, 172283L, 172297L, 172307L, 172313L, 172321L, 172331L,
-172343L, 172351L, 172357L, 172373L, 172399L, 172411L, 172421L, 172423L, 172427L,
-172433L, 172439L, 172441L, 172489L, 172507L, 172517L, 172519L, 172541L, 172553L,
-172561L, 172573L, 172583L, 172589L, 172597L, 172603L, 172607L, 172619L, 172633L,
-172643L, 172649L, 172657L, 172663L, 172673L, 172681L, 172687L, 172709L, 172717L,
-172721L, 172741L, 172751L, 172759L, 172787L, 172801L, 172807L, 172829L, 172849L,
-172853L, 172859L, 172867L, 172871L, 172877L, 172883L, 172933L, 172969L, 172973L,
-172981L, 172987L, 172993L, 172999L, 173021L, 173023L, 173039L, 173053L, 173059L,
-173081L, 173087L, 173099L, 173137L, 173141L, 173149L, 173177L, 173183L, 173189L,
-173191L, 173207L, 173209L, 173219L, 173249L, 173263L, 173267L, 173273L, 173291L,
-173293L, 173297L, 173309L, 173347L, 173357L, 173359L, 173429L, 173431L, 173473L,
-173483L, 173491L, 173497L, 173501L, 173531L, 173539L, 173543L, 173549L, 173561L,
-173573L, 173599L, 173617L, 173629L, 173647L, 173651L, 173659L, 173669L, 173671L,
-173683L, 173687L, 173699L, 173707L, 173713L, 173729L, 173741L, 173743L, 173773L,
-173777L, 173779L, 173783L, 173807L, 173819L, 173827L, 173839L, 173851L, 173861L,
-173867L, 173891L, 173897L, 173909L, 173917L, 173923L, 173933L, 173969L, 173977L,
-173981L, 173993L, 174007L, 174017L, 174019L, 174047L, 174049L, 174061L, 174067L,
-174071L, 174077L, 174079L, 174091L, 174101L, 174121L, 174137L, 174143L, 174149L,
-174157L, 174169L, 174197L, 174221L, 174241L, 174257L, 174259L, 174263L, 174281L,
-174289L, 174299L, 174311L, 174329L, 174331L, 174337L, 174347L, 174367L, 174389L,
-174407L, 174413L, 174431L, 174443L, 174457L, 174467L, 174469L, 174481L, 174487L,
-174491L, 174527L, 174533L, 174569L, 174571L, 174583L, 174599L, 174613L, 174617L,
-174631L, 174637L, 174649L, 174653L, 174659L, 174673L, 174679L, 174703L, 174721L,
-174737L, 174749L, 174761L, 174763L, 174767L, 174773L, 174799L, 174821L, 174829L,
-174851L, 174859L, 174877L, 174893L, 174901L, 174907L, 174917L, 174929L, 174931L,
-174943L, 174959L, 174989L, 174991L, 175003L, 175013L, 175039L, 175061L, 175067L,
-175069L, 175079L, 175081L, 175103L, 175129L, 175141L, 175211L, 175229L, 175261L,
-175267L, 175277L, 175291L, 175303L, 175309L, 175327L, 175333L, 175349L, 175361L,
-175391L, 175393L, 175403L, 175411L, 175433L, 175447L, 175453L, 175463L, 175481L,
-175493L, 175499L, 175519L, 175523L, 175543L, 175573L, 175601L, 175621L, 175631L,
-175633L, 175649L, 175663L, 175673L, 175687L, 175691L, 175699L, 175709L, 175723L,
-175727L, 175753L, 175757L, 175759L, 175781L, 175783L, 175811L, 175829L, 175837L,
-175843L, 175853L, 175859L, 175873L, 175891L, 175897L, 175909L, 175919L, 175937L,
-175939L, 175949L, 175961L, 175963L, 175979L, 175991L, 175993L, 176017L, 176021L,
-176023L, 176041L, 176047L, 176051L, 176053L, 176063L, 176081L, 176087L, 176089L,
-176123L, 176129L, 176153L, 176159L, 176161L, 176179L, 176191L, 176201L, 176207L,
-176213L, 176221L, 176227L, 176237L, 176243L, 176261L, 176299L, 176303L, 176317L,
-176321L, 176327L, 176329L, 176333L, 176347L, 176353L, 176357L, 176369L, 176383L,
-176389L, 176401L, 176413L, 176417L, 176419L, 176431L, 176459L, 176461L, 176467L,
-176489L, 176497L, 176503L, 176507L, 176509L, 176521L, 176531L, 176537L, 176549L,
-176551L, 176557L, 176573L, 176591L, 176597L, 176599L, 176609L, 176611L, 176629L,
-176641L, 176651L, 176677L, 176699L, 176711L, 176713L, 176741L, 176747L, 176753L,
-176777L, 176779L, 176789L, 176791L, 176797L, 176807L, 176809L, 176819L, 176849L,
-176857L, 176887L, 176899L, 176903L, 176921L, 176923L, 176927L, 176933L, 176951L,
-176977L, 176983L, 176989L, 177007L, 177011L, 177013L, 177019L, 177043L, 177091L,
-177101L, 177109L, 177113L, 177127L, 177131L, 177167L, 177173L, 177209L, 177211L,
-177217L, 177223L, 177239L, 177257L, 177269L, 177283L, 177301L, 177319L, 177323L,
-177337L, 177347L, 177379L, 177383L, 177409L, 177421L, 177427L, 177431L, 177433L,
-177467L, 177473L, 177481L, 177487L, 177493L, 177511L, 177533L, 177539L, 177553L,
-177589L, 177601L, 177623L, 177647L, 177677L, 177679L, 177691L, 177739L, 177743L,
-177761L, 177763L, 177787L, 177791L, 177797L, 177811L, 177823L, 177839L, 177841L,
-177883L, 177887L, 177889L, 177893L, 177907L, 177913L, 177917L, 177929L, 177943L,
-177949L, 177953L, 177967L, 177979L, 178001L, 178021L, 178037L, 178039L, 178067L,
-178069L, 178091L, 178093L, 178103L, 178117L, 178127L, 178141L, 178151L, 178169L,
-178183L, 178187L, 178207L, 178223L, 178231L, 178247L, 178249L, 178259L, 178261L,
-178289L, 178301L, 178307L, 178327L, 178333L, 178349L, 178351L, 178361L, 178393L,
-178397L, 178403L, 178417L, 178439L, 178441L, 178447L, 178469L, 178481L, 178487L,
-178489L, 178501L, 178513L, 178531L, 178537L, 178559L, 178561L, 178567L, 178571L,
-178597L, 178601L, 178603L, 178609L, 178613L, 178621L, 178627L, 178639L, 178643L,
-178681L, 178691L, 178693L, 178697L, 178753L, 178757L, 178781L, 178793L, 178799L,
-178807L, 178813L, 178817L, 178819L, 178831L, 178853L, 178859L, 178873L, 178877L,
-178889L, 178897L, 178903L, 178907L, 178909L, 178921L, 178931L, 178933L, 178939L,
-178951L, 178973L, 178987L, 179021L, 179029L, 179033L, 179041L, 179051L, 179057L,
-179083L, 179089L, 179099L, 179107L, 179111L, 179119L, 179143L, 179161L, 179167L,
-179173L, 179203L, 179209L, 179213L, 179233L, 179243L, 179261L, 179269L, 179281L,
-179287L, 179317L, 179321L, 179327L, 179351L, 179357L, 179369L, 179381L, 179383L,
-179393L, 179407L, 179411L, 179429L, 179437L, 179441L, 179453L, 179461L, 179471L,
-179479L, 179483L, 179497L, 179519L, 179527L, 179533L, 179549L, 179563L, 179573L,
-179579L, 179581L, 179591L, 179593L, 179603L, 179623L, 179633L, 179651L, 179657L,
-179659L, 179671L, 179687L, 179689L, 179693L, 179717L, 179719L, 179737L, 179743L,
-179749L, 179779L, 179801L, 179807L, 179813L, 179819L, 179821L, 179827L, 179833L,
-179849L, 179897L, 179899L, 179903L, 179909L, 179917L, 179923L, 179939L, 179947L,
-179951L, 179953L, 179957L, 179969L, 179981L, 179989L, 179999L, 180001L, 180007L,
-180023L, 180043L, 180053L, 180071L, 180073L, 180077L, 180097L, 180137L, 180161L,
-180179L, 180181L, 180211L, 180221L, 180233L, 180239L, 180241L, 180247L, 180259L,
-180263L, 180281L, 180287L, 180289L, 180307L, 180311L, 180317L, 180331L, 180337L,
-180347L, 180361L, 180371L, 180379L, 180391L, 180413L, 180419L, 180437L, 180463L,
-180473L, 180491L, 180497L, 180503L, 180511L, 180533L, 180539L, 180541L, 180547L,
-180563L, 180569L, 180617L, 180623L, 180629L, 180647L, 180667L, 180679L, 180701L,
-180731L, 180749L, 180751L, 180773L, 180779L, 180793L, 180797L, 180799L, 180811L,
-180847L, 180871L, 180883L, 180907L, 180949L, 180959L, 181001L, 181003L, 181019L,
-181031L, 181039L, 181061L, 181063L, 181081L, 181087L, 181123L, 181141L, 181157L,
-181183L, 181193L, 181199L, 181201L, 181211L, 181213L, 181219L, 181243L, 181253L,
-181273L, 181277L, 181283L, 181297L, 181301L, 181303L, 181361L, 181387L, 181397L,
-181399L, 181409L, 181421L, 181439L, 181457L, 181459L, 181499L, 181501L, 181513L,
-181523L, 181537L, 181549L, 181553L, 181603L, 181607L, 181609L, 181619L, 181639L,
-181667L, 181669L, 181693L, 181711L, 181717L, 181721L, 181729L, 181739L, 181751L,
-181757L, 181759L, 181763L, 181777L, 181787L, 181789L, 181813L, 181837L, 181871L,
-181873L, 181889L, 181891L, 181903L, 181913L, 181919L, 181927L, 181931L, 181943L,
-181957L, 181967L, 181981L, 181997L, 182009L, 182011L, 182027L, 182029L, 182041L,
-182047L, 182057L, 182059L, 182089L, 182099L, 182101L, 182107L, 182111L, 182123L,
-182129L, 182131L, 182141L, 182159L, 182167L, 182177L, 182179L, 182201L, 182209L,
-182233L, 182239L, 182243L, 182261L, 182279L, 182297L, 182309L, 182333L, 182339L,
-182341L, 182353L, 182387L, 182389L, 182417L, 182423L, 182431L, 182443L, 182453L,
-182467L, 182471L, 182473L, 182489L, 182503L, 182509L, 182519L, 182537L, 182549L,
-182561L, 182579L, 182587L, 182593L, 182599L, 182603L, 182617L, 182627L, 182639L,
-182641L, 182653L, 182657L, 182659L, 182681L, 182687L, 182701L, 182711L, 182713L,
-182747L, 182773L, 182779L, 182789L, 182803L, 182813L, 182821L, 182839L, 182851L,
-182857L, 182867L, 182887L, 182893L, 182899L, 182921L, 182927L, 182929L, 182933L,
-182953L, 182957L, 182969L, 182981L, 182999L, 183023L, 183037L, 183041L, 183047L,
-183059L, 183067L, 183089L, 183091L, 183119L, 183151L, 183167L, 183191L, 183203L,
-183247L, 183259L, 183263L, 183283L, 183289L, 183299L, 183301L, 183307L, 183317L,
-183319L, 183329L, 183343L, 183349L, 183361L, 183373L, 183377L, 183383L, 183389L,
-183397L, 183437L, 183439L, 183451L, 183461L, 183473L, 183479L, 183487L, 183497L,
-183499L, 183503L, 183509L, 183511L, 183523L, 183527L, 183569L, 183571L, 183577L,
-183581L, 183587L, 183593L, 183611L, 183637L, 183661L, 183683L, 183691L, 183697L,
-183707L, 183709L, 183713L, 183761L, 183763L, 183797L, 183809L, 183823L, 183829L,
-183871L, 183877L, 183881L, 183907L, 183917L, 183919L, 183943L, 183949L, 183959L,
-183971L, 183973L, 183979L, 184003L, 184007L, 184013L, 184031L, 184039L, 184043L,
-184057L, 184073L, 184081L, 184087L, 184111L, 184117L, 184133L, 184153L, 184157L,
-184181L, 184187L, 184189L, 184199L, 184211L, 184231L, 184241L, 184259L, 184271L,
-184273L, 184279L, 184291L, 184309L, 184321L, 184333L, 184337L, 184351L, 184369L,
-184409L, 184417L, 184441L, 184447L, 184463L, 184477L, 184487L, 184489L, 184511L,
-184517L, 184523L, 184553L, 184559L, 184567L, 184571L, 184577L, 184607L, 184609L,
-184627L, 184631L, 184633L, 184649L, 184651L, 184669L, 184687L, 184693L, 184703L,
-184711L, 184721L, 184727L, 184733L, 184753L, 184777L, 184823L, 184829L, 184831L,
-184837L, 184843L, 184859L, 184879L, 184901L, 184903L, 184913L, 184949L, 184957L,
-184967L, 184969L, 184993L, 184997L, 184999L, 185021L, 185027L, 185051L, 185057L,
-185063L, 185069L, 185071L, 185077L, 185089L, 185099L, 185123L, 185131L, 185137L,
-185149L, 185153L, 185161L, 185167L, 185177L, 185183L, 185189L, 185221L, 185233L,
-185243L, 185267L, 185291L, 185299L, 185303L, 185309L, 185323L, 185327L, 185359L,
-185363L, 185369L, 185371L, 185401L, 185429L, 185441L, 185467L, 185477L, 185483L,
-185491L, 185519L, 185527L, 185531L, 185533L, 185539L, 185543L, 185551L, 185557L,
-185567L, 185569L, 185593L, 185599L, 185621L, 185641L, 185651L, 185677L, 185681L,
-185683L, 185693L, 185699L, 185707L, 185711L, 185723L, 185737L, 185747L, 185749L,
-185753L, 185767L, 185789L, 185797L, 185813L, 185819L, 185821L, 185831L, 185833L,
-185849L, 185869L, 185873L, 185893L, 185897L, 185903L, 185917L, 185923L, 185947L,
-185951L, 185957L, 185959L, 185971L, 185987L, 185993L, 186007L, 186013L, 186019L,
-186023L, 186037L, 186041L, 186049L, 186071L, 186097L, 186103L, 186107L, 186113L,
-186119L, 186149L, 186157L, 186161L, 186163L, 186187L, 186191L, 186211L, 186227L,
-186229L, 186239L, 186247L, 186253L, 186259L, 186271L, 186283L, 186299L, 186301L,
-186311L, 186317L, 186343L, 186377L, 186379L, 186391L, 186397L, 186419L, 186437L,
-186451L, 186469L, 186479L, 186481L, 186551L, 186569L, 186581L, 186583L, 186587L,
-186601L, 186619L, 186629L, 186647L, 186649L, 186653L, 186671L, 186679L, 186689L,
-186701L, 186707L, 186709L, 186727L, 186733L, 186743L, 186757L, 186761L, 186763L,
-186773L, 186793L, 186799L, 186841L, 186859L, 186869L, 186871L, 186877L, 186883L,
-186889L, 186917L, 186947L, 186959L, 187003L, 187009L, 187027L, 187043L, 187049L,
-187067L, 187069L, 187073L, 187081L, 187091L, 187111L, 187123L, 187127L, 187129L,
-187133L, 187139L, 187141L, 187163L, 187171L, 187177L, 187181L, 187189L, 187193L,
-187211L, 187217L, 187219L, 187223L, 187237L, 187273L, 187277L, 187303L, 187337L,
-187339L, 187349L, 187361L, 187367L, 187373L, 187379L, 187387L, 187393L, 187409L,
-187417L, 187423L, 187433L, 187441L, 187463L, 187469L, 187471L, 187477L, 187507L,
-187513L, 187531L, 187547L, 187559L, 187573L, 187597L, 187631L, 187633L, 187637L,
-187639L, 187651L, 187661L, 187669L, 187687L, 187699L, 187711L, 187721L, 187751L,
-187763L, 187787L, 187793L, 187823L, 187843L, 187861L, 187871L, 187877L, 187883L,
-187897L, 187907L, 187909L, 187921L, 187927L, 187931L, 187951L, 187963L, 187973L,
-187987L, 188011L, 188017L, 188021L, 188029L, 188107L, 188137L, 188143L, 188147L,
-188159L, 188171L, 188179L, 188189L, 188197L, 188249L, 188261L, 188273L, 188281L,
-188291L, 188299L, 188303L, 188311L, 188317L, 188323L, 188333L, 188351L, 188359L,
-188369L, 188389L, 188401L, 188407L, 188417L, 188431L, 188437L, 188443L, 188459L,
-188473L, 188483L, 188491L, 188519L, 188527L, 188533L, 188563L, 188579L, 188603L,
-188609L, 188621L, 188633L, 188653L, 188677L, 188681L, 188687L, 188693L, 188701L,
-188707L, 188711L, 188719L, 188729L, 188753L, 188767L, 188779L, 188791L, 188801L,
-188827L, 188831L, 188833L, 188843L, 188857L, 188861L, 188863L, 188869L, 188891L,
-188911L, 188927L, 188933L, 188939L, 188941L, 188953L, 188957L, 188983L, 188999L,
-189011L, 189017L, 189019L, 189041L, 189043L, 189061L, 189067L, 189127L, 189139L,
-189149L, 189151L, 189169L, 189187L, 189199L, 189223L, 189229L, 189239L, 189251L,
-189253L, 189257L, 189271L, 189307L, 189311L, 189337L, 189347L, 189349L, 189353L,
-189361L, 189377L, 189389L, 189391L, 189401L, 189407L, 189421L, 189433L, 189437L,
-189439L, 189463L, 189467L, 189473L, 189479L, 189491L, 189493L, 189509L, 189517L,
-189523L, 189529L, 189547L, 189559L, 189583L, 189593L, 189599L, 189613L, 189617L,
-189619L, 189643L, 189653L, 189661L, 189671L, 189691L, 189697L, 189701L, 189713L,
-189733L, 189743L, 189757L, 189767L, 189797L, 189799L, 189817L, 189823L, 189851L,
-189853L, 189859L, 189877L, 189881L, 189887L, 189901L, 189913L, 189929L, 189947L,
-189949L, 189961L, 189967L, 189977L, 189983L, 189989L, 189997L, 190027L, 190031L,
-190051L, 190063L, 190093L, 190097L, 190121L, 190129L, 190147L, 190159L, 190181L,
-190207L, 190243L, 190249L, 190261L, 190271L, 190283L, 190297L, 190301L, 190313L,
-190321L, 190331L, 190339L, 190357L, 190367L, 190369L, 190387L, 190391L, 190403L,
-190409L, 190471L, 190507L, 190523L, 190529L, 190537L, 190543L, 190573L, 190577L,
-190579L, 190583L, 190591L, 190607L, 190613L, 190633L, 190639L, 190649L, 190657L,
-190667L, 190669L, 190699L, 190709L, 190711L, 190717L, 190753L, 190759L, 190763L,
-190769L, 190783L, 190787L, 190793L, 190807L, 190811L, 190823L, 190829L, 190837L,
-190843L, 190871L, 190889L, 190891L, 190901L, 190909L, 190913L, 190921L, 190979L,
-190997L, 191021L, 191027L, 191033L, 191039L, 191047L, 191057L, 191071L, 191089L,
-191099L, 191119L, 191123L, 191137L, 191141L, 191143L, 191161L, 191173L, 191189L,
-191227L, 191231L, 191237L, 191249L, 191251L, 191281L, 191297L, 191299L, 191339L,
-191341L, 191353L, 191413L, 191441L, 191447L, 191449L, 191453L, 191459L, 191461L,
-191467L, 191473L, 191491L, 191497L, 191507L, 191509L, 191519L, 191531L, 191533L,
-191537L, 191551L, 191561L, 191563L, 191579L, 191599L, 191621L, 191627L, 191657L,
-191669L, 191671L, 191677L, 191689L, 191693L, 191699L, 191707L, 191717L, 191747L,
-191749L, 191773L, 191783L, 191791L, 191801L, 191803L, 191827L, 191831L, 191833L,
-191837L, 191861L, 191899L, 191903L, 191911L, 191929L, 191953L, 191969L, 191977L,
-191999L, 192007L, 192013L, 192029L, 192037L, 192043L, 192047L, 192053L, 192091L,
-192097L, 192103L, 192113L, 192121L, 192133L, 192149L, 192161L, 192173L, 192187L,
-192191L, 192193L, 192229L, 192233L, 192239L, 192251L, 192259L, 192263L, 192271L,
-192307L, 192317L, 192319L, 192323L, 192341L, 192343L, 192347L, 192373L, 192377L,
-192383L, 192391L, 192407L, 192431L, 192461L, 192463L, 192497L, 192499L, 192529L,
-192539L, 192547L, 192553L, 192557L, 192571L, 192581L, 192583L, 192587L, 192601L,
-192611L, 192613L, 192617L, 192629L, 192631L, 192637L, 192667L, 192677L, 192697L,
-192737L, 192743L, 192749L, 192757L, 192767L, 192781L, 192791L, 192799L, 192811L,
-192817L, 192833L, 192847L, 192853L, 192859L, 192877L, 192883L, 192887L, 192889L,
-192917L, 192923L, 192931L, 192949L, 192961L, 192971L, 192977L, 192979L, 192991L,
-193003L, 193009L, 193013L, 193031L, 193043L, 193051L, 193057L, 193073L, 193093L,
-193133L, 193139L, 193147L, 193153L, 193163L, 193181L, 193183L, 193189L, 193201L,
-193243L, 193247L, 193261L, 193283L, 193301L, 193327L, 193337L, 193357L, 193367L,
-193373L, 193379L, 193381L, 193387L, 193393L, 193423L, 193433L, 193441L, 193447L,
-193451L, 193463L, 193469L, 193493L, 193507L, 193513L, 193541L, 193549L, 193559L,
-193573L, 193577L, 193597L, 193601L, 193603L, 193607L, 193619L, 193649L, 193663L,
-193679L, 193703L, 193723L, 193727L, 193741L, 193751L, 193757L, 193763L, 193771L,
-193789L, 193793L, 193799L, 193811L, 193813L, 193841L, 193847L, 193859L, 193861L,
-193871L, 193873L, 193877L, 193883L, 193891L, 193937L, 193939L, 193943L, 193951L,
-193957L, 193979L, 193993L, 194003L, 194017L, 194027L, 194057L, 194069L, 194071L,
-194083L, 194087L, 194093L, 194101L, 194113L, 194119L, 194141L, 194149L, 194167L,
-194179L, 194197L, 194203L, 194239L, 194263L, 194267L, 194269L, 194309L, 194323L,
-194353L, 194371L, 194377L, 194413L, 194431L, 194443L, 194471L, 194479L, 194483L,
-194507L, 194521L, 194527L, 194543L, 194569L, 194581L, 194591L, 194609L, 194647L,
-194653L, 194659L, 194671L, 194681L, 194683L, 194687L, 194707L, 194713L, 194717L,
-194723L, 194729L, 194749L, 194767L, 194771L, 194809L, 194813L, 194819L, 194827L,
-194839L, 194861L, 194863L, 194867L, 194869L, 194891L, 194899L, 194911L, 194917L,
-194933L, 194963L, 194977L, 194981L, 194989L, 195023L, 195029L, 195043L, 195047L,
-195049L, 195053L, 195071L, 195077L, 195089L, 195103L, 195121L, 195127L, 195131L,
-195137L, 195157L, 195161L, 195163L, 195193L, 195197L, 195203L, 195229L, 195241L,
-195253L, 195259L, 195271L, 195277L, 195281L, 195311L, 195319L, 195329L, 195341L,
-195343L, 195353L, 195359L, 195389L, 195401L, 195407L, 195413L, 195427L, 195443L,
-195457L, 195469L, 195479L, 195493L, 195497L, 195511L, 195527L, 195539L, 195541L,
-195581L, 195593L, 195599L, 195659L, 195677L, 195691L, 195697L, 195709L, 195731L,
-195733L, 195737L, 195739L, 195743L, 195751L, 195761L, 195781L, 195787L, 195791L,
-195809L, 195817L, 195863L, 195869L, 195883L, 195887L, 195893L, 195907L, 195913L,
-195919L, 195929L, 195931L, 195967L, 195971L, 195973L, 195977L, 195991L, 195997L,
-196003L, 196033L, 196039L, 196043L, 196051L, 196073L, 196081L, 196087L, 196111L,
-196117L, 196139L, 196159L, 196169L, 196171L, 196177L, 196181L, 196187L, 196193L,
-196201L, 196247L, 196271L, 196277L, 196279L, 196291L, 196303L, 196307L, 196331L,
-196337L, 196379L, 196387L, 196429L, 196439L, 196453L, 196459L, 196477L, 196499L,
-196501L, 196519L, 196523L, 196541L, 196543L, 196549L, 196561L, 196579L, 196583L,
-196597L, 196613L, 196643L, 196657L, 196661L, 196663L, 196681L, 196687L, 196699L,
-196709L, 196717L, 196727L, 196739L, 196751L, 196769L, 196771L, 196799L, 196817L,
-196831L, 196837L, 196853L, 196871L, 196873L, 196879L, 196901L, 196907L, 196919L,
-196927L, 196961L, 196991L, 196993L, 197003L, 197009L, 197023L, 197033L, 197059L,
-197063L, 197077L, 197083L, 197089L, 197101L, 197117L, 197123L, 197137L, 197147L,
-197159L, 197161L, 197203L, 197207L, 197221L, 197233L, 197243L, 197257L, 197261L,
-197269L, 197273L, 197279L, 197293L, 197297L, 197299L, 197311L, 197339L, 197341L,
-197347L, 197359L, 197369L, 197371L, 197381L, 197383L, 197389L, 197419L, 197423L,
-197441L, 197453L, 197479L, 197507L, 197521L, 197539L, 197551L, 197567L, 197569L,
-197573L, 197597L, 197599L, 197609L, 197621L, 197641L, 197647L, 197651L, 197677L,
-197683L, 197689L, 197699L, 197711L, 197713L, 197741L, 197753L, 197759L, 197767L,
-197773L, 197779L, 197803L, 197807L, 197831L, 197837L, 197887L, 197891L, 197893L,
-197909L, 197921L, 197927L, 197933L, 197947L, 197957L, 197959L, 197963L, 197969L,
-197971L, 198013L, 198017L, 198031L, 198043L, 198047L, 198073L, 198083L, 198091L,
-198097L, 198109L, 198127L, 198139L, 198173L, 198179L, 198193L, 198197L, 198221L,
-198223L, 198241L, 198251L, 198257L, 198259L, 198277L, 198281L, 198301L, 198313L,
-198323L, 198337L, 198347L, 198349L, 198377L, 198391L, 198397L, 198409L, 198413L,
-198427L, 198437L, 198439L, 198461L, 198463L, 198469L, 198479L, 198491L, 198503L,
-198529L, 198533L, 198553L, 198571L, 198589L, 198593L, 198599L, 198613L, 198623L,
-198637L, 198641L, 198647L, 198659L, 198673L, 198689L, 198701L, 198719L, 198733L,
-198761L, 198769L, 198811L, 198817L, 198823L, 198827L, 198829L, 198833L, 198839L,
-198841L, 198851L, 198859L, 198899L, 198901L, 198929L, 198937L, 198941L, 198943L,
-198953L, 198959L, 198967L, 198971L, 198977L, 198997L, 199021L, 199033L, 199037L,
-199039L, 199049L, 199081L, 199103L, 199109L, 199151L, 199153L, 199181L, 199193L,
-199207L, 199211L, 199247L, 199261L, 199267L, 199289L, 199313L, 199321L, 199337L,
-199343L, 199357L, 199373L, 199379L, 199399L, 199403L, 199411L, 199417L, 199429L,
-199447L, 199453L, 199457L, 199483L, 199487L, 199489L, 199499L, 199501L, 199523L,
-199559L, 199567L, 199583L, 199601L, 199603L, 199621L, 199637L, 199657L, 199669L,
-199673L, 199679L, 199687L, 199697L, 199721L, 199729L, 199739L, 199741L, 199751L,
-199753L, 199777L, 199783L, 199799L, 199807L, 199811L, 199813L, 199819L, 199831L,
-199853L, 199873L, 199877L, 199889L, 199909L, 199921L, 199931L, 199933L, 199961L,
-199967L, 199999L, 200003L, 200009L, 200017L, 200023L, 200029L, 200033L, 200041L,
-200063L, 200087L, 200117L, 200131L, 200153L, 200159L, 200171L, 200177L, 200183L,
-200191L, 200201L, 200227L, 200231L, 200237L, 200257L, 200273L, 200293L, 200297L,
-200323L, 200329L, 200341L, 200351L, 200357L, 200363L, 200371L, 200381L, 200383L,
-200401L, 200407L, 200437L, 200443L, 200461L, 200467L, 200483L, 200513L, 200569L,
-200573L, 200579L, 200587L, 200591L, 200597L, 200609L, 200639L, 200657L, 200671L,
-200689L, 200699L, 200713L, 200723L, 200731L, 200771L, 200779L, 200789L, 200797L,
-200807L, 200843L, 200861L, 200867L, 200869L, 200881L, 200891L, 200899L, 200903L,
-200909L, 200927L, 200929L, 200971L, 200983L, 200987L, 200989L, 201007L, 201011L,
-201031L, 201037L, 201049L, 201073L, 201101L, 201107L, 201119L, 201121L, 201139L,
-201151L, 201163L, 201167L, 201193L, 201203L, 201209L, 201211L, 201233L, 201247L,
-201251L, 201281L, 201287L, 201307L, 201329L, 201337L, 201359L, 201389L, 201401L,
-201403L, 201413L, 201437L, 201449L, 201451L, 201473L, 201491L, 201493L, 201497L,
-201499L, 201511L, 201517L, 201547L, 201557L, 201577L, 201581L, 201589L, 201599L,
-201611L, 201623L, 201629L, 201653L, 201661L, 201667L, 201673L, 201683L, 201701L,
-201709L, 201731L, 201743L, 201757L, 201767L, 201769L, 201781L, 201787L, 201791L,
-201797L, 201809L, 201821L, 201823L, 201827L, 201829L, 201833L, 201847L, 201881L,
-201889L, 201893L, 201907L, 201911L, 201919L, 201923L, 201937L, 201947L, 201953L,
-201961L, 201973L, 201979L, 201997L, 202001L, 202021L, 202031L, 202049L, 202061L,
-202063L, 202067L, 202087L, 202099L, 202109L, 202121L, 202127L, 202129L, 202183L,
-202187L, 202201L, 202219L, 202231L, 202243L, 202277L, 202289L, 202291L, 202309L,
-202327L, 202339L, 202343L, 202357L, 202361L, 202381L, 202387L, 202393L, 202403L,
-202409L, 202441L, 202471L, 202481L, 202493L, 202519L, 202529L, 202549L, 202567L,
-202577L, 202591L, 202613L, 202621L, 202627L, 202637L, 202639L, 202661L, 202667L,
-202679L, 202693L, 202717L, 202729L, 202733L, 202747L, 202751L, 202753L, 202757L,
-202777L, 202799L, 202817L, 202823L, 202841L, 202859L, 202877L, 202879L, 202889L,
-202907L, 202921L, 202931L, 202933L, 202949L, 202967L, 202973L, 202981L, 202987L,
-202999L, 203011L, 203017L, 203023L, 203039L, 203051L, 203057L, 203117L, 203141L,
-203173L, 203183L, 203207L, 203209L, 203213L, 203221L, 203227L, 203233L, 203249L,
-203279L, 203293L, 203309L, 203311L, 203317L, 203321L, 203323L, 203339L, 203341L,
-203351L, 203353L, 203363L, 203381L, 203383L, 203387L, 203393L, 203417L, 203419L,
-203429L, 203431L, 203449L, 203459L, 203461L, 203531L, 203549L, 203563L, 203569L,
-203579L, 203591L, 203617L, 203627L, 203641L, 203653L, 203657L, 203659L, 203663L,
-203669L, 203713L, 203761L, 203767L, 203771L, 203773L, 203789L, 203807L, 203809L,
-203821L, 203843L, 203857L, 203869L, 203873L, 203897L, 203909L, 203911L, 203921L,
-203947L, 203953L, 203969L, 203971L, 203977L, 203989L, 203999L, 204007L, 204013L,
-204019L, 204023L, 204047L, 204059L, 204067L, 204101L, 204107L, 204133L, 204137L,
-204143L, 204151L, 204161L, 204163L, 204173L, 204233L, 204251L, 204299L, 204301L,
-204311L, 204319L, 204329L, 204331L, 204353L, 204359L, 204361L, 204367L, 204371L,
-204377L, 204397L, 204427L, 204431L, 204437L, 204439L, 204443L, 204461L, 204481L,
-204487L, 204509L, 204511L, 204517L, 204521L, 204557L, 204563L, 204583L, 204587L,
-204599L, 204601L, 204613L, 204623L, 204641L, 204667L, 204679L, 204707L, 204719L,
-204733L, 204749L, 204751L, 204781L, 204791L, 204793L, 204797L, 204803L, 204821L,
-204857L, 204859L, 204871L, 204887L, 204913L, 204917L, 204923L, 204931L, 204947L,
-204973L, 204979L, 204983L, 205019L, 205031L, 205033L, 205043L, 205063L, 205069L,
-205081L, 205097L, 205103L, 205111L, 205129L, 205133L, 205141L, 205151L, 205157L,
-205171L, 205187L, 205201L, 205211L, 205213L, 205223L, 205237L, 205253L, 205267L,
-205297L, 205307L, 205319L, 205327L, 205339L, 205357L, 205391L, 205397L, 205399L,
-205417L, 205421L, 205423L, 205427L, 205433L, 205441L, 205453L, 205463L, 205477L,
-205483L, 205487L, 205493L, 205507L, 205519L, 205529L, 205537L, 205549L, 205553L,
-205559L, 205589L, 205603L, 205607L, 205619L, 205627L, 205633L, 205651L, 205657L,
-205661L, 205663L, 205703L, 205721L, 205759L, 205763L, 205783L, 205817L, 205823L,
-205837L, 205847L, 205879L, 205883L, 205913L, 205937L, 205949L, 205951L, 205957L,
-205963L, 205967L, 205981L, 205991L, 205993L, 206009L, 206021L, 206027L, 206033L,
-206039L, 206047L, 206051L, 206069L, 206077L, 206081L, 206083L, 206123L, 206153L,
-206177L, 206179L, 206183L, 206191L, 206197L, 206203L, 206209L, 206221L, 206233L,
-206237L, 206249L, 206251L, 206263L, 206273L, 206279L, 206281L, 206291L, 206299L,
-206303L, 206341L, 206347L, 206351L, 206369L, 206383L, 206399L, 206407L, 206411L,
-206413L, 206419L, 206447L, 206461L, 206467L, 206477L, 206483L, 206489L, 206501L,
-206519L, 206527L, 206543L, 206551L, 206593L, 206597L, 206603L, 206623L, 206627L,
-206639L, 206641L, 206651L, 206699L, 206749L, 206779L, 206783L, 206803L, 206807L,
-206813L, 206819L, 206821L, 206827L, 206879L, 206887L, 206897L, 206909L, 206911L,
-206917L, 206923L, 206933L, 206939L, 206951L, 206953L, 206993L, 207013L, 207017L,
-207029L, 207037L, 207041L, 207061L, 207073L, 207079L, 207113L, 207121L, 207127L,
-207139L, 207169L, 207187L, 207191L, 207197L, 207199L, 207227L, 207239L, 207241L,
-207257L, 207269L, 207287L, 207293L, 207301L, 207307L, 207329L, 207331L, 207341L,
-207343L, 207367L, 207371L, 207377L, 207401L, 207409L, 207433L, 207443L, 207457L,
-207463L, 207469L, 207479L, 207481L, 207491L, 207497L, 207509L, 207511L, 207517L,
-207521L, 207523L, 207541L, 207547L, 207551L, 207563L, 207569L, 207589L, 207593L,
-207619L, 207629L, 207643L, 207653L, 207661L, 207671L, 207673L, 207679L, 207709L,
-207719L, 207721L, 207743L, 207763L, 207769L, 207797L, 207799L, 207811L, 207821L,
-207833L, 207847L, 207869L, 207877L, 207923L, 207931L, 207941L, 207947L, 207953L,
-207967L, 207971L, 207973L, 207997L, 208001L, 208003L, 208009L, 208037L, 208049L,
-208057L, 208067L, 208073L, 208099L, 208111L, 208121L, 208129L, 208139L, 208141L,
-208147L, 208189L, 208207L, 208213L, 208217L, 208223L, 208231L, 208253L, 208261L,
-208277L, 208279L, 208283L, 208291L, 208309L, 208319L, 208333L, 208337L, 208367L,
-208379L, 208387L, 208391L, 208393L, 208409L, 208433L, 208441L, 208457L, 208459L,
-208463L, 208469L, 208489L, 208493L, 208499L, 208501L, 208511L, 208513L, 208519L,
-208529L, 208553L, 208577L, 208589L, 208591L, 208609L, 208627L, 208631L, 208657L,
-208667L, 208673L, 208687L, 208697L, 208699L, 208721L, 208729L, 208739L, 208759L,
-208787L, 208799L, 208807L, 208837L, 208843L, 208877L, 208889L, 208891L, 208907L,
-208927L, 208931L, 208933L, 208961L, 208963L, 208991L, 208993L, 208997L, 209021L,
-209029L, 209039L, 209063L, 209071L, 209089L, 209123L, 209147L, 209159L, 209173L,
-209179L, 209189L, 209201L, 209203L, 209213L, 209221L, 209227L, 209233L, 209249L,
-209257L, 209263L, 209267L, 209269L, 209299L, 209311L, 209317L, 209327L, 209333L,
-209347L, 209353L, 209357L, 209359L, 209371L, 209381L, 209393L, 209401L, 209431L,
-209441L, 209449L, 209459L, 209471L, 209477L, 209497L, 209519L, 209533L, 209543L,
-209549L, 209563L, 209567L, 209569L, 209579L, 209581L, 209597L, 209621L, 209623L,
-209639L, 209647L, 209659L, 209669L, 209687L, 209701L, 209707L, 209717L, 209719L,
-209743L, 209767L, 209771L, 209789L, 209801L, 209809L, 209813L, 209819L, 209821L,
-209837L, 209851L, 209857L, 209861L, 209887L, 209917L, 209927L, 209929L, 209939L,
-209953L, 209959L, 209971L, 209977L, 209983L, 209987L, 210011L, 210019L, 210031L,
-210037L, 210053L, 210071L, 210097L, 210101L, 210109L, 210113L, 210127L, 210131L,
-210139L, 210143L, 210157L, 210169L, 210173L, 210187L, 210191L, 210193L, 210209L,
-210229L, 210233L, 210241L, 210247L, 210257L, 210263L, 210277L, 210283L, 210299L,
-210317L, 210319L, 210323L, 210347L, 210359L, 210361L, 210391L, 210401L, 210403L,
-210407L, 210421L, 210437L, 210461L, 210467L, 210481L, 210487L, 210491L, 210499L,
-210523L, 210527L, 210533L, 210557L, 210599L, 210601L, 210619L, 210631L, 210643L,
-210659L, 210671L, 210709L, 210713L, 210719L, 210731L, 210739L, 210761L, 210773L,
-210803L, 210809L, 210811L, 210823L, 210827L, 210839L, 210853L, 210857L, 210869L,
-210901L, 210907L, 210911L, 210913L, 210923L, 210929L, 210943L, 210961L, 210967L,
-211007L, 211039L, 211049L, 211051L, 211061L, 211063L, 211067L, 211073L, 211093L,
-211097L, 211129L, 211151L, 211153L, 211177L, 211187L, 211193L, 211199L, 211213L,
-211217L, 211219L, 211229L, 211231L, 211241L, 211247L, 211271L, 211283L, 211291L,
-211297L, 211313L, 211319L, 211333L, 211339L, 211349L, 211369L, 211373L, 211403L,
-211427L, 211433L, 211441L, 211457L, 211469L, 211493L, 211499L, 211501L, 211507L,
-211543L, 211559L, 211571L, 211573L, 211583L, 211597L, 211619L, 211639L, 211643L,
-211657L, 211661L, 211663L, 211681L, 211691L, 211693L, 211711L, 211723L, 211727L,
-211741L, 211747L, 211777L, 211781L, 211789L, 211801L, 211811L, 211817L, 211859L,
-211867L, 211873L, 211877L, 211879L, 211889L, 211891L, 211927L, 211931L, 211933L,
-211943L, 211949L, 211969L, 211979L, 211997L, 212029L, 212039L, 212057L, 212081L,
-212099L, 212117L, 212123L, 212131L, 212141L, 212161L, 212167L, 212183L, 212203L,
-212207L, 212209L, 212227L, 212239L, 212243L, 212281L, 212293L, 212297L, 212353L,
-212369L, 212383L, 212411L, 212419L, 212423L, 212437L, 212447L, 212453L, 212461L,
-212467L, 212479L, 212501L, 212507L, 212557L, 212561L, 212573L, 212579L, 212587L,
-212593L, 212627L, 212633L, 212651L, 212669L, 212671L, 212677L, 212683L, 212701L,
-212777L, 212791L, 212801L, 212827L, 212837L, 212843L, 212851L, 212867L, 212869L,
-212873L, 212881L, 212897L, 212903L, 212909L, 212917L, 212923L, 212969L, 212981L,
-212987L, 212999L, 213019L, 213023L, 213029L, 213043L, 213067L, 213079L, 213091L,
-213097L, 213119L, 213131L, 213133L, 213139L, 213149L, 213173L, 213181L, 213193L,
-213203L, 213209L, 213217L, 213223L, 213229L, 213247L, 213253L, 213263L, 213281L,
-213287L, 213289L, 213307L, 213319L, 213329L, 213337L, 213349L, 213359L, 213361L,
-213383L, 213391L, 213397L, 213407L, 213449L, 213461L, 213467L, 213481L, 213491L,
-213523L, 213533L, 213539L, 213553L, 213557L, 213589L, 213599L, 213611L, 213613L,
-213623L, 213637L, 213641L, 213649L, 213659L, 213713L, 213721L, 213727L, 213737L,
-213751L, 213791L, 213799L, 213821L, 213827L, 213833L, 213847L, 213859L, 213881L,
-213887L, 213901L, 213919L, 213929L, 213943L, 213947L, 213949L, 213953L, 213973L,
-213977L, 213989L, 214003L, 214007L, 214009L, 214021L, 214031L, 214033L, 214043L,
-214051L, 214063L, 214069L, 214087L, 214091L, 214129L, 214133L, 214141L, 214147L,
-214163L, 214177L, 214189L, 214211L, 214213L, 214219L, 214237L, 214243L, 214259L,
-214283L, 214297L, 214309L, 214351L, 214363L, 214373L, 214381L, 214391L, 214399L,
-214433L, 214439L, 214451L, 214457L, 214463L, 214469L, 214481L, 214483L, 214499L,
-214507L, 214517L, 214519L, 214531L, 214541L, 214559L, 214561L, 214589L, 214603L,
-214607L, 214631L, 214639L, 214651L, 214657L, 214663L, 214667L, 214673L, 214691L,
-214723L, 214729L, 214733L, 214741L, 214759L, 214763L, 214771L, 214783L, 214787L,
-214789L, 214807L, 214811L, 214817L, 214831L, 214849L, 214853L, 214867L, 214883L,
-214891L, 214913L, 214939L, 214943L, 214967L, 214987L, 214993L, 215051L, 215063L,
-215077L, 215087L, 215123L, 215141L, 215143L, 215153L, 215161L, 215179L, 215183L,
-215191L, 215197L, 215239L, 215249L, 215261L, 215273L, 215279L, 215297L, 215309L,
-215317L, 215329L, 215351L, 215353L, 215359L, 215381L, 215389L, 215393L, 215399L,
-215417L, 215443L, 215447L, 215459L, 215461L, 215471L, 215483L, 215497L, 215503L,
-215507L, 215521L, 215531L, 215563L, 215573L, 215587L, 215617L, 215653L, 215659L,
-215681L, 215687L, 215689L, 215693L, 215723L, 215737L, 215753L, 215767L, 215771L,
-215797L, 215801L, 215827L, 215833L, 215843L, 215851L, 215857L, 215863L, 215893L,
-215899L, 215909L, 215921L, 215927L, 215939L, 215953L, 215959L, 215981L, 215983L,
-216023L, 216037L, 216061L, 216071L, 216091L, 216103L, 216107L, 216113L, 216119L,
-216127L, 216133L, 216149L, 216157L, 216173L, 216179L, 216211L, 216217L, 216233L,
-216259L, 216263L, 216289L, 216317L, 216319L, 216329L, 216347L, 216371L, 216373L,
-216379L, 216397L, 216401L, 216421L, 216431L, 216451L, 216481L, 216493L, 216509L,
-216523L, 216551L, 216553L, 216569L, 216571L, 216577L, 216607L, 216617L, 216641L,
-216647L, 216649L, 216653L, 216661L, 216679L, 216703L, 216719L, 216731L, 216743L,
-216751L, 216757L, 216761L, 216779L, 216781L, 216787L, 216791L, 216803L, 216829L,
-216841L, 216851L, 216859L, 216877L, 216899L, 216901L, 216911L, 216917L, 216919L,
-216947L, 216967L, 216973L, 216991L, 217001L, 217003L, 217027L, 217033L, 217057L,
-217069L, 217081L, 217111L, 217117L, 217121L, 217157L, 217163L, 217169L, 217199L,
-217201L, 217207L, 217219L, 217223L, 217229L, 217241L, 217253L, 217271L, 217307L,
-217309L, 217313L, 217319L, 217333L, 217337L, 217339L, 217351L, 217361L, 217363L,
-217367L, 217369L, 217387L, 217397L, 217409L, 217411L, 217421L, 217429L, 217439L,
-217457L, 217463L, 217489L, 217499L, 217517L, 217519L, 217559L, 217561L, 217573L,
-217577L, 217579L, 217619L, 217643L, 217661L, 217667L, 217681L, 217687L, 217691L,
-217697L, 217717L, 217727L, 217733L, 217739L, 217747L, 217771L, 217781L, 217793L,
-217823L, 217829L, 217849L, 217859L, 217901L, 217907L, 217909L, 217933L, 217937L,
-217969L, 217979L, 217981L, 218003L, 218021L, 218047L, 218069L, 218077L, 218081L,
-218083L, 218087L, 218107L, 218111L, 218117L, 218131L, 218137L, 218143L, 218149L,
-218171L, 218191L, 218213L, 218227L, 218233L, 218249L, 218279L, 218287L, 218357L,
-218363L, 218371L, 218381L, 218389L, 218401L, 218417L, 218419L, 218423L, 218437L,
-218447L, 218453L, 218459L, 218461L, 218479L, 218509L, 218513L, 218521L, 218527L,
-218531L, 218549L, 218551L, 218579L, 218591L, 218599L, 218611L, 218623L, 218627L,
-218629L, 218641L, 218651L, 218657L, 218677L, 218681L, 218711L, 218717L, 218719L,
-218723L, 218737L, 218749L, 218761L, 218783L, 218797L, 218809L, 218819L, 218833L,
-218839L, 218843L, 218849L, 218857L, 218873L, 218887L, 218923L, 218941L, 218947L,
-218963L, 218969L, 218971L, 218987L, 218989L, 218993L, 219001L, 219017L, 219019L,
-219031L, 219041L, 219053L, 219059L, 219071L, 219083L, 219091L, 219097L, 219103L,
-219119L, 219133L, 219143L, 219169L, 219187L, 219217L, 219223L, 219251L, 219277L,
-219281L, 219293L, 219301L, 219311L, 219313L, 219353L, 219361L, 219371L, 219377L,
-219389L, 219407L, 219409L, 219433L, 219437L, 219451L, 219463L, 219467L, 219491L,
-219503L, 219517L, 219523L, 219529L, 219533L, 219547L, 219577L, 219587L, 219599L,
-219607L, 219613L, 219619L, 219629L, 219647L, 219649L, 219677L, 219679L, 219683L,
-219689L, 219707L, 219721L, 219727L, 219731L, 219749L, 219757L, 219761L, 219763L,
-219767L, 219787L, 219797L, 219799L, 219809L, 219823L, 219829L, 219839L, 219847L,
-219851L, 219871L, 219881L, 219889L, 219911L, 219917L, 219931L, 219937L, 219941L,
-219943L, 219953L, 219959L, 219971L, 219977L, 219979L, 219983L, 220009L, 220013L,
-220019L, 220021L, 220057L, 220063L, 220123L, 220141L, 220147L, 220151L, 220163L,
-220169L, 220177L, 220189L, 220217L, 220243L, 220279L, 220291L, 220301L, 220307L,
-220327L, 220333L, 220351L, 220357L, 220361L, 220369L, 220373L, 220391L, 220399L,
-220403L, 220411L, 220421L, 220447L, 220469L, 220471L, 220511L, 220513L, 220529L,
-220537L, 220543L, 220553L, 220559L, 220573L, 220579L, 220589L, 220613L, 220663L,
-220667L, 220673L, 220681L, 220687L, 220699L, 220709L, 220721L, 220747L, 220757L,
-220771L, 220783L, 220789L, 220793L, 220807L, 220811L, 220841L, 220859L, 220861L,
-220873L, 220877L, 220879L, 220889L, 220897L, 220901L, 220903L, 220907L, 220919L,
-220931L, 220933L, 220939L, 220973L, 221021L, 221047L, 221059L, 221069L, 221071L,
-221077L, 221083L, 221087L, 221093L, 221101L, 221159L, 221171L, 221173L, 221197L,
-221201L, 221203L, 221209L, 221219L, 221227L, 221233L, 221239L, 221251L, 221261L,
-221281L, 221303L, 221311L, 221317L, 221327L, 221393L, 221399L, 221401L, 221411L,
-221413L, 221447L, 221453L, 221461L, 221471L, 221477L, 221489L, 221497L, 221509L,
-221537L, 221539L, 221549L, 221567L, 221581L, 221587L, 221603L, 221621L, 221623L,
-221653L, 221657L, 221659L, 221671L, 221677L, 221707L, 221713L, 221717L, 221719L,
-221723L, 221729L, 221737L, 221747L, 221773L, 221797L, 221807L, 221813L, 221827L,
-221831L, 221849L, 221873L, 221891L, 221909L, 221941L, 221951L, 221953L, 221957L,
-221987L, 221989L, 221999L, 222007L, 222011L, 222023L, 222029L, 222041L, 222043L,
-222059L, 222067L, 222073L, 222107L, 222109L, 222113L, 222127L, 222137L, 222149L,
-222151L, 222161L, 222163L, 222193L, 222197L, 222199L, 222247L, 222269L, 222289L,
-222293L, 222311L, 222317L, 222323L, 222329L, 222337L, 222347L, 222349L, 222361L,
-222367L, 222379L, 222389L, 222403L, 222419L, 222437L, 222461L, 222493L, 222499L,
-222511L, 222527L, 222533L, 222553L, 222557L, 222587L, 222601L, 222613L, 222619L,
-222643L, 222647L, 222659L, 222679L, 222707L, 222713L, 222731L, 222773L, 222779L,
-222787L, 222791L, 222793L, 222799L, 222823L, 222839L, 222841L, 222857L, 222863L,
-222877L, 222883L, 222913L, 222919L, 222931L, 222941L, 222947L, 222953L, 222967L,
-222977L, 222979L, 222991L, 223007L, 223009L, 223019L, 223037L, 223049L, 223051L,
-223061L, 223063L, 223087L, 223099L, 223103L, 223129L, 223133L, 223151L, 223207L,
-223211L, 223217L, 223219L, 223229L, 223241L, 223243L, 223247L, 223253L, 223259L,
-223273L, 223277L, 223283L, 223291L, 223303L, 223313L, 223319L, 223331L, 223337L,
-223339L, 223361L, 223367L, 223381L, 223403L, 223423L, 223429L, 223439L, 223441L,
-223463L, 223469L, 223481L, 223493L, 223507L, 223529L, 223543L, 223547L, 223549L,
-223577L, 223589L, 223621L, 223633L, 223637L, 223667L, 223679L, 223681L, 223697L,
-223711L, 223747L, 223753L, 223757L, 223759L, 223781L, 223823L, 223829L, 223831L,
-223837L, 223841L, 223843L, 223849L, 223903L, 223919L, 223921L, 223939L, 223963L,
-223969L, 223999L, 224011L, 224027L, 224033L, 224041L, 224047L, 224057L, 224069L,
-224071L, 224101L, 224113L, 224129L, 224131L, 224149L, 224153L, 224171L, 224177L,
-224197L, 224201L, 224209L, 224221L, 224233L, 224239L, 224251L, 224261L, 224267L,
-224291L, 224299L, 224303L, 224309L, 224317L, 224327L, 224351L, 224359L, 224363L,
-224401L, 224423L, 224429L, 224443L, 224449L, 224461L, 224467L, 224473L, 224491L,
-224501L, 224513L, 224527L, 224563L, 224569L, 224579L, 224591L, 224603L, 224611L,
-224617L, 224629L, 224633L, 224669L, 224677L, 224683L, 224699L, 224711L, 224717L,
-224729L, 224737L, 224743L, 224759L, 224771L, 224797L, 224813L, 224831L, 224863L,
-224869L, 224881L, 224891L, 224897L, 224909L, 224911L, 224921L, 224929L, 224947L,
-224951L, 224969L, 224977L, 224993L, 225023L, 225037L, 225061L, 225067L, 225077L,
-225079L, 225089L, 225109L, 225119L, 225133L, 225143L, 225149L, 225157L, 225161L,
-225163L, 225167L, 225217L, 225221L, 225223L, 225227L, 225241L, 225257L, 225263L,
-225287L, 225289L, 225299L, 225307L, 225341L, 225343L, 225347L, 225349L, 225353L,
-225371L, 225373L, 225383L, 225427L, 225431L, 225457L, 225461L, 225479L, 225493L,
-225499L, 225503L, 225509L, 225523L, 225527L, 225529L, 225569L, 225581L, 225583L,
-225601L, 225611L, 225613L, 225619L, 225629L, 225637L, 225671L, 225683L, 225689L,
-225697L, 225721L, 225733L, 225749L, 225751L, 225767L, 225769L, 225779L, 225781L,
-225809L, 225821L, 225829L, 225839L, 225859L, 225871L, 225889L, 225919L, 225931L,
-225941L, 225943L, 225949L, 225961L, 225977L, 225983L, 225989L, 226001L, 226007L,
-226013L, 226027L, 226063L, 226087L, 226099L, 226103L, 226123L, 226129L, 226133L,
-226141L, 226169L, 226183L, 226189L, 226199L, 226201L, 226217L, 226231L, 226241L,
-226267L, 226283L, 226307L, 226313L, 226337L, 226357L, 226367L, 226379L, 226381L,
-226397L, 226409L, 226427L, 226433L, 226451L, 226453L, 226463L, 226483L, 226487L,
-226511L, 226531L, 226547L, 226549L, 226553L, 226571L, 226601L, 226609L, 226621L,
-226631L, 226637L, 226643L, 226649L, 226657L, 226663L, 226669L, 226691L, 226697L,
-226741L, 226753L, 226769L, 226777L, 226783L, 226789L, 226799L, 226813L, 226817L,
-226819L, 226823L, 226843L, 226871L, 226901L, 226903L, 226907L, 226913L, 226937L,
-226943L, 226991L, 227011L, 227027L, 227053L, 227081L, 227089L, 227093L, 227111L,
-227113L, 227131L, 227147L, 227153L, 227159L, 227167L, 227177L, 227189L, 227191L,
-227207L, 227219L, 227231L, 227233L, 227251L, 227257L, 227267L, 227281L, 227299L,
-227303L, 227363L, 227371L, 227377L, 227387L, 227393L, 227399L, 227407L, 227419L,
-227431L, 227453L, 227459L, 227467L, 227471L, 227473L, 227489L, 227497L, 227501L,
-227519L, 227531L, 227533L, 227537L, 227561L, 227567L, 227569L, 227581L, 227593L,
-227597L, 227603L, 227609L, 227611L, 227627L, 227629L, 227651L, 227653L, 227663L,
-227671L, 227693L, 227699L, 227707L, 227719L, 227729L, 227743L, 227789L, 227797L,
-227827L, 227849L, 227869L, 227873L, 227893L, 227947L, 227951L, 227977L, 227989L,
-227993L, 228013L, 228023L, 228049L, 228061L, 228077L, 228097L, 228103L, 228113L,
-228127L, 228131L, 228139L, 228181L, 228197L, 228199L, 228203L, 228211L, 228223L,
-228233L, 228251L, 228257L, 228281L, 228299L, 228301L, 228307L, 228311L, 228331L,
-228337L, 228341L, 228353L, 228359L, 228383L, 228409L, 228419L, 228421L, 228427L,
-228443L, 228451L, 228457L, 228461L, 228469L, 228479L, 228509L, 228511L, 228517L,
-228521L, 228523L, 228539L, 228559L, 228577L, 228581L, 228587L, 228593L, 228601L,
-228611L, 228617L, 228619L, 228637L, 228647L, 228677L, 228707L, 228713L, 228731L,
-228733L, 228737L, 228751L, 228757L, 228773L, 228793L, 228797L, 228799L, 228829L,
-228841L, 228847L, 228853L, 228859L, 228869L, 228881L, 228883L, 228887L, 228901L,
-228911L, 228913L, 228923L, 228929L, 228953L, 228959L, 228961L, 228983L, 228989L,
-229003L, 229027L, 229037L, 229081L, 229093L, 229123L, 229127L, 229133L, 229139L,
-229153L, 229157L, 229171L, 229181L, 229189L, 229199L, 229213L, 229217L, 229223L,
-229237L, 229247L, 229249L, 229253L, 229261L, 229267L, 229283L, 229309L, 229321L,
-229343L, 229351L, 229373L, 229393L, 229399L, 229403L, 229409L, 229423L, 229433L,
-229459L, 229469L, 229487L, 229499L, 229507L, 229519L, 229529L, 229547L, 229549L,
-229553L, 229561L, 229583L, 229589L, 229591L, 229601L, 229613L, 229627L, 229631L,
-229637L, 229639L, 229681L, 229693L, 229699L, 229703L, 229711L, 229717L, 229727L,
-229739L, 229751L, 229753L, 229759L, 229763L, 229769L, 229771L, 229777L, 229781L,
-229799L, 229813L, 229819L, 229837L, 229841L, 229847L, 229849L, 229897L, 229903L,
-229937L, 229939L, 229949L, 229961L, 229963L, 229979L, 229981L, 230003L, 230017L,
-230047L, 230059L, 230063L, 230077L, 230081L, 230089L, 230101L, 230107L, 230117L,
-230123L, 230137L, 230143L, 230149L, 230189L, 230203L, 230213L, 230221L, 230227L,
-230233L, 230239L, 230257L, 230273L, 230281L, 230291L, 230303L, 230309L, 230311L,
-230327L, 230339L, 230341L, 230353L, 230357L, 230369L, 230383L, 230387L, 230389L,
-230393L, 230431L, 230449L, 230453L, 230467L, 230471L, 230479L, 230501L, 230507L,
-230539L, 230551L, 230561L, 230563L, 230567L, 230597L, 230611L, 230647L, 230653L,
-230663L, 230683L, 230693L, 230719L, 230729L, 230743L, 230761L, 230767L, 230771L,
-230773L, 230779L, 230807L, 230819L, 230827L, 230833L, 230849L, 230861L, 230863L,
-230873L, 230891L, 230929L, 230933L, 230939L, 230941L, 230959L, 230969L, 230977L,
-230999L, 231001L, 231017L, 231019L, 231031L, 231041L, 231053L, 231067L, 231079L,
-231107L, 231109L, 231131L, 231169L, 231197L, 231223L, 231241L, 231269L, 231271L,
-231277L, 231289L, 231293L, 231299L, 231317L, 231323L, 231331L, 231347L, 231349L,
-231359L, 231367L, 231379L, 231409L, 231419L, 231431L, 231433L, 231443L, 231461L,
-231463L, 231479L, 231481L, 231493L, 231503L, 231529L, 231533L, 231547L, 231551L,
-231559L, 231563L, 231571L, 231589L, 231599L, 231607L, 231611L, 231613L, 231631L,
-231643L, 231661L, 231677L, 231701L, 231709L, 231719L, 231779L, 231799L, 231809L,
-231821L, 231823L, 231827L, 231839L, 231841L, 231859L, 231871L, 231877L, 231893L,
-231901L, 231919L, 231923L, 231943L, 231947L, 231961L, 231967L, 232003L, 232007L,
-232013L, 232049L, 232051L, 232073L, 232079L, 232081L, 232091L, 232103L, 232109L,
-232117L, 232129L, 232153L, 232171L, 232187L, 232189L, 232207L, 232217L, 232259L,
-232303L, 232307L, 232333L, 232357L, 232363L, 232367L, 232381L, 232391L, 232409L,
-232411L, 232417L, 232433L, 232439L, 232451L, 232457L, 232459L, 232487L, 232499L,
-232513L, 232523L, 232549L, 232567L, 232571L, 232591L, 232597L, 232607L, 232621L,
-232633L, 232643L, 232663L, 232669L, 232681L, 232699L, 232709L, 232711L, 232741L,
-232751L, 232753L, 232777L, 232801L, 232811L, 232819L, 232823L, 232847L, 232853L,
-232861L, 232871L, 232877L, 232891L, 232901L, 232907L, 232919L, 232937L, 232961L,
-232963L, 232987L, 233021L, 233069L, 233071L, 233083L, 233113L, 233117L, 233141L,
-233143L, 233159L, 233161L, 233173L, 233183L, 233201L, 233221L, 233231L, 233239L,
-233251L, 233267L, 233279L, 233293L, 233297L, 233323L, 233327L, 233329L, 233341L,
-233347L, 233353L, 233357L, 233371L, 233407L, 233417L, 233419L, 233423L, 233437L,
-233477L, 233489L, 233509L, 233549L, 233551L, 233557L, 233591L, 233599L, 233609L,
-233617L, 233621L, 233641L, 233663L, 233669L, 233683L, 233687L, 233689L, 233693L,
-233713L, 233743L, 233747L, 233759L, 233777L, 233837L, 233851L, 233861L, 233879L,
-233881L, 233911L, 233917L, 233921L, 233923L, 233939L, 233941L, 233969L, 233983L,
-233993L, 234007L, 234029L, 234043L, 234067L, 234083L, 234089L, 234103L, 234121L,
-234131L, 234139L, 234149L, 234161L, 234167L, 234181L, 234187L, 234191L, 234193L,
-234197L, 234203L, 234211L, 234217L, 234239L, 234259L, 234271L, 234281L, 234287L,
-234293L, 234317L, 234319L, 234323L, 234331L, 234341L, 234343L, 234361L, 234383L,
-234431L, 234457L, 234461L, 234463L, 234467L, 234473L, 234499L, 234511L, 234527L,
-234529L, 234539L, 234541L, 234547L, 234571L, 234587L, 234589L, 234599L, 234613L,
-234629L, 234653L, 234659L, 234673L, 234683L, 234713L, 234721L, 234727L, 234733L,
-234743L, 234749L, 234769L, 234781L, 234791L, 234799L, 234803L, 234809L, 234811L,
-234833L, 234847L, 234851L, 234863L, 234869L, 234893L, 234907L, 234917L, 234931L,
-234947L, 234959L, 234961L, 234967L, 234977L, 234979L, 234989L, 235003L, 235007L,
-235009L, 235013L, 235043L, 235051L, 235057L, 235069L, 235091L, 235099L, 235111L,
-235117L, 235159L, 235171L, 235177L, 235181L, 235199L, 235211L, 235231L, 235241L,
-235243L, 235273L, 235289L, 235307L, 235309L, 235337L, 235349L, 235369L, 235397L,
-235439L, 235441L, 235447L, 235483L, 235489L, 235493L, 235513L, 235519L, 235523L,
-235537L, 235541L, 235553L, 235559L, 235577L, 235591L, 235601L, 235607L, 235621L,
-235661L, 235663L, 235673L, 235679L, 235699L, 235723L, 235747L, 235751L, 235783L,
-235787L, 235789L, 235793L, 235811L, 235813L, 235849L, 235871L, 235877L, 235889L,
-235891L, 235901L, 235919L, 235927L, 235951L, 235967L, 235979L, 235997L, 236017L,
-236021L, 236053L, 236063L, 236069L, 236077L, 236087L, 236107L, 236111L, 236129L,
-236143L, 236153L, 236167L, 236207L, 236209L, 236219L, 236231L, 236261L, 236287L,
-236293L, 236297L, 236323L, 236329L, 236333L, 236339L, 236377L, 236381L, 236387L,
-236399L, 236407L, 236429L, 236449L, 236461L, 236471L, 236477L, 236479L, 236503L,
-236507L, 236519L, 236527L, 236549L, 236563L, 236573L, 236609L, 236627L, 236641L,
-236653L, 236659L, 236681L, 236699L, 236701L, 236707L, 236713L, 236723L, 236729L,
-236737L, 236749L, 236771L, 236773L, 236779L, 236783L, 236807L, 236813L, 236867L,
-236869L, 236879L, 236881L, 236891L, 236893L, 236897L, 236909L, 236917L, 236947L,
-236981L, 236983L, 236993L, 237011L, 237019L, 237043L, 237053L, 237067L, 237071L,
-237073L, 237089L, 237091L, 237137L, 237143L, 237151L, 237157L, 237161L, 237163L,
-237173L, 237179L, 237203L, 237217L, 237233L, 237257L, 237271L, 237277L, 237283L,
-237287L, 237301L, 237313L, 237319L, 237331L, 237343L, 237361L, 237373L, 237379L,
-237401L, 237409L, 237467L, 237487L, 237509L, 237547L, 237563L, 237571L, 237581L,
-237607L, 237619L, 237631L, 237673L, 237683L, 237689L, 237691L, 237701L, 237707L,
-237733L, 237737L, 237749L, 237763L, 237767L, 237781L, 237791L, 237821L, 237851L,
-237857L, 237859L, 237877L, 237883L, 237901L, 237911L, 237929L, 237959L, 237967L,
-237971L, 237973L, 237977L, 237997L, 238001L, 238009L, 238019L, 238031L, 238037L,
-238039L, 238079L, 238081L, 238093L, 238099L, 238103L, 238109L, 238141L, 238151L,
-238157L, 238159L, 238163L, 238171L, 238181L, 238201L, 238207L, 238213L, 238223L,
-238229L, 238237L, 238247L, 238261L, 238267L, 238291L, 238307L, 238313L, 238321L,
-238331L, 238339L, 238361L, 238363L, 238369L, 238373L, 238397L, 238417L, 238423L,
-238439L, 238451L, 238463L, 238471L, 238477L, 238481L, 238499L, 238519L, 238529L,
-238531L, 238547L, 238573L, 238591L, 238627L, 238639L, 238649L, 238657L, 238673L,
-238681L, 238691L, 238703L, 238709L, 238723L, 238727L, 238729L, 238747L, 238759L,
-238781L, 238789L, 238801L, 238829L, 238837L, 238841L, 238853L, 238859L, 238877L,
-238879L, 238883L, 238897L, 238919L, 238921L, 238939L, 238943L, 238949L, 238967L,
-238991L, 239017L, 239023L, 239027L, 239053L, 239069L, 239081L, 239087L, 239119L,
-239137L, 239147L, 239167L, 239171L, 239179L, 239201L, 239231L, 239233L, 239237L,
-239243L, 239251L, 239263L, 239273L, 239287L, 239297L, 239329L, 239333L, 239347L,
-239357L, 239383L, 239387L, 239389L, 239417L, 239423L, 239429L, 239431L, 239441L,
-239461L, 239489L, 239509L, 239521L, 239527L, 239531L, 239539L, 239543L, 239557L,
-239567L, 239579L, 239587L, 239597L, 239611L, 239623L, 239633L, 239641L, 239671L,
-239689L, 239699L, 239711L, 239713L, 239731L, 239737L, 239753L, 239779L, 239783L,
-239803L, 239807L, 239831L, 239843L, 239849L, 239851L, 239857L, 239873L, 239879L,
-239893L, 239929L, 239933L, 239947L, 239957L, 239963L, 239977L, 239999L, 240007L,
-240011L, 240017L, 240041L, 240043L, 240047L, 240049L, 240059L, 240073L, 240089L,
-240101L, 240109L, 240113L, 240131L, 240139L, 240151L, 240169L, 240173L, 240197L,
-240203L, 240209L, 240257L, 240259L, 240263L, 240271L, 240283L, 240287L, 240319L,
-240341L, 240347L, 240349L, 240353L, 240371L, 240379L, 240421L, 240433L, 240437L,
-240473L, 240479L, 240491L, 240503L, 240509L, 240517L, 240551L, 240571L, 240587L,
-240589L, 240599L, 240607L, 240623L, 240631L, 240641L, 240659L, 240677L, 240701L,
-240707L, 240719L, 240727L, 240733L, 240739L, 240743L, 240763L, 240769L, 240797L,
-240811L, 240829L, 240841L, 240853L, 240859L, 240869L, 240881L, 240883L, 240893L,
-240899L, 240913L, 240943L, 240953L, 240959L, 240967L, 240997L, 241013L, 241027L,
-241037L, 241049L, 241051L, 241061L, 241067L, 241069L, 241079L, 241093L, 241117L,
-241127L, 241141L, 241169L, 241177L, 241183L, 241207L, 241229L, 241249L, 241253L,
-241259L, 241261L, 241271L, 241291L, 241303L, 241313L, 241321L, 241327L, 241333L,
-241337L, 241343L, 241361L, 241363L, 241391L, 241393L, 241421L, 241429L, 241441L,
-241453L, 241463L, 241469L, 241489L, 241511L, 241513L, 241517L, 241537L, 241543L,
-241559L, 241561L, 241567L, 241589L, 241597L, 241601L, 241603L, 241639L, 241643L,
-241651L, 241663L, 241667L, 241679L, 241687L, 241691L, 241711L, 241727L, 241739L,
-241771L, 241781L, 241783L, 241793L, 241807L, 241811L, 241817L, 241823L, 241847L,
-241861L, 241867L, 241873L, 241877L, 241883L, 241903L, 241907L, 241919L, 241921L,
-241931L, 241939L, 241951L, 241963L, 241973L, 241979L, 241981L, 241993L, 242009L,
-242057L, 242059L, 242069L, 242083L, 242093L, 242101L, 242119L, 242129L, 242147L,
-242161L, 242171L, 242173L, 242197L, 242201L, 242227L, 242243L, 242257L, 242261L,
-242273L, 242279L, 242309L, 242329L, 242357L, 242371L, 242377L, 242393L, 242399L,
-242413L, 242419L, 242441L, 242447L, 242449L, 242453L, 242467L, 242479L, 242483L,
-242491L, 242509L, 242519L, 242521L, 242533L, 242551L, 242591L, 242603L, 242617L,
-242621L, 242629L, 242633L, 242639L, 242647L, 242659L, 242677L, 242681L, 242689L,
-242713L, 242729L, 242731L, 242747L, 242773L, 242779L, 242789L, 242797L, 242807L,
-242813L, 242819L, 242863L, 242867L, 242873L, 242887L, 242911L, 242923L, 242927L,
-242971L, 242989L, 242999L, 243011L, 243031L, 243073L, 243077L, 243091L, 243101L,
-243109L, 243119L, 243121L, 243137L, 243149L, 243157L, 243161L, 243167L, 243197L,
-243203L, 243209L, 243227L, 243233L, 243239L, 243259L, 243263L, 243301L, 243311L,
-243343L, 243367L, 243391L, 243401L, 243403L, 243421L, 243431L, 243433L, 243437L,
-243461L, 243469L, 243473L, 243479L, 243487L, 243517L, 243521L, 243527L, 243533L,
-243539L, 243553L, 243577L, 243583L, 243587L, 243589L, 243613L, 243623L, 243631L,
-243643L, 243647L, 243671L, 243673L, 243701L, 243703L, 243707L, 243709L, 243769L,
-243781L, 243787L, 243799L, 243809L, 243829L, 243839L, 243851L, 243857L, 243863L,
-243871L, 243889L, 243911L, 243917L, 243931L, 243953L, 243973L, 243989L, 244003L,
-244009L, 244021L, 244033L, 244043L, 244087L, 244091L, 244109L, 244121L, 244129L,
-244141L, 244147L, 244157L, 244159L, 244177L, 244199L, 244217L, 244219L, 244243L,
-244247L, 244253L, 244261L, 244291L, 244297L, 244301L, 244303L, 244313L, 244333L,
-244339L, 244351L, 244357L, 244367L, 244379L, 244381L, 244393L, 244399L, 244403L,
-244411L, 244423L, 244429L, 244451L, 244457L, 244463L, 244471L, 244481L, 244493L,
-244507L, 244529L, 244547L, 244553L, 244561L, 244567L, 244583L, 244589L, 244597L,
-244603L, 244619L, 244633L, 244637L, 244639L, 244667L, 244669L, 244687L, 244691L,
-244703L, 244711L, 244721L, 244733L, 244747L, 244753L, 244759L, 244781L, 244787L,
-244813L, 244837L, 244841L, 244843L, 244859L, 244861L, 244873L, 244877L, 244889L,
-244897L, 244901L, 244939L, 244943L, 244957L, 244997L, 245023L, 245029L, 245033L,
-245039L, 245071L, 245083L, 245087L, 245107L, 245129L, 245131L, 245149L, 245171L,
-245173L, 245177L, 245183L, 245209L, 245251L, 245257L, 245261L, 245269L, 245279L,
-245291L, 245299L, 245317L, 245321L, 245339L, 245383L, 245389L, 245407L, 245411L,
-245417L, 245419L, 245437L, 245471L, 245473L, 245477L, 245501L, 245513L, 245519L,
-245521L, 245527L, 245533L, 245561L, 245563L, 245587L, 245591L, 245593L, 245621L,
-245627L, 245629L, 245639L, 245653L, 245671L, 245681L, 245683L, 245711L, 245719L,
-245723L, 245741L, 245747L, 245753L, 245759L, 245771L, 245783L, 245789L, 245821L,
-245849L, 245851L, 245863L, 245881L, 245897L, 245899L, 245909L, 245911L, 245941L,
-245963L, 245977L, 245981L, 245983L, 245989L, 246011L, 246017L, 246049L, 246073L,
-246097L, 246119L, 246121L, 246131L, 246133L, 246151L, 246167L, 246173L, 246187L,
-246193L, 246203L, 246209L, 246217L, 246223L, 246241L, 246247L, 246251L, 246271L,
-246277L, 246289L, 246317L, 246319L, 246329L, 246343L, 246349L, 246361L, 246371L,
-246391L, 246403L, 246439L, 246469L, 246473L, 246497L, 246509L, 246511L, 246523L,
-246527L, 246539L, 246557L, 246569L, 246577L, 246599L, 246607L, 246611L, 246613L,
-246637L, 246641L, 246643L, 246661L, 246683L, 246689L, 246707L, 246709L, 246713L,
-246731L, 246739L, 246769L, 246773L, 246781L, 246787L, 246793L, 246803L, 246809L,
-246811L, 246817L, 246833L, 246839L, 246889L, 246899L, 246907L, 246913L, 246919L,
-246923L, 246929L, 246931L, 246937L, 246941L, 246947L, 246971L, 246979L, 247001L,
-247007L, 247031L, 247067L, 247069L, 247073L, 247087L, 247099L, 247141L, 247183L,
-247193L, 247201L, 247223L, 247229L, 247241L, 247249L, 247259L, 247279L, 247301L,
-247309L, 247337L, 247339L, 247343L, 247363L, 247369L, 247381L, 247391L, 247393L,
-247409L, 247421L, 247433L, 247439L, 247451L, 247463L, 247501L, 247519L, 247529L,
-247531L, 247547L, 247553L, 247579L, 247591L, 247601L, 247603L, 247607L, 247609L,
-247613L, 247633L, 247649L, 247651L, 247691L, 247693L, 247697L, 247711L, 247717L,
-247729L, 247739L, 247759L, 247769L, 247771L, 247781L, 247799L, 247811L, 247813L,
-247829L, 247847L, 247853L, 247873L, 247879L, 247889L, 247901L, 247913L, 247939L,
-247943L, 247957L, 247991L, 247993L, 247997L, 247999L, 248021L, 248033L, 248041L,
-248051L, 248057L, 248063L, 248071L, 248077L, 248089L, 248099L, 248117L, 248119L,
-248137L, 248141L, 248161L, 248167L, 248177L, 248179L, 248189L, 248201L, 248203L,
-248231L, 248243L, 248257L, 248267L, 248291L, 248293L, 248299L, 248309L, 248317L,
-248323L, 248351L, 248357L, 248371L, 248389L, 248401L, 248407L, 248431L, 248441L,
-248447L, 248461L, 248473L, 248477L, 248483L, 248509L, 248533L, 248537L, 248543L,
-248569L, 248579L, 248587L, 248593L, 248597L, 248609L, 248621L, 248627L, 248639L,
-248641L, 248657L, 248683L, 248701L, 248707L, 248719L, 248723L, 248737L, 248749L,
-248753L, 248779L, 248783L, 248789L, 248797L, 248813L, 248821L, 248827L, 248839L,
-248851L, 248861L, 248867L, 248869L, 248879L, 248887L, 248891L, 248893L, 248903L,
-248909L, 248971L, 248981L, 248987L, 249017L, 249037L, 249059L, 249079L, 249089L,
-249097L, 249103L, 249107L, 249127L, 249131L, 249133L, 249143L, 249181L, 249187L,
-249199L, 249211L, 249217L, 249229L, 249233L, 249253L, 249257L, 249287L, 249311L,
-249317L, 249329L, 249341L, 249367L, 249377L, 249383L, 249397L, 249419L, 249421L,
-249427L, 249433L, 249437L, 249439L, 249449L, 249463L, 249497L, 249499L, 249503L,
-249517L, 249521L, 249533L, 249539L, 249541L, 249563L, 249583L, 249589L, 249593L,
-249607L, 249647L, 249659L, 249671L, 249677L, 249703L, 249721L, 249727L, 249737L,
-249749L, 249763L, 249779L, 249797L, 249811L, 249827L, 249833L, 249853L, 249857L,
-249859L, 249863L, 249871L, 249881L, 249911L, 249923L, 249943L, 249947L, 249967L,
-249971L, 249973L, 249989L, 250007L, 250013L, 250027L, 250031L, 250037L, 250043L,
-250049L, 250051L, 250057L, 250073L, 250091L, 250109L, 250123L, 250147L, 250153L,
-250169L, 250199L, 250253L, 250259L, 250267L, 250279L, 250301L, 250307L, 250343L,
-250361L, 250403L, 250409L, 250423L, 250433L, 250441L, 250451L, 250489L, 250499L,
-250501L, 250543L, 250583L, 250619L, 250643L, 250673L, 250681L, 250687L, 250693L,
-250703L, 250709L, 250721L, 250727L, 250739L, 250741L, 250751L, 250753L, 250777L,
-250787L, 250793L, 250799L, 250807L, 250813L, 250829L, 250837L, 250841L, 250853L,
-250867L, 250871L, 250889L, 250919L, 250949L, 250951L, 250963L, 250967L, 250969L,
-250979L, 250993L, 251003L, 251033L, 251051L, 251057L, 251059L, 251063L, 251071L,
-251081L, 251087L, 251099L, 251117L, 251143L, 251149L, 251159L, 251171L, 251177L,
-251179L, 251191L, 251197L, 251201L, 251203L, 251219L, 251221L, 251231L, 251233L,
-251257L, 251261L, 251263L, 251287L, 251291L, 251297L, 251323L, 251347L, 251353L,
-251359L, 251387L, 251393L, 251417L, 251429L, 251431L, 251437L, 251443L, 251467L,
-251473L, 251477L, 251483L, 251491L, 251501L, 251513L, 251519L, 251527L, 251533L,
-251539L, 251543L, 251561L, 251567L, 251609L, 251611L, 251621L, 251623L, 251639L,
-251653L, 251663L, 251677L, 251701L, 251707L, 251737L, 251761L, 251789L, 251791L,
-251809L, 251831L, 251833L, 251843L, 251857L, 251861L, 251879L, 251887L, 251893L,
-251897L, 251903L, 251917L, 251939L, 251941L, 251947L, 251969L, 251971L, 251983L,
-252001L, 252013L, 252017L, 252029L, 252037L, 252079L, 252101L, 252139L, 252143L,
-252151L, 252157L, 252163L, 252169L, 252173L, 252181L, 252193L, 252209L, 252223L,
-252233L, 252253L, 252277L, 252283L, 252289L, 252293L, 252313L, 252319L, 252323L,
-252341L, 252359L, 252383L, 252391L, 252401L, 252409L, 252419L, 252431L, 252443L,
-252449L, 252457L, 252463L, 252481L, 252509L, 252533L, 252541L, 252559L, 252583L,
-252589L, 252607L, 252611L, 252617L, 252641L, 252667L, 252691L, 252709L, 252713L,
-252727L, 252731L, 252737L, 252761L, 252767L, 252779L, 252817L, 252823L, 252827L,
-252829L, 252869L, 252877L, 252881L, 252887L, 252893L, 252899L, 252911L, 252913L,
-252919L, 252937L, 252949L, 252971L, 252979L, 252983L, 253003L, 253013L, 253049L,
-253063L, 253081L, 253103L, 253109L, 253133L, 253153L, 253157L, 253159L, 253229L,
-253243L, 253247L, 253273L, 253307L, 253321L, 253343L, 253349L, 253361L, 253367L,
-253369L, 253381L, 253387L, 253417L, 253423L, 253427L, 253433L, 253439L, 253447L,
-253469L, 253481L, 253493L, 253501L, 253507L, 253531L, 253537L, 253543L, 253553L,
-253567L, 253573L, 253601L, 253607L, 253609L, 253613L, 253633L, 253637L, 253639L,
-253651L, 253661L, 253679L, 253681L, 253703L, 253717L, 253733L, 253741L, 253751L,
-253763L, 253769L, 253777L, 253787L, 253789L, 253801L, 253811L, 253819L, 253823L,
-253853L, 253867L, 253871L, 253879L, 253901L, 253907L, 253909L, 253919L, 253937L,
-253949L, 253951L, 253969L, 253987L, 253993L, 253999L, 254003L, 254021L, 254027L,
-254039L, 254041L, 254047L, 254053L, 254071L, 254083L, 254119L, 254141L, 254147L,
-254161L, 254179L, 254197L, 254207L, 254209L, 254213L, 254249L, 254257L, 254279L,
-254281L, 254291L, 254299L, 254329L, 254369L, 254377L, 254383L, 254389L, 254407L,
-254413L, 254437L, 254447L, 254461L, 254489L, 254491L, 254519L, 254537L, 254557L,
-254593L, 254623L, 254627L, 254647L, 254659L, 254663L, 254699L, 254713L, 254729L,
-254731L, 254741L, 254747L, 254753L, 254773L, 254777L, 254783L, 254791L, 254803L,
-254827L, 254831L, 254833L, 254857L, 254869L, 254873L, 254879L, 254887L, 254899L,
-254911L, 254927L, 254929L, 254941L, 254959L, 254963L, 254971L, 254977L, 254987L,
-254993L, 255007L, 255019L, 255023L, 255043L, 255049L, 255053L, 255071L, 255077L,
-255083L, 255097L, 255107L, 255121L, 255127L, 255133L, 255137L, 255149L, 255173L,
-255179L, 255181L, 255191L, 255193L, 255197L, 255209L, 255217L, 255239L, 255247L,
-255251L, 255253L, 255259L, 255313L, 255329L, 255349L, 255361L, 255371L, 255383L,
-255413L, 255419L, 255443L, 255457L, 255467L, 255469L, 255473L, 255487L, 255499L,
-255503L, 255511L, 255517L, 255523L, 255551L, 255571L, 255587L, 255589L, 255613L,
-255617L, 255637L, 255641L, 255649L, 255653L, 255659L, 255667L, 255679L, 255709L,
-255713L, 255733L, 255743L, 255757L, 255763L, 255767L, 255803L, 255839L, 255841L,
-255847L, 255851L, 255859L, 255869L, 255877L, 255887L, 255907L, 255917L, 255919L,
-255923L, 255947L, 255961L, 255971L, 255973L, 255977L, 255989L, 256019L, 256021L,
-256031L, 256033L, 256049L, 256057L, 256079L, 256093L, 256117L, 256121L, 256129L,
-256133L, 256147L, 256163L, 256169L, 256181L, 256187L, 256189L, 256199L, 256211L,
-256219L, 256279L, 256301L, 256307L, 256313L, 256337L, 256349L, 256363L, 256369L,
-256391L, 256393L, 256423L, 256441L, 256469L, 256471L, 256483L, 256489L, 256493L,
-256499L, 256517L, 256541L, 256561L, 256567L, 256577L, 256579L, 256589L, 256603L,
-256609L, 256639L, 256643L, 256651L, 256661L, 256687L, 256699L, 256721L, 256723L,
-256757L, 256771L, 256799L, 256801L, 256813L, 256831L, 256873L, 256877L, 256889L,
-256901L, 256903L, 256931L, 256939L, 256957L, 256967L, 256981L, 257003L, 257017L,
-257053L, 257069L, 257077L, 257093L, 257099L, 257107L, 257123L, 257141L, 257161L,
-257171L, 257177L, 257189L, 257219L, 257221L, 257239L, 257249L, 257263L, 257273L,
-257281L, 257287L, 257293L, 257297L, 257311L, 257321L, 257339L, 257351L, 257353L,
-257371L, 257381L, 257399L, 257401L, 257407L, 257437L, 257443L, 257447L, 257459L,
-257473L, 257489L, 257497L, 257501L, 257503L, 257519L, 257539L, 257561L, 257591L,
-257611L, 257627L, 257639L, 257657L, 257671L, 257687L, 257689L, 257707L, 257711L,
-257713L, 257717L, 257731L, 257783L, 257791L, 257797L, 257837L, 257857L, 257861L,
-257863L, 257867L, 257869L, 257879L, 257893L, 257903L, 257921L, 257947L, 257953L,
-257981L, 257987L, 257989L, 257993L, 258019L, 258023L, 258031L, 258061L, 258067L,
-258101L, 258107L, 258109L, 258113L, 258119L, 258127L, 258131L, 258143L, 258157L,
-258161L, 258173L, 258197L, 258211L, 258233L, 258241L, 258253L, 258277L, 258283L,
-258299L, 258317L, 258319L, 258329L, 258331L, 258337L, 258353L, 258373L, 258389L,
-258403L, 258407L, 258413L, 258421L, 258437L, 258443L, 258449L, 258469L, 258487L,
-258491L, 258499L, 258521L, 258527L, 258539L, 258551L, 258563L, 258569L, 258581L,
-258607L, 258611L, 258613L, 258617L, 258623L, 258631L, 258637L, 258659L, 258673L,
-258677L, 258691L, 258697L, 258703L, 258707L, 258721L, 258733L, 258737L, 258743L,
-258763L, 258779L, 258787L, 258803L, 258809L, 258827L, 258847L, 258871L, 258887L,
-258917L, 258919L, 258949L, 258959L, 258967L, 258971L, 258977L, 258983L, 258991L,
-259001L, 259009L, 259019L, 259033L, 259099L, 259121L, 259123L, 259151L, 259157L,
-259159L, 259163L, 259169L, 259177L, 259183L, 259201L, 259211L, 259213L, 259219L,
-259229L, 259271L, 259277L, 259309L, 259321L, 259339L, 259379L, 259381L, 259387L,
-259397L, 259411L, 259421L, 259429L, 259451L, 259453L, 259459L, 259499L, 259507L,
-259517L, 259531L, 259537L, 259547L, 259577L, 259583L, 259603L, 259619L, 259621L,
-259627L, 259631L, 259639L, 259643L, 259657L, 259667L, 259681L, 259691L, 259697L,
-259717L, 259723L, 259733L, 259751L, 259771L, 259781L, 259783L, 259801L, 259813L,
-259823L, 259829L, 259837L, 259841L, 259867L, 259907L, 259933L, 259937L, 259943L,
-259949L, 259967L, 259991L, 259993L, 260003L, 260009L, 260011L, 260017L, 260023L,
-260047L, 260081L, 260089L, 260111L, 260137L, 260171L, 260179L, 260189L, 260191L,
-260201L, 260207L, 260209L, 260213L, 260231L, 260263L, 260269L, 260317L, 260329L,
-260339L, 260363L, 260387L, 260399L, 260411L, 260413L, 260417L, 260419L, 260441L,
-260453L, 260461L, 260467L, 260483L, 260489L, 260527L, 260539L, 260543L, 260549L,
-260551L, 260569L, 260573L, 260581L, 260587L, 260609L, 260629L, 260647L, 260651L,
-260671L, 260677L, 260713L, 260717L, 260723L, 260747L, 260753L, 260761L, 260773L,
-260791L, 260807L, 260809L, 260849L, 260857L, 260861L, 260863L, 260873L, 260879L,
-260893L, 260921L, 260941L, 260951L, 260959L, 260969L, 260983L, 260987L, 260999L,
-261011L, 261013L, 261017L, 261031L, 261043L, 261059L, 261061L, 261071L, 261077L,
-261089L, 261101L, 261127L, 261167L, 261169L, 261223L, 261229L, 261241L, 261251L,
-261271L, 261281L, 261301L, 261323L, 261329L, 261337L, 261347L, 261353L, 261379L,
-261389L, 261407L, 261427L, 261431L, 261433L, 261439L, 261451L, 261463L, 261467L,
-261509L, 261523L, 261529L, 261557L, 261563L, 261577L, 261581L, 261587L, 261593L,
-261601L, 261619L, 261631L, 261637L, 261641L, 261643L, 261673L, 261697L, 261707L,
-261713L, 261721L, 261739L, 261757L, 261761L, 261773L, 261787L, 261791L, 261799L,
-261823L, 261847L, 261881L, 261887L, 261917L, 261959L, 261971L, 261973L, 261977L,
-261983L, 262007L, 262027L, 262049L, 262051L, 262069L, 262079L, 262103L, 262109L,
-262111L, 262121L, 262127L, 262133L, 262139L, 262147L, 262151L, 262153L, 262187L,
-262193L, 262217L, 262231L, 262237L, 262253L, 262261L, 262271L, 262303L, 262313L,
-262321L, 262331L, 262337L, 262349L, 262351L, 262369L, 262387L, 262391L, 262399L,
-262411L, 262433L, 262459L, 262469L, 262489L, 262501L, 262511L, 262513L, 262519L,
-262541L, 262543L, 262553L, 262567L, 262583L, 262597L, 262621L, 262627L, 262643L,
-262649L, 262651L, 262657L, 262681L, 262693L, 262697L, 262709L, 262723L, 262733L,
-262739L, 262741L, 262747L, 262781L, 262783L, 262807L, 262819L, 262853L, 262877L,
-262883L, 262897L, 262901L, 262909L, 262937L, 262949L, 262957L, 262981L, 263009L,
-263023L, 263047L, 263063L, 263071L, 263077L, 263083L, 263089L, 263101L, 263111L,
-263119L, 263129L, 263167L, 263171L, 263183L, 263191L, 263201L, 263209L, 263213L,
-263227L, 263239L, 263257L, 263267L, 263269L, 263273L, 263287L, 263293L, 263303L,
-263323L, 263369L, 263383L, 263387L, 263399L, 263401L, 263411L, 263423L, 263429L,
-263437L, 263443L, 263489L, 263491L, 263503L, 263513L, 263519L, 263521L, 263533L,
-263537L, 263561L, 263567L, 263573L, 263591L, 263597L, 263609L, 263611L, 263621L,
-263647L, 263651L, 263657L, 263677L, 263723L, 263729L, 263737L, 263759L, 263761L,
-263803L, 263819L, 263821L, 263827L, 263843L, 263849L, 263863L, 263867L, 263869L,
-263881L, 263899L, 263909L, 263911L, 263927L, 263933L, 263941L, 263951L, 263953L,
-263957L, 263983L, 264007L, 264013L, 264029L, 264031L, 264053L, 264059L, 264071L,
-264083L, 264091L, 264101L, 264113L, 264127L, 264133L, 264137L, 264139L, 264167L,
-264169L, 264179L, 264211L, 264221L, 264263L, 264269L, 264283L, 264289L, 264301L,
-264323L, 264331L, 264343L, 264349L, 264353L, 264359L, 264371L, 264391L, 264403L,
-264437L, 264443L, 264463L, 264487L, 264527L, 264529L, 264553L, 264559L, 264577L,
-264581L, 264599L, 264601L, 264619L, 264631L, 264637L, 264643L, 264659L, 264697L,
-264731L, 264739L, 264743L, 264749L, 264757L, 264763L, 264769L, 264779L, 264787L,
-264791L, 264793L, 264811L, 264827L, 264829L, 264839L, 264871L, 264881L, 264889L,
-264893L, 264899L, 264919L, 264931L, 264949L, 264959L, 264961L, 264977L, 264991L,
-264997L, 265003L, 265007L, 265021L, 265037L, 265079L, 265091L, 265093L, 265117L,
-265123L, 265129L, 265141L, 265151L, 265157L, 265163L, 265169L, 265193L, 265207L,
-265231L, 265241L, 265247L, 265249L, 265261L, 265271L, 265273L, 265277L, 265313L,
-265333L, 265337L, 265339L, 265381L, 265399L, 265403L, 265417L, 265423L, 265427L,
-265451L, 265459L, 265471L, 265483L, 265493L, 265511L, 265513L, 265541L, 265543L,
-265547L, 265561L, 265567L, 265571L, 265579L, 265607L, 265613L, 265619L, 265621L,
-265703L, 265709L, 265711L, 265717L, 265729L, 265739L, 265747L, 265757L, 265781L,
-265787L, 265807L, 265813L, 265819L, 265831L, 265841L, 265847L, 265861L, 265871L,
-265873L, 265883L, 265891L, 265921L, 265957L, 265961L, 265987L, 266003L, 266009L,
-266023L, 266027L, 266029L, 266047L, 266051L, 266053L, 266059L, 266081L, 266083L,
-266089L, 266093L, 266099L, 266111L, 266117L, 266129L, 266137L, 266153L, 266159L,
-266177L, 266183L, 266221L, 266239L, 266261L, 266269L, 266281L, 266291L, 266293L,
-266297L, 266333L, 266351L, 266353L, 266359L, 266369L, 266381L, 266401L, 266411L,
-266417L, 266447L, 266449L, 266477L, 266479L, 266489L, 266491L, 266521L, 266549L,
-266587L, 266599L, 266603L, 266633L, 266641L, 266647L, 266663L, 266671L, 266677L,
-266681L, 266683L, 266687L, 266689L, 266701L, 266711L, 266719L, 266759L, 266767L,
-266797L, 266801L, 266821L, 266837L, 266839L, 266863L, 266867L, 266891L, 266897L,
-266899L, 266909L, 266921L, 266927L, 266933L, 266947L, 266953L, 266957L, 266971L,
-266977L, 266983L, 266993L, 266999L, 267017L, 267037L, 267049L, 267097L, 267131L,
-267133L, 267139L, 267143L, 267167L, 267187L, 267193L, 267199L, 267203L, 267217L,
-267227L, 267229L, 267233L, 267259L, 267271L, 267277L, 267299L, 267301L, 267307L,
-267317L, 267341L, 267353L, 267373L, 267389L, 267391L, 267401L, 267403L, 267413L,
-267419L, 267431L, 267433L, 267439L, 267451L, 267469L, 267479L, 267481L, 267493L,
-267497L, 267511L, 267517L, 267521L, 267523L, 267541L, 267551L, 267557L, 267569L,
-267581L, 267587L, 267593L, 267601L, 267611L, 267613L, 267629L, 267637L, 267643L,
-267647L, 267649L, 267661L, 267667L, 267671L, 267677L, 267679L, 267713L, 267719L,
-267721L, 267727L, 267737L, 267739L, 267749L, 267763L, 267781L, 267791L, 267797L,
-267803L, 267811L, 267829L, 267833L, 267857L, 267863L, 267877L, 267887L, 267893L,
-267899L, 267901L, 267907L, 267913L, 267929L, 267941L, 267959L, 267961L, 268003L,
-268013L, 268043L, 268049L, 268063L, 268069L, 268091L, 268123L, 268133L, 268153L,
-268171L, 268189L, 268199L, 268207L, 268211L, 268237L, 268253L, 268267L, 268271L,
-268283L, 268291L, 268297L, 268343L, 268403L, 268439L, 268459L, 268487L, 268493L,
-268501L, 268507L, 268517L, 268519L, 268529L, 268531L, 268537L, 268547L, 268573L,
-268607L, 268613L, 268637L, 268643L, 268661L, 268693L, 268721L, 268729L, 268733L,
-268747L, 268757L, 268759L, 268771L, 268777L, 268781L, 268783L, 268789L, 268811L,
-268813L, 268817L, 268819L, 268823L, 268841L, 268843L, 268861L, 268883L, 268897L,
-268909L, 268913L, 268921L, 268927L, 268937L, 268969L, 268973L, 268979L, 268993L,
-268997L, 268999L, 269023L, 269029L, 269039L, 269041L, 269057L, 269063L, 269069L,
-269089L, 269117L, 269131L, 269141L, 269167L, 269177L, 269179L, 269183L, 269189L,
-269201L, 269209L, 269219L, 269221L, 269231L, 269237L, 269251L, 269257L, 269281L,
-269317L, 269327L, 269333L, 269341L, 269351L, 269377L, 269383L, 269387L, 269389L,
-269393L, 269413L, 269419L, 269429L, 269431L, 269441L, 269461L, 269473L, 269513L,
-269519L, 269527L, 269539L, 269543L, 269561L, 269573L, 269579L, 269597L, 269617L,
-269623L, 269641L, 269651L, 269663L, 269683L, 269701L, 269713L, 269719L, 269723L,
-269741L, 269749L, 269761L, 269779L, 269783L, 269791L, 269851L, 269879L, 269887L,
-269891L, 269897L, 269923L, 269939L, 269947L, 269953L, 269981L, 269987L, 270001L,
-270029L, 270031L, 270037L, 270059L, 270071L, 270073L, 270097L, 270121L, 270131L,
-270133L, 270143L, 270157L, 270163L, 270167L, 270191L, 270209L, 270217L, 270223L,
-270229L, 270239L, 270241L, 270269L, 270271L, 270287L, 270299L, 270307L, 270311L,
-270323L, 270329L, 270337L, 270343L, 270371L, 270379L, 270407L, 270421L, 270437L,
-270443L, 270451L, 270461L, 270463L, 270493L, 270509L, 270527L, 270539L, 270547L,
-270551L, 270553L, 270563L, 270577L, 270583L, 270587L, 270593L, 270601L, 270619L,
-270631L, 270653L, 270659L, 270667L, 270679L, 270689L, 270701L, 270709L, 270719L,
-270737L, 270749L, 270761L, 270763L, 270791L, 270797L, 270799L, 270821L, 270833L,
-270841L, 270859L, 270899L, 270913L, 270923L, 270931L, 270937L, 270953L, 270961L,
-270967L, 270973L, 271003L, 271013L, 271021L, 271027L, 271043L, 271057L, 271067L,
-271079L, 271097L, 271109L, 271127L, 271129L, 271163L, 271169L, 271177L, 271181L,
-271211L, 271217L, 271231L, 271241L, 271253L, 271261L, 271273L, 271277L, 271279L,
-271289L, 271333L, 271351L, 271357L, 271363L, 271367L, 271393L, 271409L, 271429L,
-271451L, 271463L, 271471L, 271483L, 271489L, 271499L, 271501L, 271517L, 271549L,
-271553L, 271571L, 271573L, 271597L, 271603L, 271619L, 271637L, 271639L, 271651L,
-271657L, 271693L, 271703L, 271723L, 271729L, 271753L, 271769L, 271771L, 271787L,
-271807L, 271811L, 271829L, 271841L, 271849L, 271853L, 271861L, 271867L, 271879L,
-271897L, 271903L, 271919L, 271927L, 271939L, 271967L, 271969L, 271981L, 272003L,
-272009L, 272011L, 272029L, 272039L, 272053L, 272059L, 272093L, 272131L, 272141L,
-272171L, 272179L, 272183L, 272189L, 272191L, 272201L, 272203L, 272227L, 272231L,
-272249L, 272257L, 272263L, 272267L, 272269L, 272287L, 272299L, 272317L, 272329L,
-272333L, 272341L, 272347L, 272351L, 272353L, 272359L, 272369L, 272381L, 272383L,
-272399L, 272407L, 272411L, 272417L, 272423L, 272449L, 272453L, 272477L, 272507L,
-272533L, 272537L, 272539L, 272549L, 272563L, 272567L, 272581L, 272603L, 272621L,
-272651L, 272659L, 272683L, 272693L, 272717L, 272719L, 272737L, 272759L, 272761L,
-272771L, 272777L, 272807L, 272809L, 272813L, 272863L, 272879L, 272887L, 272903L,
-272911L, 272917L, 272927L, 272933L, 272959L, 272971L, 272981L, 272983L, 272989L,
-272999L, 273001L, 273029L, 273043L, 273047L, 273059L, 273061L, 273067L, 273073L,
-273083L, 273107L, 273113L, 273127L, 273131L, 273149L, 273157L, 273181L, 273187L,
-273193L, 273233L, 273253L, 273269L, 273271L, 273281L, 273283L, 273289L, 273311L,
-273313L, 273323L, 273349L, 273359L, 273367L, 273433L, 273457L, 273473L, 273503L,
-273517L, 273521L, 273527L, 273551L, 273569L, 273601L, 273613L, 273617L, 273629L,
-273641L, 273643L, 273653L, 273697L, 273709L, 273719L, 273727L, 273739L, 273773L,
-273787L, 273797L, 273803L, 273821L, 273827L, 273857L, 273881L, 273899L, 273901L,
-273913L, 273919L, 273929L, 273941L, 273943L, 273967L, 273971L, 273979L, 273997L,
-274007L, 274019L, 274033L, 274061L, 274069L, 274081L, 274093L, 274103L, 274117L,
-274121L, 274123L, 274139L, 274147L, 274163L, 274171L, 274177L, 274187L, 274199L,
-274201L, 274213L, 274223L, 274237L, 274243L, 274259L, 274271L, 274277L, 274283L,
-274301L, 274333L, 274349L, 274357L, 274361L, 274403L, 274423L, 274441L, 274451L,
-274453L, 274457L, 274471L, 274489L, 274517L, 274529L, 274579L, 274583L, 274591L,
-274609L, 274627L, 274661L, 274667L, 274679L, 274693L, 274697L, 274709L, 274711L,
-274723L, 274739L, 274751L, 274777L, 274783L, 274787L, 274811L, 274817L, 274829L,
-274831L, 274837L, 274843L, 274847L, 274853L, 274861L, 274867L, 274871L, 274889L,
-274909L, 274931L, 274943L, 274951L, 274957L, 274961L, 274973L, 274993L, 275003L,
-275027L, 275039L, 275047L, 275053L, 275059L, 275083L, 275087L, 275129L, 275131L,
-275147L, 275153L, 275159L, 275161L, 275167L, 275183L, 275201L, 275207L, 275227L,
-275251L, 275263L, 275269L, 275299L, 275309L, 275321L, 275323L, 275339L, 275357L,
-275371L, 275389L, 275393L, 275399L, 275419L, 275423L, 275447L, 275449L, 275453L,
-275459L, 275461L, 275489L, 275491L, 275503L, 275521L, 275531L, 275543L, 275549L,
-275573L, 275579L, 275581L, 275591L, 275593L, 275599L, 275623L, 275641L, 275651L,
-275657L, 275669L, 275677L, 275699L, 275711L, 275719L, 275729L, 275741L, 275767L,
-275773L, 275783L, 275813L, 275827L, 275837L, 275881L, 275897L, 275911L, 275917L,
-275921L, 275923L, 275929L, 275939L, 275941L, 275963L, 275969L, 275981L, 275987L,
-275999L, 276007L, 276011L, 276019L, 276037L, 276041L, 276043L, 276047L, 276049L,
-276079L, 276083L, 276091L, 276113L, 276137L, 276151L, 276173L, 276181L, 276187L,
-276191L, 276209L, 276229L, 276239L, 276247L, 276251L, 276257L, 276277L, 276293L,
-276319L, 276323L, 276337L, 276343L, 276347L, 276359L, 276371L, 276373L, 276389L,
-276401L, 276439L, 276443L, 276449L, 276461L, 276467L, 276487L, 276499L, 276503L,
-276517L, 276527L, 276553L, 276557L, 276581L, 276587L, 276589L, 276593L, 276599L,
-276623L, 276629L, 276637L, 276671L, 276673L, 276707L, 276721L, 276739L, 276763L,
-276767L, 276779L, 276781L, 276817L, 276821L, 276823L, 276827L, 276833L, 276839L,
-276847L, 276869L, 276883L, 276901L, 276907L, 276917L, 276919L, 276929L, 276949L,
-276953L, 276961L, 276977L, 277003L, 277007L, 277021L, 277051L, 277063L, 277073L,
-277087L, 277097L, 277099L, 277157L, 277163L, 277169L, 277177L, 277183L, 277213L,
-277217L, 277223L, 277231L, 277247L, 277259L, 277261L, 277273L, 277279L, 277297L,
-277301L, 277309L, 277331L, 277363L, 277373L, 277411L, 277421L, 277427L, 277429L,
-277483L, 277493L, 277499L, 277513L, 277531L, 277547L, 277549L, 277567L, 277577L,
-277579L, 277597L, 277601L, 277603L, 277637L, 277639L, 277643L, 277657L, 277663L,
-277687L, 277691L, 277703L, 277741L, 277747L, 277751L, 277757L, 277787L, 277789L,
-277793L, 277813L, 277829L, 277847L, 277859L, 277883L, 277889L, 277891L, 277897L,
-277903L, 277919L, 277961L, 277993L, 277999L, 278017L, 278029L, 278041L, 278051L,
-278063L, 278071L, 278087L, 278111L, 278119L, 278123L, 278143L, 278147L, 278149L,
-278177L, 278191L, 278207L, 278209L, 278219L, 278227L, 278233L, 278237L, 278261L,
-278269L, 278279L, 278321L, 278329L, 278347L, 278353L, 278363L, 278387L, 278393L,
-278413L, 278437L, 278459L, 278479L, 278489L, 278491L, 278497L, 278501L, 278503L,
-278543L, 278549L, 278557L, 278561L, 278563L, 278581L, 278591L, 278609L, 278611L,
-278617L, 278623L, 278627L, 278639L, 278651L, 278671L, 278687L, 278689L, 278701L,
-278717L, 278741L, 278743L, 278753L, 278767L, 278801L, 278807L, 278809L, 278813L,
-278819L, 278827L, 278843L, 278849L, 278867L, 278879L, 278881L, 278891L, 278903L,
-278909L, 278911L, 278917L, 278947L, 278981L, 279001L, 279007L, 279023L, 279029L,
-279047L, 279073L, 279109L, 279119L, 279121L, 279127L, 279131L, 279137L, 279143L,
-279173L, 279179L, 279187L, 279203L, 279211L, 279221L, 279269L, 279311L, 279317L,
-279329L, 279337L, 279353L, 279397L, 279407L, 279413L, 279421L, 279431L, 279443L,
-279451L, 279479L, 279481L, 279511L, 279523L, 279541L, 279551L, 279553L, 279557L,
-279571L, 279577L, 279583L, 279593L, 279607L, 279613L, 279619L, 279637L, 279641L,
-279649L, 279659L, 279679L, 279689L, 279707L, 279709L, 279731L, 279751L, 279761L,
-279767L, 279779L, 279817L, 279823L, 279847L, 279857L, 279863L, 279883L, 279913L,
-279919L, 279941L, 279949L, 279967L, 279977L, 279991L, 280001L, 280009L, 280013L,
-280031L, 280037L, 280061L, 280069L, 280097L, 280099L, 280103L, 280121L, 280129L,
-280139L, 280183L, 280187L, 280199L, 280207L, 280219L, 280223L, 280229L, 280243L,
-280249L, 280253L, 280277L, 280297L, 280303L, 280321L, 280327L, 280337L, 280339L,
-280351L, 280373L, 280409L, 280411L, 280451L, 280463L, 280487L, 280499L, 280507L,
-280513L, 280537L, 280541L, 280547L, 280549L, 280561L, 280583L, 280589L, 280591L,
-280597L, 280603L, 280607L, 280613L, 280627L, 280639L, 280673L, 280681L, 280697L,
-280699L, 280703L, 280711L, 280717L, 280729L, 280751L, 280759L, 280769L, 280771L,
-280811L, 280817L, 280837L, 280843L, 280859L, 280871L, 280879L, 280883L, 280897L,
-280909L, 280913L, 280921L, 280927L, 280933L, 280939L, 280949L, 280957L, 280963L,
-280967L, 280979L, 280997L, 281023L, 281033L, 281053L, 281063L, 281069L, 281081L,
-281117L, 281131L, 281153L, 281159L, 281167L, 281189L, 281191L, 281207L, 281227L,
-281233L, 281243L, 281249L, 281251L, 281273L, 281279L, 281291L, 281297L, 281317L,
-281321L, 281327L, 281339L, 281353L, 281357L, 281363L, 281381L, 281419L, 281423L,
-281429L, 281431L, 281509L, 281527L, 281531L, 281539L, 281549L, 281551L, 281557L,
-281563L, 281579L, 281581L, 281609L, 281621L, 281623L, 281627L, 281641L, 281647L,
-281651L, 281653L, 281663L, 281669L, 281683L, 281717L, 281719L, 281737L, 281747L,
-281761L, 281767L, 281777L, 281783L, 281791L, 281797L, 281803L, 281807L, 281833L,
-281837L, 281839L, 281849L, 281857L, 281867L, 281887L, 281893L, 281921L, 281923L,
-281927L, 281933L, 281947L, 281959L, 281971L, 281989L, 281993L, 282001L, 282011L,
-282019L, 282053L, 282059L, 282071L, 282089L, 282091L, 282097L, 282101L, 282103L,
-282127L, 282143L, 282157L, 282167L, 282221L, 282229L, 282239L, 282241L, 282253L,
-282281L, 282287L, 282299L, 282307L, 282311L, 282313L, 282349L, 282377L, 282383L,
-282389L, 282391L, 282407L, 282409L, 282413L, 282427L, 282439L, 282461L, 282481L,
-282487L, 282493L, 282559L, 282563L, 282571L, 282577L, 282589L, 282599L, 282617L,
-282661L, 282671L, 282677L, 282679L, 282683L, 282691L, 282697L, 282703L, 282707L,
-282713L, 282767L, 282769L, 282773L, 282797L, 282809L, 282827L, 282833L, 282847L,
-282851L, 282869L, 282881L, 282889L, 282907L, 282911L, 282913L, 282917L, 282959L,
-282973L, 282977L, 282991L, 283001L, 283007L, 283009L, 283027L, 283051L, 283079L,
-283093L, 283097L, 283099L, 283111L, 283117L, 283121L, 283133L, 283139L, 283159L,
-283163L, 283181L, 283183L, 283193L, 283207L, 283211L, 283267L, 283277L, 283289L,
-283303L, 283369L, 283397L, 283403L, 283411L, 283447L, 283463L, 283487L, 283489L,
-283501L, 283511L, 283519L, 283541L, 283553L, 283571L, 283573L, 283579L, 283583L,
-283601L, 283607L, 283609L, 283631L, 283637L, 283639L, 283669L, 283687L, 283697L,
-283721L, 283741L, 283763L, 283769L, 283771L, 283793L, 283799L, 283807L, 283813L,
-283817L, 283831L, 283837L, 283859L, 283861L, 283873L, 283909L, 283937L, 283949L,
-283957L, 283961L, 283979L, 284003L, 284023L, 284041L, 284051L, 284057L, 284059L,
-284083L, 284093L, 284111L, 284117L, 284129L, 284131L, 284149L, 284153L, 284159L,
-284161L, 284173L, 284191L, 284201L, 284227L, 284231L, 284233L, 284237L, 284243L,
-284261L, 284267L, 284269L, 284293L, 284311L, 284341L, 284357L, 284369L, 284377L,
-284387L, 284407L, 284413L, 284423L, 284429L, 284447L, 284467L, 284477L, 284483L,
-284489L, 284507L, 284509L, 284521L, 284527L, 284539L, 284551L, 284561L, 284573L,
-284587L, 284591L, 284593L, 284623L, 284633L, 284651L, 284657L, 284659L, 284681L,
-284689L, 284701L, 284707L, 284723L, 284729L, 284731L, 284737L, 284741L, 284743L,
-284747L, 284749L, 284759L, 284777L, 284783L, 284803L, 284807L, 284813L, 284819L,
-284831L, 284833L, 284839L, 284857L, 284881L, 284897L, 284899L, 284917L, 284927L,
-284957L, 284969L, 284989L, 285007L, 285023L, 285031L, 285049L, 285071L, 285079L,
-285091L, 285101L, 285113L, 285119L, 285121L, 285139L, 285151L, 285161L, 285179L,
-285191L, 285199L, 285221L, 285227L, 285251L, 285281L, 285283L, 285287L, 285289L,
-285301L, 285317L, 285343L, 285377L, 285421L, 285433L, 285451L, 285457L, 285463L,
-285469L, 285473L, 285497L, 285517L, 285521L, 285533L, 285539L, 285553L, 285557L,
-285559L, 285569L, 285599L, 285611L, 285613L, 285629L, 285631L, 285641L, 285643L,
-285661L, 285667L, 285673L, 285697L, 285707L, 285709L, 285721L, 285731L, 285749L,
-285757L, 285763L, 285767L, 285773L, 285781L, 285823L, 285827L, 285839L, 285841L,
-285871L, 285937L, 285949L, 285953L, 285977L, 285979L, 285983L, 285997L, 286001L,
-286009L, 286019L, 286043L, 286049L, 286061L, 286063L, 286073L, 286103L, 286129L,
-286163L, 286171L, 286199L, 286243L, 286249L, 286289L, 286301L, 286333L, 286367L,
-286369L, 286381L, 286393L, 286397L, 286411L, 286421L, 286427L, 286453L, 286457L,
-286459L, 286469L, 286477L, 286483L, 286487L, 286493L, 286499L, 286513L, 286519L,
-286541L, 286543L, 286547L, 286553L, 286589L, 286591L, 286609L, 286613L, 286619L,
-286633L, 286651L, 286673L, 286687L, 286697L, 286703L, 286711L, 286721L, 286733L,
-286751L, 286753L, 286763L, 286771L, 286777L, 286789L, 286801L, 286813L, 286831L,
-286859L, 286873L, 286927L, 286973L, 286981L, 286987L, 286999L, 287003L, 287047L,
-287057L, 287059L, 287087L, 287093L, 287099L, 287107L, 287117L, 287137L, 287141L,
-287149L, 287159L, 287167L, 287173L, 287179L, 287191L, 287219L, 287233L, 287237L,
-287239L, 287251L, 287257L, 287269L, 287279L, 287281L, 287291L, 287297L, 287321L,
-287327L, 287333L, 287341L, 287347L, 287383L, 287387L, 287393L, 287437L, 287449L,
-287491L, 287501L, 287503L, 287537L, 287549L, 287557L, 287579L, 287597L, 287611L,
-287629L, 287669L, 287671L, 287681L, 287689L, 287701L, 287731L, 287747L, 287783L,
-287789L, 287801L, 287813L, 287821L, 287849L, 287851L, 287857L, 287863L, 287867L,
-287873L, 287887L, 287921L, 287933L, 287939L, 287977L, 288007L, 288023L, 288049L,
-288053L, 288061L, 288077L, 288089L, 288109L, 288137L, 288179L, 288181L, 288191L,
-288199L, 288203L, 288209L, 288227L, 288241L, 288247L, 288257L, 288283L, 288293L,
-288307L, 288313L, 288317L, 288349L, 288359L, 288361L, 288383L, 288389L, 288403L,
-288413L, 288427L, 288433L, 288461L, 288467L, 288481L, 288493L, 288499L, 288527L,
-288529L, 288539L, 288551L, 288559L, 288571L, 288577L, 288583L, 288647L, 288649L,
-288653L, 288661L, 288679L, 288683L, 288689L, 288697L, 288731L, 288733L, 288751L,
-288767L, 288773L, 288803L, 288817L, 288823L, 288833L, 288839L, 288851L, 288853L,
-288877L, 288907L, 288913L, 288929L, 288931L, 288947L, 288973L, 288979L, 288989L,
-288991L, 288997L, 289001L, 289019L, 289021L, 289031L, 289033L, 289039L, 289049L,
-289063L, 289067L, 289099L, 289103L, 289109L, 289111L, 289127L, 289129L, 289139L,
-289141L, 289151L, 289169L, 289171L, 289181L, 289189L, 289193L, 289213L, 289241L,
-289243L, 289249L, 289253L, 289273L, 289283L, 289291L, 289297L, 289309L, 289319L,
-289343L, 289349L, 289361L, 289369L, 289381L, 289397L, 289417L, 289423L, 289439L,
-289453L, 289463L, 289469L, 289477L, 289489L, 289511L, 289543L, 289559L, 289573L,
-289577L, 289589L, 289603L, 289607L, 289637L, 289643L, 289657L, 289669L, 289717L,
-289721L, 289727L, 289733L, 289741L, 289759L, 289763L, 289771L, 289789L, 289837L,
-289841L, 289843L, 289847L, 289853L, 289859L, 289871L, 289889L, 289897L, 289937L,
-289951L, 289957L, 289967L, 289973L, 289987L, 289999L, 290011L, 290021L, 290023L,
-290027L, 290033L, 290039L, 290041L, 290047L, 290057L, 290083L, 290107L, 290113L,
-290119L, 290137L, 290141L, 290161L, 290183L, 290189L, 290201L, 290209L, 290219L,
-290233L, 290243L, 290249L, 290317L, 290327L, 290347L, 290351L, 290359L, 290369L,
-290383L, 290393L, 290399L, 290419L, 290429L, 290441L, 290443L, 290447L, 290471L,
-290473L, 290489L, 290497L, 290509L, 290527L, 290531L, 290533L, 290539L, 290557L,
-290593L, 290597L, 290611L, 290617L, 290621L, 290623L, 290627L, 290657L, 290659L,
-290663L, 290669L, 290671L, 290677L, 290701L, 290707L, 290711L, 290737L, 290761L,
-290767L, 290791L, 290803L, 290821L, 290827L, 290837L, 290839L, 290861L, 290869L,
-290879L, 290897L, 290923L, 290959L, 290963L, 290971L, 290987L, 290993L, 290999L,
-291007L, 291013L, 291037L, 291041L, 291043L, 291077L, 291089L, 291101L, 291103L,
-291107L, 291113L, 291143L, 291167L, 291169L, 291173L, 291191L, 291199L, 291209L,
-291217L, 291253L, 291257L, 291271L, 291287L, 291293L, 291299L, 291331L, 291337L,
-291349L, 291359L, 291367L, 291371L, 291373L, 291377L, 291419L, 291437L, 291439L,
-291443L, 291457L, 291481L, 291491L, 291503L, 291509L, 291521L, 291539L, 291547L,
-291559L, 291563L, 291569L, 291619L, 291647L, 291649L, 291661L, 291677L, 291689L,
-291691L, 291701L, 291721L, 291727L, 291743L, 291751L, 291779L, 291791L, 291817L,
-291829L, 291833L, 291853L, 291857L, 291869L, 291877L, 291887L, 291899L, 291901L,
-291923L, 291971L, 291979L, 291983L, 291997L, 292021L, 292027L, 292037L, 292057L,
-292069L, 292079L, 292081L, 292091L, 292093L, 292133L, 292141L, 292147L, 292157L,
-292181L, 292183L, 292223L, 292231L, 292241L, 292249L, 292267L, 292283L, 292301L,
-292309L, 292319L, 292343L, 292351L, 292363L, 292367L, 292381L, 292393L, 292427L,
-292441L, 292459L, 292469L, 292471L, 292477L, 292483L, 292489L, 292493L, 292517L,
-292531L, 292541L, 292549L, 292561L, 292573L, 292577L, 292601L, 292627L, 292631L,
-292661L, 292667L, 292673L, 292679L, 292693L, 292703L, 292709L, 292711L, 292717L,
-292727L, 292753L, 292759L, 292777L, 292793L, 292801L, 292807L, 292819L, 292837L,
-292841L, 292849L, 292867L, 292879L, 292909L, 292921L, 292933L, 292969L, 292973L,
-292979L, 292993L, 293021L, 293071L, 293081L, 293087L, 293093L, 293099L, 293107L,
-293123L, 293129L, 293147L, 293149L, 293173L, 293177L, 293179L, 293201L, 293207L,
-293213L, 293221L, 293257L, 293261L, 293263L, 293269L, 293311L, 293329L, 293339L,
-293351L, 293357L, 293399L, 293413L, 293431L, 293441L, 293453L, 293459L, 293467L,
-293473L, 293483L, 293507L, 293543L, 293599L, 293603L, 293617L, 293621L, 293633L,
-293639L, 293651L, 293659L, 293677L, 293681L, 293701L, 293717L, 293723L, 293729L,
-293749L, 293767L, 293773L, 293791L, 293803L, 293827L, 293831L, 293861L, 293863L,
-293893L, 293899L, 293941L, 293957L, 293983L, 293989L, 293999L, 294001L, 294013L,
-294023L, 294029L, 294043L, 294053L, 294059L, 294067L, 294103L, 294127L, 294131L,
-294149L, 294157L, 294167L, 294169L, 294179L, 294181L, 294199L, 294211L, 294223L,
-294227L, 294241L, 294247L, 294251L, 294269L, 294277L, 294289L, 294293L, 294311L,
-294313L, 294317L, 294319L, 294337L, 294341L, 294347L, 294353L, 294383L, 294391L,
-294397L, 294403L, 294431L, 294439L, 294461L, 294467L, 294479L, 294499L, 294509L,
-294523L, 294529L, 294551L, 294563L, 294629L, 294641L, 294647L, 294649L, 294659L,
-294673L, 294703L, 294731L, 294751L, 294757L, 294761L, 294773L, 294781L, 294787L,
-294793L, 294799L, 294803L, 294809L, 294821L, 294829L, 294859L, 294869L, 294887L,
-294893L, 294911L, 294919L, 294923L, 294947L, 294949L, 294953L, 294979L, 294989L,
-294991L, 294997L, 295007L, 295033L, 295037L, 295039L, 295049L, 295073L, 295079L,
-295081L, 295111L, 295123L, 295129L, 295153L, 295187L, 295199L, 295201L, 295219L,
-295237L, 295247L, 295259L, 295271L, 295277L, 295283L, 295291L, 295313L, 295319L,
-295333L, 295357L, 295363L, 295387L, 295411L, 295417L, 295429L, 295433L, 295439L,
-295441L, 295459L, 295513L, 295517L, 295541L, 295553L, 295567L, 295571L, 295591L,
-295601L, 295663L, 295693L, 295699L, 295703L, 295727L, 295751L, 295759L, 295769L,
-295777L, 295787L, 295819L, 295831L, 295837L, 295843L, 295847L, 295853L, 295861L,
-295871L, 295873L, 295877L, 295879L, 295901L, 295903L, 295909L, 295937L, 295943L,
-295949L, 295951L, 295961L, 295973L, 295993L, 296011L, 296017L, 296027L, 296041L,
-296047L, 296071L, 296083L, 296099L, 296117L, 296129L, 296137L, 296159L, 296183L,
-296201L, 296213L, 296221L, 296237L, 296243L, 296249L, 296251L, 296269L, 296273L,
-296279L, 296287L, 296299L, 296347L, 296353L, 296363L, 296369L, 296377L, 296437L,
-296441L, 296473L, 296477L, 296479L, 296489L, 296503L, 296507L, 296509L, 296519L,
-296551L, 296557L, 296561L, 296563L, 296579L, 296581L, 296587L, 296591L, 296627L,
-296651L, 296663L, 296669L, 296683L, 296687L, 296693L, 296713L, 296719L, 296729L,
-296731L, 296741L, 296749L, 296753L, 296767L, 296771L, 296773L, 296797L, 296801L,
-296819L, 296827L, 296831L, 296833L, 296843L, 296909L, 296911L, 296921L, 296929L,
-296941L, 296969L, 296971L, 296981L, 296983L, 296987L, 297019L, 297023L, 297049L,
-297061L, 297067L, 297079L, 297083L, 297097L, 297113L, 297133L, 297151L, 297161L,
-297169L, 297191L, 297233L, 297247L, 297251L, 297257L, 297263L, 297289L, 297317L,
-297359L, 297371L, 297377L, 297391L, 297397L, 297403L, 297421L, 297439L, 297457L,
-297467L, 297469L, 297481L, 297487L, 297503L, 297509L, 297523L, 297533L, 297581L,
-297589L, 297601L, 297607L, 297613L, 297617L, 297623L, 297629L, 297641L, 297659L,
-297683L, 297691L, 297707L, 297719L, 297727L, 297757L, 297779L, 297793L, 297797L,
-297809L, 297811L, 297833L, 297841L, 297853L, 297881L, 297889L, 297893L, 297907L,
-297911L, 297931L, 297953L, 297967L, 297971L, 297989L, 297991L, 298013L, 298021L,
-298031L, 298043L, 298049L, 298063L, 298087L, 298093L, 298099L, 298153L, 298157L,
-298159L, 298169L, 298171L, 298187L, 298201L, 298211L, 298213L, 298223L, 298237L,
-298247L, 298261L, 298283L, 298303L, 298307L, 298327L, 298339L, 298343L, 298349L,
-298369L, 298373L, 298399L, 298409L, 298411L, 298427L, 298451L, 298477L, 298483L,
-298513L, 298559L, 298579L, 298583L, 298589L, 298601L, 298607L, 298621L, 298631L,
-298651L, 298667L, 298679L, 298681L, 298687L, 298691L, 298693L, 298709L, 298723L,
-298733L, 298757L, 298759L, 298777L, 298799L, 298801L, 298817L, 298819L, 298841L,
-298847L, 298853L, 298861L, 298897L, 298937L, 298943L, 298993L, 298999L, 299011L,
-299017L, 299027L, 299029L, 299053L, 299059L, 299063L, 299087L, 299099L, 299107L,
-299113L, 299137L, 299147L, 299171L, 299179L, 299191L, 299197L, 299213L, 299239L,
-299261L, 299281L, 299287L, 299311L, 299317L, 299329L, 299333L, 299357L, 299359L,
-299363L, 299371L, 299389L, 299393L, 299401L, 299417L, 299419L, 299447L, 299471L,
-299473L, 299477L, 299479L, 299501L, 299513L, 299521L, 299527L, 299539L, 299567L,
-299569L, 299603L, 299617L, 299623L, 299653L, 299671L, 299681L, 299683L, 299699L,
-299701L, 299711L, 299723L, 299731L, 299743L, 299749L, 299771L, 299777L, 299807L,
-299843L, 299857L, 299861L, 299881L, 299891L, 299903L, 299909L, 299933L, 299941L,
-299951L, 299969L, 299977L, 299983L, 299993L, 300007L, 300017L, 300023L, 300043L,
-300073L, 300089L, 300109L, 300119L, 300137L, 300149L, 300151L, 300163L, 300187L,
-300191L, 300193L, 300221L, 300229L, 300233L, 300239L, 300247L, 300277L, 300299L,
-300301L, 300317L, 300319L, 300323L, 300331L, 300343L, 300347L, 300367L, 300397L,
-300413L, 300427L, 300431L, 300439L, 300463L, 300481L, 300491L, 300493L, 300497L,
-300499L, 300511L, 300557L, 300569L, 300581L, 300583L, 300589L, 300593L, 300623L,
-300631L, 300647L, 300649L, 300661L, 300667L, 300673L, 300683L, 300691L, 300719L,
-300721L, 300733L, 300739L, 300743L, 300749L, 300757L, 300761L, 300779L, 300787L,
-300799L, 300809L, 300821L, 300823L, 300851L, 300857L, 300869L, 300877L, 300889L,
-300893L, 300929L, 300931L, 300953L, 300961L, 300967L, 300973L, 300977L, 300997L,
-301013L, 301027L, 301039L, 301051L, 301057L, 301073L, 301079L, 301123L, 301127L,
-301141L, 301153L, 301159L, 301177L, 301181L, 301183L, 301211L, 301219L, 301237L,
-301241L, 301243L, 301247L, 301267L, 301303L, 301319L, 301331L, 301333L, 301349L,
-301361L, 301363L, 301381L, 301403L, 301409L, 301423L, 301429L, 301447L, 301459L,
-301463L, 301471L, 301487L, 301489L, 301493L, 301501L, 301531L, 301577L, 301579L,
-301583L, 301591L, 301601L, 301619L, 301627L, 301643L, 301649L, 301657L, 301669L,
-301673L, 301681L, 301703L, 301711L, 301747L, 301751L, 301753L, 301759L, 301789L,
-301793L, 301813L, 301831L, 301841L, 301843L, 301867L, 301877L, 301897L, 301901L,
-301907L, 301913L, 301927L, 301933L, 301943L, 301949L, 301979L, 301991L, 301993L,
-301997L, 301999L, 302009L, 302053L, 302111L, 302123L, 302143L, 302167L, 302171L,
-302173L, 302189L, 302191L, 302213L, 302221L, 302227L, 302261L, 302273L, 302279L,
-302287L, 302297L, 302299L, 302317L, 302329L, 302399L, 302411L, 302417L, 302429L,
-302443L, 302459L, 302483L, 302507L, 302513L, 302551L, 302563L, 302567L, 302573L,
-302579L, 302581L, 302587L, 302593L, 302597L, 302609L, 302629L, 302647L, 302663L,
-302681L, 302711L, 302723L, 302747L, 302759L, 302767L, 302779L, 302791L, 302801L,
-302831L, 302833L, 302837L, 302843L, 302851L, 302857L, 302873L, 302891L, 302903L,
-302909L, 302921L, 302927L, 302941L, 302959L, 302969L, 302971L, 302977L, 302983L,
-302989L, 302999L, 303007L, 303011L, 303013L, 303019L, 303029L, 303049L, 303053L,
-303073L, 303089L, 303091L, 303097L, 303119L, 303139L, 303143L, 303151L, 303157L,
-303187L, 303217L, 303257L, 303271L, 303283L, 303287L, 303293L, 303299L, 303307L,
-303313L, 303323L, 303337L, 303341L, 303361L, 303367L, 303371L, 303377L, 303379L,
-303389L, 303409L, 303421L, 303431L, 303463L, 303469L, 303473L, 303491L, 303493L,
-303497L, 303529L, 303539L, 303547L, 303551L, 303553L, 303571L, 303581L, 303587L,
-303593L, 303613L, 303617L, 303619L, 303643L, 303647L, 303649L, 303679L, 303683L,
-303689L, 303691L, 303703L, 303713L, 303727L, 303731L, 303749L, 303767L, 303781L,
-303803L, 303817L, 303827L, 303839L, 303859L, 303871L, 303889L, 303907L, 303917L,
-303931L, 303937L, 303959L, 303983L, 303997L, 304009L, 304013L, 304021L, 304033L,
-304039L, 304049L, 304063L, 304067L, 304069L, 304081L, 304091L, 304099L, 304127L,
-304151L, 304153L, 304163L, 304169L, 304193L, 304211L, 304217L, 304223L, 304253L,
-304259L, 304279L, 304301L, 304303L, 304331L, 304349L, 304357L, 304363L, 304373L,
-304391L, 304393L, 304411L, 304417L, 304429L, 304433L, 304439L, 304457L, 304459L,
-304477L, 304481L, 304489L, 304501L, 304511L, 304517L, 304523L, 304537L, 304541L,
-304553L, 304559L, 304561L, 304597L, 304609L, 304631L, 304643L, 304651L, 304663L,
-304687L, 304709L, 304723L, 304729L, 304739L, 304751L, 304757L, 304763L, 304771L,
-304781L, 304789L, 304807L, 304813L, 304831L, 304847L, 304849L, 304867L, 304879L,
-304883L, 304897L, 304901L, 304903L, 304907L, 304933L, 304937L, 304943L, 304949L,
-304961L, 304979L, 304981L, 305017L, 305021L, 305023L, 305029L, 305033L, 305047L,
-305069L, 305093L, 305101L, 305111L, 305113L, 305119L, 305131L, 305143L, 305147L,
-305209L, 305219L, 305231L, 305237L, 305243L, 305267L, 305281L, 305297L, 305329L,
-305339L, 305351L, 305353L, 305363L, 305369L, 305377L, 305401L, 305407L, 305411L,
-305413L, 305419L, 305423L, 305441L, 305449L, 305471L, 305477L, 305479L, 305483L,
-305489L, 305497L, 305521L, 305533L, 305551L, 305563L, 305581L, 305593L, 305597L,
-305603L, 305611L, 305621L, 305633L, 305639L, 305663L, 305717L, 305719L, 305741L,
-305743L, 305749L, 305759L, 305761L, 305771L, 305783L, 305803L, 305821L, 305839L,
-305849L, 305857L, 305861L, 305867L, 305873L, 305917L, 305927L, 305933L, 305947L,
-305971L, 305999L, 306011L, 306023L, 306029L, 306041L, 306049L, 306083L, 306091L,
-306121L, 306133L, 306139L, 306149L, 306157L, 306167L, 306169L, 306191L, 306193L,
-306209L, 306239L, 306247L, 306253L, 306259L, 306263L, 306301L, 306329L, 306331L,
-306347L, 306349L, 306359L, 306367L, 306377L, 306389L, 306407L, 306419L, 306421L,
-306431L, 306437L, 306457L, 306463L, 306473L, 306479L, 306491L, 306503L, 306511L,
-306517L, 306529L, 306533L, 306541L, 306563L, 306577L, 306587L, 306589L, 306643L,
-306653L, 306661L, 306689L, 306701L, 306703L, 306707L, 306727L, 306739L, 306749L,
-306763L, 306781L, 306809L, 306821L, 306827L, 306829L, 306847L, 306853L, 306857L,
-306871L, 306877L, 306883L, 306893L, 306899L, 306913L, 306919L, 306941L, 306947L,
-306949L, 306953L, 306991L, 307009L, 307019L, 307031L, 307033L, 307067L, 307079L,
-307091L, 307093L, 307103L, 307121L, 307129L, 307147L, 307163L, 307169L, 307171L,
-307187L, 307189L, 307201L, 307243L, 307253L, 307259L, 307261L, 307267L, 307273L,
-307277L, 307283L, 307289L, 307301L, 307337L, 307339L, 307361L, 307367L, 307381L,
-307397L, 307399L, 307409L, 307423L, 307451L, 307471L, 307481L, 307511L, 307523L,
-307529L, 307537L, 307543L, 307577L, 307583L, 307589L, 307609L, 307627L, 307631L,
-307633L, 307639L, 307651L, 307669L, 307687L, 307691L, 307693L, 307711L, 307733L,
-307759L, 307817L, 307823L, 307831L, 307843L, 307859L, 307871L, 307873L, 307891L,
-307903L, 307919L, 307939L, 307969L, 308003L, 308017L, 308027L, 308041L, 308051L,
-308081L, 308093L, 308101L, 308107L, 308117L, 308129L, 308137L, 308141L, 308149L,
-308153L, 308213L, 308219L, 308249L, 308263L, 308291L, 308293L, 308303L, 308309L,
-308311L, 308317L, 308323L, 308327L, 308333L, 308359L, 308383L, 308411L, 308423L,
-308437L, 308447L, 308467L, 308489L, 308491L, 308501L, 308507L, 308509L, 308519L,
-308521L, 308527L, 308537L, 308551L, 308569L, 308573L, 308587L, 308597L, 308621L,
-308639L, 308641L, 308663L, 308681L, 308701L, 308713L, 308723L, 308761L, 308773L,
-308801L, 308809L, 308813L, 308827L, 308849L, 308851L, 308857L, 308887L, 308899L,
-308923L, 308927L, 308929L, 308933L, 308939L, 308951L, 308989L, 308999L, 309007L,
-309011L, 309013L, 309019L, 309031L, 309037L, 309059L, 309079L, 309083L, 309091L,
-309107L, 309109L, 309121L, 309131L, 309137L, 309157L, 309167L, 309173L, 309193L,
-309223L, 309241L, 309251L, 309259L, 309269L, 309271L, 309277L, 309289L, 309293L,
-309311L, 309313L, 309317L, 309359L, 309367L, 309371L, 309391L, 309403L, 309433L,
-309437L, 309457L, 309461L, 309469L, 309479L, 309481L, 309493L, 309503L, 309521L,
-309523L, 309539L, 309541L, 309559L, 309571L, 309577L, 309583L, 309599L, 309623L,
-309629L, 309637L, 309667L, 309671L, 309677L, 309707L, 309713L, 309731L, 309737L,
-309769L, 309779L, 309781L, 309797L, 309811L, 309823L, 309851L, 309853L, 309857L,
-309877L, 309899L, 309929L, 309931L, 309937L, 309977L, 309989L, 310019L, 310021L,
-310027L, 310043L, 310049L, 310081L, 310087L, 310091L, 310111L, 310117L, 310127L,
-310129L, 310169L, 310181L, 310187L, 310223L, 310229L, 310231L, 310237L, 310243L,
-310273L, 310283L, 310291L, 310313L, 310333L, 310357L, 310361L, 310363L, 310379L,
-310397L, 310423L, 310433L, 310439L, 310447L, 310459L, 310463L, 310481L, 310489L,
-310501L, 310507L, 310511L, 310547L, 310553L, 310559L, 310567L, 310571L, 310577L,
-310591L, 310627L, 310643L, 310663L, 310693L, 310697L, 310711L, 310721L, 310727L,
-310729L, 310733L, 310741L, 310747L, 310771L, 310781L, 310789L, 310801L, 310819L,
-310823L, 310829L, 310831L, 310861L, 310867L, 310883L, 310889L, 310901L, 310927L,
-310931L, 310949L, 310969L, 310987L, 310997L, 311009L, 311021L, 311027L, 311033L,
-311041L, 311099L, 311111L, 311123L, 311137L, 311153L, 311173L, 311177L, 311183L,
-311189L, 311197L, 311203L, 311237L, 311279L, 311291L, 311293L, 311299L, 311303L,
-311323L, 311329L, 311341L, 311347L, 311359L, 311371L, 311393L, 311407L, 311419L,
-311447L, 311453L, 311473L, 311533L, 311537L, 311539L, 311551L, 311557L, 311561L,
-311567L, 311569L, 311603L, 311609L, 311653L, 311659L, 311677L, 311681L, 311683L,
-311687L, 311711L, 311713L, 311737L, 311743L, 311747L, 311749L, 311791L, 311803L,
-311807L, 311821L, 311827L, 311867L, 311869L, 311881L, 311897L, 311951L, 311957L,
-311963L, 311981L, 312007L, 312023L, 312029L, 312031L, 312043L, 312047L, 312071L,
-312073L, 312083L, 312089L, 312101L, 312107L, 312121L, 312161L, 312197L, 312199L,
-312203L, 312209L, 312211L, 312217L, 312229L, 312233L, 312241L, 312251L, 312253L,
-312269L, 312281L, 312283L, 312289L, 312311L, 312313L, 312331L, 312343L, 312349L,
-312353L, 312371L, 312383L, 312397L, 312401L, 312407L, 312413L, 312427L, 312451L,
-312469L, 312509L, 312517L, 312527L, 312551L, 312553L, 312563L, 312581L, 312583L,
-312589L, 312601L, 312617L, 312619L, 312623L, 312643L, 312673L, 312677L, 312679L,
-312701L, 312703L, 312709L, 312727L, 312737L, 312743L, 312757L, 312773L, 312779L,
-312799L, 312839L, 312841L, 312857L, 312863L, 312887L, 312899L, 312929L, 312931L,
-312937L, 312941L, 312943L, 312967L, 312971L, 312979L, 312989L, 313003L, 313009L,
-313031L, 313037L, 313081L, 313087L, 313109L, 313127L, 313129L, 313133L, 313147L,
-313151L, 313153L, 313163L, 313207L, 313211L, 313219L, 313241L, 313249L, 313267L,
-313273L, 313289L, 313297L, 313301L, 313307L, 313321L, 313331L, 313333L, 313343L,
-313351L, 313373L, 313381L, 313387L, 313399L, 313409L, 313471L, 313477L, 313507L,
-313517L, 313543L, 313549L, 313553L, 313561L, 313567L, 313571L, 313583L, 313589L,
-313597L, 313603L, 313613L, 313619L, 313637L, 313639L, 313661L, 313669L, 313679L,
-313699L, 313711L, 313717L, 313721L, 313727L, 313739L, 313741L, 313763L, 313777L,
-313783L, 313829L, 313849L, 313853L, 313879L, 313883L, 313889L, 313897L, 313909L,
-313921L, 313931L, 313933L, 313949L, 313961L, 313969L, 313979L, 313981L, 313987L,
-313991L, 313993L, 313997L, 314003L, 314021L, 314059L, 314063L, 314077L, 314107L,
-314113L, 314117L, 314129L, 314137L, 314159L, 314161L, 314173L, 314189L, 314213L,
-314219L, 314227L, 314233L, 314239L, 314243L, 314257L, 314261L, 314263L, 314267L,
-314299L, 314329L, 314339L, 314351L, 314357L, 314359L, 314399L, 314401L, 314407L,
-314423L, 314441L, 314453L, 314467L, 314491L, 314497L, 314513L, 314527L, 314543L,
-314549L, 314569L, 314581L, 314591L, 314597L, 314599L, 314603L, 314623L, 314627L,
-314641L, 314651L, 314693L, 314707L, 314711L, 314719L, 314723L, 314747L, 314761L,
-314771L, 314777L, 314779L, 314807L, 314813L, 314827L, 314851L, 314879L, 314903L,
-314917L, 314927L, 314933L, 314953L, 314957L, 314983L, 314989L, 315011L, 315013L,
-315037L, 315047L, 315059L, 315067L, 315083L, 315097L, 315103L, 315109L, 315127L,
-315179L, 315181L, 315193L, 315199L, 315223L, 315247L, 315251L, 315257L, 315269L,
-315281L, 315313L, 315349L, 315361L, 315373L, 315377L, 315389L, 315407L, 315409L,
-315421L, 315437L, 315449L, 315451L, 315461L, 315467L, 315481L, 315493L, 315517L,
-315521L, 315527L, 315529L, 315547L, 315551L, 315559L, 315569L, 315589L, 315593L,
-315599L, 315613L, 315617L, 315631L, 315643L, 315671L, 315677L, 315691L, 315697L,
-315701L, 315703L, 315739L, 315743L, 315751L, 315779L, 315803L, 315811L, 315829L,
-315851L, 315857L, 315881L, 315883L, 315893L, 315899L, 315907L, 315937L, 315949L,
-315961L, 315967L, 315977L, 316003L, 316031L, 316033L, 316037L, 316051L, 316067L,
-316073L, 316087L, 316097L, 316109L, 316133L, 316139L, 316153L, 316177L, 316189L,
-316193L, 316201L, 316213L, 316219L, 316223L, 316241L, 316243L, 316259L, 316271L,
-316291L, 316297L, 316301L, 316321L, 316339L, 316343L, 316363L, 316373L, 316391L,
-316403L, 316423L, 316429L, 316439L, 316453L, 316469L, 316471L, 316493L, 316499L,
-316501L, 316507L, 316531L, 316567L, 316571L, 316577L, 316583L, 316621L, 316633L,
-316637L, 316649L, 316661L, 316663L, 316681L, 316691L, 316697L, 316699L, 316703L,
-316717L, 316753L, 316759L, 316769L, 316777L, 316783L, 316793L, 316801L, 316817L,
-316819L, 316847L, 316853L, 316859L, 316861L, 316879L, 316891L, 316903L, 316907L,
-316919L, 316937L, 316951L, 316957L, 316961L, 316991L, 317003L, 317011L, 317021L,
-317029L, 317047L, 317063L, 317071L, 317077L, 317087L, 317089L, 317123L, 317159L,
-317171L, 317179L, 317189L, 317197L, 317209L, 317227L, 317257L, 317263L, 317267L,
-317269L, 317279L, 317321L, 317323L, 317327L, 317333L, 317351L, 317353L, 317363L,
-317371L, 317399L, 317411L, 317419L, 317431L, 317437L, 317453L, 317459L, 317483L,
-317489L, 317491L, 317503L, 317539L, 317557L, 317563L, 317587L, 317591L, 317593L,
-317599L, 317609L, 317617L, 317621L, 317651L, 317663L, 317671L, 317693L, 317701L,
-317711L, 317717L, 317729L, 317731L, 317741L, 317743L, 317771L, 317773L, 317777L,
-317783L, 317789L, 317797L, 317827L, 317831L, 317839L, 317857L, 317887L, 317903L,
-317921L, 317923L, 317957L, 317959L, 317963L, 317969L, 317971L, 317983L, 317987L,
-318001L, 318007L, 318023L, 318077L, 318103L, 318107L, 318127L, 318137L, 318161L,
-318173L, 318179L, 318181L, 318191L, 318203L, 318209L, 318211L, 318229L, 318233L,
-318247L, 318259L, 318271L, 318281L, 318287L, 318289L, 318299L, 318301L, 318313L,
-318319L, 318323L, 318337L, 318347L, 318349L, 318377L, 318403L, 318407L, 318419L,
-318431L, 318443L, 318457L, 318467L, 318473L, 318503L, 318523L, 318557L, 318559L,
-318569L, 318581L, 318589L, 318601L, 318629L, 318641L, 318653L, 318671L, 318677L,
-318679L, 318683L, 318691L, 318701L, 318713L, 318737L, 318743L, 318749L, 318751L,
-318781L, 318793L, 318809L, 318811L, 318817L, 318823L, 318833L, 318841L, 318863L,
-318881L, 318883L, 318889L, 318907L, 318911L, 318917L, 318919L, 318949L, 318979L,
-319001L, 319027L, 319031L, 319037L, 319049L, 319057L, 319061L, 319069L, 319093L,
-319097L, 319117L, 319127L, 319129L, 319133L, 319147L, 319159L, 319169L, 319183L,
-319201L, 319211L, 319223L, 319237L, 319259L, 319279L, 319289L, 319313L, 319321L,
-319327L, 319339L, 319343L, 319351L, 319357L, 319387L, 319391L, 319399L, 319411L,
-319427L, 319433L, 319439L, 319441L, 319453L, 319469L, 319477L, 319483L, 319489L,
-319499L, 319511L, 319519L, 319541L, 319547L, 319567L, 319577L, 319589L, 319591L,
-319601L, 319607L, 319639L, 319673L, 319679L, 319681L, 319687L, 319691L, 319699L,
-319727L, 319729L, 319733L, 319747L, 319757L, 319763L, 319811L, 319817L, 319819L,
-319829L, 319831L, 319849L, 319883L, 319897L, 319901L, 319919L, 319927L, 319931L,
-319937L, 319967L, 319973L, 319981L, 319993L, 320009L, 320011L, 320027L, 320039L,
-320041L, 320053L, 320057L, 320063L, 320081L, 320083L, 320101L, 320107L, 320113L,
-320119L, 320141L, 320143L, 320149L, 320153L, 320179L, 320209L, 320213L, 320219L,
-320237L, 320239L, 320267L, 320269L, 320273L, 320291L, 320293L, 320303L, 320317L,
-320329L, 320339L, 320377L, 320387L, 320389L, 320401L, 320417L, 320431L, 320449L,
-320471L, 320477L, 320483L, 320513L, 320521L, 320533L, 320539L, 320561L, 320563L,
-320591L, 320609L, 320611L, 320627L, 320647L, 320657L, 320659L, 320669L, 320687L,
-320693L, 320699L, 320713L, 320741L, 320759L, 320767L, 320791L, 320821L, 320833L,
-320839L, 320843L, 320851L, 320861L, 320867L, 320899L, 320911L, 320923L, 320927L,
-320939L, 320941L, 320953L, 321007L, 321017L, 321031L, 321037L, 321047L, 321053L,
-321073L, 321077L, 321091L, 321109L, 321143L, 321163L, 321169L, 321187L, 321193L,
-321199L, 321203L, 321221L, 321227L, 321239L, 321247L, 321289L, 321301L, 321311L,
-321313L, 321319L, 321323L, 321329L, 321331L, 321341L, 321359L, 321367L, 321371L,
-321383L, 321397L, 321403L, 321413L, 321427L, 321443L, 321449L, 321467L, 321469L,
-321509L, 321547L, 321553L, 321569L, 321571L, 321577L, 321593L, 321611L, 321617L,
-321619L, 321631L, 321647L, 321661L, 321679L, 321707L, 321709L, 321721L, 321733L,
-321743L, 321751L, 321757L, 321779L, 321799L, 321817L, 321821L, 321823L, 321829L,
-321833L, 321847L, 321851L, 321889L, 321901L, 321911L, 321947L, 321949L, 321961L,
-321983L, 321991L, 322001L, 322009L, 322013L, 322037L, 322039L, 322051L, 322057L,
-322067L, 322073L, 322079L, 322093L, 322097L, 322109L, 322111L, 322139L, 322169L,
-322171L, 322193L, 322213L, 322229L, 322237L, 322243L, 322247L, 322249L, 322261L,
-322271L, 322319L, 322327L, 322339L, 322349L, 322351L, 322397L, 322403L, 322409L,
-322417L, 322429L, 322433L, 322459L, 322463L, 322501L, 322513L, 322519L, 322523L,
-322537L, 322549L, 322559L, 322571L, 322573L, 322583L, 322589L, 322591L, 322607L,
-322613L, 322627L, 322631L, 322633L, 322649L, 322669L, 322709L, 322727L, 322747L,
-322757L, 322769L, 322771L, 322781L, 322783L, 322807L, 322849L, 322859L, 322871L,
-322877L, 322891L, 322901L, 322919L, 322921L, 322939L, 322951L, 322963L, 322969L,
-322997L, 322999L, 323003L, 323009L, 323027L, 323053L, 323077L, 323083L, 323087L,
-323093L, 323101L, 323123L, 323131L, 323137L, 323149L, 323201L, 323207L, 323233L,
-323243L, 323249L, 323251L, 323273L, 323333L, 323339L, 323341L, 323359L, 323369L,
-323371L, 323377L, 323381L, 323383L, 323413L, 323419L, 323441L, 323443L, 323467L,
-323471L, 323473L, 323507L, 323509L, 323537L, 323549L, 323567L, 323579L, 323581L,
-323591L, 323597L, 323599L, 323623L, 323641L, 323647L, 323651L, 323699L, 323707L,
-323711L, 323717L, 323759L, 323767L, 323789L, 323797L, 323801L, 323803L, 323819L,
-323837L, 323879L, 323899L, 323903L, 323923L, 323927L, 323933L, 323951L, 323957L,
-323987L, 324011L, 324031L, 324053L, 324067L, 324073L, 324089L, 324097L, 324101L,
-324113L, 324119L, 324131L, 324143L, 324151L, 324161L, 324179L, 324199L, 324209L,
-324211L, 324217L, 324223L, 324239L, 324251L, 324293L, 324299L, 324301L, 324319L,
-324329L, 324341L, 324361L, 324391L, 324397L, 324403L, 324419L, 324427L, 324431L,
-324437L, 324439L, 324449L, 324451L, 324469L, 324473L, 324491L, 324497L, 324503L,
-324517L, 324523L, 324529L, 324557L, 324587L, 324589L, 324593L, 324617L, 324619L,
-324637L, 324641L, 324647L, 324661L, 324673L, 324689L, 324697L, 324707L, 324733L,
-324743L, 324757L, 324763L, 324773L, 324781L, 324791L, 324799L, 324809L, 324811L,
-324839L, 324847L, 324869L, 324871L, 324889L, 324893L, 324901L, 324931L, 324941L,
-324949L, 324953L, 324977L, 324979L, 324983L, 324991L, 324997L, 325001L, 325009L,
-325019L, 325021L, 325027L, 325043L, 325051L, 325063L, 325079L, 325081L, 325093L,
-325133L, 325153L, 325163L, 325181L, 325187L, 325189L, 325201L, 325217L, 325219L,
-325229L, 325231L, 325249L, 325271L, 325301L, 325307L, 325309L, 325319L, 325333L,
-325343L, 325349L, 325379L, 325411L, 325421L, 325439L, 325447L, 325453L, 325459L,
-325463L, 325477L, 325487L, 325513L, 325517L, 325537L, 325541L, 325543L, 325571L,
-325597L, 325607L, 325627L, 325631L, 325643L, 325667L, 325673L, 325681L, 325691L,
-325693L, 325697L, 325709L, 325723L, 325729L, 325747L, 325751L, 325753L, 325769L,
-325777L, 325781L, 325783L, 325807L, 325813L, 325849L, 325861L, 325877L, 325883L,
-325889L, 325891L, 325901L, 325921L, 325939L, 325943L, 325951L, 325957L, 325987L,
-325993L, 325999L, 326023L, 326057L, 326063L, 326083L, 326087L, 326099L, 326101L,
-326113L, 326119L, 326141L, 326143L, 326147L, 326149L, 326153L, 326159L, 326171L,
-326189L, 326203L, 326219L, 326251L, 326257L, 326309L, 326323L, 326351L, 326353L,
-326369L, 326437L, 326441L, 326449L, 326467L, 326479L, 326497L, 326503L, 326537L,
-326539L, 326549L, 326561L, 326563L, 326567L, 326581L, 326593L, 326597L, 326609L,
-326611L, 326617L, 326633L, 326657L, 326659L, 326663L, 326681L, 326687L, 326693L,
-326701L, 326707L, 326737L, 326741L, 326773L, 326779L, 326831L, 326863L, 326867L,
-326869L, 326873L, 326881L, 326903L, 326923L, 326939L, 326941L, 326947L, 326951L,
-326983L, 326993L, 326999L, 327001L, 327007L, 327011L, 327017L, 327023L, 327059L,
-327071L, 327079L, 327127L, 327133L, 327163L, 327179L, 327193L, 327203L, 327209L,
-327211L, 327247L, 327251L, 327263L, 327277L, 327289L, 327307L, 327311L, 327317L,
-327319L, 327331L, 327337L, 327343L, 327347L, 327401L, 327407L, 327409L, 327419L,
-327421L, 327433L, 327443L, 327463L, 327469L, 327473L, 327479L, 327491L, 327493L,
-327499L, 327511L, 327517L, 327529L, 327553L, 327557L, 327559L, 327571L, 327581L,
-327583L, 327599L, 327619L, 327629L, 327647L, 327661L, 327667L, 327673L, 327689L,
-327707L, 327721L, 327737L, 327739L, 327757L, 327779L, 327797L, 327799L, 327809L,
-327823L, 327827L, 327829L, 327839L, 327851L, 327853L, 327869L, 327871L, 327881L,
-327889L, 327917L, 327923L, 327941L, 327953L, 327967L, 327979L, 327983L, 328007L,
-328037L, 328043L, 328051L, 328061L, 328063L, 328067L, 328093L, 328103L, 328109L,
-328121L, 328127L, 328129L, 328171L, 328177L, 328213L, 328243L, 328249L, 328271L,
-328277L, 328283L, 328291L, 328303L, 328327L, 328331L, 328333L, 328343L, 328357L,
-328373L, 328379L, 328381L, 328397L, 328411L, 328421L, 328429L, 328439L, 328481L,
-328511L, 328513L, 328519L, 328543L, 328579L, 328589L, 328591L, 328619L, 328621L,
-328633L, 328637L, 328639L, 328651L, 328667L, 328687L, 328709L, 328721L, 328753L,
-328777L, 328781L, 328787L, 328789L, 328813L, 328829L, 328837L, 328847L, 328849L,
-328883L, 328891L, 328897L, 328901L, 328919L, 328921L, 328931L, 328961L, 328981L,
-329009L, 329027L, 329053L, 329059L, 329081L, 329083L, 329089L, 329101L, 329111L,
-329123L, 329143L, 329167L, 329177L, 329191L, 329201L, 329207L, 329209L, 329233L,
-329243L, 329257L, 329267L, 329269L, 329281L, 329293L, 329297L, 329299L, 329309L,
-329317L, 329321L, 329333L, 329347L, 329387L, 329393L, 329401L, 329419L, 329431L,
-329471L, 329473L, 329489L, 329503L, 329519L, 329533L, 329551L, 329557L, 329587L,
-329591L, 329597L, 329603L, 329617L, 329627L, 329629L, 329639L, 329657L, 329663L,
-329671L, 329677L, 329683L, 329687L, 329711L, 329717L, 329723L, 329729L, 329761L,
-329773L, 329779L, 329789L, 329801L, 329803L, 329863L, 329867L, 329873L, 329891L,
-329899L, 329941L, 329947L, 329951L, 329957L, 329969L, 329977L, 329993L, 329999L,
-330017L, 330019L, 330037L, 330041L, 330047L, 330053L, 330061L, 330067L, 330097L,
-330103L, 330131L, 330133L, 330139L, 330149L, 330167L, 330199L, 330203L, 330217L,
-330227L, 330229L, 330233L, 330241L, 330247L, 330271L, 330287L, 330289L, 330311L,
-330313L, 330329L, 330331L, 330347L, 330359L, 330383L, 330389L, 330409L, 330413L,
-330427L, 330431L, 330433L, 330439L, 330469L, 330509L, 330557L, 330563L, 330569L,
-330587L, 330607L, 330611L, 330623L, 330641L, 330643L, 330653L, 330661L, 330679L,
-330683L, 330689L, 330697L, 330703L, 330719L, 330721L, 330731L, 330749L, 330767L,
-330787L, 330791L, 330793L, 330821L, 330823L, 330839L, 330853L, 330857L, 330859L,
-330877L, 330887L, 330899L, 330907L, 330917L, 330943L, 330983L, 330997L, 331013L,
-331027L, 331031L, 331043L, 331063L, 331081L, 331099L, 331127L, 331141L, 331147L,
-331153L, 331159L, 331171L, 331183L, 331207L, 331213L, 331217L, 331231L, 331241L,
-331249L, 331259L, 331277L, 331283L, 331301L, 331307L, 331319L, 331333L, 331337L,
-331339L, 331349L, 331367L, 331369L, 331391L, 331399L, 331423L, 331447L, 331451L,
-331489L, 331501L, 331511L, 331519L, 331523L, 331537L, 331543L, 331547L, 331549L,
-331553L, 331577L, 331579L, 331589L, 331603L, 331609L, 331613L, 331651L, 331663L,
-331691L, 331693L, 331697L, 331711L, 331739L, 331753L, 331769L, 331777L, 331781L,
-331801L, 331819L, 331841L, 331843L, 331871L, 331883L, 331889L, 331897L, 331907L,
-331909L, 331921L, 331937L, 331943L, 331957L, 331967L, 331973L, 331997L, 331999L,
-332009L, 332011L, 332039L, 332053L, 332069L, 332081L, 332099L, 332113L, 332117L,
-332147L, 332159L, 332161L, 332179L, 332183L, 332191L, 332201L, 332203L, 332207L,
-332219L, 332221L, 332251L, 332263L, 332273L, 332287L, 332303L, 332309L, 332317L,
-332393L, 332399L, 332411L, 332417L, 332441L, 332447L, 332461L, 332467L, 332471L,
-332473L, 332477L, 332489L, 332509L, 332513L, 332561L, 332567L, 332569L, 332573L,
-332611L, 332617L, 332623L, 332641L, 332687L, 332699L, 332711L, 332729L, 332743L,
-332749L, 332767L, 332779L, 332791L, 332803L, 332837L, 332851L, 332873L, 332881L,
-332887L, 332903L, 332921L, 332933L, 332947L, 332951L, 332987L, 332989L, 332993L,
-333019L, 333023L, 333029L, 333031L, 333041L, 333049L, 333071L, 333097L, 333101L,
-333103L, 333107L, 333131L, 333139L, 333161L, 333187L, 333197L, 333209L, 333227L,
-333233L, 333253L, 333269L, 333271L, 333283L, 333287L, 333299L, 333323L, 333331L,
-333337L, 333341L, 333349L, 333367L, 333383L, 333397L, 333419L, 333427L, 333433L,
-333439L, 333449L, 333451L, 333457L, 333479L, 333491L, 333493L, 333497L, 333503L,
-333517L, 333533L, 333539L, 333563L, 333581L, 333589L, 333623L, 333631L, 333647L,
-333667L, 333673L, 333679L, 333691L, 333701L, 333713L, 333719L, 333721L, 333737L,
-333757L, 333769L, 333779L, 333787L, 333791L, 333793L, 333803L, 333821L, 333857L,
-333871L, 333911L, 333923L, 333929L, 333941L, 333959L, 333973L, 333989L, 333997L,
-334021L, 334031L, 334043L, 334049L, 334057L, 334069L, 334093L, 334099L, 334127L,
-334133L, 334157L, 334171L, 334177L, 334183L, 334189L, 334199L, 334231L, 334247L,
-334261L, 334289L, 334297L, 334319L, 334331L, 334333L, 334349L, 334363L, 334379L,
-334387L, 334393L, 334403L, 334421L, 334423L, 334427L, 334429L, 334447L, 334487L,
-334493L, 334507L, 334511L, 334513L, 334541L, 334547L, 334549L, 334561L, 334603L,
-334619L, 334637L, 334643L, 334651L, 334661L, 334667L, 334681L, 334693L, 334699L,
-334717L, 334721L, 334727L, 334751L, 334753L, 334759L, 334771L, 334777L, 334783L,
-334787L, 334793L, 334843L, 334861L, 334877L, 334889L, 334891L, 334897L, 334931L,
-334963L, 334973L, 334987L, 334991L, 334993L, 335009L, 335021L, 335029L, 335033L,
-335047L, 335051L, 335057L, 335077L, 335081L, 335089L, 335107L, 335113L, 335117L,
-335123L, 335131L, 335149L, 335161L, 335171L, 335173L, 335207L, 335213L, 335221L,
-335249L, 335261L, 335273L, 335281L, 335299L, 335323L, 335341L, 335347L, 335381L,
-335383L, 335411L, 335417L, 335429L, 335449L, 335453L, 335459L, 335473L, 335477L,
-335507L, 335519L, 335527L, 335539L, 335557L, 335567L, 335579L, 335591L, 335609L,
-335633L, 335641L, 335653L, 335663L, 335669L, 335681L, 335689L, 335693L, 335719L,
-335729L, 335743L, 335747L, 335771L, 335807L, 335809L, 335813L, 335821L, 335833L,
-335843L, 335857L, 335879L, 335893L, 335897L, 335917L, 335941L, 335953L, 335957L,
-335999L, 336029L, 336031L, 336041L, 336059L, 336079L, 336101L, 336103L, 336109L,
-336113L, 336121L, 336143L, 336151L, 336157L, 336163L, 336181L, 336199L, 336211L,
-336221L, 336223L, 336227L, 336239L, 336247L, 336251L, 336253L, 336263L, 336307L,
-336317L, 336353L, 336361L, 336373L, 336397L, 336403L, 336419L, 336437L, 336463L,
-336491L, 336499L, 336503L, 336521L, 336527L, 336529L, 336533L, 336551L, 336563L,
-336571L, 336577L, 336587L, 336593L, 336599L, 336613L, 336631L, 336643L, 336649L,
-336653L, 336667L, 336671L, 336683L, 336689L, 336703L, 336727L, 336757L, 336761L,
-336767L, 336769L, 336773L, 336793L, 336799L, 336803L, 336823L, 336827L, 336829L,
-336857L, 336863L, 336871L, 336887L, 336899L, 336901L, 336911L, 336929L, 336961L,
-336977L, 336983L, 336989L, 336997L, 337013L, 337021L, 337031L, 337039L, 337049L,
-337069L, 337081L, 337091L, 337097L, 337121L, 337153L, 337189L, 337201L, 337213L,
-337217L, 337219L, 337223L, 337261L, 337277L, 337279L, 337283L, 337291L, 337301L,
-337313L, 337327L, 337339L, 337343L, 337349L, 337361L, 337367L, 337369L, 337397L,
-337411L, 337427L, 337453L, 337457L, 337487L, 337489L, 337511L, 337517L, 337529L,
-337537L, 337541L, 337543L, 337583L, 337607L, 337609L, 337627L, 337633L, 337639L,
-337651L, 337661L, 337669L, 337681L, 337691L, 337697L, 337721L, 337741L, 337751L,
-337759L, 337781L, 337793L, 337817L, 337837L, 337853L, 337859L, 337861L, 337867L,
-337871L, 337873L, 337891L, 337901L, 337903L, 337907L, 337919L, 337949L, 337957L,
-337969L, 337973L, 337999L, 338017L, 338027L, 338033L, 338119L, 338137L, 338141L,
-338153L, 338159L, 338161L, 338167L, 338171L, 338183L, 338197L, 338203L, 338207L,
-338213L, 338231L, 338237L, 338251L, 338263L, 338267L, 338269L, 338279L, 338287L,
-338293L, 338297L, 338309L, 338321L, 338323L, 338339L, 338341L, 338347L, 338369L,
-338383L, 338389L, 338407L, 338411L, 338413L, 338423L, 338431L, 338449L, 338461L,
-338473L, 338477L, 338497L, 338531L, 338543L, 338563L, 338567L, 338573L, 338579L,
-338581L, 338609L, 338659L, 338669L, 338683L, 338687L, 338707L, 338717L, 338731L,
-338747L, 338753L, 338761L, 338773L, 338777L, 338791L, 338803L, 338839L, 338851L,
-338857L, 338867L, 338893L, 338909L, 338927L, 338959L, 338993L, 338999L, 339023L,
-339049L, 339067L, 339071L, 339091L, 339103L, 339107L, 339121L, 339127L, 339137L,
-339139L, 339151L, 339161L, 339173L, 339187L, 339211L, 339223L, 339239L, 339247L,
-339257L, 339263L, 339289L, 339307L, 339323L, 339331L, 339341L, 339373L, 339389L,
-339413L, 339433L, 339467L, 339491L, 339517L, 339527L, 339539L, 339557L, 339583L,
-339589L, 339601L, 339613L, 339617L, 339631L, 339637L, 339649L, 339653L, 339659L,
-339671L, 339673L, 339679L, 339707L, 339727L, 339749L, 339751L, 339761L, 339769L,
-339799L, 339811L, 339817L, 339821L, 339827L, 339839L, 339841L, 339863L, 339887L,
-339907L, 339943L, 339959L, 339991L, 340007L, 340027L, 340031L, 340037L, 340049L,
-340057L, 340061L, 340063L, 340073L, 340079L, 340103L, 340111L, 340117L, 340121L,
-340127L, 340129L, 340169L, 340183L, 340201L, 340211L, 340237L, 340261L, 340267L,
-340283L, 340297L, 340321L, 340337L, 340339L, 340369L, 340381L, 340387L, 340393L,
-340397L, 340409L, 340429L, 340447L, 340451L, 340453L, 340477L, 340481L, 340519L,
-340541L, 340559L, 340573L, 340577L, 340579L, 340583L, 340591L, 340601L, 340619L,
-340633L, 340643L, 340649L, 340657L, 340661L, 340687L, 340693L, 340709L, 340723L,
-340757L, 340777L, 340787L, 340789L, 340793L, 340801L, 340811L, 340819L, 340849L,
-340859L, 340877L, 340889L, 340897L, 340903L, 340909L, 340913L, 340919L, 340927L,
-340931L, 340933L, 340937L, 340939L, 340957L, 340979L, 340999L, 341017L, 341027L,
-341041L, 341057L, 341059L, 341063L, 341083L, 341087L, 341123L, 341141L, 341171L,
-341179L, 341191L, 341203L, 341219L, 341227L, 341233L, 341269L, 341273L, 341281L,
-341287L, 341293L, 341303L, 341311L, 341321L, 341323L, 341333L, 341339L, 341347L,
-341357L, 341423L, 341443L, 341447L, 341459L, 341461L, 341477L, 341491L, 341501L,
-341507L, 341521L, 341543L, 341557L, 341569L, 341587L, 341597L, 341603L, 341617L,
-341623L, 341629L, 341641L, 341647L, 341659L, 341681L, 341687L, 341701L, 341729L,
-341743L, 341749L, 341771L, 341773L, 341777L, 341813L, 341821L, 341827L, 341839L,
-341851L, 341863L, 341879L, 341911L, 341927L, 341947L, 341951L, 341953L, 341959L,
-341963L, 341983L, 341993L, 342037L, 342047L, 342049L, 342059L, 342061L, 342071L,
-342073L, 342077L, 342101L, 342107L, 342131L, 342143L, 342179L, 342187L, 342191L,
-342197L, 342203L, 342211L, 342233L, 342239L, 342241L, 342257L, 342281L, 342283L,
-342299L, 342319L, 342337L, 342341L, 342343L, 342347L, 342359L, 342371L, 342373L,
-342379L, 342389L, 342413L, 342421L, 342449L, 342451L, 342467L, 342469L, 342481L,
-342497L, 342521L, 342527L, 342547L, 342553L, 342569L, 342593L, 342599L, 342607L,
-342647L, 342653L, 342659L, 342673L, 342679L, 342691L, 342697L, 342733L, 342757L,
-342761L, 342791L, 342799L, 342803L, 342821L, 342833L, 342841L, 342847L, 342863L,
-342869L, 342871L, 342889L, 342899L, 342929L, 342949L, 342971L, 342989L, 343019L,
-343037L, 343051L, 343061L, 343073L, 343081L, 343087L, 343127L, 343141L, 343153L,
-343163L, 343169L, 343177L, 343193L, 343199L, 343219L, 343237L, 343243L, 343253L,
-343261L, 343267L, 343289L, 343303L, 343307L, 343309L, 343313L, 343327L, 343333L,
-343337L, 343373L, 343379L, 343381L, 343391L, 343393L, 343411L, 343423L, 343433L,
-343481L, 343489L, 343517L, 343529L, 343531L, 343543L, 343547L, 343559L, 343561L,
-343579L, 343583L, 343589L, 343591L, 343601L, 343627L, 343631L, 343639L, 343649L,
-343661L, 343667L, 343687L, 343709L, 343727L, 343769L, 343771L, 343787L, 343799L,
-343801L, 343813L, 343817L, 343823L, 343829L, 343831L, 343891L, 343897L, 343901L,
-343913L, 343933L, 343939L, 343943L, 343951L, 343963L, 343997L, 344017L, 344021L,
-344039L, 344053L, 344083L, 344111L, 344117L, 344153L, 344161L, 344167L, 344171L,
-344173L, 344177L, 344189L, 344207L, 344209L, 344213L, 344221L, 344231L, 344237L,
-344243L, 344249L, 344251L, 344257L, 344263L, 344269L, 344273L, 344291L, 344293L,
-344321L, 344327L, 344347L, 344353L, 344363L, 344371L, 344417L, 344423L, 344429L,
-344453L, 344479L, 344483L, 344497L, 344543L, 344567L, 344587L, 344599L, 344611L,
-344621L, 344629L, 344639L, 344653L, 344671L, 344681L, 344683L, 344693L, 344719L,
-344749L, 344753L, 344759L, 344791L, 344797L, 344801L, 344807L, 344819L, 344821L,
-344843L, 344857L, 344863L, 344873L, 344887L, 344893L, 344909L, 344917L, 344921L,
-344941L, 344957L, 344959L, 344963L, 344969L, 344987L, 345001L, 345011L, 345017L,
-345019L, 345041L, 345047L, 345067L, 345089L, 345109L, 345133L, 345139L, 345143L,
-345181L, 345193L, 345221L, 345227L, 345229L, 345259L, 345263L, 345271L, 345307L,
-345311L, 345329L, 345379L, 345413L, 345431L, 345451L, 345461L, 345463L, 345473L,
-345479L, 345487L, 345511L, 345517L, 345533L, 345547L, 345551L, 345571L, 345577L,
-345581L, 345599L, 345601L, 345607L, 345637L, 345643L, 345647L, 345659L, 345673L,
-345679L, 345689L, 345701L, 345707L, 345727L, 345731L, 345733L, 345739L, 345749L,
-345757L, 345769L, 345773L, 345791L, 345803L, 345811L, 345817L, 345823L, 345853L,
-345869L, 345881L, 345887L, 345889L, 345907L, 345923L, 345937L, 345953L, 345979L,
-345997L, 346013L, 346039L, 346043L, 346051L, 346079L, 346091L, 346097L, 346111L,
-346117L, 346133L, 346139L, 346141L, 346147L, 346169L, 346187L, 346201L, 346207L,
-346217L, 346223L, 346259L, 346261L, 346277L, 346303L, 346309L, 346321L, 346331L,
-346337L, 346349L, 346361L, 346369L, 346373L, 346391L, 346393L, 346397L, 346399L,
-346417L, 346421L, 346429L, 346433L, 346439L, 346441L, 346447L, 346453L, 346469L,
-346501L, 346529L, 346543L, 346547L, 346553L, 346559L, 346561L, 346589L, 346601L,
-346607L, 346627L, 346639L, 346649L, 346651L, 346657L, 346667L, 346669L, 346699L,
-346711L, 346721L, 346739L, 346751L, 346763L, 346793L, 346831L, 346849L, 346867L,
-346873L, 346877L, 346891L, 346903L, 346933L, 346939L, 346943L, 346961L, 346963L,
-347003L, 347033L, 347041L, 347051L, 347057L, 347059L, 347063L, 347069L, 347071L,
-347099L, 347129L, 347131L, 347141L, 347143L, 347161L, 347167L, 347173L, 347177L,
-347183L, 347197L, 347201L, 347209L, 347227L, 347233L, 347239L, 347251L, 347257L,
-347287L, 347297L, 347299L, 347317L, 347329L, 347341L, 347359L, 347401L, 347411L,
-347437L, 347443L, 347489L, 347509L, 347513L, 347519L, 347533L, 347539L, 347561L,
-347563L, 347579L, 347587L, 347591L, 347609L, 347621L, 347629L, 347651L, 347671L,
-347707L, 347717L, 347729L, 347731L, 347747L, 347759L, 347771L, 347773L, 347779L,
-347801L, 347813L, 347821L, 347849L, 347873L, 347887L, 347891L, 347899L, 347929L,
-347933L, 347951L, 347957L, 347959L, 347969L, 347981L, 347983L, 347987L, 347989L,
-347993L, 348001L, 348011L, 348017L, 348031L, 348043L, 348053L, 348077L, 348083L,
-348097L, 348149L, 348163L, 348181L, 348191L, 348209L, 348217L, 348221L, 348239L,
-348241L, 348247L, 348253L, 348259L, 348269L, 348287L, 348307L, 348323L, 348353L,
-348367L, 348389L, 348401L, 348407L, 348419L, 348421L, 348431L, 348433L, 348437L,
-348443L, 348451L, 348457L, 348461L, 348463L, 348487L, 348527L, 348547L, 348553L,
-348559L, 348563L, 348571L, 348583L, 348587L, 348617L, 348629L, 348637L, 348643L,
-348661L, 348671L, 348709L, 348731L, 348739L, 348757L, 348763L, 348769L, 348779L,
-348811L, 348827L, 348833L, 348839L, 348851L, 348883L, 348889L, 348911L, 348917L,
-348919L, 348923L, 348937L, 348949L, 348989L, 348991L, 349007L, 349039L, 349043L,
-349051L, 349079L, 349081L, 349093L, 349099L, 349109L, 349121L, 349133L, 349171L,
-349177L, 349183L, 349187L, 349199L, 349207L, 349211L, 349241L, 349291L, 349303L,
-349313L, 349331L, 349337L, 349343L, 349357L, 349369L, 349373L, 349379L, 349381L,
-349387L, 349397L, 349399L, 349403L, 349409L, 349411L, 349423L, 349471L, 349477L,
-349483L, 349493L, 349499L, 349507L, 349519L, 349529L, 349553L, 349567L, 349579L,
-349589L, 349603L, 349637L, 349663L, 349667L, 349697L, 349709L, 349717L, 349729L,
-349753L, 349759L, 349787L, 349793L, 349801L, 349813L, 349819L, 349829L, 349831L,
-349837L, 349841L, 349849L, 349871L, 349903L, 349907L, 349913L, 349919L, 349927L,
-349931L, 349933L, 349939L, 349949L, 349963L, 349967L, 349981L, 350003L, 350029L,
-350033L, 350039L, 350087L, 350089L, 350093L, 350107L, 350111L, 350137L, 350159L,
-350179L, 350191L, 350213L, 350219L, 350237L, 350249L, 350257L, 350281L, 350293L,
-350347L, 350351L, 350377L, 350381L, 350411L, 350423L, 350429L, 350431L, 350437L,
-350443L, 350447L, 350453L, 350459L, 350503L, 350521L, 350549L, 350561L, 350563L,
-350587L, 350593L, 350617L, 350621L, 350629L, 350657L, 350663L, 350677L, 350699L,
-350711L, 350719L, 350729L, 350731L, 350737L, 350741L, 350747L, 350767L, 350771L,
-350783L, 350789L, 350803L, 350809L, 350843L, 350851L, 350869L, 350881L, 350887L,
-350891L, 350899L, 350941L, 350947L, 350963L, 350971L, 350981L, 350983L, 350989L,
-351011L, 351023L, 351031L, 351037L, 351041L, 351047L, 351053L, 351059L, 351061L,
-351077L, 351079L, 351097L, 351121L, 351133L, 351151L, 351157L, 351179L, 351217L,
-351223L, 351229L, 351257L, 351259L, 351269L, 351287L, 351289L, 351293L, 351301L,
-351311L, 351341L, 351343L, 351347L, 351359L, 351361L, 351383L, 351391L, 351397L,
-351401L, 351413L, 351427L, 351437L, 351457L, 351469L, 351479L, 351497L, 351503L,
-351517L, 351529L, 351551L, 351563L, 351587L, 351599L, 351643L, 351653L, 351661L,
-351667L, 351691L, 351707L, 351727L, 351731L, 351733L, 351749L, 351751L, 351763L,
-351773L, 351779L, 351797L, 351803L, 351811L, 351829L, 351847L, 351851L, 351859L,
-351863L, 351887L, 351913L, 351919L, 351929L, 351931L, 351959L, 351971L, 351991L,
-352007L, 352021L, 352043L, 352049L, 352057L, 352069L, 352073L, 352081L, 352097L,
-352109L, 352111L, 352123L, 352133L, 352181L, 352193L, 352201L, 352217L, 352229L,
-352237L, 352249L, 352267L, 352271L, 352273L, 352301L, 352309L, 352327L, 352333L,
-352349L, 352357L, 352361L, 352367L, 352369L, 352381L, 352399L, 352403L, 352409L,
-352411L, 352421L, 352423L, 352441L, 352459L, 352463L, 352481L, 352483L, 352489L,
-352493L, 352511L, 352523L, 352543L, 352549L, 352579L, 352589L, 352601L, 352607L,
-352619L, 352633L, 352637L, 352661L, 352691L, 352711L, 352739L, 352741L, 352753L,
-352757L, 352771L, 352813L, 352817L, 352819L, 352831L, 352837L, 352841L, 352853L,
-352867L, 352883L, 352907L, 352909L, 352931L, 352939L, 352949L, 352951L, 352973L,
-352991L, 353011L, 353021L, 353047L, 353053L, 353057L, 353069L, 353081L, 353099L,
-353117L, 353123L, 353137L, 353147L, 353149L, 353161L, 353173L, 353179L, 353201L,
-353203L, 353237L, 353263L, 353293L, 353317L, 353321L, 353329L, 353333L, 353341L,
-353359L, 353389L, 353401L, 353411L, 353429L, 353443L, 353453L, 353459L, 353471L,
-353473L, 353489L, 353501L, 353527L, 353531L, 353557L, 353567L, 353603L, 353611L,
-353621L, 353627L, 353629L, 353641L, 353653L, 353657L, 353677L, 353681L, 353687L,
-353699L, 353711L, 353737L, 353747L, 353767L, 353777L, 353783L, 353797L, 353807L,
-353813L, 353819L, 353833L, 353867L, 353869L, 353879L, 353891L, 353897L, 353911L,
-353917L, 353921L, 353929L, 353939L, 353963L, 354001L, 354007L, 354017L, 354023L,
-354031L, 354037L, 354041L, 354043L, 354047L, 354073L, 354091L, 354097L, 354121L,
-354139L, 354143L, 354149L, 354163L, 354169L, 354181L, 354209L, 354247L, 354251L,
-354253L, 354257L, 354259L, 354271L, 354301L, 354307L, 354313L, 354317L, 354323L,
-354329L, 354337L, 354353L, 354371L, 354373L, 354377L, 354383L, 354391L, 354401L,
-354421L, 354439L, 354443L, 354451L, 354461L, 354463L, 354469L, 354479L, 354533L,
-354539L, 354551L, 354553L, 354581L, 354587L, 354619L, 354643L, 354647L, 354661L,
-354667L, 354677L, 354689L, 354701L, 354703L, 354727L, 354737L, 354743L, 354751L,
-354763L, 354779L, 354791L, 354799L, 354829L, 354833L, 354839L, 354847L, 354869L,
-354877L, 354881L, 354883L, 354911L, 354953L, 354961L, 354971L, 354973L, 354979L,
-354983L, 354997L, 355007L, 355009L, 355027L, 355031L, 355037L, 355039L, 355049L,
-355057L, 355063L, 355073L, 355087L, 355093L, 355099L, 355109L, 355111L, 355127L,
-355139L, 355171L, 355193L, 355211L, 355261L, 355297L, 355307L, 355321L, 355331L,
-355339L, 355343L, 355361L, 355363L, 355379L, 355417L, 355427L, 355441L, 355457L,
-355463L, 355483L, 355499L, 355501L, 355507L, 355513L, 355517L, 355519L, 355529L,
-355541L, 355549L, 355559L, 355571L, 355573L, 355591L, 355609L, 355633L, 355643L,
-355651L, 355669L, 355679L, 355697L, 355717L, 355721L, 355723L, 355753L, 355763L,
-355777L, 355783L, 355799L, 355811L, 355819L, 355841L, 355847L, 355853L, 355867L,
-355891L, 355909L, 355913L, 355933L, 355937L, 355939L, 355951L, 355967L, 355969L,
-356023L, 356039L, 356077L, 356093L, 356101L, 356113L, 356123L, 356129L, 356137L,
-356141L, 356143L, 356171L, 356173L, 356197L, 356219L, 356243L, 356261L, 356263L,
-356287L, 356299L, 356311L, 356327L, 356333L, 356351L, 356387L, 356399L, 356441L,
-356443L, 356449L, 356453L, 356467L, 356479L, 356501L, 356509L, 356533L, 356549L,
-356561L, 356563L, 356567L, 356579L, 356591L, 356621L, 356647L, 356663L, 356693L,
-356701L, 356731L, 356737L, 356749L, 356761L, 356803L, 356819L, 356821L, 356831L,
-356869L, 356887L, 356893L, 356927L, 356929L, 356933L, 356947L, 356959L, 356969L,
-356977L, 356981L, 356989L, 356999L, 357031L, 357047L, 357073L, 357079L, 357083L,
-357103L, 357107L, 357109L, 357131L, 357139L, 357169L, 357179L, 357197L, 357199L,
-357211L, 357229L, 357239L, 357241L, 357263L, 357271L, 357281L, 357283L, 357293L,
-357319L, 357347L, 357349L, 357353L, 357359L, 357377L, 357389L, 357421L, 357431L,
-357437L, 357473L, 357503L, 357509L, 357517L, 357551L, 357559L, 357563L, 357569L,
-357571L, 357583L, 357587L, 357593L, 357611L, 357613L, 357619L, 357649L, 357653L,
-357659L, 357661L, 357667L, 357671L, 357677L, 357683L, 357689L, 357703L, 357727L,
-357733L, 357737L, 357739L, 357767L, 357779L, 357781L, 357787L, 357793L, 357809L,
-357817L, 357823L, 357829L, 357839L, 357859L, 357883L, 357913L, 357967L, 357977L,
-357983L, 357989L, 357997L, 358031L, 358051L, 358069L, 358073L, 358079L, 358103L,
-358109L, 358153L, 358157L, 358159L, 358181L, 358201L, 358213L, 358219L, 358223L,
-358229L, 358243L, 358273L, 358277L, 358279L, 358289L, 358291L, 358297L, 358301L,
-358313L, 358327L, 358331L, 358349L, 358373L, 358417L, 358427L, 358429L, 358441L,
-358447L, 358459L, 358471L, 358483L, 358487L, 358499L, 358531L, 358541L, 358571L,
-358573L, 358591L, 358597L, 358601L, 358607L, 358613L, 358637L, 358667L, 358669L,
-358681L, 358691L, 358697L, 358703L, 358711L, 358723L, 358727L, 358733L, 358747L,
-358753L, 358769L, 358783L, 358793L, 358811L, 358829L, 358847L, 358859L, 358861L,
-358867L, 358877L, 358879L, 358901L, 358903L, 358907L, 358909L, 358931L, 358951L,
-358973L, 358979L, 358987L, 358993L, 358999L, 359003L, 359017L, 359027L, 359041L,
-359063L, 359069L, 359101L, 359111L, 359129L, 359137L, 359143L, 359147L, 359153L,
-359167L, 359171L, 359207L, 359209L, 359231L, 359243L, 359263L, 359267L, 359279L,
-359291L, 359297L, 359299L, 359311L, 359323L, 359327L, 359353L, 359357L, 359377L,
-359389L, 359407L, 359417L, 359419L, 359441L, 359449L, 359477L, 359479L, 359483L,
-359501L, 359509L, 359539L, 359549L, 359561L, 359563L, 359581L, 359587L, 359599L,
-359621L, 359633L, 359641L, 359657L, 359663L, 359701L, 359713L, 359719L, 359731L,
-359747L, 359753L, 359761L, 359767L, 359783L, 359837L, 359851L, 359869L, 359897L,
-359911L, 359929L, 359981L, 359987L, 360007L, 360023L, 360037L, 360049L, 360053L,
-360071L, 360089L, 360091L, 360163L, 360167L, 360169L, 360181L, 360187L, 360193L,
-360197L, 360223L, 360229L, 360233L, 360257L, 360271L, 360277L, 360287L, 360289L,
-360293L, 360307L, 360317L, 360323L, 360337L, 360391L, 360407L, 360421L, 360439L,
-360457L, 360461L, 360497L, 360509L, 360511L, 360541L, 360551L, 360589L, 360593L,
-360611L, 360637L, 360649L, 360653L, 360749L, 360769L, 360779L, 360781L, 360803L,
-360817L, 360821L, 360823L, 360827L, 360851L, 360853L, 360863L, 360869L, 360901L,
-360907L, 360947L, 360949L, 360953L, 360959L, 360973L, 360977L, 360979L, 360989L,
-361001L, 361003L, 361013L, 361033L, 361069L, 361091L, 361093L, 361111L, 361159L,
-361183L, 361211L, 361213L, 361217L, 361219L, 361223L, 361237L, 361241L, 361271L,
-361279L, 361313L, 361321L, 361327L, 361337L, 361349L, 361351L, 361357L, 361363L,
-361373L, 361409L, 361411L, 361421L, 361433L, 361441L, 361447L, 361451L, 361463L,
-361469L, 361481L, 361499L, 361507L, 361511L, 361523L, 361531L, 361541L, 361549L,
-361561L, 361577L, 361637L, 361643L, 361649L, 361651L, 361663L, 361679L, 361687L,
-361723L, 361727L, 361747L, 361763L, 361769L, 361787L, 361789L, 361793L, 361799L,
-361807L, 361843L, 361871L, 361873L, 361877L, 361901L, 361903L, 361909L, 361919L,
-361927L, 361943L, 361961L, 361967L, 361973L, 361979L, 361993L, 362003L, 362027L,
-362051L, 362053L, 362059L, 362069L, 362081L, 362093L, 362099L, 362107L, 362137L,
-362143L, 362147L, 362161L, 362177L, 362191L, 362203L, 362213L, 362221L, 362233L,
-362237L, 362281L, 362291L, 362293L, 362303L, 362309L, 362333L, 362339L, 362347L,
-362353L, 362357L, 362363L, 362371L, 362377L, 362381L, 362393L, 362407L, 362419L,
-362429L, 362431L, 362443L, 362449L, 362459L, 362473L, 362521L, 362561L, 362569L,
-362581L, 362599L, 362629L, 362633L, 362657L, 362693L, 362707L, 362717L, 362723L,
-362741L, 362743L, 362749L, 362753L, 362759L, 362801L, 362851L, 362863L, 362867L,
-362897L, 362903L, 362911L, 362927L, 362941L, 362951L, 362953L, 362969L, 362977L,
-362983L, 362987L, 363017L, 363019L, 363037L, 363043L, 363047L, 363059L, 363061L,
-363067L, 363119L, 363149L, 363151L, 363157L, 363161L, 363173L, 363179L, 363199L,
-363211L, 363217L, 363257L, 363269L, 363271L, 363277L, 363313L, 363317L, 363329L,
-363343L, 363359L, 363361L, 363367L, 363371L, 363373L, 363379L, 363397L, 363401L,
-363403L, 363431L, 363437L, 363439L, 363463L, 363481L, 363491L, 363497L, 363523L,
-363529L, 363533L, 363541L, 363551L, 363557L, 363563L, 363569L, 363577L, 363581L,
-363589L, 363611L, 363619L, 363659L, 363677L, 363683L, 363691L, 363719L, 363731L,
-363751L, 363757L, 363761L, 363767L, 363773L, 363799L, 363809L, 363829L, 363833L,
-363841L, 363871L, 363887L, 363889L, 363901L, 363911L, 363917L, 363941L, 363947L,
-363949L, 363959L, 363967L, 363977L, 363989L, 364027L, 364031L, 364069L, 364073L,
-364079L, 364103L, 364127L, 364129L, 364141L, 364171L, 364183L, 364187L, 364193L,
-364213L, 364223L, 364241L, 364267L, 364271L, 364289L, 364291L, 364303L, 364313L,
-364321L, 364333L, 364337L, 364349L, 364373L, 364379L, 364393L, 364411L, 364417L,
-364423L, 364433L, 364447L, 364451L, 364459L, 364471L, 364499L, 364513L, 364523L,
-364537L, 364541L, 364543L, 364571L, 364583L, 364601L, 364607L, 364621L, 364627L,
-364643L, 364657L, 364669L, 364687L, 364691L, 364699L, 364717L, 364739L, 364747L,
-364751L, 364753L, 364759L, 364801L, 364829L, 364853L, 364873L, 364879L, 364883L,
-364891L, 364909L, 364919L, 364921L, 364937L, 364943L, 364961L, 364979L, 364993L,
-364997L, 365003L, 365017L, 365021L, 365039L, 365063L, 365069L, 365089L, 365107L,
-365119L, 365129L, 365137L, 365147L, 365159L, 365173L, 365179L, 365201L, 365213L,
-365231L, 365249L, 365251L, 365257L, 365291L, 365293L, 365297L, 365303L, 365327L,
-365333L, 365357L, 365369L, 365377L, 365411L, 365413L, 365419L, 365423L, 365441L,
-365461L, 365467L, 365471L, 365473L, 365479L, 365489L, 365507L, 365509L, 365513L,
-365527L, 365531L, 365537L, 365557L, 365567L, 365569L, 365587L, 365591L, 365611L,
-365627L, 365639L, 365641L, 365669L, 365683L, 365689L, 365699L, 365747L, 365749L,
-365759L, 365773L, 365779L, 365791L, 365797L, 365809L, 365837L, 365839L, 365851L,
-365903L, 365929L, 365933L, 365941L, 365969L, 365983L, 366001L, 366013L, 366019L,
-366029L, 366031L, 366053L, 366077L, 366097L, 366103L, 366127L, 366133L, 366139L,
-366161L, 366167L, 366169L, 366173L, 366181L, 366193L, 366199L, 366211L, 366217L,
-366221L, 366227L, 366239L, 366259L, 366269L, 366277L, 366287L, 366293L, 366307L,
-366313L, 366329L, 366341L, 366343L, 366347L, 366383L, 366397L, 366409L, 366419L,
-366433L, 366437L, 366439L, 366461L, 366463L, 366467L, 366479L, 366497L, 366511L,
-366517L, 366521L, 366547L, 366593L, 366599L, 366607L, 366631L, 366677L, 366683L,
-366697L, 366701L, 366703L, 366713L, 366721L, 366727L, 366733L, 366787L, 366791L,
-366811L, 366829L, 366841L, 366851L, 366853L, 366859L, 366869L, 366881L, 366889L,
-366901L, 366907L, 366917L, 366923L, 366941L, 366953L, 366967L, 366973L, 366983L,
-366997L, 367001L, 367007L, 367019L, 367021L, 367027L, 367033L, 367049L, 367069L,
-367097L, 367121L, 367123L, 367127L, 367139L, 367163L, 367181L, 367189L, 367201L,
-367207L, 367219L, 367229L, 367231L, 367243L, 367259L, 367261L, 367273L, 367277L,
-367307L, 367309L, 367313L, 367321L, 367357L, 367369L, 367391L, 367397L, 367427L,
-367453L, 367457L, 367469L, 367501L, 367519L, 367531L, 367541L, 367547L, 367559L,
-367561L, 367573L, 367597L, 367603L, 367613L, 367621L, 367637L, 367649L, 367651L,
-367663L, 367673L, 367687L, 367699L, 367711L, 367721L, 367733L, 367739L, 367751L,
-367771L, 367777L, 367781L, 367789L, 367819L, 367823L, 367831L, 367841L, 367849L,
-367853L, 367867L, 367879L, 367883L, 367889L, 367909L, 367949L, 367957L, 368021L,
-368029L, 368047L, 368059L, 368077L, 368083L, 368089L, 368099L, 368107L, 368111L,
-368117L, 368129L, 368141L, 368149L, 368153L, 368171L, 368189L, 368197L, 368227L,
-368231L, 368233L, 368243L, 368273L, 368279L, 368287L, 368293L, 368323L, 368327L,
-368359L, 368363L, 368369L, 368399L, 368411L, 368443L, 368447L, 368453L, 368471L,
-368491L, 368507L, 368513L, 368521L, 368531L, 368539L, 368551L, 368579L, 368593L,
-368597L, 368609L, 368633L, 368647L, 368651L, 368653L, 368689L, 368717L, 368729L,
-368737L, 368743L, 368773L, 368783L, 368789L, 368791L, 368801L, 368803L, 368833L,
-368857L, 368873L, 368881L, 368899L, 368911L, 368939L, 368947L, 368957L, 369007L,
-369013L, 369023L, 369029L, 369067L, 369071L, 369077L, 369079L, 369097L, 369119L,
-369133L, 369137L, 369143L, 369169L, 369181L, 369191L, 369197L, 369211L, 369247L,
-369253L, 369263L, 369269L, 369283L, 369293L, 369301L, 369319L, 369331L, 369353L,
-369361L, 369407L, 369409L, 369419L, 369469L, 369487L, 369491L, 369539L, 369553L,
-369557L, 369581L, 369637L, 369647L, 369659L, 369661L, 369673L, 369703L, 369709L,
-369731L, 369739L, 369751L, 369791L, 369793L, 369821L, 369827L, 369829L, 369833L,
-369841L, 369851L, 369877L, 369893L, 369913L, 369917L, 369947L, 369959L, 369961L,
-369979L, 369983L, 369991L, 369997L, 370003L, 370009L, 370021L, 370033L, 370057L,
-370061L, 370067L, 370081L, 370091L, 370103L, 370121L, 370133L, 370147L, 370159L,
-370169L, 370193L, 370199L, 370207L, 370213L, 370217L, 370241L, 370247L, 370261L,
-370373L, 370387L, 370399L, 370411L, 370421L, 370423L, 370427L, 370439L, 370441L,
-370451L, 370463L, 370471L, 370477L, 370483L, 370493L, 370511L, 370529L, 370537L,
-370547L, 370561L, 370571L, 370597L, 370603L, 370609L, 370613L, 370619L, 370631L,
-370661L, 370663L, 370673L, 370679L, 370687L, 370693L, 370723L, 370759L, 370793L,
-370801L, 370813L, 370837L, 370871L, 370873L, 370879L, 370883L, 370891L, 370897L,
-370919L, 370949L, 371027L, 371029L, 371057L, 371069L, 371071L, 371083L, 371087L,
-371099L, 371131L, 371141L, 371143L, 371153L, 371177L, 371179L, 371191L, 371213L,
-371227L, 371233L, 371237L, 371249L, 371251L, 371257L, 371281L, 371291L, 371299L,
-371303L, 371311L, 371321L, 371333L, 371339L, 371341L, 371353L, 371359L, 371383L,
-371387L, 371389L, 371417L, 371447L, 371453L, 371471L, 371479L, 371491L, 371509L,
-371513L, 371549L, 371561L, 371573L, 371587L, 371617L, 371627L, 371633L, 371639L,
-371663L, 371669L, 371699L, 371719L, 371737L, 371779L, 371797L, 371831L, 371837L,
-371843L, 371851L, 371857L, 371869L, 371873L, 371897L, 371927L, 371929L, 371939L,
-371941L, 371951L, 371957L, 371971L, 371981L, 371999L, 372013L, 372023L, 372037L,
-372049L, 372059L, 372061L, 372067L, 372107L, 372121L, 372131L, 372137L, 372149L,
-372167L, 372173L, 372179L, 372223L, 372241L, 372263L, 372269L, 372271L, 372277L,
-372289L, 372293L, 372299L, 372311L, 372313L, 372353L, 372367L, 372371L, 372377L,
-372397L, 372401L, 372409L, 372413L, 372443L, 372451L, 372461L, 372473L, 372481L,
-372497L, 372511L, 372523L, 372539L, 372607L, 372611L, 372613L, 372629L, 372637L,
-372653L, 372661L, 372667L, 372677L, 372689L, 372707L, 372709L, 372719L, 372733L,
-372739L, 372751L, 372763L, 372769L, 372773L, 372797L, 372803L, 372809L, 372817L,
-372829L, 372833L, 372839L, 372847L, 372859L, 372871L, 372877L, 372881L, 372901L,
-372917L, 372941L, 372943L, 372971L, 372973L, 372979L, 373003L, 373007L, 373019L,
-373049L, 373063L, 373073L, 373091L, 373127L, 373151L, 373157L, 373171L, 373181L,
-373183L, 373187L, 373193L, 373199L, 373207L, 373211L, 373213L, 373229L, 373231L,
-373273L, 373291L, 373297L, 373301L, 373327L, 373339L, 373343L, 373349L, 373357L,
-373361L, 373363L, 373379L, 373393L, 373447L, 373453L, 373459L, 373463L, 373487L,
-373489L, 373501L, 373517L, 373553L, 373561L, 373567L, 373613L, 373621L, 373631L,
-373649L, 373657L, 373661L, 373669L, 373693L, 373717L, 373721L, 373753L, 373757L,
-373777L, 373783L, 373823L, 373837L, 373859L, 373861L, 373903L, 373909L, 373937L,
-373943L, 373951L, 373963L, 373969L, 373981L, 373987L, 373999L, 374009L, 374029L,
-374039L, 374041L, 374047L, 374063L, 374069L, 374083L, 374089L, 374093L, 374111L,
-374117L, 374123L, 374137L, 374149L, 374159L, 374173L, 374177L, 374189L, 374203L,
-374219L, 374239L, 374287L, 374291L, 374293L, 374299L, 374317L, 374321L, 374333L,
-374347L, 374351L, 374359L, 374389L, 374399L, 374441L, 374443L, 374447L, 374461L,
-374483L, 374501L, 374531L, 374537L, 374557L, 374587L, 374603L, 374639L, 374641L,
-374653L, 374669L, 374677L, 374681L, 374683L, 374687L, 374701L, 374713L, 374719L,
-374729L, 374741L, 374753L, 374761L, 374771L, 374783L, 374789L, 374797L, 374807L,
-374819L, 374837L, 374839L, 374849L, 374879L, 374887L, 374893L, 374903L, 374909L,
-374929L, 374939L, 374953L, 374977L, 374981L, 374987L, 374989L, 374993L, 375017L,
-375019L, 375029L, 375043L, 375049L, 375059L, 375083L, 375091L, 375097L, 375101L,
-375103L, 375113L, 375119L, 375121L, 375127L, 375149L, 375157L, 375163L, 375169L,
-375203L, 375209L, 375223L, 375227L, 375233L, 375247L, 375251L, 375253L, 375257L,
-375259L, 375281L, 375283L, 375311L, 375341L, 375359L, 375367L, 375371L, 375373L,
-375391L, 375407L, 375413L, 375443L, 375449L, 375451L, 375457L, 375467L, 375481L,
-375509L, 375511L, 375523L, 375527L, 375533L, 375553L, 375559L, 375563L, 375569L,
-375593L, 375607L, 375623L, 375631L, 375643L, 375647L, 375667L, 375673L, 375703L,
-375707L, 375709L, 375743L, 375757L, 375761L, 375773L, 375779L, 375787L, 375799L,
-375833L, 375841L, 375857L, 375899L, 375901L, 375923L, 375931L, 375967L, 375971L,
-375979L, 375983L, 375997L, 376001L, 376003L, 376009L, 376021L, 376039L, 376049L,
-376063L, 376081L, 376097L, 376099L, 376127L, 376133L, 376147L, 376153L, 376171L,
-376183L, 376199L, 376231L, 376237L, 376241L, 376283L, 376291L, 376297L, 376307L,
-376351L, 376373L, 376393L, 376399L, 376417L, 376463L, 376469L, 376471L, 376477L,
-376483L, 376501L, 376511L, 376529L, 376531L, 376547L, 376573L, 376577L, 376583L,
-376589L, 376603L, 376609L, 376627L, 376631L, 376633L, 376639L, 376657L, 376679L,
-376687L, 376699L, 376709L, 376721L, 376729L, 376757L, 376759L, 376769L, 376787L,
-376793L, 376801L, 376807L, 376811L, 376819L, 376823L, 376837L, 376841L, 376847L,
-376853L, 376889L, 376891L, 376897L, 376921L, 376927L, 376931L, 376933L, 376949L,
-376963L, 376969L, 377011L, 377021L, 377051L, 377059L, 377071L, 377099L, 377123L,
-377129L, 377137L, 377147L, 377171L, 377173L, 377183L, 377197L, 377219L, 377231L,
-377257L, 377263L, 377287L, 377291L, 377297L, 377327L, 377329L, 377339L, 377347L,
-377353L, 377369L, 377371L, 377387L, 377393L, 377459L, 377471L, 377477L, 377491L,
-377513L, 377521L, 377527L, 377537L, 377543L, 377557L, 377561L, 377563L, 377581L,
-377593L, 377599L, 377617L, 377623L, 377633L, 377653L, 377681L, 377687L, 377711L,
-377717L, 377737L, 377749L, 377761L, 377771L, 377779L, 377789L, 377801L, 377809L,
-377827L, 377831L, 377843L, 377851L, 377873L, 377887L, 377911L, 377963L, 377981L,
-377999L, 378011L, 378019L, 378023L, 378041L, 378071L, 378083L, 378089L, 378101L,
-378127L, 378137L, 378149L, 378151L, 378163L, 378167L, 378179L, 378193L, 378223L,
-378229L, 378239L, 378241L, 378253L, 378269L, 378277L, 378283L, 378289L, 378317L,
-378353L, 378361L, 378379L, 378401L, 378407L, 378439L, 378449L, 378463L, 378467L,
-378493L, 378503L, 378509L, 378523L, 378533L, 378551L, 378559L, 378569L, 378571L,
-378583L, 378593L, 378601L, 378619L, 378629L, 378661L, 378667L, 378671L, 378683L,
-378691L, 378713L, 378733L, 378739L, 378757L, 378761L, 378779L, 378793L, 378809L,
-378817L, 378821L, 378823L, 378869L, 378883L, 378893L, 378901L, 378919L, 378929L,
-378941L, 378949L, 378953L, 378967L, 378977L, 378997L, 379007L, 379009L, 379013L,
-379033L, 379039L, 379073L, 379081L, 379087L, 379097L, 379103L, 379123L, 379133L,
-379147L, 379157L, 379163L, 379177L, 379187L, 379189L, 379199L, 379207L, 379273L,
-379277L, 379283L, 379289L, 379307L, 379319L, 379333L, 379343L, 379369L, 379387L,
-379391L, 379397L, 379399L, 379417L, 379433L, 379439L, 379441L, 379451L, 379459L,
-379499L, 379501L, 379513L, 379531L, 379541L, 379549L, 379571L, 379573L, 379579L,
-379597L, 379607L, 379633L, 379649L, 379663L, 379667L, 379679L, 379681L, 379693L,
-379699L, 379703L, 379721L, 379723L, 379727L, 379751L, 379777L, 379787L, 379811L,
-379817L, 379837L, 379849L, 379853L, 379859L, 379877L, 379889L, 379903L, 379909L,
-379913L, 379927L, 379931L, 379963L, 379979L, 379993L, 379997L, 379999L, 380041L,
-380047L, 380059L, 380071L, 380117L, 380129L, 380131L, 380141L, 380147L, 380179L,
-380189L, 380197L, 380201L, 380203L, 380207L, 380231L, 380251L, 380267L, 380269L,
-380287L, 380291L, 380299L, 380309L, 380311L, 380327L, 380329L, 380333L, 380363L,
-380377L, 380383L, 380417L, 380423L, 380441L, 380447L, 380453L, 380459L, 380461L,
-380483L, 380503L, 380533L, 380557L, 380563L, 380591L, 380621L, 380623L, 380629L,
-380641L, 380651L, 380657L, 380707L, 380713L, 380729L, 380753L, 380777L, 380797L,
-380803L, 380819L, 380837L, 380839L, 380843L, 380867L, 380869L, 380879L, 380881L,
-380909L, 380917L, 380929L, 380951L, 380957L, 380971L, 380977L, 380983L, 381001L,
-381011L, 381019L, 381037L, 381047L, 381061L, 381071L, 381077L, 381097L, 381103L,
-381167L, 381169L, 381181L, 381209L, 381221L, 381223L, 381233L, 381239L, 381253L,
-381287L, 381289L, 381301L, 381319L, 381323L, 381343L, 381347L, 381371L, 381373L,
-381377L, 381383L, 381389L, 381401L, 381413L, 381419L, 381439L, 381443L, 381461L,
-381467L, 381481L, 381487L, 381509L, 381523L, 381527L, 381529L, 381533L, 381541L,
-381559L, 381569L, 381607L, 381629L, 381631L, 381637L, 381659L, 381673L, 381697L,
-381707L, 381713L, 381737L, 381739L, 381749L, 381757L, 381761L, 381791L, 381793L,
-381817L, 381841L, 381853L, 381859L, 381911L, 381917L, 381937L, 381943L, 381949L,
-381977L, 381989L, 381991L, 382001L, 382003L, 382021L, 382037L, 382061L, 382069L,
-382073L, 382087L, 382103L, 382117L, 382163L, 382171L, 382189L, 382229L, 382231L,
-382241L, 382253L, 382267L, 382271L, 382303L, 382331L, 382351L, 382357L, 382363L,
-382373L, 382391L, 382427L, 382429L, 382457L, 382463L, 382493L, 382507L, 382511L,
-382519L, 382541L, 382549L, 382553L, 382567L, 382579L, 382583L, 382589L, 382601L,
-382621L, 382631L, 382643L, 382649L, 382661L, 382663L, 382693L, 382703L, 382709L,
-382727L, 382729L, 382747L, 382751L, 382763L, 382769L, 382777L, 382801L, 382807L,
-382813L, 382843L, 382847L, 382861L, 382867L, 382871L, 382873L, 382883L, 382919L,
-382933L, 382939L, 382961L, 382979L, 382999L, 383011L, 383023L, 383029L, 383041L,
-383051L, 383069L, 383077L, 383081L, 383083L, 383099L, 383101L, 383107L, 383113L,
-383143L, 383147L, 383153L, 383171L, 383179L, 383219L, 383221L, 383261L, 383267L,
-383281L, 383291L, 383297L, 383303L, 383321L, 383347L, 383371L, 383393L, 383399L,
-383417L, 383419L, 383429L, 383459L, 383483L, 383489L, 383519L, 383521L, 383527L,
-383533L, 383549L, 383557L, 383573L, 383587L, 383609L, 383611L, 383623L, 383627L,
-383633L, 383651L, 383657L, 383659L, 383681L, 383683L, 383693L, 383723L, 383729L,
-383753L, 383759L, 383767L, 383777L, 383791L, 383797L, 383807L, 383813L, 383821L,
-383833L, 383837L, 383839L, 383869L, 383891L, 383909L, 383917L, 383923L, 383941L,
-383951L, 383963L, 383969L, 383983L, 383987L, 384001L, 384017L, 384029L, 384049L,
-384061L, 384067L, 384079L, 384089L, 384107L, 384113L, 384133L, 384143L, 384151L,
-384157L, 384173L, 384187L, 384193L, 384203L, 384227L, 384247L, 384253L, 384257L,
-384259L, 384277L, 384287L, 384289L, 384299L, 384301L, 384317L, 384331L, 384343L,
-384359L, 384367L, 384383L, 384403L, 384407L, 384437L, 384469L, 384473L, 384479L,
-384481L, 384487L, 384497L, 384509L, 384533L, 384547L, 384577L, 384581L, 384589L,
-384599L, 384611L, 384619L, 384623L, 384641L, 384673L, 384691L, 384697L, 384701L,
-384719L, 384733L, 384737L, 384751L, 384757L, 384773L, 384779L, 384817L, 384821L,
-384827L, 384841L, 384847L, 384851L, 384889L, 384907L, 384913L, 384919L, 384941L,
-384961L, 384973L, 385001L, 385013L, 385027L, 385039L, 385057L, 385069L, 385079L,
-385081L, 385087L, 385109L, 385127L, 385129L, 385139L, 385141L, 385153L, 385159L,
-385171L, 385193L, 385199L, 385223L, 385249L, 385261L, 385267L, 385279L, 385289L,
-385291L, 385321L, 385327L, 385331L, 385351L, 385379L, 385391L, 385393L, 385397L,
-385403L, 385417L, 385433L, 385471L, 385481L, 385493L, 385501L, 385519L, 385531L,
-385537L, 385559L, 385571L, 385573L, 385579L, 385589L, 385591L, 385597L, 385607L,
-385621L, 385631L, 385639L, 385657L, 385661L, 385663L, 385709L, 385739L, 385741L,
-385771L, 385783L, 385793L, 385811L, 385817L, 385831L, 385837L, 385843L, 385859L,
-385877L, 385897L, 385901L, 385907L, 385927L, 385939L, 385943L, 385967L, 385991L,
-385997L, 386017L, 386039L, 386041L, 386047L, 386051L, 386083L, 386093L, 386117L,
-386119L, 386129L, 386131L, 386143L, 386149L, 386153L, 386159L, 386161L, 386173L,
-386219L, 386227L, 386233L, 386237L, 386249L, 386263L, 386279L, 386297L, 386299L,
-386303L, 386329L, 386333L, 386339L, 386363L, 386369L, 386371L, 386381L, 386383L,
-386401L, 386411L, 386413L, 386429L, 386431L, 386437L, 386471L, 386489L, 386501L,
-386521L, 386537L, 386543L, 386549L, 386569L, 386587L, 386609L, 386611L, 386621L,
-386629L, 386641L, 386647L, 386651L, 386677L, 386689L, 386693L, 386713L, 386719L,
-386723L, 386731L, 386747L, 386777L, 386809L, 386839L, 386851L, 386887L, 386891L,
-386921L, 386927L, 386963L, 386977L, 386987L, 386989L, 386993L, 387007L, 387017L,
-387031L, 387047L, 387071L, 387077L, 387083L, 387089L, 387109L, 387137L, 387151L,
-387161L, 387169L, 387173L, 387187L, 387197L, 387199L, 387203L, 387227L, 387253L,
-387263L, 387269L, 387281L, 387307L, 387313L, 387329L, 387341L, 387371L, 387397L,
-387403L, 387433L, 387437L, 387449L, 387463L, 387493L, 387503L, 387509L, 387529L,
-387551L, 387577L, 387587L, 387613L, 387623L, 387631L, 387641L, 387659L, 387677L,
-387679L, 387683L, 387707L, 387721L, 387727L, 387743L, 387749L, 387763L, 387781L,
-387791L, 387799L, 387839L, 387853L, 387857L, 387911L, 387913L, 387917L, 387953L,
-387967L, 387971L, 387973L, 387977L, 388009L, 388051L, 388057L, 388067L, 388081L,
-388099L, 388109L, 388111L, 388117L, 388133L, 388159L, 388163L, 388169L, 388177L,
-388181L, 388183L, 388187L, 388211L, 388231L, 388237L, 388253L, 388259L, 388273L,
-388277L, 388301L, 388313L, 388319L, 388351L, 388363L, 388369L, 388373L, 388391L,
-388403L, 388459L, 388471L, 388477L, 388481L, 388483L, 388489L, 388499L, 388519L,
-388529L, 388541L, 388567L, 388573L, 388621L, 388651L, 388657L, 388673L, 388691L,
-388693L, 388697L, 388699L, 388711L, 388727L, 388757L, 388777L, 388781L, 388789L,
-388793L, 388813L, 388823L, 388837L, 388859L, 388879L, 388891L, 388897L, 388901L,
-388903L, 388931L, 388933L, 388937L, 388961L, 388963L, 388991L, 389003L, 389023L,
-389027L, 389029L, 389041L, 389047L, 389057L, 389083L, 389089L, 389099L, 389111L,
-389117L, 389141L, 389149L, 389161L, 389167L, 389171L, 389173L, 389189L, 389219L,
-389227L, 389231L, 389269L, 389273L, 389287L, 389297L, 389299L, 389303L, 389357L,
-389369L, 389381L, 389399L, 389401L, 389437L, 389447L, 389461L, 389479L, 389483L,
-389507L, 389513L, 389527L, 389531L, 389533L, 389539L, 389561L, 389563L, 389567L,
-389569L, 389579L, 389591L, 389621L, 389629L, 389651L, 389659L, 389663L, 389687L,
-389699L, 389713L, 389723L, 389743L, 389749L, 389761L, 389773L, 389783L, 389791L,
-389797L, 389819L, 389839L, 389849L, 389867L, 389891L, 389897L, 389903L, 389911L,
-389923L, 389927L, 389941L, 389947L, 389953L, 389957L, 389971L, 389981L, 389989L,
-389999L, 390001L, 390043L, 390067L, 390077L, 390083L, 390097L, 390101L, 390107L,
-390109L, 390113L, 390119L, 390151L, 390157L, 390161L, 390191L, 390193L, 390199L,
-390209L, 390211L, 390223L, 390263L, 390281L, 390289L, 390307L, 390323L, 390343L,
-390347L, 390353L, 390359L, 390367L, 390373L, 390389L, 390391L, 390407L, 390413L,
-390419L, 390421L, 390433L, 390437L, 390449L, 390463L, 390479L, 390487L, 390491L,
-390493L, 390499L, 390503L, 390527L, 390539L, 390553L, 390581L, 390647L, 390653L,
-390671L, 390673L, 390703L, 390707L, 390721L, 390727L, 390737L, 390739L, 390743L,
-390751L, 390763L, 390781L, 390791L, 390809L, 390821L, 390829L, 390851L, 390869L,
-390877L, 390883L, 390889L, 390893L, 390953L, 390959L, 390961L, 390967L, 390989L,
-390991L, 391009L, 391019L, 391021L, 391031L, 391049L, 391057L, 391063L, 391067L,
-391073L, 391103L, 391117L, 391133L, 391151L, 391159L, 391163L, 391177L, 391199L,
-391217L, 391219L, 391231L, 391247L, 391249L, 391273L, 391283L, 391291L, 391301L,
-391331L, 391337L, 391351L, 391367L, 391373L, 391379L, 391387L, 391393L, 391397L,
-391399L, 391403L, 391441L, 391451L, 391453L, 391487L, 391519L, 391537L, 391553L,
-391579L, 391613L, 391619L, 391627L, 391631L, 391639L, 391661L, 391679L, 391691L,
-391693L, 391711L, 391717L, 391733L, 391739L, 391751L, 391753L, 391757L, 391789L,
-391801L, 391817L, 391823L, 391847L, 391861L, 391873L, 391879L, 391889L, 391891L,
-391903L, 391907L, 391921L, 391939L, 391961L, 391967L, 391987L, 391999L, 392011L,
-392033L, 392053L, 392059L, 392069L, 392087L, 392099L, 392101L, 392111L, 392113L,
-392131L, 392143L, 392149L, 392153L, 392159L, 392177L, 392201L, 392209L, 392213L,
-392221L, 392233L, 392239L, 392251L, 392261L, 392263L, 392267L, 392269L, 392279L,
-392281L, 392297L, 392299L, 392321L, 392333L, 392339L, 392347L, 392351L, 392363L,
-392383L, 392389L, 392423L, 392437L, 392443L, 392467L, 392473L, 392477L, 392489L,
-392503L, 392519L, 392531L, 392543L, 392549L, 392569L, 392593L, 392599L, 392611L,
-392629L, 392647L, 392663L, 392669L, 392699L, 392723L, 392737L, 392741L, 392759L,
-392761L, 392767L, 392803L, 392807L, 392809L, 392827L, 392831L, 392837L, 392849L,
-392851L, 392857L, 392879L, 392893L, 392911L, 392923L, 392927L, 392929L, 392957L,
-392963L, 392969L, 392981L, 392983L, 393007L, 393013L, 393017L, 393031L, 393059L,
-393073L, 393077L, 393079L, 393083L, 393097L, 393103L, 393109L, 393121L, 393137L,
-393143L, 393157L, 393161L, 393181L, 393187L, 393191L, 393203L, 393209L, 393241L,
-393247L, 393257L, 393271L, 393287L, 393299L, 393301L, 393311L, 393331L, 393361L,
-393373L, 393377L, 393383L, 393401L, 393403L, 393413L, 393451L, 393473L, 393479L,
-393487L, 393517L, 393521L, 393539L, 393541L, 393551L, 393557L, 393571L, 393577L,
-393581L, 393583L, 393587L, 393593L, 393611L, 393629L, 393637L, 393649L, 393667L,
-393671L, 393677L, 393683L, 393697L, 393709L, 393713L, 393721L, 393727L, 393739L,
-393749L, 393761L, 393779L, 393797L, 393847L, 393853L, 393857L, 393859L, 393863L,
-393871L, 393901L, 393919L, 393929L, 393931L, 393947L, 393961L, 393977L, 393989L,
-393997L, 394007L, 394019L, 394039L, 394049L, 394063L, 394073L, 394099L, 394123L,
-394129L, 394153L, 394157L, 394169L, 394187L, 394201L, 394211L, 394223L, 394241L,
-394249L, 394259L, 394271L, 394291L, 394319L, 394327L, 394357L, 394363L, 394367L,
-394369L, 394393L, 394409L, 394411L, 394453L, 394481L, 394489L, 394501L, 394507L,
-394523L, 394529L, 394549L, 394571L, 394577L, 394579L, 394601L, 394619L, 394631L,
-394633L, 394637L, 394643L, 394673L, 394699L, 394717L, 394721L, 394727L, 394729L,
-394733L, 394739L, 394747L, 394759L, 394787L, 394811L, 394813L, 394817L, 394819L,
-394829L, 394837L, 394861L, 394879L, 394897L, 394931L, 394943L, 394963L, 394967L,
-394969L, 394981L, 394987L, 394993L, 395023L, 395027L, 395039L, 395047L, 395069L,
-395089L, 395093L, 395107L, 395111L, 395113L, 395119L, 395137L, 395141L, 395147L,
-395159L, 395173L, 395189L, 395191L, 395201L, 395231L, 395243L, 395251L, 395261L,
-395273L, 395287L, 395293L, 395303L, 395309L, 395321L, 395323L, 395377L, 395383L,
-395407L, 395429L, 395431L, 395443L, 395449L, 395453L, 395459L, 395491L, 395509L,
-395513L, 395533L, 395537L, 395543L, 395581L, 395597L, 395611L, 395621L, 395627L,
-395657L, 395671L, 395677L, 395687L, 395701L, 395719L, 395737L, 395741L, 395749L,
-395767L, 395803L, 395849L, 395851L, 395873L, 395887L, 395891L, 395897L, 395909L,
-395921L, 395953L, 395959L, 395971L, 396001L, 396029L, 396031L, 396041L, 396043L,
-396061L, 396079L, 396091L, 396103L, 396107L, 396119L, 396157L, 396173L, 396181L,
-396197L, 396199L, 396203L, 396217L, 396239L, 396247L, 396259L, 396269L, 396293L,
-396299L, 396301L, 396311L, 396323L, 396349L, 396353L, 396373L, 396377L, 396379L,
-396413L, 396427L, 396437L, 396443L, 396449L, 396479L, 396509L, 396523L, 396527L,
-396533L, 396541L, 396547L, 396563L, 396577L, 396581L, 396601L, 396619L, 396623L,
-396629L, 396631L, 396637L, 396647L, 396667L, 396679L, 396703L, 396709L, 396713L,
-396719L, 396733L, 396833L, 396871L, 396881L, 396883L, 396887L, 396919L, 396931L,
-396937L, 396943L, 396947L, 396953L, 396971L, 396983L, 396997L, 397013L, 397027L,
-397037L, 397051L, 397057L, 397063L, 397073L, 397093L, 397099L, 397127L, 397151L,
-397153L, 397181L, 397183L, 397211L, 397217L, 397223L, 397237L, 397253L, 397259L,
-397283L, 397289L, 397297L, 397301L, 397303L, 397337L, 397351L, 397357L, 397361L,
-397373L, 397379L, 397427L, 397429L, 397433L, 397459L, 397469L, 397489L, 397493L,
-397517L, 397519L, 397541L, 397543L, 397547L, 397549L, 397567L, 397589L, 397591L,
-397597L, 397633L, 397643L, 397673L, 397687L, 397697L, 397721L, 397723L, 397729L,
-397751L, 397753L, 397757L, 397759L, 397763L, 397799L, 397807L, 397811L, 397829L,
-397849L, 397867L, 397897L, 397907L, 397921L, 397939L, 397951L, 397963L, 397973L,
-397981L, 398011L, 398023L, 398029L, 398033L, 398039L, 398053L, 398059L, 398063L,
-398077L, 398087L, 398113L, 398117L, 398119L, 398129L, 398143L, 398149L, 398171L,
-398207L, 398213L, 398219L, 398227L, 398249L, 398261L, 398267L, 398273L, 398287L,
-398303L, 398311L, 398323L, 398339L, 398341L, 398347L, 398353L, 398357L, 398369L,
-398393L, 398407L, 398417L, 398423L, 398441L, 398459L, 398467L, 398471L, 398473L,
-398477L, 398491L, 398509L, 398539L, 398543L, 398549L, 398557L, 398569L, 398581L,
-398591L, 398609L, 398611L, 398621L, 398627L, 398669L, 398681L, 398683L, 398693L,
-398711L, 398729L, 398731L, 398759L, 398771L, 398813L, 398819L, 398821L, 398833L,
-398857L, 398863L, 398887L, 398903L, 398917L, 398921L, 398933L, 398941L, 398969L,
-398977L, 398989L, 399023L, 399031L, 399043L, 399059L, 399067L, 399071L, 399079L,
-399097L, 399101L, 399107L, 399131L, 399137L, 399149L, 399151L, 399163L, 399173L,
-399181L, 399197L, 399221L, 399227L, 399239L, 399241L, 399263L, 399271L, 399277L,
-399281L, 399283L, 399353L, 399379L, 399389L, 399391L, 399401L, 399403L, 399409L,
-399433L, 399439L, 399473L, 399481L, 399491L, 399493L, 399499L, 399523L, 399527L,
-399541L, 399557L, 399571L, 399577L, 399583L, 399587L, 399601L, 399613L, 399617L,
-399643L, 399647L, 399667L, 399677L, 399689L, 399691L, 399719L, 399727L, 399731L,
-399739L, 399757L, 399761L, 399769L, 399781L, 399787L, 399793L, 399851L, 399853L,
-399871L, 399887L, 399899L, 399911L, 399913L, 399937L, 399941L, 399953L, 399979L,
-399983L, 399989L, 400009L, 400031L, 400033L, 400051L, 400067L, 400069L, 400087L,
-400093L, 400109L, 400123L, 400151L, 400157L, 400187L, 400199L, 400207L, 400217L,
-400237L, 400243L, 400247L, 400249L, 400261L, 400277L, 400291L, 400297L, 400307L,
-400313L, 400321L, 400331L, 400339L, 400381L, 400391L, 400409L, 400417L, 400429L,
-400441L, 400457L, 400471L, 400481L, 400523L, 400559L, 400579L, 400597L, 400601L,
-400607L, 400619L, 400643L, 400651L, 400657L, 400679L, 400681L, 400703L, 400711L,
-400721L, 400723L, 400739L, 400753L, 400759L, 400823L, 400837L, 400849L, 400853L,
-400859L, 400871L, 400903L, 400927L, 400931L, 400943L, 400949L, 400963L, 400997L,
-401017L, 401029L, 401039L, 401053L, 401057L, 401069L, 401077L, 401087L, 401101L,
-401113L, 401119L, 401161L, 401173L, 401179L, 401201L, 401209L, 401231L, 401237L,
-401243L, 401279L, 401287L, 401309L, 401311L, 401321L, 401329L, 401341L, 401347L,
-401371L, 401381L, 401393L, 401407L, 401411L, 401417L, 401473L, 401477L, 401507L,
-401519L, 401537L, 401539L, 401551L, 401567L, 401587L, 401593L, 401627L, 401629L,
-401651L, 401669L, 401671L, 401689L, 401707L, 401711L, 401743L, 401771L, 401773L,
-401809L, 401813L, 401827L, 401839L, 401861L, 401867L, 401887L, 401903L, 401909L,
-401917L, 401939L, 401953L, 401957L, 401959L, 401981L, 401987L, 401993L, 402023L,
-402029L, 402037L, 402043L, 402049L, 402053L, 402071L, 402089L, 402091L, 402107L,
-402131L, 402133L, 402137L, 402139L, 402197L, 402221L, 402223L, 402239L, 402253L,
-402263L, 402277L, 402299L, 402307L, 402313L, 402329L, 402331L, 402341L, 402343L,
-402359L, 402361L, 402371L, 402379L, 402383L, 402403L, 402419L, 402443L, 402487L,
-402503L, 402511L, 402517L, 402527L, 402529L, 402541L, 402551L, 402559L, 402581L,
-402583L, 402587L, 402593L, 402601L, 402613L, 402631L, 402691L, 402697L, 402739L,
-402751L, 402757L, 402761L, 402763L, 402767L, 402769L, 402797L, 402803L, 402817L,
-402823L, 402847L, 402851L, 402859L, 402863L, 402869L, 402881L, 402923L, 402943L,
-402947L, 402949L, 402991L, 403001L, 403003L, 403037L, 403043L, 403049L, 403057L,
-403061L, 403063L, 403079L, 403097L, 403103L, 403133L, 403141L, 403159L, 403163L,
-403181L, 403219L, 403241L, 403243L, 403253L, 403261L, 403267L, 403289L, 403301L,
-403309L, 403327L, 403331L, 403339L, 403363L, 403369L, 403387L, 403391L, 403433L,
-403439L, 403483L, 403499L, 403511L, 403537L, 403547L, 403549L, 403553L, 403567L,
-403577L, 403591L, 403603L, 403607L, 403621L, 403649L, 403661L, 403679L, 403681L,
-403687L, 403703L, 403717L, 403721L, 403729L, 403757L, 403783L, 403787L, 403817L,
-403829L, 403831L, 403849L, 403861L, 403867L, 403877L, 403889L, 403901L, 403933L,
-403951L, 403957L, 403969L, 403979L, 403981L, 403993L, 404009L, 404011L, 404017L,
-404021L, 404029L, 404051L, 404081L, 404099L, 404113L, 404119L, 404123L, 404161L,
-404167L, 404177L, 404189L, 404191L, 404197L, 404213L, 404221L, 404249L, 404251L,
-404267L, 404269L, 404273L, 404291L, 404309L, 404321L, 404323L, 404357L, 404381L,
-404387L, 404389L, 404399L, 404419L, 404423L, 404429L, 404431L, 404449L, 404461L,
-404483L, 404489L, 404497L, 404507L, 404513L, 404527L, 404531L, 404533L, 404539L,
-404557L, 404597L, 404671L, 404693L, 404699L, 404713L, 404773L, 404779L, 404783L,
-404819L, 404827L, 404837L, 404843L, 404849L, 404851L, 404941L, 404951L, 404959L,
-404969L, 404977L, 404981L, 404983L, 405001L, 405011L, 405029L, 405037L, 405047L,
-405049L, 405071L, 405073L, 405089L, 405091L, 405143L, 405157L, 405179L, 405199L,
-405211L, 405221L, 405227L, 405239L, 405241L, 405247L, 405253L, 405269L, 405277L,
-405287L, 405299L, 405323L, 405341L, 405343L, 405347L, 405373L, 405401L, 405407L,
-405413L, 405437L, 405439L, 405473L, 405487L, 405491L, 405497L, 405499L, 405521L,
-405527L, 405529L, 405541L, 405553L, 405577L, 405599L, 405607L, 405611L, 405641L,
-405659L, 405667L, 405677L, 405679L, 405683L, 405689L, 405701L, 405703L, 405709L,
-405719L, 405731L, 405749L, 405763L, 405767L, 405781L, 405799L, 405817L, 405827L,
-405829L, 405857L, 405863L, 405869L, 405871L, 405893L, 405901L, 405917L, 405947L,
-405949L, 405959L, 405967L, 405989L, 405991L, 405997L, 406013L, 406027L, 406037L,
-406067L, 406073L, 406093L, 406117L, 406123L, 406169L, 406171L, 406177L, 406183L,
-406207L, 406247L, 406253L, 406267L, 406271L, 406309L, 406313L, 406327L, 406331L,
-406339L, 406349L, 406361L, 406381L, 406397L, 406403L, 406423L, 406447L, 406481L,
-406499L, 406501L, 406507L, 406513L, 406517L, 406531L, 406547L, 406559L, 406561L,
-406573L, 406577L, 406579L, 406583L, 406591L, 406631L, 406633L, 406649L, 406661L,
-406673L, 406697L, 406699L, 406717L, 406729L, 406739L, 406789L, 406807L, 406811L,
-406817L, 406837L, 406859L, 406873L, 406883L, 406907L, 406951L, 406969L, 406981L,
-406993L, 407023L, 407047L, 407059L, 407083L, 407119L, 407137L, 407149L, 407153L,
-407177L, 407179L, 407191L, 407203L, 407207L, 407219L, 407221L, 407233L, 407249L,
-407257L, 407263L, 407273L, 407287L, 407291L, 407299L, 407311L, 407317L, 407321L,
-407347L, 407357L, 407359L, 407369L, 407377L, 407383L, 407401L, 407437L, 407471L,
-407483L, 407489L, 407501L, 407503L, 407509L, 407521L, 407527L, 407567L, 407573L,
-407579L, 407587L, 407599L, 407621L, 407633L, 407639L, 407651L, 407657L, 407669L,
-407699L, 407707L, 407713L, 407717L, 407723L, 407741L, 407747L, 407783L, 407789L,
-407791L, 407801L, 407807L, 407821L, 407833L, 407843L, 407857L, 407861L, 407879L,
-407893L, 407899L, 407917L, 407923L, 407947L, 407959L, 407969L, 407971L, 407977L,
-407993L, 408011L, 408019L, 408041L, 408049L, 408071L, 408077L, 408091L, 408127L,
-408131L, 408137L, 408169L, 408173L, 408197L, 408203L, 408209L, 408211L, 408217L,
-408223L, 408229L, 408241L, 408251L, 408263L, 408271L, 408283L, 408311L, 408337L,
-408341L, 408347L, 408361L, 408379L, 408389L, 408403L, 408413L, 408427L, 408431L,
-408433L, 408437L, 408461L, 408469L, 408479L, 408491L, 408497L, 408533L, 408539L,
-408553L, 408563L, 408607L, 408623L, 408631L, 408637L, 408643L, 408659L, 408677L,
-408689L, 408691L, 408701L, 408703L, 408713L, 408719L, 408743L, 408763L, 408769L,
-408773L, 408787L, 408803L, 408809L, 408817L, 408841L, 408857L, 408869L, 408911L,
-408913L, 408923L, 408943L, 408953L, 408959L, 408971L, 408979L, 408997L, 409007L,
-409021L, 409027L, 409033L, 409043L, 409063L, 409069L, 409081L, 409099L, 409121L,
-409153L, 409163L, 409177L, 409187L, 409217L, 409237L, 409259L, 409261L, 409267L,
-409271L, 409289L, 409291L, 409327L, 409333L, 409337L, 409349L, 409351L, 409369L,
-409379L, 409391L, 409397L, 409429L, 409433L, 409441L, 409463L, 409471L, 409477L,
-409483L, 409499L, 409517L, 409523L, 409529L, 409543L, 409573L, 409579L, 409589L,
-409597L, 409609L, 409639L, 409657L, 409691L, 409693L, 409709L, 409711L, 409723L,
-409729L, 409733L, 409753L, 409769L, 409777L, 409781L, 409813L, 409817L, 409823L,
-409831L, 409841L, 409861L, 409867L, 409879L, 409889L, 409891L, 409897L, 409901L,
-409909L, 409933L, 409943L, 409951L, 409961L, 409967L, 409987L, 409993L, 409999L,
-410009L, 410029L, 410063L, 410087L, 410093L, 410117L, 410119L, 410141L, 410143L,
-410149L, 410171L, 410173L, 410203L, 410231L, 410233L, 410239L, 410243L, 410257L,
-410279L, 410281L, 410299L, 410317L, 410323L, 410339L, 410341L, 410353L, 410359L,
-410383L, 410387L, 410393L, 410401L, 410411L, 410413L, 410453L, 410461L, 410477L,
-410489L, 410491L, 410497L, 410507L, 410513L, 410519L, 410551L, 410561L, 410587L,
-410617L, 410621L, 410623L, 410629L, 410651L, 410659L, 410671L, 410687L, 410701L,
-410717L, 410731L, 410741L, 410747L, 410749L, 410759L, 410783L, 410789L, 410801L,
-410807L, 410819L, 410833L, 410857L, 410899L, 410903L, 410929L, 410953L, 410983L,
-410999L, 411001L, 411007L, 411011L, 411013L, 411031L, 411041L, 411049L, 411067L,
-411071L, 411083L, 411101L, 411113L, 411119L, 411127L, 411143L, 411157L, 411167L,
-411193L, 411197L, 411211L, 411233L, 411241L, 411251L, 411253L, 411259L, 411287L,
-411311L, 411337L, 411347L, 411361L, 411371L, 411379L, 411409L, 411421L, 411443L,
-411449L, 411469L, 411473L, 411479L, 411491L, 411503L, 411527L, 411529L, 411557L,
-411563L, 411569L, 411577L, 411583L, 411589L, 411611L, 411613L, 411617L, 411637L,
-411641L, 411667L, 411679L, 411683L, 411703L, 411707L, 411709L, 411721L, 411727L,
-411737L, 411739L, 411743L, 411751L, 411779L, 411799L, 411809L, 411821L, 411823L,
-411833L, 411841L, 411883L, 411919L, 411923L, 411937L, 411941L, 411947L, 411967L,
-411991L, 412001L, 412007L, 412019L, 412031L, 412033L, 412037L, 412039L, 412051L,
-412067L, 412073L, 412081L, 412099L, 412109L, 412123L, 412127L, 412133L, 412147L,
-412157L, 412171L, 412187L, 412189L, 412193L, 412201L, 412211L, 412213L, 412219L,
-412249L, 412253L, 412273L, 412277L, 412289L, 412303L, 412333L, 412339L, 412343L,
-412387L, 412397L, 412411L, 412457L, 412463L, 412481L, 412487L, 412493L, 412537L,
-412561L, 412567L, 412571L, 412589L, 412591L, 412603L, 412609L, 412619L, 412627L,
-412637L, 412639L, 412651L, 412663L, 412667L, 412717L, 412739L, 412771L, 412793L,
-412807L, 412831L, 412849L, 412859L, 412891L, 412901L, 412903L, 412939L, 412943L,
-412949L, 412967L, 412987L, 413009L, 413027L, 413033L, 413053L, 413069L, 413071L,
-413081L, 413087L, 413089L, 413093L, 413111L, 413113L, 413129L, 413141L, 413143L,
-413159L, 413167L, 413183L, 413197L, 413201L, 413207L, 413233L, 413243L, 413251L,
-413263L, 413267L, 413293L, 413299L, 413353L, 413411L, 413417L, 413429L, 413443L,
-413461L, 413477L, 413521L, 413527L, 413533L, 413537L, 413551L, 413557L, 413579L,
-413587L, 413597L, 413629L, 413653L, 413681L, 413683L, 413689L, 413711L, 413713L,
-413719L, 413737L, 413753L, 413759L, 413779L, 413783L, 413807L, 413827L, 413849L,
-413863L, 413867L, 413869L, 413879L, 413887L, 413911L, 413923L, 413951L, 413981L,
-414013L, 414017L, 414019L, 414031L, 414049L, 414053L, 414061L, 414077L, 414083L,
-414097L, 414101L, 414107L, 414109L, 414131L, 414157L, 414179L, 414199L, 414203L,
-414209L, 414217L, 414221L, 414241L, 414259L, 414269L, 414277L, 414283L, 414311L,
-414313L, 414329L, 414331L, 414347L, 414361L, 414367L, 414383L, 414389L, 414397L,
-414413L, 414431L, 414433L, 414451L, 414457L, 414461L, 414467L, 414487L, 414503L,
-414521L, 414539L, 414553L, 414559L, 414571L, 414577L, 414607L, 414611L, 414629L,
-414641L, 414643L, 414653L, 414677L, 414679L, 414683L, 414691L, 414697L, 414703L,
-414707L, 414709L, 414721L, 414731L, 414737L, 414763L, 414767L, 414769L, 414773L,
-414779L, 414793L, 414803L, 414809L, 414833L, 414857L, 414871L, 414889L, 414893L,
-414899L, 414913L, 414923L, 414929L, 414949L, 414959L, 414971L, 414977L, 414991L,
-415013L, 415031L, 415039L, 415061L, 415069L, 415073L, 415087L, 415097L, 415109L,
-415111L, 415133L, 415141L, 415147L, 415153L, 415159L, 415171L, 415187L, 415189L,
-415201L, 415213L, 415231L, 415253L, 415271L, 415273L, 415319L, 415343L, 415379L,
-415381L, 415391L, 415409L, 415427L, 415447L, 415469L, 415477L, 415489L, 415507L,
-415517L, 415523L, 415543L, 415553L, 415559L, 415567L, 415577L, 415603L, 415607L,
-415609L, 415627L, 415631L, 415643L, 415651L, 415661L, 415669L, 415673L, 415687L,
-415691L, 415697L, 415717L, 415721L, 415729L, 415759L, 415783L, 415787L, 415799L,
-415801L, 415819L, 415823L, 415861L, 415873L, 415879L, 415901L, 415931L, 415937L,
-415949L, 415951L, 415957L, 415963L, 415969L, 415979L, 415993L, 415999L, 416011L,
-416023L, 416071L, 416077L, 416089L, 416107L, 416147L, 416149L, 416153L, 416159L,
-416167L, 416201L, 416219L, 416239L, 416243L, 416249L, 416257L, 416263L, 416281L,
-416291L, 416333L, 416359L, 416387L, 416389L, 416393L, 416399L, 416401L, 416407L,
-416413L, 416417L, 416419L, 416441L, 416443L, 416459L, 416473L, 416477L, 416491L,
-416497L, 416501L, 416503L, 416513L, 416531L, 416543L, 416573L, 416579L, 416593L,
-416621L, 416623L, 416629L, 416659L, 416677L, 416693L, 416719L, 416761L, 416797L,
-416821L, 416833L, 416839L, 416849L, 416851L, 416873L, 416881L, 416887L, 416947L,
-416957L, 416963L, 416989L, 417007L, 417017L, 417019L, 417023L, 417037L, 417089L,
-417097L, 417113L, 417119L, 417127L, 417133L, 417161L, 417169L, 417173L, 417181L,
-417187L, 417191L, 417203L, 417217L, 417227L, 417239L, 417251L, 417271L, 417283L,
-417293L, 417311L, 417317L, 417331L, 417337L, 417371L, 417377L, 417379L, 417383L,
-417419L, 417437L, 417451L, 417457L, 417479L, 417491L, 417493L, 417509L, 417511L,
-417523L, 417541L, 417553L, 417559L, 417577L, 417581L, 417583L, 417617L, 417623L,
-417631L, 417643L, 417649L, 417671L, 417691L, 417719L, 417721L, 417727L, 417731L,
-417733L, 417737L, 417751L, 417763L, 417773L, 417793L, 417811L, 417821L, 417839L,
-417863L, 417869L, 417881L, 417883L, 417899L, 417931L, 417941L, 417947L, 417953L,
-417959L, 417961L, 417983L, 417997L, 418007L, 418009L, 418027L, 418031L, 418043L,
-418051L, 418069L, 418073L, 418079L, 418087L, 418109L, 418129L, 418157L, 418169L,
-418177L, 418181L, 418189L, 418199L, 418207L, 418219L, 418259L, 418273L, 418279L,
-418289L, 418303L, 418321L, 418331L, 418337L, 418339L, 418343L, 418349L, 418351L,
-418357L, 418373L, 418381L, 418391L, 418423L, 418427L, 418447L, 418459L, 418471L,
-418493L, 418511L, 418553L, 418559L, 418597L, 418601L, 418603L, 418631L, 418633L,
-418637L, 418657L, 418667L, 418699L, 418709L, 418721L, 418739L, 418751L, 418763L,
-418771L, 418783L, 418787L, 418793L, 418799L, 418811L, 418813L, 418819L, 418837L,
-418843L, 418849L, 418861L, 418867L, 418871L, 418883L, 418889L, 418909L, 418921L,
-418927L, 418933L, 418939L, 418961L, 418981L, 418987L, 418993L, 418997L, 419047L,
-419051L, 419053L, 419057L, 419059L, 419087L, 419141L, 419147L, 419161L, 419171L,
-419183L, 419189L, 419191L, 419201L, 419231L, 419249L, 419261L, 419281L, 419291L,
-419297L, 419303L, 419317L, 419329L, 419351L, 419383L, 419401L, 419417L, 419423L,
-419429L, 419443L, 419449L, 419459L, 419467L, 419473L, 419477L, 419483L, 419491L,
-419513L, 419527L, 419537L, 419557L, 419561L, 419563L, 419567L, 419579L, 419591L,
-419597L, 419599L, 419603L, 419609L, 419623L, 419651L, 419687L, 419693L, 419701L,
-419711L, 419743L, 419753L, 419777L, 419789L, 419791L, 419801L, 419803L, 419821L,
-419827L, 419831L, 419873L, 419893L, 419921L, 419927L, 419929L, 419933L, 419953L,
-419959L, 419999L, 420001L, 420029L, 420037L, 420041L, 420047L, 420073L, 420097L,
-420103L, 420149L, 420163L, 420191L, 420193L, 420221L, 420241L, 420253L, 420263L,
-420269L, 420271L, 420293L, 420307L, 420313L, 420317L, 420319L, 420323L, 420331L,
-420341L, 420349L, 420353L, 420361L, 420367L, 420383L, 420397L, 420419L, 420421L,
-420439L, 420457L, 420467L, 420479L, 420481L, 420499L, 420503L, 420521L, 420551L,
-420557L, 420569L, 420571L, 420593L, 420599L, 420613L, 420671L, 420677L, 420683L,
-420691L, 420731L, 420737L, 420743L, 420757L, 420769L, 420779L, 420781L, 420799L,
-420803L, 420809L, 420811L, 420851L, 420853L, 420857L, 420859L, 420899L, 420919L,
-420929L, 420941L, 420967L, 420977L, 420997L, 421009L, 421019L, 421033L, 421037L,
-421049L, 421079L, 421081L, 421093L, 421103L, 421121L, 421123L, 421133L, 421147L,
-421159L, 421163L, 421177L, 421181L, 421189L, 421207L, 421241L, 421273L, 421279L,
-421303L, 421313L, 421331L, 421339L, 421349L, 421361L, 421381L, 421397L, 421409L,
-421417L, 421423L, 421433L, 421453L, 421459L, 421469L, 421471L, 421483L, 421493L,
-421501L, 421517L, 421559L, 421607L, 421609L, 421621L, 421633L, 421639L, 421643L,
-421657L, 421661L, 421691L, 421697L, 421699L, 421703L, 421709L, 421711L, 421717L,
-421727L, 421739L, 421741L, 421783L, 421801L, 421807L, 421831L, 421847L, 421891L,
-421907L, 421913L, 421943L, 421973L, 421987L, 421997L, 422029L, 422041L, 422057L,
-422063L, 422069L, 422077L, 422083L, 422087L, 422089L, 422099L, 422101L, 422111L,
-422113L, 422129L, 422137L, 422141L, 422183L, 422203L, 422209L, 422231L, 422239L,
-422243L, 422249L, 422267L, 422287L, 422291L, 422309L, 422311L, 422321L, 422339L,
-422353L, 422363L, 422369L, 422377L, 422393L, 422407L, 422431L, 422453L, 422459L,
-422479L, 422537L, 422549L, 422551L, 422557L, 422563L, 422567L, 422573L, 422581L,
-422621L, 422627L, 422657L, 422689L, 422701L, 422707L, 422711L, 422749L, 422753L,
-422759L, 422761L, 422789L, 422797L, 422803L, 422827L, 422857L, 422861L, 422867L,
-422869L, 422879L, 422881L, 422893L, 422897L, 422899L, 422911L, 422923L, 422927L,
-422969L, 422987L, 423001L, 423013L, 423019L, 423043L, 423053L, 423061L, 423067L,
-423083L, 423091L, 423097L, 423103L, 423109L, 423121L, 423127L, 423133L, 423173L,
-423179L, 423191L, 423209L, 423221L, 423229L, 423233L, 423251L, 423257L, 423259L,
-423277L, 423281L, 423287L, 423289L, 423299L, 423307L, 423323L, 423341L, 423347L,
-423389L, 423403L, 423413L, 423427L, 423431L, 423439L, 423457L, 423461L, 423463L,
-423469L, 423481L, 423497L, 423503L, 423509L, 423541L, 423547L, 423557L, 423559L,
-423581L, 423587L, 423601L, 423617L, 423649L, 423667L, 423697L, 423707L, 423713L,
-423727L, 423749L, 423751L, 423763L, 423769L, 423779L, 423781L, 423791L, 423803L,
-423823L, 423847L, 423853L, 423859L, 423869L, 423883L, 423887L, 423931L, 423949L,
-423961L, 423977L, 423989L, 423991L, 424001L, 424003L, 424007L, 424019L, 424027L,
-424037L, 424079L, 424091L, 424093L, 424103L, 424117L, 424121L, 424129L, 424139L,
-424147L, 424157L, 424163L, 424169L, 424187L, 424199L, 424223L, 424231L, 424243L,
-424247L, 424261L, 424267L, 424271L, 424273L, 424313L, 424331L, 424339L, 424343L,
-424351L, 424397L, 424423L, 424429L, 424433L, 424451L, 424471L, 424481L, 424493L,
-424519L, 424537L, 424547L, 424549L, 424559L, 424573L, 424577L, 424597L, 424601L,
-424639L, 424661L, 424667L, 424679L, 424687L, 424693L, 424709L, 424727L, 424729L,
-424757L, 424769L, 424771L, 424777L, 424811L, 424817L, 424819L, 424829L, 424841L,
-424843L, 424849L, 424861L, 424867L, 424889L, 424891L, 424903L, 424909L, 424913L,
-424939L, 424961L, 424967L, 424997L, 425003L, 425027L, 425039L, 425057L, 425059L,
-425071L, 425083L, 425101L, 425107L, 425123L, 425147L, 425149L, 425189L, 425197L,
-425207L, 425233L, 425237L, 425251L, 425273L, 425279L, 425281L, 425291L, 425297L,
-425309L, 425317L, 425329L, 425333L, 425363L, 425377L, 425387L, 425393L, 425417L,
-425419L, 425423L, 425441L, 425443L, 425471L, 425473L, 425489L, 425501L, 425519L,
-425521L, 425533L, 425549L, 425563L, 425591L, 425603L, 425609L, 425641L, 425653L,
-425681L, 425701L, 425713L, 425779L, 425783L, 425791L, 425801L, 425813L, 425819L,
-425837L, 425839L, 425851L, 425857L, 425861L, 425869L, 425879L, 425899L, 425903L,
-425911L, 425939L, 425959L, 425977L, 425987L, 425989L, 426007L, 426011L, 426061L,
-426073L, 426077L, 426089L, 426091L, 426103L, 426131L, 426161L, 426163L, 426193L,
-426197L, 426211L, 426229L, 426233L, 426253L, 426287L, 426301L, 426311L, 426319L,
-426331L, 426353L, 426383L, 426389L, 426401L, 426407L, 426421L, 426427L, 426469L,
-426487L, 426527L, 426541L, 426551L, 426553L, 426563L, 426583L, 426611L, 426631L,
-426637L, 426641L, 426661L, 426691L, 426697L, 426707L, 426709L, 426731L, 426737L,
-426739L, 426743L, 426757L, 426761L, 426763L, 426773L, 426779L, 426787L, 426799L,
-426841L, 426859L, 426863L, 426871L, 426889L, 426893L, 426913L, 426917L, 426919L,
-426931L, 426941L, 426971L, 426973L, 426997L, 427001L, 427013L, 427039L, 427043L,
-427067L, 427069L, 427073L, 427079L, 427081L, 427103L, 427117L, 427151L, 427169L,
-427181L, 427213L, 427237L, 427241L, 427243L, 427247L, 427249L, 427279L, 427283L,
-427307L, 427309L, 427327L, 427333L, 427351L, 427369L, 427379L, 427381L, 427403L,
-427417L, 427421L, 427423L, 427429L, 427433L, 427439L, 427447L, 427451L, 427457L,
-427477L, 427513L, 427517L, 427523L, 427529L, 427541L, 427579L, 427591L, 427597L,
-427619L, 427621L, 427681L, 427711L, 427717L, 427723L, 427727L, 427733L, 427751L,
-427781L, 427787L, 427789L, 427813L, 427849L, 427859L, 427877L, 427879L, 427883L,
-427913L, 427919L, 427939L, 427949L, 427951L, 427957L, 427967L, 427969L, 427991L,
-427993L, 427997L, 428003L, 428023L, 428027L, 428033L, 428039L, 428041L, 428047L,
-428083L, 428093L, 428137L, 428143L, 428147L, 428149L, 428161L, 428167L, 428173L,
-428177L, 428221L, 428227L, 428231L, 428249L, 428251L, 428273L, 428297L, 428299L,
-428303L, 428339L, 428353L, 428369L, 428401L, 428411L, 428429L, 428471L, 428473L,
-428489L, 428503L, 428509L, 428531L, 428539L, 428551L, 428557L, 428563L, 428567L,
-428569L, 428579L, 428629L, 428633L, 428639L, 428657L, 428663L, 428671L, 428677L,
-428683L, 428693L, 428731L, 428741L, 428759L, 428777L, 428797L, 428801L, 428807L,
-428809L, 428833L, 428843L, 428851L, 428863L, 428873L, 428899L, 428951L, 428957L,
-428977L, 429007L, 429017L, 429043L, 429083L, 429101L, 429109L, 429119L, 429127L,
-429137L, 429139L, 429161L, 429181L, 429197L, 429211L, 429217L, 429223L, 429227L,
-429241L, 429259L, 429271L, 429277L, 429281L, 429283L, 429329L, 429347L, 429349L,
-429361L, 429367L, 429389L, 429397L, 429409L, 429413L, 429427L, 429431L, 429449L,
-429463L, 429467L, 429469L, 429487L, 429497L, 429503L, 429509L, 429511L, 429521L,
-429529L, 429547L, 429551L, 429563L, 429581L, 429587L, 429589L, 429599L, 429631L,
-429643L, 429659L, 429661L, 429673L, 429677L, 429679L, 429683L, 429701L, 429719L,
-429727L, 429731L, 429733L, 429773L, 429791L, 429797L, 429817L, 429823L, 429827L,
-429851L, 429853L, 429881L, 429887L, 429889L, 429899L, 429901L, 429907L, 429911L,
-429917L, 429929L, 429931L, 429937L, 429943L, 429953L, 429971L, 429973L, 429991L,
-430007L, 430009L, 430013L, 430019L, 430057L, 430061L, 430081L, 430091L, 430093L,
-430121L, 430139L, 430147L, 430193L, 430259L, 430267L, 430277L, 430279L, 430289L,
-430303L, 430319L, 430333L, 430343L, 430357L, 430393L, 430411L, 430427L, 430433L,
-430453L, 430487L, 430499L, 430511L, 430513L, 430517L, 430543L, 430553L, 430571L,
-430579L, 430589L, 430601L, 430603L, 430649L, 430663L, 430691L, 430697L, 430699L,
-430709L, 430723L, 430739L, 430741L, 430747L, 430751L, 430753L, 430769L, 430783L,
-430789L, 430799L, 430811L, 430819L, 430823L, 430841L, 430847L, 430861L, 430873L,
-430879L, 430883L, 430891L, 430897L, 430907L, 430909L, 430921L, 430949L, 430957L,
-430979L, 430981L, 430987L, 430999L, 431017L, 431021L, 431029L, 431047L, 431051L,
-431063L, 431077L, 431083L, 431099L, 431107L, 431141L, 431147L, 431153L, 431173L,
-431191L, 431203L, 431213L, 431219L, 431237L, 431251L, 431257L, 431267L, 431269L,
-431287L, 431297L, 431311L, 431329L, 431339L, 431363L, 431369L, 431377L, 431381L,
-431399L, 431423L, 431429L, 431441L, 431447L, 431449L, 431479L, 431513L, 431521L,
-431533L, 431567L, 431581L, 431597L, 431603L, 431611L, 431617L, 431621L, 431657L,
-431659L, 431663L, 431671L, 431693L, 431707L, 431729L, 431731L, 431759L, 431777L,
-431797L, 431801L, 431803L, 431807L, 431831L, 431833L, 431857L, 431863L, 431867L,
-431869L, 431881L, 431887L, 431891L, 431903L, 431911L, 431929L, 431933L, 431947L,
-431983L, 431993L, 432001L, 432007L, 432023L, 432031L, 432037L, 432043L, 432053L,
-432059L, 432067L, 432073L, 432097L, 432121L, 432137L, 432139L, 432143L, 432149L,
-432161L, 432163L, 432167L, 432199L, 432203L, 432227L, 432241L, 432251L, 432277L,
-432281L, 432287L, 432301L, 432317L, 432323L, 432337L, 432343L, 432349L, 432359L,
-432373L, 432389L, 432391L, 432401L, 432413L, 432433L, 432437L, 432449L, 432457L,
-432479L, 432491L, 432499L, 432503L, 432511L, 432527L, 432539L, 432557L, 432559L,
-432569L, 432577L, 432587L, 432589L, 432613L, 432631L, 432637L, 432659L, 432661L,
-432713L, 432721L, 432727L, 432737L, 432743L, 432749L, 432781L, 432793L, 432797L,
-432799L, 432833L, 432847L, 432857L, 432869L, 432893L, 432907L, 432923L, 432931L,
-432959L, 432961L, 432979L, 432983L, 432989L, 433003L, 433033L, 433049L, 433051L,
-433061L, 433073L, 433079L, 433087L, 433093L, 433099L, 433117L, 433123L, 433141L,
-433151L, 433187L, 433193L, 433201L, 433207L, 433229L, 433241L, 433249L, 433253L,
-433259L, 433261L, 433267L, 433271L, 433291L, 433309L, 433319L, 433337L, 433351L,
-433357L, 433361L, 433369L, 433373L, 433393L, 433399L, 433421L, 433429L, 433439L,
-433453L, 433469L, 433471L, 433501L, 433507L, 433513L, 433549L, 433571L, 433577L,
-433607L, 433627L, 433633L, 433639L, 433651L, 433661L, 433663L, 433673L, 433679L,
-433681L, 433703L, 433723L, 433729L, 433747L, 433759L, 433777L, 433781L, 433787L,
-433813L, 433817L, 433847L, 433859L, 433861L, 433877L, 433883L, 433889L, 433931L,
-433943L, 433963L, 433967L, 433981L, 434009L, 434011L, 434029L, 434039L, 434081L,
-434087L, 434107L, 434111L, 434113L, 434117L, 434141L, 434167L, 434179L, 434191L,
-434201L, 434209L, 434221L, 434237L, 434243L, 434249L, 434261L, 434267L, 434293L,
-434297L, 434303L, 434311L, 434323L, 434347L, 434353L, 434363L, 434377L, 434383L,
-434387L, 434389L, 434407L, 434411L, 434431L, 434437L, 434459L, 434461L, 434471L,
-434479L, 434501L, 434509L, 434521L, 434561L, 434563L, 434573L, 434593L, 434597L,
-434611L, 434647L, 434659L, 434683L, 434689L, 434699L, 434717L, 434719L, 434743L,
-434761L, 434783L, 434803L, 434807L, 434813L, 434821L, 434827L, 434831L, 434839L,
-434849L, 434857L, 434867L, 434873L, 434881L, 434909L, 434921L, 434923L, 434927L,
-434933L, 434939L, 434947L, 434957L, 434963L, 434977L, 434981L, 434989L, 435037L,
-435041L, 435059L, 435103L, 435107L, 435109L, 435131L, 435139L, 435143L, 435151L,
-435161L, 435179L, 435181L, 435187L, 435191L, 435221L, 435223L, 435247L, 435257L,
-435263L, 435277L, 435283L, 435287L, 435307L, 435317L, 435343L, 435349L, 435359L,
-435371L, 435397L, 435401L, 435403L, 435419L, 435427L, 435437L, 435439L, 435451L,
-435481L, 435503L, 435529L, 435541L, 435553L, 435559L, 435563L, 435569L, 435571L,
-435577L, 435583L, 435593L, 435619L, 435623L, 435637L, 435641L, 435647L, 435649L,
-435653L, 435661L, 435679L, 435709L, 435731L, 435733L, 435739L, 435751L, 435763L,
-435769L, 435779L, 435817L, 435839L, 435847L, 435857L, 435859L, 435881L, 435889L,
-435893L, 435907L, 435913L, 435923L, 435947L, 435949L, 435973L, 435983L, 435997L,
-436003L, 436013L, 436027L, 436061L, 436081L, 436087L, 436091L, 436097L, 436127L,
-436147L, 436151L, 436157L, 436171L, 436181L, 436217L, 436231L, 436253L, 436273L,
-436279L, 436283L, 436291L, 436307L, 436309L, 436313L, 436343L, 436357L, 436399L,
-436417L, 436427L, 436439L, 436459L, 436463L, 436477L, 436481L, 436483L, 436507L,
-436523L, 436529L, 436531L, 436547L, 436549L, 436571L, 436591L, 436607L, 436621L,
-436627L, 436649L, 436651L, 436673L, 436687L, 436693L, 436717L, 436727L, 436729L,
-436739L, 436741L, 436757L, 436801L, 436811L, 436819L, 436831L, 436841L, 436853L,
-436871L, 436889L, 436913L, 436957L, 436963L, 436967L, 436973L, 436979L, 436993L,
-436999L, 437011L, 437033L, 437071L, 437077L, 437083L, 437093L, 437111L, 437113L,
-437137L, 437141L, 437149L, 437153L, 437159L, 437191L, 437201L, 437219L, 437237L,
-437243L, 437263L, 437273L, 437279L, 437287L, 437293L, 437321L, 437351L, 437357L,
-437363L, 437387L, 437389L, 437401L, 437413L, 437467L, 437471L, 437473L, 437497L,
-437501L, 437509L, 437519L, 437527L, 437533L, 437539L, 437543L, 437557L, 437587L,
-437629L, 437641L, 437651L, 437653L, 437677L, 437681L, 437687L, 437693L, 437719L,
-437729L, 437743L, 437753L, 437771L, 437809L, 437819L, 437837L, 437849L, 437861L,
-437867L, 437881L, 437909L, 437923L, 437947L, 437953L, 437959L, 437977L, 438001L,
-438017L, 438029L, 438047L, 438049L, 438091L, 438131L, 438133L, 438143L, 438169L,
-438203L, 438211L, 438223L, 438233L, 438241L, 438253L, 438259L, 438271L, 438281L,
-438287L, 438301L, 438313L, 438329L, 438341L, 438377L, 438391L, 438401L, 438409L,
-438419L, 438439L, 438443L, 438467L, 438479L, 438499L, 438517L, 438521L, 438523L,
-438527L, 438533L, 438551L, 438569L, 438589L, 438601L, 438611L, 438623L, 438631L,
-438637L, 438661L, 438667L, 438671L, 438701L, 438707L, 438721L, 438733L, 438761L,
-438769L, 438793L, 438827L, 438829L, 438833L, 438847L, 438853L, 438869L, 438877L,
-438887L, 438899L, 438913L, 438937L, 438941L, 438953L, 438961L, 438967L, 438979L,
-438983L, 438989L, 439007L, 439009L, 439063L, 439081L, 439123L, 439133L, 439141L,
-439157L, 439163L, 439171L, 439183L, 439199L, 439217L, 439253L, 439273L, 439279L,
-439289L, 439303L, 439339L, 439349L, 439357L, 439367L, 439381L, 439409L, 439421L,
-439427L, 439429L, 439441L, 439459L, 439463L, 439471L, 439493L, 439511L, 439519L,
-439541L, 439559L, 439567L, 439573L, 439577L, 439583L, 439601L, 439613L, 439631L,
-439639L, 439661L, 439667L, 439687L, 439693L, 439697L, 439709L, 439723L, 439729L,
-439753L, 439759L, 439763L, 439771L, 439781L, 439787L, 439799L, 439811L, 439823L,
-439849L, 439853L, 439861L, 439867L, 439883L, 439891L, 439903L, 439919L, 439949L,
-439961L, 439969L, 439973L, 439981L, 439991L, 440009L, 440023L, 440039L, 440047L,
-440087L, 440093L, 440101L, 440131L, 440159L, 440171L, 440177L, 440179L, 440183L,
-440203L, 440207L, 440221L, 440227L, 440239L, 440261L, 440269L, 440281L, 440303L,
-440311L, 440329L, 440333L, 440339L, 440347L, 440371L, 440383L, 440389L, 440393L,
-440399L, 440431L, 440441L, 440443L, 440471L, 440497L, 440501L, 440507L, 440509L,
-440527L, 440537L, 440543L, 440549L, 440551L, 440567L, 440569L, 440579L, 440581L,
-440641L, 440651L, 440653L, 440669L, 440677L, 440681L, 440683L, 440711L, 440717L,
-440723L, 440731L, 440753L, 440761L, 440773L, 440807L, 440809L, 440821L, 440831L,
-440849L, 440863L, 440893L, 440903L, 440911L, 440939L, 440941L, 440953L, 440959L,
-440983L, 440987L, 440989L, 441011L, 441029L, 441041L, 441043L, 441053L, 441073L,
-441079L, 441101L, 441107L, 441109L, 441113L, 441121L, 441127L, 441157L, 441169L,
-441179L, 441187L, 441191L, 441193L, 441229L, 441247L, 441251L, 441257L, 441263L,
-441281L, 441307L, 441319L, 441349L, 441359L, 441361L, 441403L, 441421L, 441443L,
-441449L, 441461L, 441479L, 441499L, 441517L, 441523L, 441527L, 441547L, 441557L,
-441563L, 441569L, 441587L, 441607L, 441613L, 441619L, 441631L, 441647L, 441667L,
-441697L, 441703L, 441713L, 441737L, 441751L, 441787L, 441797L, 441799L, 441811L,
-441827L, 441829L, 441839L, 441841L, 441877L, 441887L, 441907L, 441913L, 441923L,
-441937L, 441953L, 441971L, 442003L, 442007L, 442009L, 442019L, 442027L, 442031L,
-442033L, 442061L, 442069L, 442097L, 442109L, 442121L, 442139L, 442147L, 442151L,
-442157L, 442171L, 442177L, 442181L, 442193L, 442201L, 442207L, 442217L, 442229L,
-442237L, 442243L, 442271L, 442283L, 442291L, 442319L, 442327L, 442333L, 442363L,
-442367L, 442397L, 442399L, 442439L, 442447L, 442457L, 442469L, 442487L, 442489L,
-442499L, 442501L, 442517L, 442531L, 442537L, 442571L, 442573L, 442577L, 442579L,
-442601L, 442609L, 442619L, 442633L, 442691L, 442699L, 442703L, 442721L, 442733L,
-442747L, 442753L, 442763L, 442769L, 442777L, 442781L, 442789L, 442807L, 442817L,
-442823L, 442829L, 442831L, 442837L, 442843L, 442861L, 442879L, 442903L, 442919L,
-442961L, 442963L, 442973L, 442979L, 442987L, 442991L, 442997L, 443011L, 443017L,
-443039L, 443041L, 443057L, 443059L, 443063L, 443077L, 443089L, 443117L, 443123L,
-443129L, 443147L, 443153L, 443159L, 443161L, 443167L, 443171L, 443189L, 443203L,
-443221L, 443227L, 443231L, 443237L, 443243L, 443249L, 443263L, 443273L, 443281L,
-443291L, 443293L, 443341L, 443347L, 443353L, 443363L, 443369L, 443389L, 443407L,
-443413L, 443419L, 443423L, 443431L, 443437L, 443453L, 443467L, 443489L, 443501L,
-443533L, 443543L, 443551L, 443561L, 443563L, 443567L, 443587L, 443591L, 443603L,
-443609L, 443629L, 443659L, 443687L, 443689L, 443701L, 443711L, 443731L, 443749L,
-443753L, 443759L, 443761L, 443771L, 443777L, 443791L, 443837L, 443851L, 443867L,
-443869L, 443873L, 443879L, 443881L, 443893L, 443899L, 443909L, 443917L, 443939L,
-443941L, 443953L, 443983L, 443987L, 443999L, 444001L, 444007L, 444029L, 444043L,
-444047L, 444079L, 444089L, 444109L, 444113L, 444121L, 444127L, 444131L, 444151L,
-444167L, 444173L, 444179L, 444181L, 444187L, 444209L, 444253L, 444271L, 444281L,
-444287L, 444289L, 444293L, 444307L, 444341L, 444343L, 444347L, 444349L, 444401L,
-444403L, 444421L, 444443L, 444449L, 444461L, 444463L, 444469L, 444473L, 444487L,
-444517L, 444523L, 444527L, 444529L, 444539L, 444547L, 444553L, 444557L, 444569L,
-444589L, 444607L, 444623L, 444637L, 444641L, 444649L, 444671L, 444677L, 444701L,
-444713L, 444739L, 444767L, 444791L, 444793L, 444803L, 444811L, 444817L, 444833L,
-444841L, 444859L, 444863L, 444869L, 444877L, 444883L, 444887L, 444893L, 444901L,
-444929L, 444937L, 444953L, 444967L, 444971L, 444979L, 445001L, 445019L, 445021L,
-445031L, 445033L, 445069L, 445087L, 445091L, 445097L, 445103L, 445141L, 445157L,
-445169L, 445183L, 445187L, 445199L, 445229L, 445261L, 445271L, 445279L, 445283L,
-445297L, 445307L, 445321L, 445339L, 445363L, 445427L, 445433L, 445447L, 445453L,
-445463L, 445477L, 445499L, 445507L, 445537L, 445541L, 445567L, 445573L, 445583L,
-445589L, 445597L, 445619L, 445631L, 445633L, 445649L, 445657L, 445691L, 445699L,
-445703L, 445741L, 445747L, 445769L, 445771L, 445789L, 445799L, 445807L, 445829L,
-445847L, 445853L, 445871L, 445877L, 445883L, 445891L, 445931L, 445937L, 445943L,
-445967L, 445969L, 446003L, 446009L, 446041L, 446053L, 446081L, 446087L, 446111L,
-446123L, 446129L, 446141L, 446179L, 446189L, 446191L, 446197L, 446221L, 446227L,
-446231L, 446261L, 446263L, 446273L, 446279L, 446293L, 446309L, 446323L, 446333L,
-446353L, 446363L, 446387L, 446389L, 446399L, 446401L, 446417L, 446441L, 446447L,
-446461L, 446473L, 446477L, 446503L, 446533L, 446549L, 446561L, 446569L, 446597L,
-446603L, 446609L, 446647L, 446657L, 446713L, 446717L, 446731L, 446753L, 446759L,
-446767L, 446773L, 446819L, 446827L, 446839L, 446863L, 446881L, 446891L, 446893L,
-446909L, 446911L, 446921L, 446933L, 446951L, 446969L, 446983L, 447001L, 447011L,
-447019L, 447053L, 447067L, 447079L, 447101L, 447107L, 447119L, 447133L, 447137L,
-447173L, 447179L, 447193L, 447197L, 447211L, 447217L, 447221L, 447233L, 447247L,
-447257L, 447259L, 447263L, 447311L, 447319L, 447323L, 447331L, 447353L, 447401L,
-447409L, 447427L, 447439L, 447443L, 447449L, 447451L, 447463L, 447467L, 447481L,
-447509L, 447521L, 447527L, 447541L, 447569L, 447571L, 447611L, 447617L, 447637L,
-447641L, 447677L, 447683L, 447701L, 447703L, 447743L, 447749L, 447757L, 447779L,
-447791L, 447793L, 447817L, 447823L, 447827L, 447829L, 447841L, 447859L, 447877L,
-447883L, 447893L, 447901L, 447907L, 447943L, 447961L, 447983L, 447991L, 448003L,
-448013L, 448027L, 448031L, 448057L, 448067L, 448073L, 448093L, 448111L, 448121L,
-448139L, 448141L, 448157L, 448159L, 448169L, 448177L, 448187L, 448193L, 448199L,
-448207L, 448241L, 448249L, 448303L, 448309L, 448313L, 448321L, 448351L, 448363L,
-448367L, 448373L, 448379L, 448387L, 448397L, 448421L, 448451L, 448519L, 448531L,
-448561L, 448597L, 448607L, 448627L, 448631L, 448633L, 448667L, 448687L, 448697L,
-448703L, 448727L, 448733L, 448741L, 448769L, 448793L, 448801L, 448807L, 448829L,
-448843L, 448853L, 448859L, 448867L, 448871L, 448873L, 448879L, 448883L, 448907L,
-448927L, 448939L, 448969L, 448993L, 448997L, 448999L, 449003L, 449011L, 449051L,
-449077L, 449083L, 449093L, 449107L, 449117L, 449129L, 449131L, 449149L, 449153L,
-449161L, 449171L, 449173L, 449201L, 449203L, 449209L, 449227L, 449243L, 449249L,
-449261L, 449263L, 449269L, 449287L, 449299L, 449303L, 449311L, 449321L, 449333L,
-449347L, 449353L, 449363L, 449381L, 449399L, 449411L, 449417L, 449419L, 449437L,
-449441L, 449459L, 449473L, 449543L, 449549L, 449557L, 449563L, 449567L, 449569L,
-449591L, 449609L, 449621L, 449629L, 449653L, 449663L, 449671L, 449677L, 449681L,
-449689L, 449693L, 449699L, 449741L, 449759L, 449767L, 449773L, 449783L, 449797L,
-449807L, 449821L, 449833L, 449851L, 449879L, 449921L, 449929L, 449941L, 449951L,
-449959L, 449963L, 449971L, 449987L, 449989L, 450001L, 450011L, 450019L, 450029L,
-450067L, 450071L, 450077L, 450083L, 450101L, 450103L, 450113L, 450127L, 450137L,
-450161L, 450169L, 450193L, 450199L, 450209L, 450217L, 450223L, 450227L, 450239L,
-450257L, 450259L, 450277L, 450287L, 450293L, 450299L, 450301L, 450311L, 450343L,
-450349L, 450361L, 450367L, 450377L, 450383L, 450391L, 450403L, 450413L, 450421L,
-450431L, 450451L, 450473L, 450479L, 450481L, 450487L, 450493L, 450503L, 450529L,
-450533L, 450557L, 450563L, 450581L, 450587L, 450599L, 450601L, 450617L, 450641L,
-450643L, 450649L, 450677L, 450691L, 450707L, 450719L, 450727L, 450761L, 450767L,
-450787L, 450797L, 450799L, 450803L, 450809L, 450811L, 450817L, 450829L, 450839L,
-450841L, 450847L, 450859L, 450881L, 450883L, 450887L, 450893L, 450899L, 450913L,
-450917L, 450929L, 450943L, 450949L, 450971L, 450991L, 450997L, 451013L, 451039L,
-451051L, 451057L, 451069L, 451093L, 451097L, 451103L, 451109L, 451159L, 451177L,
-451181L, 451183L, 451201L, 451207L, 451249L, 451277L, 451279L, 451301L, 451303L,
-451309L, 451313L, 451331L, 451337L, 451343L, 451361L, 451387L, 451397L, 451411L,
-451439L, 451441L, 451481L, 451499L, 451519L, 451523L, 451541L, 451547L, 451553L,
-451579L, 451601L, 451609L, 451621L, 451637L, 451657L, 451663L, 451667L, 451669L,
-451679L, 451681L, 451691L, 451699L, 451709L, 451723L, 451747L, 451753L, 451771L,
-451783L, 451793L, 451799L, 451823L, 451831L, 451837L, 451859L, 451873L, 451879L,
-451897L, 451901L, 451903L, 451909L, 451921L, 451933L, 451937L, 451939L, 451961L,
-451967L, 451987L, 452009L, 452017L, 452027L, 452033L, 452041L, 452077L, 452083L,
-452087L, 452131L, 452159L, 452161L, 452171L, 452191L, 452201L, 452213L, 452227L,
-452233L, 452239L, 452269L, 452279L, 452293L, 452297L, 452329L, 452363L, 452377L,
-452393L, 452401L, 452443L, 452453L, 452497L, 452519L, 452521L, 452531L, 452533L,
-452537L, 452539L, 452549L, 452579L, 452587L, 452597L, 452611L, 452629L, 452633L,
-452671L, 452687L, 452689L, 452701L, 452731L, 452759L, 452773L, 452797L, 452807L,
-452813L, 452821L, 452831L, 452857L, 452869L, 452873L, 452923L, 452953L, 452957L,
-452983L, 452989L, 453023L, 453029L, 453053L, 453073L, 453107L, 453119L, 453133L,
-453137L, 453143L, 453157L, 453161L, 453181L, 453197L, 453199L, 453209L, 453217L,
-453227L, 453239L, 453247L, 453269L, 453289L, 453293L, 453301L, 453311L, 453317L,
-453329L, 453347L, 453367L, 453371L, 453377L, 453379L, 453421L, 453451L, 453461L,
-453527L, 453553L, 453559L, 453569L, 453571L, 453599L, 453601L, 453617L, 453631L,
-453637L, 453641L, 453643L, 453659L, 453667L, 453671L, 453683L, 453703L, 453707L,
-453709L, 453737L, 453757L, 453797L, 453799L, 453823L, 453833L, 453847L, 453851L,
-453877L, 453889L, 453907L, 453913L, 453923L, 453931L, 453949L, 453961L, 453977L,
-453983L, 453991L, 454009L, 454021L, 454031L, 454033L, 454039L, 454061L, 454063L,
-454079L, 454109L, 454141L, 454151L, 454159L, 454183L, 454199L, 454211L, 454213L,
-454219L, 454229L, 454231L, 454247L, 454253L, 454277L, 454297L, 454303L, 454313L,
-454331L, 454351L, 454357L, 454361L, 454379L, 454387L, 454409L, 454417L, 454451L,
-454453L, 454483L, 454501L, 454507L, 454513L, 454541L, 454543L, 454547L, 454577L,
-454579L, 454603L, 454609L, 454627L, 454637L, 454673L, 454679L, 454709L, 454711L,
-454721L, 454723L, 454759L, 454763L, 454777L, 454799L, 454823L, 454843L, 454847L,
-454849L, 454859L, 454889L, 454891L, 454907L, 454919L, 454921L, 454931L, 454943L,
-454967L, 454969L, 454973L, 454991L, 455003L, 455011L, 455033L, 455047L, 455053L,
-455093L, 455099L, 455123L, 455149L, 455159L, 455167L, 455171L, 455177L, 455201L,
-455219L, 455227L, 455233L, 455237L, 455261L, 455263L, 455269L, 455291L, 455309L,
-455317L, 455321L, 455333L, 455339L, 455341L, 455353L, 455381L, 455393L, 455401L,
-455407L, 455419L, 455431L, 455437L, 455443L, 455461L, 455471L, 455473L, 455479L,
-455489L, 455491L, 455513L, 455527L, 455531L, 455537L, 455557L, 455573L, 455579L,
-455597L, 455599L, 455603L, 455627L, 455647L, 455659L, 455681L, 455683L, 455687L,
-455701L, 455711L, 455717L, 455737L, 455761L, 455783L, 455789L, 455809L, 455827L,
-455831L, 455849L, 455863L, 455881L, 455899L, 455921L, 455933L, 455941L, 455953L,
-455969L, 455977L, 455989L, 455993L, 455999L, 456007L, 456013L, 456023L, 456037L,
-456047L, 456061L, 456091L, 456107L, 456109L, 456119L, 456149L, 456151L, 456167L,
-456193L, 456223L, 456233L, 456241L, 456283L, 456293L, 456329L, 456349L, 456353L,
-456367L, 456377L, 456403L, 456409L, 456427L, 456439L, 456451L, 456457L, 456461L,
-456499L, 456503L, 456517L, 456523L, 456529L, 456539L, 456553L, 456557L, 456559L,
-456571L, 456581L, 456587L, 456607L, 456611L, 456613L, 456623L, 456641L, 456647L,
-456649L, 456653L, 456679L, 456683L, 456697L, 456727L, 456737L, 456763L, 456767L,
-456769L, 456791L, 456809L, 456811L, 456821L, 456871L, 456877L, 456881L, 456899L,
-456901L, 456923L, 456949L, 456959L, 456979L, 456991L, 457001L, 457003L, 457013L,
-457021L, 457043L, 457049L, 457057L, 457087L, 457091L, 457097L, 457099L, 457117L,
-457139L, 457151L, 457153L, 457183L, 457189L, 457201L, 457213L, 457229L, 457241L,
-457253L, 457267L, 457271L, 457277L, 457279L, 457307L, 457319L, 457333L, 457339L,
-457363L, 457367L, 457381L, 457393L, 457397L, 457399L, 457403L, 457411L, 457421L,
-457433L, 457459L, 457469L, 457507L, 457511L, 457517L, 457547L, 457553L, 457559L,
-457571L, 457607L, 457609L, 457621L, 457643L, 457651L, 457661L, 457669L, 457673L,
-457679L, 457687L, 457697L, 457711L, 457739L, 457757L, 457789L, 457799L, 457813L,
-457817L, 457829L, 457837L, 457871L, 457889L, 457903L, 457913L, 457943L, 457979L,
-457981L, 457987L, 458009L, 458027L, 458039L, 458047L, 458053L, 458057L, 458063L,
-458069L, 458119L, 458123L, 458173L, 458179L, 458189L, 458191L, 458197L, 458207L,
-458219L, 458239L, 458309L, 458317L, 458323L, 458327L, 458333L, 458357L, 458363L,
-458377L, 458399L, 458401L, 458407L, 458449L, 458477L, 458483L, 458501L, 458531L,
-458533L, 458543L, 458567L, 458569L, 458573L, 458593L, 458599L, 458611L, 458621L,
-458629L, 458639L, 458651L, 458663L, 458669L, 458683L, 458701L, 458719L, 458729L,
-458747L, 458789L, 458791L, 458797L, 458807L, 458819L, 458849L, 458863L, 458879L,
-458891L, 458897L, 458917L, 458921L, 458929L, 458947L, 458957L, 458959L, 458963L,
-458971L, 458977L, 458981L, 458987L, 458993L, 459007L, 459013L, 459023L, 459029L,
-459031L, 459037L, 459047L, 459089L, 459091L, 459113L, 459127L, 459167L, 459169L,
-459181L, 459209L, 459223L, 459229L, 459233L, 459257L, 459271L, 459293L, 459301L,
-459313L, 459317L, 459337L, 459341L, 459343L, 459353L, 459373L, 459377L, 459383L,
-459397L, 459421L, 459427L, 459443L, 459463L, 459467L, 459469L, 459479L, 459509L,
-459521L, 459523L, 459593L, 459607L, 459611L, 459619L, 459623L, 459631L, 459647L,
-459649L, 459671L, 459677L, 459691L, 459703L, 459749L, 459763L, 459791L, 459803L,
-459817L, 459829L, 459841L, 459847L, 459883L, 459913L, 459923L, 459929L, 459937L,
-459961L, 460013L, 460039L, 460051L, 460063L, 460073L, 460079L, 460081L, 460087L,
-460091L, 460099L, 460111L, 460127L, 460147L, 460157L, 460171L, 460181L, 460189L,
-460211L, 460217L, 460231L, 460247L, 460267L, 460289L, 460297L, 460301L, 460337L,
-460349L, 460373L, 460379L, 460387L, 460393L, 460403L, 460409L, 460417L, 460451L,
-460463L, 460477L, 460531L, 460543L, 460561L, 460571L, 460589L, 460609L, 460619L,
-460627L, 460633L, 460637L, 460643L, 460657L, 460673L, 460697L, 460709L, 460711L,
-460721L, 460771L, 460777L, 460787L, 460793L, 460813L, 460829L, 460841L, 460843L,
-460871L, 460891L, 460903L, 460907L, 460913L, 460919L, 460937L, 460949L, 460951L,
-460969L, 460973L, 460979L, 460981L, 460987L, 460991L, 461009L, 461011L, 461017L,
-461051L, 461053L, 461059L, 461093L, 461101L, 461119L, 461143L, 461147L, 461171L,
-461183L, 461191L, 461207L, 461233L, 461239L, 461257L, 461269L, 461273L, 461297L,
-461299L, 461309L, 461317L, 461323L, 461327L, 461333L, 461359L, 461381L, 461393L,
-461407L, 461411L, 461413L, 461437L, 461441L, 461443L, 461467L, 461479L, 461507L,
-461521L, 461561L, 461569L, 461581L, 461599L, 461603L, 461609L, 461627L, 461639L,
-461653L, 461677L, 461687L, 461689L, 461693L, 461707L, 461717L, 461801L, 461803L,
-461819L, 461843L, 461861L, 461887L, 461891L, 461917L, 461921L, 461933L, 461957L,
-461971L, 461977L, 461983L, 462013L, 462041L, 462067L, 462073L, 462079L, 462097L,
-462103L, 462109L, 462113L, 462131L, 462149L, 462181L, 462191L, 462199L, 462221L,
-462239L, 462263L, 462271L, 462307L, 462311L, 462331L, 462337L, 462361L, 462373L,
-462377L, 462401L, 462409L, 462419L, 462421L, 462437L, 462443L, 462467L, 462481L,
-462491L, 462493L, 462499L, 462529L, 462541L, 462547L, 462557L, 462569L, 462571L,
-462577L, 462589L, 462607L, 462629L, 462641L, 462643L, 462653L, 462659L, 462667L,
-462673L, 462677L, 462697L, 462713L, 462719L, 462727L, 462733L, 462739L, 462773L,
-462827L, 462841L, 462851L, 462863L, 462871L, 462881L, 462887L, 462899L, 462901L,
-462911L, 462937L, 462947L, 462953L, 462983L, 463003L, 463031L, 463033L, 463093L,
-463103L, 463157L, 463181L, 463189L, 463207L, 463213L, 463219L, 463231L, 463237L,
-463247L, 463249L, 463261L, 463283L, 463291L, 463297L, 463303L, 463313L, 463319L,
-463321L, 463339L, 463343L, 463363L, 463387L, 463399L, 463433L, 463447L, 463451L,
-463453L, 463457L, 463459L, 463483L, 463501L, 463511L, 463513L, 463523L, 463531L,
-463537L, 463549L, 463579L, 463613L, 463627L, 463633L, 463643L, 463649L, 463663L,
-463679L, 463693L, 463711L, 463717L, 463741L, 463747L, 463753L, 463763L, 463781L,
-463787L, 463807L, 463823L, 463829L, 463831L, 463849L, 463861L, 463867L, 463873L,
-463889L, 463891L, 463907L, 463919L, 463921L, 463949L, 463963L, 463973L, 463987L,
-463993L, 464003L, 464011L, 464021L, 464033L, 464047L, 464069L, 464081L, 464089L,
-464119L, 464129L, 464131L, 464137L, 464141L, 464143L, 464171L, 464173L, 464197L,
-464201L, 464213L, 464237L, 464251L, 464257L, 464263L, 464279L, 464281L, 464291L,
-464309L, 464311L, 464327L, 464351L, 464371L, 464381L, 464383L, 464413L, 464419L,
-464437L, 464447L, 464459L, 464467L, 464479L, 464483L, 464521L, 464537L, 464539L,
-464549L, 464557L, 464561L, 464587L, 464591L, 464603L, 464617L, 464621L, 464647L,
-464663L, 464687L, 464699L, 464741L, 464747L, 464749L, 464753L, 464767L, 464771L,
-464773L, 464777L, 464801L, 464803L, 464809L, 464813L, 464819L, 464843L, 464857L,
-464879L, 464897L, 464909L, 464917L, 464923L, 464927L, 464939L, 464941L, 464951L,
-464953L, 464963L, 464983L, 464993L, 464999L, 465007L, 465011L, 465013L, 465019L,
-465041L, 465061L, 465067L, 465071L, 465077L, 465079L, 465089L, 465107L, 465119L,
-465133L, 465151L, 465161L, 465163L, 465167L, 465169L, 465173L, 465187L, 465209L,
-465211L, 465259L, 465271L, 465277L, 465281L, 465293L, 465299L, 465317L, 465319L,
-465331L, 465337L, 465373L, 465379L, 465383L, 465407L, 465419L, 465433L, 465463L,
-465469L, 465523L, 465529L, 465541L, 465551L, 465581L, 465587L, 465611L, 465631L,
-465643L, 465649L, 465659L, 465679L, 465701L, 465721L, 465739L, 465743L, 465761L,
-465781L, 465797L, 465799L, 465809L, 465821L, 465833L, 465841L, 465887L, 465893L,
-465901L, 465917L, 465929L, 465931L, 465947L, 465977L, 465989L, 466009L, 466019L,
-466027L, 466033L, 466043L, 466061L, 466069L, 466073L, 466079L, 466087L, 466091L,
-466121L, 466139L, 466153L, 466171L, 466181L, 466183L, 466201L, 466243L, 466247L,
-466261L, 466267L, 466273L, 466283L, 466303L, 466321L, 466331L, 466339L, 466357L,
-466369L, 466373L, 466409L, 466423L, 466441L, 466451L, 466483L, 466517L, 466537L,
-466547L, 466553L, 466561L, 466567L, 466573L, 466579L, 466603L, 466619L, 466637L,
-466649L, 466651L, 466673L, 466717L, 466723L, 466729L, 466733L, 466747L, 466751L,
-466777L, 466787L, 466801L, 466819L, 466853L, 466859L, 466897L, 466909L, 466913L,
-466919L, 466951L, 466957L, 466997L, 467003L, 467009L, 467017L, 467021L, 467063L,
-467081L, 467083L, 467101L, 467119L, 467123L, 467141L, 467147L, 467171L, 467183L,
-467197L, 467209L, 467213L, 467237L, 467239L, 467261L, 467293L, 467297L, 467317L,
-467329L, 467333L, 467353L, 467371L, 467399L, 467417L, 467431L, 467437L, 467447L,
-467471L, 467473L, 467477L, 467479L, 467491L, 467497L, 467503L, 467507L, 467527L,
-467531L, 467543L, 467549L, 467557L, 467587L, 467591L, 467611L, 467617L, 467627L,
-467629L, 467633L, 467641L, 467651L, 467657L, 467669L, 467671L, 467681L, 467689L,
-467699L, 467713L, 467729L, 467737L, 467743L, 467749L, 467773L, 467783L, 467813L,
-467827L, 467833L, 467867L, 467869L, 467879L, 467881L, 467893L, 467897L, 467899L,
-467903L, 467927L, 467941L, 467953L, 467963L, 467977L, 468001L, 468011L, 468019L,
-468029L, 468049L, 468059L, 468067L, 468071L, 468079L, 468107L, 468109L, 468113L,
-468121L, 468133L, 468137L, 468151L, 468157L, 468173L, 468187L, 468191L, 468199L,
-468239L, 468241L, 468253L, 468271L, 468277L, 468289L, 468319L, 468323L, 468353L,
-468359L, 468371L, 468389L, 468421L, 468439L, 468451L, 468463L, 468473L, 468491L,
-468493L, 468499L, 468509L, 468527L, 468551L, 468557L, 468577L, 468581L, 468593L,
-468599L, 468613L, 468619L, 468623L, 468641L, 468647L, 468653L, 468661L, 468667L,
-468683L, 468691L, 468697L, 468703L, 468709L, 468719L, 468737L, 468739L, 468761L,
-468773L, 468781L, 468803L, 468817L, 468821L, 468841L, 468851L, 468859L, 468869L,
-468883L, 468887L, 468889L, 468893L, 468899L, 468913L, 468953L, 468967L, 468973L,
-468983L, 469009L, 469031L, 469037L, 469069L, 469099L, 469121L, 469127L, 469141L,
-469153L, 469169L, 469193L, 469207L, 469219L, 469229L, 469237L, 469241L, 469253L,
-469267L, 469279L, 469283L, 469303L, 469321L, 469331L, 469351L, 469363L, 469367L,
-469369L, 469379L, 469397L, 469411L, 469429L, 469439L, 469457L, 469487L, 469501L,
-469529L, 469541L, 469543L, 469561L, 469583L, 469589L, 469613L, 469627L, 469631L,
-469649L, 469657L, 469673L, 469687L, 469691L, 469717L, 469723L, 469747L, 469753L,
-469757L, 469769L, 469787L, 469793L, 469801L, 469811L, 469823L, 469841L, 469849L,
-469877L, 469879L, 469891L, 469907L, 469919L, 469939L, 469957L, 469969L, 469979L,
-469993L, 470021L, 470039L, 470059L, 470077L, 470081L, 470083L, 470087L, 470089L,
-470131L, 470149L, 470153L, 470161L, 470167L, 470179L, 470201L, 470207L, 470209L,
-470213L, 470219L, 470227L, 470243L, 470251L, 470263L, 470279L, 470297L, 470299L,
-470303L, 470317L, 470333L, 470347L, 470359L, 470389L, 470399L, 470411L, 470413L,
-470417L, 470429L, 470443L, 470447L, 470453L, 470461L, 470471L, 470473L, 470489L,
-470501L, 470513L, 470521L, 470531L, 470539L, 470551L, 470579L, 470593L, 470597L,
-470599L, 470609L, 470621L, 470627L, 470647L, 470651L, 470653L, 470663L, 470669L,
-470689L, 470711L, 470719L, 470731L, 470749L, 470779L, 470783L, 470791L, 470819L,
-470831L, 470837L, 470863L, 470867L, 470881L, 470887L, 470891L, 470903L, 470927L,
-470933L, 470941L, 470947L, 470957L, 470959L, 470993L, 470999L, 471007L, 471041L,
-471061L, 471073L, 471089L, 471091L, 471101L, 471137L, 471139L, 471161L, 471173L,
-471179L, 471187L, 471193L, 471209L, 471217L, 471241L, 471253L, 471259L, 471277L,
-471281L, 471283L, 471299L, 471301L, 471313L, 471353L, 471389L, 471391L, 471403L,
-471407L, 471439L, 471451L, 471467L, 471481L, 471487L, 471503L, 471509L, 471521L,
-471533L, 471539L, 471553L, 471571L, 471589L, 471593L, 471607L, 471617L, 471619L,
-471641L, 471649L, 471659L, 471671L, 471673L, 471677L, 471683L, 471697L, 471703L,
-471719L, 471721L, 471749L, 471769L, 471781L, 471791L, 471803L, 471817L, 471841L,
-471847L, 471853L, 471871L, 471893L, 471901L, 471907L, 471923L, 471929L, 471931L,
-471943L, 471949L, 471959L, 471997L, 472019L, 472027L, 472051L, 472057L, 472063L,
-472067L, 472103L, 472111L, 472123L, 472127L, 472133L, 472139L, 472151L, 472159L,
-472163L, 472189L, 472193L, 472247L, 472249L, 472253L, 472261L, 472273L, 472289L,
-472301L, 472309L, 472319L, 472331L, 472333L, 472349L, 472369L, 472391L, 472393L,
-472399L, 472411L, 472421L, 472457L, 472469L, 472477L, 472523L, 472541L, 472543L,
-472559L, 472561L, 472573L, 472597L, 472631L, 472639L, 472643L, 472669L, 472687L,
-472691L, 472697L, 472709L, 472711L, 472721L, 472741L, 472751L, 472763L, 472793L,
-472799L, 472817L, 472831L, 472837L, 472847L, 472859L, 472883L, 472907L, 472909L,
-472921L, 472937L, 472939L, 472963L, 472993L, 473009L, 473021L, 473027L, 473089L,
-473101L, 473117L, 473141L, 473147L, 473159L, 473167L, 473173L, 473191L, 473197L,
-473201L, 473203L, 473219L, 473227L, 473257L, 473279L, 473287L, 473293L, 473311L,
-473321L, 473327L, 473351L, 473353L, 473377L, 473381L, 473383L, 473411L, 473419L,
-473441L, 473443L, 473453L, 473471L, 473477L, 473479L, 473497L, 473503L, 473507L,
-473513L, 473519L, 473527L, 473531L, 473533L, 473549L, 473579L, 473597L, 473611L,
-473617L, 473633L, 473647L, 473659L, 473719L, 473723L, 473729L, 473741L, 473743L,
-473761L, 473789L, 473833L, 473839L, 473857L, 473861L, 473867L, 473887L, 473899L,
-473911L, 473923L, 473927L, 473929L, 473939L, 473951L, 473953L, 473971L, 473981L,
-473987L, 473999L, 474017L, 474029L, 474037L, 474043L, 474049L, 474059L, 474073L,
-474077L, 474101L, 474119L, 474127L, 474137L, 474143L, 474151L, 474163L, 474169L,
-474197L, 474211L, 474223L, 474241L, 474263L, 474289L, 474307L, 474311L, 474319L,
-474337L, 474343L, 474347L, 474359L, 474379L, 474389L, 474391L, 474413L, 474433L,
-474437L, 474443L, 474479L, 474491L, 474497L, 474499L, 474503L, 474533L, 474541L,
-474547L, 474557L, 474569L, 474571L, 474581L, 474583L, 474619L, 474629L, 474647L,
-474659L, 474667L, 474671L, 474707L, 474709L, 474737L, 474751L, 474757L, 474769L,
-474779L, 474787L, 474809L, 474811L, 474839L, 474847L, 474857L, 474899L, 474907L,
-474911L, 474917L, 474923L, 474931L, 474937L, 474941L, 474949L, 474959L, 474977L,
-474983L, 475037L, 475051L, 475073L, 475081L, 475091L, 475093L, 475103L, 475109L,
-475141L, 475147L, 475151L, 475159L, 475169L, 475207L, 475219L, 475229L, 475243L,
-475271L, 475273L, 475283L, 475289L, 475297L, 475301L, 475327L, 475331L, 475333L,
-475351L, 475367L, 475369L, 475379L, 475381L, 475403L, 475417L, 475421L, 475427L,
-475429L, 475441L, 475457L, 475469L, 475483L, 475511L, 475523L, 475529L, 475549L,
-475583L, 475597L, 475613L, 475619L, 475621L, 475637L, 475639L, 475649L, 475669L,
-475679L, 475681L, 475691L, 475693L, 475697L, 475721L, 475729L, 475751L, 475753L,
-475759L, 475763L, 475777L, 475789L, 475793L, 475807L, 475823L, 475831L, 475837L,
-475841L, 475859L, 475877L, 475879L, 475889L, 475897L, 475903L, 475907L, 475921L,
-475927L, 475933L, 475957L, 475973L, 475991L, 475997L, 476009L, 476023L, 476027L,
-476029L, 476039L, 476041L, 476059L, 476081L, 476087L, 476089L, 476101L, 476107L,
-476111L, 476137L, 476143L, 476167L, 476183L, 476219L, 476233L, 476237L, 476243L,
-476249L, 476279L, 476299L, 476317L, 476347L, 476351L, 476363L, 476369L, 476381L,
-476401L, 476407L, 476419L, 476423L, 476429L, 476467L, 476477L, 476479L, 476507L,
-476513L, 476519L, 476579L, 476587L, 476591L, 476599L, 476603L, 476611L, 476633L,
-476639L, 476647L, 476659L, 476681L, 476683L, 476701L, 476713L, 476719L, 476737L,
-476743L, 476753L, 476759L, 476783L, 476803L, 476831L, 476849L, 476851L, 476863L,
-476869L, 476887L, 476891L, 476911L, 476921L, 476929L, 476977L, 476981L, 476989L,
-477011L, 477013L, 477017L, 477019L, 477031L, 477047L, 477073L, 477077L, 477091L,
-477131L, 477149L, 477163L, 477209L, 477221L, 477229L, 477259L, 477277L, 477293L,
-477313L, 477317L, 477329L, 477341L, 477359L, 477361L, 477383L, 477409L, 477439L,
-477461L, 477469L, 477497L, 477511L, 477517L, 477523L, 477539L, 477551L, 477553L,
-477557L, 477571L, 477577L, 477593L, 477619L, 477623L, 477637L, 477671L, 477677L,
-477721L, 477727L, 477731L, 477739L, 477767L, 477769L, 477791L, 477797L, 477809L,
-477811L, 477821L, 477823L, 477839L, 477847L, 477857L, 477863L, 477881L, 477899L,
-477913L, 477941L, 477947L, 477973L, 477977L, 477991L, 478001L, 478039L, 478063L,
-478067L, 478069L, 478087L, 478099L, 478111L, 478129L, 478139L, 478157L, 478169L,
-478171L, 478189L, 478199L, 478207L, 478213L, 478241L, 478243L, 478253L, 478259L,
-478271L, 478273L, 478321L, 478339L, 478343L, 478351L, 478391L, 478399L, 478403L,
-478411L, 478417L, 478421L, 478427L, 478433L, 478441L, 478451L, 478453L, 478459L,
-478481L, 478483L, 478493L, 478523L, 478531L, 478571L, 478573L, 478579L, 478589L,
-478603L, 478627L, 478631L, 478637L, 478651L, 478679L, 478697L, 478711L, 478727L,
-478729L, 478739L, 478741L, 478747L, 478763L, 478769L, 478787L, 478801L, 478811L,
-478813L, 478823L, 478831L, 478843L, 478853L, 478861L, 478871L, 478879L, 478897L,
-478901L, 478913L, 478927L, 478931L, 478937L, 478943L, 478963L, 478967L, 478991L,
-478999L, 479023L, 479027L, 479029L, 479041L, 479081L, 479131L, 479137L, 479147L,
-479153L, 479189L, 479191L, 479201L, 479209L, 479221L, 479231L, 479239L, 479243L,
-479263L, 479267L, 479287L, 479299L, 479309L, 479317L, 479327L, 479357L, 479371L,
-479377L, 479387L, 479419L, 479429L, 479431L, 479441L, 479461L, 479473L, 479489L,
-479497L, 479509L, 479513L, 479533L, 479543L, 479561L, 479569L, 479581L, 479593L,
-479599L, 479623L, 479629L, 479639L, 479701L, 479749L, 479753L, 479761L, 479771L,
-479777L, 479783L, 479797L, 479813L, 479821L, 479833L, 479839L, 479861L, 479879L,
-479881L, 479891L, 479903L, 479909L, 479939L, 479951L, 479953L, 479957L, 479971L,
-480013L, 480017L, 480019L, 480023L, 480043L, 480047L, 480049L, 480059L, 480061L,
-480071L, 480091L, 480101L, 480107L, 480113L, 480133L, 480143L, 480157L, 480167L,
-480169L, 480203L, 480209L, 480287L, 480299L, 480317L, 480329L, 480341L, 480343L,
-480349L, 480367L, 480373L, 480379L, 480383L, 480391L, 480409L, 480419L, 480427L,
-480449L, 480451L, 480461L, 480463L, 480499L, 480503L, 480509L, 480517L, 480521L,
-480527L, 480533L, 480541L, 480553L, 480563L, 480569L, 480583L, 480587L, 480647L,
-480661L, 480707L, 480713L, 480731L, 480737L, 480749L, 480761L, 480773L, 480787L,
-480803L, 480827L, 480839L, 480853L, 480881L, 480911L, 480919L, 480929L, 480937L,
-480941L, 480959L, 480967L, 480979L, 480989L, 481001L, 481003L, 481009L, 481021L,
-481043L, 481051L, 481067L, 481073L, 481087L, 481093L, 481097L, 481109L, 481123L,
-481133L, 481141L, 481147L, 481153L, 481157L, 481171L, 481177L, 481181L, 481199L,
-481207L, 481211L, 481231L, 481249L, 481297L, 481301L, 481303L, 481307L, 481343L,
-481363L, 481373L, 481379L, 481387L, 481409L, 481417L, 481433L, 481447L, 481469L,
-481489L, 481501L, 481513L, 481531L, 481549L, 481571L, 481577L, 481589L, 481619L,
-481633L, 481639L, 481651L, 481667L, 481673L, 481681L, 481693L, 481697L, 481699L,
-481721L, 481751L, 481753L, 481769L, 481787L, 481801L, 481807L, 481813L, 481837L,
-481843L, 481847L, 481849L, 481861L, 481867L, 481879L, 481883L, 481909L, 481939L,
-481963L, 481997L, 482017L, 482021L, 482029L, 482033L, 482039L, 482051L, 482071L,
-482093L, 482099L, 482101L, 482117L, 482123L, 482179L, 482189L, 482203L, 482213L,
-482227L, 482231L, 482233L, 482243L, 482263L, 482281L, 482309L, 482323L, 482347L,
-482351L, 482359L, 482371L, 482387L, 482393L, 482399L, 482401L, 482407L, 482413L,
-482423L, 482437L, 482441L, 482483L, 482501L, 482507L, 482509L, 482513L, 482519L,
-482527L, 482539L, 482569L, 482593L, 482597L, 482621L, 482627L, 482633L, 482641L,
-482659L, 482663L, 482683L, 482687L, 482689L, 482707L, 482711L, 482717L, 482719L,
-482731L, 482743L, 482753L, 482759L, 482767L, 482773L, 482789L, 482803L, 482819L,
-482827L, 482837L, 482861L, 482863L, 482873L, 482897L, 482899L, 482917L, 482941L,
-482947L, 482957L, 482971L, 483017L, 483031L, 483061L, 483071L, 483097L, 483127L,
-483139L, 483163L, 483167L, 483179L, 483209L, 483211L, 483221L, 483229L, 483233L,
-483239L, 483247L, 483251L, 483281L, 483289L, 483317L, 483323L, 483337L, 483347L,
-483367L, 483377L, 483389L, 483397L, 483407L, 483409L, 483433L, 483443L, 483467L,
-483481L, 483491L, 483499L, 483503L, 483523L, 483541L, 483551L, 483557L, 483563L,
-483577L, 483611L, 483619L, 483629L, 483643L, 483649L, 483671L, 483697L, 483709L,
-483719L, 483727L, 483733L, 483751L, 483757L, 483761L, 483767L, 483773L, 483787L,
-483809L, 483811L, 483827L, 483829L, 483839L, 483853L, 483863L, 483869L, 483883L,
-483907L, 483929L, 483937L, 483953L, 483971L, 483991L, 484019L, 484027L, 484037L,
-484061L, 484067L, 484079L, 484091L, 484111L, 484117L, 484123L, 484129L, 484151L,
-484153L, 484171L, 484181L, 484193L, 484201L, 484207L, 484229L, 484243L, 484259L,
-484283L, 484301L, 484303L, 484327L, 484339L, 484361L, 484369L, 484373L, 484397L,
-484411L, 484417L, 484439L, 484447L, 484457L, 484459L, 484487L, 484489L, 484493L,
-484531L, 484543L, 484577L, 484597L, 484607L, 484609L, 484613L, 484621L, 484639L,
-484643L, 484691L, 484703L, 484727L, 484733L, 484751L, 484763L, 484769L, 484777L,
-484787L, 484829L, 484853L, 484867L, 484927L, 484951L, 484987L, 484999L, 485021L,
-485029L, 485041L, 485053L, 485059L, 485063L, 485081L, 485101L, 485113L, 485123L,
-485131L, 485137L, 485161L, 485167L, 485171L, 485201L, 485207L, 485209L, 485263L,
-485311L, 485347L, 485351L, 485363L, 485371L, 485383L, 485389L, 485411L, 485417L,
-485423L, 485437L, 485447L, 485479L, 485497L, 485509L, 485519L, 485543L, 485567L,
-485587L, 485593L, 485603L, 485609L, 485647L, 485657L, 485671L, 485689L, 485701L,
-485717L, 485729L, 485731L, 485753L, 485777L, 485819L, 485827L, 485831L, 485833L,
-485893L, 485899L, 485909L, 485923L, 485941L, 485959L, 485977L, 485993L, 486023L,
-486037L, 486041L, 486043L, 486053L, 486061L, 486071L, 486091L, 486103L, 486119L,
-486133L, 486139L, 486163L, 486179L, 486181L, 486193L, 486203L, 486221L, 486223L,
-486247L, 486281L, 486293L, 486307L, 486313L, 486323L, 486329L, 486331L, 486341L,
-486349L, 486377L, 486379L, 486389L, 486391L, 486397L, 486407L, 486433L, 486443L,
-486449L, 486481L, 486491L, 486503L, 486509L, 486511L, 486527L, 486539L, 486559L,
-486569L, 486583L, 486589L, 486601L, 486617L, 486637L, 486641L, 486643L, 486653L,
-486667L, 486671L, 486677L, 486679L, 486683L, 486697L, 486713L, 486721L, 486757L,
-486767L, 486769L, 486781L, 486797L, 486817L, 486821L, 486833L, 486839L, 486869L,
-486907L, 486923L, 486929L, 486943L, 486947L, 486949L, 486971L, 486977L, 486991L,
-487007L, 487013L, 487021L, 487049L, 487051L, 487057L, 487073L, 487079L, 487093L,
-487099L, 487111L, 487133L, 487177L, 487183L, 487187L, 487211L, 487213L, 487219L,
-487247L, 487261L, 487283L, 487303L, 487307L, 487313L, 487349L, 487363L, 487381L,
-487387L, 487391L, 487397L, 487423L, 487427L, 487429L, 487447L, 487457L, 487463L,
-487469L, 487471L, 487477L, 487481L, 487489L, 487507L, 487561L, 487589L, 487601L,
-487603L, 487607L, 487637L, 487649L, 487651L, 487657L, 487681L, 487691L, 487703L,
-487709L, 487717L, 487727L, 487733L, 487741L, 487757L, 487769L, 487783L, 487789L,
-487793L, 487811L, 487819L, 487829L, 487831L, 487843L, 487873L, 487889L, 487891L,
-487897L, 487933L, 487943L, 487973L, 487979L, 487997L, 488003L, 488009L, 488011L,
-488021L, 488051L, 488057L, 488069L, 488119L, 488143L, 488149L, 488153L, 488161L,
-488171L, 488197L, 488203L, 488207L, 488209L, 488227L, 488231L, 488233L, 488239L,
-488249L, 488261L, 488263L, 488287L, 488303L, 488309L, 488311L, 488317L, 488321L,
-488329L, 488333L, 488339L, 488347L, 488353L, 488381L, 488399L, 488401L, 488407L,
-488417L, 488419L, 488441L, 488459L, 488473L, 488503L, 488513L, 488539L, 488567L,
-488573L, 488603L, 488611L, 488617L, 488627L, 488633L, 488639L, 488641L, 488651L,
-488687L, 488689L, 488701L, 488711L, 488717L, 488723L, 488729L, 488743L, 488749L,
-488759L, 488779L, 488791L, 488797L, 488821L, 488827L, 488833L, 488861L, 488879L,
-488893L, 488897L, 488909L, 488921L, 488947L, 488959L, 488981L, 488993L, 489001L,
-489011L, 489019L, 489043L, 489053L, 489061L, 489101L, 489109L, 489113L, 489127L,
-489133L, 489157L, 489161L, 489179L, 489191L, 489197L, 489217L, 489239L, 489241L,
-489257L, 489263L, 489283L, 489299L, 489329L, 489337L, 489343L, 489361L, 489367L,
-489389L, 489407L, 489409L, 489427L, 489431L, 489439L, 489449L, 489457L, 489479L,
-489487L, 489493L, 489529L, 489539L, 489551L, 489553L, 489557L, 489571L, 489613L,
-489631L, 489653L, 489659L, 489673L, 489677L, 489679L, 489689L, 489691L, 489733L,
-489743L, 489761L, 489791L, 489793L, 489799L, 489803L, 489817L, 489823L, 489833L,
-489847L, 489851L, 489869L, 489871L, 489887L, 489901L, 489911L, 489913L, 489941L,
-489943L, 489959L, 489961L, 489977L, 489989L, 490001L, 490003L, 490019L, 490031L,
-490033L, 490057L, 490097L, 490103L, 490111L, 490117L, 490121L, 490151L, 490159L,
-490169L, 490183L, 490201L, 490207L, 490223L, 490241L, 490247L, 490249L, 490267L,
-490271L, 490277L, 490283L, 490309L, 490313L, 490339L, 490367L, 490393L, 490417L,
-490421L, 490453L, 490459L, 490463L, 490481L, 490493L, 490499L, 490519L, 490537L,
-490541L, 490543L, 490549L, 490559L, 490571L, 490573L, 490577L, 490579L, 490591L,
-490619L, 490627L, 490631L, 490643L, 490661L, 490663L, 490697L, 490733L, 490741L,
-490769L, 490771L, 490783L, 490829L, 490837L, 490849L, 490859L, 490877L, 490891L,
-490913L, 490921L, 490927L, 490937L, 490949L, 490951L, 490957L, 490967L, 490969L,
-490991L, 490993L, 491003L, 491039L, 491041L, 491059L, 491081L, 491083L, 491129L,
-491137L, 491149L, 491159L, 491167L, 491171L, 491201L, 491213L, 491219L, 491251L,
-491261L, 491273L, 491279L, 491297L, 491299L, 491327L, 491329L, 491333L, 491339L,
-491341L, 491353L, 491357L, 491371L, 491377L, 491417L, 491423L, 491429L, 491461L,
-491483L, 491489L, 491497L, 491501L, 491503L, 491527L, 491531L, 491537L, 491539L,
-491581L, 491591L, 491593L, 491611L, 491627L, 491633L, 491639L, 491651L, 491653L,
-491669L, 491677L, 491707L, 491719L, 491731L, 491737L, 491747L, 491773L, 491783L,
-491789L, 491797L, 491819L, 491833L, 491837L, 491851L, 491857L, 491867L, 491873L,
-491899L, 491923L, 491951L, 491969L, 491977L, 491983L, 492007L, 492013L, 492017L,
-492029L, 492047L, 492053L, 492059L, 492061L, 492067L, 492077L, 492083L, 492103L,
-492113L, 492227L, 492251L, 492253L, 492257L, 492281L, 492293L, 492299L, 492319L,
-492377L, 492389L, 492397L, 492403L, 492409L, 492413L, 492421L, 492431L, 492463L,
-492467L, 492487L, 492491L, 492511L, 492523L, 492551L, 492563L, 492587L, 492601L,
-492617L, 492619L, 492629L, 492631L, 492641L, 492647L, 492659L, 492671L, 492673L,
-492707L, 492719L, 492721L, 492731L, 492757L, 492761L, 492763L, 492769L, 492781L,
-492799L, 492839L, 492853L, 492871L, 492883L, 492893L, 492901L, 492911L, 492967L,
-492979L, 493001L, 493013L, 493021L, 493027L, 493043L, 493049L, 493067L, 493093L,
-493109L, 493111L, 493121L, 493123L, 493127L, 493133L, 493139L, 493147L, 493159L,
-493169L, 493177L, 493193L, 493201L, 493211L, 493217L, 493219L, 493231L, 493243L,
-493249L, 493277L, 493279L, 493291L, 493301L, 493313L, 493333L, 493351L, 493369L,
-493393L, 493397L, 493399L, 493403L, 493433L, 493447L, 493457L, 493463L, 493481L,
-493523L, 493531L, 493541L, 493567L, 493573L, 493579L, 493583L, 493607L, 493621L,
-493627L, 493643L, 493657L, 493693L, 493709L, 493711L, 493721L, 493729L, 493733L,
-493747L, 493777L, 493793L, 493807L, 493811L, 493813L, 493817L, 493853L, 493859L,
-493873L, 493877L, 493897L, 493919L, 493931L, 493937L, 493939L, 493967L, 493973L,
-493979L, 493993L, 494023L, 494029L, 494041L, 494051L, 494069L, 494077L, 494083L,
-494093L, 494101L, 494107L, 494129L, 494141L, 494147L, 494167L, 494191L, 494213L,
-494237L, 494251L, 494257L, 494267L, 494269L, 494281L, 494287L, 494317L, 494327L,
-494341L, 494353L, 494359L, 494369L, 494381L, 494383L, 494387L, 494407L, 494413L,
-494441L, 494443L, 494471L, 494497L, 494519L, 494521L, 494539L, 494561L, 494563L,
-494567L, 494587L, 494591L, 494609L, 494617L, 494621L, 494639L, 494647L, 494651L,
-494671L, 494677L, 494687L, 494693L, 494699L, 494713L, 494719L, 494723L, 494731L,
-494737L, 494743L, 494749L, 494759L, 494761L, 494783L, 494789L, 494803L, 494843L,
-494849L, 494873L, 494899L, 494903L, 494917L, 494927L, 494933L, 494939L, 494959L,
-494987L, 495017L, 495037L, 495041L, 495043L, 495067L, 495071L, 495109L, 495113L,
-495119L, 495133L, 495139L, 495149L, 495151L, 495161L, 495181L, 495199L, 495211L,
-495221L, 495241L, 495269L, 495277L, 495289L, 495301L, 495307L, 495323L, 495337L,
-495343L, 495347L, 495359L, 495361L, 495371L, 495377L, 495389L, 495401L, 495413L,
-495421L, 495433L, 495437L, 495449L, 495457L, 495461L, 495491L, 495511L, 495527L,
-495557L, 495559L, 495563L, 495569L, 495571L, 495587L, 495589L, 495611L, 495613L,
-495617L, 495619L, 495629L, 495637L, 495647L, 495667L, 495679L, 495701L, 495707L,
-495713L, 495749L, 495751L, 495757L, 495769L, 495773L, 495787L, 495791L, 495797L,
-495799L, 495821L, 495827L, 495829L, 495851L, 495877L, 495893L, 495899L, 495923L,
-495931L, 495947L, 495953L, 495959L, 495967L, 495973L, 495983L, 496007L, 496019L,
-496039L, 496051L, 496063L, 496073L, 496079L, 496123L, 496127L, 496163L, 496187L,
-496193L, 496211L, 496229L, 496231L, 496259L, 496283L, 496289L, 496291L, 496297L,
-496303L, 496313L, 496333L, 496339L, 496343L, 496381L, 496399L, 496427L, 496439L,
-496453L, 496459L, 496471L, 496477L, 496481L, 496487L, 496493L, 496499L, 496511L,
-496549L, 496579L, 496583L, 496609L, 496631L, 496669L, 496681L, 496687L, 496703L,
-496711L, 496733L, 496747L, 496763L, 496789L, 496813L, 496817L, 496841L, 496849L,
-496871L, 496877L, 496889L, 496891L, 496897L, 496901L, 496913L, 496919L, 496949L,
-496963L, 496997L, 496999L, 497011L, 497017L, 497041L, 497047L, 497051L, 497069L,
-497093L, 497111L, 497113L, 497117L, 497137L, 497141L, 497153L, 497171L, 497177L,
-497197L, 497239L, 497257L, 497261L, 497269L, 497279L, 497281L, 497291L, 497297L,
-497303L, 497309L, 497323L, 497339L, 497351L, 497389L, 497411L, 497417L, 497423L,
-497449L, 497461L, 497473L, 497479L, 497491L, 497501L, 497507L, 497509L, 497521L,
-497537L, 497551L, 497557L, 497561L, 497579L, 497587L, 497597L, 497603L, 497633L,
-497659L, 497663L, 497671L, 497677L, 497689L, 497701L, 497711L, 497719L, 497729L,
-497737L, 497741L, 497771L, 497773L, 497801L, 497813L, 497831L, 497839L, 497851L,
-497867L, 497869L, 497873L, 497899L, 497929L, 497957L, 497963L, 497969L, 497977L,
-497989L, 497993L, 497999L, 498013L, 498053L, 498061L, 498073L, 498089L, 498101L,
-498103L, 498119L, 498143L, 498163L, 498167L, 498181L, 498209L, 498227L, 498257L,
-498259L, 498271L, 498301L, 498331L, 498343L, 498361L, 498367L, 498391L, 498397L,
-498401L, 498403L, 498409L, 498439L, 498461L, 498467L, 498469L, 498493L, 498497L,
-498521L, 498523L, 498527L, 498551L, 498557L, 498577L, 498583L, 498599L, 498611L,
-498613L, 498643L, 498647L, 498653L, 498679L, 498689L, 498691L, 498733L, 498739L,
-498749L, 498761L, 498767L, 498779L, 498781L, 498787L, 498791L, 498803L, 498833L,
-498857L, 498859L, 498881L, 498907L, 498923L, 498931L, 498937L, 498947L, 498961L,
-498973L, 498977L, 498989L, 499021L, 499027L, 499033L, 499039L, 499063L, 499067L,
-499099L, 499117L, 499127L, 499129L, 499133L, 499139L, 499141L, 499151L, 499157L,
-499159L, 499181L, 499183L, 499189L, 499211L, 499229L, 499253L, 499267L, 499277L,
-499283L, 499309L, 499321L, 499327L, 499349L, 499361L, 499363L, 499391L, 499397L,
-499403L, 499423L, 499439L, 499459L, 499481L, 499483L, 499493L, 499507L, 499519L,
-499523L, 499549L, 499559L, 499571L, 499591L, 499601L, 499607L, 499621L, 499633L,
-499637L, 499649L, 499661L, 499663L, 499669L, 499673L, 499679L, 499687L, 499691L,
-499693L, 499711L, 499717L, 499729L, 499739L, 499747L, 499781L, 499787L, 499801L,
-499819L, 499853L, 499879L, 499883L, 499897L, 499903L, 499927L, 499943L, 499957L,
-499969L, 499973L, 499979L, 500009L, 500029L, 500041L, 500057L, 500069L, 500083L,
-500107L, 500111L, 500113L, 500119L, 500153L, 500167L, 500173L, 500177L, 500179L,
-500197L, 500209L, 500231L, 500233L, 500237L, 500239L, 500249L, 500257L, 500287L,
-500299L, 500317L, 500321L, 500333L, 500341L, 500363L, 500369L, 500389L, 500393L,
-500413L, 500417L, 500431L, 500443L, 500459L, 500471L, 500473L, 500483L, 500501L,
-500509L, 500519L, 500527L, 500567L, 500579L, 500587L, 500603L, 500629L, 500671L,
-500677L, 500693L, 500699L, 500713L, 500719L, 500723L, 500729L, 500741L, 500777L,
-500791L, 500807L, 500809L, 500831L, 500839L, 500861L, 500873L, 500881L, 500887L,
-500891L, 500909L, 500911L, 500921L, 500923L, 500933L, 500947L, 500953L, 500957L,
-500977L, 501001L, 501013L, 501019L, 501029L, 501031L, 501037L, 501043L, 501077L,
-501089L, 501103L, 501121L, 501131L, 501133L, 501139L, 501157L, 501173L, 501187L,
-501191L, 501197L, 501203L, 501209L, 501217L, 501223L, 501229L, 501233L, 501257L,
-501271L, 501287L, 501299L, 501317L, 501341L, 501343L, 501367L, 501383L, 501401L,
-501409L, 501419L, 501427L, 501451L, 501463L, 501493L, 501503L, 501511L, 501563L,
-501577L, 501593L, 501601L, 501617L, 501623L, 501637L, 501659L, 501691L, 501701L,
-501703L, 501707L, 501719L, 501731L, 501769L, 501779L, 501803L, 501817L, 501821L,
-501827L, 501829L, 501841L, 501863L, 501889L, 501911L, 501931L, 501947L, 501953L,
-501967L, 501971L, 501997L, 502001L, 502013L, 502039L, 502043L, 502057L, 502063L,
-502079L, 502081L, 502087L, 502093L, 502121L, 502133L, 502141L, 502171L, 502181L,
-502217L, 502237L, 502247L, 502259L, 502261L, 502277L, 502301L, 502321L, 502339L,
-502393L, 502409L, 502421L, 502429L, 502441L, 502451L, 502487L, 502499L, 502501L,
-502507L, 502517L, 502543L, 502549L, 502553L, 502591L, 502597L, 502613L, 502631L,
-502633L, 502643L, 502651L, 502669L, 502687L, 502699L, 502703L, 502717L, 502729L,
-502769L, 502771L, 502781L, 502787L, 502807L, 502819L, 502829L, 502841L, 502847L,
-502861L, 502883L, 502919L, 502921L, 502937L, 502961L, 502973L, 503003L, 503017L,
-503039L, 503053L, 503077L, 503123L, 503131L, 503137L, 503147L, 503159L, 503197L,
-503207L, 503213L, 503227L, 503231L, 503233L, 503249L, 503267L, 503287L, 503297L,
-503303L, 503317L, 503339L, 503351L, 503359L, 503369L, 503381L, 503383L, 503389L,
-503407L, 503413L, 503423L, 503431L, 503441L, 503453L, 503483L, 503501L, 503543L,
-503549L, 503551L, 503563L, 503593L, 503599L, 503609L, 503611L, 503621L, 503623L,
-503647L, 503653L, 503663L, 503707L, 503717L, 503743L, 503753L, 503771L, 503777L,
-503779L, 503791L, 503803L, 503819L, 503821L, 503827L, 503851L, 503857L, 503869L,
-503879L, 503911L, 503927L, 503929L, 503939L, 503947L, 503959L, 503963L, 503969L,
-503983L, 503989L, 504001L, 504011L, 504017L, 504047L, 504061L, 504073L, 504103L,
-504121L, 504139L, 504143L, 504149L, 504151L, 504157L, 504181L, 504187L, 504197L,
-504209L, 504221L, 504247L, 504269L, 504289L, 504299L, 504307L, 504311L, 504323L,
-504337L, 504349L, 504353L, 504359L, 504377L, 504379L, 504389L, 504403L, 504457L,
-504461L, 504473L, 504479L, 504521L, 504523L, 504527L, 504547L, 504563L, 504593L,
-504599L, 504607L, 504617L, 504619L, 504631L, 504661L, 504667L, 504671L, 504677L,
-504683L, 504727L, 504767L, 504787L, 504797L, 504799L, 504817L, 504821L, 504851L,
-504853L, 504857L, 504871L, 504877L, 504893L, 504901L, 504929L, 504937L, 504943L,
-504947L, 504953L, 504967L, 504983L, 504989L, 504991L, 505027L, 505031L, 505033L,
-505049L, 505051L, 505061L, 505067L, 505073L, 505091L, 505097L, 505111L, 505117L,
-505123L, 505129L, 505139L, 505157L, 505159L, 505181L, 505187L, 505201L, 505213L,
-505231L, 505237L, 505277L, 505279L, 505283L, 505301L, 505313L, 505319L, 505321L,
-505327L, 505339L, 505357L, 505367L, 505369L, 505399L, 505409L, 505411L, 505429L,
-505447L, 505459L, 505469L, 505481L, 505493L, 505501L, 505511L, 505513L, 505523L,
-505537L, 505559L, 505573L, 505601L, 505607L, 505613L, 505619L, 505633L, 505639L,
-505643L, 505657L, 505663L, 505669L, 505691L, 505693L, 505709L, 505711L, 505727L,
-505759L, 505763L, 505777L, 505781L, 505811L, 505819L, 505823L, 505867L, 505871L,
-505877L, 505907L, 505919L, 505927L, 505949L, 505961L, 505969L, 505979L, 506047L,
-506071L, 506083L, 506101L, 506113L, 506119L, 506131L, 506147L, 506171L, 506173L,
-506183L, 506201L, 506213L, 506251L, 506263L, 506269L, 506281L, 506291L, 506327L,
-506329L, 506333L, 506339L, 506347L, 506351L, 506357L, 506381L, 506393L, 506417L,
-506423L, 506449L, 506459L, 506461L, 506479L, 506491L, 506501L, 506507L, 506531L,
-506533L, 506537L, 506551L, 506563L, 506573L, 506591L, 506593L, 506599L, 506609L,
-506629L, 506647L, 506663L, 506683L, 506687L, 506689L, 506699L, 506729L, 506731L,
-506743L, 506773L, 506783L, 506791L, 506797L, 506809L, 506837L, 506843L, 506861L,
-506873L, 506887L, 506893L, 506899L, 506903L, 506911L, 506929L, 506941L, 506963L,
-506983L, 506993L, 506999L, 507029L, 507049L, 507071L, 507077L, 507079L, 507103L,
-507109L, 507113L, 507119L, 507137L, 507139L, 507149L, 507151L, 507163L, 507193L,
-507197L, 507217L, 507289L, 507301L, 507313L, 507317L, 507329L, 507347L, 507349L,
-507359L, 507361L, 507371L, 507383L, 507401L, 507421L, 507431L, 507461L, 507491L,
-507497L, 507499L, 507503L, 507523L, 507557L, 507571L, 507589L, 507593L, 507599L,
-507607L, 507631L, 507641L, 507667L, 507673L, 507691L, 507697L, 507713L, 507719L,
-507743L, 507757L, 507779L, 507781L, 507797L, 507803L, 507809L, 507821L, 507827L,
-507839L, 507883L, 507901L, 507907L, 507917L, 507919L, 507937L, 507953L, 507961L,
-507971L, 507979L, 508009L, 508019L, 508021L, 508033L, 508037L, 508073L, 508087L,
-508091L, 508097L, 508103L, 508129L, 508159L, 508171L, 508187L, 508213L, 508223L,
-508229L, 508237L, 508243L, 508259L, 508271L, 508273L, 508297L, 508301L, 508327L,
-508331L, 508349L, 508363L, 508367L, 508373L, 508393L, 508433L, 508439L, 508451L,
-508471L, 508477L, 508489L, 508499L, 508513L, 508517L, 508531L, 508549L, 508559L,
-508567L, 508577L, 508579L, 508583L, 508619L, 508621L, 508637L, 508643L, 508661L,
-508693L, 508709L, 508727L, 508771L, 508789L, 508799L, 508811L, 508817L, 508841L,
-508847L, 508867L, 508901L, 508903L, 508909L, 508913L, 508919L, 508931L, 508943L,
-508951L, 508957L, 508961L, 508969L, 508973L, 508987L, 509023L, 509027L, 509053L,
-509063L, 509071L, 509087L, 509101L, 509123L, 509137L, 509147L, 509149L, 509203L,
-509221L, 509227L, 509239L, 509263L, 509281L, 509287L, 509293L, 509297L, 509317L,
-509329L, 509359L, 509363L, 509389L, 509393L, 509413L, 509417L, 509429L, 509441L,
-509449L, 509477L, 509513L, 509521L, 509543L, 509549L, 509557L, 509563L, 509569L,
-509573L, 509581L, 509591L, 509603L, 509623L, 509633L, 509647L, 509653L, 509659L,
-509681L, 509687L, 509689L, 509693L, 509699L, 509723L, 509731L, 509737L, 509741L,
-509767L, 509783L, 509797L, 509801L, 509833L, 509837L, 509843L, 509863L, 509867L,
-509879L, 509909L, 509911L, 509921L, 509939L, 509947L, 509959L, 509963L, 509989L,
-510007L, 510031L, 510047L, 510049L, 510061L, 510067L, 510073L, 510077L, 510079L,
-510089L, 510101L, 510121L, 510127L, 510137L, 510157L, 510179L, 510199L, 510203L,
-510217L, 510227L, 510233L, 510241L, 510247L, 510253L, 510271L, 510287L, 510299L,
-510311L, 510319L, 510331L, 510361L, 510379L, 510383L, 510401L, 510403L, 510449L,
-510451L, 510457L, 510463L, 510481L, 510529L, 510551L, 510553L, 510569L, 510581L,
-510583L, 510589L, 510611L, 510613L, 510617L, 510619L, 510677L, 510683L, 510691L,
-510707L, 510709L, 510751L, 510767L, 510773L, 510793L, 510803L, 510817L, 510823L,
-510827L, 510847L, 510889L, 510907L, 510919L, 510931L, 510941L, 510943L, 510989L,
-511001L, 511013L, 511019L, 511033L, 511039L, 511057L, 511061L, 511087L, 511109L,
-511111L, 511123L, 511151L, 511153L, 511163L, 511169L, 511171L, 511177L, 511193L,
-511201L, 511211L, 511213L, 511223L, 511237L, 511243L, 511261L, 511279L, 511289L,
-511297L, 511327L, 511333L, 511337L, 511351L, 511361L, 511387L, 511391L, 511409L,
-511417L, 511439L, 511447L, 511453L, 511457L, 511463L, 511477L, 511487L, 511507L,
-511519L, 511523L, 511541L, 511549L, 511559L, 511573L, 511579L, 511583L, 511591L,
-511603L, 511627L, 511631L, 511633L, 511669L, 511691L, 511703L, 511711L, 511723L,
-511757L, 511787L, 511793L, 511801L, 511811L, 511831L, 511843L, 511859L, 511867L,
-511873L, 511891L, 511897L, 511909L, 511933L, 511939L, 511961L, 511963L, 511991L,
-511997L, 512009L, 512011L, 512021L, 512047L, 512059L, 512093L, 512101L, 512137L,
-512147L, 512167L, 512207L, 512249L, 512251L, 512269L, 512287L, 512311L, 512321L,
-512333L, 512353L, 512389L, 512419L, 512429L, 512443L, 512467L, 512497L, 512503L,
-512507L, 512521L, 512531L, 512537L, 512543L, 512569L, 512573L, 512579L, 512581L,
-512591L, 512593L, 512597L, 512609L, 512621L, 512641L, 512657L, 512663L, 512671L,
-512683L, 512711L, 512713L, 512717L, 512741L, 512747L, 512761L, 512767L, 512779L,
-512797L, 512803L, 512819L, 512821L, 512843L, 512849L, 512891L, 512899L, 512903L,
-512917L, 512921L, 512927L, 512929L, 512959L, 512977L, 512989L, 512999L, 513001L,
-513013L, 513017L, 513031L, 513041L, 513047L, 513053L, 513059L, 513067L, 513083L,
-513101L, 513103L, 513109L, 513131L, 513137L, 513157L, 513167L, 513169L, 513173L,
-513203L, 513239L, 513257L, 513269L, 513277L, 513283L, 513307L, 513311L, 513313L,
-513319L, 513341L, 513347L, 513353L, 513367L, 513371L, 513397L, 513407L, 513419L,
-513427L, 513431L, 513439L, 513473L, 513479L, 513481L, 513509L, 513511L, 513529L,
-513533L, 513593L, 513631L, 513641L, 513649L, 513673L, 513679L, 513683L, 513691L,
-513697L, 513719L, 513727L, 513731L, 513739L, 513749L, 513761L, 513767L, 513769L,
-513781L, 513829L, 513839L, 513841L, 513871L, 513881L, 513899L, 513917L, 513923L,
-513937L, 513943L, 513977L, 513991L, 514001L, 514009L, 514013L, 514021L, 514049L,
-514051L, 514057L, 514061L, 514079L, 514081L, 514093L, 514103L, 514117L, 514123L,
-514127L, 514147L, 514177L, 514187L, 514201L, 514219L, 514229L, 514243L, 514247L,
-514249L, 514271L, 514277L, 514289L, 514309L, 514313L, 514333L, 514343L, 514357L,
-514361L, 514379L, 514399L, 514417L, 514429L, 514433L, 514453L, 514499L, 514513L,
-514519L, 514523L, 514529L, 514531L, 514543L, 514561L, 514571L, 514621L, 514637L,
-514639L, 514643L, 514649L, 514651L, 514669L, 514681L, 514711L, 514733L, 514739L,
-514741L, 514747L, 514751L, 514757L, 514769L, 514783L, 514793L, 514819L, 514823L,
-514831L, 514841L, 514847L, 514853L, 514859L, 514867L, 514873L, 514889L, 514903L,
-514933L, 514939L, 514949L, 514967L, 515041L, 515087L, 515089L, 515111L, 515143L,
-515149L, 515153L, 515173L, 515191L, 515227L, 515231L, 515233L, 515237L, 515279L,
-515293L, 515311L, 515323L, 515351L, 515357L, 515369L, 515371L, 515377L, 515381L,
-515401L, 515429L, 515477L, 515507L, 515519L, 515539L, 515563L, 515579L, 515587L,
-515597L, 515611L, 515621L, 515639L, 515651L, 515653L, 515663L, 515677L, 515681L,
-515687L, 515693L, 515701L, 515737L, 515741L, 515761L, 515771L, 515773L, 515777L,
-515783L, 515803L, 515813L, 515839L, 515843L, 515857L, 515861L, 515873L, 515887L,
-515917L, 515923L, 515929L, 515941L, 515951L, 515969L, 515993L, 516017L, 516023L,
-516049L, 516053L, 516077L, 516091L, 516127L, 516151L, 516157L, 516161L, 516163L,
-516169L, 516179L, 516193L, 516199L, 516209L, 516223L, 516227L, 516233L, 516247L,
-516251L, 516253L, 516277L, 516283L, 516293L, 516319L, 516323L, 516349L, 516359L,
-516361L, 516371L, 516377L, 516391L, 516407L, 516421L, 516431L, 516433L, 516437L,
-516449L, 516457L, 516469L, 516493L, 516499L, 516517L, 516521L, 516539L, 516541L,
-516563L, 516587L, 516589L, 516599L, 516611L, 516617L, 516619L, 516623L, 516643L,
-516653L, 516673L, 516679L, 516689L, 516701L, 516709L, 516713L, 516721L, 516727L,
-516757L, 516793L, 516811L, 516821L, 516829L, 516839L, 516847L, 516871L, 516877L,
-516883L, 516907L, 516911L, 516931L, 516947L, 516949L, 516959L, 516973L, 516977L,
-516979L, 516991L, 517003L, 517043L, 517061L, 517067L, 517073L, 517079L, 517081L,
-517087L, 517091L, 517129L, 517151L, 517169L, 517177L, 517183L, 517189L, 517207L,
-517211L, 517217L, 517229L, 517241L, 517243L, 517249L, 517261L, 517267L, 517277L,
-517289L, 517303L, 517337L, 517343L, 517367L, 517373L, 517381L, 517393L, 517399L,
-517403L, 517411L, 517417L, 517457L, 517459L, 517469L, 517471L, 517481L, 517487L,
-517499L, 517501L, 517507L, 517511L, 517513L, 517547L, 517549L, 517553L, 517571L,
-517577L, 517589L, 517597L, 517603L, 517609L, 517613L, 517619L, 517637L, 517639L,
-517711L, 517717L, 517721L, 517729L, 517733L, 517739L, 517747L, 517817L, 517823L,
-517831L, 517861L, 517873L, 517877L, 517901L, 517919L, 517927L, 517931L, 517949L,
-517967L, 517981L, 517991L, 517999L, 518017L, 518047L, 518057L, 518059L, 518083L,
-518099L, 518101L, 518113L, 518123L, 518129L, 518131L, 518137L, 518153L, 518159L,
-518171L, 518179L, 518191L, 518207L, 518209L, 518233L, 518237L, 518239L, 518249L,
-518261L, 518291L, 518299L, 518311L, 518327L, 518341L, 518387L, 518389L, 518411L,
-518417L, 518429L, 518431L, 518447L, 518467L, 518471L, 518473L, 518509L, 518521L,
-518533L, 518543L, 518579L, 518587L, 518597L, 518611L, 518621L, 518657L, 518689L,
-518699L, 518717L, 518729L, 518737L, 518741L, 518743L, 518747L, 518759L, 518761L,
-518767L, 518779L, 518801L, 518803L, 518807L, 518809L, 518813L, 518831L, 518863L,
-518867L, 518893L, 518911L, 518933L, 518953L, 518981L, 518983L, 518989L, 519011L,
-519031L, 519037L, 519067L, 519083L, 519089L, 519091L, 519097L, 519107L, 519119L,
-519121L, 519131L, 519151L, 519161L, 519193L, 519217L, 519227L, 519229L, 519247L,
-519257L, 519269L, 519283L, 519287L, 519301L, 519307L, 519349L, 519353L, 519359L,
-519371L, 519373L, 519383L, 519391L, 519413L, 519427L, 519433L, 519457L, 519487L,
-519499L, 519509L, 519521L, 519523L, 519527L, 519539L, 519551L, 519553L, 519577L,
-519581L, 519587L, 519611L, 519619L, 519643L, 519647L, 519667L, 519683L, 519691L,
-519703L, 519713L, 519733L, 519737L, 519769L, 519787L, 519793L, 519797L, 519803L,
-519817L, 519863L, 519881L, 519889L, 519907L, 519917L, 519919L, 519923L, 519931L,
-519943L, 519947L, 519971L, 519989L, 519997L, 520019L, 520021L, 520031L, 520043L,
-520063L, 520067L, 520073L, 520103L, 520111L, 520123L, 520129L, 520151L, 520193L,
-520213L, 520241L, 520279L, 520291L, 520297L, 520307L, 520309L, 520313L, 520339L,
-520349L, 520357L, 520361L, 520363L, 520369L, 520379L, 520381L, 520393L, 520409L,
-520411L, 520423L, 520427L, 520433L, 520447L, 520451L, 520529L, 520547L, 520549L,
-520567L, 520571L, 520589L, 520607L, 520609L, 520621L, 520631L, 520633L, 520649L,
-520679L, 520691L, 520699L, 520703L, 520717L, 520721L, 520747L, 520759L, 520763L,
-520787L, 520813L, 520837L, 520841L, 520853L, 520867L, 520889L, 520913L, 520921L,
-520943L, 520957L, 520963L, 520967L, 520969L, 520981L, 521009L, 521021L, 521023L,
-521039L, 521041L, 521047L, 521051L, 521063L, 521107L, 521119L, 521137L, 521153L,
-521161L, 521167L, 521173L, 521177L, 521179L, 521201L, 521231L, 521243L, 521251L,
-521267L, 521281L, 521299L, 521309L, 521317L, 521329L, 521357L, 521359L, 521363L,
-521369L, 521377L, 521393L, 521399L, 521401L, 521429L, 521447L, 521471L, 521483L,
-521491L, 521497L, 521503L, 521519L, 521527L, 521533L, 521537L, 521539L, 521551L,
-521557L, 521567L, 521581L, 521603L, 521641L, 521657L, 521659L, 521669L, 521671L,
-521693L, 521707L, 521723L, 521743L, 521749L, 521753L, 521767L, 521777L, 521789L,
-521791L, 521809L, 521813L, 521819L, 521831L, 521861L, 521869L, 521879L, 521881L,
-521887L, 521897L, 521903L, 521923L, 521929L, 521981L, 521993L, 521999L, 522017L,
-522037L, 522047L, 522059L, 522061L, 522073L, 522079L, 522083L, 522113L, 522127L,
-522157L, 522161L, 522167L, 522191L, 522199L, 522211L, 522227L, 522229L, 522233L,
-522239L, 522251L, 522259L, 522281L, 522283L, 522289L, 522317L, 522323L, 522337L,
-522371L, 522373L, 522383L, 522391L, 522409L, 522413L, 522439L, 522449L, 522469L,
-522479L, 522497L, 522517L, 522521L, 522523L, 522541L, 522553L, 522569L, 522601L,
-522623L, 522637L, 522659L, 522661L, 522673L, 522677L, 522679L, 522689L, 522703L,
-522707L, 522719L, 522737L, 522749L, 522757L, 522761L, 522763L, 522787L, 522811L,
-522827L, 522829L, 522839L, 522853L, 522857L, 522871L, 522881L, 522883L, 522887L,
-522919L, 522943L, 522947L, 522959L, 522961L, 522989L, 523007L, 523021L, 523031L,
-523049L, 523093L, 523097L, 523109L, 523129L, 523169L, 523177L, 523207L, 523213L,
-523219L, 523261L, 523297L, 523307L, 523333L, 523349L, 523351L, 523357L, 523387L,
-523403L, 523417L, 523427L, 523433L, 523459L, 523463L, 523487L, 523489L, 523493L,
-523511L, 523519L, 523541L, 523543L, 523553L, 523571L, 523573L, 523577L, 523597L,
-523603L, 523631L, 523637L, 523639L, 523657L, 523667L, 523669L, 523673L, 523681L,
-523717L, 523729L, 523741L, 523759L, 523763L, 523771L, 523777L, 523793L, 523801L,
-523829L, 523847L, 523867L, 523877L, 523903L, 523907L, 523927L, 523937L, 523949L,
-523969L, 523987L, 523997L, 524047L, 524053L, 524057L, 524063L, 524071L, 524081L,
-524087L, 524099L, 524113L, 524119L, 524123L, 524149L, 524171L, 524189L, 524197L,
-524201L, 524203L, 524219L, 524221L, 524231L, 524243L, 524257L, 524261L, 524269L,
-524287L, 524309L, 524341L, 524347L, 524351L, 524353L, 524369L, 524387L, 524389L,
-524411L, 524413L, 524429L, 524453L, 524497L, 524507L, 524509L, 524519L, 524521L,
-524591L, 524593L, 524599L, 524633L, 524669L, 524681L, 524683L, 524701L, 524707L,
-524731L, 524743L, 524789L, 524801L, 524803L, 524827L, 524831L, 524857L, 524863L,
-524869L, 524873L, 524893L, 524899L, 524921L, 524933L, 524939L, 524941L, 524947L,
-524957L, 524959L, 524963L, 524969L, 524971L, 524981L, 524983L, 524999L, 525001L,
-525013L, 525017L, 525029L, 525043L, 525101L, 525127L, 525137L, 525143L, 525157L,
-525163L, 525167L, 525191L, 525193L, 525199L, 525209L, 525221L, 525241L, 525247L,
-525253L, 525257L, 525299L, 525313L, 525353L, 525359L, 525361L, 525373L, 525377L,
-525379L, 525391L, 525397L, 525409L, 525431L, 525433L, 525439L, 525457L, 525461L,
-525467L, 525491L, 525493L, 525517L, 525529L, 525533L, 525541L, 525571L, 525583L,
-525593L, 525599L, 525607L, 525641L, 525649L, 525671L, 525677L, 525697L, 525709L,
-525713L, 525719L, 525727L, 525731L, 525739L, 525769L, 525773L, 525781L, 525809L,
-525817L, 525839L, 525869L, 525871L, 525887L, 525893L, 525913L, 525923L, 525937L,
-525947L, 525949L, 525953L, 525961L, 525979L, 525983L, 526027L, 526037L, 526049L,
-526051L, 526063L, 526067L, 526069L, 526073L, 526087L, 526117L, 526121L, 526139L,
-526157L, 526159L, 526189L, 526193L, 526199L, 526213L, 526223L, 526231L, 526249L,
-526271L, 526283L, 526289L, 526291L, 526297L, 526307L, 526367L, 526373L, 526381L,
-526387L, 526391L, 526397L, 526423L, 526429L, 526441L, 526453L, 526459L, 526483L,
-526499L, 526501L, 526511L, 526531L, 526543L, 526571L, 526573L, 526583L, 526601L,
-526619L, 526627L, 526633L, 526637L, 526649L, 526651L, 526657L, 526667L, 526679L,
-526681L, 526703L, 526709L, 526717L, 526733L, 526739L, 526741L, 526759L, 526763L,
-526777L, 526781L, 526829L, 526831L, 526837L, 526853L, 526859L, 526871L, 526909L,
-526913L, 526931L, 526937L, 526943L, 526951L, 526957L, 526963L, 526993L, 526997L,
-527053L, 527057L, 527063L, 527069L, 527071L, 527081L, 527099L, 527123L, 527129L,
-527143L, 527159L, 527161L, 527173L, 527179L, 527203L, 527207L, 527209L, 527237L,
-527251L, 527273L, 527281L, 527291L, 527327L, 527333L, 527347L, 527353L, 527377L,
-527381L, 527393L, 527399L, 527407L, 527411L, 527419L, 527441L, 527447L, 527453L,
-527489L, 527507L, 527533L, 527557L, 527563L, 527581L, 527591L, 527599L, 527603L,
-527623L, 527627L, 527633L, 527671L, 527699L, 527701L, 527729L, 527741L, 527749L,
-527753L, 527789L, 527803L, 527809L, 527819L, 527843L, 527851L, 527869L, 527881L,
-527897L, 527909L, 527921L, 527929L, 527941L, 527981L, 527983L, 527987L, 527993L,
-528001L, 528013L, 528041L, 528043L, 528053L, 528091L, 528097L, 528107L, 528127L,
-528131L, 528137L, 528163L, 528167L, 528191L, 528197L, 528217L, 528223L, 528247L,
-528263L, 528289L, 528299L, 528313L, 528317L, 528329L, 528373L, 528383L, 528391L,
-528401L, 528403L, 528413L, 528419L, 528433L, 528469L, 528487L, 528491L, 528509L,
-528511L, 528527L, 528559L, 528611L, 528623L, 528629L, 528631L, 528659L, 528667L,
-528673L, 528679L, 528691L, 528707L, 528709L, 528719L, 528763L, 528779L, 528791L,
-528799L, 528811L, 528821L, 528823L, 528833L, 528863L, 528877L, 528881L, 528883L,
-528911L, 528929L, 528947L, 528967L, 528971L, 528973L, 528991L, 529003L, 529007L,
-529027L, 529033L, 529037L, 529043L, 529049L, 529051L, 529097L, 529103L, 529117L,
-529121L, 529127L, 529129L, 529153L, 529157L, 529181L, 529183L, 529213L, 529229L,
-529237L, 529241L, 529259L, 529271L, 529273L, 529301L, 529307L, 529313L, 529327L,
-529343L, 529349L, 529357L, 529381L, 529393L, 529411L, 529421L, 529423L, 529471L,
-529489L, 529513L, 529517L, 529519L, 529531L, 529547L, 529577L, 529579L, 529603L,
-529619L, 529637L, 529649L, 529657L, 529673L, 529681L, 529687L, 529691L, 529693L,
-529709L, 529723L, 529741L, 529747L, 529751L, 529807L, 529811L, 529813L, 529819L,
-529829L, 529847L, 529871L, 529927L, 529933L, 529939L, 529957L, 529961L, 529973L,
-529979L, 529981L, 529987L, 529999L, 530017L, 530021L, 530027L, 530041L, 530051L,
-530063L, 530087L, 530093L, 530129L, 530137L, 530143L, 530177L, 530183L, 530197L,
-530203L, 530209L, 530227L, 530237L, 530249L, 530251L, 530261L, 530267L, 530279L,
-530293L, 530297L, 530303L, 530329L, 530333L, 530339L, 530353L, 530359L, 530389L,
-530393L, 530401L, 530429L, 530443L, 530447L, 530501L, 530507L, 530513L, 530527L,
-530531L, 530533L, 530539L, 530549L, 530567L, 530597L, 530599L, 530603L, 530609L,
-530641L, 530653L, 530659L, 530669L, 530693L, 530701L, 530711L, 530713L, 530731L,
-530741L, 530743L, 530753L, 530767L, 530773L, 530797L, 530807L, 530833L, 530837L,
-530843L, 530851L, 530857L, 530861L, 530869L, 530897L, 530911L, 530947L, 530969L,
-530977L, 530983L, 530989L, 531017L, 531023L, 531043L, 531071L, 531079L, 531101L,
-531103L, 531121L, 531133L, 531143L, 531163L, 531169L, 531173L, 531197L, 531203L,
-531229L, 531239L, 531253L, 531263L, 531281L, 531287L, 531299L, 531331L, 531337L,
-531343L, 531347L, 531353L, 531359L, 531383L, 531457L, 531481L, 531497L, 531521L,
-531547L, 531551L, 531569L, 531571L, 531581L, 531589L, 531611L, 531613L, 531623L,
-531631L, 531637L, 531667L, 531673L, 531689L, 531701L, 531731L, 531793L, 531799L,
-531821L, 531823L, 531827L, 531833L, 531841L, 531847L, 531857L, 531863L, 531871L,
-531877L, 531901L, 531911L, 531919L, 531977L, 531983L, 531989L, 531997L, 532001L,
-532009L, 532027L, 532033L, 532061L, 532069L, 532093L, 532099L, 532141L, 532153L,
-532159L, 532163L, 532183L, 532187L, 532193L, 532199L, 532241L, 532249L, 532261L,
-532267L, 532277L, 532283L, 532307L, 532313L, 532327L, 532331L, 532333L, 532349L,
-532373L, 532379L, 532391L, 532403L, 532417L, 532421L, 532439L, 532447L, 532451L,
-532453L, 532489L, 532501L, 532523L, 532529L, 532531L, 532537L, 532547L, 532561L,
-532601L, 532603L, 532607L, 532619L, 532621L, 532633L, 532639L, 532663L, 532669L,
-532687L, 532691L, 532709L, 532733L, 532739L, 532751L, 532757L, 532771L, 532781L,
-532783L, 532789L, 532801L, 532811L, 532823L, 532849L, 532853L, 532867L, 532907L,
-532919L, 532949L, 532951L, 532981L, 532993L, 532999L, 533003L, 533009L, 533011L,
-533033L, 533051L, 533053L, 533063L, 533077L, 533089L, 533111L, 533129L, 533149L,
-533167L, 533177L, 533189L, 533191L, 533213L, 533219L, 533227L, 533237L, 533249L,
-533257L, 533261L, 533263L, 533297L, 533303L, 533317L, 533321L, 533327L, 533353L,
-533363L, 533371L, 533389L, 533399L, 533413L, 533447L, 533453L, 533459L, 533509L,
-533543L, 533549L, 533573L, 533581L, 533593L, 533633L, 533641L, 533671L, 533693L,
-533711L, 533713L, 533719L, 533723L, 533737L, 533747L, 533777L, 533801L, 533809L,
-533821L, 533831L, 533837L, 533857L, 533879L, 533887L, 533893L, 533909L, 533921L,
-533927L, 533959L, 533963L, 533969L, 533971L, 533989L, 533993L, 533999L, 534007L,
-534013L, 534019L, 534029L, 534043L, 534047L, 534049L, 534059L, 534073L, 534077L,
-534091L, 534101L, 534113L, 534137L, 534167L, 534173L, 534199L, 534203L, 534211L,
-534229L, 534241L, 534253L, 534283L, 534301L, 534307L, 534311L, 534323L, 534329L,
-534341L, 534367L, 534371L, 534403L, 534407L, 534431L, 534439L, 534473L, 534491L,
-534511L, 534529L, 534553L, 534571L, 534577L, 534581L, 534601L, 534607L, 534617L,
-534629L, 534631L, 534637L, 534647L, 534649L, 534659L, 534661L, 534671L, 534697L,
-534707L, 534739L, 534799L, 534811L, 534827L, 534839L, 534841L, 534851L, 534857L,
-534883L, 534889L, 534913L, 534923L, 534931L, 534943L, 534949L, 534971L, 535013L,
-535019L, 535033L, 535037L, 535061L, 535099L, 535103L, 535123L, 535133L, 535151L,
-535159L, 535169L, 535181L, 535193L, 535207L, 535219L, 535229L, 535237L, 535243L,
-535273L, 535303L, 535319L, 535333L, 535349L, 535351L, 535361L, 535387L, 535391L,
-535399L, 535481L, 535487L, 535489L, 535499L, 535511L, 535523L, 535529L, 535547L,
-535571L, 535573L, 535589L, 535607L, 535609L, 535627L, 535637L, 535663L, 535669L,
-535673L, 535679L, 535697L, 535709L, 535727L, 535741L, 535751L, 535757L, 535771L,
-535783L, 535793L, 535811L, 535849L, 535859L, 535861L, 535879L, 535919L, 535937L,
-535939L, 535943L, 535957L, 535967L, 535973L, 535991L, 535999L, 536017L, 536023L,
-536051L, 536057L, 536059L, 536069L, 536087L, 536099L, 536101L, 536111L, 536141L,
-536147L, 536149L, 536189L, 536191L, 536203L, 536213L, 536219L, 536227L, 536233L,
-536243L, 536267L, 536273L, 536279L, 536281L, 536287L, 536293L, 536311L, 536323L,
-536353L, 536357L, 536377L, 536399L, 536407L, 536423L, 536441L, 536443L, 536447L,
-536449L, 536453L, 536461L, 536467L, 536479L, 536491L, 536509L, 536513L, 536531L,
-536533L, 536561L, 536563L, 536593L, 536609L, 536621L, 536633L, 536651L, 536671L,
-536677L, 536687L, 536699L, 536717L, 536719L, 536729L, 536743L, 536749L, 536771L,
-536773L, 536777L, 536779L, 536791L, 536801L, 536803L, 536839L, 536849L, 536857L,
-536867L, 536869L, 536891L, 536909L, 536917L, 536923L, 536929L, 536933L, 536947L,
-536953L, 536971L, 536989L, 536999L, 537001L, 537007L, 537011L, 537023L, 537029L,
-537037L, 537041L, 537067L, 537071L, 537079L, 537091L, 537127L, 537133L, 537143L,
-537157L, 537169L, 537181L, 537191L, 537197L, 537221L, 537233L, 537241L, 537269L,
-537281L, 537287L, 537307L, 537331L, 537343L, 537347L, 537373L, 537379L, 537401L,
-537403L, 537413L, 537497L, 537527L, 537547L, 537569L, 537583L, 537587L, 537599L,
-537611L, 537637L, 537661L, 537673L, 537679L, 537703L, 537709L, 537739L, 537743L,
-537749L, 537769L, 537773L, 537781L, 537787L, 537793L, 537811L, 537841L, 537847L,
-537853L, 537877L, 537883L, 537899L, 537913L, 537919L, 537941L, 537991L, 538001L,
-538019L, 538049L, 538051L, 538073L, 538079L, 538093L, 538117L, 538121L, 538123L,
-538127L, 538147L, 538151L, 538157L, 538159L, 538163L, 538199L, 538201L, 538247L,
-538249L, 538259L, 538267L, 538283L, 538297L, 538301L, 538303L, 538309L, 538331L,
-538333L, 538357L, 538367L, 538397L, 538399L, 538411L, 538423L, 538457L, 538471L,
-538481L, 538487L, 538511L, 538513L, 538519L, 538523L, 538529L, 538553L, 538561L,
-538567L, 538579L, 538589L, 538597L, 538621L, 538649L, 538651L, 538697L, 538709L,
-538711L, 538721L, 538723L, 538739L, 538751L, 538763L, 538771L, 538777L, 538789L,
-538799L, 538801L, 538817L, 538823L, 538829L, 538841L, 538871L, 538877L, 538921L,
-538927L, 538931L, 538939L, 538943L, 538987L, 539003L, 539009L, 539039L, 539047L,
-539089L, 539093L, 539101L, 539107L, 539111L, 539113L, 539129L, 539141L, 539153L,
-539159L, 539167L, 539171L, 539207L, 539219L, 539233L, 539237L, 539261L, 539267L,
-539269L, 539293L, 539303L, 539309L, 539311L, 539321L, 539323L, 539339L, 539347L,
-539351L, 539389L, 539401L, 539447L, 539449L, 539479L, 539501L, 539503L, 539507L,
-539509L, 539533L, 539573L, 539621L, 539629L, 539633L, 539639L, 539641L, 539653L,
-539663L, 539677L, 539687L, 539711L, 539713L, 539723L, 539729L, 539743L, 539761L,
-539783L, 539797L, 539837L, 539839L, 539843L, 539849L, 539863L, 539881L, 539897L,
-539899L, 539921L, 539947L, 539993L, 540041L, 540061L, 540079L, 540101L, 540119L,
-540121L, 540139L, 540149L, 540157L, 540167L, 540173L, 540179L, 540181L, 540187L,
-540203L, 540217L, 540233L, 540251L, 540269L, 540271L, 540283L, 540301L, 540307L,
-540343L, 540347L, 540349L, 540367L, 540373L, 540377L, 540383L, 540389L, 540391L,
-540433L, 540437L, 540461L, 540469L, 540509L, 540511L, 540517L, 540539L, 540541L,
-540557L, 540559L, 540577L, 540587L, 540599L, 540611L, 540613L, 540619L, 540629L,
-540677L, 540679L, 540689L, 540691L, 540697L, 540703L, 540713L, 540751L, 540769L,
-540773L, 540779L, 540781L, 540803L, 540809L, 540823L, 540851L, 540863L, 540871L,
-540877L, 540901L, 540907L, 540961L, 540989L, 541001L, 541007L, 541027L, 541049L,
-541061L, 541087L, 541097L, 541129L, 541133L, 541141L, 541153L, 541181L, 541193L,
-541201L, 541217L, 541231L, 541237L, 541249L, 541267L, 541271L, 541283L, 541301L,
-541309L, 541339L, 541349L, 541361L, 541363L, 541369L, 541381L, 541391L, 541417L,
-541439L, 541447L, 541469L, 541483L, 541507L, 541511L, 541523L, 541529L, 541531L,
-541537L, 541543L, 541547L, 541549L, 541571L, 541577L, 541579L, 541589L, 541613L,
-541631L, 541657L, 541661L, 541669L, 541693L, 541699L, 541711L, 541721L, 541727L,
-541759L, 541763L, 541771L, 541777L, 541781L, 541799L, 541817L, 541831L, 541837L,
-541859L, 541889L, 541901L, 541927L, 541951L, 541967L, 541987L, 541991L, 541993L,
-541999L, 542021L, 542023L, 542027L, 542053L, 542063L, 542071L, 542081L, 542083L,
-542093L, 542111L, 542117L, 542119L, 542123L, 542131L, 542141L, 542149L, 542153L,
-542167L, 542183L, 542189L, 542197L, 542207L, 542219L, 542237L, 542251L, 542261L,
-542263L, 542281L, 542293L, 542299L, 542323L, 542371L, 542401L, 542441L, 542447L,
-542461L, 542467L, 542483L, 542489L, 542497L, 542519L, 542533L, 542537L, 542539L,
-542551L, 542557L, 542567L, 542579L, 542587L, 542599L, 542603L, 542683L, 542687L,
-542693L, 542713L, 542719L, 542723L, 542747L, 542761L, 542771L, 542783L, 542791L,
-542797L, 542821L, 542831L, 542837L, 542873L, 542891L, 542911L, 542921L, 542923L,
-542933L, 542939L, 542947L, 542951L, 542981L, 542987L, 542999L, 543017L, 543019L,
-543029L, 543061L, 543097L, 543113L, 543131L, 543139L, 543143L, 543149L, 543157L,
-543161L, 543163L, 543187L, 543203L, 543217L, 543223L, 543227L, 543233L, 543241L,
-543253L, 543259L, 543281L, 543287L, 543289L, 543299L, 543307L, 543311L, 543313L,
-543341L, 543349L, 543353L, 543359L, 543379L, 543383L, 543407L, 543427L, 543463L,
-543497L, 543503L, 543509L, 543539L, 543551L, 543553L, 543593L, 543601L, 543607L,
-543611L, 543617L, 543637L, 543659L, 543661L, 543671L, 543679L, 543689L, 543703L,
-543707L, 543713L, 543769L, 543773L, 543787L, 543791L, 543793L, 543797L, 543811L,
-543827L, 543841L, 543853L, 543857L, 543859L, 543871L, 543877L, 543883L, 543887L,
-543889L, 543901L, 543911L, 543929L, 543967L, 543971L, 543997L, 544001L, 544007L,
-544009L, 544013L, 544021L, 544031L, 544097L, 544099L, 544109L, 544123L, 544129L,
-544133L, 544139L, 544171L, 544177L, 544183L, 544199L, 544223L, 544259L, 544273L,
-544277L, 544279L, 544367L, 544373L, 544399L, 544403L, 544429L, 544451L, 544471L,
-544477L, 544487L, 544501L, 544513L, 544517L, 544543L, 544549L, 544601L, 544613L,
-544627L, 544631L, 544651L, 544667L, 544699L, 544717L, 544721L, 544723L, 544727L,
-544757L, 544759L, 544771L, 544781L, 544793L, 544807L, 544813L, 544837L, 544861L,
-544877L, 544879L, 544883L, 544889L, 544897L, 544903L, 544919L, 544927L, 544937L,
-544961L, 544963L, 544979L, 545023L, 545029L, 545033L, 545057L, 545063L, 545087L,
-545089L, 545093L, 545117L, 545131L, 545141L, 545143L, 545161L, 545189L, 545203L,
-545213L, 545231L, 545239L, 545257L, 545267L, 545291L, 545329L, 545371L, 545387L,
-545429L, 545437L, 545443L, 545449L, 545473L, 545477L, 545483L, 545497L, 545521L,
-545527L, 545533L, 545543L, 545549L, 545551L, 545579L, 545599L, 545609L, 545617L,
-545621L, 545641L, 545647L, 545651L, 545663L, 545711L, 545723L, 545731L, 545747L,
-545749L, 545759L, 545773L, 545789L, 545791L, 545827L, 545843L, 545863L, 545873L,
-545893L, 545899L, 545911L, 545917L, 545929L, 545933L, 545939L, 545947L, 545959L,
-546001L, 546017L, 546019L, 546031L, 546047L, 546053L, 546067L, 546071L, 546097L,
-546101L, 546103L, 546109L, 546137L, 546149L, 546151L, 546173L, 546179L, 546197L,
-546211L, 546233L, 546239L, 546241L, 546253L, 546263L, 546283L, 546289L, 546317L,
-546323L, 546341L, 546349L, 546353L, 546361L, 546367L, 546373L, 546391L, 546461L,
-546467L, 546479L, 546509L, 546523L, 546547L, 546569L, 546583L, 546587L, 546599L,
-546613L, 546617L, 546619L, 546631L, 546643L, 546661L, 546671L, 546677L, 546683L,
-546691L, 546709L, 546719L, 546731L, 546739L, 546781L, 546841L, 546859L, 546863L,
-546869L, 546881L, 546893L, 546919L, 546937L, 546943L, 546947L, 546961L, 546967L,
-546977L, 547007L, 547021L, 547037L, 547061L, 547087L, 547093L, 547097L, 547103L,
-547121L, 547133L, 547139L, 547171L, 547223L, 547229L, 547237L, 547241L, 547249L,
-547271L, 547273L, 547291L, 547301L, 547321L, 547357L, 547361L, 547363L, 547369L,
-547373L, 547387L, 547397L, 547399L, 547411L, 547441L, 547453L, 547471L, 547483L,
-547487L, 547493L, 547499L, 547501L, 547513L, 547529L, 547537L, 547559L, 547567L,
-547577L, 547583L, 547601L, 547609L, 547619L, 547627L, 547639L, 547643L, 547661L,
-547663L, 547681L, 547709L, 547727L, 547741L, 547747L, 547753L, 547763L, 547769L,
-547787L, 547817L, 547819L, 547823L, 547831L, 547849L, 547853L, 547871L, 547889L,
-547901L, 547909L, 547951L, 547957L, 547999L, 548003L, 548039L, 548059L, 548069L,
-548083L, 548089L, 548099L, 548117L, 548123L, 548143L, 548153L, 548189L, 548201L,
-548213L, 548221L, 548227L, 548239L, 548243L, 548263L, 548291L, 548309L, 548323L,
-548347L, 548351L, 548363L, 548371L, 548393L, 548399L, 548407L, 548417L, 548423L,
-548441L, 548453L, 548459L, 548461L, 548489L, 548501L, 548503L, 548519L, 548521L,
-548533L, 548543L, 548557L, 548567L, 548579L, 548591L, 548623L, 548629L, 548657L,
-548671L, 548677L, 548687L, 548693L, 548707L, 548719L, 548749L, 548753L, 548761L,
-548771L, 548783L, 548791L, 548827L, 548831L, 548833L, 548837L, 548843L, 548851L,
-548861L, 548869L, 548893L, 548897L, 548903L, 548909L, 548927L, 548953L, 548957L,
-548963L, 549001L, 549011L, 549013L, 549019L, 549023L, 549037L, 549071L, 549089L,
-549091L, 549097L, 549121L, 549139L, 549149L, 549161L, 549163L, 549167L, 549169L,
-549193L, 549203L, 549221L, 549229L, 549247L, 549257L, 549259L, 549281L, 549313L,
-549319L, 549323L, 549331L, 549379L, 549391L, 549403L, 549421L, 549431L, 549443L,
-549449L, 549481L, 549503L, 549509L, 549511L, 549517L, 549533L, 549547L, 549551L,
-549553L, 549569L, 549587L, 549589L, 549607L, 549623L, 549641L, 549643L, 549649L,
-549667L, 549683L, 549691L, 549701L, 549707L, 549713L, 549719L, 549733L, 549737L,
-549739L, 549749L, 549751L, 549767L, 549817L, 549833L, 549839L, 549863L, 549877L,
-549883L, 549911L, 549937L, 549943L, 549949L, 549977L, 549979L, 550007L, 550009L,
-550027L, 550049L, 550061L, 550063L, 550073L, 550111L, 550117L, 550127L, 550129L,
-550139L, 550163L, 550169L, 550177L, 550181L, 550189L, 550211L, 550213L, 550241L,
-550267L, 550279L, 550283L, 550289L, 550309L, 550337L, 550351L, 550369L, 550379L,
-550427L, 550439L, 550441L, 550447L, 550457L, 550469L, 550471L, 550489L, 550513L,
-550519L, 550531L, 550541L, 550553L, 550577L, 550607L, 550609L, 550621L, 550631L,
-550637L, 550651L, 550657L, 550661L, 550663L, 550679L, 550691L, 550703L, 550717L,
-550721L, 550733L, 550757L, 550763L, 550789L, 550801L, 550811L, 550813L, 550831L,
-550841L, 550843L, 550859L, 550861L, 550903L, 550909L, 550937L, 550939L, 550951L,
-550961L, 550969L, 550973L, 550993L, 550997L, 551003L, 551017L, 551027L, 551039L,
-551059L, 551063L, 551069L, 551093L, 551099L, 551107L, 551113L, 551129L, 551143L,
-551179L, 551197L, 551207L, 551219L, 551231L, 551233L, 551269L, 551281L, 551297L,
-551311L, 551321L, 551339L, 551347L, 551363L, 551381L, 551387L, 551407L, 551423L,
-551443L, 551461L, 551483L, 551489L, 551503L, 551519L, 551539L, 551543L, 551549L,
-551557L, 551569L, 551581L, 551587L, 551597L, 551651L, 551653L, 551659L, 551671L,
-551689L, 551693L, 551713L, 551717L, 551723L, 551729L, 551731L, 551743L, 551753L,
-551767L, 551773L, 551801L, 551809L, 551813L, 551843L, 551849L, 551861L, 551909L,
-551911L, 551917L, 551927L, 551933L, 551951L, 551959L, 551963L, 551981L, 552001L,
-552011L, 552029L, 552031L, 552047L, 552053L, 552059L, 552089L, 552091L, 552103L,
-552107L, 552113L, 552127L, 552137L, 552179L, 552193L, 552217L, 552239L, 552241L,
-552259L, 552263L, 552271L, 552283L, 552301L, 552317L, 552341L, 552353L, 552379L,
-552397L, 552401L, 552403L, 552469L, 552473L, 552481L, 552491L, 552493L, 552511L,
-552523L, 552527L, 552553L, 552581L, 552583L, 552589L, 552611L, 552649L, 552659L,
-552677L, 552703L, 552707L, 552709L, 552731L, 552749L, 552751L, 552757L, 552787L,
-552791L, 552793L, 552809L, 552821L, 552833L, 552841L, 552847L, 552859L, 552883L,
-552887L, 552899L, 552913L, 552917L, 552971L, 552983L, 552991L, 553013L, 553037L,
-553043L, 553051L, 553057L, 553067L, 553073L, 553093L, 553097L, 553099L, 553103L,
-553123L, 553139L, 553141L, 553153L, 553171L, 553181L, 553193L, 553207L, 553211L,
-553229L, 553249L, 553253L, 553277L, 553279L, 553309L, 553351L, 553363L, 553369L,
-553411L, 553417L, 553433L, 553439L, 553447L, 553457L, 553463L, 553471L, 553481L,
-553507L, 553513L, 553517L, 553529L, 553543L, 553549L, 553561L, 553573L, 553583L,
-553589L, 553591L, 553601L, 553607L, 553627L, 553643L, 553649L, 553667L, 553681L,
-553687L, 553699L, 553703L, 553727L, 553733L, 553747L, 553757L, 553759L, 553769L,
-553789L, 553811L, 553837L, 553849L, 553867L, 553873L, 553897L, 553901L, 553919L,
-553921L, 553933L, 553961L, 553963L, 553981L, 553991L, 554003L, 554011L, 554017L,
-554051L, 554077L, 554087L, 554089L, 554117L, 554123L, 554129L, 554137L, 554167L,
-554171L, 554179L, 554189L, 554207L, 554209L, 554233L, 554237L, 554263L, 554269L,
-554293L, 554299L, 554303L, 554317L, 554347L, 554377L, 554383L, 554417L, 554419L,
-554431L, 554447L, 554453L, 554467L, 554503L, 554527L, 554531L, 554569L, 554573L,
-554597L, 554611L, 554627L, 554633L, 554639L, 554641L, 554663L, 554669L, 554677L,
-554699L, 554707L, 554711L, 554731L, 554747L, 554753L, 554759L, 554767L, 554779L,
-554789L, 554791L, 554797L, 554803L, 554821L, 554833L, 554837L, 554839L, 554843L,
-554849L, 554887L, 554891L, 554893L, 554899L, 554923L, 554927L, 554951L, 554959L,
-554969L, 554977L, 555029L, 555041L, 555043L, 555053L, 555073L, 555077L, 555083L,
-555091L, 555097L, 555109L, 555119L, 555143L, 555167L, 555209L, 555221L, 555251L,
-555253L, 555257L, 555277L, 555287L, 555293L, 555301L, 555307L, 555337L, 555349L,
-555361L, 555383L, 555391L, 555419L, 555421L, 555439L, 555461L, 555487L, 555491L,
-555521L, 555523L, 555557L, 555589L, 555593L, 555637L, 555661L, 555671L, 555677L,
-555683L, 555691L, 555697L, 555707L, 555739L, 555743L, 555761L, 555767L, 555823L,
-555827L, 555829L, 555853L, 555857L, 555871L, 555931L, 555941L, 555953L, 555967L,
-556007L, 556021L, 556027L, 556037L, 556043L, 556051L, 556067L, 556069L, 556093L,
-556103L, 556123L, 556159L, 556177L, 556181L, 556211L, 556219L, 556229L, 556243L,
-556253L, 556261L, 556267L, 556271L, 556273L, 556279L, 556289L, 556313L, 556321L,
-556327L, 556331L, 556343L, 556351L, 556373L, 556399L, 556403L, 556441L, 556459L,
-556477L, 556483L, 556487L, 556513L, 556519L, 556537L, 556559L, 556573L, 556579L,
-556583L, 556601L, 556607L, 556609L, 556613L, 556627L, 556639L, 556651L, 556679L,
-556687L, 556691L, 556693L, 556697L, 556709L, 556723L, 556727L, 556741L, 556753L,
-556763L, 556769L, 556781L, 556789L, 556793L, 556799L, 556811L, 556817L, 556819L,
-556823L, 556841L, 556849L, 556859L, 556861L, 556867L, 556883L, 556891L, 556931L,
-556939L, 556943L, 556957L, 556967L, 556981L, 556987L, 556999L, 557017L, 557021L,
-557027L, 557033L, 557041L, 557057L, 557059L, 557069L, 557087L, 557093L, 557153L,
-557159L, 557197L, 557201L, 557261L, 557269L, 557273L, 557281L, 557303L, 557309L,
-557321L, 557329L, 557339L, 557369L, 557371L, 557377L, 557423L, 557443L, 557449L,
-557461L, 557483L, 557489L, 557519L, 557521L, 557533L, 557537L, 557551L, 557567L,
-557573L, 557591L, 557611L, 557633L, 557639L, 557663L, 557671L, 557693L, 557717L,
-557729L, 557731L, 557741L, 557743L, 557747L, 557759L, 557761L, 557779L, 557789L,
-557801L, 557803L, 557831L, 557857L, 557861L, 557863L, 557891L, 557899L, 557903L,
-557927L, 557981L, 557987L, 558007L, 558017L, 558029L, 558053L, 558067L, 558083L,
-558091L, 558109L, 558113L, 558121L, 558139L, 558149L, 558167L, 558179L, 558197L,
-558203L, 558209L, 558223L, 558241L, 558251L, 558253L, 558287L, 558289L, 558307L,
-558319L, 558343L, 558401L, 558413L, 558421L, 558427L, 558431L, 558457L, 558469L,
-558473L, 558479L, 558491L, 558497L, 558499L, 558521L, 558529L, 558533L, 558539L,
-558541L, 558563L, 558583L, 558587L, 558599L, 558611L, 558629L, 558643L, 558661L,
-558683L, 558703L, 558721L, 558731L, 558757L, 558769L, 558781L, 558787L, 558791L,
-558793L, 558827L, 558829L, 558863L, 558869L, 558881L, 558893L, 558913L, 558931L,
-558937L, 558947L, 558973L, 558979L, 558997L, 559001L, 559049L, 559051L, 559067L,
-559081L, 559093L, 559099L, 559123L, 559133L, 559157L, 559177L, 559183L, 559201L,
-559211L, 559213L, 559217L, 559219L, 559231L, 559243L, 559259L, 559277L, 559297L,
-559313L, 559319L, 559343L, 559357L, 559367L, 559369L, 559397L, 559421L, 559451L,
-559459L, 559469L, 559483L, 559511L, 559513L, 559523L, 559529L, 559541L, 559547L,
-559549L, 559561L, 559571L, 559577L, 559583L, 559591L, 559597L, 559631L, 559633L,
-559639L, 559649L, 559667L, 559673L, 559679L, 559687L, 559703L, 559709L, 559739L,
-559747L, 559777L, 559781L, 559799L, 559807L, 559813L, 559831L, 559841L, 559849L,
-559859L, 559877L, 559883L, 559901L, 559907L, 559913L, 559939L, 559967L, 559973L,
-559991L, 560017L, 560023L, 560029L, 560039L, 560047L, 560081L, 560083L, 560089L,
-560093L, 560107L, 560113L, 560117L, 560123L, 560137L, 560149L, 560159L, 560171L,
-560173L, 560179L, 560191L, 560207L, 560213L, 560221L, 560227L, 560233L, 560237L,
-560239L, 560243L, 560249L, 560281L, 560293L, 560297L, 560299L, 560311L, 560317L,
-560341L, 560353L, 560393L, 560411L, 560437L, 560447L, 560459L, 560471L, 560477L,
-560479L, 560489L, 560491L, 560501L, 560503L, 560531L, 560543L, 560551L, 560561L,
-560597L, 560617L, 560621L, 560639L, 560641L, 560653L, 560669L, 560683L, 560689L,
-560701L, 560719L, 560737L, 560753L, 560761L, 560767L, 560771L, 560783L, 560797L,
-560803L, 560827L, 560837L, 560863L, 560869L, 560873L, 560887L, 560891L, 560893L,
-560897L, 560929L, 560939L, 560941L, 560969L, 560977L, 561019L, 561047L, 561053L,
-561059L, 561061L, 561079L, 561083L, 561091L, 561097L, 561101L, 561103L, 561109L,
-561161L, 561173L, 561181L, 561191L, 561199L, 561229L, 561251L, 561277L, 561307L,
-561313L, 561343L, 561347L, 561359L, 561367L, 561373L, 561377L, 561389L, 561409L,
-561419L, 561439L, 561461L, 561521L, 561529L, 561551L, 561553L, 561559L, 561599L,
-561607L, 561667L, 561703L, 561713L, 561733L, 561761L, 561767L, 561787L, 561797L,
-561809L, 561829L, 561839L, 561907L, 561917L, 561923L, 561931L, 561943L, 561947L,
-561961L, 561973L, 561983L, 561997L, 562007L, 562019L, 562021L, 562043L, 562091L,
-562103L, 562129L, 562147L, 562169L, 562181L, 562193L, 562201L, 562231L, 562259L,
-562271L, 562273L, 562283L, 562291L, 562297L, 562301L, 562307L, 562313L, 562333L,
-562337L, 562349L, 562351L, 562357L, 562361L, 562399L, 562403L, 562409L, 562417L,
-562421L, 562427L, 562439L, 562459L, 562477L, 562493L, 562501L, 562517L, 562519L,
-562537L, 562577L, 562579L, 562589L, 562591L, 562607L, 562613L, 562621L, 562631L,
-562633L, 562651L, 562663L, 562669L, 562673L, 562691L, 562693L, 562699L, 562703L,
-562711L, 562721L, 562739L, 562753L, 562759L, 562763L, 562781L, 562789L, 562813L,
-562831L, 562841L, 562871L, 562897L, 562901L, 562909L, 562931L, 562943L, 562949L,
-562963L, 562967L, 562973L, 562979L, 562987L, 562997L, 563009L, 563011L, 563021L,
-563039L, 563041L, 563047L, 563051L, 563077L, 563081L, 563099L, 563113L, 563117L,
-563119L, 563131L, 563149L, 563153L, 563183L, 563197L, 563219L, 563249L, 563263L,
-563287L, 563327L, 563351L, 563357L, 563359L, 563377L, 563401L, 563411L, 563413L,
-563417L, 563419L, 563447L, 563449L, 563467L, 563489L, 563501L, 563503L, 563543L,
-563551L, 563561L, 563587L, 563593L, 563599L, 563623L, 563657L, 563663L, 563723L,
-563743L, 563747L, 563777L, 563809L, 563813L, 563821L, 563831L, 563837L, 563851L,
-563869L, 563881L, 563887L, 563897L, 563929L, 563933L, 563947L, 563971L, 563987L,
-563999L, 564013L, 564017L, 564041L, 564049L, 564059L, 564061L, 564089L, 564097L,
-564103L, 564127L, 564133L, 564149L, 564163L, 564173L, 564191L, 564197L, 564227L,
-564229L, 564233L, 564251L, 564257L, 564269L, 564271L, 564299L, 564301L, 564307L,
-564313L, 564323L, 564353L, 564359L, 564367L, 564371L, 564373L, 564391L, 564401L,
-564407L, 564409L, 564419L, 564437L, 564449L, 564457L, 564463L, 564467L, 564491L,
-564497L, 564523L, 564533L, 564593L, 564607L, 564617L, 564643L, 564653L, 564667L,
-564671L, 564679L, 564701L, 564703L, 564709L, 564713L, 564761L, 564779L, 564793L,
-564797L, 564827L, 564871L, 564881L, 564899L, 564917L, 564919L, 564923L, 564937L,
-564959L, 564973L, 564979L, 564983L, 564989L, 564997L, 565013L, 565039L, 565049L,
-565057L, 565069L, 565109L, 565111L, 565127L, 565163L, 565171L, 565177L, 565183L,
-565189L, 565207L, 565237L, 565241L, 565247L, 565259L, 565261L, 565273L, 565283L,
-565289L, 565303L, 565319L, 565333L, 565337L, 565343L, 565361L, 565379L, 565381L,
-565387L, 565391L, 565393L, 565427L, 565429L, 565441L, 565451L, 565463L, 565469L,
-565483L, 565489L, 565507L, 565511L, 565517L, 565519L, 565549L, 565553L, 565559L,
-565567L, 565571L, 565583L, 565589L, 565597L, 565603L, 565613L, 565637L, 565651L,
-565661L, 565667L, 565723L, 565727L, 565769L, 565771L, 565787L, 565793L, 565813L,
-565849L, 565867L, 565889L, 565891L, 565907L, 565909L, 565919L, 565921L, 565937L,
-565973L, 565979L, 565997L, 566011L, 566023L, 566047L, 566057L, 566077L, 566089L,
-566101L, 566107L, 566131L, 566149L, 566161L, 566173L, 566179L, 566183L, 566201L,
-566213L, 566227L, 566231L, 566233L, 566273L, 566311L, 566323L, 566347L, 566387L,
-566393L, 566413L, 566417L, 566429L, 566431L, 566437L, 566441L, 566443L, 566453L,
-566521L, 566537L, 566539L, 566543L, 566549L, 566551L, 566557L, 566563L, 566567L,
-566617L, 566633L, 566639L, 566653L, 566659L, 566677L, 566681L, 566693L, 566701L,
-566707L, 566717L, 566719L, 566723L, 566737L, 566759L, 566767L, 566791L, 566821L,
-566833L, 566851L, 566857L, 566879L, 566911L, 566939L, 566947L, 566963L, 566971L,
-566977L, 566987L, 566999L, 567011L, 567013L, 567031L, 567053L, 567059L, 567067L,
-567097L, 567101L, 567107L, 567121L, 567143L, 567179L, 567181L, 567187L, 567209L,
-567257L, 567263L, 567277L, 567319L, 567323L, 567367L, 567377L, 567383L, 567389L,
-567401L, 567407L, 567439L, 567449L, 567451L, 567467L, 567487L, 567493L, 567499L,
-567527L, 567529L, 567533L, 567569L, 567601L, 567607L, 567631L, 567649L, 567653L,
-567659L, 567661L, 567667L, 567673L, 567689L, 567719L, 567737L, 567751L, 567761L,
-567767L, 567779L, 567793L, 567811L, 567829L, 567841L, 567857L, 567863L, 567871L,
-567877L, 567881L, 567883L, 567899L, 567937L, 567943L, 567947L, 567949L, 567961L,
-567979L, 567991L, 567997L, 568019L, 568027L, 568033L, 568049L, 568069L, 568091L,
-568097L, 568109L, 568133L, 568151L, 568153L, 568163L, 568171L, 568177L, 568187L,
-568189L, 568193L, 568201L, 568207L, 568231L, 568237L, 568241L, 568273L, 568279L,
-568289L, 568303L, 568349L, 568363L, 568367L, 568387L, 568391L, 568433L, 568439L,
-568441L, 568453L, 568471L, 568481L, 568493L, 568523L, 568541L, 568549L, 568577L,
-568609L, 568619L, 568627L, 568643L, 568657L, 568669L, 568679L, 568691L, 568699L,
-568709L, 568723L, 568751L, 568783L, 568787L, 568807L, 568823L, 568831L, 568853L,
-568877L, 568891L, 568903L, 568907L, 568913L, 568921L, 568963L, 568979L, 568987L,
-568991L, 568999L, 569003L, 569011L, 569021L, 569047L, 569053L, 569057L, 569071L,
-569077L, 569081L, 569083L, 569111L, 569117L, 569137L, 569141L, 569159L, 569161L,
-569189L, 569197L, 569201L, 569209L, 569213L, 569237L, 569243L, 569249L, 569251L,
-569263L, 569267L, 569269L, 569321L, 569323L, 569369L, 569417L, 569419L, 569423L,
-569431L, 569447L, 569461L, 569479L, 569497L, 569507L, 569533L, 569573L, 569579L,
-569581L, 569599L, 569603L, 569609L, 569617L, 569623L, 569659L, 569663L, 569671L,
-569683L, 569711L, 569713L, 569717L, 569729L, 569731L, 569747L, 569759L, 569771L,
-569773L, 569797L, 569809L, 569813L, 569819L, 569831L, 569839L, 569843L, 569851L,
-569861L, 569869L, 569887L, 569893L, 569897L, 569903L, 569927L, 569939L, 569957L,
-569983L, 570001L, 570013L, 570029L, 570041L, 570043L, 570047L, 570049L, 570071L,
-570077L, 570079L, 570083L, 570091L, 570107L, 570109L, 570113L, 570131L, 570139L,
-570161L, 570173L, 570181L, 570191L, 570217L, 570221L, 570233L, 570253L, 570329L,
-570359L, 570373L, 570379L, 570389L, 570391L, 570403L, 570407L, 570413L, 570419L,
-570421L, 570461L, 570463L, 570467L, 570487L, 570491L, 570497L, 570499L, 570509L,
-570511L, 570527L, 570529L, 570539L, 570547L, 570553L, 570569L, 570587L, 570601L,
-570613L, 570637L, 570643L, 570649L, 570659L, 570667L, 570671L, 570677L, 570683L,
-570697L, 570719L, 570733L, 570737L, 570743L, 570781L, 570821L, 570827L, 570839L,
-570841L, 570851L, 570853L, 570859L, 570881L, 570887L, 570901L, 570919L, 570937L,
-570949L, 570959L, 570961L, 570967L, 570991L, 571001L, 571019L, 571031L, 571037L,
-571049L, 571069L, 571093L, 571099L, 571111L, 571133L, 571147L, 571157L, 571163L,
-571199L, 571201L, 571211L, 571223L, 571229L, 571231L, 571261L, 571267L, 571279L,
-571303L, 571321L, 571331L, 571339L, 571369L, 571381L, 571397L, 571399L, 571409L,
-571433L, 571453L, 571471L, 571477L, 571531L, 571541L, 571579L, 571583L, 571589L,
-571601L, 571603L, 571633L, 571657L, 571673L, 571679L, 571699L, 571709L, 571717L,
-571721L, 571741L, 571751L, 571759L, 571777L, 571783L, 571789L, 571799L, 571801L,
-571811L, 571841L, 571847L, 571853L, 571861L, 571867L, 571871L, 571873L, 571877L,
-571903L, 571933L, 571939L, 571969L, 571973L, 572023L, 572027L, 572041L, 572051L,
-572053L, 572059L, 572063L, 572069L, 572087L, 572093L, 572107L, 572137L, 572161L,
-572177L, 572179L, 572183L, 572207L, 572233L, 572239L, 572251L, 572269L, 572281L,
-572303L, 572311L, 572321L, 572323L, 572329L, 572333L, 572357L, 572387L, 572399L,
-572417L, 572419L, 572423L, 572437L, 572449L, 572461L, 572471L, 572479L, 572491L,
-572497L, 572519L, 572521L, 572549L, 572567L, 572573L, 572581L, 572587L, 572597L,
-572599L, 572609L, 572629L, 572633L, 572639L, 572651L, 572653L, 572657L, 572659L,
-572683L, 572687L, 572699L, 572707L, 572711L, 572749L, 572777L, 572791L, 572801L,
-572807L, 572813L, 572821L, 572827L, 572833L, 572843L, 572867L, 572879L, 572881L,
-572903L, 572909L, 572927L, 572933L, 572939L, 572941L, 572963L, 572969L, 572993L,
-573007L, 573031L, 573047L, 573101L, 573107L, 573109L, 573119L, 573143L, 573161L,
-573163L, 573179L, 573197L, 573247L, 573253L, 573263L, 573277L, 573289L, 573299L,
-573317L, 573329L, 573341L, 573343L, 573371L, 573379L, 573383L, 573409L, 573437L,
-573451L, 573457L, 573473L, 573479L, 573481L, 573487L, 573493L, 573497L, 573509L,
-573511L, 573523L, 573527L, 573557L, 573569L, 573571L, 573637L, 573647L, 573673L,
-573679L, 573691L, 573719L, 573737L, 573739L, 573757L, 573761L, 573763L, 573787L,
-573791L, 573809L, 573817L, 573829L, 573847L, 573851L, 573863L, 573871L, 573883L,
-573887L, 573899L, 573901L, 573929L, 573941L, 573953L, 573967L, 573973L, 573977L,
-574003L, 574031L, 574033L, 574051L, 574061L, 574081L, 574099L, 574109L, 574127L,
-574157L, 574159L, 574163L, 574169L, 574181L, 574183L, 574201L, 574219L, 574261L,
-574279L, 574283L, 574289L, 574297L, 574307L, 574309L, 574363L, 574367L, 574373L,
-574393L, 574423L, 574429L, 574433L, 574439L, 574477L, 574489L, 574493L, 574501L,
-574507L, 574529L, 574543L, 574547L, 574597L, 574619L, 574621L, 574627L, 574631L,
-574643L, 574657L, 574667L, 574687L, 574699L, 574703L, 574711L, 574723L, 574727L,
-574733L, 574741L, 574789L, 574799L, 574801L, 574813L, 574817L, 574859L, 574907L,
-574913L, 574933L, 574939L, 574949L, 574963L, 574967L, 574969L, 575009L, 575027L,
-575033L, 575053L, 575063L, 575077L, 575087L, 575119L, 575123L, 575129L, 575131L,
-575137L, 575153L, 575173L, 575177L, 575203L, 575213L, 575219L, 575231L, 575243L,
-575249L, 575251L, 575257L, 575261L, 575303L, 575317L, 575359L, 575369L, 575371L,
-575401L, 575417L, 575429L, 575431L, 575441L, 575473L, 575479L, 575489L, 575503L,
-575513L, 575551L, 575557L, 575573L, 575579L, 575581L, 575591L, 575593L, 575611L,
-575623L, 575647L, 575651L, 575669L, 575677L, 575689L, 575693L, 575699L, 575711L,
-575717L, 575723L, 575747L, 575753L, 575777L, 575791L, 575821L, 575837L, 575849L,
-575857L, 575863L, 575867L, 575893L, 575903L, 575921L, 575923L, 575941L, 575957L,
-575959L, 575963L, 575987L, 576001L, 576013L, 576019L, 576029L, 576031L, 576041L,
-576049L, 576089L, 576101L, 576119L, 576131L, 576151L, 576161L, 576167L, 576179L,
-576193L, 576203L, 576211L, 576217L, 576221L, 576223L, 576227L, 576287L, 576293L,
-576299L, 576313L, 576319L, 576341L, 576377L, 576379L, 576391L, 576421L, 576427L,
-576431L, 576439L, 576461L, 576469L, 576473L, 576493L, 576509L, 576523L, 576529L,
-576533L, 576539L, 576551L, 576553L, 576577L, 576581L, 576613L, 576617L, 576637L,
-576647L, 576649L, 576659L, 576671L, 576677L, 576683L, 576689L, 576701L, 576703L,
-576721L, 576727L, 576731L, 576739L, 576743L, 576749L, 576757L, 576769L, 576787L,
-576791L, 576881L, 576883L, 576889L, 576899L, 576943L, 576949L, 576967L, 576977L,
-577007L, 577009L, 577033L, 577043L, 577063L, 577067L, 577069L, 577081L, 577097L,
-577111L, 577123L, 577147L, 577151L, 577153L, 577169L, 577177L, 577193L, 577219L,
-577249L, 577259L, 577271L, 577279L, 577307L, 577327L, 577331L, 577333L, 577349L,
-577351L, 577363L, 577387L, 577397L, 577399L, 577427L, 577453L, 577457L, 577463L,
-577471L, 577483L, 577513L, 577517L, 577523L, 577529L, 577531L, 577537L, 577547L,
-577559L, 577573L, 577589L, 577601L, 577613L, 577627L, 577637L, 577639L, 577667L,
-577721L, 577739L, 577751L, 577757L, 577781L, 577799L, 577807L, 577817L, 577831L,
-577849L, 577867L, 577873L, 577879L, 577897L, 577901L, 577909L, 577919L, 577931L,
-577937L, 577939L, 577957L, 577979L, 577981L, 578021L, 578029L, 578041L, 578047L,
-578063L, 578077L, 578093L, 578117L, 578131L, 578167L, 578183L, 578191L, 578203L,
-578209L, 578213L, 578251L, 578267L, 578297L, 578299L, 578309L, 578311L, 578317L,
-578327L, 578353L, 578363L, 578371L, 578399L, 578401L, 578407L, 578419L, 578441L,
-578453L, 578467L, 578477L, 578483L, 578489L, 578497L, 578503L, 578509L, 578533L,
-578537L, 578563L, 578573L, 578581L, 578587L, 578597L, 578603L, 578609L, 578621L,
-578647L, 578659L, 578687L, 578689L, 578693L, 578701L, 578719L, 578729L, 578741L,
-578777L, 578779L, 578789L, 578803L, 578819L, 578821L, 578827L, 578839L, 578843L,
-578857L, 578861L, 578881L, 578917L, 578923L, 578957L, 578959L, 578971L, 578999L,
-579011L, 579017L, 579023L, 579053L, 579079L, 579083L, 579107L, 579113L, 579119L,
-579133L, 579179L, 579197L, 579199L, 579239L, 579251L, 579259L, 579263L, 579277L,
-579281L, 579283L, 579287L, 579311L, 579331L, 579353L, 579379L, 579407L, 579409L,
-579427L, 579433L, 579451L, 579473L, 579497L, 579499L, 579503L, 579517L, 579521L,
-579529L, 579533L, 579539L, 579541L, 579563L, 579569L, 579571L, 579583L, 579587L,
-579611L, 579613L, 579629L, 579637L, 579641L, 579643L, 579653L, 579673L, 579701L,
-579707L, 579713L, 579721L, 579737L, 579757L, 579763L, 579773L, 579779L, 579809L,
-579829L, 579851L, 579869L, 579877L, 579881L, 579883L, 579893L, 579907L, 579947L,
-579949L, 579961L, 579967L, 579973L, 579983L, 580001L, 580031L, 580033L, 580079L,
-580081L, 580093L, 580133L, 580163L, 580169L, 580183L, 580187L, 580201L, 580213L,
-580219L, 580231L, 580259L, 580291L, 580301L, 580303L, 580331L, 580339L, 580343L,
-580357L, 580361L, 580373L, 580379L, 580381L, 580409L, 580417L, 580471L, 580477L,
-580487L, 580513L, 580529L, 580549L, 580553L, 580561L, 580577L, 580607L, 580627L,
-580631L, 580633L, 580639L, 580663L, 580673L, 580687L, 580691L, 580693L, 580711L,
-580717L, 580733L, 580747L, 580757L, 580759L, 580763L, 580787L, 580793L, 580807L,
-580813L, 580837L, 580843L, 580859L, 580871L, 580889L, 580891L, 580901L, 580913L,
-580919L, 580927L, 580939L, 580969L, 580981L, 580997L, 581029L, 581041L, 581047L,
-581069L, 581071L, 581089L, 581099L, 581101L, 581137L, 581143L, 581149L, 581171L,
-581173L, 581177L, 581183L, 581197L, 581201L, 581227L, 581237L, 581239L, 581261L,
-581263L, 581293L, 581303L, 581311L, 581323L, 581333L, 581341L, 581351L, 581353L,
-581369L, 581377L, 581393L, 581407L, 581411L, 581429L, 581443L, 581447L, 581459L,
-581473L, 581491L, 581521L, 581527L, 581549L, 581551L, 581557L, 581573L, 581597L,
-581599L, 581617L, 581639L, 581657L, 581663L, 581683L, 581687L, 581699L, 581701L,
-581729L, 581731L, 581743L, 581753L, 581767L, 581773L, 581797L, 581809L, 581821L,
-581843L, 581857L, 581863L, 581869L, 581873L, 581891L, 581909L, 581921L, 581941L,
-581947L, 581953L, 581981L, 581983L, 582011L, 582013L, 582017L, 582031L, 582037L,
-582067L, 582083L, 582119L, 582137L, 582139L, 582157L, 582161L, 582167L, 582173L,
-582181L, 582203L, 582209L, 582221L, 582223L, 582227L, 582247L, 582251L, 582299L,
-582317L, 582319L, 582371L, 582391L, 582409L, 582419L, 582427L, 582433L, 582451L,
-582457L, 582469L, 582499L, 582509L, 582511L, 582541L, 582551L, 582563L, 582587L,
-582601L, 582623L, 582643L, 582649L, 582677L, 582689L, 582691L, 582719L, 582721L,
-582727L, 582731L, 582737L, 582761L, 582763L, 582767L, 582773L, 582781L, 582793L,
-582809L, 582821L, 582851L, 582853L, 582859L, 582887L, 582899L, 582931L, 582937L,
-582949L, 582961L, 582971L, 582973L, 582983L, 583007L, 583013L, 583019L, 583021L,
-583031L, 583069L, 583087L, 583127L, 583139L, 583147L, 583153L, 583169L, 583171L,
-583181L, 583189L, 583207L, 583213L, 583229L, 583237L, 583249L, 583267L, 583273L,
-583279L, 583291L, 583301L, 583337L, 583339L, 583351L, 583367L, 583391L, 583397L,
-583403L, 583409L, 583417L, 583421L, 583447L, 583459L, 583469L, 583481L, 583493L,
-583501L, 583511L, 583519L, 583523L, 583537L, 583543L, 583577L, 583603L, 583613L,
-583619L, 583621L, 583631L, 583651L, 583657L, 583669L, 583673L, 583697L, 583727L,
-583733L, 583753L, 583769L, 583777L, 583783L, 583789L, 583801L, 583841L, 583853L,
-583859L, 583861L, 583873L, 583879L, 583903L, 583909L, 583937L, 583969L, 583981L,
-583991L, 583997L, 584011L, 584027L, 584033L, 584053L, 584057L, 584063L, 584081L,
-584099L, 584141L, 584153L, 584167L, 584183L, 584203L, 584249L, 584261L, 584279L,
-584281L, 584303L, 584347L, 584357L, 584359L, 584377L, 584387L, 584393L, 584399L,
-584411L, 584417L, 584429L, 584447L, 584471L, 584473L, 584509L, 584531L, 584557L,
-584561L, 584587L, 584593L, 584599L, 584603L, 584609L, 584621L, 584627L, 584659L,
-584663L, 584677L, 584693L, 584699L, 584707L, 584713L, 584719L, 584723L, 584737L,
-584767L, 584777L, 584789L, 584791L, 584809L, 584849L, 584863L, 584869L, 584873L,
-584879L, 584897L, 584911L, 584917L, 584923L, 584951L, 584963L, 584971L, 584981L,
-584993L, 584999L, 585019L, 585023L, 585031L, 585037L, 585041L, 585043L, 585049L,
-585061L, 585071L, 585073L, 585077L, 585107L, 585113L, 585119L, 585131L, 585149L,
-585163L, 585199L, 585217L, 585251L, 585269L, 585271L, 585283L, 585289L, 585313L,
-585317L, 585337L, 585341L, 585367L, 585383L, 585391L, 585413L, 585437L, 585443L,
-585461L, 585467L, 585493L, 585503L, 585517L, 585547L, 585551L, 585569L, 585577L,
-585581L, 585587L, 585593L, 585601L, 585619L, 585643L, 585653L, 585671L, 585677L,
-585691L, 585721L, 585727L, 585733L, 585737L, 585743L, 585749L, 585757L, 585779L,
-585791L, 585799L, 585839L, 585841L, 585847L, 585853L, 585857L, 585863L, 585877L,
-585881L, 585883L, 585889L, 585899L, 585911L, 585913L, 585917L, 585919L, 585953L,
-585989L, 585997L, 586009L, 586037L, 586051L, 586057L, 586067L, 586073L, 586087L,
-586111L, 586121L, 586123L, 586129L, 586139L, 586147L, 586153L, 586189L, 586213L,
-586237L, 586273L, 586277L, 586291L, 586301L, 586309L, 586319L, 586349L, 586361L,
-586363L, 586367L, 586387L, 586403L, 586429L, 586433L, 586457L, 586459L, 586463L,
-586471L, 586493L, 586499L, 586501L, 586541L, 586543L, 586567L, 586571L, 586577L,
-586589L, 586601L, 586603L, 586609L, 586627L, 586631L, 586633L, 586667L, 586679L,
-586693L, 586711L, 586723L, 586741L, 586769L, 586787L, 586793L, 586801L, 586811L,
-586813L, 586819L, 586837L, 586841L, 586849L, 586871L, 586897L, 586903L, 586909L,
-586919L, 586921L, 586933L, 586939L, 586951L, 586961L, 586973L, 586979L, 586981L,
-587017L, 587021L, 587033L, 587051L, 587053L, 587057L, 587063L, 587087L, 587101L,
-587107L, 587117L, 587123L, 587131L, 587137L, 587143L, 587149L, 587173L, 587179L,
-587189L, 587201L, 587219L, 587263L, 587267L, 587269L, 587281L, 587287L, 587297L,
-587303L, 587341L, 587371L, 587381L, 587387L, 587413L, 587417L, 587429L, 587437L,
-587441L, 587459L, 587467L, 587473L, 587497L, 587513L, 587519L, 587527L, 587533L,
-587539L, 587549L, 587551L, 587563L, 587579L, 587599L, 587603L, 587617L, 587621L,
-587623L, 587633L, 587659L, 587669L, 587677L, 587687L, 587693L, 587711L, 587731L,
-587737L, 587747L, 587749L, 587753L, 587771L, 587773L, 587789L, 587813L, 587827L,
-587833L, 587849L, 587863L, 587887L, 587891L, 587897L, 587927L, 587933L, 587947L,
-587959L, 587969L, 587971L, 587987L, 587989L, 587999L, 588011L, 588019L, 588037L,
-588043L, 588061L, 588073L, 588079L, 588083L, 588097L, 588113L, 588121L, 588131L,
-588151L, 588167L, 588169L, 588173L, 588191L, 588199L, 588229L, 588239L, 588241L,
-588257L, 588277L, 588293L, 588311L, 588347L, 588359L, 588361L, 588383L, 588389L,
-588397L, 588403L, 588433L, 588437L, 588463L, 588481L, 588493L, 588503L, 588509L,
-588517L, 588521L, 588529L, 588569L, 588571L, 588619L, 588631L, 588641L, 588647L,
-588649L, 588667L, 588673L, 588683L, 588703L, 588733L, 588737L, 588743L, 588767L,
-588773L, 588779L, 588811L, 588827L, 588839L, 588871L, 588877L, 588881L, 588893L,
-588911L, 588937L, 588941L, 588947L, 588949L, 588953L, 588977L, 589021L, 589027L,
-589049L, 589063L, 589109L, 589111L, 589123L, 589139L, 589159L, 589163L, 589181L,
-589187L, 589189L, 589207L, 589213L, 589219L, 589231L, 589241L, 589243L, 589273L,
-589289L, 589291L, 589297L, 589327L, 589331L, 589349L, 589357L, 589387L, 589409L,
-589439L, 589451L, 589453L, 589471L, 589481L, 589493L, 589507L, 589529L, 589531L,
-589579L, 589583L, 589591L, 589601L, 589607L, 589609L, 589639L, 589643L, 589681L,
-589711L, 589717L, 589751L, 589753L, 589759L, 589763L, 589783L, 589793L, 589807L,
-589811L, 589829L, 589847L, 589859L, 589861L, 589873L, 589877L, 589903L, 589921L,
-589933L, 589993L, 589997L, 590021L, 590027L, 590033L, 590041L, 590071L, 590077L,
-590099L, 590119L, 590123L, 590129L, 590131L, 590137L, 590141L, 590153L, 590171L,
-590201L, 590207L, 590243L, 590251L, 590263L, 590267L, 590269L, 590279L, 590309L,
-590321L, 590323L, 590327L, 590357L, 590363L, 590377L, 590383L, 590389L, 590399L,
-590407L, 590431L, 590437L, 590489L, 590537L, 590543L, 590567L, 590573L, 590593L,
-590599L, 590609L, 590627L, 590641L, 590647L, 590657L, 590659L, 590669L, 590713L,
-590717L, 590719L, 590741L, 590753L, 590771L, 590797L, 590809L, 590813L, 590819L,
-590833L, 590839L, 590867L, 590899L, 590921L, 590923L, 590929L, 590959L, 590963L,
-590983L, 590987L, 591023L, 591053L, 591061L, 591067L, 591079L, 591089L, 591091L,
-591113L, 591127L, 591131L, 591137L, 591161L, 591163L, 591181L, 591193L, 591233L,
-591259L, 591271L, 591287L, 591289L, 591301L, 591317L, 591319L, 591341L, 591377L,
-591391L, 591403L, 591407L, 591421L, 591431L, 591443L, 591457L, 591469L, 591499L,
-591509L, 591523L, 591553L, 591559L, 591581L, 591599L, 591601L, 591611L, 591623L,
-591649L, 591653L, 591659L, 591673L, 591691L, 591709L, 591739L, 591743L, 591749L,
-591751L, 591757L, 591779L, 591791L, 591827L, 591841L, 591847L, 591863L, 591881L,
-591887L, 591893L, 591901L, 591937L, 591959L, 591973L, 592019L, 592027L, 592049L,
-592057L, 592061L, 592073L, 592087L, 592099L, 592121L, 592129L, 592133L, 592139L,
-592157L, 592199L, 592217L, 592219L, 592223L, 592237L, 592261L, 592289L, 592303L,
-592307L, 592309L, 592321L, 592337L, 592343L, 592351L, 592357L, 592367L, 592369L,
-592387L, 592391L, 592393L, 592429L, 592451L, 592453L, 592463L, 592469L, 592483L,
-592489L, 592507L, 592517L, 592531L, 592547L, 592561L, 592577L, 592589L, 592597L,
-592601L, 592609L, 592621L, 592639L, 592643L, 592649L, 592661L, 592663L, 592681L,
-592693L, 592723L, 592727L, 592741L, 592747L, 592759L, 592763L, 592793L, 592843L,
-592849L, 592853L, 592861L, 592873L, 592877L, 592897L, 592903L, 592919L, 592931L,
-592939L, 592967L, 592973L, 592987L, 592993L, 593003L, 593029L, 593041L, 593051L,
-593059L, 593071L, 593081L, 593083L, 593111L, 593119L, 593141L, 593143L, 593149L,
-593171L, 593179L, 593183L, 593207L, 593209L, 593213L, 593227L, 593231L, 593233L,
-593251L, 593261L, 593273L, 593291L, 593293L, 593297L, 593321L, 593323L, 593353L,
-593381L, 593387L, 593399L, 593401L, 593407L, 593429L, 593447L, 593449L, 593473L,
-593479L, 593491L, 593497L, 593501L, 593507L, 593513L, 593519L, 593531L, 593539L,
-593573L, 593587L, 593597L, 593603L, 593627L, 593629L, 593633L, 593641L, 593647L,
-593651L, 593689L, 593707L, 593711L, 593767L, 593777L, 593783L, 593839L, 593851L,
-593863L, 593869L, 593899L, 593903L, 593933L, 593951L, 593969L, 593977L, 593987L,
-593993L, 594023L, 594037L, 594047L, 594091L, 594103L, 594107L, 594119L, 594137L,
-594151L, 594157L, 594161L, 594163L, 594179L, 594193L, 594203L, 594211L, 594227L,
-594241L, 594271L, 594281L, 594283L, 594287L, 594299L, 594311L, 594313L, 594329L,
-594359L, 594367L, 594379L, 594397L, 594401L, 594403L, 594421L, 594427L, 594449L,
-594457L, 594467L, 594469L, 594499L, 594511L, 594521L, 594523L, 594533L, 594551L,
-594563L, 594569L, 594571L, 594577L, 594617L, 594637L, 594641L, 594653L, 594667L,
-594679L, 594697L, 594709L, 594721L, 594739L, 594749L, 594751L, 594773L, 594793L,
-594821L, 594823L, 594827L, 594829L, 594857L, 594889L, 594899L, 594911L, 594917L,
-594929L, 594931L, 594953L, 594959L, 594961L, 594977L, 594989L, 595003L, 595037L,
-595039L, 595043L, 595057L, 595069L, 595073L, 595081L, 595087L, 595093L, 595097L,
-595117L, 595123L, 595129L, 595139L, 595141L, 595157L, 595159L, 595181L, 595183L,
-595201L, 595207L, 595229L, 595247L, 595253L, 595261L, 595267L, 595271L, 595277L,
-595291L, 595303L, 595313L, 595319L, 595333L, 595339L, 595351L, 595363L, 595373L,
-595379L, 595381L, 595411L, 595451L, 595453L, 595481L, 595513L, 595519L, 595523L,
-595547L, 595549L, 595571L, 595577L, 595579L, 595613L, 595627L, 595687L, 595703L,
-595709L, 595711L, 595717L, 595733L, 595741L, 595801L, 595807L, 595817L, 595843L,
-595873L, 595877L, 595927L, 595939L, 595943L, 595949L, 595951L, 595957L, 595961L,
-595963L, 595967L, 595981L, 596009L, 596021L, 596027L, 596047L, 596053L, 596059L,
-596069L, 596081L, 596083L, 596093L, 596117L, 596119L, 596143L, 596147L, 596159L,
-596179L, 596209L, 596227L, 596231L, 596243L, 596251L, 596257L, 596261L, 596273L,
-596279L, 596291L, 596293L, 596317L, 596341L, 596363L, 596369L, 596399L, 596419L,
-596423L, 596461L, 596489L, 596503L, 596507L, 596537L, 596569L, 596573L, 596579L,
-596587L, 596593L, 596599L, 596611L, 596623L, 596633L, 596653L, 596663L, 596669L,
-596671L, 596693L, 596707L, 596737L, 596741L, 596749L, 596767L, 596779L, 596789L,
-596803L, 596821L, 596831L, 596839L, 596851L, 596857L, 596861L, 596863L, 596879L,
-596899L, 596917L, 596927L, 596929L, 596933L, 596941L, 596963L, 596977L, 596983L,
-596987L, 597031L, 597049L, 597053L, 597059L, 597073L, 597127L, 597131L, 597133L,
-597137L, 597169L, 597209L, 597221L, 597239L, 597253L, 597263L, 597269L, 597271L,
-597301L, 597307L, 597349L, 597353L, 597361L, 597367L, 597383L, 597391L, 597403L,
-597407L, 597409L, 597419L, 597433L, 597437L, 597451L, 597473L, 597497L, 597521L,
-597523L, 597539L, 597551L, 597559L, 597577L, 597581L, 597589L, 597593L, 597599L,
-597613L, 597637L, 597643L, 597659L, 597671L, 597673L, 597677L, 597679L, 597689L,
-597697L, 597757L, 597761L, 597767L, 597769L, 597781L, 597803L, 597823L, 597827L,
-597833L, 597853L, 597859L, 597869L, 597889L, 597899L, 597901L, 597923L, 597929L,
-597967L, 597997L, 598007L, 598049L, 598051L, 598057L, 598079L, 598093L, 598099L,
-598123L, 598127L, 598141L, 598151L, 598159L, 598163L, 598187L, 598189L, 598193L,
-598219L, 598229L, 598261L, 598303L, 598307L, 598333L, 598363L, 598369L, 598379L,
-598387L, 598399L, 598421L, 598427L, 598439L, 598447L, 598457L, 598463L, 598487L,
-598489L, 598501L, 598537L, 598541L, 598571L, 598613L, 598643L, 598649L, 598651L,
-598657L, 598669L, 598681L, 598687L, 598691L, 598711L, 598721L, 598727L, 598729L,
-598777L, 598783L, 598789L, 598799L, 598817L, 598841L, 598853L, 598867L, 598877L,
-598883L, 598891L, 598903L, 598931L, 598933L, 598963L, 598967L, 598973L, 598981L,
-598987L, 598999L, 599003L, 599009L, 599021L, 599023L, 599069L, 599087L, 599117L,
-599143L, 599147L, 599149L, 599153L, 599191L, 599213L, 599231L, 599243L, 599251L,
-599273L, 599281L, 599303L, 599309L, 599321L, 599341L, 599353L, 599359L, 599371L,
-599383L, 599387L, 599399L, 599407L, 599413L, 599419L, 599429L, 599477L, 599479L,
-599491L, 599513L, 599519L, 599537L, 599551L, 599561L, 599591L, 599597L, 599603L,
-599611L, 599623L, 599629L, 599657L, 599663L, 599681L, 599693L, 599699L, 599701L,
-599713L, 599719L, 599741L, 599759L, 599779L, 599783L, 599803L, 599831L, 599843L,
-599857L, 599869L, 599891L, 599899L, 599927L, 599933L, 599939L, 599941L, 599959L,
-599983L, 599993L, 599999L, 600011L, 600043L, 600053L, 600071L, 600073L, 600091L,
-600101L, 600109L, 600167L, 600169L, 600203L, 600217L, 600221L, 600233L, 600239L,
-600241L, 600247L, 600269L, 600283L, 600289L, 600293L, 600307L, 600311L, 600317L,
-600319L, 600337L, 600359L, 600361L, 600367L, 600371L, 600401L, 600403L, 600407L,
-600421L, 600433L, 600449L, 600451L, 600463L, 600469L, 600487L, 600517L, 600529L,
-600557L, 600569L, 600577L, 600601L, 600623L, 600631L, 600641L, 600659L, 600673L,
-600689L, 600697L, 600701L, 600703L, 600727L, 600751L, 600791L, 600823L, 600827L,
-600833L, 600841L, 600857L, 600877L, 600881L, 600883L, 600889L, 600893L, 600931L,
-600947L, 600949L, 600959L, 600961L, 600973L, 600979L, 600983L, 601021L, 601031L,
-601037L, 601039L, 601043L, 601061L, 601067L, 601079L, 601093L, 601127L, 601147L,
-601187L, 601189L, 601193L, 601201L, 601207L, 601219L, 601231L, 601241L, 601247L,
-601259L, 601267L, 601283L, 601291L, 601297L, 601309L, 601313L, 601319L, 601333L,
-601339L, 601357L, 601379L, 601397L, 601411L, 601423L, 601439L, 601451L, 601457L,
-601487L, 601507L, 601541L, 601543L, 601589L, 601591L, 601607L, 601631L, 601651L,
-601669L, 601687L, 601697L, 601717L, 601747L, 601751L, 601759L, 601763L, 601771L,
-601801L, 601807L, 601813L, 601819L, 601823L, 601831L, 601849L, 601873L, 601883L,
-601889L, 601897L, 601903L, 601943L, 601949L, 601961L, 601969L, 601981L, 602029L,
-602033L, 602039L, 602047L, 602057L, 602081L, 602083L, 602087L, 602093L, 602099L,
-602111L, 602137L, 602141L, 602143L, 602153L, 602179L, 602197L, 602201L, 602221L,
-602227L, 602233L, 602257L, 602267L, 602269L, 602279L, 602297L, 602309L, 602311L,
-602317L, 602321L, 602333L, 602341L, 602351L, 602377L, 602383L, 602401L, 602411L,
-602431L, 602453L, 602461L, 602477L, 602479L, 602489L, 602501L, 602513L, 602521L,
-602543L, 602551L, 602593L, 602597L, 602603L, 602621L, 602627L, 602639L, 602647L,
-602677L, 602687L, 602689L, 602711L, 602713L, 602717L, 602729L, 602743L, 602753L,
-602759L, 602773L, 602779L, 602801L, 602821L, 602831L, 602839L, 602867L, 602873L,
-602887L, 602891L, 602909L, 602929L, 602947L, 602951L, 602971L, 602977L, 602983L,
-602999L, 603011L, 603013L, 603023L, 603047L, 603077L, 603091L, 603101L, 603103L,
-603131L, 603133L, 603149L, 603173L, 603191L, 603203L, 603209L, 603217L, 603227L,
-603257L, 603283L, 603311L, 603319L, 603349L, 603389L, 603391L, 603401L, 603431L,
-603443L, 603457L, 603467L, 603487L, 603503L, 603521L, 603523L, 603529L, 603541L,
-603553L, 603557L, 603563L, 603569L, 603607L, 603613L, 603623L, 603641L, 603667L,
-603679L, 603689L, 603719L, 603731L, 603739L, 603749L, 603761L, 603769L, 603781L,
-603791L, 603793L, 603817L, 603821L, 603833L, 603847L, 603851L, 603853L, 603859L,
-603881L, 603893L, 603899L, 603901L, 603907L, 603913L, 603917L, 603919L, 603923L,
-603931L, 603937L, 603947L, 603949L, 603989L, 604001L, 604007L, 604013L, 604031L,
-604057L, 604063L, 604069L, 604073L, 604171L, 604189L, 604223L, 604237L, 604243L,
-604249L, 604259L, 604277L, 604291L, 604309L, 604313L, 604319L, 604339L, 604343L,
-604349L, 604361L, 604369L, 604379L, 604397L, 604411L, 604427L, 604433L, 604441L,
-604477L, 604481L, 604517L, 604529L, 604547L, 604559L, 604579L, 604589L, 604603L,
-604609L, 604613L, 604619L, 604649L, 604651L, 604661L, 604697L, 604699L, 604711L,
-604727L, 604729L, 604733L, 604753L, 604759L, 604781L, 604787L, 604801L, 604811L,
-604819L, 604823L, 604829L, 604837L, 604859L, 604861L, 604867L, 604883L, 604907L,
-604931L, 604939L, 604949L, 604957L, 604973L, 604997L, 605009L, 605021L, 605023L,
-605039L, 605051L, 605069L, 605071L, 605113L, 605117L, 605123L, 605147L, 605167L,
-605173L, 605177L, 605191L, 605221L, 605233L, 605237L, 605239L, 605249L, 605257L,
-605261L, 605309L, 605323L, 605329L, 605333L, 605347L, 605369L, 605393L, 605401L,
-605411L, 605413L, 605443L, 605471L, 605477L, 605497L, 605503L, 605509L, 605531L,
-605533L, 605543L, 605551L, 605573L, 605593L, 605597L, 605599L, 605603L, 605609L,
-605617L, 605629L, 605639L, 605641L, 605687L, 605707L, 605719L, 605779L, 605789L,
-605809L, 605837L, 605849L, 605861L, 605867L, 605873L, 605879L, 605887L, 605893L,
-605909L, 605921L, 605933L, 605947L, 605953L, 605977L, 605987L, 605993L, 606017L,
-606029L, 606031L, 606037L, 606041L, 606049L, 606059L, 606077L, 606079L, 606083L,
-606091L, 606113L, 606121L, 606131L, 606173L, 606181L, 606223L, 606241L, 606247L,
-606251L, 606299L, 606301L, 606311L, 606313L, 606323L, 606341L, 606379L, 606383L,
-606413L, 606433L, 606443L, 606449L, 606493L, 606497L, 606503L, 606521L, 606527L,
-606539L, 606559L, 606569L, 606581L, 606587L, 606589L, 606607L, 606643L, 606649L,
-606653L, 606659L, 606673L, 606721L, 606731L, 606733L, 606737L, 606743L, 606757L,
-606791L, 606811L, 606829L, 606833L, 606839L, 606847L, 606857L, 606863L, 606899L,
-606913L, 606919L, 606943L, 606959L, 606961L, 606967L, 606971L, 606997L, 607001L,
-607003L, 607007L, 607037L, 607043L, 607049L, 607063L, 607067L, 607081L, 607091L,
-607093L, 607097L, 607109L, 607127L, 607129L, 607147L, 607151L, 607153L, 607157L,
-607163L, 607181L, 607199L, 607213L, 607219L, 607249L, 607253L, 607261L, 607301L,
-607303L, 607307L, 607309L, 607319L, 607331L, 607337L, 607339L, 607349L, 607357L,
-607363L, 607417L, 607421L, 607423L, 607471L, 607493L, 607517L, 607531L, 607549L,
-607573L, 607583L, 607619L, 607627L, 607667L, 607669L, 607681L, 607697L, 607703L,
-607721L, 607723L, 607727L, 607741L, 607769L, 607813L, 607819L, 607823L, 607837L,
-607843L, 607861L, 607883L, 607889L, 607909L, 607921L, 607931L, 607933L, 607939L,
-607951L, 607961L, 607967L, 607991L, 607993L, 608011L, 608029L, 608033L, 608087L,
-608089L, 608099L, 608117L, 608123L, 608129L, 608131L, 608147L, 608161L, 608177L,
-608191L, 608207L, 608213L, 608269L, 608273L, 608297L, 608299L, 608303L, 608339L,
-608347L, 608357L, 608359L, 608369L, 608371L, 608383L, 608389L, 608393L, 608401L,
-608411L, 608423L, 608429L, 608431L, 608459L, 608471L, 608483L, 608497L, 608519L,
-608521L, 608527L, 608581L, 608591L, 608593L, 608609L, 608611L, 608633L, 608653L,
-608659L, 608669L, 608677L, 608693L, 608701L, 608737L, 608743L, 608749L, 608759L,
-608767L, 608789L, 608819L, 608831L, 608843L, 608851L, 608857L, 608863L, 608873L,
-608887L, 608897L, 608899L, 608903L, 608941L, 608947L, 608953L, 608977L, 608987L,
-608989L, 608999L, 609043L, 609047L, 609067L, 609071L, 609079L, 609101L, 609107L,
-609113L, 609143L, 609149L, 609163L, 609173L, 609179L, 609199L, 609209L, 609221L,
-609227L, 609233L, 609241L, 609253L, 609269L, 609277L, 609283L, 609289L, 609307L,
-609313L, 609337L, 609359L, 609361L, 609373L, 609379L, 609391L, 609397L, 609403L,
-609407L, 609421L, 609437L, 609443L, 609461L, 609487L, 609503L, 609509L, 609517L,
-609527L, 609533L, 609541L, 609571L, 609589L, 609593L, 609599L, 609601L, 609607L,
-609613L, 609617L, 609619L, 609641L, 609673L, 609683L, 609701L, 609709L, 609743L,
-609751L, 609757L, 609779L, 609781L, 609803L, 609809L, 609821L, 609859L, 609877L,
-609887L, 609907L, 609911L, 609913L, 609923L, 609929L, 609979L, 609989L, 609991L,
-609997L, 610031L, 610063L, 610081L, 610123L, 610157L, 610163L, 610187L, 610193L,
-610199L, 610217L, 610219L, 610229L, 610243L, 610271L, 610279L, 610289L, 610301L,
-610327L, 610331L, 610339L, 610391L, 610409L, 610417L, 610429L, 610439L, 610447L,
-610457L, 610469L, 610501L, 610523L, 610541L, 610543L, 610553L, 610559L, 610567L,
-610579L, 610583L, 610619L, 610633L, 610639L, 610651L, 610661L, 610667L, 610681L,
-610699L, 610703L, 610721L, 610733L, 610739L, 610741L, 610763L, 610781L, 610783L,
-610787L, 610801L, 610817L, 610823L, 610829L, 610837L, 610843L, 610847L, 610849L,
-610867L, 610877L, 610879L, 610891L, 610913L, 610919L, 610921L, 610933L, 610957L,
-610969L, 610993L, 611011L, 611027L, 611033L, 611057L, 611069L, 611071L, 611081L,
-611101L, 611111L, 611113L, 611131L, 611137L, 611147L, 611189L, 611207L, 611213L,
-611257L, 611263L, 611279L, 611293L, 611297L, 611323L, 611333L, 611389L, 611393L,
-611411L, 611419L, 611441L, 611449L, 611453L, 611459L, 611467L, 611483L, 611497L,
-611531L, 611543L, 611549L, 611551L, 611557L, 611561L, 611587L, 611603L, 611621L,
-611641L, 611657L, 611671L, 611693L, 611707L, 611729L, 611753L, 611791L, 611801L,
-611803L, 611827L, 611833L, 611837L, 611839L, 611873L, 611879L, 611887L, 611903L,
-611921L, 611927L, 611939L, 611951L, 611953L, 611957L, 611969L, 611977L, 611993L,
-611999L, 612011L, 612023L, 612037L, 612041L, 612043L, 612049L, 612061L, 612067L,
-612071L, 612083L, 612107L, 612109L, 612113L, 612133L, 612137L, 612149L, 612169L,
-612173L, 612181L, 612193L, 612217L, 612223L, 612229L, 612259L, 612263L, 612301L,
-612307L, 612317L, 612319L, 612331L, 612341L, 612349L, 612371L, 612373L, 612377L,
-612383L, 612401L, 612407L, 612439L, 612481L, 612497L, 612511L, 612553L, 612583L,
-612589L, 612611L, 612613L, 612637L, 612643L, 612649L, 612671L, 612679L, 612713L,
-612719L, 612727L, 612737L, 612751L, 612763L, 612791L, 612797L, 612809L, 612811L,
-612817L, 612823L, 612841L, 612847L, 612853L, 612869L, 612877L, 612889L, 612923L,
-612929L, 612947L, 612967L, 612971L, 612977L, 613007L, 613009L, 613013L, 613049L,
-613061L, 613097L, 613099L, 613141L, 613153L, 613163L, 613169L, 613177L, 613181L,
-613189L, 613199L, 613213L, 613219L, 613229L, 613231L, 613243L, 613247L, 613253L,
-613267L, 613279L, 613289L, 613297L, 613337L, 613357L, 613363L, 613367L, 613381L,
-613421L, 613427L, 613439L, 613441L, 613447L, 613451L, 613463L, 613469L, 613471L,
-613493L, 613499L, 613507L, 613523L, 613549L, 613559L, 613573L, 613577L, 613597L,
-613607L, 613609L, 613633L, 613637L, 613651L, 613661L, 613667L, 613673L, 613699L,
-613733L, 613741L, 613747L, 613759L, 613763L, 613807L, 613813L, 613817L, 613829L,
-613841L, 613849L, 613861L, 613883L, 613889L, 613903L, 613957L, 613967L, 613969L,
-613981L, 613993L, 613999L, 614041L, 614051L, 614063L, 614071L, 614093L, 614101L,
-614113L, 614129L, 614143L, 614147L, 614153L, 614167L, 614177L, 614179L, 614183L,
-614219L, 614267L, 614279L, 614291L, 614293L, 614297L, 614321L, 614333L, 614377L,
-614387L, 614413L, 614417L, 614437L, 614477L, 614483L, 614503L, 614527L, 614531L,
-614543L, 614561L, 614563L, 614569L, 614609L, 614611L, 614617L, 614623L, 614633L,
-614639L, 614657L, 614659L, 614671L, 614683L, 614687L, 614693L, 614701L, 614717L,
-614729L, 614741L, 614743L, 614749L, 614753L, 614759L, 614773L, 614827L, 614843L,
-614849L, 614851L, 614863L, 614881L, 614893L, 614909L, 614917L, 614927L, 614963L,
-614981L, 614983L, 615019L, 615031L, 615047L, 615053L, 615067L, 615101L, 615103L,
-615107L, 615137L, 615151L, 615161L, 615187L, 615229L, 615233L, 615253L, 615259L,
-615269L, 615289L, 615299L, 615313L, 615337L, 615341L, 615343L, 615367L, 615379L,
-615389L, 615401L, 615403L, 615413L, 615427L, 615431L, 615437L, 615449L, 615473L,
-615479L, 615491L, 615493L, 615497L, 615509L, 615521L, 615539L, 615557L, 615577L,
-615599L, 615607L, 615617L, 615623L, 615661L, 615677L, 615679L, 615709L, 615721L,
-615731L, 615739L, 615743L, 615749L, 615751L, 615761L, 615767L, 615773L, 615793L,
-615799L, 615821L, 615827L, 615829L, 615833L, 615869L, 615883L, 615887L, 615907L,
-615919L, 615941L, 615949L, 615971L, 615997L, 616003L, 616027L, 616051L, 616069L,
-616073L, 616079L, 616103L, 616111L, 616117L, 616129L, 616139L, 616141L, 616153L,
-616157L, 616169L, 616171L, 616181L, 616207L, 616211L, 616219L, 616223L, 616229L,
-616243L, 616261L, 616277L, 616289L, 616307L, 616313L, 616321L, 616327L, 616361L,
-616367L, 616387L, 616391L, 616393L, 616409L, 616411L, 616433L, 616439L, 616459L,
-616463L, 616481L, 616489L, 616501L, 616507L, 616513L, 616519L, 616523L, 616529L,
-616537L, 616547L, 616579L, 616589L, 616597L, 616639L, 616643L, 616669L, 616673L,
-616703L, 616717L, 616723L, 616729L, 616741L, 616757L, 616769L, 616783L, 616787L,
-616789L, 616793L, 616799L, 616829L, 616841L, 616843L, 616849L, 616871L, 616877L,
-616897L, 616909L, 616933L, 616943L, 616951L, 616961L, 616991L, 616997L, 616999L,
-617011L, 617027L, 617039L, 617051L, 617053L, 617059L, 617077L, 617087L, 617107L,
-617119L, 617129L, 617131L, 617147L, 617153L, 617161L, 617189L, 617191L, 617231L,
-617233L, 617237L, 617249L, 617257L, 617269L, 617273L, 617293L, 617311L, 617327L,
-617333L, 617339L, 617341L, 617359L, 617363L, 617369L, 617387L, 617401L, 617411L,
-617429L, 617447L, 617453L, 617467L, 617471L, 617473L, 617479L, 617509L, 617521L,
-617531L, 617537L, 617579L, 617587L, 617647L, 617651L, 617657L, 617677L, 617681L,
-617689L, 617693L, 617699L, 617707L, 617717L, 617719L, 617723L, 617731L, 617759L,
-617761L, 617767L, 617777L, 617791L, 617801L, 617809L, 617819L, 617843L, 617857L,
-617873L, 617879L, 617887L, 617917L, 617951L, 617959L, 617963L, 617971L, 617983L,
-618029L, 618031L, 618041L, 618049L, 618053L, 618083L, 618119L, 618131L, 618161L,
-618173L, 618199L, 618227L, 618229L, 618253L, 618257L, 618269L, 618271L, 618287L,
-618301L, 618311L, 618323L, 618329L, 618337L, 618347L, 618349L, 618361L, 618377L,
-618407L, 618413L, 618421L, 618437L, 618439L, 618463L, 618509L, 618521L, 618547L,
-618559L, 618571L, 618577L, 618581L, 618587L, 618589L, 618593L, 618619L, 618637L,
-618643L, 618671L, 618679L, 618703L, 618707L, 618719L, 618799L, 618823L, 618833L,
-618841L, 618847L, 618857L, 618859L, 618869L, 618883L, 618913L, 618929L, 618941L,
-618971L, 618979L, 618991L, 618997L, 619007L, 619009L, 619019L, 619027L, 619033L,
-619057L, 619061L, 619067L, 619079L, 619111L, 619117L, 619139L, 619159L, 619169L,
-619181L, 619187L, 619189L, 619207L, 619247L, 619253L, 619261L, 619273L, 619277L,
-619279L, 619303L, 619309L, 619313L, 619331L, 619363L, 619373L, 619391L, 619397L,
-619471L, 619477L, 619511L, 619537L, 619543L, 619561L, 619573L, 619583L, 619589L,
-619603L, 619607L, 619613L, 619621L, 619657L, 619669L, 619681L, 619687L, 619693L,
-619711L, 619739L, 619741L, 619753L, 619763L, 619771L, 619793L, 619807L, 619811L,
-619813L, 619819L, 619831L, 619841L, 619849L, 619867L, 619897L, 619909L, 619921L,
-619967L, 619979L, 619981L, 619987L, 619999L, 620003L, 620029L, 620033L, 620051L,
-620099L, 620111L, 620117L, 620159L, 620161L, 620171L, 620183L, 620197L, 620201L,
-620227L, 620233L, 620237L, 620239L, 620251L, 620261L, 620297L, 620303L, 620311L,
-620317L, 620329L, 620351L, 620359L, 620363L, 620377L, 620383L, 620393L, 620401L,
-620413L, 620429L, 620437L, 620441L, 620461L, 620467L, 620491L, 620507L, 620519L,
-620531L, 620549L, 620561L, 620567L, 620569L, 620579L, 620603L, 620623L, 620639L,
-620647L, 620657L, 620663L, 620671L, 620689L, 620693L, 620717L, 620731L, 620743L,
-620759L, 620771L, 620773L, 620777L, 620813L, 620821L, 620827L, 620831L, 620849L,
-620869L, 620887L, 620909L, 620911L, 620929L, 620933L, 620947L, 620957L, 620981L,
-620999L, 621007L, 621013L, 621017L, 621029L, 621031L, 621043L, 621059L, 621083L,
-621097L, 621113L, 621133L, 621139L, 621143L, 621217L, 621223L, 621227L, 621239L,
-621241L, 621259L, 621289L, 621301L, 621317L, 621337L, 621343L, 621347L, 621353L,
-621359L, 621371L, 621389L, 621419L, 621427L, 621431L, 621443L, 621451L, 621461L,
-621473L, 621521L, 621527L, 621541L, 621583L, 621611L, 621617L, 621619L, 621629L,
-621631L, 621641L, 621671L, 621679L, 621697L, 621701L, 621703L, 621721L, 621739L,
-621749L, 621757L, 621769L, 621779L, 621799L, 621821L, 621833L, 621869L, 621871L,
-621883L, 621893L, 621913L, 621923L, 621937L, 621941L, 621983L, 621997L, 622009L,
-622019L, 622043L, 622049L, 622051L, 622067L, 622073L, 622091L, 622103L, 622109L,
-622123L, 622129L, 622133L, 622151L, 622157L, 622159L, 622177L, 622187L, 622189L,
-622241L, 622243L, 622247L, 622249L, 622277L, 622301L, 622313L, 622331L, 622333L,
-622337L, 622351L, 622367L, 622397L, 622399L, 622423L, 622477L, 622481L, 622483L,
-622493L, 622513L, 622519L, 622529L, 622547L, 622549L, 622561L, 622571L, 622577L,
-622603L, 622607L, 622613L, 622619L, 622621L, 622637L, 622639L, 622663L, 622669L,
-622709L, 622723L, 622729L, 622751L, 622777L, 622781L, 622793L, 622813L, 622849L,
-622861L, 622879L, 622889L, 622901L, 622927L, 622943L, 622957L, 622967L, 622987L,
-622997L, 623003L, 623009L, 623017L, 623023L, 623041L, 623057L, 623059L, 623071L,
-623107L, 623171L, 623209L, 623221L, 623261L, 623263L, 623269L, 623279L, 623281L,
-623291L, 623299L, 623303L, 623321L, 623327L, 623341L, 623351L, 623353L, 623383L,
-623387L, 623393L, 623401L, 623417L, 623423L, 623431L, 623437L, 623477L, 623521L,
-623531L, 623537L, 623563L, 623591L, 623617L, 623621L, 623633L, 623641L, 623653L,
-623669L, 623671L, 623677L, 623681L, 623683L, 623699L, 623717L, 623719L, 623723L,
-623729L, 623743L, 623759L, 623767L, 623771L, 623803L, 623839L, 623851L, 623867L,
-623869L, 623879L, 623881L, 623893L, 623923L, 623929L, 623933L, 623947L, 623957L,
-623963L, 623977L, 623983L, 623989L, 624007L, 624031L, 624037L, 624047L, 624049L,
-624067L, 624089L, 624097L, 624119L, 624133L, 624139L, 624149L, 624163L, 624191L,
-624199L, 624203L, 624209L, 624229L, 624233L, 624241L, 624251L, 624259L, 624271L,
-624277L, 624311L, 624313L, 624319L, 624329L, 624331L, 624347L, 624391L, 624401L,
-624419L, 624443L, 624451L, 624467L, 624469L, 624479L, 624487L, 624497L, 624509L,
-624517L, 624521L, 624539L, 624541L, 624577L, 624593L, 624599L, 624601L, 624607L,
-624643L, 624649L, 624667L, 624683L, 624707L, 624709L, 624721L, 624727L, 624731L,
-624737L, 624763L, 624769L, 624787L, 624791L, 624797L, 624803L, 624809L, 624829L,
-624839L, 624847L, 624851L, 624859L, 624917L, 624961L, 624973L, 624977L, 624983L,
-624997L, 625007L, 625033L, 625057L, 625063L, 625087L, 625103L, 625109L, 625111L,
-625129L, 625133L, 625169L, 625171L, 625181L, 625187L, 625199L, 625213L, 625231L,
-625237L, 625253L, 625267L, 625279L, 625283L, 625307L, 625319L, 625343L, 625351L,
-625367L, 625369L, 625397L, 625409L, 625451L, 625477L, 625483L, 625489L, 625507L,
-625517L, 625529L, 625543L, 625589L, 625591L, 625609L, 625621L, 625627L, 625631L,
-625637L, 625643L, 625657L, 625661L, 625663L, 625697L, 625699L, 625763L, 625777L,
-625789L, 625811L, 625819L, 625831L, 625837L, 625861L, 625871L, 625883L, 625909L,
-625913L, 625927L, 625939L, 625943L, 625969L, 625979L, 625997L, 626009L, 626011L,
-626033L, 626051L, 626063L, 626113L, 626117L, 626147L, 626159L, 626173L, 626177L,
-626189L, 626191L, 626201L, 626207L, 626239L, 626251L, 626261L, 626317L, 626323L,
-626333L, 626341L, 626347L, 626363L, 626377L, 626389L, 626393L, 626443L, 626477L,
-626489L, 626519L, 626533L, 626539L, 626581L, 626597L, 626599L, 626609L, 626611L,
-626617L, 626621L, 626623L, 626627L, 626629L, 626663L, 626683L, 626687L, 626693L,
-626701L, 626711L, 626713L, 626723L, 626741L, 626749L, 626761L, 626771L, 626783L,
-626797L, 626809L, 626833L, 626837L, 626861L, 626887L, 626917L, 626921L, 626929L,
-626947L, 626953L, 626959L, 626963L, 626987L, 627017L, 627041L, 627059L, 627071L,
-627073L, 627083L, 627089L, 627091L, 627101L, 627119L, 627131L, 627139L, 627163L,
-627169L, 627191L, 627197L, 627217L, 627227L, 627251L, 627257L, 627269L, 627271L,
-627293L, 627301L, 627329L, 627349L, 627353L, 627377L, 627379L, 627383L, 627391L,
-627433L, 627449L, 627479L, 627481L, 627491L, 627511L, 627541L, 627547L, 627559L,
-627593L, 627611L, 627617L, 627619L, 627637L, 627643L, 627659L, 627661L, 627667L,
-627673L, 627709L, 627721L, 627733L, 627749L, 627773L, 627787L, 627791L, 627797L,
-627799L, 627811L, 627841L, 627859L, 627901L, 627911L, 627919L, 627943L, 627947L,
-627953L, 627961L, 627973L, 628013L, 628021L, 628037L, 628049L, 628051L, 628057L,
-628063L, 628093L, 628097L, 628127L, 628139L, 628171L, 628183L, 628189L, 628193L,
-628207L, 628213L, 628217L, 628219L, 628231L, 628261L, 628267L, 628289L, 628301L,
-628319L, 628357L, 628363L, 628373L, 628379L, 628391L, 628399L, 628423L, 628427L,
-628447L, 628477L, 628487L, 628493L, 628499L, 628547L, 628561L, 628583L, 628591L,
-628651L, 628673L, 628679L, 628681L, 628687L, 628699L, 628709L, 628721L, 628753L,
-628757L, 628759L, 628781L, 628783L, 628787L, 628799L, 628801L, 628811L, 628819L,
-628841L, 628861L, 628877L, 628909L, 628913L, 628921L, 628937L, 628939L, 628973L,
-628993L, 628997L, 629003L, 629009L, 629011L, 629023L, 629029L, 629059L, 629081L,
-629113L, 629137L, 629143L, 629171L, 629177L, 629203L, 629243L, 629249L, 629263L,
-629281L, 629311L, 629339L, 629341L, 629351L, 629371L, 629381L, 629383L, 629401L,
-629411L, 629417L, 629429L, 629449L, 629467L, 629483L, 629491L, 629509L, 629513L,
-629537L, 629567L, 629569L, 629591L, 629593L, 629609L, 629611L, 629617L, 629623L,
-629653L, 629683L, 629687L, 629689L, 629701L, 629711L, 629723L, 629737L, 629743L,
-629747L, 629767L, 629773L, 629779L, 629803L, 629807L, 629819L, 629843L, 629857L,
-629861L, 629873L, 629891L, 629897L, 629899L, 629903L, 629921L, 629927L, 629929L,
-629939L, 629963L, 629977L, 629987L, 629989L, 630017L, 630023L, 630029L, 630043L,
-630067L, 630101L, 630107L, 630127L, 630151L, 630163L, 630167L, 630169L, 630181L,
-630193L, 630197L, 630229L, 630247L, 630263L, 630281L, 630299L, 630307L, 630319L,
-630349L, 630353L, 630391L, 630433L, 630451L, 630467L, 630473L, 630481L, 630493L,
-630521L, 630523L, 630529L, 630559L, 630577L, 630583L, 630587L, 630589L, 630593L,
-630607L, 630613L, 630659L, 630677L, 630689L, 630701L, 630709L, 630713L, 630719L,
-630733L, 630737L, 630797L, 630803L, 630823L, 630827L, 630841L, 630863L, 630871L,
-630893L, 630899L, 630901L, 630907L, 630911L, 630919L, 630941L, 630967L, 630997L,
-631003L, 631013L, 631039L, 631061L, 631121L, 631133L, 631139L, 631151L, 631153L,
-631157L, 631171L, 631181L, 631187L, 631223L, 631229L, 631247L, 631249L, 631259L,
-631271L, 631273L, 631291L, 631307L, 631339L, 631357L, 631361L, 631387L, 631391L,
-631399L, 631409L, 631429L, 631453L, 631457L, 631459L, 631469L, 631471L, 631483L,
-631487L, 631507L, 631513L, 631529L, 631531L, 631537L, 631549L, 631559L, 631573L,
-631577L, 631583L, 631597L, 631613L, 631619L, 631643L, 631667L, 631679L, 631681L,
-631711L, 631717L, 631723L, 631733L, 631739L, 631751L, 631753L, 631789L, 631817L,
-631819L, 631843L, 631847L, 631853L, 631859L, 631861L, 631867L, 631889L, 631901L,
-631903L, 631913L, 631927L, 631931L, 631937L, 631979L, 631987L, 631991L, 631993L,
-632029L, 632041L, 632053L, 632081L, 632083L, 632087L, 632089L, 632101L, 632117L,
-632123L, 632141L, 632147L, 632153L, 632189L, 632209L, 632221L, 632227L, 632231L,
-632251L, 632257L, 632267L, 632273L, 632297L, 632299L, 632321L, 632323L, 632327L,
-632329L, 632347L, 632351L, 632353L, 632363L, 632371L, 632381L, 632389L, 632393L,
-632447L, 632459L, 632473L, 632483L, 632497L, 632501L, 632503L, 632521L, 632557L,
-632561L, 632591L, 632609L, 632623L, 632627L, 632629L, 632647L, 632669L, 632677L,
-632683L, 632699L, 632713L, 632717L, 632743L, 632747L, 632773L, 632777L, 632813L,
-632839L, 632843L, 632851L, 632857L, 632881L, 632897L, 632911L, 632923L, 632939L,
-632941L, 632971L, 632977L, 632987L, 632993L, 633001L, 633013L, 633037L, 633053L,
-633067L, 633079L, 633091L, 633133L, 633151L, 633161L, 633187L, 633197L, 633209L,
-633221L, 633253L, 633257L, 633263L, 633271L, 633287L, 633307L, 633317L, 633337L,
-633359L, 633377L, 633379L, 633383L, 633401L, 633407L, 633427L, 633449L, 633461L,
-633463L, 633467L, 633469L, 633473L, 633487L, 633497L, 633559L, 633569L, 633571L,
-633583L, 633599L, 633613L, 633623L, 633629L, 633649L, 633653L, 633667L, 633739L,
-633751L, 633757L, 633767L, 633781L, 633791L, 633793L, 633797L, 633799L, 633803L,
-633823L, 633833L, 633877L, 633883L, 633923L, 633931L, 633937L, 633943L, 633953L,
-633961L, 633967L, 633991L, 634003L, 634013L, 634031L, 634061L, 634079L, 634091L,
-634097L, 634103L, 634141L, 634157L, 634159L, 634169L, 634177L, 634181L, 634187L,
-634199L, 634211L, 634223L, 634237L, 634241L, 634247L, 634261L, 634267L, 634273L,
-634279L, 634301L, 634307L, 634313L, 634327L, 634331L, 634343L, 634367L, 634373L,
-634397L, 634421L, 634441L, 634471L, 634483L, 634493L, 634499L, 634511L, 634519L,
-634523L, 634531L, 634541L, 634567L, 634573L, 634577L, 634597L, 634603L, 634609L,
-634643L, 634649L, 634651L, 634679L, 634681L, 634687L, 634703L, 634709L, 634717L,
-634727L, 634741L, 634747L, 634757L, 634759L, 634793L, 634807L, 634817L, 634841L,
-634853L, 634859L, 634861L, 634871L, 634891L, 634901L, 634903L, 634927L, 634937L,
-634939L, 634943L, 634969L, 634979L, 635003L, 635021L, 635039L, 635051L, 635057L,
-635087L, 635119L, 635147L, 635149L, 635197L, 635203L, 635207L, 635249L, 635251L,
-635263L, 635267L, 635279L, 635287L, 635291L, 635293L, 635309L, 635317L, 635333L,
-635339L, 635347L, 635351L, 635353L, 635359L, 635363L, 635387L, 635389L, 635413L,
-635423L, 635431L, 635441L, 635449L, 635461L, 635471L, 635483L, 635507L, 635519L,
-635527L, 635533L, 635563L, 635567L, 635599L, 635603L, 635617L, 635639L, 635653L,
-635659L, 635689L, 635707L, 635711L, 635729L, 635731L, 635737L, 635777L, 635801L,
-635809L, 635813L, 635821L, 635837L, 635849L, 635867L, 635879L, 635891L, 635893L,
-635909L, 635917L, 635923L, 635939L, 635959L, 635969L, 635977L, 635981L, 635983L,
-635989L, 636017L, 636023L, 636043L, 636059L, 636061L, 636071L, 636073L, 636107L,
-636109L, 636133L, 636137L, 636149L, 636193L, 636211L, 636217L, 636241L, 636247L,
-636257L, 636263L, 636277L, 636283L, 636287L, 636301L, 636313L, 636319L, 636331L,
-636343L, 636353L, 636359L, 636403L, 636407L, 636409L, 636421L, 636469L, 636473L,
-636499L, 636533L, 636539L, 636541L, 636547L, 636553L, 636563L, 636569L, 636613L,
-636619L, 636631L, 636653L, 636673L, 636697L, 636719L, 636721L, 636731L, 636739L,
-636749L, 636761L, 636763L, 636773L, 636781L, 636809L, 636817L, 636821L, 636829L,
-636851L, 636863L, 636877L, 636917L, 636919L, 636931L, 636947L, 636953L, 636967L,
-636983L, 636997L, 637001L, 637003L, 637067L, 637073L, 637079L, 637097L, 637129L,
-637139L, 637157L, 637163L, 637171L, 637199L, 637201L, 637229L, 637243L, 637271L,
-637277L, 637283L, 637291L, 637297L, 637309L, 637319L, 637321L, 637327L, 637337L,
-637339L, 637349L, 637369L, 637379L, 637409L, 637421L, 637423L, 637447L, 637459L,
-637463L, 637471L, 637489L, 637499L, 637513L, 637519L, 637529L, 637531L, 637543L,
-637573L, 637597L, 637601L, 637603L, 637607L, 637627L, 637657L, 637669L, 637691L,
-637699L, 637709L, 637711L, 637717L, 637723L, 637727L, 637729L, 637751L, 637771L,
-637781L, 637783L, 637787L, 637817L, 637829L, 637831L, 637841L, 637873L, 637883L,
-637909L, 637933L, 637937L, 637939L, 638023L, 638047L, 638051L, 638059L, 638063L,
-638081L, 638117L, 638123L, 638147L, 638159L, 638161L, 638171L, 638177L, 638179L,
-638201L, 638233L, 638263L, 638269L, 638303L, 638317L, 638327L, 638347L, 638359L,
-638371L, 638423L, 638431L, 638437L, 638453L, 638459L, 638467L, 638489L, 638501L,
-638527L, 638567L, 638581L, 638587L, 638621L, 638629L, 638633L, 638663L, 638669L,
-638689L, 638699L, 638717L, 638719L, 638767L, 638801L, 638819L, 638839L, 638857L,
-638861L, 638893L, 638923L, 638933L, 638959L, 638971L, 638977L, 638993L, 638999L,
-639007L, 639011L, 639043L, 639049L, 639053L, 639083L, 639091L, 639137L, 639143L,
-639151L, 639157L, 639167L, 639169L, 639181L, 639211L, 639253L, 639257L, 639259L,
-639263L, 639269L, 639299L, 639307L, 639311L, 639329L, 639337L, 639361L, 639371L,
-639391L, 639433L, 639439L, 639451L, 639487L, 639491L, 639493L, 639511L, 639517L,
-639533L, 639547L, 639563L, 639571L, 639577L, 639589L, 639599L, 639601L, 639631L,
-639637L, 639647L, 639671L, 639677L, 639679L, 639689L, 639697L, 639701L, 639703L,
-639713L, 639719L, 639731L, 639739L, 639757L, 639833L, 639839L, 639851L, 639853L,
-639857L, 639907L, 639911L, 639937L, 639941L, 639949L, 639959L, 639983L, 639997L,
-640007L, 640009L, 640019L, 640027L, 640039L, 640043L, 640049L, 640061L, 640069L,
-640099L, 640109L, 640121L, 640127L, 640139L, 640151L, 640153L, 640163L, 640193L,
-640219L, 640223L, 640229L, 640231L, 640247L, 640249L, 640259L, 640261L, 640267L,
-640279L, 640303L, 640307L, 640333L, 640363L, 640369L, 640411L, 640421L, 640457L,
-640463L, 640477L, 640483L, 640499L, 640529L, 640531L, 640579L, 640583L, 640589L,
-640613L, 640621L, 640631L, 640649L, 640663L, 640667L, 640669L, 640687L, 640691L,
-640727L, 640733L, 640741L, 640771L, 640777L, 640793L, 640837L, 640847L, 640853L,
-640859L, 640873L, 640891L, 640901L, 640907L, 640919L, 640933L, 640943L, 640949L,
-640957L, 640963L, 640967L, 640973L, 640993L, 641051L, 641057L, 641077L, 641083L,
-641089L, 641093L, 641101L, 641129L, 641131L, 641143L, 641167L, 641197L, 641203L,
-641213L, 641227L, 641239L, 641261L, 641279L, 641287L, 641299L, 641317L, 641327L,
-641371L, 641387L, 641411L, 641413L, 641419L, 641437L, 641441L, 641453L, 641467L,
-641471L, 641479L, 641491L, 641513L, 641519L, 641521L, 641549L, 641551L, 641579L,
-641581L, 641623L, 641633L, 641639L, 641681L, 641701L, 641713L, 641747L, 641749L,
-641761L, 641789L, 641791L, 641803L, 641813L, 641819L, 641821L, 641827L, 641833L,
-641843L, 641863L, 641867L, 641873L, 641881L, 641891L, 641897L, 641909L, 641923L,
-641929L, 641959L, 641969L, 641981L, 642011L, 642013L, 642049L, 642071L, 642077L,
-642079L, 642113L, 642121L, 642133L, 642149L, 642151L, 642157L, 642163L, 642197L,
-642199L, 642211L, 642217L, 642223L, 642233L, 642241L, 642247L, 642253L, 642281L,
-642359L, 642361L, 642373L, 642403L, 642407L, 642419L, 642427L, 642457L, 642487L,
-642517L, 642527L, 642529L, 642533L, 642547L, 642557L, 642563L, 642581L, 642613L,
-642623L, 642673L, 642683L, 642701L, 642737L, 642739L, 642769L, 642779L, 642791L,
-642797L, 642799L, 642809L, 642833L, 642853L, 642869L, 642871L, 642877L, 642881L,
-642899L, 642907L, 642931L, 642937L, 642947L, 642953L, 642973L, 642977L, 642997L,
-643009L, 643021L, 643031L, 643039L, 643043L, 643051L, 643061L, 643073L, 643081L,
-643087L, 643099L, 643121L, 643129L, 643183L, 643187L, 643199L, 643213L, 643217L,
-643231L, 643243L, 643273L, 643301L, 643303L, 643369L, 643373L, 643403L, 643421L,
-643429L, 643439L, 643453L, 643457L, 643463L, 643469L, 643493L, 643507L, 643523L,
-643547L, 643553L, 643567L, 643583L, 643589L, 643619L, 643633L, 643639L, 643649L,
-643651L, 643661L, 643681L, 643691L, 643693L, 643697L, 643703L, 643723L, 643729L,
-643751L, 643781L, 643847L, 643849L, 643859L, 643873L, 643879L, 643883L, 643889L,
-643919L, 643927L, 643949L, 643957L, 643961L, 643969L, 643991L, 644009L, 644029L,
-644047L, 644051L, 644053L, 644057L, 644089L, 644101L, 644107L, 644117L, 644123L,
-644129L, 644131L, 644141L, 644143L, 644153L, 644159L, 644173L, 644191L, 644197L,
-644201L, 644227L, 644239L, 644257L, 644261L, 644291L, 644297L, 644327L, 644341L,
-644353L, 644359L, 644363L, 644377L, 644381L, 644383L, 644401L, 644411L, 644431L,
-644443L, 644447L, 644489L, 644491L, 644507L, 644513L, 644519L, 644531L, 644549L,
-644557L, 644563L, 644569L, 644593L, 644597L, 644599L, 644617L, 644629L, 644647L,
-644653L, 644669L, 644671L, 644687L, 644701L, 644717L, 644729L, 644731L, 644747L,
-644753L, 644767L, 644783L, 644789L, 644797L, 644801L, 644837L, 644843L, 644857L,
-644863L, 644867L, 644869L, 644881L, 644899L, 644909L, 644911L, 644923L, 644933L,
-644951L, 644977L, 644999L, 645011L, 645013L, 645019L, 645023L, 645037L, 645041L,
-645049L, 645067L, 645077L, 645083L, 645091L, 645097L, 645131L, 645137L, 645149L,
-645179L, 645187L, 645233L, 645257L, 645313L, 645329L, 645347L, 645353L, 645367L,
-645383L, 645397L, 645409L, 645419L, 645431L, 645433L, 645443L, 645467L, 645481L,
-645493L, 645497L, 645499L, 645503L, 645521L, 645527L, 645529L, 645571L, 645577L,
-645581L, 645583L, 645599L, 645611L, 645629L, 645641L, 645647L, 645649L, 645661L,
-645683L, 645691L, 645703L, 645713L, 645727L, 645737L, 645739L, 645751L, 645763L,
-645787L, 645803L, 645833L, 645839L, 645851L, 645857L, 645877L, 645889L, 645893L,
-645901L, 645907L, 645937L, 645941L, 645973L, 645979L, 646003L, 646013L, 646027L,
-646039L, 646067L, 646073L, 646099L, 646103L, 646147L, 646157L, 646159L, 646169L,
-646181L, 646183L, 646189L, 646193L, 646199L, 646237L, 646253L, 646259L, 646267L,
-646271L, 646273L, 646291L, 646301L, 646307L, 646309L, 646339L, 646379L, 646397L,
-646403L, 646411L, 646421L, 646423L, 646433L, 646453L, 646519L, 646523L, 646537L,
-646543L, 646549L, 646571L, 646573L, 646577L, 646609L, 646619L, 646631L, 646637L,
-646643L, 646669L, 646687L, 646721L, 646757L, 646771L, 646781L, 646823L, 646831L,
-646837L, 646843L, 646859L, 646873L, 646879L, 646883L, 646889L, 646897L, 646909L,
-646913L, 646927L, 646937L, 646957L, 646979L, 646981L, 646991L, 646993L, 647011L,
-647033L, 647039L, 647047L, 647057L, 647069L, 647081L, 647099L, 647111L, 647113L,
-647117L, 647131L, 647147L, 647161L, 647189L, 647201L, 647209L, 647219L, 647261L,
-647263L, 647293L, 647303L, 647321L, 647327L, 647333L, 647341L, 647357L, 647359L,
-647363L, 647371L, 647399L, 647401L, 647417L, 647429L, 647441L, 647453L, 647477L,
-647489L, 647503L, 647509L, 647527L, 647531L, 647551L, 647557L, 647579L, 647587L,
-647593L, 647609L, 647617L, 647627L, 647641L, 647651L, 647659L, 647663L, 647687L,
-647693L, 647719L, 647723L, 647741L, 647743L, 647747L, 647753L, 647771L, 647783L,
-647789L, 647809L, 647821L, 647837L, 647839L, 647851L, 647861L, 647891L, 647893L,
-647909L, 647917L, 647951L, 647953L, 647963L, 647987L, 648007L, 648019L, 648029L,
-648041L, 648047L, 648059L, 648061L, 648073L, 648079L, 648097L, 648101L, 648107L,
-648119L, 648133L, 648173L, 648181L, 648191L, 648199L, 648211L, 648217L, 648229L,
-648239L, 648257L, 648259L, 648269L, 648283L, 648289L, 648293L, 648317L, 648331L,
-648341L, 648343L, 648371L, 648377L, 648379L, 648383L, 648391L, 648433L, 648437L,
-648449L, 648481L, 648509L, 648563L, 648607L, 648617L, 648619L, 648629L, 648631L,
-648649L, 648653L, 648671L, 648677L, 648689L, 648709L, 648719L, 648731L, 648763L,
-648779L, 648803L, 648841L, 648859L, 648863L, 648871L, 648887L, 648889L, 648911L,
-648917L, 648931L, 648937L, 648953L, 648961L, 648971L, 648997L, 649001L, 649007L,
-649039L, 649063L, 649069L, 649073L, 649079L, 649081L, 649087L, 649093L, 649123L,
-649141L, 649147L, 649151L, 649157L, 649183L, 649217L, 649261L, 649273L, 649277L,
-649279L, 649283L, 649291L, 649307L, 649321L, 649361L, 649379L, 649381L, 649403L,
-649421L, 649423L, 649427L, 649457L, 649469L, 649471L, 649483L, 649487L, 649499L,
-649501L, 649507L, 649511L, 649529L, 649541L, 649559L, 649567L, 649573L, 649577L,
-649613L, 649619L, 649631L, 649633L, 649639L, 649643L, 649651L, 649657L, 649661L,
-649697L, 649709L, 649717L, 649739L, 649751L, 649769L, 649771L, 649777L, 649783L,
-649787L, 649793L, 649799L, 649801L, 649813L, 649829L, 649843L, 649849L, 649867L,
-649871L, 649877L, 649879L, 649897L, 649907L, 649921L, 649937L, 649969L, 649981L,
-649991L, 650011L, 650017L, 650059L, 650071L, 650081L, 650099L, 650107L, 650179L,
-650183L, 650189L, 650213L, 650227L, 650261L, 650269L, 650281L, 650291L, 650317L,
-650327L, 650329L, 650347L, 650359L, 650387L, 650401L, 650413L, 650449L, 650477L,
-650479L, 650483L, 650519L, 650537L, 650543L, 650549L, 650563L, 650567L, 650581L,
-650591L, 650599L, 650609L, 650623L, 650627L, 650669L, 650701L, 650759L, 650761L,
-650779L, 650813L, 650821L, 650827L, 650833L, 650851L, 650861L, 650863L, 650869L,
-650873L, 650911L, 650917L, 650927L, 650933L, 650953L, 650971L, 650987L, 651017L,
-651019L, 651029L, 651043L, 651067L, 651071L, 651097L, 651103L, 651109L, 651127L,
-651139L, 651143L, 651169L, 651179L, 651181L, 651191L, 651193L, 651221L, 651223L,
-651239L, 651247L, 651251L, 651257L, 651271L, 651281L, 651289L, 651293L, 651323L,
-651331L, 651347L, 651361L, 651397L, 651401L, 651437L, 651439L, 651461L, 651473L,
-651481L, 651487L, 651503L, 651509L, 651517L, 651587L, 651617L, 651641L, 651647L,
-651649L, 651667L, 651683L, 651689L, 651697L, 651727L, 651731L, 651733L, 651767L,
-651769L, 651793L, 651803L, 651809L, 651811L, 651821L, 651839L, 651841L, 651853L,
-651857L, 651863L, 651869L, 651877L, 651881L, 651901L, 651913L, 651943L, 651971L,
-651997L, 652019L, 652033L, 652039L, 652063L, 652079L, 652081L, 652087L, 652117L,
-652121L, 652153L, 652189L, 652207L, 652217L, 652229L, 652237L, 652241L, 652243L,
-652261L, 652279L, 652283L, 652291L, 652319L, 652321L, 652331L, 652339L, 652343L,
-652357L, 652361L, 652369L, 652373L, 652381L, 652411L, 652417L, 652429L, 652447L,
-652451L, 652453L, 652493L, 652499L, 652507L, 652541L, 652543L, 652549L, 652559L,
-652567L, 652573L, 652577L, 652591L, 652601L, 652607L, 652609L, 652621L, 652627L,
-652651L, 652657L, 652667L, 652699L, 652723L, 652727L, 652733L, 652739L, 652741L,
-652747L, 652753L, 652759L, 652787L, 652811L, 652831L, 652837L, 652849L, 652853L,
-652871L, 652903L, 652909L, 652913L, 652921L, 652931L, 652933L, 652937L, 652943L,
-652957L, 652969L, 652991L, 652997L, 652999L, 653033L, 653057L, 653083L, 653111L,
-653113L, 653117L, 653143L, 653153L, 653197L, 653203L, 653207L, 653209L, 653243L,
-653267L, 653273L, 653281L, 653311L, 653321L, 653339L, 653357L, 653363L, 653431L,
-653461L, 653473L, 653491L, 653501L, 653503L, 653507L, 653519L, 653537L, 653539L,
-653561L, 653563L, 653579L, 653593L, 653617L, 653621L, 653623L, 653641L, 653647L,
-653651L, 653659L, 653687L, 653693L, 653707L, 653711L, 653713L, 653743L, 653749L,
-653761L, 653777L, 653789L, 653797L, 653801L, 653819L, 653831L, 653879L, 653881L,
-653893L, 653899L, 653903L, 653927L, 653929L, 653941L, 653951L, 653963L, 653969L,
-653977L, 653993L, 654001L, 654011L, 654019L, 654023L, 654029L, 654047L, 654053L,
-654067L, 654089L, 654107L, 654127L, 654149L, 654161L, 654163L, 654167L, 654169L,
-654187L, 654191L, 654209L, 654221L, 654223L, 654229L, 654233L, 654257L, 654293L,
-654301L, 654307L, 654323L, 654343L, 654349L, 654371L, 654397L, 654413L, 654421L,
-654427L, 654439L, 654491L, 654499L, 654509L, 654527L, 654529L, 654539L, 654541L,
-654553L, 654571L, 654587L, 654593L, 654601L, 654611L, 654613L, 654623L, 654629L,
-654671L, 654679L, 654697L, 654701L, 654727L, 654739L, 654743L, 654749L, 654767L,
-654779L, 654781L, 654799L, 654803L, 654817L, 654821L, 654827L, 654839L, 654853L,
-654877L, 654889L, 654917L, 654923L, 654931L, 654943L, 654967L, 654991L, 655001L,
-655003L, 655013L, 655021L, 655033L, 655037L, 655043L, 655069L, 655087L, 655103L,
-655111L, 655121L, 655157L, 655181L, 655211L, 655219L, 655223L, 655229L, 655241L,
-655243L, 655261L, 655267L, 655273L, 655283L, 655289L, 655301L, 655331L, 655337L,
-655351L, 655357L, 655373L, 655379L, 655387L, 655399L, 655439L, 655453L, 655471L,
-655489L, 655507L, 655511L, 655517L, 655531L, 655541L, 655547L, 655559L, 655561L,
-655579L, 655583L, 655597L, 655601L, 655637L, 655643L, 655649L, 655651L, 655657L,
-655687L, 655693L, 655717L, 655723L, 655727L, 655757L, 655807L, 655847L, 655849L,
-655859L, 655883L, 655901L, 655909L, 655913L, 655927L, 655943L, 655961L, 655987L,
-656023L, 656039L, 656063L, 656077L, 656113L, 656119L, 656129L, 656141L, 656147L,
-656153L, 656171L, 656221L, 656237L, 656263L, 656267L, 656273L, 656291L, 656297L,
-656303L, 656311L, 656321L, 656323L, 656329L, 656333L, 656347L, 656371L, 656377L,
-656389L, 656407L, 656423L, 656429L, 656459L, 656471L, 656479L, 656483L, 656519L,
-656527L, 656561L, 656587L, 656597L, 656599L, 656603L, 656609L, 656651L, 656657L,
-656671L, 656681L, 656683L, 656687L, 656701L, 656707L, 656737L, 656741L, 656749L,
-656753L, 656771L, 656783L, 656791L, 656809L, 656819L, 656833L, 656839L, 656891L,
-656917L, 656923L, 656939L, 656951L, 656959L, 656977L, 656989L, 656993L, 657017L,
-657029L, 657047L, 657049L, 657061L, 657071L, 657079L, 657089L, 657091L, 657113L,
-657121L, 657127L, 657131L, 657187L, 657193L, 657197L, 657233L, 657257L, 657269L,
-657281L, 657289L, 657299L, 657311L, 657313L, 657323L, 657347L, 657361L, 657383L,
-657403L, 657413L, 657431L, 657439L, 657451L, 657469L, 657473L, 657491L, 657493L,
-657497L, 657499L, 657523L, 657529L, 657539L, 657557L, 657581L, 657583L, 657589L,
-657607L, 657617L, 657649L, 657653L, 657659L, 657661L, 657703L, 657707L, 657719L,
-657743L, 657779L, 657793L, 657809L, 657827L, 657841L, 657863L, 657893L, 657911L,
-657929L, 657931L, 657947L, 657959L, 657973L, 657983L, 658001L, 658043L, 658051L,
-658057L, 658069L, 658079L, 658111L, 658117L, 658123L, 658127L, 658139L, 658153L,
-658159L, 658169L, 658187L, 658199L, 658211L, 658219L, 658247L, 658253L, 658261L,
-658277L, 658279L, 658303L, 658309L, 658319L, 658321L, 658327L, 658349L, 658351L,
-658367L, 658379L, 658391L, 658403L, 658417L, 658433L, 658447L, 658453L, 658477L,
-658487L, 658507L, 658547L, 658549L, 658573L, 658579L, 658589L, 658591L, 658601L,
-658607L, 658613L, 658633L, 658639L, 658643L, 658649L, 658663L, 658681L, 658703L,
-658751L, 658753L, 658783L, 658807L, 658817L, 658831L, 658837L, 658841L, 658871L,
-658873L, 658883L, 658897L, 658907L, 658913L, 658919L, 658943L, 658961L, 658963L,
-658969L, 658979L, 658991L, 658997L, 659011L, 659023L, 659047L, 659059L, 659063L,
-659069L, 659077L, 659101L, 659137L, 659159L, 659171L, 659173L, 659177L, 659189L,
-659221L, 659231L, 659237L, 659251L, 659279L, 659299L, 659317L, 659327L, 659333L,
-659353L, 659371L, 659419L, 659423L, 659437L, 659453L, 659467L, 659473L, 659497L,
-659501L, 659513L, 659521L, 659531L, 659539L, 659563L, 659569L, 659591L, 659597L,
-659609L, 659611L, 659621L, 659629L, 659639L, 659653L, 659657L, 659669L, 659671L,
-659689L, 659693L, 659713L, 659723L, 659741L, 659759L, 659761L, 659783L, 659819L,
-659831L, 659843L, 659849L, 659863L, 659873L, 659881L, 659899L, 659917L, 659941L,
-659947L, 659951L, 659963L, 659983L, 659999L, 660001L, 660013L, 660029L, 660047L,
-660053L, 660061L, 660067L, 660071L, 660073L, 660097L, 660103L, 660119L, 660131L,
-660137L, 660157L, 660167L, 660181L, 660197L, 660199L, 660217L, 660227L, 660241L,
-660251L, 660271L, 660277L, 660281L, 660299L, 660329L, 660337L, 660347L, 660349L,
-660367L, 660377L, 660379L, 660391L, 660403L, 660409L, 660449L, 660493L, 660503L,
-660509L, 660521L, 660529L, 660547L, 660557L, 660559L, 660563L, 660589L, 660593L,
-660599L, 660601L, 660607L, 660617L, 660619L, 660643L, 660659L, 660661L, 660683L,
-660719L, 660727L, 660731L, 660733L, 660757L, 660769L, 660787L, 660791L, 660799L,
-660809L, 660811L, 660817L, 660833L, 660851L, 660853L, 660887L, 660893L, 660899L,
-660901L, 660917L, 660923L, 660941L, 660949L, 660973L, 660983L, 661009L, 661019L,
-661027L, 661049L, 661061L, 661091L, 661093L, 661097L, 661099L, 661103L, 661109L,
-661117L, 661121L, 661139L, 661183L, 661187L, 661189L, 661201L, 661217L, 661231L,
-661237L, 661253L, 661259L, 661267L, 661321L, 661327L, 661343L, 661361L, 661373L,
-661393L, 661417L, 661421L, 661439L, 661459L, 661477L, 661481L, 661483L, 661513L,
-661517L, 661541L, 661547L, 661553L, 661603L, 661607L, 661613L, 661621L, 661663L,
-661673L, 661679L, 661697L, 661721L, 661741L, 661769L, 661777L, 661823L, 661849L,
-661873L, 661877L, 661879L, 661883L, 661889L, 661897L, 661909L, 661931L, 661939L,
-661949L, 661951L, 661961L, 661987L, 661993L, 662003L, 662021L, 662029L, 662047L,
-662059L, 662063L, 662083L, 662107L, 662111L, 662141L, 662143L, 662149L, 662177L,
-662203L, 662227L, 662231L, 662251L, 662261L, 662267L, 662281L, 662287L, 662309L,
-662323L, 662327L, 662339L, 662351L, 662353L, 662357L, 662369L, 662401L, 662407L,
-662443L, 662449L, 662477L, 662483L, 662491L, 662513L, 662527L, 662531L, 662537L,
-662539L, 662551L, 662567L, 662591L, 662617L, 662639L, 662647L, 662657L, 662671L,
-662681L, 662689L, 662693L, 662713L, 662719L, 662743L, 662771L, 662773L, 662789L,
-662797L, 662819L, 662833L, 662839L, 662843L, 662867L, 662897L, 662899L, 662917L,
-662939L, 662941L, 662947L, 662951L, 662953L, 662957L, 662999L, 663001L, 663007L,
-663031L, 663037L, 663049L, 663053L, 663071L, 663097L, 663127L, 663149L, 663161L,
-663163L, 663167L, 663191L, 663203L, 663209L, 663239L, 663241L, 663263L, 663269L,
-663281L, 663283L, 663301L, 663319L, 663331L, 663349L, 663359L, 663371L, 663407L,
-663409L, 663437L, 663463L, 663517L, 663529L, 663539L, 663541L, 663547L, 663557L,
-663563L, 663569L, 663571L, 663581L, 663583L, 663587L, 663589L, 663599L, 663601L,
-663631L, 663653L, 663659L, 663661L, 663683L, 663709L, 663713L, 663737L, 663763L,
-663787L, 663797L, 663821L, 663823L, 663827L, 663853L, 663857L, 663869L, 663881L,
-663893L, 663907L, 663937L, 663959L, 663961L, 663967L, 663973L, 663977L, 663979L,
-663983L, 663991L, 663997L, 664009L, 664019L, 664043L, 664061L, 664067L, 664091L,
-664099L, 664109L, 664117L, 664121L, 664123L, 664133L, 664141L, 664151L, 664177L,
-664193L, 664199L, 664211L, 664243L, 664253L, 664271L, 664273L, 664289L, 664319L,
-664331L, 664357L, 664369L, 664379L, 664381L, 664403L, 664421L, 664427L, 664441L,
-664459L, 664471L, 664507L, 664511L, 664529L, 664537L, 664549L, 664561L, 664571L,
-664579L, 664583L, 664589L, 664597L, 664603L, 664613L, 664619L, 664621L, 664633L,
-664661L, 664663L, 664667L, 664669L, 664679L, 664687L, 664691L, 664693L, 664711L,
-664739L, 664757L, 664771L, 664777L, 664789L, 664793L, 664799L, 664843L, 664847L,
-664849L, 664879L, 664891L, 664933L, 664949L, 664967L, 664973L, 664997L, 665011L,
-665017L, 665029L, 665039L, 665047L, 665051L, 665053L, 665069L, 665089L, 665111L,
-665113L, 665117L, 665123L, 665131L, 665141L, 665153L, 665177L, 665179L, 665201L,
-665207L, 665213L, 665221L, 665233L, 665239L, 665251L, 665267L, 665279L, 665293L,
-665299L, 665303L, 665311L, 665351L, 665359L, 665369L, 665381L, 665387L, 665419L,
-665429L, 665447L, 665479L, 665501L, 665503L, 665507L, 665527L, 665549L, 665557L,
-665563L, 665569L, 665573L, 665591L, 665603L, 665617L, 665629L, 665633L, 665659L,
-665677L, 665713L, 665719L, 665723L, 665747L, 665761L, 665773L, 665783L, 665789L,
-665801L, 665803L, 665813L, 665843L, 665857L, 665897L, 665921L, 665923L, 665947L,
-665953L, 665981L, 665983L, 665993L, 666013L, 666019L, 666023L, 666031L, 666041L,
-666067L, 666073L, 666079L, 666089L, 666091L, 666109L, 666119L, 666139L, 666143L,
-666167L, 666173L, 666187L, 666191L, 666203L, 666229L, 666233L, 666269L, 666277L,
-666301L, 666329L, 666353L, 666403L, 666427L, 666431L, 666433L, 666437L, 666439L,
-666461L, 666467L, 666493L, 666511L, 666527L, 666529L, 666541L, 666557L, 666559L,
-666599L, 666607L, 666637L, 666643L, 666647L, 666649L, 666667L, 666671L, 666683L,
-666697L, 666707L, 666727L, 666733L, 666737L, 666749L, 666751L, 666769L, 666773L,
-666811L, 666821L, 666823L, 666829L, 666857L, 666871L, 666889L, 666901L, 666929L,
-666937L, 666959L, 666979L, 666983L, 666989L, 667013L, 667019L, 667021L, 667081L,
-667091L, 667103L, 667123L, 667127L, 667129L, 667141L, 667171L, 667181L, 667211L,
-667229L, 667241L, 667243L, 667273L, 667283L, 667309L, 667321L, 667333L, 667351L,
-667361L, 667363L, 667367L, 667379L, 667417L, 667421L, 667423L, 667427L, 667441L,
-667463L, 667477L, 667487L, 667501L, 667507L, 667519L, 667531L, 667547L, 667549L,
-667553L, 667559L, 667561L, 667577L, 667631L, 667643L, 667649L, 667657L, 667673L,
-667687L, 667691L, 667697L, 667699L, 667727L, 667741L, 667753L, 667769L, 667781L,
-667801L, 667817L, 667819L, 667829L, 667837L, 667859L, 667861L, 667867L, 667883L,
-667903L, 667921L, 667949L, 667963L, 667987L, 667991L, 667999L, 668009L, 668029L,
-668033L, 668047L, 668051L, 668069L, 668089L, 668093L, 668111L, 668141L, 668153L,
-668159L, 668179L, 668201L, 668203L, 668209L, 668221L, 668243L, 668273L, 668303L,
-668347L, 668407L, 668417L, 668471L, 668509L, 668513L, 668527L, 668531L, 668533L,
-668539L, 668543L, 668567L, 668579L, 668581L, 668599L, 668609L, 668611L, 668617L,
-668623L, 668671L, 668677L, 668687L, 668699L, 668713L, 668719L, 668737L, 668741L,
-668747L, 668761L, 668791L, 668803L, 668813L, 668821L, 668851L, 668867L, 668869L,
-668873L, 668879L, 668903L, 668929L, 668939L, 668947L, 668959L, 668963L, 668989L,
-668999L, 669023L, 669029L, 669049L, 669077L, 669089L, 669091L, 669107L, 669113L,
-669121L, 669127L, 669133L, 669167L, 669173L, 669181L, 669241L, 669247L, 669271L,
-669283L, 669287L, 669289L, 669301L, 669311L, 669329L, 669359L, 669371L, 669377L,
-669379L, 669391L, 669401L, 669413L, 669419L, 669433L, 669437L, 669451L, 669463L,
-669479L, 669481L, 669527L, 669551L, 669577L, 669607L, 669611L, 669637L, 669649L,
-669659L, 669661L, 669667L, 669673L, 669677L, 669679L, 669689L, 669701L, 669707L,
-669733L, 669763L, 669787L, 669791L, 669839L, 669847L, 669853L, 669857L, 669859L,
-669863L, 669869L, 669887L, 669901L, 669913L, 669923L, 669931L, 669937L, 669943L,
-669947L, 669971L, 669989L, 670001L, 670031L, 670037L, 670039L, 670049L, 670051L,
-670097L, 670099L, 670129L, 670139L, 670147L, 670177L, 670193L, 670199L, 670211L,
-670217L, 670223L, 670231L, 670237L, 670249L, 670261L, 670279L, 670297L, 670303L,
-670321L, 670333L, 670343L, 670349L, 670363L, 670379L, 670399L, 670409L, 670447L,
-670457L, 670471L, 670487L, 670489L, 670493L, 670507L, 670511L, 670517L, 670541L,
-670543L, 670559L, 670577L, 670583L, 670597L, 670613L, 670619L, 670627L, 670639L,
-670669L, 670673L, 670693L, 670711L, 670727L, 670729L, 670739L, 670763L, 670777L,
-670781L, 670811L, 670823L, 670849L, 670853L, 670867L, 670877L, 670897L, 670903L,
-670919L, 670931L, 670951L, 670963L, 670987L, 670991L, 671003L, 671017L, 671029L,
-671039L, 671059L, 671063L, 671081L, 671087L, 671093L, 671123L, 671131L, 671141L,
-671159L, 671161L, 671189L, 671201L, 671219L, 671233L, 671249L, 671257L, 671261L,
-671269L, 671287L, 671299L, 671303L, 671323L, 671339L, 671353L, 671357L, 671369L,
-671383L, 671401L, 671417L, 671431L, 671443L, 671467L, 671471L, 671477L, 671501L,
-671519L, 671533L, 671537L, 671557L, 671581L, 671591L, 671603L, 671609L, 671633L,
-671647L, 671651L, 671681L, 671701L, 671717L, 671729L, 671743L, 671753L, 671777L,
-671779L, 671791L, 671831L, 671837L, 671851L, 671887L, 671893L, 671903L, 671911L,
-671917L, 671921L, 671933L, 671939L, 671941L, 671947L, 671969L, 671971L, 671981L,
-671999L, 672019L, 672029L, 672041L, 672043L, 672059L, 672073L, 672079L, 672097L,
-672103L, 672107L, 672127L, 672131L, 672137L, 672143L, 672151L, 672167L, 672169L,
-672181L, 672193L, 672209L, 672223L, 672227L, 672229L, 672251L, 672271L, 672283L,
-672289L, 672293L, 672311L, 672317L, 672323L, 672341L, 672349L, 672377L, 672379L,
-672439L, 672443L, 672473L, 672493L, 672499L, 672521L, 672557L, 672577L, 672587L,
-672593L, 672629L, 672641L, 672643L, 672653L, 672667L, 672703L, 672743L, 672757L,
-672767L, 672779L, 672781L, 672787L, 672799L, 672803L, 672811L, 672817L, 672823L,
-672827L, 672863L, 672869L, 672871L, 672883L, 672901L, 672913L, 672937L, 672943L,
-672949L, 672953L, 672967L, 672977L, 672983L, 673019L, 673039L, 673063L, 673069L,
-673073L, 673091L, 673093L, 673109L, 673111L, 673117L, 673121L, 673129L, 673157L,
-673193L, 673199L, 673201L, 673207L, 673223L, 673241L, 673247L, 673271L, 673273L,
-673291L, 673297L, 673313L, 673327L, 673339L, 673349L, 673381L, 673391L, 673397L,
-673399L, 673403L, 673411L, 673427L, 673429L, 673441L, 673447L, 673451L, 673457L,
-673459L, 673469L, 673487L, 673499L, 673513L, 673529L, 673549L, 673553L, 673567L,
-673573L, 673579L, 673609L, 673613L, 673619L, 673637L, 673639L, 673643L, 673649L,
-673667L, 673669L, 673747L, 673769L, 673781L, 673787L, 673793L, 673801L, 673811L,
-673817L, 673837L, 673879L, 673891L, 673921L, 673943L, 673951L, 673961L, 673979L,
-673991L, 674017L, 674057L, 674059L, 674071L, 674083L, 674099L, 674117L, 674123L,
-674131L, 674159L, 674161L, 674173L, 674183L, 674189L, 674227L, 674231L, 674239L,
-674249L, 674263L, 674269L, 674273L, 674299L, 674321L, 674347L, 674357L, 674363L,
-674371L, 674393L, 674419L, 674431L, 674449L, 674461L, 674483L, 674501L, 674533L,
-674537L, 674551L, 674563L, 674603L, 674647L, 674669L, 674677L, 674683L, 674693L,
-674699L, 674701L, 674711L, 674717L, 674719L, 674731L, 674741L, 674749L, 674759L,
-674761L, 674767L, 674771L, 674789L, 674813L, 674827L, 674831L, 674833L, 674837L,
-674851L, 674857L, 674867L, 674879L, 674903L, 674929L, 674941L, 674953L, 674957L,
-674977L, 674987L, 675029L, 675067L, 675071L, 675079L, 675083L, 675097L, 675109L,
-675113L, 675131L, 675133L, 675151L, 675161L, 675163L, 675173L, 675179L, 675187L,
-675197L, 675221L, 675239L, 675247L, 675251L, 675253L, 675263L, 675271L, 675299L,
-675313L, 675319L, 675341L, 675347L, 675391L, 675407L, 675413L, 675419L, 675449L,
-675457L, 675463L, 675481L, 675511L, 675539L, 675541L, 675551L, 675553L, 675559L,
-675569L, 675581L, 675593L, 675601L, 675607L, 675611L, 675617L, 675629L, 675643L,
-675713L, 675739L, 675743L, 675751L, 675781L, 675797L, 675817L, 675823L, 675827L,
-675839L, 675841L, 675859L, 675863L, 675877L, 675881L, 675889L, 675923L, 675929L,
-675931L, 675959L, 675973L, 675977L, 675979L, 676007L, 676009L, 676031L, 676037L,
-676043L, 676051L, 676057L, 676061L, 676069L, 676099L, 676103L, 676111L, 676129L,
-676147L, 676171L, 676211L, 676217L, 676219L, 676241L, 676253L, 676259L, 676279L,
-676289L, 676297L, 676337L, 676339L, 676349L, 676363L, 676373L, 676387L, 676391L,
-676409L, 676411L, 676421L, 676427L, 676463L, 676469L, 676493L, 676523L, 676573L,
-676589L, 676597L, 676601L, 676649L, 676661L, 676679L, 676703L, 676717L, 676721L,
-676727L, 676733L, 676747L, 676751L, 676763L, 676771L, 676807L, 676829L, 676859L,
-676861L, 676883L, 676891L, 676903L, 676909L, 676919L, 676927L, 676931L, 676937L,
-676943L, 676961L, 676967L, 676979L, 676981L, 676987L, 676993L, 677011L, 677021L,
-677029L, 677041L, 677057L, 677077L, 677081L, 677107L, 677111L, 677113L, 677119L,
-677147L, 677167L, 677177L, 677213L, 677227L, 677231L, 677233L, 677239L, 677309L,
-677311L, 677321L, 677323L, 677333L, 677357L, 677371L, 677387L, 677423L, 677441L,
-677447L, 677459L, 677461L, 677471L, 677473L, 677531L, 677533L, 677539L, 677543L,
-677561L, 677563L, 677587L, 677627L, 677639L, 677647L, 677657L, 677681L, 677683L,
-677687L, 677717L, 677737L, 677767L, 677779L, 677783L, 677791L, 677813L, 677827L,
-677857L, 677891L, 677927L, 677947L, 677953L, 677959L, 677983L, 678023L, 678037L,
-678047L, 678061L, 678077L, 678101L, 678103L, 678133L, 678157L, 678169L, 678179L,
-678191L, 678199L, 678203L, 678211L, 678217L, 678221L, 678229L, 678253L, 678289L,
-678299L, 678329L, 678341L, 678343L, 678367L, 678371L, 678383L, 678401L, 678407L,
-678409L, 678413L, 678421L, 678437L, 678451L, 678463L, 678479L, 678481L, 678493L,
-678499L, 678533L, 678541L, 678553L, 678563L, 678577L, 678581L, 678593L, 678599L,
-678607L, 678611L, 678631L, 678637L, 678641L, 678647L, 678649L, 678653L, 678659L,
-678719L, 678721L, 678731L, 678739L, 678749L, 678757L, 678761L, 678763L, 678767L,
-678773L, 678779L, 678809L, 678823L, 678829L, 678833L, 678859L, 678871L, 678883L,
-678901L, 678907L, 678941L, 678943L, 678949L, 678959L, 678971L, 678989L, 679033L,
-679037L, 679039L, 679051L, 679067L, 679087L, 679111L, 679123L, 679127L, 679153L,
-679157L, 679169L, 679171L, 679183L, 679207L, 679219L, 679223L, 679229L, 679249L,
-679277L, 679279L, 679297L, 679309L, 679319L, 679333L, 679361L, 679363L, 679369L,
-679373L, 679381L, 679403L, 679409L, 679417L, 679423L, 679433L, 679451L, 679463L,
-679487L, 679501L, 679517L, 679519L, 679531L, 679537L, 679561L, 679597L, 679603L,
-679607L, 679633L, 679639L, 679669L, 679681L, 679691L, 679699L, 679709L, 679733L,
-679741L, 679747L, 679751L, 679753L, 679781L, 679793L, 679807L, 679823L, 679829L,
-679837L, 679843L, 679859L, 679867L, 679879L, 679883L, 679891L, 679897L, 679907L,
-679909L, 679919L, 679933L, 679951L, 679957L, 679961L, 679969L, 679981L, 679993L,
-679999L, 680003L, 680027L, 680039L, 680059L, 680077L, 680081L, 680083L, 680107L,
-680123L, 680129L, 680159L, 680161L, 680177L, 680189L, 680203L, 680209L, 680213L,
-680237L, 680249L, 680263L, 680291L, 680293L, 680297L, 680299L, 680321L, 680327L,
-680341L, 680347L, 680353L, 680377L, 680387L, 680399L, 680401L, 680411L, 680417L,
-680431L, 680441L, 680443L, 680453L, 680489L, 680503L, 680507L, 680509L, 680531L,
-680539L, 680567L, 680569L, 680587L, 680597L, 680611L, 680623L, 680633L, 680651L,
-680657L, 680681L, 680707L, 680749L, 680759L, 680767L, 680783L, 680803L, 680809L,
-680831L, 680857L, 680861L, 680873L, 680879L, 680881L, 680917L, 680929L, 680959L,
-680971L, 680987L, 680989L, 680993L, 681001L, 681011L, 681019L, 681041L, 681047L,
-681049L, 681061L, 681067L, 681089L, 681091L, 681113L, 681127L, 681137L, 681151L,
-681167L, 681179L, 681221L, 681229L, 681251L, 681253L, 681257L, 681259L, 681271L,
-681293L, 681311L, 681337L, 681341L, 681361L, 681367L, 681371L, 681403L, 681407L,
-681409L, 681419L, 681427L, 681449L, 681451L, 681481L, 681487L, 681493L, 681497L,
-681521L, 681523L, 681539L, 681557L, 681563L, 681589L, 681607L, 681613L, 681623L,
-681631L, 681647L, 681673L, 681677L, 681689L, 681719L, 681727L, 681731L, 681763L,
-681773L, 681781L, 681787L, 681809L, 681823L, 681833L, 681839L, 681841L, 681883L,
-681899L, 681913L, 681931L, 681943L, 681949L, 681971L, 681977L, 681979L, 681983L,
-681997L, 682001L, 682009L, 682037L, 682049L, 682063L, 682069L, 682079L, 682141L,
-682147L, 682151L, 682153L, 682183L, 682207L, 682219L, 682229L, 682237L, 682247L,
-682259L, 682277L, 682289L, 682291L, 682303L, 682307L, 682321L, 682327L, 682333L,
-682337L, 682361L, 682373L, 682411L, 682417L, 682421L, 682427L, 682439L, 682447L,
-682463L, 682471L, 682483L, 682489L, 682511L, 682519L, 682531L, 682547L, 682597L,
-682607L, 682637L, 682657L, 682673L, 682679L, 682697L, 682699L, 682723L, 682729L,
-682733L, 682739L, 682751L, 682763L, 682777L, 682789L, 682811L, 682819L, 682901L,
-682933L, 682943L, 682951L, 682967L, 683003L, 683021L, 683041L, 683047L, 683071L,
-683083L, 683087L, 683119L, 683129L, 683143L, 683149L, 683159L, 683201L, 683231L,
-683251L, 683257L, 683273L, 683299L, 683303L, 683317L, 683323L, 683341L, 683351L,
-683357L, 683377L, 683381L, 683401L, 683407L, 683437L, 683447L, 683453L, 683461L,
-683471L, 683477L, 683479L, 683483L, 683489L, 683503L, 683513L, 683567L, 683591L,
-683597L, 683603L, 683651L, 683653L, 683681L, 683687L, 683693L, 683699L, 683701L,
-683713L, 683719L, 683731L, 683737L, 683747L, 683759L, 683777L, 683783L, 683789L,
-683807L, 683819L, 683821L, 683831L, 683833L, 683843L, 683857L, 683861L, 683863L,
-683873L, 683887L, 683899L, 683909L, 683911L, 683923L, 683933L, 683939L, 683957L,
-683983L, 684007L, 684017L, 684037L, 684053L, 684091L, 684109L, 684113L, 684119L,
-684121L, 684127L, 684157L, 684163L, 684191L, 684217L, 684221L, 684239L, 684269L,
-684287L, 684289L, 684293L, 684311L, 684329L, 684337L, 684347L, 684349L, 684373L,
-684379L, 684407L, 684419L, 684427L, 684433L, 684443L, 684451L, 684469L, 684473L,
-684493L, 684527L, 684547L, 684557L, 684559L, 684569L, 684581L, 684587L, 684599L,
-684617L, 684637L, 684643L, 684647L, 684683L, 684713L, 684727L, 684731L, 684751L,
-684757L, 684767L, 684769L, 684773L, 684791L, 684793L, 684799L, 684809L, 684829L,
-684841L, 684857L, 684869L, 684889L, 684923L, 684949L, 684961L, 684973L, 684977L,
-684989L, 685001L, 685019L, 685031L, 685039L, 685051L, 685057L, 685063L, 685073L,
-685081L, 685093L, 685099L, 685103L, 685109L, 685123L, 685141L, 685169L, 685177L,
-685199L, 685231L, 685247L, 685249L, 685271L, 685297L, 685301L, 685319L, 685337L,
-685339L, 685361L, 685367L, 685369L, 685381L, 685393L, 685417L, 685427L, 685429L,
-685453L, 685459L, 685471L, 685493L, 685511L, 685513L, 685519L, 685537L, 685541L,
-685547L, 685591L, 685609L, 685613L, 685621L, 685631L, 685637L, 685649L, 685669L,
-685679L, 685697L, 685717L, 685723L, 685733L, 685739L, 685747L, 685753L, 685759L,
-685781L, 685793L, 685819L, 685849L, 685859L, 685907L, 685939L, 685963L, 685969L,
-685973L, 685987L, 685991L, 686003L, 686009L, 686011L, 686027L, 686029L, 686039L,
-686041L, 686051L, 686057L, 686087L, 686089L, 686099L, 686117L, 686131L, 686141L,
-686143L, 686149L, 686173L, 686177L, 686197L, 686201L, 686209L, 686267L, 686269L,
-686293L, 686317L, 686321L, 686333L, 686339L, 686353L, 686359L, 686363L, 686417L,
-686423L, 686437L, 686449L, 686453L, 686473L, 686479L, 686503L, 686513L, 686519L,
-686551L, 686563L, 686593L, 686611L, 686639L, 686669L, 686671L, 686687L, 686723L,
-686729L, 686731L, 686737L, 686761L, 686773L, 686789L, 686797L, 686801L, 686837L,
-686843L, 686863L, 686879L, 686891L, 686893L, 686897L, 686911L, 686947L, 686963L,
-686969L, 686971L, 686977L, 686989L, 686993L, 687007L, 687013L, 687017L, 687019L,
-687023L, 687031L, 687041L, 687061L, 687073L, 687083L, 687101L, 687107L, 687109L,
-687121L, 687131L, 687139L, 687151L, 687161L, 687163L, 687179L, 687223L, 687233L,
-687277L, 687289L, 687299L, 687307L, 687311L, 687317L, 687331L, 687341L, 687343L,
-687359L, 687383L, 687389L, 687397L, 687403L, 687413L, 687431L, 687433L, 687437L,
-687443L, 687457L, 687461L, 687473L, 687481L, 687499L, 687517L, 687521L, 687523L,
-687541L, 687551L, 687559L, 687581L, 687593L, 687623L, 687637L, 687641L, 687647L,
-687679L, 687683L, 687691L, 687707L, 687721L, 687737L, 687749L, 687767L, 687773L,
-687779L, 687787L, 687809L, 687823L, 687829L, 687839L, 687847L, 687893L, 687901L,
-687917L, 687923L, 687931L, 687949L, 687961L, 687977L, 688003L, 688013L, 688027L,
-688031L, 688063L, 688067L, 688073L, 688087L, 688097L, 688111L, 688133L, 688139L,
-688147L, 688159L, 688187L, 688201L, 688217L, 688223L, 688249L, 688253L, 688277L,
-688297L, 688309L, 688333L, 688339L, 688357L, 688379L, 688393L, 688397L, 688403L,
-688411L, 688423L, 688433L, 688447L, 688451L, 688453L, 688477L, 688511L, 688531L,
-688543L, 688561L, 688573L, 688591L, 688621L, 688627L, 688631L, 688637L, 688657L,
-688661L, 688669L, 688679L, 688697L, 688717L, 688729L, 688733L, 688741L, 688747L,
-688757L, 688763L, 688777L, 688783L, 688799L, 688813L, 688861L, 688867L, 688871L,
-688889L, 688907L, 688939L, 688951L, 688957L, 688969L, 688979L, 688999L, 689021L,
-689033L, 689041L, 689063L, 689071L, 689077L, 689081L, 689089L, 689093L, 689107L,
-689113L, 689131L, 689141L, 689167L, 689201L, 689219L, 689233L, 689237L, 689257L,
-689261L, 689267L, 689279L, 689291L, 689309L, 689317L, 689321L, 689341L, 689357L,
-689369L, 689383L, 689389L, 689393L, 689411L, 689431L, 689441L, 689459L, 689461L,
-689467L, 689509L, 689551L, 689561L, 689581L, 689587L, 689597L, 689599L, 689603L,
-689621L, 689629L, 689641L, 689693L, 689699L, 689713L, 689723L, 689761L, 689771L,
-689779L, 689789L, 689797L, 689803L, 689807L, 689827L, 689831L, 689851L, 689867L,
-689869L, 689873L, 689879L, 689891L, 689893L, 689903L, 689917L, 689921L, 689929L,
-689951L, 689957L, 689959L, 689963L, 689981L, 689987L, 690037L, 690059L, 690073L,
-690089L, 690103L, 690119L, 690127L, 690139L, 690143L, 690163L, 690187L, 690233L,
-690259L, 690269L, 690271L, 690281L, 690293L, 690323L, 690341L, 690367L, 690377L,
-690397L, 690407L, 690419L, 690427L, 690433L, 690439L, 690449L, 690467L, 690491L,
-690493L, 690509L, 690511L, 690533L, 690541L, 690553L, 690583L, 690589L, 690607L,
-690611L, 690629L, 690661L, 690673L, 690689L, 690719L, 690721L, 690757L, 690787L,
-690793L, 690817L, 690839L, 690841L, 690869L, 690871L, 690887L, 690889L, 690919L,
-690929L, 690953L, 690997L, 691001L, 691037L, 691051L, 691063L, 691079L, 691109L,
-691111L, 691121L, 691129L, 691147L, 691151L, 691153L, 691181L, 691183L, 691189L,
-691193L, 691199L, 691231L, 691241L, 691267L, 691289L, 691297L, 691309L, 691333L,
-691337L, 691343L, 691349L, 691363L, 691381L, 691399L, 691409L, 691433L, 691451L,
-691463L, 691489L, 691499L, 691531L, 691553L, 691573L, 691583L, 691589L, 691591L,
-691631L, 691637L, 691651L, 691661L, 691681L, 691687L, 691693L, 691697L, 691709L,
-691721L, 691723L, 691727L, 691729L, 691739L, 691759L, 691763L, 691787L, 691799L,
-691813L, 691829L, 691837L, 691841L, 691843L, 691871L, 691877L, 691891L, 691897L,
-691903L, 691907L, 691919L, 691921L, 691931L, 691949L, 691973L, 691979L, 691991L,
-691997L, 692009L, 692017L, 692051L, 692059L, 692063L, 692071L, 692089L, 692099L,
-692117L, 692141L, 692147L, 692149L, 692161L, 692191L, 692221L, 692239L, 692249L,
-692269L, 692273L, 692281L, 692287L, 692297L, 692299L, 692309L, 692327L, 692333L,
-692347L, 692353L, 692371L, 692387L, 692389L, 692399L, 692401L, 692407L, 692413L,
-692423L, 692431L, 692441L, 692453L, 692459L, 692467L, 692513L, 692521L, 692537L,
-692539L, 692543L, 692567L, 692581L, 692591L, 692621L, 692641L, 692647L, 692651L,
-692663L, 692689L, 692707L, 692711L, 692717L, 692729L, 692743L, 692753L, 692761L,
-692771L, 692779L, 692789L, 692821L, 692851L, 692863L, 692893L, 692917L, 692927L,
-692929L, 692933L, 692957L, 692963L, 692969L, 692983L, 693019L, 693037L, 693041L,
-693061L, 693079L, 693089L, 693097L, 693103L, 693127L, 693137L, 693149L, 693157L,
-693167L, 693169L, 693179L, 693223L, 693257L, 693283L, 693317L, 693323L, 693337L,
-693353L, 693359L, 693373L, 693397L, 693401L, 693403L, 693409L, 693421L, 693431L,
-693437L, 693487L, 693493L, 693503L, 693523L, 693527L, 693529L, 693533L, 693569L,
-693571L, 693601L, 693607L, 693619L, 693629L, 693659L, 693661L, 693677L, 693683L,
-693689L, 693691L, 693697L, 693701L, 693727L, 693731L, 693733L, 693739L, 693743L,
-693757L, 693779L, 693793L, 693799L, 693809L, 693827L, 693829L, 693851L, 693859L,
-693871L, 693877L, 693881L, 693943L, 693961L, 693967L, 693989L, 694019L, 694033L,
-694039L, 694061L, 694069L, 694079L, 694081L, 694087L, 694091L, 694123L, 694189L,
-694193L, 694201L, 694207L, 694223L, 694259L, 694261L, 694271L, 694273L, 694277L,
-694313L, 694319L, 694327L, 694333L, 694339L, 694349L, 694357L, 694361L, 694367L,
-694373L, 694381L, 694387L, 694391L, 694409L, 694427L, 694457L, 694471L, 694481L,
-694483L, 694487L, 694511L, 694513L, 694523L, 694541L, 694549L, 694559L, 694567L,
-694571L, 694591L, 694597L, 694609L, 694619L, 694633L, 694649L, 694651L, 694717L,
-694721L, 694747L, 694763L, 694781L, 694783L, 694789L, 694829L, 694831L, 694867L,
-694871L, 694873L, 694879L, 694901L, 694919L, 694951L, 694957L, 694979L, 694987L,
-694997L, 694999L, 695003L, 695017L, 695021L, 695047L, 695059L, 695069L, 695081L,
-695087L, 695089L, 695099L, 695111L, 695117L, 695131L, 695141L, 695171L, 695207L,
-695239L, 695243L, 695257L, 695263L, 695269L, 695281L, 695293L, 695297L, 695309L,
-695323L, 695327L, 695329L, 695347L, 695369L, 695371L, 695377L, 695389L, 695407L,
-695411L, 695441L, 695447L, 695467L, 695477L, 695491L, 695503L, 695509L, 695561L,
-695567L, 695573L, 695581L, 695593L, 695599L, 695603L, 695621L, 695627L, 695641L,
-695659L, 695663L, 695677L, 695687L, 695689L, 695701L, 695719L, 695743L, 695749L,
-695771L, 695777L, 695791L, 695801L, 695809L, 695839L, 695843L, 695867L, 695873L,
-695879L, 695881L, 695899L, 695917L, 695927L, 695939L, 695999L, 696019L, 696053L,
-696061L, 696067L, 696077L, 696079L, 696083L, 696107L, 696109L, 696119L, 696149L,
-696181L, 696239L, 696253L, 696257L, 696263L, 696271L, 696281L, 696313L, 696317L,
-696323L, 696343L, 696349L, 696359L, 696361L, 696373L, 696379L, 696403L, 696413L,
-696427L, 696433L, 696457L, 696481L, 696491L, 696497L, 696503L, 696517L, 696523L,
-696533L, 696547L, 696569L, 696607L, 696611L, 696617L, 696623L, 696629L, 696653L,
-696659L, 696679L, 696691L, 696719L, 696721L, 696737L, 696743L, 696757L, 696763L,
-696793L, 696809L, 696811L, 696823L, 696827L, 696833L, 696851L, 696853L, 696887L,
-696889L, 696893L, 696907L, 696929L, 696937L, 696961L, 696989L, 696991L, 697009L,
-697013L, 697019L, 697033L, 697049L, 697063L, 697069L, 697079L, 697087L, 697093L,
-697111L, 697121L, 697127L, 697133L, 697141L, 697157L, 697181L, 697201L, 697211L,
-697217L, 697259L, 697261L, 697267L, 697271L, 697303L, 697327L, 697351L, 697373L,
-697379L, 697381L, 697387L, 697397L, 697399L, 697409L, 697423L, 697441L, 697447L,
-697453L, 697457L, 697481L, 697507L, 697511L, 697513L, 697519L, 697523L, 697553L,
-697579L, 697583L, 697591L, 697601L, 697603L, 697637L, 697643L, 697673L, 697681L,
-697687L, 697691L, 697693L, 697703L, 697727L, 697729L, 697733L, 697757L, 697759L,
-697787L, 697819L, 697831L, 697877L, 697891L, 697897L, 697909L, 697913L, 697937L,
-697951L, 697967L, 697973L, 697979L, 697993L, 697999L, 698017L, 698021L, 698039L,
-698051L, 698053L, 698077L, 698083L, 698111L, 698171L, 698183L, 698239L, 698249L,
-698251L, 698261L, 698263L, 698273L, 698287L, 698293L, 698297L, 698311L, 698329L,
-698339L, 698359L, 698371L, 698387L, 698393L, 698413L, 698417L, 698419L, 698437L,
-698447L, 698471L, 698483L, 698491L, 698507L, 698521L, 698527L, 698531L, 698539L,
-698543L, 698557L, 698567L, 698591L, 698641L, 698653L, 698669L, 698701L, 698713L,
-698723L, 698729L, 698773L, 698779L, 698821L, 698827L, 698849L, 698891L, 698899L,
-698903L, 698923L, 698939L, 698977L, 698983L, 699001L, 699007L, 699037L, 699053L,
-699059L, 699073L, 699077L, 699089L, 699113L, 699119L, 699133L, 699151L, 699157L,
-699169L, 699187L, 699191L, 699197L, 699211L, 699217L, 699221L, 699241L, 699253L,
-699271L, 699287L, 699289L, 699299L, 699319L, 699323L, 699343L, 699367L, 699373L,
-699379L, 699383L, 699401L, 699427L, 699437L, 699443L, 699449L, 699463L, 699469L,
-699493L, 699511L, 699521L, 699527L, 699529L, 699539L, 699541L, 699557L, 699571L,
-699581L, 699617L, 699631L, 699641L, 699649L, 699697L, 699709L, 699719L, 699733L,
-699757L, 699761L, 699767L, 699791L, 699793L, 699817L, 699823L, 699863L, 699931L,
-699943L, 699947L, 699953L, 699961L, 699967L, 700001L, 700027L, 700057L, 700067L,
-700079L, 700081L, 700087L, 700099L, 700103L, 700109L, 700127L, 700129L, 700171L,
-700199L, 700201L, 700211L, 700223L, 700229L, 700237L, 700241L, 700277L, 700279L,
-700303L, 700307L, 700319L, 700331L, 700339L, 700361L, 700363L, 700367L, 700387L,
-700391L, 700393L, 700423L, 700429L, 700433L, 700459L, 700471L, 700499L, 700523L,
-700537L, 700561L, 700571L, 700573L, 700577L, 700591L, 700597L, 700627L, 700633L,
-700639L, 700643L, 700673L, 700681L, 700703L, 700717L, 700751L, 700759L, 700781L,
-700789L, 700801L, 700811L, 700831L, 700837L, 700849L, 700871L, 700877L, 700883L,
-700897L, 700907L, 700919L, 700933L, 700937L, 700949L, 700963L, 700993L, 701009L,
-701011L, 701023L, 701033L, 701047L, 701089L, 701117L, 701147L, 701159L, 701177L,
-701179L, 701209L, 701219L, 701221L, 701227L, 701257L, 701279L, 701291L, 701299L,
-701329L, 701341L, 701357L, 701359L, 701377L, 701383L, 701399L, 701401L, 701413L,
-701417L, 701419L, 701443L, 701447L, 701453L, 701473L, 701479L, 701489L, 701497L,
-701507L, 701509L, 701527L, 701531L, 701549L, 701579L, 701581L, 701593L, 701609L,
-701611L, 701621L, 701627L, 701629L, 701653L, 701669L, 701671L, 701681L, 701699L,
-701711L, 701719L, 701731L, 701741L, 701761L, 701783L, 701791L, 701819L, 701837L,
-701863L, 701881L, 701903L, 701951L, 701957L, 701963L, 701969L, 702007L, 702011L,
-702017L, 702067L, 702077L, 702101L, 702113L, 702127L, 702131L, 702137L, 702139L,
-702173L, 702179L, 702193L, 702199L, 702203L, 702211L, 702239L, 702257L, 702269L,
-702281L, 702283L, 702311L, 702313L, 702323L, 702329L, 702337L, 702341L, 702347L,
-702349L, 702353L, 702379L, 702391L, 702407L, 702413L, 702431L, 702433L, 702439L,
-702451L, 702469L, 702497L, 702503L, 702511L, 702517L, 702523L, 702529L, 702539L,
-702551L, 702557L, 702587L, 702589L, 702599L, 702607L, 702613L, 702623L, 702671L,
-702679L, 702683L, 702701L, 702707L, 702721L, 702731L, 702733L, 702743L, 702773L,
-702787L, 702803L, 702809L, 702817L, 702827L, 702847L, 702851L, 702853L, 702869L,
-702881L, 702887L, 702893L, 702913L, 702937L, 702983L, 702991L, 703013L, 703033L,
-703039L, 703081L, 703117L, 703121L, 703123L, 703127L, 703139L, 703141L, 703169L,
-703193L, 703211L, 703217L, 703223L, 703229L, 703231L, 703243L, 703249L, 703267L,
-703277L, 703301L, 703309L, 703321L, 703327L, 703331L, 703349L, 703357L, 703379L,
-703393L, 703411L, 703441L, 703447L, 703459L, 703463L, 703471L, 703489L, 703499L,
-703531L, 703537L, 703559L, 703561L, 703631L, 703643L, 703657L, 703663L, 703673L,
-703679L, 703691L, 703699L, 703709L, 703711L, 703721L, 703733L, 703753L, 703763L,
-703789L, 703819L, 703837L, 703849L, 703861L, 703873L, 703883L, 703897L, 703903L,
-703907L, 703943L, 703949L, 703957L, 703981L, 703991L, 704003L, 704009L, 704017L,
-704023L, 704027L, 704029L, 704059L, 704069L, 704087L, 704101L, 704111L, 704117L,
-704131L, 704141L, 704153L, 704161L, 704177L, 704183L, 704189L, 704213L, 704219L,
-704233L, 704243L, 704251L, 704269L, 704279L, 704281L, 704287L, 704299L, 704303L,
-704309L, 704321L, 704357L, 704393L, 704399L, 704419L, 704441L, 704447L, 704449L,
-704453L, 704461L, 704477L, 704507L, 704521L, 704527L, 704549L, 704551L, 704567L,
-704569L, 704579L, 704581L, 704593L, 704603L, 704617L, 704647L, 704657L, 704663L,
-704681L, 704687L, 704713L, 704719L, 704731L, 704747L, 704761L, 704771L, 704777L,
-704779L, 704783L, 704797L, 704801L, 704807L, 704819L, 704833L, 704839L, 704849L,
-704857L, 704861L, 704863L, 704867L, 704897L, 704929L, 704933L, 704947L, 704983L,
-704989L, 704993L, 704999L, 705011L, 705013L, 705017L, 705031L, 705043L, 705053L,
-705073L, 705079L, 705097L, 705113L, 705119L, 705127L, 705137L, 705161L, 705163L,
-705167L, 705169L, 705181L, 705191L, 705197L, 705209L, 705247L, 705259L, 705269L,
-705277L, 705293L, 705307L, 705317L, 705389L, 705403L, 705409L, 705421L, 705427L,
-705437L, 705461L, 705491L, 705493L, 705499L, 705521L, 705533L, 705559L, 705613L,
-705631L, 705643L, 705689L, 705713L, 705737L, 705751L, 705763L, 705769L, 705779L,
-705781L, 705787L, 705821L, 705827L, 705829L, 705833L, 705841L, 705863L, 705871L,
-705883L, 705899L, 705919L, 705937L, 705949L, 705967L, 705973L, 705989L, 706001L,
-706003L, 706009L, 706019L, 706033L, 706039L, 706049L, 706051L, 706067L, 706099L,
-706109L, 706117L, 706133L, 706141L, 706151L, 706157L, 706159L, 706183L, 706193L,
-706201L, 706207L, 706213L, 706229L, 706253L, 706267L, 706283L, 706291L, 706297L,
-706301L, 706309L, 706313L, 706337L, 706357L, 706369L, 706373L, 706403L, 706417L,
-706427L, 706463L, 706481L, 706487L, 706499L, 706507L, 706523L, 706547L, 706561L,
-706597L, 706603L, 706613L, 706621L, 706631L, 706633L, 706661L, 706669L, 706679L,
-706703L, 706709L, 706729L, 706733L, 706747L, 706751L, 706753L, 706757L, 706763L,
-706787L, 706793L, 706801L, 706829L, 706837L, 706841L, 706847L, 706883L, 706897L,
-706907L, 706913L, 706919L, 706921L, 706943L, 706961L, 706973L, 706987L, 706999L,
-707011L, 707027L, 707029L, 707053L, 707071L, 707099L, 707111L, 707117L, 707131L,
-707143L, 707153L, 707159L, 707177L, 707191L, 707197L, 707219L, 707249L, 707261L,
-707279L, 707293L, 707299L, 707321L, 707341L, 707359L, 707383L, 707407L, 707429L,
-707431L, 707437L, 707459L, 707467L, 707501L, 707527L, 707543L, 707561L, 707563L,
-707573L, 707627L, 707633L, 707647L, 707653L, 707669L, 707671L, 707677L, 707683L,
-707689L, 707711L, 707717L, 707723L, 707747L, 707753L, 707767L, 707789L, 707797L,
-707801L, 707813L, 707827L, 707831L, 707849L, 707857L, 707869L, 707873L, 707887L,
-707911L, 707923L, 707929L, 707933L, 707939L, 707951L, 707953L, 707957L, 707969L,
-707981L, 707983L, 708007L, 708011L, 708017L, 708023L, 708031L, 708041L, 708047L,
-708049L, 708053L, 708061L, 708091L, 708109L, 708119L, 708131L, 708137L, 708139L,
-708161L, 708163L, 708179L, 708199L, 708221L, 708223L, 708229L, 708251L, 708269L,
-708283L, 708287L, 708293L, 708311L, 708329L, 708343L, 708347L, 708353L, 708359L,
-708361L, 708371L, 708403L, 708437L, 708457L, 708473L, 708479L, 708481L, 708493L,
-708497L, 708517L, 708527L, 708559L, 708563L, 708569L, 708583L, 708593L, 708599L,
-708601L, 708641L, 708647L, 708667L, 708689L, 708703L, 708733L, 708751L, 708803L,
-708823L, 708839L, 708857L, 708859L, 708893L, 708899L, 708907L, 708913L, 708923L,
-708937L, 708943L, 708959L, 708979L, 708989L, 708991L, 708997L, 709043L, 709057L,
-709097L, 709117L, 709123L, 709139L, 709141L, 709151L, 709153L, 709157L, 709201L,
-709211L, 709217L, 709231L, 709237L, 709271L, 709273L, 709279L, 709283L, 709307L,
-709321L, 709337L, 709349L, 709351L, 709381L, 709409L, 709417L, 709421L, 709433L,
-709447L, 709451L, 709453L, 709469L, 709507L, 709519L, 709531L, 709537L, 709547L,
-709561L, 709589L, 709603L, 709607L, 709609L, 709649L, 709651L, 709663L, 709673L,
-709679L, 709691L, 709693L, 709703L, 709729L, 709739L, 709741L, 709769L, 709777L,
-709789L, 709799L, 709817L, 709823L, 709831L, 709843L, 709847L, 709853L, 709861L,
-709871L, 709879L, 709901L, 709909L, 709913L, 709921L, 709927L, 709957L, 709963L,
-709967L, 709981L, 709991L, 710009L, 710023L, 710027L, 710051L, 710053L, 710081L,
-710089L, 710119L, 710189L, 710207L, 710219L, 710221L, 710257L, 710261L, 710273L,
-710293L, 710299L, 710321L, 710323L, 710327L, 710341L, 710351L, 710371L, 710377L,
-710383L, 710389L, 710399L, 710441L, 710443L, 710449L, 710459L, 710473L, 710483L,
-710491L, 710503L, 710513L, 710519L, 710527L, 710531L, 710557L, 710561L, 710569L,
-710573L, 710599L, 710603L, 710609L, 710621L, 710623L, 710627L, 710641L, 710663L,
-710683L, 710693L, 710713L, 710777L, 710779L, 710791L, 710813L, 710837L, 710839L,
-710849L, 710851L, 710863L, 710867L, 710873L, 710887L, 710903L, 710909L, 710911L,
-710917L, 710929L, 710933L, 710951L, 710959L, 710971L, 710977L, 710987L, 710989L,
-711001L, 711017L, 711019L, 711023L, 711041L, 711049L, 711089L, 711097L, 711121L,
-711131L, 711133L, 711143L, 711163L, 711173L, 711181L, 711187L, 711209L, 711223L,
-711259L, 711287L, 711299L, 711307L, 711317L, 711329L, 711353L, 711371L, 711397L,
-711409L, 711427L, 711437L, 711463L, 711479L, 711497L, 711499L, 711509L, 711517L,
-711523L, 711539L, 711563L, 711577L, 711583L, 711589L, 711617L, 711629L, 711649L,
-711653L, 711679L, 711691L, 711701L, 711707L, 711709L, 711713L, 711727L, 711731L,
-711749L, 711751L, 711757L, 711793L, 711811L, 711817L, 711829L, 711839L, 711847L,
-711859L, 711877L, 711889L, 711899L, 711913L, 711923L, 711929L, 711937L, 711947L,
-711959L, 711967L, 711973L, 711983L, 712007L, 712021L, 712051L, 712067L, 712093L,
-712109L, 712121L, 712133L, 712157L, 712169L, 712171L, 712183L, 712199L, 712219L,
-712237L, 712279L, 712289L, 712301L, 712303L, 712319L, 712321L, 712331L, 712339L,
-712357L, 712409L, 712417L, 712427L, 712429L, 712433L, 712447L, 712477L, 712483L,
-712489L, 712493L, 712499L, 712507L, 712511L, 712531L, 712561L, 712571L, 712573L,
-712601L, 712603L, 712631L, 712651L, 712669L, 712681L, 712687L, 712693L, 712697L,
-712711L, 712717L, 712739L, 712781L, 712807L, 712819L, 712837L, 712841L, 712843L,
-712847L, 712883L, 712889L, 712891L, 712909L, 712913L, 712927L, 712939L, 712951L,
-712961L, 712967L, 712973L, 712981L, 713021L, 713039L, 713059L, 713077L, 713107L,
-713117L, 713129L, 713147L, 713149L, 713159L, 713171L, 713177L, 713183L, 713189L,
-713191L, 713227L, 713233L, 713239L, 713243L, 713261L, 713267L, 713281L, 713287L,
-713309L, 713311L, 713329L, 713347L, 713351L, 713353L, 713357L, 713381L, 713389L,
-713399L, 713407L, 713411L, 713417L, 713467L, 713477L, 713491L, 713497L, 713501L,
-713509L, 713533L, 713563L, 713569L, 713597L, 713599L, 713611L, 713627L, 713653L,
-713663L, 713681L, 713737L, 713743L, 713747L, 713753L, 713771L, 713807L, 713827L,
-713831L, 713833L, 713861L, 713863L, 713873L, 713891L, 713903L, 713917L, 713927L,
-713939L, 713941L, 713957L, 713981L, 713987L, 714029L, 714037L, 714061L, 714073L,
-714107L, 714113L, 714139L, 714143L, 714151L, 714163L, 714169L, 714199L, 714223L,
-714227L, 714247L, 714257L, 714283L, 714341L, 714349L, 714361L, 714377L, 714443L,
-714463L, 714479L, 714481L, 714487L, 714503L, 714509L, 714517L, 714521L, 714529L,
-714551L, 714557L, 714563L, 714569L, 714577L, 714601L, 714619L, 714673L, 714677L,
-714691L, 714719L, 714739L, 714751L, 714773L, 714781L, 714787L, 714797L, 714809L,
-714827L, 714839L, 714841L, 714851L, 714853L, 714869L, 714881L, 714887L, 714893L,
-714907L, 714911L, 714919L, 714943L, 714947L, 714949L, 714971L, 714991L, 715019L,
-715031L, 715049L, 715063L, 715069L, 715073L, 715087L, 715109L, 715123L, 715151L,
-715153L, 715157L, 715159L, 715171L, 715189L, 715193L, 715223L, 715229L, 715237L,
-715243L, 715249L, 715259L, 715289L, 715301L, 715303L, 715313L, 715339L, 715357L,
-715361L, 715373L, 715397L, 715417L, 715423L, 715439L, 715441L, 715453L, 715457L,
-715489L, 715499L, 715523L, 715537L, 715549L, 715567L, 715571L, 715577L, 715579L,
-715613L, 715621L, 715639L, 715643L, 715651L, 715657L, 715679L, 715681L, 715699L,
-715727L, 715739L, 715753L, 715777L, 715789L, 715801L, 715811L, 715817L, 715823L,
-715843L, 715849L, 715859L, 715867L, 715873L, 715877L, 715879L, 715889L, 715903L,
-715909L, 715919L, 715927L, 715943L, 715961L, 715963L, 715969L, 715973L, 715991L,
-715999L, 716003L, 716033L, 716063L, 716087L, 716117L, 716123L, 716137L, 716143L,
-716161L, 716171L, 716173L, 716249L, 716257L, 716279L, 716291L, 716299L, 716321L,
-716351L, 716383L, 716389L, 716399L, 716411L, 716413L, 716447L, 716449L, 716453L,
-716459L, 716477L, 716479L, 716483L, 716491L, 716501L, 716531L, 716543L, 716549L,
-716563L, 716581L, 716591L, 716621L, 716629L, 716633L, 716659L, 716663L, 716671L,
-716687L, 716693L, 716707L, 716713L, 716731L, 716741L, 716743L, 716747L, 716783L,
-716789L, 716809L, 716819L, 716827L, 716857L, 716861L, 716869L, 716897L, 716899L,
-716917L, 716929L, 716951L, 716953L, 716959L, 716981L, 716987L, 717001L, 717011L,
-717047L, 717089L, 717091L, 717103L, 717109L, 717113L, 717127L, 717133L, 717139L,
-717149L, 717151L, 717161L, 717191L, 717229L, 717259L, 717271L, 717289L, 717293L,
-717317L, 717323L, 717331L, 717341L, 717397L, 717413L, 717419L, 717427L, 717443L,
-717449L, 717463L, 717491L, 717511L, 717527L, 717529L, 717533L, 717539L, 717551L,
-717559L, 717581L, 717589L, 717593L, 717631L, 717653L, 717659L, 717667L, 717679L,
-717683L, 717697L, 717719L, 717751L, 717797L, 717803L, 717811L, 717817L, 717841L,
-717851L, 717883L, 717887L, 717917L, 717919L, 717923L, 717967L, 717979L, 717989L,
-718007L, 718043L, 718049L, 718051L, 718087L, 718093L, 718121L, 718139L, 718163L,
-718169L, 718171L, 718183L, 718187L, 718241L, 718259L, 718271L, 718303L, 718321L,
-718331L, 718337L, 718343L, 718349L, 718357L, 718379L, 718381L, 718387L, 718391L,
-718411L, 718423L, 718427L, 718433L, 718453L, 718457L, 718463L, 718493L, 718511L,
-718513L, 718541L, 718547L, 718559L, 718579L, 718603L, 718621L, 718633L, 718657L,
-718661L, 718691L, 718703L, 718717L, 718723L, 718741L, 718747L, 718759L, 718801L,
-718807L, 718813L, 718841L, 718847L, 718871L, 718897L, 718901L, 718919L, 718931L,
-718937L, 718943L, 718973L, 718999L, 719009L, 719011L, 719027L, 719041L, 719057L,
-719063L, 719071L, 719101L, 719119L, 719143L, 719149L, 719153L, 719167L, 719177L,
-719179L, 719183L, 719189L, 719197L, 719203L, 719227L, 719237L, 719239L, 719267L,
-719281L, 719297L, 719333L, 719351L, 719353L, 719377L, 719393L, 719413L, 719419L,
-719441L, 719447L, 719483L, 719503L, 719533L, 719557L, 719567L, 719569L, 719573L,
-719597L, 719599L, 719633L, 719639L, 719659L, 719671L, 719681L, 719683L, 719689L,
-719699L, 719713L, 719717L, 719723L, 719731L, 719749L, 719753L, 719773L, 719779L,
-719791L, 719801L, 719813L, 719821L, 719833L, 719839L, 719893L, 719903L, 719911L,
-719941L, 719947L, 719951L, 719959L, 719981L, 719989L, 720007L, 720019L, 720023L,
-720053L, 720059L, 720089L, 720091L, 720101L, 720127L, 720133L, 720151L, 720173L,
-720179L, 720193L, 720197L, 720211L, 720221L, 720229L, 720241L, 720253L, 720257L,
-720281L, 720283L, 720289L, 720299L, 720301L, 720311L, 720319L, 720359L, 720361L,
-720367L, 720373L, 720397L, 720403L, 720407L, 720413L, 720439L, 720481L, 720491L,
-720497L, 720527L, 720547L, 720569L, 720571L, 720607L, 720611L, 720617L, 720619L,
-720653L, 720661L, 720677L, 720683L, 720697L, 720703L, 720743L, 720763L, 720767L,
-720773L, 720779L, 720791L, 720793L, 720829L, 720847L, 720857L, 720869L, 720877L,
-720887L, 720899L, 720901L, 720913L, 720931L, 720943L, 720947L, 720961L, 720971L,
-720983L, 720991L, 720997L, 721003L, 721013L, 721037L, 721043L, 721051L, 721057L,
-721079L, 721087L, 721109L, 721111L, 721117L, 721129L, 721139L, 721141L, 721159L,
-721163L, 721169L, 721177L, 721181L, 721199L, 721207L, 721213L, 721219L, 721223L,
-721229L, 721243L, 721261L, 721267L, 721283L, 721291L, 721307L, 721319L, 721321L,
-721333L, 721337L, 721351L, 721363L, 721379L, 721381L, 721387L, 721397L, 721439L,
-721451L, 721481L, 721499L, 721529L, 721547L, 721561L, 721571L, 721577L, 721597L,
-721613L, 721619L, 721621L, 721631L, 721661L, 721663L, 721687L, 721697L, 721703L,
-721709L, 721733L, 721739L, 721783L, 721793L, 721843L, 721849L, 721859L, 721883L,
-721891L, 721909L, 721921L, 721951L, 721961L, 721979L, 721991L, 721997L, 722011L,
-722023L, 722027L, 722047L, 722063L, 722069L, 722077L, 722093L, 722119L, 722123L,
-722147L, 722149L, 722153L, 722159L, 722167L, 722173L, 722213L, 722237L, 722243L,
-722257L, 722273L, 722287L, 722291L, 722299L, 722311L, 722317L, 722321L, 722333L,
-722341L, 722353L, 722363L, 722369L, 722377L, 722389L, 722411L, 722417L, 722431L,
-722459L, 722467L, 722479L, 722489L, 722509L, 722521L, 722537L, 722539L, 722563L,
-722581L, 722599L, 722611L, 722633L, 722639L, 722663L, 722669L, 722713L, 722723L,
-722737L, 722749L, 722783L, 722791L, 722797L, 722807L, 722819L, 722833L, 722849L,
-722881L, 722899L, 722903L, 722921L, 722933L, 722963L, 722971L, 722977L, 722983L,
-723029L, 723031L, 723043L, 723049L, 723053L, 723067L, 723071L, 723089L, 723101L,
-723103L, 723109L, 723113L, 723119L, 723127L, 723133L, 723157L, 723161L, 723167L,
-723169L, 723181L, 723193L, 723209L, 723221L, 723227L, 723257L, 723259L, 723263L,
-723269L, 723271L, 723287L, 723293L, 723319L, 723337L, 723353L, 723361L, 723379L,
-723391L, 723407L, 723409L, 723413L, 723421L, 723439L, 723451L, 723467L, 723473L,
-723479L, 723491L, 723493L, 723529L, 723551L, 723553L, 723559L, 723563L, 723587L,
-723589L, 723601L, 723607L, 723617L, 723623L, 723661L, 723721L, 723727L, 723739L,
-723761L, 723791L, 723797L, 723799L, 723803L, 723823L, 723829L, 723839L, 723851L,
-723857L, 723859L, 723893L, 723901L, 723907L, 723913L, 723917L, 723923L, 723949L,
-723959L, 723967L, 723973L, 723977L, 723997L, 724001L, 724007L, 724021L, 724079L,
-724093L, 724099L, 724111L, 724117L, 724121L, 724123L, 724153L, 724187L, 724211L,
-724219L, 724259L, 724267L, 724277L, 724291L, 724303L, 724309L, 724313L, 724331L,
-724393L, 724403L, 724433L, 724441L, 724447L, 724453L, 724459L, 724469L, 724481L,
-724487L, 724499L, 724513L, 724517L, 724519L, 724531L, 724547L, 724553L, 724567L,
-724573L, 724583L, 724597L, 724601L, 724609L, 724621L, 724627L, 724631L, 724639L,
-724643L, 724651L, 724721L, 724723L, 724729L, 724733L, 724747L, 724751L, 724769L,
-724777L, 724781L, 724783L, 724807L, 724813L, 724837L, 724847L, 724853L, 724879L,
-724901L, 724903L, 724939L, 724949L, 724961L, 724967L, 724991L, 724993L, 725009L,
-725041L, 725057L, 725071L, 725077L, 725099L, 725111L, 725113L, 725119L, 725147L,
-725149L, 725159L, 725161L, 725189L, 725201L, 725209L, 725273L, 725293L, 725303L,
-725317L, 725321L, 725323L, 725327L, 725341L, 725357L, 725359L, 725371L, 725381L,
-725393L, 725399L, 725423L, 725437L, 725447L, 725449L, 725479L, 725507L, 725519L,
-725531L, 725537L, 725579L, 725587L, 725597L, 725603L, 725639L, 725653L, 725663L,
-725671L, 725687L, 725723L, 725731L, 725737L, 725749L, 725789L, 725801L, 725807L,
-725827L, 725861L, 725863L, 725867L, 725891L, 725897L, 725909L, 725929L, 725939L,
-725953L, 725981L, 725983L, 725993L, 725999L, 726007L, 726013L, 726023L, 726043L,
-726071L, 726091L, 726097L, 726101L, 726107L, 726109L, 726137L, 726139L, 726149L,
-726157L, 726163L, 726169L, 726181L, 726191L, 726221L, 726287L, 726289L, 726301L,
-726307L, 726331L, 726337L, 726367L, 726371L, 726377L, 726379L, 726391L, 726413L,
-726419L, 726431L, 726457L, 726463L, 726469L, 726487L, 726497L, 726521L, 726527L,
-726533L, 726559L, 726589L, 726599L, 726601L, 726611L, 726619L, 726623L, 726629L,
-726641L, 726647L, 726659L, 726679L, 726689L, 726697L, 726701L, 726707L, 726751L,
-726779L, 726787L, 726797L, 726809L, 726811L, 726839L, 726841L, 726853L, 726893L,
-726899L, 726911L, 726917L, 726923L, 726941L, 726953L, 726983L, 726989L, 726991L,
-727003L, 727009L, 727019L, 727021L, 727049L, 727061L, 727063L, 727079L, 727121L,
-727123L, 727157L, 727159L, 727169L, 727183L, 727189L, 727201L, 727211L, 727241L,
-727247L, 727249L, 727261L, 727267L, 727271L, 727273L, 727289L, 727297L, 727313L,
-727327L, 727343L, 727351L, 727369L, 727399L, 727409L, 727427L, 727451L, 727459L,
-727471L, 727483L, 727487L, 727499L, 727501L, 727541L, 727561L, 727577L, 727589L,
-727613L, 727621L, 727633L, 727667L, 727673L, 727691L, 727703L, 727711L, 727717L,
-727729L, 727733L, 727747L, 727759L, 727763L, 727777L, 727781L, 727799L, 727807L,
-727817L, 727823L, 727843L, 727847L, 727877L, 727879L, 727891L, 727933L, 727939L,
-727949L, 727981L, 727997L, 728003L, 728017L, 728027L, 728047L, 728069L, 728087L,
-728113L, 728129L, 728131L, 728173L, 728191L, 728207L, 728209L, 728261L, 728267L,
-728269L, 728281L, 728293L, 728303L, 728317L, 728333L, 728369L, 728381L, 728383L,
-728417L, 728423L, 728437L, 728471L, 728477L, 728489L, 728521L, 728527L, 728537L,
-728551L, 728557L, 728561L, 728573L, 728579L, 728627L, 728639L, 728647L, 728659L,
-728681L, 728687L, 728699L, 728701L, 728713L, 728723L, 728729L, 728731L, 728743L,
-728747L, 728771L, 728809L, 728813L, 728831L, 728837L, 728839L, 728843L, 728851L,
-728867L, 728869L, 728873L, 728881L, 728891L, 728899L, 728911L, 728921L, 728927L,
-728929L, 728941L, 728947L, 728953L, 728969L, 728971L, 728993L, 729019L, 729023L,
-729037L, 729041L, 729059L, 729073L, 729139L, 729143L, 729173L, 729187L, 729191L,
-729199L, 729203L, 729217L, 729257L, 729269L, 729271L, 729293L, 729301L, 729329L,
-729331L, 729359L, 729367L, 729371L, 729373L, 729389L, 729403L, 729413L, 729451L,
-729457L, 729473L, 729493L, 729497L, 729503L, 729511L, 729527L, 729551L, 729557L,
-729559L, 729569L, 729571L, 729577L, 729587L, 729601L, 729607L, 729613L, 729637L,
-729643L, 729649L, 729661L, 729671L, 729679L, 729689L, 729713L, 729719L, 729737L,
-729749L, 729761L, 729779L, 729787L, 729791L, 729821L, 729851L, 729871L, 729877L,
-729907L, 729913L, 729919L, 729931L, 729941L, 729943L, 729947L, 729977L, 729979L,
-729991L, 730003L, 730021L, 730033L, 730049L, 730069L, 730091L, 730111L, 730139L,
-730157L, 730187L, 730199L, 730217L, 730237L, 730253L, 730277L, 730283L, 730297L,
-730321L, 730339L, 730363L, 730397L, 730399L, 730421L, 730447L, 730451L, 730459L,
-730469L, 730487L, 730537L, 730553L, 730559L, 730567L, 730571L, 730573L, 730589L,
-730591L, 730603L, 730619L, 730633L, 730637L, 730663L, 730669L, 730679L, 730727L,
-730747L, 730753L, 730757L, 730777L, 730781L, 730783L, 730789L, 730799L, 730811L,
-730819L, 730823L, 730837L, 730843L, 730853L, 730867L, 730879L, 730889L, 730901L,
-730909L, 730913L, 730943L, 730969L, 730973L, 730993L, 730999L, 731033L, 731041L,
-731047L, 731053L, 731057L, 731113L, 731117L, 731141L, 731173L, 731183L, 731189L,
-731191L, 731201L, 731209L, 731219L, 731233L, 731243L, 731249L, 731251L, 731257L,
-731261L, 731267L, 731287L, 731299L, 731327L, 731333L, 731359L, 731363L, 731369L,
-731389L, 731413L, 731447L, 731483L, 731501L, 731503L, 731509L, 731531L, 731539L,
-731567L, 731587L, 731593L, 731597L, 731603L, 731611L, 731623L, 731639L, 731651L,
-731681L, 731683L, 731711L, 731713L, 731719L, 731729L, 731737L, 731741L, 731761L,
-731767L, 731779L, 731803L, 731807L, 731821L, 731827L, 731831L, 731839L, 731851L,
-731869L, 731881L, 731893L, 731909L, 731911L, 731921L, 731923L, 731933L, 731957L,
-731981L, 731999L, 732023L, 732029L, 732041L, 732073L, 732077L, 732079L, 732097L,
-732101L, 732133L, 732157L, 732169L, 732181L, 732187L, 732191L, 732197L, 732209L,
-732211L, 732217L, 732229L, 732233L, 732239L, 732257L, 732271L, 732283L, 732287L,
-732293L, 732299L, 732311L, 732323L, 732331L, 732373L, 732439L, 732449L, 732461L,
-732467L, 732491L, 732493L, 732497L, 732509L, 732521L, 732533L, 732541L, 732601L,
-732617L, 732631L, 732653L, 732673L, 732689L, 732703L, 732709L, 732713L, 732731L,
-732749L, 732761L, 732769L, 732799L, 732817L, 732827L, 732829L, 732833L, 732841L,
-732863L, 732877L, 732889L, 732911L, 732923L, 732943L, 732959L, 732967L, 732971L,
-732997L, 733003L, 733009L, 733067L, 733097L, 733099L, 733111L, 733123L, 733127L,
-733133L, 733141L, 733147L, 733157L, 733169L, 733177L, 733189L, 733237L, 733241L,
-733273L, 733277L, 733283L, 733289L, 733301L, 733307L, 733321L, 733331L, 733333L,
-733339L, 733351L, 733373L, 733387L, 733391L, 733393L, 733399L, 733409L, 733427L,
-733433L, 733459L, 733477L, 733489L, 733511L, 733517L, 733519L, 733559L, 733561L,
-733591L, 733619L, 733639L, 733651L, 733687L, 733697L, 733741L, 733751L, 733753L,
-733757L, 733793L, 733807L, 733813L, 733823L, 733829L, 733841L, 733847L, 733849L,
-733867L, 733871L, 733879L, 733883L, 733919L, 733921L, 733937L, 733939L, 733949L,
-733963L, 733973L, 733981L, 733991L, 734003L, 734017L, 734021L, 734047L, 734057L,
-734087L, 734113L, 734131L, 734143L, 734159L, 734171L, 734177L, 734189L, 734197L,
-734203L, 734207L, 734221L, 734233L, 734263L, 734267L, 734273L, 734291L, 734303L,
-734329L, 734347L, 734381L, 734389L, 734401L, 734411L, 734423L, 734429L, 734431L,
-734443L, 734471L, 734473L, 734477L, 734479L, 734497L, 734537L, 734543L, 734549L,
-734557L, 734567L, 734627L, 734647L, 734653L, 734659L, 734663L, 734687L, 734693L,
-734707L, 734717L, 734729L, 734737L, 734743L, 734759L, 734771L, 734803L, 734807L,
-734813L, 734819L, 734837L, 734849L, 734869L, 734879L, 734887L, 734897L, 734911L,
-734933L, 734941L, 734953L, 734957L, 734959L, 734971L, 735001L, 735019L, 735043L,
-735061L, 735067L, 735071L, 735073L, 735083L, 735107L, 735109L, 735113L, 735139L,
-735143L, 735157L, 735169L, 735173L, 735181L, 735187L, 735193L, 735209L, 735211L,
-735239L, 735247L, 735263L, 735271L, 735283L, 735307L, 735311L, 735331L, 735337L,
-735341L, 735359L, 735367L, 735373L, 735389L, 735391L, 735419L, 735421L, 735431L,
-735439L, 735443L, 735451L, 735461L, 735467L, 735473L, 735479L, 735491L, 735529L,
-735533L, 735557L, 735571L, 735617L, 735649L, 735653L, 735659L, 735673L, 735689L,
-735697L, 735719L, 735731L, 735733L, 735739L, 735751L, 735781L, 735809L, 735821L,
-735829L, 735853L, 735871L, 735877L, 735883L, 735901L, 735919L, 735937L, 735949L,
-735953L, 735979L, 735983L, 735997L, 736007L, 736013L, 736027L, 736037L, 736039L,
-736051L, 736061L, 736063L, 736091L, 736093L, 736097L, 736111L, 736121L, 736147L,
-736159L, 736181L, 736187L, 736243L, 736247L, 736249L, 736259L, 736273L, 736277L,
-736279L, 736357L, 736361L, 736363L, 736367L, 736369L, 736381L, 736387L, 736399L,
-736403L, 736409L, 736429L, 736433L, 736441L, 736447L, 736469L, 736471L, 736511L,
-736577L, 736607L, 736639L, 736657L, 736679L, 736691L, 736699L, 736717L, 736721L,
-736741L, 736787L, 736793L, 736817L, 736823L, 736843L, 736847L, 736867L, 736871L,
-736889L, 736903L, 736921L, 736927L, 736937L, 736951L, 736961L, 736973L, 736987L,
-736993L, 737017L, 737039L, 737041L, 737047L, 737053L, 737059L, 737083L, 737089L,
-737111L, 737119L, 737129L, 737131L, 737147L, 737159L, 737179L, 737183L, 737203L,
-737207L, 737251L, 737263L, 737279L, 737281L, 737287L, 737291L, 737293L, 737309L,
-737327L, 737339L, 737351L, 737353L, 737411L, 737413L, 737423L, 737431L, 737479L,
-737483L, 737497L, 737501L, 737507L, 737509L, 737531L, 737533L, 737537L, 737563L,
-737567L, 737573L, 737591L, 737593L, 737617L, 737629L, 737641L, 737657L, 737663L,
-737683L, 737687L, 737717L, 737719L, 737729L, 737747L, 737753L, 737767L, 737773L,
-737797L, 737801L, 737809L, 737819L, 737843L, 737857L, 737861L, 737873L, 737887L,
-737897L, 737921L, 737927L, 737929L, 737969L, 737981L, 737999L, 738011L, 738029L,
-738043L, 738053L, 738071L, 738083L, 738107L, 738109L, 738121L, 738151L, 738163L,
-738173L, 738197L, 738211L, 738217L, 738223L, 738247L, 738263L, 738301L, 738313L,
-738317L, 738319L, 738341L, 738349L, 738373L, 738379L, 738383L, 738391L, 738401L,
-738403L, 738421L, 738443L, 738457L, 738469L, 738487L, 738499L, 738509L, 738523L,
-738539L, 738547L, 738581L, 738583L, 738589L, 738623L, 738643L, 738677L, 738707L,
-738713L, 738721L, 738743L, 738757L, 738781L, 738791L, 738797L, 738811L, 738827L,
-738839L, 738847L, 738851L, 738863L, 738877L, 738889L, 738917L, 738919L, 738923L,
-738937L, 738953L, 738961L, 738977L, 738989L, 739003L, 739021L, 739027L, 739031L,
-739051L, 739061L, 739069L, 739087L, 739099L, 739103L, 739111L, 739117L, 739121L,
-739153L, 739163L, 739171L, 739183L, 739187L, 739199L, 739201L, 739217L, 739241L,
-739253L, 739273L, 739283L, 739301L, 739303L, 739307L, 739327L, 739331L, 739337L,
-739351L, 739363L, 739369L, 739373L, 739379L, 739391L, 739393L, 739397L, 739399L,
-739433L, 739439L, 739463L, 739469L, 739493L, 739507L, 739511L, 739513L, 739523L,
-739549L, 739553L, 739579L, 739601L, 739603L, 739621L, 739631L, 739633L, 739637L,
-739649L, 739693L, 739699L, 739723L, 739751L, 739759L, 739771L, 739777L, 739787L,
-739799L, 739813L, 739829L, 739847L, 739853L, 739859L, 739861L, 739909L, 739931L,
-739943L, 739951L, 739957L, 739967L, 739969L, 740011L, 740021L, 740023L, 740041L,
-740053L, 740059L, 740087L, 740099L, 740123L, 740141L, 740143L, 740153L, 740161L,
-740171L, 740189L, 740191L, 740227L, 740237L, 740279L, 740287L, 740303L, 740321L,
-740323L, 740329L, 740351L, 740359L, 740371L, 740387L, 740423L, 740429L, 740461L,
-740473L, 740477L, 740483L, 740513L, 740521L, 740527L, 740533L, 740549L, 740561L,
-740581L, 740591L, 740599L, 740603L, 740651L, 740653L, 740659L, 740671L, 740681L,
-740687L, 740693L, 740711L, 740713L, 740717L, 740737L, 740749L, 740801L, 740849L,
-740891L, 740893L, 740897L, 740903L, 740923L, 740939L, 740951L, 740969L, 740989L,
-741001L, 741007L, 741011L, 741031L, 741043L, 741053L, 741061L, 741071L, 741077L,
-741079L, 741101L, 741119L, 741121L, 741127L, 741131L, 741137L, 741163L, 741187L,
-741193L, 741227L, 741229L, 741233L, 741253L, 741283L, 741337L, 741341L, 741343L,
-741347L, 741373L, 741401L, 741409L, 741413L, 741431L, 741457L, 741467L, 741469L,
-741473L, 741479L, 741491L, 741493L, 741509L, 741541L, 741547L, 741563L, 741569L,
-741593L, 741599L, 741641L, 741661L, 741667L, 741677L, 741679L, 741683L, 741691L,
-741709L, 741721L, 741781L, 741787L, 741803L, 741809L, 741827L, 741833L, 741847L,
-741857L, 741859L, 741869L, 741877L, 741883L, 741913L, 741929L, 741941L, 741967L,
-741973L, 741991L, 742009L, 742031L, 742037L, 742057L, 742069L, 742073L, 742111L,
-742117L, 742127L, 742151L, 742153L, 742193L, 742199L, 742201L, 742211L, 742213L,
-742219L, 742229L, 742241L, 742243L, 742253L, 742277L, 742283L, 742289L, 742307L,
-742327L, 742333L, 742351L, 742369L, 742381L, 742393L, 742409L, 742439L, 742457L,
-742499L, 742507L, 742513L, 742519L, 742531L, 742537L, 742541L, 742549L, 742559L,
-742579L, 742591L, 742607L, 742619L, 742657L, 742663L, 742673L, 742681L, 742697L,
-742699L, 742711L, 742717L, 742723L, 742757L, 742759L, 742783L, 742789L, 742801L,
-742817L, 742891L, 742897L, 742909L, 742913L, 742943L, 742949L, 742967L, 742981L,
-742991L, 742993L, 742999L, 743027L, 743047L, 743059L, 743069L, 743089L, 743111L,
-743123L, 743129L, 743131L, 743137L, 743143L, 743159L, 743161L, 743167L, 743173L,
-743177L, 743179L, 743203L, 743209L, 743221L, 743251L, 743263L, 743269L, 743273L,
-743279L, 743297L, 743321L, 743333L, 743339L, 743363L, 743377L, 743401L, 743423L,
-743447L, 743507L, 743549L, 743551L, 743573L, 743579L, 743591L, 743609L, 743657L,
-743669L, 743671L, 743689L, 743693L, 743711L, 743731L, 743747L, 743777L, 743779L,
-743791L, 743803L, 743819L, 743833L, 743837L, 743849L, 743851L, 743881L, 743891L,
-743917L, 743921L, 743923L, 743933L, 743947L, 743987L, 743989L, 744019L, 744043L,
-744071L, 744077L, 744083L, 744113L, 744127L, 744137L, 744179L, 744187L, 744199L,
-744203L, 744221L, 744239L, 744251L, 744253L, 744283L, 744301L, 744313L, 744353L,
-744371L, 744377L, 744389L, 744391L, 744397L, 744407L, 744409L, 744431L, 744451L,
-744493L, 744503L, 744511L, 744539L, 744547L, 744559L, 744599L, 744607L, 744637L,
-744641L, 744649L, 744659L, 744661L, 744677L, 744701L, 744707L, 744721L, 744727L,
-744739L, 744761L, 744767L, 744791L, 744811L, 744817L, 744823L, 744829L, 744833L,
-744859L, 744893L, 744911L, 744917L, 744941L, 744949L, 744959L, 744977L, 745001L,
-745013L, 745027L, 745033L, 745037L, 745051L, 745067L, 745103L, 745117L, 745133L,
-745141L, 745181L, 745187L, 745189L, 745201L, 745231L, 745243L, 745247L, 745249L,
-745273L, 745301L, 745307L, 745337L, 745343L, 745357L, 745369L, 745379L, 745391L,
-745397L, 745471L, 745477L, 745517L, 745529L, 745531L, 745543L, 745567L, 745573L,
-745601L, 745609L, 745621L, 745631L, 745649L, 745673L, 745697L, 745699L, 745709L,
-745711L, 745727L, 745733L, 745741L, 745747L, 745751L, 745753L, 745757L, 745817L,
-745837L, 745859L, 745873L, 745903L, 745931L, 745933L, 745939L, 745951L, 745973L,
-745981L, 745993L, 745999L, 746017L, 746023L, 746033L, 746041L, 746047L, 746069L,
-746099L, 746101L, 746107L, 746117L, 746129L, 746153L, 746167L, 746171L, 746177L,
-746183L, 746191L, 746197L, 746203L, 746209L, 746227L, 746231L, 746233L, 746243L,
-746267L, 746287L, 746303L, 746309L, 746329L, 746353L, 746363L, 746371L, 746411L,
-746413L, 746429L, 746477L, 746479L, 746483L, 746497L, 746503L, 746507L, 746509L,
-746531L, 746533L, 746561L, 746563L, 746597L, 746653L, 746659L, 746671L, 746677L,
-746723L, 746737L, 746743L, 746747L, 746749L, 746773L, 746777L, 746791L, 746797L,
-746807L, 746813L, 746839L, 746843L, 746869L, 746873L, 746891L, 746899L, 746903L,
-746939L, 746951L, 746957L, 746959L, 746969L, 746981L, 746989L, 747037L, 747049L,
-747053L, 747073L, 747107L, 747113L, 747139L, 747157L, 747161L, 747199L, 747203L,
-747223L, 747239L, 747259L, 747277L, 747283L, 747287L, 747319L, 747323L, 747343L,
-747361L, 747377L, 747391L, 747401L, 747407L, 747421L, 747427L, 747449L, 747451L,
-747457L, 747463L, 747493L, 747497L, 747499L, 747521L, 747529L, 747547L, 747557L,
-747563L, 747583L, 747587L, 747599L, 747611L, 747619L, 747647L, 747673L, 747679L,
-747713L, 747731L, 747737L, 747743L, 747763L, 747781L, 747811L, 747827L, 747829L,
-747833L, 747839L, 747841L, 747853L, 747863L, 747869L, 747871L, 747889L, 747917L,
-747919L, 747941L, 747953L, 747977L, 747979L, 747991L, 748003L, 748019L, 748021L,
-748039L, 748057L, 748091L, 748093L, 748133L, 748169L, 748183L, 748199L, 748207L,
-748211L, 748217L, 748219L, 748249L, 748271L, 748273L, 748283L, 748301L, 748331L,
-748337L, 748339L, 748343L, 748361L, 748379L, 748387L, 748441L, 748453L, 748463L,
-748471L, 748481L, 748487L, 748499L, 748513L, 748523L, 748541L, 748567L, 748589L,
-748597L, 748603L, 748609L, 748613L, 748633L, 748637L, 748639L, 748669L, 748687L,
-748691L, 748703L, 748711L, 748717L, 748723L, 748729L, 748763L, 748777L, 748789L,
-748801L, 748807L, 748817L, 748819L, 748823L, 748829L, 748831L, 748849L, 748861L,
-748871L, 748877L, 748883L, 748889L, 748921L, 748933L, 748963L, 748973L, 748981L,
-748987L, 749011L, 749027L, 749051L, 749069L, 749081L, 749083L, 749093L, 749129L,
-749137L, 749143L, 749149L, 749153L, 749167L, 749171L, 749183L, 749197L, 749209L,
-749219L, 749237L, 749249L, 749257L, 749267L, 749279L, 749297L, 749299L, 749323L,
-749339L, 749347L, 749351L, 749383L, 749393L, 749401L, 749423L, 749429L, 749431L,
-749443L, 749449L, 749453L, 749461L, 749467L, 749471L, 749543L, 749557L, 749587L,
-749641L, 749653L, 749659L, 749677L, 749701L, 749711L, 749729L, 749741L, 749747L,
-749761L, 749773L, 749779L, 749803L, 749807L, 749809L, 749843L, 749851L, 749863L,
-749891L, 749893L, 749899L, 749909L, 749923L, 749927L, 749939L, 749941L, 749971L,
-749993L, 750019L, 750037L, 750059L, 750077L, 750083L, 750097L, 750119L, 750121L,
-750131L, 750133L, 750137L, 750151L, 750157L, 750161L, 750163L, 750173L, 750179L,
-750203L, 750209L, 750223L, 750229L, 750287L, 750311L, 750313L, 750353L, 750383L,
-750401L, 750413L, 750419L, 750437L, 750457L, 750473L, 750487L, 750509L, 750517L,
-750521L, 750553L, 750571L, 750599L, 750613L, 750641L, 750653L, 750661L, 750667L,
-750679L, 750691L, 750707L, 750713L, 750719L, 750721L, 750749L, 750769L, 750787L,
-750791L, 750797L, 750803L, 750809L, 750817L, 750829L, 750853L, 750857L, 750863L,
-750917L, 750929L, 750943L, 750961L, 750977L, 750983L, 751001L, 751007L, 751021L,
-751027L, 751057L, 751061L, 751087L, 751103L, 751123L, 751133L, 751139L, 751141L,
-751147L, 751151L, 751181L, 751183L, 751189L, 751193L, 751199L, 751207L, 751217L,
-751237L, 751259L, 751273L, 751277L, 751291L, 751297L, 751301L, 751307L, 751319L,
-751321L, 751327L, 751343L, 751351L, 751357L, 751363L, 751367L, 751379L, 751411L,
-751423L, 751447L, 751453L, 751463L, 751481L, 751523L, 751529L, 751549L, 751567L,
-751579L, 751609L, 751613L, 751627L, 751631L, 751633L, 751637L, 751643L, 751661L,
-751669L, 751691L, 751711L, 751717L, 751727L, 751739L, 751747L, 751753L, 751759L,
-751763L, 751787L, 751799L, 751813L, 751823L, 751841L, 751853L, 751867L, 751871L,
-751879L, 751901L, 751909L, 751913L, 751921L, 751943L, 751957L, 751969L, 751987L,
-751997L, 752009L, 752023L, 752033L, 752053L, 752083L, 752093L, 752107L, 752111L,
-752117L, 752137L, 752149L, 752177L, 752183L, 752189L, 752197L, 752201L, 752203L,
-752207L, 752251L, 752263L, 752273L, 752281L, 752287L, 752291L, 752293L, 752299L,
-752303L, 752351L, 752359L, 752383L, 752413L, 752431L, 752447L, 752449L, 752459L,
-752483L, 752489L, 752503L, 752513L, 752519L, 752527L, 752569L, 752581L, 752593L,
-752603L, 752627L, 752639L, 752651L, 752681L, 752683L, 752699L, 752701L, 752707L,
-752747L, 752771L, 752789L, 752797L, 752803L, 752809L, 752819L, 752821L, 752831L,
-752833L, 752861L, 752867L, 752881L, 752891L, 752903L, 752911L, 752929L, 752933L,
-752977L, 752993L, 753001L, 753007L, 753019L, 753023L, 753031L, 753079L, 753091L,
-753127L, 753133L, 753139L, 753143L, 753161L, 753187L, 753191L, 753197L, 753229L,
-753257L, 753307L, 753329L, 753341L, 753353L, 753367L, 753373L, 753383L, 753409L,
-753421L, 753427L, 753437L, 753439L, 753461L, 753463L, 753497L, 753499L, 753527L,
-753547L, 753569L, 753583L, 753587L, 753589L, 753611L, 753617L, 753619L, 753631L,
-753647L, 753659L, 753677L, 753679L, 753689L, 753691L, 753707L, 753719L, 753721L,
-753737L, 753743L, 753751L, 753773L, 753793L, 753799L, 753803L, 753811L, 753821L,
-753839L, 753847L, 753859L, 753931L, 753937L, 753941L, 753947L, 753959L, 753979L,
-753983L, 754003L, 754027L, 754037L, 754043L, 754057L, 754067L, 754073L, 754081L,
-754093L, 754099L, 754109L, 754111L, 754121L, 754123L, 754133L, 754153L, 754157L,
-754181L, 754183L, 754207L, 754211L, 754217L, 754223L, 754241L, 754249L, 754267L,
-754279L, 754283L, 754289L, 754297L, 754301L, 754333L, 754337L, 754343L, 754367L,
-754373L, 754379L, 754381L, 754399L, 754417L, 754421L, 754427L, 754451L, 754463L,
-754483L, 754489L, 754513L, 754531L, 754549L, 754573L, 754577L, 754583L, 754597L,
-754627L, 754639L, 754651L, 754703L, 754709L, 754711L, 754717L, 754723L, 754739L,
-754751L, 754771L, 754781L, 754811L, 754829L, 754861L, 754877L, 754891L, 754903L,
-754907L, 754921L, 754931L, 754937L, 754939L, 754967L, 754969L, 754973L, 754979L,
-754981L, 754991L, 754993L, 755009L, 755033L, 755057L, 755071L, 755077L, 755081L,
-755087L, 755107L, 755137L, 755143L, 755147L, 755171L, 755173L, 755203L, 755213L,
-755233L, 755239L, 755257L, 755267L, 755273L, 755309L, 755311L, 755317L, 755329L,
-755333L, 755351L, 755357L, 755371L, 755387L, 755393L, 755399L, 755401L, 755413L,
-755437L, 755441L, 755449L, 755473L, 755483L, 755509L, 755539L, 755551L, 755561L,
-755567L, 755569L, 755593L, 755597L, 755617L, 755627L, 755663L, 755681L, 755707L,
-755717L, 755719L, 755737L, 755759L, 755767L, 755771L, 755789L, 755791L, 755809L,
-755813L, 755861L, 755863L, 755869L, 755879L, 755899L, 755903L, 755959L, 755969L,
-755977L, 756011L, 756023L, 756043L, 756053L, 756097L, 756101L, 756127L, 756131L,
-756139L, 756149L, 756167L, 756179L, 756191L, 756199L, 756227L, 756247L, 756251L,
-756253L, 756271L, 756281L, 756289L, 756293L, 756319L, 756323L, 756331L, 756373L,
-756403L, 756419L, 756421L, 756433L, 756443L, 756463L, 756467L, 756527L, 756533L,
-756541L, 756563L, 756571L, 756593L, 756601L, 756607L, 756629L, 756641L, 756649L,
-756667L, 756673L, 756683L, 756689L, 756703L, 756709L, 756719L, 756727L, 756739L,
-756773L, 756799L, 756829L, 756839L, 756853L, 756869L, 756881L, 756887L, 756919L,
-756923L, 756961L, 756967L, 756971L, 757019L, 757039L, 757063L, 757067L, 757109L,
-757111L, 757151L, 757157L, 757171L, 757181L, 757201L, 757241L, 757243L, 757247L,
-757259L, 757271L, 757291L, 757297L, 757307L, 757319L, 757327L, 757331L, 757343L,
-757363L, 757381L, 757387L, 757403L, 757409L, 757417L, 757429L, 757433L, 757457L,
-757481L, 757487L, 757507L, 757513L, 757517L, 757543L, 757553L, 757577L, 757579L,
-757583L, 757607L, 757633L, 757651L, 757661L, 757693L, 757699L, 757709L, 757711L,
-757727L, 757751L, 757753L, 757763L, 757793L, 757807L, 757811L, 757819L, 757829L,
-757879L, 757903L, 757909L, 757927L, 757937L, 757943L, 757951L, 757993L, 757997L,
-758003L, 758029L, 758041L, 758053L, 758071L, 758083L, 758099L, 758101L, 758111L,
-758137L, 758141L, 758159L, 758179L, 758189L, 758201L, 758203L, 758227L, 758231L,
-758237L, 758243L, 758267L, 758269L, 758273L, 758279L, 758299L, 758323L, 758339L,
-758341L, 758357L, 758363L, 758383L, 758393L, 758411L, 758431L, 758441L, 758449L,
-758453L, 758491L, 758501L, 758503L, 758519L, 758521L, 758551L, 758561L, 758573L,
-758579L, 758599L, 758617L, 758629L, 758633L, 758671L, 758687L, 758699L, 758707L,
-758711L, 758713L, 758729L, 758731L, 758741L, 758743L, 758753L, 758767L, 758783L,
-758789L, 758819L, 758827L, 758837L, 758851L, 758867L, 758887L, 758893L, 758899L,
-758929L, 758941L, 758957L, 758963L, 758969L, 758971L, 758987L, 759001L, 759019L,
-759029L, 759037L, 759047L, 759053L, 759089L, 759103L, 759113L, 759131L, 759149L,
-759167L, 759173L, 759179L, 759181L, 759193L, 759223L, 759229L, 759263L, 759287L,
-759293L, 759301L, 759313L, 759329L, 759359L, 759371L, 759377L, 759397L, 759401L,
-759431L, 759433L, 759457L, 759463L, 759467L, 759491L, 759503L, 759523L, 759547L,
-759553L, 759557L, 759559L, 759569L, 759571L, 759581L, 759589L, 759599L, 759617L,
-759623L, 759631L, 759637L, 759641L, 759653L, 759659L, 759673L, 759691L, 759697L,
-759701L, 759709L, 759719L, 759727L, 759739L, 759757L, 759763L, 759797L, 759799L,
-759821L, 759833L, 759881L, 759893L, 759911L, 759923L, 759929L, 759947L, 759953L,
-759959L, 759961L, 759973L, 760007L, 760043L, 760063L, 760079L, 760093L, 760103L,
-760117L, 760129L, 760141L, 760147L, 760153L, 760163L, 760169L, 760183L, 760187L,
-760211L, 760229L, 760231L, 760237L, 760241L, 760261L, 760267L, 760273L, 760289L,
-760297L, 760301L, 760321L, 760343L, 760367L, 760373L, 760411L, 760423L, 760433L,
-760447L, 760453L, 760457L, 760477L, 760489L, 760499L, 760511L, 760519L, 760531L,
-760537L, 760549L, 760553L, 760561L, 760567L, 760579L, 760607L, 760619L, 760621L,
-760637L, 760649L, 760657L, 760693L, 760723L, 760729L, 760759L, 760769L, 760783L,
-760807L, 760813L, 760841L, 760843L, 760847L, 760871L, 760891L, 760897L, 760901L,
-760913L, 760927L, 760933L, 760939L, 760951L, 760961L, 760993L, 760997L, 761003L,
-761009L, 761023L, 761051L, 761069L, 761087L, 761113L, 761119L, 761129L, 761153L,
-761161L, 761177L, 761179L, 761183L, 761203L, 761207L, 761213L, 761227L, 761249L,
-761251L, 761261L, 761263L, 761291L, 761297L, 761347L, 761351L, 761357L, 761363L,
-761377L, 761381L, 761389L, 761393L, 761399L, 761407L, 761417L, 761429L, 761437L,
-761441L, 761443L, 761459L, 761471L, 761477L, 761483L, 761489L, 761521L, 761531L,
-761533L, 761543L, 761561L, 761567L, 761591L, 761597L, 761603L, 761611L, 761623L,
-761633L, 761669L, 761671L, 761681L, 761689L, 761711L, 761713L, 761731L, 761773L,
-761777L, 761779L, 761807L, 761809L, 761833L, 761861L, 761863L, 761869L, 761879L,
-761897L, 761927L, 761939L, 761963L, 761977L, 761983L, 761993L, 762001L, 762007L,
-762017L, 762031L, 762037L, 762049L, 762053L, 762061L, 762101L, 762121L, 762187L,
-762211L, 762227L, 762233L, 762239L, 762241L, 762253L, 762257L, 762277L, 762319L,
-762329L, 762367L, 762371L, 762373L, 762379L, 762389L, 762397L, 762401L, 762407L,
-762409L, 762479L, 762491L, 762499L, 762529L, 762539L, 762547L, 762557L, 762563L,
-762571L, 762577L, 762583L, 762599L, 762647L, 762653L, 762659L, 762667L, 762721L,
-762737L, 762743L, 762761L, 762779L, 762791L, 762809L, 762821L, 762823L, 762847L,
-762871L, 762877L, 762893L, 762899L, 762901L, 762913L, 762917L, 762919L, 762959L,
-762967L, 762973L, 762989L, 763001L, 763013L, 763027L, 763031L, 763039L, 763043L,
-763067L, 763073L, 763093L, 763111L, 763123L, 763141L, 763157L, 763159L, 763183L,
-763201L, 763223L, 763237L, 763261L, 763267L, 763271L, 763303L, 763307L, 763339L,
-763349L, 763369L, 763381L, 763391L, 763403L, 763409L, 763417L, 763423L, 763429L,
-763447L, 763457L, 763471L, 763481L, 763493L, 763513L, 763523L, 763549L, 763559L,
-763573L, 763579L, 763583L, 763597L, 763601L, 763613L, 763619L, 763621L, 763627L,
-763649L, 763663L, 763673L, 763699L, 763739L, 763751L, 763753L, 763757L, 763771L,
-763787L, 763801L, 763811L, 763823L, 763843L, 763859L, 763879L, 763883L, 763897L,
-763901L, 763907L, 763913L, 763921L, 763927L, 763937L, 763943L, 763957L, 763967L,
-763999L, 764003L, 764011L, 764017L, 764021L, 764041L, 764051L, 764053L, 764059L,
-764081L, 764089L, 764111L, 764131L, 764143L, 764149L, 764171L, 764189L, 764209L,
-764233L, 764249L, 764251L, 764261L, 764273L, 764293L, 764317L, 764321L, 764327L,
-764339L, 764341L, 764369L, 764381L, 764399L, 764431L, 764447L, 764459L, 764471L,
-764501L, 764521L, 764539L, 764551L, 764563L, 764587L, 764591L, 764593L, 764611L,
-764623L, 764627L, 764629L, 764657L, 764683L, 764689L, 764717L, 764719L, 764723L,
-764783L, 764789L, 764809L, 764837L, 764839L, 764849L, 764857L, 764887L, 764891L,
-764893L, 764899L, 764903L, 764947L, 764969L, 764971L, 764977L, 764989L, 764993L,
-764999L, 765007L, 765031L, 765041L, 765043L, 765047L, 765059L, 765091L, 765097L,
-765103L, 765109L, 765131L, 765137L, 765139L, 765143L, 765151L, 765169L, 765181L,
-765199L, 765203L, 765209L, 765211L, 765227L, 765229L, 765241L, 765251L, 765257L,
-765283L, 765287L, 765293L, 765307L, 765313L, 765319L, 765329L, 765353L, 765379L,
-765383L, 765389L, 765409L, 765437L, 765439L, 765461L, 765467L, 765487L, 765497L,
-765503L, 765521L, 765533L, 765539L, 765577L, 765581L, 765587L, 765613L, 765619L,
-765623L, 765649L, 765659L, 765673L, 765707L, 765727L, 765749L, 765763L, 765767L,
-765773L, 765781L, 765823L, 765827L, 765847L, 765851L, 765857L, 765859L, 765881L,
-765889L, 765893L, 765899L, 765907L, 765913L, 765931L, 765949L, 765953L, 765971L,
-765983L, 765991L, 766021L, 766039L, 766049L, 766067L, 766079L, 766091L, 766097L,
-766109L, 766111L, 766127L, 766163L, 766169L, 766177L, 766187L, 766211L, 766223L,
-766229L, 766231L, 766237L, 766247L, 766261L, 766273L, 766277L, 766301L, 766313L,
-766321L, 766333L, 766357L, 766361L, 766369L, 766373L, 766387L, 766393L, 766399L,
-766421L, 766439L, 766453L, 766457L, 766471L, 766477L, 766487L, 766501L, 766511L,
-766531L, 766541L, 766543L, 766553L, 766559L, 766583L, 766609L, 766637L, 766639L,
-766651L, 766679L, 766687L, 766721L, 766739L, 766757L, 766763L, 766769L, 766793L,
-766807L, 766811L, 766813L, 766817L, 766861L, 766867L, 766873L, 766877L, 766891L,
-766901L, 766907L, 766937L, 766939L, 766943L, 766957L, 766967L, 766999L, 767017L,
-767029L, 767051L, 767071L, 767089L, 767093L, 767101L, 767111L, 767131L, 767147L,
-767153L, 767161L, 767167L, 767203L, 767243L, 767279L, 767287L, 767293L, 767309L,
-767317L, 767321L, 767323L, 767339L, 767357L, 767359L, 767381L, 767399L, 767423L,
-767443L, 767471L, 767489L, 767509L, 767513L, 767521L, 767527L, 767537L, 767539L,
-767549L, 767551L, 767587L, 767597L, 767603L, 767617L, 767623L, 767633L, 767647L,
-767677L, 767681L, 767707L, 767729L, 767747L, 767749L, 767759L, 767761L, 767773L,
-767783L, 767813L, 767827L, 767831L, 767843L, 767857L, 767863L, 767867L, 767869L,
-767881L, 767909L, 767951L, 767957L, 768013L, 768029L, 768041L, 768049L, 768059L,
-768073L, 768101L, 768107L, 768127L, 768133L, 768139L, 768161L, 768167L, 768169L,
-768191L, 768193L, 768197L, 768199L, 768203L, 768221L, 768241L, 768259L, 768263L,
-768301L, 768319L, 768323L, 768329L, 768343L, 768347L, 768353L, 768359L, 768371L,
-768373L, 768377L, 768389L, 768401L, 768409L, 768419L, 768431L, 768437L, 768457L,
-768461L, 768479L, 768491L, 768503L, 768541L, 768563L, 768571L, 768589L, 768613L,
-768623L, 768629L, 768631L, 768641L, 768643L, 768653L, 768671L, 768727L, 768751L,
-768767L, 768773L, 768787L, 768793L, 768799L, 768811L, 768841L, 768851L, 768853L,
-768857L, 768869L, 768881L, 768923L, 768931L, 768941L, 768953L, 768979L, 768983L,
-769003L, 769007L, 769019L, 769033L, 769039L, 769057L, 769073L, 769081L, 769091L,
-769117L, 769123L, 769147L, 769151L, 769159L, 769169L, 769207L, 769231L, 769243L,
-769247L, 769259L, 769261L, 769273L, 769289L, 769297L, 769309L, 769319L, 769339L,
-769357L, 769387L, 769411L, 769421L, 769423L, 769429L, 769453L, 769459L, 769463L,
-769469L, 769487L, 769541L, 769543L, 769547L, 769553L, 769577L, 769579L, 769589L,
-769591L, 769597L, 769619L, 769627L, 769661L, 769663L, 769673L, 769687L, 769723L,
-769729L, 769733L, 769739L, 769751L, 769781L, 769789L, 769799L, 769807L, 769837L,
-769871L, 769903L, 769919L, 769927L, 769943L, 769961L, 769963L, 769973L, 769987L,
-769997L, 769999L, 770027L, 770039L, 770041L, 770047L, 770053L, 770057L, 770059L,
-770069L, 770101L, 770111L, 770113L, 770123L, 770129L, 770167L, 770177L, 770179L,
-770183L, 770191L, 770207L, 770227L, 770233L, 770239L, 770261L, 770281L, 770291L,
-770309L, 770311L, 770353L, 770359L, 770387L, 770401L, 770417L, 770437L, 770447L,
-770449L, 770459L, 770503L, 770519L, 770527L, 770533L, 770537L, 770551L, 770557L,
-770573L, 770579L, 770587L, 770591L, 770597L, 770611L, 770639L, 770641L, 770647L,
-770657L, 770663L, 770669L, 770741L, 770761L, 770767L, 770771L, 770789L, 770801L,
-770813L, 770837L, 770839L, 770843L, 770863L, 770867L, 770873L, 770881L, 770897L,
-770909L, 770927L, 770929L, 770951L, 770971L, 770981L, 770993L, 771011L, 771013L,
-771019L, 771031L, 771037L, 771047L, 771049L, 771073L, 771079L, 771091L, 771109L,
-771143L, 771163L, 771179L, 771181L, 771209L, 771217L, 771227L, 771233L, 771269L,
-771283L, 771289L, 771293L, 771299L, 771301L, 771349L, 771359L, 771389L, 771401L,
-771403L, 771427L, 771431L, 771437L, 771439L, 771461L, 771473L, 771481L, 771499L,
-771503L, 771509L, 771517L, 771527L, 771553L, 771569L, 771583L, 771587L, 771607L,
-771619L, 771623L, 771629L, 771637L, 771643L, 771653L, 771679L, 771691L, 771697L,
-771703L, 771739L, 771763L, 771769L, 771781L, 771809L, 771853L, 771863L, 771877L,
-771887L, 771889L, 771899L, 771917L, 771937L, 771941L, 771961L, 771971L, 771973L,
-771997L, 772001L, 772003L, 772019L, 772061L, 772073L, 772081L, 772091L, 772097L,
-772127L, 772139L, 772147L, 772159L, 772169L, 772181L, 772207L, 772229L, 772231L,
-772273L, 772279L, 772297L, 772313L, 772333L, 772339L, 772349L, 772367L, 772379L,
-772381L, 772391L, 772393L, 772403L, 772439L, 772441L, 772451L, 772459L, 772477L,
-772493L, 772517L, 772537L, 772567L, 772571L, 772573L, 772591L, 772619L, 772631L,
-772649L, 772657L, 772661L, 772663L, 772669L, 772691L, 772697L, 772703L, 772721L,
-772757L, 772771L, 772789L, 772843L, 772847L, 772853L, 772859L, 772867L, 772903L,
-772907L, 772909L, 772913L, 772921L, 772949L, 772963L, 772987L, 772991L, 773021L,
-773023L, 773027L, 773029L, 773039L, 773057L, 773063L, 773081L, 773083L, 773093L,
-773117L, 773147L, 773153L, 773159L, 773207L, 773209L, 773231L, 773239L, 773249L,
-773251L, 773273L, 773287L, 773299L, 773317L, 773341L, 773363L, 773371L, 773387L,
-773393L, 773407L, 773417L, 773447L, 773453L, 773473L, 773491L, 773497L, 773501L,
-773533L, 773537L, 773561L, 773567L, 773569L, 773579L, 773599L, 773603L, 773609L,
-773611L, 773657L, 773659L, 773681L, 773683L, 773693L, 773713L, 773719L, 773723L,
-773767L, 773777L, 773779L, 773803L, 773821L, 773831L, 773837L, 773849L, 773863L,
-773867L, 773869L, 773879L, 773897L, 773909L, 773933L, 773939L, 773951L, 773953L,
-773987L, 773989L, 773999L, 774001L, 774017L, 774023L, 774047L, 774071L, 774073L,
-774083L, 774107L, 774119L, 774127L, 774131L, 774133L, 774143L, 774149L, 774161L,
-774173L, 774181L, 774199L, 774217L, 774223L, 774229L, 774233L, 774239L, 774283L,
-774289L, 774313L, 774317L, 774337L, 774343L, 774377L, 774427L, 774439L, 774463L,
-774467L, 774491L, 774511L, 774523L, 774541L, 774551L, 774577L, 774583L, 774589L,
-774593L, 774601L, 774629L, 774643L, 774661L, 774667L, 774671L, 774679L, 774691L,
-774703L, 774733L, 774757L, 774773L, 774779L, 774791L, 774797L, 774799L, 774803L,
-774811L, 774821L, 774833L, 774853L, 774857L, 774863L, 774901L, 774919L, 774929L,
-774931L, 774959L, 774997L, 775007L, 775037L, 775043L, 775057L, 775063L, 775079L,
-775087L, 775091L, 775097L, 775121L, 775147L, 775153L, 775157L, 775163L, 775189L,
-775193L, 775237L, 775241L, 775259L, 775267L, 775273L, 775309L, 775343L, 775349L,
-775361L, 775363L, 775367L, 775393L, 775417L, 775441L, 775451L, 775477L, 775507L,
-775513L, 775517L, 775531L, 775553L, 775573L, 775601L, 775603L, 775613L, 775627L,
-775633L, 775639L, 775661L, 775669L, 775681L, 775711L, 775729L, 775739L, 775741L,
-775757L, 775777L, 775787L, 775807L, 775811L, 775823L, 775861L, 775871L, 775889L,
-775919L, 775933L, 775937L, 775939L, 775949L, 775963L, 775987L, 776003L, 776029L,
-776047L, 776057L, 776059L, 776077L, 776099L, 776117L, 776119L, 776137L, 776143L,
-776159L, 776173L, 776177L, 776179L, 776183L, 776201L, 776219L, 776221L, 776233L,
-776249L, 776257L, 776267L, 776287L, 776317L, 776327L, 776357L, 776389L, 776401L,
-776429L, 776449L, 776453L, 776467L, 776471L, 776483L, 776497L, 776507L, 776513L,
-776521L, 776551L, 776557L, 776561L, 776563L, 776569L, 776599L, 776627L, 776651L,
-776683L, 776693L, 776719L, 776729L, 776749L, 776753L, 776759L, 776801L, 776813L,
-776819L, 776837L, 776851L, 776861L, 776869L, 776879L, 776887L, 776899L, 776921L,
-776947L, 776969L, 776977L, 776983L, 776987L, 777001L, 777011L, 777013L, 777031L,
-777041L, 777071L, 777097L, 777103L, 777109L, 777137L, 777143L, 777151L, 777167L,
-777169L, 777173L, 777181L, 777187L, 777191L, 777199L, 777209L, 777221L, 777241L,
-777247L, 777251L, 777269L, 777277L, 777313L, 777317L, 777349L, 777353L, 777373L,
-777383L, 777389L, 777391L, 777419L, 777421L, 777431L, 777433L, 777437L, 777451L,
-777463L, 777473L, 777479L, 777541L, 777551L, 777571L, 777583L, 777589L, 777617L,
-777619L, 777641L, 777643L, 777661L, 777671L, 777677L, 777683L, 777731L, 777737L,
-777743L, 777761L, 777769L, 777781L, 777787L, 777817L, 777839L, 777857L, 777859L,
-777863L, 777871L, 777877L, 777901L, 777911L, 777919L, 777977L, 777979L, 777989L,
-778013L, 778027L, 778049L, 778051L, 778061L, 778079L, 778081L, 778091L, 778097L,
-778109L, 778111L, 778121L, 778123L, 778153L, 778163L, 778187L, 778201L, 778213L,
-778223L, 778237L, 778241L, 778247L, 778301L, 778307L, 778313L, 778319L, 778333L,
-778357L, 778361L, 778363L, 778391L, 778397L, 778403L, 778409L, 778417L, 778439L,
-778469L, 778507L, 778511L, 778513L, 778523L, 778529L, 778537L, 778541L, 778553L,
-778559L, 778567L, 778579L, 778597L, 778633L, 778643L, 778663L, 778667L, 778681L,
-778693L, 778697L, 778699L, 778709L, 778717L, 778727L, 778733L, 778759L, 778763L,
-778769L, 778777L, 778793L, 778819L, 778831L, 778847L, 778871L, 778873L, 778879L,
-778903L, 778907L, 778913L, 778927L, 778933L, 778951L, 778963L, 778979L, 778993L,
-779003L, 779011L, 779021L, 779039L, 779063L, 779069L, 779081L, 779101L, 779111L,
-779131L, 779137L, 779159L, 779173L, 779189L, 779221L, 779231L, 779239L, 779249L,
-779267L, 779327L, 779329L, 779341L, 779347L, 779351L, 779353L, 779357L, 779377L,
-779413L, 779477L, 779489L, 779507L, 779521L, 779531L, 779543L, 779561L, 779563L,
-779573L, 779579L, 779591L, 779593L, 779599L, 779609L, 779617L, 779621L, 779657L,
-779659L, 779663L, 779693L, 779699L, 779707L, 779731L, 779747L, 779749L, 779761L,
-779767L, 779771L, 779791L, 779797L, 779827L, 779837L, 779869L, 779873L, 779879L,
-779887L, 779899L, 779927L, 779939L, 779971L, 779981L, 779983L, 779993L, 780029L,
-780037L, 780041L, 780047L, 780049L, 780061L, 780119L, 780127L, 780163L, 780173L,
-780179L, 780191L, 780193L, 780211L, 780223L, 780233L, 780253L, 780257L, 780287L,
-780323L, 780343L, 780347L, 780371L, 780379L, 780383L, 780389L, 780397L, 780401L,
-780421L, 780433L, 780457L, 780469L, 780499L, 780523L, 780553L, 780583L, 780587L,
-780601L, 780613L, 780631L, 780649L, 780667L, 780671L, 780679L, 780683L, 780697L,
-780707L, 780719L, 780721L, 780733L, 780799L, 780803L, 780809L, 780817L, 780823L,
-780833L, 780841L, 780851L, 780853L, 780869L, 780877L, 780887L, 780889L, 780917L,
-780931L, 780953L, 780961L, 780971L, 780973L, 780991L, 781003L, 781007L, 781021L,
-781043L, 781051L, 781063L, 781069L, 781087L, 781111L, 781117L, 781127L, 781129L,
-781139L, 781163L, 781171L, 781199L, 781211L, 781217L, 781229L, 781243L, 781247L,
-781271L, 781283L, 781301L, 781307L, 781309L, 781321L, 781327L, 781351L, 781357L,
-781367L, 781369L, 781387L, 781397L, 781399L, 781409L, 781423L, 781427L, 781433L,
-781453L, 781481L, 781483L, 781493L, 781511L, 781513L, 781519L, 781523L, 781531L,
-781559L, 781567L, 781589L, 781601L, 781607L, 781619L, 781631L, 781633L, 781661L,
-781673L, 781681L, 781721L, 781733L, 781741L, 781771L, 781799L, 781801L, 781817L,
-781819L, 781853L, 781861L, 781867L, 781883L, 781889L, 781897L, 781919L, 781951L,
-781961L, 781967L, 781969L, 781973L, 781987L, 781997L, 781999L, 782003L, 782009L,
-782011L, 782053L, 782057L, 782071L, 782083L, 782087L, 782107L, 782113L, 782123L,
-782129L, 782137L, 782141L, 782147L, 782149L, 782183L, 782189L, 782191L, 782209L,
-782219L, 782231L, 782251L, 782263L, 782267L, 782297L, 782311L, 782329L, 782339L,
-782371L, 782381L, 782387L, 782389L, 782393L, 782429L, 782443L, 782461L, 782473L,
-782489L, 782497L, 782501L, 782519L, 782539L, 782581L, 782611L, 782641L, 782659L,
-782669L, 782671L, 782687L, 782689L, 782707L, 782711L, 782723L, 782777L, 782783L,
-782791L, 782839L, 782849L, 782861L, 782891L, 782911L, 782921L, 782941L, 782963L,
-782981L, 782983L, 782993L, 783007L, 783011L, 783019L, 783023L, 783043L, 783077L,
-783089L, 783119L, 783121L, 783131L, 783137L, 783143L, 783149L, 783151L, 783191L,
-783193L, 783197L, 783227L, 783247L, 783257L, 783259L, 783269L, 783283L, 783317L,
-783323L, 783329L, 783337L, 783359L, 783361L, 783373L, 783379L, 783407L, 783413L,
-783421L, 783473L, 783487L, 783527L, 783529L, 783533L, 783553L, 783557L, 783569L,
-783571L, 783599L, 783613L, 783619L, 783641L, 783647L, 783661L, 783677L, 783689L,
-783691L, 783701L, 783703L, 783707L, 783719L, 783721L, 783733L, 783737L, 783743L,
-783749L, 783763L, 783767L, 783779L, 783781L, 783787L, 783791L, 783793L, 783799L,
-783803L, 783829L, 783869L, 783877L, 783931L, 783953L, 784009L, 784039L, 784061L,
-784081L, 784087L, 784097L, 784103L, 784109L, 784117L, 784129L, 784153L, 784171L,
-784181L, 784183L, 784211L, 784213L, 784219L, 784229L, 784243L, 784249L, 784283L,
-784307L, 784309L, 784313L, 784321L, 784327L, 784349L, 784351L, 784367L, 784373L,
-784379L, 784387L, 784409L, 784411L, 784423L, 784447L, 784451L, 784457L, 784463L,
-784471L, 784481L, 784489L, 784501L, 784513L, 784541L, 784543L, 784547L, 784561L,
-784573L, 784577L, 784583L, 784603L, 784627L, 784649L, 784661L, 784687L, 784697L,
-784717L, 784723L, 784727L, 784753L, 784789L, 784799L, 784831L, 784837L, 784841L,
-784859L, 784867L, 784897L, 784913L, 784919L, 784939L, 784957L, 784961L, 784981L,
-785003L, 785017L, 785033L, 785053L, 785093L, 785101L, 785107L, 785119L, 785123L,
-785129L, 785143L, 785153L, 785159L, 785167L, 785203L, 785207L, 785219L, 785221L,
-785227L, 785249L, 785269L, 785287L, 785293L, 785299L, 785303L, 785311L, 785321L,
-785329L, 785333L, 785341L, 785347L, 785353L, 785357L, 785363L, 785377L, 785413L,
-785423L, 785431L, 785459L, 785461L, 785483L, 785501L, 785503L, 785527L, 785537L,
-785549L, 785569L, 785573L, 785579L, 785591L, 785597L, 785623L, 785627L, 785641L,
-785651L, 785671L, 785693L, 785717L, 785731L, 785737L, 785753L, 785773L, 785777L,
-785779L, 785801L, 785803L, 785809L, 785839L, 785857L, 785861L, 785879L, 785903L,
-785921L, 785923L, 785947L, 785951L, 785963L, 786001L, 786013L, 786017L, 786031L,
-786047L, 786053L, 786059L, 786061L, 786077L, 786109L, 786127L, 786151L, 786167L,
-786173L, 786179L, 786197L, 786211L, 786223L, 786241L, 786251L, 786271L, 786307L,
-786311L, 786319L, 786329L, 786337L, 786349L, 786371L, 786407L, 786419L, 786431L,
-786433L, 786449L, 786469L, 786491L, 786547L, 786551L, 786553L, 786587L, 786589L,
-786613L, 786629L, 786659L, 786661L, 786673L, 786691L, 786697L, 786701L, 786703L,
-786707L, 786719L, 786739L, 786763L, 786803L, 786823L, 786829L, 786833L, 786859L,
-786881L, 786887L, 786889L, 786901L, 786931L, 786937L, 786941L, 786949L, 786959L,
-786971L, 786979L, 786983L, 787021L, 787043L, 787051L, 787057L, 787067L, 787069L,
-787079L, 787091L, 787099L, 787123L, 787139L, 787153L, 787181L, 787187L, 787207L,
-787217L, 787243L, 787261L, 787277L, 787289L, 787309L, 787331L, 787333L, 787337L,
-787357L, 787361L, 787427L, 787429L, 787433L, 787439L, 787447L, 787469L, 787477L,
-787483L, 787489L, 787513L, 787517L, 787519L, 787529L, 787537L, 787541L, 787547L,
-787573L, 787601L, 787609L, 787621L, 787639L, 787649L, 787667L, 787697L, 787711L,
-787747L, 787751L, 787757L, 787769L, 787771L, 787777L, 787783L, 787793L, 787807L,
-787811L, 787817L, 787823L, 787837L, 787879L, 787883L, 787903L, 787907L, 787939L,
-787973L, 787981L, 787993L, 787999L, 788009L, 788023L, 788027L, 788033L, 788041L,
-788071L, 788077L, 788087L, 788089L, 788093L, 788107L, 788129L, 788153L, 788159L,
-788167L, 788173L, 788189L, 788209L, 788213L, 788231L, 788261L, 788267L, 788287L,
-788309L, 788317L, 788321L, 788351L, 788353L, 788357L, 788363L, 788369L, 788377L,
-788383L, 788387L, 788393L, 788399L, 788413L, 788419L, 788429L, 788449L, 788467L,
-788479L, 788497L, 788521L, 788527L, 788531L, 788537L, 788549L, 788561L, 788563L,
-788569L, 788603L, 788621L, 788651L, 788659L, 788677L, 788687L, 788701L, 788719L,
-788761L, 788779L, 788789L, 788813L, 788819L, 788849L, 788863L, 788867L, 788869L,
-788873L, 788891L, 788897L, 788903L, 788927L, 788933L, 788941L, 788947L, 788959L,
-788971L, 788993L, 788999L, 789001L, 789017L, 789029L, 789031L, 789067L, 789077L,
-789091L, 789097L, 789101L, 789109L, 789121L, 789133L, 789137L, 789149L, 789169L,
-789181L, 789221L, 789227L, 789251L, 789311L, 789323L, 789331L, 789343L, 789367L,
-789377L, 789389L, 789391L, 789407L, 789419L, 789443L, 789473L, 789491L, 789493L,
-789511L, 789527L, 789533L, 789557L, 789571L, 789577L, 789587L, 789589L, 789611L,
-789623L, 789631L, 789653L, 789671L, 789673L, 789683L, 789689L, 789709L, 789713L,
-789721L, 789731L, 789739L, 789749L, 789793L, 789823L, 789829L, 789847L, 789851L,
-789857L, 789883L, 789941L, 789959L, 789961L, 789967L, 789977L, 789979L, 790003L,
-790021L, 790033L, 790043L, 790051L, 790057L, 790063L, 790087L, 790093L, 790099L,
-790121L, 790169L, 790171L, 790189L, 790199L, 790201L, 790219L, 790241L, 790261L,
-790271L, 790277L, 790289L, 790291L, 790327L, 790331L, 790333L, 790351L, 790369L,
-790379L, 790397L, 790403L, 790417L, 790421L, 790429L, 790451L, 790459L, 790481L,
-790501L, 790513L, 790519L, 790523L, 790529L, 790547L, 790567L, 790583L, 790589L,
-790607L, 790613L, 790633L, 790637L, 790649L, 790651L, 790693L, 790697L, 790703L,
-790709L, 790733L, 790739L, 790747L, 790753L, 790781L, 790793L, 790817L, 790819L,
-790831L, 790843L, 790861L, 790871L, 790879L, 790883L, 790897L, 790927L, 790957L,
-790961L, 790967L, 790969L, 790991L, 790997L, 791003L, 791009L, 791017L, 791029L,
-791047L, 791053L, 791081L, 791093L, 791099L, 791111L, 791117L, 791137L, 791159L,
-791191L, 791201L, 791209L, 791227L, 791233L, 791251L, 791257L, 791261L, 791291L,
-791309L, 791311L, 791317L, 791321L, 791347L, 791363L, 791377L, 791387L, 791411L,
-791419L, 791431L, 791443L, 791447L, 791473L, 791489L, 791519L, 791543L, 791561L,
-791563L, 791569L, 791573L, 791599L, 791627L, 791629L, 791657L, 791663L, 791677L,
-791699L, 791773L, 791783L, 791789L, 791797L, 791801L, 791803L, 791827L, 791849L,
-791851L, 791887L, 791891L, 791897L, 791899L, 791909L, 791927L, 791929L, 791933L,
-791951L, 791969L, 791971L, 791993L, 792023L, 792031L, 792037L, 792041L, 792049L,
-792061L, 792067L, 792073L, 792101L, 792107L, 792109L, 792119L, 792131L, 792151L,
-792163L, 792179L, 792223L, 792227L, 792229L, 792241L, 792247L, 792257L, 792263L,
-792277L, 792283L, 792293L, 792299L, 792301L, 792307L, 792317L, 792359L, 792371L,
-792377L, 792383L, 792397L, 792413L, 792443L, 792461L, 792479L, 792481L, 792487L,
-792521L, 792529L, 792551L, 792553L, 792559L, 792563L, 792581L, 792593L, 792601L,
-792613L, 792629L, 792637L, 792641L, 792643L, 792647L, 792667L, 792679L, 792689L,
-792691L, 792697L, 792703L, 792709L, 792713L, 792731L, 792751L, 792769L, 792793L,
-792797L, 792821L, 792871L, 792881L, 792893L, 792907L, 792919L, 792929L, 792941L,
-792959L, 792973L, 792983L, 792989L, 792991L, 793043L, 793069L, 793099L, 793103L,
-793123L, 793129L, 793139L, 793159L, 793181L, 793187L, 793189L, 793207L, 793229L,
-793253L, 793279L, 793297L, 793301L, 793327L, 793333L, 793337L, 793343L, 793379L,
-793399L, 793439L, 793447L, 793453L, 793487L, 793489L, 793493L, 793511L, 793517L,
-793519L, 793537L, 793547L, 793553L, 793561L, 793591L, 793601L, 793607L, 793621L,
-793627L, 793633L, 793669L, 793673L, 793691L, 793699L, 793711L, 793717L, 793721L,
-793733L, 793739L, 793757L, 793769L, 793777L, 793787L, 793789L, 793813L, 793841L,
-793843L, 793853L, 793867L, 793889L, 793901L, 793927L, 793931L, 793939L, 793957L,
-793967L, 793979L, 793981L, 793999L, 794009L, 794011L, 794023L, 794033L, 794039L,
-794041L, 794063L, 794071L, 794077L, 794089L, 794111L, 794113L, 794119L, 794137L,
-794141L, 794149L, 794153L, 794161L, 794173L, 794179L, 794191L, 794201L, 794203L,
-794207L, 794221L, 794231L, 794239L, 794249L, 794327L, 794341L, 794363L, 794383L,
-794389L, 794399L, 794407L, 794413L, 794449L, 794471L, 794473L, 794477L, 794483L,
-794491L, 794509L, 794531L, 794537L, 794543L, 794551L, 794557L, 794569L, 794579L,
-794587L, 794593L, 794641L, 794653L, 794657L, 794659L, 794669L, 794693L, 794711L,
-794741L, 794743L, 794749L, 794779L, 794831L, 794879L, 794881L, 794887L, 794921L,
-794923L, 794953L, 794957L, 794993L, 794999L, 795001L, 795007L, 795023L, 795071L,
-795077L, 795079L, 795083L, 795097L, 795101L, 795103L, 795121L, 795127L, 795139L,
-795149L, 795161L, 795187L, 795203L, 795211L, 795217L, 795233L, 795239L, 795251L,
-795253L, 795299L, 795307L, 795323L, 795329L, 795337L, 795343L, 795349L, 795427L,
-795449L, 795461L, 795467L, 795479L, 795493L, 795503L, 795517L, 795527L, 795533L,
-795539L, 795551L, 795581L, 795589L, 795601L, 795643L, 795647L, 795649L, 795653L,
-795659L, 795661L, 795667L, 795679L, 795703L, 795709L, 795713L, 795727L, 795737L,
-795761L, 795763L, 795791L, 795793L, 795797L, 795799L, 795803L, 795827L, 795829L,
-795871L, 795877L, 795913L, 795917L, 795931L, 795937L, 795941L, 795943L, 795947L,
-795979L, 795983L, 795997L, 796001L, 796009L, 796063L, 796067L, 796091L, 796121L,
-796139L, 796141L, 796151L, 796171L, 796177L, 796181L, 796189L, 796193L, 796217L,
-796247L, 796259L, 796267L, 796291L, 796303L, 796307L, 796337L, 796339L, 796361L,
-796363L, 796373L, 796379L, 796387L, 796391L, 796409L, 796447L, 796451L, 796459L,
-796487L, 796493L, 796517L, 796531L, 796541L, 796553L, 796561L, 796567L, 796571L,
-796583L, 796591L, 796619L, 796633L, 796657L, 796673L, 796687L, 796693L, 796699L,
-796709L, 796711L, 796751L, 796759L, 796769L, 796777L, 796781L, 796799L, 796801L,
-796813L, 796819L, 796847L, 796849L, 796853L, 796867L, 796871L, 796877L, 796889L,
-796921L, 796931L, 796933L, 796937L, 796951L, 796967L, 796969L, 796981L, 797003L,
-797009L, 797021L, 797029L, 797033L, 797039L, 797051L, 797053L, 797057L, 797063L,
-797077L, 797119L, 797131L, 797143L, 797161L, 797171L, 797201L, 797207L, 797273L,
-797281L, 797287L, 797309L, 797311L, 797333L, 797353L, 797359L, 797383L, 797389L,
-797399L, 797417L, 797429L, 797473L, 797497L, 797507L, 797509L, 797539L, 797549L,
-797551L, 797557L, 797561L, 797567L, 797569L, 797579L, 797581L, 797591L, 797593L,
-797611L, 797627L, 797633L, 797647L, 797681L, 797689L, 797701L, 797711L, 797729L,
-797743L, 797747L, 797767L, 797773L, 797813L, 797833L, 797851L, 797869L, 797887L,
-797897L, 797911L, 797917L, 797933L, 797947L, 797957L, 797977L, 797987L, 798023L,
-798043L, 798059L, 798067L, 798071L, 798079L, 798089L, 798097L, 798101L, 798121L,
-798131L, 798139L, 798143L, 798151L, 798173L, 798179L, 798191L, 798197L, 798199L,
-798221L, 798223L, 798227L, 798251L, 798257L, 798263L, 798271L, 798293L, 798319L,
-798331L, 798373L, 798383L, 798397L, 798403L, 798409L, 798443L, 798451L, 798461L,
-798481L, 798487L, 798503L, 798517L, 798521L, 798527L, 798533L, 798569L, 798599L,
-798613L, 798641L, 798647L, 798649L, 798667L, 798691L, 798697L, 798701L, 798713L,
-798727L, 798737L, 798751L, 798757L, 798773L, 798781L, 798799L, 798823L, 798871L,
-798887L, 798911L, 798923L, 798929L, 798937L, 798943L, 798961L, 799003L, 799021L,
-799031L, 799061L, 799063L, 799091L, 799093L, 799103L, 799147L, 799151L, 799171L,
-799217L, 799219L, 799223L, 799259L, 799291L, 799301L, 799303L, 799307L, 799313L,
-799333L, 799343L, 799361L, 799363L, 799369L, 799417L, 799427L, 799441L, 799453L,
-799471L, 799481L, 799483L, 799489L, 799507L, 799523L, 799529L, 799543L, 799553L,
-799573L, 799609L, 799613L, 799619L, 799621L, 799633L, 799637L, 799651L, 799657L,
-799661L, 799679L, 799723L, 799727L, 799739L, 799741L, 799753L, 799759L, 799789L,
-799801L, 799807L, 799817L, 799837L, 799853L, 799859L, 799873L, 799891L, 799921L,
-799949L, 799961L, 799979L, 799991L, 799993L, 799999L, 800011L, 800029L, 800053L,
-800057L, 800077L, 800083L, 800089L, 800113L, 800117L, 800119L, 800123L, 800131L,
-800143L, 800159L, 800161L, 800171L, 800209L, 800213L, 800221L, 800231L, 800237L,
-800243L, 800281L, 800287L, 800291L, 800311L, 800329L, 800333L, 800351L, 800357L,
-800399L, 800407L, 800417L, 800419L, 800441L, 800447L, 800473L, 800477L, 800483L,
-800497L, 800509L, 800519L, 800521L, 800533L, 800537L, 800539L, 800549L, 800557L,
-800573L, 800587L, 800593L, 800599L, 800621L, 800623L, 800647L, 800651L, 800659L,
-800663L, 800669L, 800677L, 800687L, 800693L, 800707L, 800711L, 800729L, 800731L,
-800741L, 800743L, 800759L, 800773L, 800783L, 800801L, 800861L, 800873L, 800879L,
-800897L, 800903L, 800909L, 800923L, 800953L, 800959L, 800971L, 800977L, 800993L,
-800999L, 801001L, 801007L, 801011L, 801019L, 801037L, 801061L, 801077L, 801079L,
-801103L, 801107L, 801127L, 801137L, 801179L, 801187L, 801197L, 801217L, 801247L,
-801277L, 801289L, 801293L, 801301L, 801331L, 801337L, 801341L, 801349L, 801371L,
-801379L, 801403L, 801407L, 801419L, 801421L, 801461L, 801469L, 801487L, 801503L,
-801517L, 801539L, 801551L, 801557L, 801569L, 801571L, 801607L, 801611L, 801617L,
-801631L, 801641L, 801677L, 801683L, 801701L, 801707L, 801709L, 801733L, 801761L,
-801791L, 801809L, 801811L, 801817L, 801833L, 801841L, 801859L, 801883L, 801947L,
-801949L, 801959L, 801973L, 801989L, 802007L, 802019L, 802027L, 802031L, 802037L,
-802073L, 802103L, 802121L, 802127L, 802129L, 802133L, 802141L, 802147L, 802159L,
-802163L, 802177L, 802181L, 802183L, 802189L, 802231L, 802253L, 802279L, 802283L,
-802297L, 802331L, 802339L, 802357L, 802387L, 802421L, 802441L, 802453L, 802463L,
-802471L, 802499L, 802511L, 802523L, 802531L, 802573L, 802583L, 802589L, 802597L,
-802603L, 802609L, 802643L, 802649L, 802651L, 802661L, 802667L, 802709L, 802721L,
-802729L, 802733L, 802751L, 802759L, 802777L, 802783L, 802787L, 802793L, 802799L,
-802811L, 802829L, 802831L, 802873L, 802909L, 802913L, 802933L, 802951L, 802969L,
-802979L, 802987L, 803027L, 803041L, 803053L, 803057L, 803059L, 803087L, 803093L,
-803119L, 803141L, 803171L, 803189L, 803207L, 803227L, 803237L, 803251L, 803269L,
-803273L, 803287L, 803311L, 803323L, 803333L, 803347L, 803359L, 803389L, 803393L,
-803399L, 803417L, 803441L, 803443L, 803447L, 803449L, 803461L, 803479L, 803483L,
-803497L, 803501L, 803513L, 803519L, 803549L, 803587L, 803591L, 803609L, 803611L,
-803623L, 803629L, 803651L, 803659L, 803669L, 803687L, 803717L, 803729L, 803731L,
-803741L, 803749L, 803813L, 803819L, 803849L, 803857L, 803867L, 803893L, 803897L,
-803911L, 803921L, 803927L, 803939L, 803963L, 803977L, 803987L, 803989L, 804007L,
-804017L, 804031L, 804043L, 804059L, 804073L, 804077L, 804091L, 804107L, 804113L,
-804119L, 804127L, 804157L, 804161L, 804179L, 804191L, 804197L, 804203L, 804211L,
-804239L, 804259L, 804281L, 804283L, 804313L, 804317L, 804329L, 804337L, 804341L,
-804367L, 804371L, 804383L, 804409L, 804443L, 804449L, 804473L, 804493L, 804497L,
-804511L, 804521L, 804523L, 804541L, 804553L, 804571L, 804577L, 804581L, 804589L,
-804607L, 804611L, 804613L, 804619L, 804653L, 804689L, 804697L, 804703L, 804709L,
-804743L, 804751L, 804757L, 804761L, 804767L, 804803L, 804823L, 804829L, 804833L,
-804847L, 804857L, 804877L, 804889L, 804893L, 804901L, 804913L, 804919L, 804929L,
-804941L, 804943L, 804983L, 804989L, 804997L, 805019L, 805027L, 805031L, 805033L,
-805037L, 805061L, 805067L, 805073L, 805081L, 805097L, 805099L, 805109L, 805111L,
-805121L, 805153L, 805159L, 805177L, 805187L, 805213L, 805219L, 805223L, 805241L,
-805249L, 805267L, 805271L, 805279L, 805289L, 805297L, 805309L, 805313L, 805327L,
-805331L, 805333L, 805339L, 805369L, 805381L, 805397L, 805403L, 805421L, 805451L,
-805463L, 805471L, 805487L, 805499L, 805501L, 805507L, 805517L, 805523L, 805531L,
-805537L, 805559L, 805573L, 805583L, 805589L, 805633L, 805639L, 805687L, 805703L,
-805711L, 805723L, 805729L, 805741L, 805757L, 805789L, 805799L, 805807L, 805811L,
-805843L, 805853L, 805859L, 805867L, 805873L, 805877L, 805891L, 805901L, 805913L,
-805933L, 805967L, 805991L, 806009L, 806011L, 806017L, 806023L, 806027L, 806033L,
-806041L, 806051L, 806059L, 806087L, 806107L, 806111L, 806129L, 806137L, 806153L,
-806159L, 806177L, 806203L, 806213L, 806233L, 806257L, 806261L, 806263L, 806269L,
-806291L, 806297L, 806317L, 806329L, 806363L, 806369L, 806371L, 806381L, 806383L,
-806389L, 806447L, 806453L, 806467L, 806483L, 806503L, 806513L, 806521L, 806543L,
-806549L, 806579L, 806581L, 806609L, 806639L, 806657L, 806671L, 806719L, 806737L,
-806761L, 806783L, 806789L, 806791L, 806801L, 806807L, 806821L, 806857L, 806893L,
-806903L, 806917L, 806929L, 806941L, 806947L, 806951L, 806977L, 806999L, 807011L,
-807017L, 807071L, 807077L, 807083L, 807089L, 807097L, 807113L, 807119L, 807127L,
-807151L, 807181L, 807187L, 807193L, 807197L, 807203L, 807217L, 807221L, 807241L,
-807251L, 807259L, 807281L, 807299L, 807337L, 807371L, 807379L, 807383L, 807403L,
-807407L, 807409L, 807419L, 807427L, 807463L, 807473L, 807479L, 807487L, 807491L,
-807493L, 807509L, 807511L, 807523L, 807539L, 807559L, 807571L, 807607L, 807613L,
-807629L, 807637L, 807647L, 807689L, 807707L, 807731L, 807733L, 807749L, 807757L,
-807787L, 807797L, 807809L, 807817L, 807869L, 807871L, 807901L, 807907L, 807923L,
-807931L, 807941L, 807943L, 807949L, 807973L, 807997L, 808019L, 808021L, 808039L,
-808081L, 808097L, 808111L, 808147L, 808153L, 808169L, 808177L, 808187L, 808211L,
-808217L, 808229L, 808237L, 808261L, 808267L, 808307L, 808309L, 808343L, 808349L,
-808351L, 808361L, 808363L, 808369L, 808373L, 808391L, 808399L, 808417L, 808421L,
-808439L, 808441L, 808459L, 808481L, 808517L, 808523L, 808553L, 808559L, 808579L,
-808589L, 808597L, 808601L, 808603L, 808627L, 808637L, 808651L, 808679L, 808681L,
-808693L, 808699L, 808721L, 808733L, 808739L, 808747L, 808751L, 808771L, 808777L,
-808789L, 808793L, 808837L, 808853L, 808867L, 808919L, 808937L, 808957L, 808961L,
-808981L, 808991L, 808993L, 809023L, 809041L, 809051L, 809063L, 809087L, 809093L,
-809101L, 809141L, 809143L, 809147L, 809173L, 809177L, 809189L, 809201L, 809203L,
-809213L, 809231L, 809239L, 809243L, 809261L, 809269L, 809273L, 809297L, 809309L,
-809323L, 809339L, 809357L, 809359L, 809377L, 809383L, 809399L, 809401L, 809407L,
-809423L, 809437L, 809443L, 809447L, 809453L, 809461L, 809491L, 809507L, 809521L,
-809527L, 809563L, 809569L, 809579L, 809581L, 809587L, 809603L, 809629L, 809701L,
-809707L, 809719L, 809729L, 809737L, 809741L, 809747L, 809749L, 809759L, 809771L,
-809779L, 809797L, 809801L, 809803L, 809821L, 809827L, 809833L, 809839L, 809843L,
-809869L, 809891L, 809903L, 809909L, 809917L, 809929L, 809981L, 809983L, 809993L,
-810013L, 810023L, 810049L, 810053L, 810059L, 810071L, 810079L, 810091L, 810109L,
-810137L, 810149L, 810151L, 810191L, 810193L, 810209L, 810223L, 810239L, 810253L,
-810259L, 810269L, 810281L, 810307L, 810319L, 810343L, 810349L, 810353L, 810361L,
-810367L, 810377L, 810379L, 810389L, 810391L, 810401L, 810409L, 810419L, 810427L,
-810437L, 810443L, 810457L, 810473L, 810487L, 810493L, 810503L, 810517L, 810533L,
-810539L, 810541L, 810547L, 810553L, 810571L, 810581L, 810583L, 810587L, 810643L,
-810653L, 810659L, 810671L, 810697L, 810737L, 810757L, 810763L, 810769L, 810791L,
-810809L, 810839L, 810853L, 810871L, 810881L, 810893L, 810907L, 810913L, 810923L,
-810941L, 810949L, 810961L, 810967L, 810973L, 810989L, 811037L, 811039L, 811067L,
-811081L, 811099L, 811123L, 811127L, 811147L, 811157L, 811163L, 811171L, 811183L,
-811193L, 811199L, 811207L, 811231L, 811241L, 811253L, 811259L, 811273L, 811277L,
-811289L, 811297L, 811337L, 811351L, 811379L, 811387L, 811411L, 811429L, 811441L,
-811457L, 811469L, 811493L, 811501L, 811511L, 811519L, 811523L, 811553L, 811561L,
-811583L, 811607L, 811619L, 811627L, 811637L, 811649L, 811651L, 811667L, 811691L,
-811697L, 811703L, 811709L, 811729L, 811747L, 811753L, 811757L, 811763L, 811771L,
-811777L, 811799L, 811819L, 811861L, 811871L, 811879L, 811897L, 811919L, 811931L,
-811933L, 811957L, 811961L, 811981L, 811991L, 811997L, 812011L, 812033L, 812047L,
-812051L, 812057L, 812081L, 812101L, 812129L, 812137L, 812167L, 812173L, 812179L,
-812183L, 812191L, 812213L, 812221L, 812233L, 812249L, 812257L, 812267L, 812281L,
-812297L, 812299L, 812309L, 812341L, 812347L, 812351L, 812353L, 812359L, 812363L,
-812381L, 812387L, 812393L, 812401L, 812431L, 812443L, 812467L, 812473L, 812477L,
-812491L, 812501L, 812503L, 812519L, 812527L, 812587L, 812597L, 812599L, 812627L,
-812633L, 812639L, 812641L, 812671L, 812681L, 812689L, 812699L, 812701L, 812711L,
-812717L, 812731L, 812759L, 812761L, 812807L, 812849L, 812857L, 812869L, 812921L,
-812939L, 812963L, 812969L, 813013L, 813017L, 813023L, 813041L, 813049L, 813061L,
-813083L, 813089L, 813091L, 813097L, 813107L, 813121L, 813133L, 813157L, 813167L,
-813199L, 813203L, 813209L, 813217L, 813221L, 813227L, 813251L, 813269L, 813277L,
-813283L, 813287L, 813299L, 813301L, 813311L, 813343L, 813361L, 813367L, 813377L,
-813383L, 813401L, 813419L, 813427L, 813443L, 813493L, 813499L, 813503L, 813511L,
-813529L, 813541L, 813559L, 813577L, 813583L, 813601L, 813613L, 813623L, 813647L,
-813677L, 813697L, 813707L, 813721L, 813749L, 813767L, 813797L, 813811L, 813817L,
-813829L, 813833L, 813847L, 813863L, 813871L, 813893L, 813907L, 813931L, 813961L,
-813971L, 813991L, 813997L, 814003L, 814007L, 814013L, 814019L, 814031L, 814043L,
-814049L, 814061L, 814063L, 814067L, 814069L, 814081L, 814097L, 814127L, 814129L,
-814139L, 814171L, 814183L, 814193L, 814199L, 814211L, 814213L, 814237L, 814241L,
-814243L, 814279L, 814309L, 814327L, 814337L, 814367L, 814379L, 814381L, 814393L,
-814399L, 814403L, 814423L, 814447L, 814469L, 814477L, 814493L, 814501L, 814531L,
-814537L, 814543L, 814559L, 814577L, 814579L, 814601L, 814603L, 814609L, 814631L,
-814633L, 814643L, 814687L, 814699L, 814717L, 814741L, 814747L, 814763L, 814771L,
-814783L, 814789L, 814799L, 814823L, 814829L, 814841L, 814859L, 814873L, 814883L,
-814889L, 814901L, 814903L, 814927L, 814937L, 814939L, 814943L, 814949L, 814991L,
-815029L, 815033L, 815047L, 815053L, 815063L, 815123L, 815141L, 815149L, 815159L,
-815173L, 815197L, 815209L, 815231L, 815251L, 815257L, 815261L, 815273L, 815279L,
-815291L, 815317L, 815333L, 815341L, 815351L, 815389L, 815401L, 815411L, 815413L,
-815417L, 815431L, 815453L, 815459L, 815471L, 815491L, 815501L, 815519L, 815527L,
-815533L, 815539L, 815543L, 815569L, 815587L, 815599L, 815621L, 815623L, 815627L,
-815653L, 815663L, 815669L, 815671L, 815681L, 815687L, 815693L, 815713L, 815729L,
-815809L, 815819L, 815821L, 815831L, 815851L, 815869L, 815891L, 815897L, 815923L,
-815933L, 815939L, 815953L, 815963L, 815977L, 815989L, 816019L, 816037L, 816043L,
-816047L, 816077L, 816091L, 816103L, 816113L, 816121L, 816131L, 816133L, 816157L,
-816161L, 816163L, 816169L, 816191L, 816203L, 816209L, 816217L, 816223L, 816227L,
-816239L, 816251L, 816271L, 816317L, 816329L, 816341L, 816353L, 816367L, 816377L,
-816401L, 816427L, 816443L, 816451L, 816469L, 816499L, 816521L, 816539L, 816547L,
-816559L, 816581L, 816587L, 816589L, 816593L, 816649L, 816653L, 816667L, 816689L,
-816691L, 816703L, 816709L, 816743L, 816763L, 816769L, 816779L, 816811L, 816817L,
-816821L, 816839L, 816841L, 816847L, 816857L, 816859L, 816869L, 816883L, 816887L,
-816899L, 816911L, 816917L, 816919L, 816929L, 816941L, 816947L, 816961L, 816971L,
-817013L, 817027L, 817039L, 817049L, 817051L, 817073L, 817081L, 817087L, 817093L,
-817111L, 817123L, 817127L, 817147L, 817151L, 817153L, 817163L, 817169L, 817183L,
-817211L, 817237L, 817273L, 817277L, 817279L, 817291L, 817303L, 817319L, 817321L,
-817331L, 817337L, 817357L, 817379L, 817403L, 817409L, 817433L, 817457L, 817463L,
-817483L, 817519L, 817529L, 817549L, 817561L, 817567L, 817603L, 817637L, 817651L,
-817669L, 817679L, 817697L, 817709L, 817711L, 817721L, 817723L, 817727L, 817757L,
-817769L, 817777L, 817783L, 817787L, 817793L, 817823L, 817837L, 817841L, 817867L,
-817871L, 817877L, 817889L, 817891L, 817897L, 817907L, 817913L, 817919L, 817933L,
-817951L, 817979L, 817987L, 818011L, 818017L, 818021L, 818093L, 818099L, 818101L,
-818113L, 818123L, 818143L, 818171L, 818173L, 818189L, 818219L, 818231L, 818239L,
-818249L, 818281L, 818287L, 818291L, 818303L, 818309L, 818327L, 818339L, 818341L,
-818347L, 818353L, 818359L, 818371L, 818383L, 818393L, 818399L, 818413L, 818429L,
-818453L, 818473L, 818509L, 818561L, 818569L, 818579L, 818581L, 818603L, 818621L,
-818659L, 818683L, 818687L, 818689L, 818707L, 818717L, 818723L, 818813L, 818819L,
-818821L, 818827L, 818837L, 818887L, 818897L, 818947L, 818959L, 818963L, 818969L,
-818977L, 818999L, 819001L, 819017L, 819029L, 819031L, 819037L, 819061L, 819073L,
-819083L, 819101L, 819131L, 819149L, 819157L, 819167L, 819173L, 819187L, 819229L,
-819239L, 819241L, 819251L, 819253L, 819263L, 819271L, 819289L, 819307L, 819311L,
-819317L, 819319L, 819367L, 819373L, 819389L, 819391L, 819407L, 819409L, 819419L,
-819431L, 819437L, 819443L, 819449L, 819457L, 819463L, 819473L, 819487L, 819491L,
-819493L, 819499L, 819503L, 819509L, 819523L, 819563L, 819583L, 819593L, 819607L,
-819617L, 819619L, 819629L, 819647L, 819653L, 819659L, 819673L, 819691L, 819701L,
-819719L, 819737L, 819739L, 819761L, 819769L, 819773L, 819781L, 819787L, 819799L,
-819811L, 819823L, 819827L, 819829L, 819853L, 819899L, 819911L, 819913L, 819937L,
-819943L, 819977L, 819989L, 819991L, 820037L, 820051L, 820067L, 820073L, 820093L,
-820109L, 820117L, 820129L, 820133L, 820163L, 820177L, 820187L, 820201L, 820213L,
-820223L, 820231L, 820241L, 820243L, 820247L, 820271L, 820273L, 820279L, 820319L,
-820321L, 820331L, 820333L, 820343L, 820349L, 820361L, 820367L, 820399L, 820409L,
-820411L, 820427L, 820429L, 820441L, 820459L, 820481L, 820489L, 820537L, 820541L,
-820559L, 820577L, 820597L, 820609L, 820619L, 820627L, 820637L, 820643L, 820649L,
-820657L, 820679L, 820681L, 820691L, 820711L, 820723L, 820733L, 820747L, 820753L,
-820759L, 820763L, 820789L, 820793L, 820837L, 820873L, 820891L, 820901L, 820907L,
-820909L, 820921L, 820927L, 820957L, 820969L, 820991L, 820997L, 821003L, 821027L,
-821039L, 821053L, 821057L, 821063L, 821069L, 821081L, 821089L, 821099L, 821101L,
-821113L, 821131L, 821143L, 821147L, 821153L, 821167L, 821173L, 821207L, 821209L,
-821263L, 821281L, 821291L, 821297L, 821311L, 821329L, 821333L, 821377L, 821383L,
-821411L, 821441L, 821449L, 821459L, 821461L, 821467L, 821477L, 821479L, 821489L,
-821497L, 821507L, 821519L, 821551L, 821573L, 821603L, 821641L, 821647L, 821651L,
-821663L, 821677L, 821741L, 821747L, 821753L, 821759L, 821771L, 821801L, 821803L,
-821809L, 821819L, 821827L, 821833L, 821851L, 821857L, 821861L, 821869L, 821879L,
-821897L, 821911L, 821939L, 821941L, 821971L, 821993L, 821999L, 822007L, 822011L,
-822013L, 822037L, 822049L, 822067L, 822079L, 822113L, 822131L, 822139L, 822161L,
-822163L, 822167L, 822169L, 822191L, 822197L, 822221L, 822223L, 822229L, 822233L,
-822253L, 822259L, 822277L, 822293L, 822299L, 822313L, 822317L, 822323L, 822329L,
-822343L, 822347L, 822361L, 822379L, 822383L, 822389L, 822391L, 822407L, 822431L,
-822433L, 822517L, 822539L, 822541L, 822551L, 822553L, 822557L, 822571L, 822581L,
-822587L, 822589L, 822599L, 822607L, 822611L, 822631L, 822667L, 822671L, 822673L,
-822683L, 822691L, 822697L, 822713L, 822721L, 822727L, 822739L, 822743L, 822761L,
-822763L, 822781L, 822791L, 822793L, 822803L, 822821L, 822823L, 822839L, 822853L,
-822881L, 822883L, 822889L, 822893L, 822901L, 822907L, 822949L, 822971L, 822973L,
-822989L, 823001L, 823003L, 823013L, 823033L, 823051L, 823117L, 823127L, 823129L,
-823153L, 823169L, 823177L, 823183L, 823201L, 823219L, 823231L, 823237L, 823241L,
-823243L, 823261L, 823271L, 823283L, 823309L, 823337L, 823349L, 823351L, 823357L,
-823373L, 823399L, 823421L, 823447L, 823451L, 823457L, 823481L, 823483L, 823489L,
-823499L, 823519L, 823541L, 823547L, 823553L, 823573L, 823591L, 823601L, 823619L,
-823621L, 823637L, 823643L, 823651L, 823663L, 823679L, 823703L, 823709L, 823717L,
-823721L, 823723L, 823727L, 823729L, 823741L, 823747L, 823759L, 823777L, 823787L,
-823789L, 823799L, 823819L, 823829L, 823831L, 823841L, 823843L, 823877L, 823903L,
-823913L, 823961L, 823967L, 823969L, 823981L, 823993L, 823997L, 824017L, 824029L,
-824039L, 824063L, 824069L, 824077L, 824081L, 824099L, 824123L, 824137L, 824147L,
-824179L, 824183L, 824189L, 824191L, 824227L, 824231L, 824233L, 824269L, 824281L,
-824287L, 824339L, 824393L, 824399L, 824401L, 824413L, 824419L, 824437L, 824443L,
-824459L, 824477L, 824489L, 824497L, 824501L, 824513L, 824531L, 824539L, 824563L,
-824591L, 824609L, 824641L, 824647L, 824651L, 824669L, 824671L, 824683L, 824699L,
-824701L, 824723L, 824741L, 824749L, 824753L, 824773L, 824777L, 824779L, 824801L,
-824821L, 824833L, 824843L, 824861L, 824893L, 824899L, 824911L, 824921L, 824933L,
-824939L, 824947L, 824951L, 824977L, 824981L, 824983L, 825001L, 825007L, 825017L,
-825029L, 825047L, 825049L, 825059L, 825067L, 825073L, 825101L, 825107L, 825109L,
-825131L, 825161L, 825191L, 825193L, 825199L, 825203L, 825229L, 825241L, 825247L,
-825259L, 825277L, 825281L, 825283L, 825287L, 825301L, 825329L, 825337L, 825343L,
-825347L, 825353L, 825361L, 825389L, 825397L, 825403L, 825413L, 825421L, 825439L,
-825443L, 825467L, 825479L, 825491L, 825509L, 825527L, 825533L, 825547L, 825551L,
-825553L, 825577L, 825593L, 825611L, 825613L, 825637L, 825647L, 825661L, 825679L,
-825689L, 825697L, 825701L, 825709L, 825733L, 825739L, 825749L, 825763L, 825779L,
-825791L, 825821L, 825827L, 825829L, 825857L, 825883L, 825889L, 825919L, 825947L,
-825959L, 825961L, 825971L, 825983L, 825991L, 825997L, 826019L, 826037L, 826039L,
-826051L, 826061L, 826069L, 826087L, 826093L, 826097L, 826129L, 826151L, 826153L,
-826169L, 826171L, 826193L, 826201L, 826211L, 826271L, 826283L, 826289L, 826303L,
-826313L, 826333L, 826339L, 826349L, 826351L, 826363L, 826379L, 826381L, 826391L,
-826393L, 826403L, 826411L, 826453L, 826477L, 826493L, 826499L, 826541L, 826549L,
-826559L, 826561L, 826571L, 826583L, 826603L, 826607L, 826613L, 826621L, 826663L,
-826667L, 826669L, 826673L, 826681L, 826697L, 826699L, 826711L, 826717L, 826723L,
-826729L, 826753L, 826759L, 826783L, 826799L, 826807L, 826811L, 826831L, 826849L,
-826867L, 826879L, 826883L, 826907L, 826921L, 826927L, 826939L, 826957L, 826963L,
-826967L, 826979L, 826997L, 827009L, 827023L, 827039L, 827041L, 827063L, 827087L,
-827129L, 827131L, 827143L, 827147L, 827161L, 827213L, 827227L, 827231L, 827251L,
-827269L, 827293L, 827303L, 827311L, 827327L, 827347L, 827369L, 827389L, 827417L,
-827423L, 827429L, 827443L, 827447L, 827461L, 827473L, 827501L, 827521L, 827537L,
-827539L, 827549L, 827581L, 827591L, 827599L, 827633L, 827639L, 827677L, 827681L,
-827693L, 827699L, 827719L, 827737L, 827741L, 827767L, 827779L, 827791L, 827803L,
-827809L, 827821L, 827833L, 827837L, 827843L, 827851L, 827857L, 827867L, 827873L,
-827899L, 827903L, 827923L, 827927L, 827929L, 827941L, 827969L, 827987L, 827989L,
-828007L, 828011L, 828013L, 828029L, 828043L, 828059L, 828067L, 828071L, 828101L,
-828109L, 828119L, 828127L, 828131L, 828133L, 828169L, 828199L, 828209L, 828221L,
-828239L, 828277L, 828349L, 828361L, 828371L, 828379L, 828383L, 828397L, 828407L,
-828409L, 828431L, 828449L, 828517L, 828523L, 828547L, 828557L, 828577L, 828587L,
-828601L, 828637L, 828643L, 828649L, 828673L, 828677L, 828691L, 828697L, 828701L,
-828703L, 828721L, 828731L, 828743L, 828757L, 828787L, 828797L, 828809L, 828811L,
-828823L, 828829L, 828833L, 828859L, 828871L, 828881L, 828889L, 828899L, 828901L,
-828917L, 828923L, 828941L, 828953L, 828967L, 828977L, 829001L, 829013L, 829057L,
-829063L, 829069L, 829093L, 829097L, 829111L, 829121L, 829123L, 829151L, 829159L,
-829177L, 829187L, 829193L, 829211L, 829223L, 829229L, 829237L, 829249L, 829267L,
-829273L, 829289L, 829319L, 829349L, 829399L, 829453L, 829457L, 829463L, 829469L,
-829501L, 829511L, 829519L, 829537L, 829547L, 829561L, 829601L, 829613L, 829627L,
-829637L, 829639L, 829643L, 829657L, 829687L, 829693L, 829709L, 829721L, 829723L,
-829727L, 829729L, 829733L, 829757L, 829789L, 829811L, 829813L, 829819L, 829831L,
-829841L, 829847L, 829849L, 829867L, 829877L, 829883L, 829949L, 829967L, 829979L,
-829987L, 829993L, 830003L, 830017L, 830041L, 830051L, 830099L, 830111L, 830117L,
-830131L, 830143L, 830153L, 830173L, 830177L, 830191L, 830233L, 830237L, 830257L,
-830267L, 830279L, 830293L, 830309L, 830311L, 830327L, 830329L, 830339L, 830341L,
-830353L, 830359L, 830363L, 830383L, 830387L, 830411L, 830413L, 830419L, 830441L,
-830447L, 830449L, 830477L, 830483L, 830497L, 830503L, 830513L, 830549L, 830551L,
-830561L, 830567L, 830579L, 830587L, 830591L, 830597L, 830617L, 830639L, 830657L,
-830677L, 830693L, 830719L, 830729L, 830741L, 830743L, 830777L, 830789L, 830801L,
-830827L, 830833L, 830839L, 830849L, 830861L, 830873L, 830887L, 830891L, 830899L,
-830911L, 830923L, 830939L, 830957L, 830981L, 830989L, 831023L, 831031L, 831037L,
-831043L, 831067L, 831071L, 831073L, 831091L, 831109L, 831139L, 831161L, 831163L,
-831167L, 831191L, 831217L, 831221L, 831239L, 831253L, 831287L, 831301L, 831323L,
-831329L, 831361L, 831367L, 831371L, 831373L, 831407L, 831409L, 831431L, 831433L,
-831437L, 831443L, 831461L, 831503L, 831529L, 831539L, 831541L, 831547L, 831553L,
-831559L, 831583L, 831587L, 831599L, 831617L, 831619L, 831631L, 831643L, 831647L,
-831653L, 831659L, 831661L, 831679L, 831683L, 831697L, 831707L, 831709L, 831713L,
-831731L, 831739L, 831751L, 831757L, 831769L, 831781L, 831799L, 831811L, 831821L,
-831829L, 831847L, 831851L, 831863L, 831881L, 831889L, 831893L, 831899L, 831911L,
-831913L, 831917L, 831967L, 831983L, 832003L, 832063L, 832079L, 832081L, 832103L,
-832109L, 832121L, 832123L, 832129L, 832141L, 832151L, 832157L, 832159L, 832189L,
-832211L, 832217L, 832253L, 832291L, 832297L, 832309L, 832327L, 832331L, 832339L,
-832361L, 832367L, 832369L, 832373L, 832379L, 832399L, 832411L, 832421L, 832427L,
-832451L, 832457L, 832477L, 832483L, 832487L, 832493L, 832499L, 832519L, 832583L,
-832591L, 832597L, 832607L, 832613L, 832621L, 832627L, 832631L, 832633L, 832639L,
-832673L, 832679L, 832681L, 832687L, 832693L, 832703L, 832709L, 832717L, 832721L,
-832729L, 832747L, 832757L, 832763L, 832771L, 832787L, 832801L, 832837L, 832841L,
-832861L, 832879L, 832883L, 832889L, 832913L, 832919L, 832927L, 832933L, 832943L,
-832957L, 832963L, 832969L, 832973L, 832987L, 833009L, 833023L, 833033L, 833047L,
-833057L, 833099L, 833101L, 833117L, 833171L, 833177L, 833179L, 833191L, 833197L,
-833201L, 833219L, 833251L, 833269L, 833281L, 833293L, 833299L, 833309L, 833347L,
-833353L, 833363L, 833377L, 833389L, 833429L, 833449L, 833453L, 833461L, 833467L,
-833477L, 833479L, 833491L, 833509L, 833537L, 833557L, 833563L, 833593L, 833597L,
-833617L, 833633L, 833659L, 833669L, 833689L, 833711L, 833713L, 833717L, 833719L,
-833737L, 833747L, 833759L, 833783L, 833801L, 833821L, 833839L, 833843L, 833857L,
-833873L, 833887L, 833893L, 833897L, 833923L, 833927L, 833933L, 833947L, 833977L,
-833999L, 834007L, 834013L, 834023L, 834059L, 834107L, 834131L, 834133L, 834137L,
-834143L, 834149L, 834151L, 834181L, 834199L, 834221L, 834257L, 834259L, 834269L,
-834277L, 834283L, 834287L, 834299L, 834311L, 834341L, 834367L, 834433L, 834439L,
-834469L, 834487L, 834497L, 834503L, 834511L, 834523L, 834527L, 834569L, 834571L,
-834593L, 834599L, 834607L, 834611L, 834623L, 834629L, 834641L, 834643L, 834653L,
-834671L, 834703L, 834709L, 834721L, 834761L, 834773L, 834781L, 834787L, 834797L,
-834809L, 834811L, 834829L, 834857L, 834859L, 834893L, 834913L, 834941L, 834947L,
-834949L, 834959L, 834961L, 834983L, 834991L, 835001L, 835013L, 835019L, 835033L,
-835039L, 835097L, 835099L, 835117L, 835123L, 835139L, 835141L, 835207L, 835213L,
-835217L, 835249L, 835253L, 835271L, 835313L, 835319L, 835321L, 835327L, 835369L,
-835379L, 835391L, 835399L, 835421L, 835427L, 835441L, 835451L, 835453L, 835459L,
-835469L, 835489L, 835511L, 835531L, 835553L, 835559L, 835591L, 835603L, 835607L,
-835609L, 835633L, 835643L, 835661L, 835663L, 835673L, 835687L, 835717L, 835721L,
-835733L, 835739L, 835759L, 835789L, 835811L, 835817L, 835819L, 835823L, 835831L,
-835841L, 835847L, 835859L, 835897L, 835909L, 835927L, 835931L, 835937L, 835951L,
-835957L, 835973L, 835979L, 835987L, 835993L, 835997L, 836047L, 836063L, 836071L,
-836107L, 836117L, 836131L, 836137L, 836149L, 836153L, 836159L, 836161L, 836183L,
-836189L, 836191L, 836203L, 836219L, 836233L, 836239L, 836243L, 836267L, 836291L,
-836299L, 836317L, 836327L, 836347L, 836351L, 836369L, 836377L, 836387L, 836413L,
-836449L, 836471L, 836477L, 836491L, 836497L, 836501L, 836509L, 836567L, 836569L,
-836573L, 836609L, 836611L, 836623L, 836657L, 836663L, 836677L, 836683L, 836699L,
-836701L, 836707L, 836713L, 836729L, 836747L, 836749L, 836753L, 836761L, 836789L,
-836807L, 836821L, 836833L, 836839L, 836861L, 836863L, 836873L, 836879L, 836881L,
-836917L, 836921L, 836939L, 836951L, 836971L, 837017L, 837043L, 837047L, 837059L,
-837071L, 837073L, 837077L, 837079L, 837107L, 837113L, 837139L, 837149L, 837157L,
-837191L, 837203L, 837257L, 837271L, 837283L, 837293L, 837307L, 837313L, 837359L,
-837367L, 837373L, 837377L, 837379L, 837409L, 837413L, 837439L, 837451L, 837461L,
-837467L, 837497L, 837503L, 837509L, 837521L, 837533L, 837583L, 837601L, 837611L,
-837619L, 837631L, 837659L, 837667L, 837673L, 837677L, 837679L, 837721L, 837731L,
-837737L, 837773L, 837779L, 837797L, 837817L, 837833L, 837847L, 837853L, 837887L,
-837923L, 837929L, 837931L, 837937L, 837943L, 837979L, 838003L, 838021L, 838037L,
-838039L, 838043L, 838063L, 838069L, 838091L, 838093L, 838099L, 838133L, 838139L,
-838141L, 838153L, 838157L, 838169L, 838171L, 838193L, 838207L, 838247L, 838249L,
-838349L, 838351L, 838363L, 838367L, 838379L, 838391L, 838393L, 838399L, 838403L,
-838421L, 838429L, 838441L, 838447L, 838459L, 838463L, 838471L, 838483L, 838517L,
-838547L, 838553L, 838561L, 838571L, 838583L, 838589L, 838597L, 838601L, 838609L,
-838613L, 838631L, 838633L, 838657L, 838667L, 838687L, 838693L, 838711L, 838751L,
-838757L, 838769L, 838771L, 838777L, 838781L, 838807L, 838813L, 838837L, 838853L,
-838889L, 838897L, 838909L, 838913L, 838919L, 838927L, 838931L, 838939L, 838949L,
-838951L, 838963L, 838969L, 838991L, 838993L, 839009L, 839029L, 839051L, 839071L,
-839087L, 839117L, 839131L, 839161L, 839203L, 839207L, 839221L, 839227L, 839261L,
-839269L, 839303L, 839323L, 839327L, 839351L, 839353L, 839369L, 839381L, 839413L,
-839429L, 839437L, 839441L, 839453L, 839459L, 839471L, 839473L, 839483L, 839491L,
-839497L, 839519L, 839539L, 839551L, 839563L, 839599L, 839603L, 839609L, 839611L,
-839617L, 839621L, 839633L, 839651L, 839653L, 839669L, 839693L, 839723L, 839731L,
-839767L, 839771L, 839791L, 839801L, 839809L, 839831L, 839837L, 839873L, 839879L,
-839887L, 839897L, 839899L, 839903L, 839911L, 839921L, 839957L, 839959L, 839963L,
-839981L, 839999L, 840023L, 840053L, 840061L, 840067L, 840083L, 840109L, 840137L,
-840139L, 840149L, 840163L, 840179L, 840181L, 840187L, 840197L, 840223L, 840239L,
-840241L, 840253L, 840269L, 840277L, 840289L, 840299L, 840319L, 840331L, 840341L,
-840347L, 840353L, 840439L, 840451L, 840457L, 840467L, 840473L, 840479L, 840491L,
-840523L, 840547L, 840557L, 840571L, 840589L, 840601L, 840611L, 840643L, 840661L,
-840683L, 840703L, 840709L, 840713L, 840727L, 840733L, 840743L, 840757L, 840761L,
-840767L, 840817L, 840821L, 840823L, 840839L, 840841L, 840859L, 840863L, 840907L,
-840911L, 840923L, 840929L, 840941L, 840943L, 840967L, 840979L, 840989L, 840991L,
-841003L, 841013L, 841019L, 841021L, 841063L, 841069L, 841079L, 841081L, 841091L,
-841097L, 841103L, 841147L, 841157L, 841189L, 841193L, 841207L, 841213L, 841219L,
-841223L, 841231L, 841237L, 841241L, 841259L, 841273L, 841277L, 841283L, 841289L,
-841297L, 841307L, 841327L, 841333L, 841349L, 841369L, 841391L, 841397L, 841411L,
-841427L, 841447L, 841457L, 841459L, 841541L, 841549L, 841559L, 841573L, 841597L,
-841601L, 841637L, 841651L, 841661L, 841663L, 841691L, 841697L, 841727L, 841741L,
-841751L, 841793L, 841801L, 841849L, 841859L, 841873L, 841879L, 841889L, 841913L,
-841921L, 841927L, 841931L, 841933L, 841979L, 841987L, 842003L, 842021L, 842041L,
-842047L, 842063L, 842071L, 842077L, 842081L, 842087L, 842089L, 842111L, 842113L,
-842141L, 842147L, 842159L, 842161L, 842167L, 842173L, 842183L, 842203L, 842209L,
-842249L, 842267L, 842279L, 842291L, 842293L, 842311L, 842321L, 842323L, 842339L,
-842341L, 842351L, 842353L, 842371L, 842383L, 842393L, 842399L, 842407L, 842417L,
-842419L, 842423L, 842447L, 842449L, 842473L, 842477L, 842483L, 842489L, 842497L,
-842507L, 842519L, 842521L, 842531L, 842551L, 842581L, 842587L, 842599L, 842617L,
-842623L, 842627L, 842657L, 842701L, 842729L, 842747L, 842759L, 842767L, 842771L,
-842791L, 842801L, 842813L, 842819L, 842857L, 842869L, 842879L, 842887L, 842923L,
-842939L, 842951L, 842957L, 842969L, 842977L, 842981L, 842987L, 842993L, 843043L,
-843067L, 843079L, 843091L, 843103L, 843113L, 843127L, 843131L, 843137L, 843173L,
-843179L, 843181L, 843209L, 843211L, 843229L, 843253L, 843257L, 843289L, 843299L,
-843301L, 843307L, 843331L, 843347L, 843361L, 843371L, 843377L, 843379L, 843383L,
-843397L, 843443L, 843449L, 843457L, 843461L, 843473L, 843487L, 843497L, 843503L,
-843527L, 843539L, 843553L, 843559L, 843587L, 843589L, 843607L, 843613L, 843629L,
-843643L, 843649L, 843677L, 843679L, 843701L, 843737L, 843757L, 843763L, 843779L,
-843781L, 843793L, 843797L, 843811L, 843823L, 843833L, 843841L, 843881L, 843883L,
-843889L, 843901L, 843907L, 843911L, 844001L, 844013L, 844043L, 844061L, 844069L,
-844087L, 844093L, 844111L, 844117L, 844121L, 844127L, 844139L, 844141L, 844153L,
-844157L, 844163L, 844183L, 844187L, 844199L, 844201L, 844243L, 844247L, 844253L,
-844279L, 844289L, 844297L, 844309L, 844321L, 844351L, 844369L, 844421L, 844427L,
-844429L, 844433L, 844439L, 844447L, 844453L, 844457L, 844463L, 844469L, 844483L,
-844489L, 844499L, 844507L, 844511L, 844513L, 844517L, 844523L, 844549L, 844553L,
-844601L, 844603L, 844609L, 844619L, 844621L, 844631L, 844639L, 844643L, 844651L,
-844709L, 844717L, 844733L, 844757L, 844763L, 844769L, 844771L, 844777L, 844841L,
-844847L, 844861L, 844867L, 844891L, 844897L, 844903L, 844913L, 844927L, 844957L,
-844999L, 845003L, 845017L, 845021L, 845027L, 845041L, 845069L, 845083L, 845099L,
-845111L, 845129L, 845137L, 845167L, 845179L, 845183L, 845197L, 845203L, 845209L,
-845219L, 845231L, 845237L, 845261L, 845279L, 845287L, 845303L, 845309L, 845333L,
-845347L, 845357L, 845363L, 845371L, 845381L, 845387L, 845431L, 845441L, 845447L,
-845459L, 845489L, 845491L, 845531L, 845567L, 845599L, 845623L, 845653L, 845657L,
-845659L, 845683L, 845717L, 845723L, 845729L, 845749L, 845753L, 845771L, 845777L,
-845809L, 845833L, 845849L, 845863L, 845879L, 845881L, 845893L, 845909L, 845921L,
-845927L, 845941L, 845951L, 845969L, 845981L, 845983L, 845987L, 845989L, 846037L,
-846059L, 846061L, 846067L, 846113L, 846137L, 846149L, 846161L, 846179L, 846187L,
-846217L, 846229L, 846233L, 846247L, 846259L, 846271L, 846323L, 846341L, 846343L,
-846353L, 846359L, 846361L, 846383L, 846389L, 846397L, 846401L, 846403L, 846407L,
-846421L, 846427L, 846437L, 846457L, 846487L, 846493L, 846499L, 846529L, 846563L,
-846577L, 846589L, 846647L, 846661L, 846667L, 846673L, 846689L, 846721L, 846733L,
-846739L, 846749L, 846751L, 846757L, 846779L, 846823L, 846841L, 846851L, 846869L,
-846871L, 846877L, 846913L, 846917L, 846919L, 846931L, 846943L, 846949L, 846953L,
-846961L, 846973L, 846977L, 846983L, 846997L, 847009L, 847031L, 847037L, 847043L,
-847051L, 847069L, 847073L, 847079L, 847097L, 847103L, 847109L, 847129L, 847139L,
-847151L, 847157L, 847163L, 847169L, 847193L, 847201L, 847213L, 847219L, 847237L,
-847247L, 847271L, 847277L, 847279L, 847283L, 847309L, 847321L, 847339L, 847361L,
-847367L, 847373L, 847393L, 847423L, 847453L, 847477L, 847493L, 847499L, 847507L,
-847519L, 847531L, 847537L, 847543L, 847549L, 847577L, 847589L, 847601L, 847607L,
-847621L, 847657L, 847663L, 847673L, 847681L, 847687L, 847697L, 847703L, 847727L,
-847729L, 847741L, 847787L, 847789L, 847813L, 847817L, 847853L, 847871L, 847883L,
-847901L, 847919L, 847933L, 847937L, 847949L, 847967L, 847969L, 847991L, 847993L,
-847997L, 848017L, 848051L, 848087L, 848101L, 848119L, 848123L, 848131L, 848143L,
-848149L, 848173L, 848201L, 848203L, 848213L, 848227L, 848251L, 848269L, 848273L,
-848297L, 848321L, 848359L, 848363L, 848383L, 848387L, 848399L, 848417L, 848423L,
-848429L, 848443L, 848461L, 848467L, 848473L, 848489L, 848531L, 848537L, 848557L,
-848567L, 848579L, 848591L, 848593L, 848599L, 848611L, 848629L, 848633L, 848647L,
-848651L, 848671L, 848681L, 848699L, 848707L, 848713L, 848737L, 848747L, 848761L,
-848779L, 848789L, 848791L, 848797L, 848803L, 848807L, 848839L, 848843L, 848849L,
-848851L, 848857L, 848879L, 848893L, 848909L, 848921L, 848923L, 848927L, 848933L,
-848941L, 848959L, 848983L, 848993L, 849019L, 849047L, 849049L, 849061L, 849083L,
-849097L, 849103L, 849119L, 849127L, 849131L, 849143L, 849161L, 849179L, 849197L,
-849203L, 849217L, 849221L, 849223L, 849241L, 849253L, 849271L, 849301L, 849311L,
-849347L, 849349L, 849353L, 849383L, 849391L, 849419L, 849427L, 849461L, 849467L,
-849481L, 849523L, 849533L, 849539L, 849571L, 849581L, 849587L, 849593L, 849599L,
-849601L, 849649L, 849691L, 849701L, 849703L, 849721L, 849727L, 849731L, 849733L,
-849743L, 849763L, 849767L, 849773L, 849829L, 849833L, 849839L, 849857L, 849869L,
-849883L, 849917L, 849923L, 849931L, 849943L, 849967L, 849973L, 849991L, 849997L,
-850009L, 850021L, 850027L, 850033L, 850043L, 850049L, 850061L, 850063L, 850081L,
-850093L, 850121L, 850133L, 850139L, 850147L, 850177L, 850181L, 850189L, 850207L,
-850211L, 850229L, 850243L, 850247L, 850253L, 850261L, 850271L, 850273L, 850301L,
-850303L, 850331L, 850337L, 850349L, 850351L, 850373L, 850387L, 850393L, 850397L,
-850403L, 850417L, 850427L, 850433L, 850439L, 850453L, 850457L, 850481L, 850529L,
-850537L, 850567L, 850571L, 850613L, 850631L, 850637L, 850673L, 850679L, 850691L,
-850711L, 850727L, 850753L, 850781L, 850807L, 850823L, 850849L, 850853L, 850879L,
-850891L, 850897L, 850933L, 850943L, 850951L, 850973L, 850979L, 851009L, 851017L,
-851033L, 851041L, 851051L, 851057L, 851087L, 851093L, 851113L, 851117L, 851131L,
-851153L, 851159L, 851171L, 851177L, 851197L, 851203L, 851209L, 851231L, 851239L,
-851251L, 851261L, 851267L, 851273L, 851293L, 851297L, 851303L, 851321L, 851327L,
-851351L, 851359L, 851363L, 851381L, 851387L, 851393L, 851401L, 851413L, 851419L,
-851423L, 851449L, 851471L, 851491L, 851507L, 851519L, 851537L, 851549L, 851569L,
-851573L, 851597L, 851603L, 851623L, 851633L, 851639L, 851647L, 851659L, 851671L,
-851677L, 851689L, 851723L, 851731L, 851749L, 851761L, 851797L, 851801L, 851803L,
-851813L, 851821L, 851831L, 851839L, 851843L, 851863L, 851881L, 851891L, 851899L,
-851953L, 851957L, 851971L, 852011L, 852013L, 852031L, 852037L, 852079L, 852101L,
-852121L, 852139L, 852143L, 852149L, 852151L, 852167L, 852179L, 852191L, 852197L,
-852199L, 852211L, 852233L, 852239L, 852253L, 852259L, 852263L, 852287L, 852289L,
-852301L, 852323L, 852347L, 852367L, 852391L, 852409L, 852427L, 852437L, 852457L,
-852463L, 852521L, 852557L, 852559L, 852563L, 852569L, 852581L, 852583L, 852589L,
-852613L, 852617L, 852623L, 852641L, 852661L, 852671L, 852673L, 852689L, 852749L,
-852751L, 852757L, 852763L, 852769L, 852793L, 852799L, 852809L, 852827L, 852829L,
-852833L, 852847L, 852851L, 852857L, 852871L, 852881L, 852889L, 852893L, 852913L,
-852937L, 852953L, 852959L, 852989L, 852997L, 853007L, 853031L, 853033L, 853049L,
-853057L, 853079L, 853091L, 853103L, 853123L, 853133L, 853159L, 853187L, 853189L,
-853211L, 853217L, 853241L, 853283L, 853289L, 853291L, 853319L, 853339L, 853357L,
-853387L, 853403L, 853427L, 853429L, 853439L, 853477L, 853481L, 853493L, 853529L,
-853543L, 853547L, 853571L, 853577L, 853597L, 853637L, 853663L, 853667L, 853669L,
-853687L, 853693L, 853703L, 853717L, 853733L, 853739L, 853759L, 853763L, 853793L,
-853799L, 853807L, 853813L, 853819L, 853823L, 853837L, 853843L, 853873L, 853889L,
-853901L, 853903L, 853913L, 853933L, 853949L, 853969L, 853981L, 853999L, 854017L,
-854033L, 854039L, 854041L, 854047L, 854053L, 854083L, 854089L, 854093L, 854099L,
-854111L, 854123L, 854129L, 854141L, 854149L, 854159L, 854171L, 854213L, 854257L,
-854263L, 854299L, 854303L, 854323L, 854327L, 854333L, 854351L, 854353L, 854363L,
-854383L, 854387L, 854407L, 854417L, 854419L, 854423L, 854431L, 854443L, 854459L,
-854461L, 854467L, 854479L, 854527L, 854533L, 854569L, 854587L, 854593L, 854599L,
-854617L, 854621L, 854629L, 854647L, 854683L, 854713L, 854729L, 854747L, 854771L,
-854801L, 854807L, 854849L, 854869L, 854881L, 854897L, 854899L, 854921L, 854923L,
-854927L, 854929L, 854951L, 854957L, 854963L, 854993L, 854999L, 855031L, 855059L,
-855061L, 855067L, 855079L, 855089L, 855119L, 855131L, 855143L, 855187L, 855191L,
-855199L, 855203L, 855221L, 855229L, 855241L, 855269L, 855271L, 855277L, 855293L,
-855307L, 855311L, 855317L, 855331L, 855359L, 855373L, 855377L, 855391L, 855397L,
-855401L, 855419L, 855427L, 855431L, 855461L, 855467L, 855499L, 855511L, 855521L,
-855527L, 855581L, 855601L, 855607L, 855619L, 855641L, 855667L, 855671L, 855683L,
-855697L, 855709L, 855713L, 855719L, 855721L, 855727L, 855731L, 855733L, 855737L,
-855739L, 855781L, 855787L, 855821L, 855851L, 855857L, 855863L, 855887L, 855889L,
-855901L, 855919L, 855923L, 855937L, 855947L, 855983L, 855989L, 855997L, 856021L,
-856043L, 856057L, 856061L, 856073L, 856081L, 856099L, 856111L, 856117L, 856133L,
-856139L, 856147L, 856153L, 856169L, 856181L, 856187L, 856213L, 856237L, 856241L,
-856249L, 856277L, 856279L, 856301L, 856309L, 856333L, 856343L, 856351L, 856369L,
-856381L, 856391L, 856393L, 856411L, 856417L, 856421L, 856441L, 856459L, 856469L,
-856483L, 856487L, 856507L, 856519L, 856529L, 856547L, 856549L, 856553L, 856567L,
-856571L, 856627L, 856637L, 856649L, 856693L, 856697L, 856699L, 856703L, 856711L,
-856717L, 856721L, 856733L, 856759L, 856787L, 856789L, 856799L, 856811L, 856813L,
-856831L, 856841L, 856847L, 856853L, 856897L, 856901L, 856903L, 856909L, 856927L,
-856939L, 856943L, 856949L, 856969L, 856993L, 857009L, 857011L, 857027L, 857029L,
-857039L, 857047L, 857053L, 857069L, 857081L, 857083L, 857099L, 857107L, 857137L,
-857161L, 857167L, 857201L, 857203L, 857221L, 857249L, 857267L, 857273L, 857281L,
-857287L, 857309L, 857321L, 857333L, 857341L, 857347L, 857357L, 857369L, 857407L,
-857411L, 857419L, 857431L, 857453L, 857459L, 857471L, 857513L, 857539L, 857551L,
-857567L, 857569L, 857573L, 857579L, 857581L, 857629L, 857653L, 857663L, 857669L,
-857671L, 857687L, 857707L, 857711L, 857713L, 857723L, 857737L, 857741L, 857743L,
-857749L, 857809L, 857821L, 857827L, 857839L, 857851L, 857867L, 857873L, 857897L,
-857903L, 857929L, 857951L, 857953L, 857957L, 857959L, 857963L, 857977L, 857981L,
-858001L, 858029L, 858043L, 858073L, 858083L, 858101L, 858103L, 858113L, 858127L,
-858149L, 858161L, 858167L, 858217L, 858223L, 858233L, 858239L, 858241L, 858251L,
-858259L, 858269L, 858281L, 858293L, 858301L, 858307L, 858311L, 858317L, 858373L,
-858397L, 858427L, 858433L, 858457L, 858463L, 858467L, 858479L, 858497L, 858503L,
-858527L, 858563L, 858577L, 858589L, 858623L, 858631L, 858673L, 858691L, 858701L,
-858707L, 858709L, 858713L, 858749L, 858757L, 858763L, 858769L, 858787L, 858817L,
-858821L, 858833L, 858841L, 858859L, 858877L, 858883L, 858899L, 858911L, 858919L,
-858931L, 858943L, 858953L, 858961L, 858989L, 858997L, 859003L, 859031L, 859037L,
-859049L, 859051L, 859057L, 859081L, 859091L, 859093L, 859109L, 859121L, 859181L,
-859189L, 859213L, 859223L, 859249L, 859259L, 859267L, 859273L, 859277L, 859279L,
-859297L, 859321L, 859361L, 859363L, 859373L, 859381L, 859393L, 859423L, 859433L,
-859447L, 859459L, 859477L, 859493L, 859513L, 859553L, 859559L, 859561L, 859567L,
-859577L, 859601L, 859603L, 859609L, 859619L, 859633L, 859657L, 859667L, 859669L,
-859679L, 859681L, 859697L, 859709L, 859751L, 859783L, 859787L, 859799L, 859801L,
-859823L, 859841L, 859849L, 859853L, 859861L, 859891L, 859913L, 859919L, 859927L,
-859933L, 859939L, 859973L, 859981L, 859987L, 860009L, 860011L, 860029L, 860051L,
-860059L, 860063L, 860071L, 860077L, 860087L, 860089L, 860107L, 860113L, 860117L,
-860143L, 860239L, 860257L, 860267L, 860291L, 860297L, 860309L, 860311L, 860317L,
-860323L, 860333L, 860341L, 860351L, 860357L, 860369L, 860381L, 860383L, 860393L,
-860399L, 860413L, 860417L, 860423L, 860441L, 860479L, 860501L, 860507L, 860513L,
-860533L, 860543L, 860569L, 860579L, 860581L, 860593L, 860599L, 860609L, 860623L,
-860641L, 860647L, 860663L, 860689L, 860701L, 860747L, 860753L, 860759L, 860779L,
-860789L, 860791L, 860809L, 860813L, 860819L, 860843L, 860861L, 860887L, 860891L,
-860911L, 860917L, 860921L, 860927L, 860929L, 860939L, 860941L, 860957L, 860969L,
-860971L, 861001L, 861013L, 861019L, 861031L, 861037L, 861043L, 861053L, 861059L,
-861079L, 861083L, 861089L, 861109L, 861121L, 861131L, 861139L, 861163L, 861167L,
-861191L, 861199L, 861221L, 861239L, 861293L, 861299L, 861317L, 861347L, 861353L,
-861361L, 861391L, 861433L, 861437L, 861439L, 861491L, 861493L, 861499L, 861541L,
-861547L, 861551L, 861559L, 861563L, 861571L, 861589L, 861599L, 861613L, 861617L,
-861647L, 861659L, 861691L, 861701L, 861703L, 861719L, 861733L, 861739L, 861743L,
-861761L, 861797L, 861799L, 861803L, 861823L, 861829L, 861853L, 861857L, 861871L,
-861877L, 861881L, 861899L, 861901L, 861907L, 861929L, 861937L, 861941L, 861947L,
-861977L, 861979L, 861997L, 862009L, 862013L, 862031L, 862033L, 862061L, 862067L,
-862097L, 862117L, 862123L, 862129L, 862139L, 862157L, 862159L, 862171L, 862177L,
-862181L, 862187L, 862207L, 862219L, 862229L, 862231L, 862241L, 862249L, 862259L,
-862261L, 862273L, 862283L, 862289L, 862297L, 862307L, 862319L, 862331L, 862343L,
-862369L, 862387L, 862397L, 862399L, 862409L, 862417L, 862423L, 862441L, 862447L,
-862471L, 862481L, 862483L, 862487L, 862493L, 862501L, 862541L, 862553L, 862559L,
-862567L, 862571L, 862573L, 862583L, 862607L, 862627L, 862633L, 862649L, 862651L,
-862669L, 862703L, 862727L, 862739L, 862769L, 862777L, 862783L, 862789L, 862811L,
-862819L, 862861L, 862879L, 862907L, 862909L, 862913L, 862919L, 862921L, 862943L,
-862957L, 862973L, 862987L, 862991L, 862997L, 863003L, 863017L, 863047L, 863081L,
-863087L, 863119L, 863123L, 863131L, 863143L, 863153L, 863179L, 863197L, 863231L,
-863251L, 863279L, 863287L, 863299L, 863309L, 863323L, 863363L, 863377L, 863393L,
-863479L, 863491L, 863497L, 863509L, 863521L, 863537L, 863539L, 863561L, 863593L,
-863609L, 863633L, 863641L, 863671L, 863689L, 863693L, 863711L, 863729L, 863743L,
-863749L, 863767L, 863771L, 863783L, 863801L, 863803L, 863833L, 863843L, 863851L,
-863867L, 863869L, 863879L, 863887L, 863897L, 863899L, 863909L, 863917L, 863921L,
-863959L, 863983L, 864007L, 864011L, 864013L, 864029L, 864037L, 864047L, 864049L,
-864053L, 864077L, 864079L, 864091L, 864103L, 864107L, 864119L, 864121L, 864131L,
-864137L, 864151L, 864167L, 864169L, 864191L, 864203L, 864211L, 864221L, 864223L,
-864251L, 864277L, 864289L, 864299L, 864301L, 864307L, 864319L, 864323L, 864341L,
-864359L, 864361L, 864379L, 864407L, 864419L, 864427L, 864439L, 864449L, 864491L,
-864503L, 864509L, 864511L, 864533L, 864541L, 864551L, 864581L, 864583L, 864587L,
-864613L, 864623L, 864629L, 864631L, 864641L, 864673L, 864679L, 864691L, 864707L,
-864733L, 864737L, 864757L, 864781L, 864793L, 864803L, 864811L, 864817L, 864883L,
-864887L, 864901L, 864911L, 864917L, 864947L, 864953L, 864959L, 864967L, 864979L,
-864989L, 865001L, 865003L, 865043L, 865049L, 865057L, 865061L, 865069L, 865087L,
-865091L, 865103L, 865121L, 865153L, 865159L, 865177L, 865201L, 865211L, 865213L,
-865217L, 865231L, 865247L, 865253L, 865259L, 865261L, 865301L, 865307L, 865313L,
-865321L, 865327L, 865339L, 865343L, 865349L, 865357L, 865363L, 865379L, 865409L,
-865457L, 865477L, 865481L, 865483L, 865493L, 865499L, 865511L, 865537L, 865577L,
-865591L, 865597L, 865609L, 865619L, 865637L, 865639L, 865643L, 865661L, 865681L,
-865687L, 865717L, 865721L, 865729L, 865741L, 865747L, 865751L, 865757L, 865769L,
-865771L, 865783L, 865801L, 865807L, 865817L, 865819L, 865829L, 865847L, 865859L,
-865867L, 865871L, 865877L, 865889L, 865933L, 865937L, 865957L, 865979L, 865993L,
-866003L, 866009L, 866011L, 866029L, 866051L, 866053L, 866057L, 866081L, 866083L,
-866087L, 866093L, 866101L, 866119L, 866123L, 866161L, 866183L, 866197L, 866213L,
-866221L, 866231L, 866279L, 866293L, 866309L, 866311L, 866329L, 866353L, 866389L,
-866399L, 866417L, 866431L, 866443L, 866461L, 866471L, 866477L, 866513L, 866519L,
-866573L, 866581L, 866623L, 866629L, 866639L, 866641L, 866653L, 866683L, 866689L,
-866693L, 866707L, 866713L, 866717L, 866737L, 866743L, 866759L, 866777L, 866783L,
-866819L, 866843L, 866849L, 866851L, 866857L, 866869L, 866909L, 866917L, 866927L,
-866933L, 866941L, 866953L, 866963L, 866969L, 867001L, 867007L, 867011L, 867023L,
-867037L, 867059L, 867067L, 867079L, 867091L, 867121L, 867131L, 867143L, 867151L,
-867161L, 867173L, 867203L, 867211L, 867227L, 867233L, 867253L, 867257L, 867259L,
-867263L, 867271L, 867281L, 867301L, 867319L, 867337L, 867343L, 867371L, 867389L,
-867397L, 867401L, 867409L, 867413L, 867431L, 867443L, 867457L, 867463L, 867467L,
-867487L, 867509L, 867511L, 867541L, 867547L, 867553L, 867563L, 867571L, 867577L,
-867589L, 867617L, 867619L, 867623L, 867631L, 867641L, 867653L, 867677L, 867679L,
-867689L, 867701L, 867719L, 867733L, 867743L, 867773L, 867781L, 867793L, 867803L,
-867817L, 867827L, 867829L, 867857L, 867871L, 867887L, 867913L, 867943L, 867947L,
-867959L, 867991L, 868019L, 868033L, 868039L, 868051L, 868069L, 868073L, 868081L,
-868103L, 868111L, 868121L, 868123L, 868151L, 868157L, 868171L, 868177L, 868199L,
-868211L, 868229L, 868249L, 868267L, 868271L, 868277L, 868291L, 868313L, 868327L,
-868331L, 868337L, 868349L, 868369L, 868379L, 868381L, 868397L, 868409L, 868423L,
-868451L, 868453L, 868459L, 868487L, 868489L, 868493L, 868529L, 868531L, 868537L,
-868559L, 868561L, 868577L, 868583L, 868603L, 868613L, 868639L, 868663L, 868669L,
-868691L, 868697L, 868727L, 868739L, 868741L, 868771L, 868783L, 868787L, 868793L,
-868799L, 868801L, 868817L, 868841L, 868849L, 868867L, 868873L, 868877L, 868883L,
-868891L, 868909L, 868937L, 868939L, 868943L, 868951L, 868957L, 868993L, 868997L,
-868999L, 869017L, 869021L, 869039L, 869053L, 869059L, 869069L, 869081L, 869119L,
-869131L, 869137L, 869153L, 869173L, 869179L, 869203L, 869233L, 869249L, 869251L,
-869257L, 869273L, 869291L, 869293L, 869299L, 869303L, 869317L, 869321L, 869339L,
-869369L, 869371L, 869381L, 869399L, 869413L, 869419L, 869437L, 869443L, 869461L,
-869467L, 869471L, 869489L, 869501L, 869521L, 869543L, 869551L, 869563L, 869579L,
-869587L, 869597L, 869599L, 869657L, 869663L, 869683L, 869689L, 869707L, 869717L,
-869747L, 869753L, 869773L, 869777L, 869779L, 869807L, 869809L, 869819L, 869849L,
-869863L, 869879L, 869887L, 869893L, 869899L, 869909L, 869927L, 869951L, 869959L,
-869983L, 869989L, 870007L, 870013L, 870031L, 870047L, 870049L, 870059L, 870083L,
-870097L, 870109L, 870127L, 870131L, 870137L, 870151L, 870161L, 870169L, 870173L,
-870197L, 870211L, 870223L, 870229L, 870239L, 870241L, 870253L, 870271L, 870283L,
-870301L, 870323L, 870329L, 870341L, 870367L, 870391L, 870403L, 870407L, 870413L,
-870431L, 870433L, 870437L, 870461L, 870479L, 870491L, 870497L, 870517L, 870533L,
-870547L, 870577L, 870589L, 870593L, 870601L, 870613L, 870629L, 870641L, 870643L,
-870679L, 870691L, 870703L, 870731L, 870739L, 870743L, 870773L, 870787L, 870809L,
-870811L, 870823L, 870833L, 870847L, 870853L, 870871L, 870889L, 870901L, 870907L,
-870911L, 870917L, 870929L, 870931L, 870953L, 870967L, 870977L, 870983L, 870997L,
-871001L, 871021L, 871027L, 871037L, 871061L, 871103L, 871147L, 871159L, 871163L,
-871177L, 871181L, 871229L, 871231L, 871249L, 871259L, 871271L, 871289L, 871303L,
-871337L, 871349L, 871393L, 871439L, 871459L, 871463L, 871477L, 871513L, 871517L,
-871531L, 871553L, 871571L, 871589L, 871597L, 871613L, 871621L, 871639L, 871643L,
-871649L, 871657L, 871679L, 871681L, 871687L, 871727L, 871763L, 871771L, 871789L,
-871817L, 871823L, 871837L, 871867L, 871883L, 871901L, 871919L, 871931L, 871957L,
-871963L, 871973L, 871987L, 871993L, 872017L, 872023L, 872033L, 872041L, 872057L,
-872071L, 872077L, 872089L, 872099L, 872107L, 872129L, 872141L, 872143L, 872149L,
-872159L, 872161L, 872173L, 872177L, 872189L, 872203L, 872227L, 872231L, 872237L,
-872243L, 872251L, 872257L, 872269L, 872281L, 872317L, 872323L, 872351L, 872353L,
-872369L, 872381L, 872383L, 872387L, 872393L, 872411L, 872419L, 872429L, 872437L,
-872441L, 872453L, 872471L, 872477L, 872479L, 872533L, 872549L, 872561L, 872563L,
-872567L, 872587L, 872609L, 872611L, 872621L, 872623L, 872647L, 872657L, 872659L,
-872671L, 872687L, 872731L, 872737L, 872747L, 872749L, 872761L, 872789L, 872791L,
-872843L, 872863L, 872923L, 872947L, 872951L, 872953L, 872959L, 872999L, 873017L,
-873043L, 873049L, 873073L, 873079L, 873083L, 873091L, 873109L, 873113L, 873121L,
-873133L, 873139L, 873157L, 873209L, 873247L, 873251L, 873263L, 873293L, 873317L,
-873319L, 873331L, 873343L, 873349L, 873359L, 873403L, 873407L, 873419L, 873421L,
-873427L, 873437L, 873461L, 873463L, 873469L, 873497L, 873527L, 873529L, 873539L,
-873541L, 873553L, 873569L, 873571L, 873617L, 873619L, 873641L, 873643L, 873659L,
-873667L, 873671L, 873689L, 873707L, 873709L, 873721L, 873727L, 873739L, 873767L,
-873773L, 873781L, 873787L, 873863L, 873877L, 873913L, 873959L, 873979L, 873989L,
-873991L, 874001L, 874009L, 874037L, 874063L, 874087L, 874091L, 874099L, 874103L,
-874109L, 874117L, 874121L, 874127L, 874151L, 874193L, 874213L, 874217L, 874229L,
-874249L, 874267L, 874271L, 874277L, 874301L, 874303L, 874331L, 874337L, 874343L,
-874351L, 874373L, 874387L, 874397L, 874403L, 874409L, 874427L, 874457L, 874459L,
-874477L, 874487L, 874537L, 874543L, 874547L, 874567L, 874583L, 874597L, 874619L,
-874637L, 874639L, 874651L, 874661L, 874673L, 874681L, 874693L, 874697L, 874711L,
-874721L, 874723L, 874729L, 874739L, 874763L, 874771L, 874777L, 874799L, 874807L,
-874813L, 874823L, 874831L, 874847L, 874859L, 874873L, 874879L, 874889L, 874891L,
-874919L, 874957L, 874967L, 874987L, 875011L, 875027L, 875033L, 875089L, 875107L,
-875113L, 875117L, 875129L, 875141L, 875183L, 875201L, 875209L, 875213L, 875233L,
-875239L, 875243L, 875261L, 875263L, 875267L, 875269L, 875297L, 875299L, 875317L,
-875323L, 875327L, 875333L, 875339L, 875341L, 875363L, 875377L, 875389L, 875393L,
-875417L, 875419L, 875429L, 875443L, 875447L, 875477L, 875491L, 875503L, 875509L,
-875513L, 875519L, 875521L, 875543L, 875579L, 875591L, 875593L, 875617L, 875621L,
-875627L, 875629L, 875647L, 875659L, 875663L, 875681L, 875683L, 875689L, 875701L,
-875711L, 875717L, 875731L, 875741L, 875759L, 875761L, 875773L, 875779L, 875783L,
-875803L, 875821L, 875837L, 875851L, 875893L, 875923L, 875929L, 875933L, 875947L,
-875969L, 875981L, 875983L, 876011L, 876013L, 876017L, 876019L, 876023L, 876041L,
-876067L, 876077L, 876079L, 876097L, 876103L, 876107L, 876121L, 876131L, 876137L,
-876149L, 876181L, 876191L, 876193L, 876199L, 876203L, 876229L, 876233L, 876257L,
-876263L, 876287L, 876301L, 876307L, 876311L, 876329L, 876331L, 876341L, 876349L,
-876371L, 876373L, 876431L, 876433L, 876443L, 876479L, 876481L, 876497L, 876523L,
-876529L, 876569L, 876581L, 876593L, 876607L, 876611L, 876619L, 876643L, 876647L,
-876653L, 876661L, 876677L, 876719L, 876721L, 876731L, 876749L, 876751L, 876761L,
-876769L, 876787L, 876791L, 876797L, 876817L, 876823L, 876833L, 876851L, 876853L,
-876871L, 876893L, 876913L, 876929L, 876947L, 876971L, 877003L, 877027L, 877043L,
-877057L, 877073L, 877091L, 877109L, 877111L, 877117L, 877133L, 877169L, 877181L,
-877187L, 877199L, 877213L, 877223L, 877237L, 877267L, 877291L, 877297L, 877301L,
-877313L, 877321L, 877333L, 877343L, 877351L, 877361L, 877367L, 877379L, 877397L,
-877399L, 877403L, 877411L, 877423L, 877463L, 877469L, 877531L, 877543L, 877567L,
-877573L, 877577L, 877601L, 877609L, 877619L, 877621L, 877651L, 877661L, 877699L,
-877739L, 877771L, 877783L, 877817L, 877823L, 877837L, 877843L, 877853L, 877867L,
-877871L, 877873L, 877879L, 877883L, 877907L, 877909L, 877937L, 877939L, 877949L,
-877997L, 878011L, 878021L, 878023L, 878039L, 878041L, 878077L, 878083L, 878089L,
-878099L, 878107L, 878113L, 878131L, 878147L, 878153L, 878159L, 878167L, 878173L,
-878183L, 878191L, 878197L, 878201L, 878221L, 878239L, 878279L, 878287L, 878291L,
-878299L, 878309L, 878359L, 878377L, 878387L, 878411L, 878413L, 878419L, 878443L,
-878453L, 878467L, 878489L, 878513L, 878539L, 878551L, 878567L, 878573L, 878593L,
-878597L, 878609L, 878621L, 878629L, 878641L, 878651L, 878659L, 878663L, 878677L,
-878681L, 878699L, 878719L, 878737L, 878743L, 878749L, 878777L, 878783L, 878789L,
-878797L, 878821L, 878831L, 878833L, 878837L, 878851L, 878863L, 878869L, 878873L,
-878893L, 878929L, 878939L, 878953L, 878957L, 878987L, 878989L, 879001L, 879007L,
-879023L, 879031L, 879061L, 879089L, 879097L, 879103L, 879113L, 879119L, 879133L,
-879143L, 879167L, 879169L, 879181L, 879199L, 879227L, 879239L, 879247L, 879259L,
-879269L, 879271L, 879283L, 879287L, 879299L, 879331L, 879341L, 879343L, 879353L,
-879371L, 879391L, 879401L, 879413L, 879449L, 879457L, 879493L, 879523L, 879533L,
-879539L, 879553L, 879581L, 879583L, 879607L, 879617L, 879623L, 879629L, 879649L,
-879653L, 879661L, 879667L, 879673L, 879679L, 879689L, 879691L, 879701L, 879707L,
-879709L, 879713L, 879721L, 879743L, 879797L, 879799L, 879817L, 879821L, 879839L,
-879859L, 879863L, 879881L, 879917L, 879919L, 879941L, 879953L, 879961L, 879973L,
-879979L, 880001L, 880007L, 880021L, 880027L, 880031L, 880043L, 880057L, 880067L,
-880069L, 880091L, 880097L, 880109L, 880127L, 880133L, 880151L, 880153L, 880199L,
-880211L, 880219L, 880223L, 880247L, 880249L, 880259L, 880283L, 880301L, 880303L,
-880331L, 880337L, 880343L, 880349L, 880361L, 880367L, 880409L, 880421L, 880423L,
-880427L, 880483L, 880487L, 880513L, 880519L, 880531L, 880541L, 880543L, 880553L,
-880559L, 880571L, 880573L, 880589L, 880603L, 880661L, 880667L, 880673L, 880681L,
-880687L, 880699L, 880703L, 880709L, 880723L, 880727L, 880729L, 880751L, 880793L,
-880799L, 880801L, 880813L, 880819L, 880823L, 880853L, 880861L, 880871L, 880883L,
-880903L, 880907L, 880909L, 880939L, 880949L, 880951L, 880961L, 880981L, 880993L,
-881003L, 881009L, 881017L, 881029L, 881057L, 881071L, 881077L, 881099L, 881119L,
-881141L, 881143L, 881147L, 881159L, 881171L, 881173L, 881191L, 881197L, 881207L,
-881219L, 881233L, 881249L, 881269L, 881273L, 881311L, 881317L, 881327L, 881333L,
-881351L, 881357L, 881369L, 881393L, 881407L, 881411L, 881417L, 881437L, 881449L,
-881471L, 881473L, 881477L, 881479L, 881509L, 881527L, 881533L, 881537L, 881539L,
-881591L, 881597L, 881611L, 881641L, 881663L, 881669L, 881681L, 881707L, 881711L,
-881729L, 881743L, 881779L, 881813L, 881833L, 881849L, 881897L, 881899L, 881911L,
-881917L, 881939L, 881953L, 881963L, 881983L, 881987L, 882017L, 882019L, 882029L,
-882031L, 882047L, 882061L, 882067L, 882071L, 882083L, 882103L, 882139L, 882157L,
-882169L, 882173L, 882179L, 882187L, 882199L, 882239L, 882241L, 882247L, 882251L,
-882253L, 882263L, 882289L, 882313L, 882359L, 882367L, 882377L, 882389L, 882391L,
-882433L, 882439L, 882449L, 882451L, 882461L, 882481L, 882491L, 882517L, 882529L,
-882551L, 882571L, 882577L, 882587L, 882593L, 882599L, 882617L, 882631L, 882653L,
-882659L, 882697L, 882701L, 882703L, 882719L, 882727L, 882733L, 882751L, 882773L,
-882779L, 882823L, 882851L, 882863L, 882877L, 882881L, 882883L, 882907L, 882913L,
-882923L, 882943L, 882953L, 882961L, 882967L, 882979L, 883013L, 883049L, 883061L,
-883073L, 883087L, 883093L, 883109L, 883111L, 883117L, 883121L, 883163L, 883187L,
-883193L, 883213L, 883217L, 883229L, 883231L, 883237L, 883241L, 883247L, 883249L,
-883273L, 883279L, 883307L, 883327L, 883331L, 883339L, 883343L, 883357L, 883391L,
-883397L, 883409L, 883411L, 883423L, 883429L, 883433L, 883451L, 883471L, 883483L,
-883489L, 883517L, 883537L, 883549L, 883577L, 883579L, 883613L, 883621L, 883627L,
-883639L, 883661L, 883667L, 883691L, 883697L, 883699L, 883703L, 883721L, 883733L,
-883739L, 883763L, 883777L, 883781L, 883783L, 883807L, 883871L, 883877L, 883889L,
-883921L, 883933L, 883963L, 883969L, 883973L, 883979L, 883991L, 884003L, 884011L,
-884029L, 884057L, 884069L, 884077L, 884087L, 884111L, 884129L, 884131L, 884159L,
-884167L, 884171L, 884183L, 884201L, 884227L, 884231L, 884243L, 884251L, 884267L,
-884269L, 884287L, 884293L, 884309L, 884311L, 884321L, 884341L, 884353L, 884363L,
-884369L, 884371L, 884417L, 884423L, 884437L, 884441L, 884453L, 884483L, 884489L,
-884491L, 884497L, 884501L, 884537L, 884573L, 884579L, 884591L, 884593L, 884617L,
-884651L, 884669L, 884693L, 884699L, 884717L, 884743L, 884789L, 884791L, 884803L,
-884813L, 884827L, 884831L, 884857L, 884881L, 884899L, 884921L, 884951L, 884959L,
-884977L, 884981L, 884987L, 884999L, 885023L, 885041L, 885061L, 885083L, 885091L,
-885097L, 885103L, 885107L, 885127L, 885133L, 885161L, 885163L, 885169L, 885187L,
-885217L, 885223L, 885233L, 885239L, 885251L, 885257L, 885263L, 885289L, 885301L,
-885307L, 885331L, 885359L, 885371L, 885383L, 885389L, 885397L, 885403L, 885421L,
-885427L, 885449L, 885473L, 885487L, 885497L, 885503L, 885509L, 885517L, 885529L,
-885551L, 885553L, 885589L, 885607L, 885611L, 885623L, 885679L, 885713L, 885721L,
-885727L, 885733L, 885737L, 885769L, 885791L, 885793L, 885803L, 885811L, 885821L,
-885823L, 885839L, 885869L, 885881L, 885883L, 885889L, 885893L, 885919L, 885923L,
-885931L, 885943L, 885947L, 885959L, 885961L, 885967L, 885971L, 885977L, 885991L,
-886007L, 886013L, 886019L, 886021L, 886031L, 886043L, 886069L, 886097L, 886117L,
-886129L, 886163L, 886177L, 886181L, 886183L, 886189L, 886199L, 886241L, 886243L,
-886247L, 886271L, 886283L, 886307L, 886313L, 886337L, 886339L, 886349L, 886367L,
-886381L, 886387L, 886421L, 886427L, 886429L, 886433L, 886453L, 886463L, 886469L,
-886471L, 886493L, 886511L, 886517L, 886519L, 886537L, 886541L, 886547L, 886549L,
-886583L, 886591L, 886607L, 886609L, 886619L, 886643L, 886651L, 886663L, 886667L,
-886741L, 886747L, 886751L, 886759L, 886777L, 886793L, 886799L, 886807L, 886819L,
-886859L, 886867L, 886891L, 886909L, 886913L, 886967L, 886969L, 886973L, 886979L,
-886981L, 886987L, 886993L, 886999L, 887017L, 887057L, 887059L, 887069L, 887093L,
-887101L, 887113L, 887141L, 887143L, 887153L, 887171L, 887177L, 887191L, 887203L,
-887233L, 887261L, 887267L, 887269L, 887291L, 887311L, 887323L, 887333L, 887377L,
-887387L, 887399L, 887401L, 887423L, 887441L, 887449L, 887459L, 887479L, 887483L,
-887503L, 887533L, 887543L, 887567L, 887569L, 887573L, 887581L, 887599L, 887617L,
-887629L, 887633L, 887641L, 887651L, 887657L, 887659L, 887669L, 887671L, 887681L,
-887693L, 887701L, 887707L, 887717L, 887743L, 887749L, 887759L, 887819L, 887827L,
-887837L, 887839L, 887849L, 887867L, 887903L, 887911L, 887921L, 887923L, 887941L,
-887947L, 887987L, 887989L, 888001L, 888011L, 888047L, 888059L, 888061L, 888077L,
-888091L, 888103L, 888109L, 888133L, 888143L, 888157L, 888161L, 888163L, 888179L,
-888203L, 888211L, 888247L, 888257L, 888263L, 888271L, 888287L, 888313L, 888319L,
-888323L, 888359L, 888361L, 888373L, 888389L, 888397L, 888409L, 888413L, 888427L,
-888431L, 888443L, 888451L, 888457L, 888469L, 888479L, 888493L, 888499L, 888533L,
-888541L, 888557L, 888623L, 888631L, 888637L, 888653L, 888659L, 888661L, 888683L,
-888689L, 888691L, 888721L, 888737L, 888751L, 888761L, 888773L, 888779L, 888781L,
-888793L, 888799L, 888809L, 888827L, 888857L, 888869L, 888871L, 888887L, 888917L,
-888919L, 888931L, 888959L, 888961L, 888967L, 888983L, 888989L, 888997L, 889001L,
-889027L, 889037L, 889039L, 889043L, 889051L, 889069L, 889081L, 889087L, 889123L,
-889139L, 889171L, 889177L, 889211L, 889237L, 889247L, 889261L, 889271L, 889279L,
-889289L, 889309L, 889313L, 889327L, 889337L, 889349L, 889351L, 889363L, 889367L,
-889373L, 889391L, 889411L, 889429L, 889439L, 889453L, 889481L, 889489L, 889501L,
-889519L, 889579L, 889589L, 889597L, 889631L, 889639L, 889657L, 889673L, 889687L,
-889697L, 889699L, 889703L, 889727L, 889747L, 889769L, 889783L, 889829L, 889871L,
-889873L, 889877L, 889879L, 889891L, 889901L, 889907L, 889909L, 889921L, 889937L,
-889951L, 889957L, 889963L, 889997L, 890003L, 890011L, 890027L, 890053L, 890063L,
-890083L, 890107L, 890111L, 890117L, 890119L, 890129L, 890147L, 890159L, 890161L,
-890177L, 890221L, 890231L, 890237L, 890287L, 890291L, 890303L, 890317L, 890333L,
-890371L, 890377L, 890419L, 890429L, 890437L, 890441L, 890459L, 890467L, 890501L,
-890531L, 890543L, 890551L, 890563L, 890597L, 890609L, 890653L, 890657L, 890671L,
-890683L, 890707L, 890711L, 890717L, 890737L, 890761L, 890789L, 890797L, 890803L,
-890809L, 890821L, 890833L, 890843L, 890861L, 890863L, 890867L, 890881L, 890887L,
-890893L, 890927L, 890933L, 890941L, 890957L, 890963L, 890969L, 890993L, 890999L,
-891001L, 891017L, 891047L, 891049L, 891061L, 891067L, 891091L, 891101L, 891103L,
-891133L, 891151L, 891161L, 891173L, 891179L, 891223L, 891239L, 891251L, 891277L,
-891287L, 891311L, 891323L, 891329L, 891349L, 891377L, 891379L, 891389L, 891391L,
-891409L, 891421L, 891427L, 891439L, 891481L, 891487L, 891491L, 891493L, 891509L,
-891521L, 891523L, 891551L, 891557L, 891559L, 891563L, 891571L, 891577L, 891587L,
-891593L, 891601L, 891617L, 891629L, 891643L, 891647L, 891659L, 891661L, 891677L,
-891679L, 891707L, 891743L, 891749L, 891763L, 891767L, 891797L, 891799L, 891809L,
-891817L, 891823L, 891827L, 891829L, 891851L, 891859L, 891887L, 891889L, 891893L,
-891899L, 891907L, 891923L, 891929L, 891967L, 891983L, 891991L, 891997L, 892019L,
-892027L, 892049L, 892057L, 892079L, 892091L, 892093L, 892097L, 892103L, 892123L,
-892141L, 892153L, 892159L, 892169L, 892189L, 892219L, 892237L, 892249L, 892253L,
-892261L, 892267L, 892271L, 892291L, 892321L, 892351L, 892357L, 892387L, 892391L,
-892421L, 892433L, 892439L, 892457L, 892471L, 892481L, 892513L, 892523L, 892531L,
-892547L, 892553L, 892559L, 892579L, 892597L, 892603L, 892609L, 892627L, 892643L,
-892657L, 892663L, 892667L, 892709L, 892733L, 892747L, 892757L, 892763L, 892777L,
-892781L, 892783L, 892817L, 892841L, 892849L, 892861L, 892877L, 892901L, 892919L,
-892933L, 892951L, 892973L, 892987L, 892999L, 893003L, 893023L, 893029L, 893033L,
-893041L, 893051L, 893059L, 893093L, 893099L, 893107L, 893111L, 893117L, 893119L,
-893131L, 893147L, 893149L, 893161L, 893183L, 893213L, 893219L, 893227L, 893237L,
-893257L, 893261L, 893281L, 893317L, 893339L, 893341L, 893351L, 893359L, 893363L,
-893381L, 893383L, 893407L, 893413L, 893419L, 893429L, 893441L, 893449L, 893479L,
-893489L, 893509L, 893521L, 893549L, 893567L, 893591L, 893603L, 893609L, 893653L,
-893657L, 893671L, 893681L, 893701L, 893719L, 893723L, 893743L, 893777L, 893797L,
-893821L, 893839L, 893857L, 893863L, 893873L, 893881L, 893897L, 893903L, 893917L,
-893929L, 893933L, 893939L, 893989L, 893999L, 894011L, 894037L, 894059L, 894067L,
-894073L, 894097L, 894109L, 894119L, 894137L, 894139L, 894151L, 894161L, 894167L,
-894181L, 894191L, 894193L, 894203L, 894209L, 894211L, 894221L, 894227L, 894233L,
-894239L, 894247L, 894259L, 894277L, 894281L, 894287L, 894301L, 894329L, 894343L,
-894371L, 894391L, 894403L, 894407L, 894409L, 894419L, 894427L, 894431L, 894449L,
-894451L, 894503L, 894511L, 894521L, 894527L, 894541L, 894547L, 894559L, 894581L,
-894589L, 894611L, 894613L, 894637L, 894643L, 894667L, 894689L, 894709L, 894713L,
-894721L, 894731L, 894749L, 894763L, 894779L, 894791L, 894793L, 894811L, 894869L,
-894871L, 894893L, 894917L, 894923L, 894947L, 894973L, 894997L, 895003L, 895007L,
-895009L, 895039L, 895049L, 895051L, 895079L, 895087L, 895127L, 895133L, 895151L,
-895157L, 895159L, 895171L, 895189L, 895211L, 895231L, 895241L, 895243L, 895247L,
-895253L, 895277L, 895283L, 895291L, 895309L, 895313L, 895319L, 895333L, 895343L,
-895351L, 895357L, 895361L, 895387L, 895393L, 895421L, 895423L, 895457L, 895463L,
-895469L, 895471L, 895507L, 895529L, 895553L, 895571L, 895579L, 895591L, 895613L,
-895627L, 895633L, 895649L, 895651L, 895667L, 895669L, 895673L, 895681L, 895691L,
-895703L, 895709L, 895721L, 895729L, 895757L, 895771L, 895777L, 895787L, 895789L,
-895799L, 895801L, 895813L, 895823L, 895841L, 895861L, 895879L, 895889L, 895901L,
-895903L, 895913L, 895927L, 895933L, 895957L, 895987L, 896003L, 896009L, 896047L,
-896069L, 896101L, 896107L, 896111L, 896113L, 896123L, 896143L, 896167L, 896191L,
-896201L, 896263L, 896281L, 896293L, 896297L, 896299L, 896323L, 896327L, 896341L,
-896347L, 896353L, 896369L, 896381L, 896417L, 896443L, 896447L, 896449L, 896453L,
-896479L, 896491L, 896509L, 896521L, 896531L, 896537L, 896543L, 896549L, 896557L,
-896561L, 896573L, 896587L, 896617L, 896633L, 896647L, 896669L, 896677L, 896681L,
-896717L, 896719L, 896723L, 896771L, 896783L, 896803L, 896837L, 896867L, 896879L,
-896897L, 896921L, 896927L, 896947L, 896953L, 896963L, 896983L, 897007L, 897011L,
-897019L, 897049L, 897053L, 897059L, 897067L, 897077L, 897101L, 897103L, 897119L,
-897133L, 897137L, 897157L, 897163L, 897191L, 897223L, 897229L, 897241L, 897251L,
-897263L, 897269L, 897271L, 897301L, 897307L, 897317L, 897319L, 897329L, 897349L,
-897359L, 897373L, 897401L, 897433L, 897443L, 897461L, 897467L, 897469L, 897473L,
-897497L, 897499L, 897517L, 897527L, 897553L, 897557L, 897563L, 897571L, 897577L,
-897581L, 897593L, 897601L, 897607L, 897629L, 897647L, 897649L, 897671L, 897691L,
-897703L, 897707L, 897709L, 897727L, 897751L, 897779L, 897781L, 897817L, 897829L,
-897847L, 897877L, 897881L, 897887L, 897899L, 897907L, 897931L, 897947L, 897971L,
-897983L, 898013L, 898019L, 898033L, 898063L, 898067L, 898069L, 898091L, 898097L,
-898109L, 898129L, 898133L, 898147L, 898153L, 898171L, 898181L, 898189L, 898199L,
-898211L, 898213L, 898223L, 898231L, 898241L, 898243L, 898253L, 898259L, 898279L,
-898283L, 898291L, 898307L, 898319L, 898327L, 898361L, 898369L, 898409L, 898421L,
-898423L, 898427L, 898439L, 898459L, 898477L, 898481L, 898483L, 898493L, 898519L,
-898523L, 898543L, 898549L, 898553L, 898561L, 898607L, 898613L, 898621L, 898661L,
-898663L, 898669L, 898673L, 898691L, 898717L, 898727L, 898753L, 898763L, 898769L,
-898787L, 898813L, 898819L, 898823L, 898853L, 898867L, 898873L, 898889L, 898897L,
-898921L, 898927L, 898951L, 898981L, 898987L, 899009L, 899051L, 899057L, 899069L,
-899123L, 899149L, 899153L, 899159L, 899161L, 899177L, 899179L, 899183L, 899189L,
-899209L, 899221L, 899233L, 899237L, 899263L, 899273L, 899291L, 899309L, 899321L,
-899387L, 899401L, 899413L, 899429L, 899447L, 899467L, 899473L, 899477L, 899491L,
-899519L, 899531L, 899537L, 899611L, 899617L, 899659L, 899671L, 899681L, 899687L,
-899693L, 899711L, 899719L, 899749L, 899753L, 899761L, 899779L, 899791L, 899807L,
-899831L, 899849L, 899851L, 899863L, 899881L, 899891L, 899893L, 899903L, 899917L,
-899939L, 899971L, 899981L, 900001L, 900007L, 900019L, 900037L, 900061L, 900089L,
-900091L, 900103L, 900121L, 900139L, 900143L, 900149L, 900157L, 900161L, 900169L,
-900187L, 900217L, 900233L, 900241L, 900253L, 900259L, 900283L, 900287L, 900293L,
-900307L, 900329L, 900331L, 900349L, 900397L, 900409L, 900443L, 900461L, 900481L,
-900491L, 900511L, 900539L, 900551L, 900553L, 900563L, 900569L, 900577L, 900583L,
-900587L, 900589L, 900593L, 900607L, 900623L, 900649L, 900659L, 900671L, 900673L,
-900689L, 900701L, 900719L, 900737L, 900743L, 900751L, 900761L, 900763L, 900773L,
-900797L, 900803L, 900817L, 900821L, 900863L, 900869L, 900917L, 900929L, 900931L,
-900937L, 900959L, 900971L, 900973L, 900997L, 901007L, 901009L, 901013L, 901063L,
-901067L, 901079L, 901093L, 901097L, 901111L, 901133L, 901141L, 901169L, 901171L,
-901177L, 901183L, 901193L, 901207L, 901211L, 901213L, 901247L, 901249L, 901253L,
-901273L, 901279L, 901309L, 901333L, 901339L, 901367L, 901399L, 901403L, 901423L,
-901427L, 901429L, 901441L, 901447L, 901451L, 901457L, 901471L, 901489L, 901499L,
-901501L, 901513L, 901517L, 901529L, 901547L, 901567L, 901591L, 901613L, 901643L,
-901657L, 901679L, 901687L, 901709L, 901717L, 901739L, 901741L, 901751L, 901781L,
-901787L, 901811L, 901819L, 901841L, 901861L, 901891L, 901907L, 901909L, 901919L,
-901931L, 901937L, 901963L, 901973L, 901993L, 901997L, 902009L, 902017L, 902029L,
-902039L, 902047L, 902053L, 902087L, 902089L, 902119L, 902137L, 902141L, 902179L,
-902191L, 902201L, 902227L, 902261L, 902263L, 902281L, 902299L, 902303L, 902311L,
-902333L, 902347L, 902351L, 902357L, 902389L, 902401L, 902413L, 902437L, 902449L,
-902471L, 902477L, 902483L, 902501L, 902507L, 902521L, 902563L, 902569L, 902579L,
-902591L, 902597L, 902599L, 902611L, 902639L, 902653L, 902659L, 902669L, 902677L,
-902687L, 902719L, 902723L, 902753L, 902761L, 902767L, 902771L, 902777L, 902789L,
-902807L, 902821L, 902827L, 902849L, 902873L, 902903L, 902933L, 902953L, 902963L,
-902971L, 902977L, 902981L, 902987L, 903017L, 903029L, 903037L, 903073L, 903079L,
-903103L, 903109L, 903143L, 903151L, 903163L, 903179L, 903197L, 903211L, 903223L,
-903251L, 903257L, 903269L, 903311L, 903323L, 903337L, 903347L, 903359L, 903367L,
-903389L, 903391L, 903403L, 903407L, 903421L, 903443L, 903449L, 903451L, 903457L,
-903479L, 903493L, 903527L, 903541L, 903547L, 903563L, 903569L, 903607L, 903613L,
-903641L, 903649L, 903673L, 903677L, 903691L, 903701L, 903709L, 903751L, 903757L,
-903761L, 903781L, 903803L, 903827L, 903841L, 903871L, 903883L, 903899L, 903913L,
-903919L, 903949L, 903967L, 903979L, 904019L, 904027L, 904049L, 904067L, 904069L,
-904073L, 904087L, 904093L, 904097L, 904103L, 904117L, 904121L, 904147L, 904157L,
-904181L, 904193L, 904201L, 904207L, 904217L, 904219L, 904261L, 904283L, 904289L,
-904297L, 904303L, 904357L, 904361L, 904369L, 904399L, 904441L, 904459L, 904483L,
-904489L, 904499L, 904511L, 904513L, 904517L, 904523L, 904531L, 904559L, 904573L,
-904577L, 904601L, 904619L, 904627L, 904633L, 904637L, 904643L, 904661L, 904663L,
-904667L, 904679L, 904681L, 904693L, 904697L, 904721L, 904727L, 904733L, 904759L,
-904769L, 904777L, 904781L, 904789L, 904793L, 904801L, 904811L, 904823L, 904847L,
-904861L, 904867L, 904873L, 904879L, 904901L, 904903L, 904907L, 904919L, 904931L,
-904933L, 904987L, 904997L, 904999L, 905011L, 905053L, 905059L, 905071L, 905083L,
-905087L, 905111L, 905123L, 905137L, 905143L, 905147L, 905161L, 905167L, 905171L,
-905189L, 905197L, 905207L, 905209L, 905213L, 905227L, 905249L, 905269L, 905291L,
-905297L, 905299L, 905329L, 905339L, 905347L, 905381L, 905413L, 905449L, 905453L,
-905461L, 905477L, 905491L, 905497L, 905507L, 905551L, 905581L, 905587L, 905599L,
-905617L, 905621L, 905629L, 905647L, 905651L, 905659L, 905677L, 905683L, 905687L,
-905693L, 905701L, 905713L, 905719L, 905759L, 905761L, 905767L, 905783L, 905803L,
-905819L, 905833L, 905843L, 905897L, 905909L, 905917L, 905923L, 905951L, 905959L,
-905963L, 905999L, 906007L, 906011L, 906013L, 906023L, 906029L, 906043L, 906089L,
-906107L, 906119L, 906121L, 906133L, 906179L, 906187L, 906197L, 906203L, 906211L,
-906229L, 906233L, 906259L, 906263L, 906289L, 906293L, 906313L, 906317L, 906329L,
-906331L, 906343L, 906349L, 906371L, 906377L, 906383L, 906391L, 906403L, 906421L,
-906427L, 906431L, 906461L, 906473L, 906481L, 906487L, 906497L, 906517L, 906523L,
-906539L, 906541L, 906557L, 906589L, 906601L, 906613L, 906617L, 906641L, 906649L,
-906673L, 906679L, 906691L, 906701L, 906707L, 906713L, 906727L, 906749L, 906751L,
-906757L, 906767L, 906779L, 906793L, 906809L, 906817L, 906823L, 906839L, 906847L,
-906869L, 906881L, 906901L, 906911L, 906923L, 906929L, 906931L, 906943L, 906949L,
-906973L, 907019L, 907021L, 907031L, 907063L, 907073L, 907099L, 907111L, 907133L,
-907139L, 907141L, 907163L, 907169L, 907183L, 907199L, 907211L, 907213L, 907217L,
-907223L, 907229L, 907237L, 907259L, 907267L, 907279L, 907297L, 907301L, 907321L,
-907331L, 907363L, 907367L, 907369L, 907391L, 907393L, 907397L, 907399L, 907427L,
-907433L, 907447L, 907457L, 907469L, 907471L, 907481L, 907493L, 907507L, 907513L,
-907549L, 907561L, 907567L, 907583L, 907589L, 907637L, 907651L, 907657L, 907663L,
-907667L, 907691L, 907693L, 907703L, 907717L, 907723L, 907727L, 907733L, 907757L,
-907759L, 907793L, 907807L, 907811L, 907813L, 907831L, 907843L, 907849L, 907871L,
-907891L, 907909L, 907913L, 907927L, 907957L, 907967L, 907969L, 907997L, 907999L,
-908003L, 908041L, 908053L, 908057L, 908071L, 908081L, 908101L, 908113L, 908129L,
-908137L, 908153L, 908179L, 908183L, 908197L, 908213L, 908221L, 908233L, 908249L,
-908287L, 908317L, 908321L, 908353L, 908359L, 908363L, 908377L, 908381L, 908417L,
-908419L, 908441L, 908449L, 908459L, 908471L, 908489L, 908491L, 908503L, 908513L,
-908521L, 908527L, 908533L, 908539L, 908543L, 908549L, 908573L, 908581L, 908591L,
-908597L, 908603L, 908617L, 908623L, 908627L, 908653L, 908669L, 908671L, 908711L,
-908723L, 908731L, 908741L, 908749L, 908759L, 908771L, 908797L, 908807L, 908813L,
-908819L, 908821L, 908849L, 908851L, 908857L, 908861L, 908863L, 908879L, 908881L,
-908893L, 908909L, 908911L, 908927L, 908953L, 908959L, 908993L, 909019L, 909023L,
-909031L, 909037L, 909043L, 909047L, 909061L, 909071L, 909089L, 909091L, 909107L,
-909113L, 909119L, 909133L, 909151L, 909173L, 909203L, 909217L, 909239L, 909241L,
-909247L, 909253L, 909281L, 909287L, 909289L, 909299L, 909301L, 909317L, 909319L,
-909329L, 909331L, 909341L, 909343L, 909371L, 909379L, 909383L, 909401L, 909409L,
-909437L, 909451L, 909457L, 909463L, 909481L, 909521L, 909529L, 909539L, 909541L,
-909547L, 909577L, 909599L, 909611L, 909613L, 909631L, 909637L, 909679L, 909683L,
-909691L, 909697L, 909731L, 909737L, 909743L, 909761L, 909767L, 909773L, 909787L,
-909791L, 909803L, 909809L, 909829L, 909833L, 909859L, 909863L, 909877L, 909889L,
-909899L, 909901L, 909907L, 909911L, 909917L, 909971L, 909973L, 909977L, 910003L,
-910031L, 910051L, 910069L, 910093L, 910097L, 910099L, 910103L, 910109L, 910121L,
-910127L, 910139L, 910141L, 910171L, 910177L, 910199L, 910201L, 910207L, 910213L,
-910219L, 910229L, 910277L, 910279L, 910307L, 910361L, 910369L, 910421L, 910447L,
-910451L, 910453L, 910457L, 910471L, 910519L, 910523L, 910561L, 910577L, 910583L,
-910603L, 910619L, 910621L, 910627L, 910631L, 910643L, 910661L, 910691L, 910709L,
-910711L, 910747L, 910751L, 910771L, 910781L, 910787L, 910799L, 910807L, 910817L,
-910849L, 910853L, 910883L, 910909L, 910939L, 910957L, 910981L, 911003L, 911011L,
-911023L, 911033L, 911039L, 911063L, 911077L, 911087L, 911089L, 911101L, 911111L,
-911129L, 911147L, 911159L, 911161L, 911167L, 911171L, 911173L, 911179L, 911201L,
-911219L, 911227L, 911231L, 911233L, 911249L, 911269L, 911291L, 911293L, 911303L,
-911311L, 911321L, 911327L, 911341L, 911357L, 911359L, 911363L, 911371L, 911413L,
-911419L, 911437L, 911453L, 911459L, 911503L, 911507L, 911527L, 911549L, 911593L,
-911597L, 911621L, 911633L, 911657L, 911663L, 911671L, 911681L, 911683L, 911689L,
-911707L, 911719L, 911723L, 911737L, 911749L, 911773L, 911777L, 911783L, 911819L,
-911831L, 911837L, 911839L, 911851L, 911861L, 911873L, 911879L, 911893L, 911899L,
-911903L, 911917L, 911947L, 911951L, 911957L, 911959L, 911969L, 912007L, 912031L,
-912047L, 912049L, 912053L, 912061L, 912083L, 912089L, 912103L, 912167L, 912173L,
-912187L, 912193L, 912211L, 912217L, 912227L, 912239L, 912251L, 912269L, 912287L,
-912337L, 912343L, 912349L, 912367L, 912391L, 912397L, 912403L, 912409L, 912413L,
-912449L, 912451L, 912463L, 912467L, 912469L, 912481L, 912487L, 912491L, 912497L,
-912511L, 912521L, 912523L, 912533L, 912539L, 912559L, 912581L, 912631L, 912647L,
-912649L, 912727L, 912763L, 912773L, 912797L, 912799L, 912809L, 912823L, 912829L,
-912839L, 912851L, 912853L, 912859L, 912869L, 912871L, 912911L, 912929L, 912941L,
-912953L, 912959L, 912971L, 912973L, 912979L, 912991L, 913013L, 913027L, 913037L,
-913039L, 913063L, 913067L, 913103L, 913139L, 913151L, 913177L, 913183L, 913217L,
-913247L, 913259L, 913279L, 913309L, 913321L, 913327L, 913331L, 913337L, 913373L,
-913397L, 913417L, 913421L, 913433L, 913441L, 913447L, 913457L, 913483L, 913487L,
-913513L, 913571L, 913573L, 913579L, 913589L, 913637L, 913639L, 913687L, 913709L,
-913723L, 913739L, 913753L, 913771L, 913799L, 913811L, 913853L, 913873L, 913889L,
-913907L, 913921L, 913933L, 913943L, 913981L, 913999L, 914021L, 914027L, 914041L,
-914047L, 914117L, 914131L, 914161L, 914189L, 914191L, 914213L, 914219L, 914237L,
-914239L, 914257L, 914269L, 914279L, 914293L, 914321L, 914327L, 914339L, 914351L,
-914357L, 914359L, 914363L, 914369L, 914371L, 914429L, 914443L, 914449L, 914461L,
-914467L, 914477L, 914491L, 914513L, 914519L, 914521L, 914533L, 914561L, 914569L,
-914579L, 914581L, 914591L, 914597L, 914609L, 914611L, 914629L, 914647L, 914657L,
-914701L, 914713L, 914723L, 914731L, 914737L, 914777L, 914783L, 914789L, 914791L,
-914801L, 914813L, 914819L, 914827L, 914843L, 914857L, 914861L, 914867L, 914873L,
-914887L, 914891L, 914897L, 914941L, 914951L, 914971L, 914981L, 915007L, 915017L,
-915029L, 915041L, 915049L, 915053L, 915067L, 915071L, 915113L, 915139L, 915143L,
-915157L, 915181L, 915191L, 915197L, 915199L, 915203L, 915221L, 915223L, 915247L,
-915251L, 915253L, 915259L, 915283L, 915301L, 915311L, 915353L, 915367L, 915379L,
-915391L, 915437L, 915451L, 915479L, 915487L, 915527L, 915533L, 915539L, 915547L,
-915557L, 915587L, 915589L, 915601L, 915611L, 915613L, 915623L, 915631L, 915641L,
-915659L, 915683L, 915697L, 915703L, 915727L, 915731L, 915737L, 915757L, 915763L,
-915769L, 915799L, 915839L, 915851L, 915869L, 915881L, 915911L, 915917L, 915919L,
-915947L, 915949L, 915961L, 915973L, 915991L, 916031L, 916033L, 916049L, 916057L,
-916061L, 916073L, 916099L, 916103L, 916109L, 916121L, 916127L, 916129L, 916141L,
-916169L, 916177L, 916183L, 916187L, 916189L, 916213L, 916217L, 916219L, 916259L,
-916261L, 916273L, 916291L, 916319L, 916337L, 916339L, 916361L, 916367L, 916387L,
-916411L, 916417L, 916441L, 916451L, 916457L, 916463L, 916469L, 916471L, 916477L,
-916501L, 916507L, 916511L, 916537L, 916561L, 916571L, 916583L, 916613L, 916621L,
-916633L, 916649L, 916651L, 916679L, 916703L, 916733L, 916771L, 916781L, 916787L,
-916831L, 916837L, 916841L, 916859L, 916871L, 916879L, 916907L, 916913L, 916931L,
-916933L, 916939L, 916961L, 916973L, 916999L, 917003L, 917039L, 917041L, 917051L,
-917053L, 917083L, 917089L, 917093L, 917101L, 917113L, 917117L, 917123L, 917141L,
-917153L, 917159L, 917173L, 917179L, 917209L, 917219L, 917227L, 917237L, 917239L,
-917243L, 917251L, 917281L, 917291L, 917317L, 917327L, 917333L, 917353L, 917363L,
-917381L, 917407L, 917443L, 917459L, 917461L, 917471L, 917503L, 917513L, 917519L,
-917549L, 917557L, 917573L, 917591L, 917593L, 917611L, 917617L, 917629L, 917633L,
-917641L, 917659L, 917669L, 917687L, 917689L, 917713L, 917729L, 917737L, 917753L,
-917759L, 917767L, 917771L, 917773L, 917783L, 917789L, 917803L, 917809L, 917827L,
-917831L, 917837L, 917843L, 917849L, 917869L, 917887L, 917893L, 917923L, 917927L,
-917951L, 917971L, 917993L, 918011L, 918019L, 918041L, 918067L, 918079L, 918089L,
-918103L, 918109L, 918131L, 918139L, 918143L, 918149L, 918157L, 918161L, 918173L,
-918193L, 918199L, 918209L, 918223L, 918257L, 918259L, 918263L, 918283L, 918301L,
-918319L, 918329L, 918341L, 918347L, 918353L, 918361L, 918371L, 918389L, 918397L,
-918431L, 918433L, 918439L, 918443L, 918469L, 918481L, 918497L, 918529L, 918539L,
-918563L, 918581L, 918583L, 918587L, 918613L, 918641L, 918647L, 918653L, 918677L,
-918679L, 918683L, 918733L, 918737L, 918751L, 918763L, 918767L, 918779L, 918787L,
-918793L, 918823L, 918829L, 918839L, 918857L, 918877L, 918889L, 918899L, 918913L,
-918943L, 918947L, 918949L, 918959L, 918971L, 918989L, 919013L, 919019L, 919021L,
-919031L, 919033L, 919063L, 919067L, 919081L, 919109L, 919111L, 919129L, 919147L,
-919153L, 919169L, 919183L, 919189L, 919223L, 919229L, 919231L, 919249L, 919253L,
-919267L, 919301L, 919313L, 919319L, 919337L, 919349L, 919351L, 919381L, 919393L,
-919409L, 919417L, 919421L, 919423L, 919427L, 919447L, 919511L, 919519L, 919531L,
-919559L, 919571L, 919591L, 919613L, 919621L, 919631L, 919679L, 919691L, 919693L,
-919703L, 919729L, 919757L, 919759L, 919769L, 919781L, 919799L, 919811L, 919817L,
-919823L, 919859L, 919871L, 919883L, 919901L, 919903L, 919913L, 919927L, 919937L,
-919939L, 919949L, 919951L, 919969L, 919979L, 920011L, 920021L, 920039L, 920053L,
-920107L, 920123L, 920137L, 920147L, 920149L, 920167L, 920197L, 920201L, 920203L,
-920209L, 920219L, 920233L, 920263L, 920267L, 920273L, 920279L, 920281L, 920291L,
-920323L, 920333L, 920357L, 920371L, 920377L, 920393L, 920399L, 920407L, 920411L,
-920419L, 920441L, 920443L, 920467L, 920473L, 920477L, 920497L, 920509L, 920519L,
-920539L, 920561L, 920609L, 920641L, 920651L, 920653L, 920677L, 920687L, 920701L,
-920707L, 920729L, 920741L, 920743L, 920753L, 920761L, 920783L, 920789L, 920791L,
-920807L, 920827L, 920833L, 920849L, 920863L, 920869L, 920891L, 920921L, 920947L,
-920951L, 920957L, 920963L, 920971L, 920999L, 921001L, 921007L, 921013L, 921029L,
-921031L, 921073L, 921079L, 921091L, 921121L, 921133L, 921143L, 921149L, 921157L,
-921169L, 921191L, 921197L, 921199L, 921203L, 921223L, 921233L, 921241L, 921257L,
-921259L, 921287L, 921293L, 921331L, 921353L, 921373L, 921379L, 921407L, 921409L,
-921457L, 921463L, 921467L, 921491L, 921497L, 921499L, 921517L, 921523L, 921563L,
-921581L, 921589L, 921601L, 921611L, 921629L, 921637L, 921643L, 921647L, 921667L,
-921677L, 921703L, 921733L, 921737L, 921743L, 921749L, 921751L, 921761L, 921779L,
-921787L, 921821L, 921839L, 921841L, 921871L, 921887L, 921889L, 921901L, 921911L,
-921913L, 921919L, 921931L, 921959L, 921989L, 922021L, 922027L, 922037L, 922039L,
-922043L, 922057L, 922067L, 922069L, 922073L, 922079L, 922081L, 922087L, 922099L,
-922123L, 922169L, 922211L, 922217L, 922223L, 922237L, 922247L, 922261L, 922283L,
-922289L, 922291L, 922303L, 922309L, 922321L, 922331L, 922333L, 922351L, 922357L,
-922367L, 922391L, 922423L, 922451L, 922457L, 922463L, 922487L, 922489L, 922499L,
-922511L, 922513L, 922517L, 922531L, 922549L, 922561L, 922601L, 922613L, 922619L,
-922627L, 922631L, 922637L, 922639L, 922643L, 922667L, 922679L, 922681L, 922699L,
-922717L, 922729L, 922739L, 922741L, 922781L, 922807L, 922813L, 922853L, 922861L,
-922897L, 922907L, 922931L, 922973L, 922993L, 923017L, 923023L, 923029L, 923047L,
-923051L, 923053L, 923107L, 923123L, 923129L, 923137L, 923141L, 923147L, 923171L,
-923177L, 923179L, 923183L, 923201L, 923203L, 923227L, 923233L, 923239L, 923249L,
-923309L, 923311L, 923333L, 923341L, 923347L, 923369L, 923371L, 923387L, 923399L,
-923407L, 923411L, 923437L, 923441L, 923449L, 923453L, 923467L, 923471L, 923501L,
-923509L, 923513L, 923539L, 923543L, 923551L, 923561L, 923567L, 923579L, 923581L,
-923591L, 923599L, 923603L, 923617L, 923641L, 923653L, 923687L, 923693L, 923701L,
-923711L, 923719L, 923743L, 923773L, 923789L, 923809L, 923833L, 923849L, 923851L,
-923861L, 923869L, 923903L, 923917L, 923929L, 923939L, 923947L, 923953L, 923959L,
-923963L, 923971L, 923977L, 923983L, 923987L, 924019L, 924023L, 924031L, 924037L,
-924041L, 924043L, 924059L, 924073L, 924083L, 924097L, 924101L, 924109L, 924139L,
-924151L, 924173L, 924191L, 924197L, 924241L, 924269L, 924281L, 924283L, 924299L,
-924323L, 924337L, 924359L, 924361L, 924383L, 924397L, 924401L, 924403L, 924419L,
-924421L, 924431L, 924437L, 924463L, 924493L, 924499L, 924503L, 924523L, 924527L,
-924529L, 924551L, 924557L, 924601L, 924617L, 924641L, 924643L, 924659L, 924661L,
-924683L, 924697L, 924709L, 924713L, 924719L, 924727L, 924731L, 924743L, 924751L,
-924757L, 924769L, 924773L, 924779L, 924793L, 924809L, 924811L, 924827L, 924829L,
-924841L, 924871L, 924877L, 924881L, 924907L, 924929L, 924961L, 924967L, 924997L,
-925019L, 925027L, 925033L, 925039L, 925051L, 925063L, 925073L, 925079L, 925081L,
-925087L, 925097L, 925103L, 925109L, 925117L, 925121L, 925147L, 925153L, 925159L,
-925163L, 925181L, 925189L, 925193L, 925217L, 925237L, 925241L, 925271L, 925273L,
-925279L, 925291L, 925307L, 925339L, 925349L, 925369L, 925373L, 925387L, 925391L,
-925399L, 925409L, 925423L, 925447L, 925469L, 925487L, 925499L, 925501L, 925513L,
-925517L, 925523L, 925559L, 925577L, 925579L, 925597L, 925607L, 925619L, 925621L,
-925637L, 925649L, 925663L, 925669L, 925679L, 925697L, 925721L, 925733L, 925741L,
-925783L, 925789L, 925823L, 925831L, 925843L, 925849L, 925891L, 925901L, 925913L,
-925921L, 925937L, 925943L, 925949L, 925961L, 925979L, 925987L, 925997L, 926017L,
-926027L, 926033L, 926077L, 926087L, 926089L, 926099L, 926111L, 926113L, 926129L,
-926131L, 926153L, 926161L, 926171L, 926179L, 926183L, 926203L, 926227L, 926239L,
-926251L, 926273L, 926293L, 926309L, 926327L, 926351L, 926353L, 926357L, 926377L,
-926389L, 926399L, 926411L, 926423L, 926437L, 926461L, 926467L, 926489L, 926503L,
-926507L, 926533L, 926537L, 926557L, 926561L, 926567L, 926581L, 926587L, 926617L,
-926623L, 926633L, 926657L, 926659L, 926669L, 926671L, 926689L, 926701L, 926707L,
-926741L, 926747L, 926767L, 926777L, 926797L, 926803L, 926819L, 926843L, 926851L,
-926867L, 926879L, 926899L, 926903L, 926921L, 926957L, 926963L, 926971L, 926977L,
-926983L, 927001L, 927007L, 927013L, 927049L, 927077L, 927083L, 927089L, 927097L,
-927137L, 927149L, 927161L, 927167L, 927187L, 927191L, 927229L, 927233L, 927259L,
-927287L, 927301L, 927313L, 927317L, 927323L, 927361L, 927373L, 927397L, 927403L,
-927431L, 927439L, 927491L, 927497L, 927517L, 927529L, 927533L, 927541L, 927557L,
-927569L, 927587L, 927629L, 927631L, 927643L, 927649L, 927653L, 927671L, 927677L,
-927683L, 927709L, 927727L, 927743L, 927763L, 927769L, 927779L, 927791L, 927803L,
-927821L, 927833L, 927841L, 927847L, 927853L, 927863L, 927869L, 927961L, 927967L,
-927973L, 928001L, 928043L, 928051L, 928063L, 928079L, 928097L, 928099L, 928111L,
-928139L, 928141L, 928153L, 928157L, 928159L, 928163L, 928177L, 928223L, 928231L,
-928253L, 928267L, 928271L, 928273L, 928289L, 928307L, 928313L, 928331L, 928337L,
-928351L, 928399L, 928409L, 928423L, 928427L, 928429L, 928453L, 928457L, 928463L,
-928469L, 928471L, 928513L, 928547L, 928559L, 928561L, 928597L, 928607L, 928619L,
-928621L, 928637L, 928643L, 928649L, 928651L, 928661L, 928679L, 928699L, 928703L,
-928769L, 928771L, 928787L, 928793L, 928799L, 928813L, 928817L, 928819L, 928849L,
-928859L, 928871L, 928883L, 928903L, 928913L, 928927L, 928933L, 928979L, 929003L,
-929009L, 929011L, 929023L, 929029L, 929051L, 929057L, 929059L, 929063L, 929069L,
-929077L, 929083L, 929087L, 929113L, 929129L, 929141L, 929153L, 929161L, 929171L,
-929197L, 929207L, 929209L, 929239L, 929251L, 929261L, 929281L, 929293L, 929303L,
-929311L, 929323L, 929333L, 929381L, 929389L, 929393L, 929399L, 929417L, 929419L,
-929431L, 929459L, 929483L, 929497L, 929501L, 929507L, 929527L, 929549L, 929557L,
-929561L, 929573L, 929581L, 929587L, 929609L, 929623L, 929627L, 929629L, 929639L,
-929641L, 929647L, 929671L, 929693L, 929717L, 929737L, 929741L, 929743L, 929749L,
-929777L, 929791L, 929807L, 929809L, 929813L, 929843L, 929861L, 929869L, 929881L,
-929891L, 929897L, 929941L, 929953L, 929963L, 929977L, 929983L, 930011L, 930043L,
-930071L, 930073L, 930077L, 930079L, 930089L, 930101L, 930113L, 930119L, 930157L,
-930173L, 930179L, 930187L, 930191L, 930197L, 930199L, 930211L, 930229L, 930269L,
-930277L, 930283L, 930287L, 930289L, 930301L, 930323L, 930337L, 930379L, 930389L,
-930409L, 930437L, 930467L, 930469L, 930481L, 930491L, 930499L, 930509L, 930547L,
-930551L, 930569L, 930571L, 930583L, 930593L, 930617L, 930619L, 930637L, 930653L,
-930667L, 930689L, 930707L, 930719L, 930737L, 930749L, 930763L, 930773L, 930779L,
-930817L, 930827L, 930841L, 930847L, 930859L, 930863L, 930889L, 930911L, 930931L,
-930973L, 930977L, 930989L, 930991L, 931003L, 931013L, 931067L, 931087L, 931097L,
-931123L, 931127L, 931129L, 931153L, 931163L, 931169L, 931181L, 931193L, 931199L,
-931213L, 931237L, 931241L, 931267L, 931289L, 931303L, 931309L, 931313L, 931319L,
-931351L, 931363L, 931387L, 931417L, 931421L, 931487L, 931499L, 931517L, 931529L,
-931537L, 931543L, 931571L, 931573L, 931577L, 931597L, 931621L, 931639L, 931657L,
-931691L, 931709L, 931727L, 931729L, 931739L, 931747L, 931751L, 931757L, 931781L,
-931783L, 931789L, 931811L, 931837L, 931849L, 931859L, 931873L, 931877L, 931883L,
-931901L, 931907L, 931913L, 931921L, 931933L, 931943L, 931949L, 931967L, 931981L,
-931999L, 932003L, 932021L, 932039L, 932051L, 932081L, 932101L, 932117L, 932119L,
-932131L, 932149L, 932153L, 932177L, 932189L, 932203L, 932207L, 932209L, 932219L,
-932221L, 932227L, 932231L, 932257L, 932303L, 932317L, 932333L, 932341L, 932353L,
-932357L, 932413L, 932417L, 932419L, 932431L, 932441L, 932447L, 932471L, 932473L,
-932483L, 932497L, 932513L, 932521L, 932537L, 932549L, 932557L, 932563L, 932567L,
-932579L, 932587L, 932593L, 932597L, 932609L, 932647L, 932651L, 932663L, 932677L,
-932681L, 932683L, 932749L, 932761L, 932779L, 932783L, 932801L, 932803L, 932819L,
-932839L, 932863L, 932879L, 932887L, 932917L, 932923L, 932927L, 932941L, 932947L,
-932951L, 932963L, 932969L, 932983L, 932999L, 933001L, 933019L, 933047L, 933059L,
-933061L, 933067L, 933073L, 933151L, 933157L, 933173L, 933199L, 933209L, 933217L,
-933221L, 933241L, 933259L, 933263L, 933269L, 933293L, 933301L, 933313L, 933319L,
-933329L, 933349L, 933389L, 933397L, 933403L, 933407L, 933421L, 933433L, 933463L,
-933479L, 933497L, 933523L, 933551L, 933553L, 933563L, 933601L, 933607L, 933613L,
-933643L, 933649L, 933671L, 933677L, 933703L, 933707L, 933739L, 933761L, 933781L,
-933787L, 933797L, 933809L, 933811L, 933817L, 933839L, 933847L, 933851L, 933853L,
-933883L, 933893L, 933923L, 933931L, 933943L, 933949L, 933953L, 933967L, 933973L,
-933979L, 934001L, 934009L, 934033L, 934039L, 934049L, 934051L, 934057L, 934067L,
-934069L, 934079L, 934111L, 934117L, 934121L, 934127L, 934151L, 934159L, 934187L,
-934223L, 934229L, 934243L, 934253L, 934259L, 934277L, 934291L, 934301L, 934319L,
-934343L, 934387L, 934393L, 934399L, 934403L, 934429L, 934441L, 934463L, 934469L,
-934481L, 934487L, 934489L, 934499L, 934517L, 934523L, 934537L, 934543L, 934547L,
-934561L, 934567L, 934579L, 934597L, 934603L, 934607L, 934613L, 934639L, 934669L,
-934673L, 934693L, 934721L, 934723L, 934733L, 934753L, 934763L, 934771L, 934793L,
-934799L, 934811L, 934831L, 934837L, 934853L, 934861L, 934883L, 934889L, 934891L,
-934897L, 934907L, 934909L, 934919L, 934939L, 934943L, 934951L, 934961L, 934979L,
-934981L, 935003L, 935021L, 935023L, 935059L, 935063L, 935071L, 935093L, 935107L,
-935113L, 935147L, 935149L, 935167L, 935183L, 935189L, 935197L, 935201L, 935213L,
-935243L, 935257L, 935261L, 935303L, 935339L, 935353L, 935359L, 935377L, 935381L,
-935393L, 935399L, 935413L, 935423L, 935443L, 935447L, 935461L, 935489L, 935507L,
-935513L, 935531L, 935537L, 935581L, 935587L, 935591L, 935593L, 935603L, 935621L,
-935639L, 935651L, 935653L, 935677L, 935687L, 935689L, 935699L, 935707L, 935717L,
-935719L, 935761L, 935771L, 935777L, 935791L, 935813L, 935819L, 935827L, 935839L,
-935843L, 935861L, 935899L, 935903L, 935971L, 935999L, 936007L, 936029L, 936053L,
-936097L, 936113L, 936119L, 936127L, 936151L, 936161L, 936179L, 936181L, 936197L,
-936203L, 936223L, 936227L, 936233L, 936253L, 936259L, 936281L, 936283L, 936311L,
-936319L, 936329L, 936361L, 936379L, 936391L, 936401L, 936407L, 936413L, 936437L,
-936451L, 936469L, 936487L, 936493L, 936499L, 936511L, 936521L, 936527L, 936539L,
-936557L, 936577L, 936587L, 936599L, 936619L, 936647L, 936659L, 936667L, 936673L,
-936679L, 936697L, 936709L, 936713L, 936731L, 936737L, 936739L, 936769L, 936773L,
-936779L, 936797L, 936811L, 936827L, 936869L, 936889L, 936907L, 936911L, 936917L,
-936919L, 936937L, 936941L, 936953L, 936967L, 937003L, 937007L, 937009L, 937031L,
-937033L, 937049L, 937067L, 937121L, 937127L, 937147L, 937151L, 937171L, 937187L,
-937207L, 937229L, 937231L, 937241L, 937243L, 937253L, 937331L, 937337L, 937351L,
-937373L, 937379L, 937421L, 937429L, 937459L, 937463L, 937477L, 937481L, 937501L,
-937511L, 937537L, 937571L, 937577L, 937589L, 937591L, 937613L, 937627L, 937633L,
-937637L, 937639L, 937661L, 937663L, 937667L, 937679L, 937681L, 937693L, 937709L,
-937721L, 937747L, 937751L, 937777L, 937789L, 937801L, 937813L, 937819L, 937823L,
-937841L, 937847L, 937877L, 937883L, 937891L, 937901L, 937903L, 937919L, 937927L,
-937943L, 937949L, 937969L, 937991L, 938017L, 938023L, 938027L, 938033L, 938051L,
-938053L, 938057L, 938059L, 938071L, 938083L, 938089L, 938099L, 938107L, 938117L,
-938129L, 938183L, 938207L, 938219L, 938233L, 938243L, 938251L, 938257L, 938263L,
-938279L, 938293L, 938309L, 938323L, 938341L, 938347L, 938351L, 938359L, 938369L,
-938387L, 938393L, 938437L, 938447L, 938453L, 938459L, 938491L, 938507L, 938533L,
-938537L, 938563L, 938569L, 938573L, 938591L, 938611L, 938617L, 938659L, 938677L,
-938681L, 938713L, 938747L, 938761L, 938803L, 938807L, 938827L, 938831L, 938843L,
-938857L, 938869L, 938879L, 938881L, 938921L, 938939L, 938947L, 938953L, 938963L,
-938969L, 938981L, 938983L, 938989L, 939007L, 939011L, 939019L, 939061L, 939089L,
-939091L, 939109L, 939119L, 939121L, 939157L, 939167L, 939179L, 939181L, 939193L,
-939203L, 939229L, 939247L, 939287L, 939293L, 939299L, 939317L, 939347L, 939349L,
-939359L, 939361L, 939373L, 939377L, 939391L, 939413L, 939431L, 939439L, 939443L,
-939451L, 939469L, 939487L, 939511L, 939551L, 939581L, 939599L, 939611L, 939613L,
-939623L, 939649L, 939661L, 939677L, 939707L, 939713L, 939737L, 939739L, 939749L,
-939767L, 939769L, 939773L, 939791L, 939793L, 939823L, 939839L, 939847L, 939853L,
-939871L, 939881L, 939901L, 939923L, 939931L, 939971L, 939973L, 939989L, 939997L,
-940001L, 940003L, 940019L, 940031L, 940067L, 940073L, 940087L, 940097L, 940127L,
-940157L, 940169L, 940183L, 940189L, 940201L, 940223L, 940229L, 940241L, 940249L,
-940259L, 940271L, 940279L, 940297L, 940301L, 940319L, 940327L, 940349L, 940351L,
-940361L, 940369L, 940399L, 940403L, 940421L, 940469L, 940477L, 940483L, 940501L,
-940523L, 940529L, 940531L, 940543L, 940547L, 940549L, 940553L, 940573L, 940607L,
-940619L, 940649L, 940669L, 940691L, 940703L, 940721L, 940727L, 940733L, 940739L,
-940759L, 940781L, 940783L, 940787L, 940801L, 940813L, 940817L, 940829L, 940853L,
-940871L, 940879L, 940889L, 940903L, 940913L, 940921L, 940931L, 940949L, 940957L,
-940981L, 940993L, 941009L, 941011L, 941023L, 941027L, 941041L, 941093L, 941099L,
-941117L, 941119L, 941123L, 941131L, 941153L, 941159L, 941167L, 941179L, 941201L,
-941207L, 941209L, 941221L, 941249L, 941251L, 941263L, 941267L, 941299L, 941309L,
-941323L, 941329L, 941351L, 941359L, 941383L, 941407L, 941429L, 941441L, 941449L,
-941453L, 941461L, 941467L, 941471L, 941489L, 941491L, 941503L, 941509L, 941513L,
-941519L, 941537L, 941557L, 941561L, 941573L, 941593L, 941599L, 941609L, 941617L,
-941641L, 941653L, 941663L, 941669L, 941671L, 941683L, 941701L, 941723L, 941737L,
-941741L, 941747L, 941753L, 941771L, 941791L, 941813L, 941839L, 941861L, 941879L,
-941903L, 941911L, 941929L, 941933L, 941947L, 941971L, 941981L, 941989L, 941999L,
-942013L, 942017L, 942031L, 942037L, 942041L, 942043L, 942049L, 942061L, 942079L,
-942091L, 942101L, 942113L, 942143L, 942163L, 942167L, 942169L, 942187L, 942199L,
-942217L, 942223L, 942247L, 942257L, 942269L, 942301L, 942311L, 942313L, 942317L,
-942341L, 942367L, 942371L, 942401L, 942433L, 942437L, 942439L, 942449L, 942479L,
-942509L, 942521L, 942527L, 942541L, 942569L, 942577L, 942583L, 942593L, 942607L,
-942637L, 942653L, 942659L, 942661L, 942691L, 942709L, 942719L, 942727L, 942749L,
-942763L, 942779L, 942787L, 942811L, 942827L, 942847L, 942853L, 942857L, 942859L,
-942869L, 942883L, 942889L, 942899L, 942901L, 942917L, 942943L, 942979L, 942983L,
-943003L, 943009L, 943013L, 943031L, 943043L, 943057L, 943073L, 943079L, 943081L,
-943091L, 943097L, 943127L, 943139L, 943153L, 943157L, 943183L, 943199L, 943213L,
-943219L, 943231L, 943249L, 943273L, 943277L, 943289L, 943301L, 943303L, 943307L,
-943321L, 943343L, 943357L, 943363L, 943367L, 943373L, 943387L, 943403L, 943409L,
-943421L, 943429L, 943471L, 943477L, 943499L, 943511L, 943541L, 943543L, 943567L,
-943571L, 943589L, 943601L, 943603L, 943637L, 943651L, 943693L, 943699L, 943729L,
-943741L, 943751L, 943757L, 943763L, 943769L, 943777L, 943781L, 943783L, 943799L,
-943801L, 943819L, 943837L, 943841L, 943843L, 943849L, 943871L, 943903L, 943909L,
-943913L, 943931L, 943951L, 943967L, 944003L, 944017L, 944029L, 944039L, 944071L,
-944077L, 944123L, 944137L, 944143L, 944147L, 944149L, 944161L, 944179L, 944191L,
-944233L, 944239L, 944257L, 944261L, 944263L, 944297L, 944309L, 944329L, 944369L,
-944387L, 944389L, 944393L, 944399L, 944417L, 944429L, 944431L, 944453L, 944467L,
-944473L, 944491L, 944497L, 944519L, 944521L, 944527L, 944533L, 944543L, 944551L,
-944561L, 944563L, 944579L, 944591L, 944609L, 944621L, 944651L, 944659L, 944677L,
-944687L, 944689L, 944701L, 944711L, 944717L, 944729L, 944731L, 944773L, 944777L,
-944803L, 944821L, 944833L, 944857L, 944873L, 944887L, 944893L, 944897L, 944899L,
-944929L, 944953L, 944963L, 944969L, 944987L, 945031L, 945037L, 945059L, 945089L,
-945103L, 945143L, 945151L, 945179L, 945209L, 945211L, 945227L, 945233L, 945289L,
-945293L, 945331L, 945341L, 945349L, 945359L, 945367L, 945377L, 945389L, 945391L,
-945397L, 945409L, 945431L, 945457L, 945463L, 945473L, 945479L, 945481L, 945521L,
-945547L, 945577L, 945587L, 945589L, 945601L, 945629L, 945631L, 945647L, 945671L,
-945673L, 945677L, 945701L, 945731L, 945733L, 945739L, 945767L, 945787L, 945799L,
-945809L, 945811L, 945817L, 945823L, 945851L, 945881L, 945883L, 945887L, 945899L,
-945907L, 945929L, 945937L, 945941L, 945943L, 945949L, 945961L, 945983L, 946003L,
-946021L, 946031L, 946037L, 946079L, 946081L, 946091L, 946093L, 946109L, 946111L,
-946123L, 946133L, 946163L, 946177L, 946193L, 946207L, 946223L, 946249L, 946273L,
-946291L, 946307L, 946327L, 946331L, 946367L, 946369L, 946391L, 946397L, 946411L,
-946417L, 946453L, 946459L, 946469L, 946487L, 946489L, 946507L, 946511L, 946513L,
-946549L, 946573L, 946579L, 946607L, 946661L, 946663L, 946667L, 946669L, 946681L,
-946697L, 946717L, 946727L, 946733L, 946741L, 946753L, 946769L, 946783L, 946801L,
-946819L, 946823L, 946853L, 946859L, 946861L, 946873L, 946877L, 946901L, 946919L,
-946931L, 946943L, 946949L, 946961L, 946969L, 946987L, 946993L, 946997L, 947027L,
-947033L, 947083L, 947119L, 947129L, 947137L, 947171L, 947183L, 947197L, 947203L,
-947239L, 947263L, 947299L, 947327L, 947341L, 947351L, 947357L, 947369L, 947377L,
-947381L, 947383L, 947389L, 947407L, 947411L, 947413L, 947417L, 947423L, 947431L,
-947449L, 947483L, 947501L, 947509L, 947539L, 947561L, 947579L, 947603L, 947621L,
-947627L, 947641L, 947647L, 947651L, 947659L, 947707L, 947711L, 947719L, 947729L,
-947741L, 947743L, 947747L, 947753L, 947773L, 947783L, 947803L, 947819L, 947833L,
-947851L, 947857L, 947861L, 947873L, 947893L, 947911L, 947917L, 947927L, 947959L,
-947963L, 947987L, 948007L, 948019L, 948029L, 948041L, 948049L, 948053L, 948061L,
-948067L, 948089L, 948091L, 948133L, 948139L, 948149L, 948151L, 948169L, 948173L,
-948187L, 948247L, 948253L, 948263L, 948281L, 948287L, 948293L, 948317L, 948331L,
-948349L, 948377L, 948391L, 948401L, 948403L, 948407L, 948427L, 948439L, 948443L,
-948449L, 948457L, 948469L, 948487L, 948517L, 948533L, 948547L, 948551L, 948557L,
-948581L, 948593L, 948659L, 948671L, 948707L, 948713L, 948721L, 948749L, 948767L,
-948797L, 948799L, 948839L, 948847L, 948853L, 948877L, 948887L, 948901L, 948907L,
-948929L, 948943L, 948947L, 948971L, 948973L, 948989L, 949001L, 949019L, 949021L,
-949033L, 949037L, 949043L, 949051L, 949111L, 949121L, 949129L, 949147L, 949153L,
-949159L, 949171L, 949211L, 949213L, 949241L, 949243L, 949253L, 949261L, 949303L,
-949307L, 949381L, 949387L, 949391L, 949409L, 949423L, 949427L, 949439L, 949441L,
-949451L, 949453L, 949471L, 949477L, 949513L, 949517L, 949523L, 949567L, 949583L,
-949589L, 949607L, 949609L, 949621L, 949631L, 949633L, 949643L, 949649L, 949651L,
-949667L, 949673L, 949687L, 949691L, 949699L, 949733L, 949759L, 949771L, 949777L,
-949789L, 949811L, 949849L, 949853L, 949889L, 949891L, 949903L, 949931L, 949937L,
-949939L, 949951L, 949957L, 949961L, 949967L, 949973L, 949979L, 949987L, 949997L,
-950009L, 950023L, 950029L, 950039L, 950041L, 950071L, 950083L, 950099L, 950111L,
-950149L, 950161L, 950177L, 950179L, 950207L, 950221L, 950227L, 950231L, 950233L,
-950239L, 950251L, 950269L, 950281L, 950329L, 950333L, 950347L, 950357L, 950363L,
-950393L, 950401L, 950423L, 950447L, 950459L, 950461L, 950473L, 950479L, 950483L,
-950497L, 950501L, 950507L, 950519L, 950527L, 950531L, 950557L, 950569L, 950611L,
-950617L, 950633L, 950639L, 950647L, 950671L, 950681L, 950689L, 950693L, 950699L,
-950717L, 950723L, 950737L, 950743L, 950753L, 950783L, 950791L, 950809L, 950813L,
-950819L, 950837L, 950839L, 950867L, 950869L, 950879L, 950921L, 950927L, 950933L,
-950947L, 950953L, 950959L, 950993L, 951001L, 951019L, 951023L, 951029L, 951047L,
-951053L, 951059L, 951061L, 951079L, 951089L, 951091L, 951101L, 951107L, 951109L,
-951131L, 951151L, 951161L, 951193L, 951221L, 951259L, 951277L, 951281L, 951283L,
-951299L, 951331L, 951341L, 951343L, 951361L, 951367L, 951373L, 951389L, 951407L,
-951413L, 951427L, 951437L, 951449L, 951469L, 951479L, 951491L, 951497L, 951553L,
-951557L, 951571L, 951581L, 951583L, 951589L, 951623L, 951637L, 951641L, 951647L,
-951649L, 951659L, 951689L, 951697L, 951749L, 951781L, 951787L, 951791L, 951803L,
-951829L, 951851L, 951859L, 951887L, 951893L, 951911L, 951941L, 951943L, 951959L,
-951967L, 951997L, 952001L, 952009L, 952037L, 952057L, 952073L, 952087L, 952097L,
-952111L, 952117L, 952123L, 952129L, 952141L, 952151L, 952163L, 952169L, 952183L,
-952199L, 952207L, 952219L, 952229L, 952247L, 952253L, 952277L, 952279L, 952291L,
-952297L, 952313L, 952349L, 952363L, 952379L, 952381L, 952397L, 952423L, 952429L,
-952439L, 952481L, 952487L, 952507L, 952513L, 952541L, 952547L, 952559L, 952573L,
-952583L, 952597L, 952619L, 952649L, 952657L, 952667L, 952669L, 952681L, 952687L,
-952691L, 952709L, 952739L, 952741L, 952753L, 952771L, 952789L, 952811L, 952813L,
-952823L, 952829L, 952843L, 952859L, 952873L, 952877L, 952883L, 952921L, 952927L,
-952933L, 952937L, 952943L, 952957L, 952967L, 952979L, 952981L, 952997L, 953023L,
-953039L, 953041L, 953053L, 953077L, 953081L, 953093L, 953111L, 953131L, 953149L,
-953171L, 953179L, 953191L, 953221L, 953237L, 953243L, 953261L, 953273L, 953297L,
-953321L, 953333L, 953341L, 953347L, 953399L, 953431L, 953437L, 953443L, 953473L,
-953483L, 953497L, 953501L, 953503L, 953507L, 953521L, 953539L, 953543L, 953551L,
-953567L, 953593L, 953621L, 953639L, 953647L, 953651L, 953671L, 953681L, 953699L,
-953707L, 953731L, 953747L, 953773L, 953789L, 953791L, 953831L, 953851L, 953861L,
-953873L, 953881L, 953917L, 953923L, 953929L, 953941L, 953969L, 953977L, 953983L,
-953987L, 954001L, 954007L, 954011L, 954043L, 954067L, 954097L, 954103L, 954131L,
-954133L, 954139L, 954157L, 954167L, 954181L, 954203L, 954209L, 954221L, 954229L,
-954253L, 954257L, 954259L, 954263L, 954269L, 954277L, 954287L, 954307L, 954319L,
-954323L, 954367L, 954377L, 954379L, 954391L, 954409L, 954433L, 954451L, 954461L,
-954469L, 954491L, 954497L, 954509L, 954517L, 954539L, 954571L, 954599L, 954619L,
-954623L, 954641L, 954649L, 954671L, 954677L, 954697L, 954713L, 954719L, 954727L,
-954743L, 954757L, 954763L, 954827L, 954829L, 954847L, 954851L, 954853L, 954857L,
-954869L, 954871L, 954911L, 954917L, 954923L, 954929L, 954971L, 954973L, 954977L,
-954979L, 954991L, 955037L, 955039L, 955051L, 955061L, 955063L, 955091L, 955093L,
-955103L, 955127L, 955139L, 955147L, 955153L, 955183L, 955193L, 955211L, 955217L,
-955223L, 955243L, 955261L, 955267L, 955271L, 955277L, 955307L, 955309L, 955313L,
-955319L, 955333L, 955337L, 955363L, 955379L, 955391L, 955433L, 955439L, 955441L,
-955457L, 955469L, 955477L, 955481L, 955483L, 955501L, 955511L, 955541L, 955601L,
-955607L, 955613L, 955649L, 955657L, 955693L, 955697L, 955709L, 955711L, 955727L,
-955729L, 955769L, 955777L, 955781L, 955793L, 955807L, 955813L, 955819L, 955841L,
-955853L, 955879L, 955883L, 955891L, 955901L, 955919L, 955937L, 955939L, 955951L,
-955957L, 955963L, 955967L, 955987L, 955991L, 955993L, 956003L, 956051L, 956057L,
-956083L, 956107L, 956113L, 956119L, 956143L, 956147L, 956177L, 956231L, 956237L,
-956261L, 956269L, 956273L, 956281L, 956303L, 956311L, 956341L, 956353L, 956357L,
-956377L, 956383L, 956387L, 956393L, 956399L, 956401L, 956429L, 956477L, 956503L,
-956513L, 956521L, 956569L, 956587L, 956617L, 956633L, 956689L, 956699L, 956713L,
-956723L, 956749L, 956759L, 956789L, 956801L, 956831L, 956843L, 956849L, 956861L,
-956881L, 956903L, 956909L, 956929L, 956941L, 956951L, 956953L, 956987L, 956993L,
-956999L, 957031L, 957037L, 957041L, 957043L, 957059L, 957071L, 957091L, 957097L,
-957107L, 957109L, 957119L, 957133L, 957139L, 957161L, 957169L, 957181L, 957193L,
-957211L, 957221L, 957241L, 957247L, 957263L, 957289L, 957317L, 957331L, 957337L,
-957349L, 957361L, 957403L, 957409L, 957413L, 957419L, 957431L, 957433L, 957499L,
-957529L, 957547L, 957553L, 957557L, 957563L, 957587L, 957599L, 957601L, 957611L,
-957641L, 957643L, 957659L, 957701L, 957703L, 957709L, 957721L, 957731L, 957751L,
-957769L, 957773L, 957811L, 957821L, 957823L, 957851L, 957871L, 957877L, 957889L,
-957917L, 957937L, 957949L, 957953L, 957959L, 957977L, 957991L, 958007L, 958021L,
-958039L, 958043L, 958049L, 958051L, 958057L, 958063L, 958121L, 958123L, 958141L,
-958159L, 958163L, 958183L, 958193L, 958213L, 958259L, 958261L, 958289L, 958313L,
-958319L, 958327L, 958333L, 958339L, 958343L, 958351L, 958357L, 958361L, 958367L,
-958369L, 958381L, 958393L, 958423L, 958439L, 958459L, 958481L, 958487L, 958499L,
-958501L, 958519L, 958523L, 958541L, 958543L, 958547L, 958549L, 958553L, 958577L,
-958609L, 958627L, 958637L, 958667L, 958669L, 958673L, 958679L, 958687L, 958693L,
-958729L, 958739L, 958777L, 958787L, 958807L, 958819L, 958829L, 958843L, 958849L,
-958871L, 958877L, 958883L, 958897L, 958901L, 958921L, 958931L, 958933L, 958957L,
-958963L, 958967L, 958973L, 959009L, 959083L, 959093L, 959099L, 959131L, 959143L,
-959149L, 959159L, 959173L, 959183L, 959207L, 959209L, 959219L, 959227L, 959237L,
-959263L, 959267L, 959269L, 959279L, 959323L, 959333L, 959339L, 959351L, 959363L,
-959369L, 959377L, 959383L, 959389L, 959449L, 959461L, 959467L, 959471L, 959473L,
-959477L, 959479L, 959489L, 959533L, 959561L, 959579L, 959597L, 959603L, 959617L,
-959627L, 959659L, 959677L, 959681L, 959689L, 959719L, 959723L, 959737L, 959759L,
-959773L, 959779L, 959801L, 959809L, 959831L, 959863L, 959867L, 959869L, 959873L,
-959879L, 959887L, 959911L, 959921L, 959927L, 959941L, 959947L, 959953L, 959969L,
-960017L, 960019L, 960031L, 960049L, 960053L, 960059L, 960077L, 960119L, 960121L,
-960131L, 960137L, 960139L, 960151L, 960173L, 960191L, 960199L, 960217L, 960229L,
-960251L, 960259L, 960293L, 960299L, 960329L, 960331L, 960341L, 960353L, 960373L,
-960383L, 960389L, 960419L, 960467L, 960493L, 960497L, 960499L, 960521L, 960523L,
-960527L, 960569L, 960581L, 960587L, 960593L, 960601L, 960637L, 960643L, 960647L,
-960649L, 960667L, 960677L, 960691L, 960703L, 960709L, 960737L, 960763L, 960793L,
-960803L, 960809L, 960829L, 960833L, 960863L, 960889L, 960931L, 960937L, 960941L,
-960961L, 960977L, 960983L, 960989L, 960991L, 961003L, 961021L, 961033L, 961063L,
-961067L, 961069L, 961073L, 961087L, 961091L, 961097L, 961099L, 961109L, 961117L,
-961123L, 961133L, 961139L, 961141L, 961151L, 961157L, 961159L, 961183L, 961187L,
-961189L, 961201L, 961241L, 961243L, 961273L, 961277L, 961283L, 961313L, 961319L,
-961339L, 961393L, 961397L, 961399L, 961427L, 961447L, 961451L, 961453L, 961459L,
-961487L, 961507L, 961511L, 961529L, 961531L, 961547L, 961549L, 961567L, 961601L,
-961613L, 961619L, 961627L, 961633L, 961637L, 961643L, 961657L, 961661L, 961663L,
-961679L, 961687L, 961691L, 961703L, 961729L, 961733L, 961739L, 961747L, 961757L,
-961769L, 961777L, 961783L, 961789L, 961811L, 961813L, 961817L, 961841L, 961847L,
-961853L, 961861L, 961871L, 961879L, 961927L, 961937L, 961943L, 961957L, 961973L,
-961981L, 961991L, 961993L, 962009L, 962011L, 962033L, 962041L, 962051L, 962063L,
-962077L, 962099L, 962119L, 962131L, 962161L, 962177L, 962197L, 962233L, 962237L,
-962243L, 962257L, 962267L, 962303L, 962309L, 962341L, 962363L, 962413L, 962417L,
-962431L, 962441L, 962447L, 962459L, 962461L, 962471L, 962477L, 962497L, 962503L,
-962509L, 962537L, 962543L, 962561L, 962569L, 962587L, 962603L, 962609L, 962617L,
-962623L, 962627L, 962653L, 962669L, 962671L, 962677L, 962681L, 962683L, 962737L,
-962743L, 962747L, 962779L, 962783L, 962789L, 962791L, 962807L, 962837L, 962839L,
-962861L, 962867L, 962869L, 962903L, 962909L, 962911L, 962921L, 962959L, 962963L,
-962971L, 962993L, 963019L, 963031L, 963043L, 963047L, 963097L, 963103L, 963121L,
-963143L, 963163L, 963173L, 963181L, 963187L, 963191L, 963211L, 963223L, 963227L,
-963239L, 963241L, 963253L, 963283L, 963299L, 963301L, 963311L, 963323L, 963331L,
-963341L, 963343L, 963349L, 963367L, 963379L, 963397L, 963419L, 963427L, 963461L,
-963481L, 963491L, 963497L, 963499L, 963559L, 963581L, 963601L, 963607L, 963629L,
-963643L, 963653L, 963659L, 963667L, 963689L, 963691L, 963701L, 963707L, 963709L,
-963719L, 963731L, 963751L, 963761L, 963763L, 963779L, 963793L, 963799L, 963811L,
-963817L, 963839L, 963841L, 963847L, 963863L, 963871L, 963877L, 963899L, 963901L,
-963913L, 963943L, 963973L, 963979L, 964009L, 964021L, 964027L, 964039L, 964049L,
-964081L, 964097L, 964133L, 964151L, 964153L, 964199L, 964207L, 964213L, 964217L,
-964219L, 964253L, 964259L, 964261L, 964267L, 964283L, 964289L, 964297L, 964303L,
-964309L, 964333L, 964339L, 964351L, 964357L, 964363L, 964373L, 964417L, 964423L,
-964433L, 964463L, 964499L, 964501L, 964507L, 964517L, 964519L, 964531L, 964559L,
-964571L, 964577L, 964583L, 964589L, 964609L, 964637L, 964661L, 964679L, 964693L,
-964697L, 964703L, 964721L, 964753L, 964757L, 964783L, 964787L, 964793L, 964823L,
-964829L, 964861L, 964871L, 964879L, 964883L, 964889L, 964897L, 964913L, 964927L,
-964933L, 964939L, 964967L, 964969L, 964973L, 964981L, 965023L, 965047L, 965059L,
-965087L, 965089L, 965101L, 965113L, 965117L, 965131L, 965147L, 965161L, 965171L,
-965177L, 965179L, 965189L, 965191L, 965197L, 965201L, 965227L, 965233L, 965249L,
-965267L, 965291L, 965303L, 965317L, 965329L, 965357L, 965369L, 965399L, 965401L,
-965407L, 965411L, 965423L, 965429L, 965443L, 965453L, 965467L, 965483L, 965491L,
-965507L, 965519L, 965533L, 965551L, 965567L, 965603L, 965611L, 965621L, 965623L,
-965639L, 965647L, 965659L, 965677L, 965711L, 965749L, 965759L, 965773L, 965777L,
-965779L, 965791L, 965801L, 965843L, 965851L, 965857L, 965893L, 965927L, 965953L,
-965963L, 965969L, 965983L, 965989L, 966011L, 966013L, 966029L, 966041L, 966109L,
-966113L, 966139L, 966149L, 966157L, 966191L, 966197L, 966209L, 966211L, 966221L,
-966227L, 966233L, 966241L, 966257L, 966271L, 966293L, 966307L, 966313L, 966319L,
-966323L, 966337L, 966347L, 966353L, 966373L, 966377L, 966379L, 966389L, 966401L,
-966409L, 966419L, 966431L, 966439L, 966463L, 966481L, 966491L, 966499L, 966509L,
-966521L, 966527L, 966547L, 966557L, 966583L, 966613L, 966617L, 966619L, 966631L,
-966653L, 966659L, 966661L, 966677L, 966727L, 966751L, 966781L, 966803L, 966817L,
-966863L, 966869L, 966871L, 966883L, 966893L, 966907L, 966913L, 966919L, 966923L,
-966937L, 966961L, 966971L, 966991L, 966997L, 967003L, 967019L, 967049L, 967061L,
-967111L, 967129L, 967139L, 967171L, 967201L, 967229L, 967259L, 967261L, 967289L,
-967297L, 967319L, 967321L, 967327L, 967333L, 967349L, 967361L, 967363L, 967391L,
-967397L, 967427L, 967429L, 967441L, 967451L, 967459L, 967481L, 967493L, 967501L,
-967507L, 967511L, 967529L, 967567L, 967583L, 967607L, 967627L, 967663L, 967667L,
-967693L, 967699L, 967709L, 967721L, 967739L, 967751L, 967753L, 967763L, 967781L,
-967787L, 967819L, 967823L, 967831L, 967843L, 967847L, 967859L, 967873L, 967877L,
-967903L, 967919L, 967931L, 967937L, 967951L, 967961L, 967979L, 967999L, 968003L,
-968017L, 968021L, 968027L, 968041L, 968063L, 968089L, 968101L, 968111L, 968113L,
-968117L, 968137L, 968141L, 968147L, 968159L, 968173L, 968197L, 968213L, 968237L,
-968239L, 968251L, 968263L, 968267L, 968273L, 968291L, 968299L, 968311L, 968321L,
-968329L, 968333L, 968353L, 968377L, 968381L, 968389L, 968419L, 968423L, 968431L,
-968437L, 968459L, 968467L, 968479L, 968501L, 968503L, 968519L, 968521L, 968537L,
-968557L, 968567L, 968573L, 968593L, 968641L, 968647L, 968659L, 968663L, 968689L,
-968699L, 968713L, 968729L, 968731L, 968761L, 968801L, 968809L, 968819L, 968827L,
-968831L, 968857L, 968879L, 968897L, 968909L, 968911L, 968917L, 968939L, 968959L,
-968963L, 968971L, 969011L, 969037L, 969041L, 969049L, 969071L, 969083L, 969097L,
-969109L, 969113L, 969131L, 969139L, 969167L, 969179L, 969181L, 969233L, 969239L,
-969253L, 969257L, 969259L, 969271L, 969301L, 969341L, 969343L, 969347L, 969359L,
-969377L, 969403L, 969407L, 969421L, 969431L, 969433L, 969443L, 969457L, 969461L,
-969467L, 969481L, 969497L, 969503L, 969509L, 969533L, 969559L, 969569L, 969593L,
-969599L, 969637L, 969641L, 969667L, 969671L, 969677L, 969679L, 969713L, 969719L,
-969721L, 969743L, 969757L, 969763L, 969767L, 969791L, 969797L, 969809L, 969821L,
-969851L, 969863L, 969869L, 969877L, 969889L, 969907L, 969911L, 969919L, 969923L,
-969929L, 969977L, 969989L, 970027L, 970031L, 970043L, 970051L, 970061L, 970063L,
-970069L, 970087L, 970091L, 970111L, 970133L, 970147L, 970201L, 970213L, 970217L,
-970219L, 970231L, 970237L, 970247L, 970259L, 970261L, 970267L, 970279L, 970297L,
-970303L, 970313L, 970351L, 970391L, 970421L, 970423L, 970433L, 970441L, 970447L,
-970457L, 970469L, 970481L, 970493L, 970537L, 970549L, 970561L, 970573L, 970583L,
-970603L, 970633L, 970643L, 970657L, 970667L, 970687L, 970699L, 970721L, 970747L,
-970777L, 970787L, 970789L, 970793L, 970799L, 970813L, 970817L, 970829L, 970847L,
-970859L, 970861L, 970867L, 970877L, 970883L, 970903L, 970909L, 970927L, 970939L,
-970943L, 970961L, 970967L, 970969L, 970987L, 970997L, 970999L, 971021L, 971027L,
-971029L, 971039L, 971051L, 971053L, 971063L, 971077L, 971093L, 971099L, 971111L,
-971141L, 971143L, 971149L, 971153L, 971171L, 971177L, 971197L, 971207L, 971237L,
-971251L, 971263L, 971273L, 971279L, 971281L, 971291L, 971309L, 971339L, 971353L,
-971357L, 971371L, 971381L, 971387L, 971389L, 971401L, 971419L, 971429L, 971441L,
-971473L, 971479L, 971483L, 971491L, 971501L, 971513L, 971521L, 971549L, 971561L,
-971563L, 971569L, 971591L, 971639L, 971651L, 971653L, 971683L, 971693L, 971699L,
-971713L, 971723L, 971753L, 971759L, 971767L, 971783L, 971821L, 971833L, 971851L,
-971857L, 971863L, 971899L, 971903L, 971917L, 971921L, 971933L, 971939L, 971951L,
-971959L, 971977L, 971981L, 971989L, 972001L, 972017L, 972029L, 972031L, 972047L,
-972071L, 972079L, 972091L, 972113L, 972119L, 972121L, 972131L, 972133L, 972137L,
-972161L, 972163L, 972197L, 972199L, 972221L, 972227L, 972229L, 972259L, 972263L,
-972271L, 972277L, 972313L, 972319L, 972329L, 972337L, 972343L, 972347L, 972353L,
-972373L, 972403L, 972407L, 972409L, 972427L, 972431L, 972443L, 972469L, 972473L,
-972481L, 972493L, 972533L, 972557L, 972577L, 972581L, 972599L, 972611L, 972613L,
-972623L, 972637L, 972649L, 972661L, 972679L, 972683L, 972701L, 972721L, 972787L,
-972793L, 972799L, 972823L, 972827L, 972833L, 972847L, 972869L, 972887L, 972899L,
-972901L, 972941L, 972943L, 972967L, 972977L, 972991L, 973001L, 973003L, 973031L,
-973033L, 973051L, 973057L, 973067L, 973069L, 973073L, 973081L, 973099L, 973129L,
-973151L, 973169L, 973177L, 973187L, 973213L, 973253L, 973277L, 973279L, 973283L,
-973289L, 973321L, 973331L, 973333L, 973367L, 973373L, 973387L, 973397L, 973409L,
-973411L, 973421L, 973439L, 973459L, 973487L, 973523L, 973529L, 973537L, 973547L,
-973561L, 973591L, 973597L, 973631L, 973657L, 973669L, 973681L, 973691L, 973727L,
-973757L, 973759L, 973781L, 973787L, 973789L, 973801L, 973813L, 973823L, 973837L,
-973853L, 973891L, 973897L, 973901L, 973919L, 973957L, 974003L, 974009L, 974033L,
-974041L, 974053L, 974063L, 974089L, 974107L, 974123L, 974137L, 974143L, 974147L,
-974159L, 974161L, 974167L, 974177L, 974179L, 974189L, 974213L, 974249L, 974261L,
-974269L, 974273L, 974279L, 974293L, 974317L, 974329L, 974359L, 974383L, 974387L,
-974401L, 974411L, 974417L, 974419L, 974431L, 974437L, 974443L, 974459L, 974473L,
-974489L, 974497L, 974507L, 974513L, 974531L, 974537L, 974539L, 974551L, 974557L,
-974563L, 974581L, 974591L, 974599L, 974651L, 974653L, 974657L, 974707L, 974711L,
-974713L, 974737L, 974747L, 974749L, 974761L, 974773L, 974803L, 974819L, 974821L,
-974837L, 974849L, 974861L, 974863L, 974867L, 974873L, 974879L, 974887L, 974891L,
-974923L, 974927L, 974957L, 974959L, 974969L, 974971L, 974977L, 974983L, 974989L,
-974999L, 975011L, 975017L, 975049L, 975053L, 975071L, 975083L, 975089L, 975133L,
-975151L, 975157L, 975181L, 975187L, 975193L, 975199L, 975217L, 975257L, 975259L,
-975263L, 975277L, 975281L, 975287L, 975313L, 975323L, 975343L, 975367L, 975379L,
-975383L, 975389L, 975421L, 975427L, 975433L, 975439L, 975463L, 975493L, 975497L,
-975509L, 975521L, 975523L, 975551L, 975553L, 975581L, 975599L, 975619L, 975629L,
-975643L, 975649L, 975661L, 975671L, 975691L, 975701L, 975731L, 975739L, 975743L,
-975797L, 975803L, 975811L, 975823L, 975827L, 975847L, 975857L, 975869L, 975883L,
-975899L, 975901L, 975907L, 975941L, 975943L, 975967L, 975977L, 975991L, 976009L,
-976013L, 976033L, 976039L, 976091L, 976093L, 976103L, 976109L, 976117L, 976127L,
-976147L, 976177L, 976187L, 976193L, 976211L, 976231L, 976253L, 976271L, 976279L,
-976301L, 976303L, 976307L, 976309L, 976351L, 976369L, 976403L, 976411L, 976439L,
-976447L, 976453L, 976457L, 976471L, 976477L, 976483L, 976489L, 976501L, 976513L,
-976537L, 976553L, 976559L, 976561L, 976571L, 976601L, 976607L, 976621L, 976637L,
-976639L, 976643L, 976669L, 976699L, 976709L, 976721L, 976727L, 976777L, 976799L,
-976817L, 976823L, 976849L, 976853L, 976883L, 976909L, 976919L, 976933L, 976951L,
-976957L, 976991L, 977021L, 977023L, 977047L, 977057L, 977069L, 977087L, 977107L,
-977147L, 977149L, 977167L, 977183L, 977191L, 977203L, 977209L, 977233L, 977239L,
-977243L, 977257L, 977269L, 977299L, 977323L, 977351L, 977357L, 977359L, 977363L,
-977369L, 977407L, 977411L, 977413L, 977437L, 977447L, 977507L, 977513L, 977521L,
-977539L, 977567L, 977591L, 977593L, 977609L, 977611L, 977629L, 977671L, 977681L,
-977693L, 977719L, 977723L, 977747L, 977761L, 977791L, 977803L, 977813L, 977819L,
-977831L, 977849L, 977861L, 977881L, 977897L, 977923L, 977927L, 977971L, 978001L,
-978007L, 978011L, 978017L, 978031L, 978037L, 978041L, 978049L, 978053L, 978067L,
-978071L, 978073L, 978077L, 978079L, 978091L, 978113L, 978149L, 978151L, 978157L,
-978179L, 978181L, 978203L, 978209L, 978217L, 978223L, 978233L, 978239L, 978269L,
-978277L, 978283L, 978287L, 978323L, 978337L, 978343L, 978347L, 978349L, 978359L,
-978389L, 978403L, 978413L, 978427L, 978449L, 978457L, 978463L, 978473L, 978479L,
-978491L, 978511L, 978521L, 978541L, 978569L, 978599L, 978611L, 978617L, 978619L,
-978643L, 978647L, 978683L, 978689L, 978697L, 978713L, 978727L, 978743L, 978749L,
-978773L, 978797L, 978799L, 978821L, 978839L, 978851L, 978853L, 978863L, 978871L,
-978883L, 978907L, 978917L, 978931L, 978947L, 978973L, 978997L, 979001L, 979009L,
-979031L, 979037L, 979061L, 979063L, 979093L, 979103L, 979109L, 979117L, 979159L,
-979163L, 979171L, 979177L, 979189L, 979201L, 979207L, 979211L, 979219L, 979229L,
-979261L, 979273L, 979283L, 979291L, 979313L, 979327L, 979333L, 979337L, 979343L,
-979361L, 979369L, 979373L, 979379L, 979403L, 979423L, 979439L, 979457L, 979471L,
-979481L, 979519L, 979529L, 979541L, 979543L, 979549L, 979553L, 979567L, 979651L,
-979691L, 979709L, 979717L, 979747L, 979757L, 979787L, 979807L, 979819L, 979831L,
-979873L, 979883L, 979889L, 979907L, 979919L, 979921L, 979949L, 979969L, 979987L,
-980027L, 980047L, 980069L, 980071L, 980081L, 980107L, 980117L, 980131L, 980137L,
-980149L, 980159L, 980173L, 980179L, 980197L, 980219L, 980249L, 980261L, 980293L,
-980299L, 980321L, 980327L, 980363L, 980377L, 980393L, 980401L, 980417L, 980423L,
-980431L, 980449L, 980459L, 980471L, 980489L, 980491L, 980503L, 980549L, 980557L,
-980579L, 980587L, 980591L, 980593L, 980599L, 980621L, 980641L, 980677L, 980687L,
-980689L, 980711L, 980717L, 980719L, 980729L, 980731L, 980773L, 980801L, 980803L,
-980827L, 980831L, 980851L, 980887L, 980893L, 980897L, 980899L, 980909L, 980911L,
-980921L, 980957L, 980963L, 980999L, 981011L, 981017L, 981023L, 981037L, 981049L,
-981061L, 981067L, 981073L, 981077L, 981091L, 981133L, 981137L, 981139L, 981151L,
-981173L, 981187L, 981199L, 981209L, 981221L, 981241L, 981263L, 981271L, 981283L,
-981287L, 981289L, 981301L, 981311L, 981319L, 981373L, 981377L, 981391L, 981397L,
-981419L, 981437L, 981439L, 981443L, 981451L, 981467L, 981473L, 981481L, 981493L,
-981517L, 981523L, 981527L, 981569L, 981577L, 981587L, 981599L, 981601L, 981623L,
-981637L, 981653L, 981683L, 981691L, 981697L, 981703L, 981707L, 981713L, 981731L,
-981769L, 981797L, 981809L, 981811L, 981817L, 981823L, 981887L, 981889L, 981913L,
-981919L, 981941L, 981947L, 981949L, 981961L, 981979L, 981983L, 982021L, 982057L,
-982061L, 982063L, 982067L, 982087L, 982097L, 982099L, 982103L, 982117L, 982133L,
-982147L, 982151L, 982171L, 982183L, 982187L, 982211L, 982213L, 982217L, 982231L,
-982271L, 982273L, 982301L, 982321L, 982337L, 982339L, 982343L, 982351L, 982363L,
-982381L, 982393L, 982403L, 982453L, 982489L, 982493L, 982559L, 982571L, 982573L,
-982577L, 982589L, 982603L, 982613L, 982621L, 982633L, 982643L, 982687L, 982693L,
-982697L, 982703L, 982741L, 982759L, 982769L, 982777L, 982783L, 982789L, 982801L,
-982819L, 982829L, 982841L, 982843L, 982847L, 982867L, 982871L, 982903L, 982909L,
-982931L, 982939L, 982967L, 982973L, 982981L, 983063L, 983069L, 983083L, 983113L,
-983119L, 983123L, 983131L, 983141L, 983149L, 983153L, 983173L, 983179L, 983189L,
-983197L, 983209L, 983233L, 983239L, 983243L, 983261L, 983267L, 983299L, 983317L,
-983327L, 983329L, 983347L, 983363L, 983371L, 983377L, 983407L, 983429L, 983431L,
-983441L, 983443L, 983447L, 983449L, 983461L, 983491L, 983513L, 983519L, 983527L,
-983531L, 983533L, 983557L, 983579L, 983581L, 983597L, 983617L, 983659L, 983699L,
-983701L, 983737L, 983771L, 983777L, 983783L, 983789L, 983791L, 983803L, 983809L,
-983813L, 983819L, 983849L, 983861L, 983863L, 983881L, 983911L, 983923L, 983929L,
-983951L, 983987L, 983993L, 984007L, 984017L, 984037L, 984047L, 984059L, 984083L,
-984091L, 984119L, 984121L, 984127L, 984149L, 984167L, 984199L, 984211L, 984241L,
-984253L, 984299L, 984301L, 984307L, 984323L, 984329L, 984337L, 984341L, 984349L,
-984353L, 984359L, 984367L, 984383L, 984391L, 984397L, 984407L, 984413L, 984421L,
-984427L, 984437L, 984457L, 984461L, 984481L, 984491L, 984497L, 984539L, 984541L,
-984563L, 984583L, 984587L, 984593L, 984611L, 984617L, 984667L, 984689L, 984701L,
-984703L, 984707L, 984733L, 984749L, 984757L, 984761L, 984817L, 984847L, 984853L,
-984859L, 984877L, 984881L, 984911L, 984913L, 984917L, 984923L, 984931L, 984947L,
-984959L, 985003L, 985007L, 985013L, 985027L, 985057L, 985063L, 985079L, 985097L,
-985109L, 985121L, 985129L, 985151L, 985177L, 985181L, 985213L, 985219L, 985253L,
-985277L, 985279L, 985291L, 985301L, 985307L, 985331L, 985339L, 985351L, 985379L,
-985399L, 985403L, 985417L, 985433L, 985447L, 985451L, 985463L, 985471L, 985483L,
-985487L, 985493L, 985499L, 985519L, 985529L, 985531L, 985547L, 985571L, 985597L,
-985601L, 985613L, 985631L, 985639L, 985657L, 985667L, 985679L, 985703L, 985709L,
-985723L, 985729L, 985741L, 985759L, 985781L, 985783L, 985799L, 985807L, 985819L,
-985867L, 985871L, 985877L, 985903L, 985921L, 985937L, 985951L, 985969L, 985973L,
-985979L, 985981L, 985991L, 985993L, 985997L, 986023L, 986047L, 986053L, 986071L,
-986101L, 986113L, 986131L, 986137L, 986143L, 986147L, 986149L, 986177L, 986189L,
-986191L, 986197L, 986207L, 986213L, 986239L, 986257L, 986267L, 986281L, 986287L,
-986333L, 986339L, 986351L, 986369L, 986411L, 986417L, 986429L, 986437L, 986471L,
-986477L, 986497L, 986507L, 986509L, 986519L, 986533L, 986543L, 986563L, 986567L,
-986569L, 986581L, 986593L, 986597L, 986599L, 986617L, 986633L, 986641L, 986659L,
-986693L, 986707L, 986717L, 986719L, 986729L, 986737L, 986749L, 986759L, 986767L,
-986779L, 986801L, 986813L, 986819L, 986837L, 986849L, 986851L, 986857L, 986903L,
-986927L, 986929L, 986933L, 986941L, 986959L, 986963L, 986981L, 986983L, 986989L,
-987013L, 987023L, 987029L, 987043L, 987053L, 987061L, 987067L, 987079L, 987083L,
-987089L, 987097L, 987101L, 987127L, 987143L, 987191L, 987193L, 987199L, 987209L,
-987211L, 987227L, 987251L, 987293L, 987299L, 987313L, 987353L, 987361L, 987383L,
-987391L, 987433L, 987457L, 987463L, 987473L, 987491L, 987509L, 987523L, 987533L,
-987541L, 987559L, 987587L, 987593L, 987599L, 987607L, 987631L, 987659L, 987697L,
-987713L, 987739L, 987793L, 987797L, 987803L, 987809L, 987821L, 987851L, 987869L,
-987911L, 987913L, 987929L, 987941L, 987971L, 987979L, 987983L, 987991L, 987997L,
-988007L, 988021L, 988033L, 988051L, 988061L, 988067L, 988069L, 988093L, 988109L,
-988111L, 988129L, 988147L, 988157L, 988199L, 988213L, 988217L, 988219L, 988231L,
-988237L, 988243L, 988271L, 988279L, 988297L, 988313L, 988319L, 988321L, 988343L,
-988357L, 988367L, 988409L, 988417L, 988439L, 988453L, 988459L, 988483L, 988489L,
-988501L, 988511L, 988541L, 988549L, 988571L, 988577L, 988579L, 988583L, 988591L,
-988607L, 988643L, 988649L, 988651L, 988661L, 988681L, 988693L, 988711L, 988727L,
-988733L, 988759L, 988763L, 988783L, 988789L, 988829L, 988837L, 988849L, 988859L,
-988861L, 988877L, 988901L, 988909L, 988937L, 988951L, 988963L, 988979L, 989011L,
-989029L, 989059L, 989071L, 989081L, 989099L, 989119L, 989123L, 989171L, 989173L,
-989231L, 989239L, 989249L, 989251L, 989279L, 989293L, 989309L, 989321L, 989323L,
-989327L, 989341L, 989347L, 989353L, 989377L, 989381L, 989411L, 989419L, 989423L,
-989441L, 989467L, 989477L, 989479L, 989507L, 989533L, 989557L, 989561L, 989579L,
-989581L, 989623L, 989629L, 989641L, 989647L, 989663L, 989671L, 989687L, 989719L,
-989743L, 989749L, 989753L, 989761L, 989777L, 989783L, 989797L, 989803L, 989827L,
-989831L, 989837L, 989839L, 989869L, 989873L, 989887L, 989909L, 989917L, 989921L,
-989929L, 989939L, 989951L, 989959L, 989971L, 989977L, 989981L, 989999L, 990001L,
-990013L, 990023L, 990037L, 990043L, 990053L, 990137L, 990151L, 990163L, 990169L,
-990179L, 990181L, 990211L, 990239L, 990259L, 990277L, 990281L, 990287L, 990289L,
-990293L, 990307L, 990313L, 990323L, 990329L, 990331L, 990349L, 990359L, 990361L,
-990371L, 990377L, 990383L, 990389L, 990397L, 990463L, 990469L, 990487L, 990497L,
-990503L, 990511L, 990523L, 990529L, 990547L, 990559L, 990589L, 990593L, 990599L,
-990631L, 990637L, 990643L, 990673L, 990707L, 990719L, 990733L, 990761L, 990767L,
-990797L, 990799L, 990809L, 990841L, 990851L, 990881L, 990887L, 990889L, 990893L,
-990917L, 990923L, 990953L, 990961L, 990967L, 990973L, 990989L, 991009L, 991027L,
-991031L, 991037L, 991043L, 991057L, 991063L, 991069L, 991073L, 991079L, 991091L,
-991127L, 991129L, 991147L, 991171L, 991181L, 991187L, 991201L, 991217L, 991223L,
-991229L, 991261L, 991273L, 991313L, 991327L, 991343L, 991357L, 991381L, 991387L,
-991409L, 991427L, 991429L, 991447L, 991453L, 991483L, 991493L, 991499L, 991511L,
-991531L, 991541L, 991547L, 991567L, 991579L, 991603L, 991607L, 991619L, 991621L,
-991633L, 991643L, 991651L, 991663L, 991693L, 991703L, 991717L, 991723L, 991733L,
-991741L, 991751L, 991777L, 991811L, 991817L, 991867L, 991871L, 991873L, 991883L,
-991889L, 991901L, 991909L, 991927L, 991931L, 991943L, 991951L, 991957L, 991961L,
-991973L, 991979L, 991981L, 991987L, 991999L, 992011L, 992021L, 992023L, 992051L,
-992087L, 992111L, 992113L, 992129L, 992141L, 992153L, 992179L, 992183L, 992219L,
-992231L, 992249L, 992263L, 992267L, 992269L, 992281L, 992309L, 992317L, 992357L,
-992359L, 992363L, 992371L, 992393L, 992417L, 992429L, 992437L, 992441L, 992449L,
-992461L, 992513L, 992521L, 992539L, 992549L, 992561L, 992591L, 992603L, 992609L,
-992623L, 992633L, 992659L, 992689L, 992701L, 992707L, 992723L, 992737L, 992777L,
-992801L, 992809L, 992819L, 992843L, 992857L, 992861L, 992863L, 992867L, 992891L,
-992903L, 992917L, 992923L, 992941L, 992947L, 992963L, 992983L, 993001L, 993011L,
-993037L, 993049L, 993053L, 993079L, 993103L, 993107L, 993121L, 993137L, 993169L,
-993197L, 993199L, 993203L, 993211L, 993217L, 993233L, 993241L, 993247L, 993253L,
-993269L, 993283L, 993287L, 993319L, 993323L, 993341L, 993367L, 993397L, 993401L,
-993407L, 993431L, 993437L, 993451L, 993467L, 993479L, 993481L, 993493L, 993527L,
-993541L, 993557L, 993589L, 993611L, 993617L, 993647L, 993679L, 993683L, 993689L,
-993703L, 993763L, 993779L, 993781L, 993793L, 993821L, 993823L, 993827L, 993841L,
-993851L, 993869L, 993887L, 993893L, 993907L, 993913L, 993919L, 993943L, 993961L,
-993977L, 993983L, 993997L, 994013L, 994027L, 994039L, 994051L, 994067L, 994069L,
-994073L, 994087L, 994093L, 994141L, 994163L, 994181L, 994183L, 994193L, 994199L,
-994229L, 994237L, 994241L, 994247L, 994249L, 994271L, 994297L, 994303L, 994307L,
-994309L, 994319L, 994321L, 994337L, 994339L, 994363L, 994369L, 994391L, 994393L,
-994417L, 994447L, 994453L, 994457L, 994471L, 994489L, 994501L, 994549L, 994559L,
-994561L, 994571L, 994579L, 994583L, 994603L, 994621L, 994657L, 994663L, 994667L,
-994691L, 994699L, 994709L, 994711L, 994717L, 994723L, 994751L, 994769L, 994793L,
-994811L, 994813L, 994817L, 994831L, 994837L, 994853L, 994867L, 994871L, 994879L,
-994901L, 994907L, 994913L, 994927L, 994933L, 994949L, 994963L, 994991L, 994997L,
-995009L, 995023L, 995051L, 995053L, 995081L, 995117L, 995119L, 995147L, 995167L,
-995173L, 995219L, 995227L, 995237L, 995243L, 995273L, 995303L, 995327L, 995329L,
-995339L, 995341L, 995347L, 995363L, 995369L, 995377L, 995381L, 995387L, 995399L,
-995431L, 995443L, 995447L, 995461L, 995471L, 995513L, 995531L, 995539L, 995549L,
-995551L, 995567L, 995573L, 995587L, 995591L, 995593L, 995611L, 995623L, 995641L,
-995651L, 995663L, 995669L, 995677L, 995699L, 995713L, 995719L, 995737L, 995747L,
-995783L, 995791L, 995801L, 995833L, 995881L, 995887L, 995903L, 995909L, 995927L,
-995941L, 995957L, 995959L, 995983L, 995987L, 995989L, 996001L, 996011L, 996019L,
-996049L, 996067L, 996103L, 996109L, 996119L, 996143L, 996157L, 996161L, 996167L,
-996169L, 996173L, 996187L, 996197L, 996209L, 996211L, 996253L, 996257L, 996263L,
-996271L, 996293L, 996301L, 996311L, 996323L, 996329L, 996361L, 996367L, 996403L,
-996407L, 996409L, 996431L, 996461L, 996487L, 996511L, 996529L, 996539L, 996551L,
-996563L, 996571L, 996599L, 996601L, 996617L, 996629L, 996631L, 996637L, 996647L,
-996649L, 996689L, 996703L, 996739L, 996763L, 996781L, 996803L, 996811L, 996841L,
-996847L, 996857L, 996859L, 996871L, 996881L, 996883L, 996887L, 996899L, 996953L,
-996967L, 996973L, 996979L, 997001L, 997013L, 997019L, 997021L, 997037L, 997043L,
-997057L, 997069L, 997081L, 997091L, 997097L, 997099L, 997103L, 997109L, 997111L,
-997121L, 997123L, 997141L, 997147L, 997151L, 997153L, 997163L, 997201L, 997207L,
-997219L, 997247L, 997259L, 997267L, 997273L, 997279L, 997307L, 997309L, 997319L,
-997327L, 997333L, 997343L, 997357L, 997369L, 997379L, 997391L, 997427L, 997433L,
-997439L, 997453L, 997463L, 997511L, 997541L, 997547L, 997553L, 997573L, 997583L,
-997589L, 997597L, 997609L, 997627L, 997637L, 997649L, 997651L, 997663L, 997681L,
-997693L, 997699L, 997727L, 997739L, 997741L, 997751L, 997769L, 997783L, 997793L,
-997807L, 997811L, 997813L, 997877L, 997879L, 997889L, 997891L, 997897L, 997933L,
-997949L, 997961L, 997963L, 997973L, 997991L, 998009L, 998017L, 998027L, 998029L,
-998069L, 998071L, 998077L, 998083L, 998111L, 998117L, 998147L, 998161L, 998167L,
-998197L, 998201L, 998213L, 998219L, 998237L, 998243L, 998273L, 998281L, 998287L,
-998311L, 998329L, 998353L, 998377L, 998381L, 998399L, 998411L, 998419L, 998423L,
-998429L, 998443L, 998471L, 998497L, 998513L, 998527L, 998537L, 998539L, 998551L,
-998561L, 998617L, 998623L, 998629L, 998633L, 998651L, 998653L, 998681L, 998687L,
-998689L, 998717L, 998737L, 998743L, 998749L, 998759L, 998779L, 998813L, 998819L,
-998831L, 998839L, 998843L, 998857L, 998861L, 998897L, 998909L, 998917L, 998927L,
-998941L, 998947L, 998951L, 998957L, 998969L, 998983L, 998989L, 999007L, 999023L,
-999029L, 999043L, 999049L, 999067L, 999083L, 999091L, 999101L, 999133L, 999149L,
-999169L, 999181L, 999199L, 999217L, 999221L, 999233L, 999239L, 999269L, 999287L,
-999307L, 999329L, 999331L, 999359L, 999371L, 999377L, 999389L, 999431L, 999433L,
-999437L, 999451L, 999491L, 999499L, 999521L, 999529L, 999541L, 999553L, 999563L,
-999599L, 999611L, 999613L, 999623L, 999631L, 999653L, 999667L, 999671L, 999683L,
-999721L, 999727L, 999749L, 999763L, 999769L, 999773L, 999809L, 999853L, 999863L,
-999883L, 999907L, 999917L, 999931L, 999953L, 999959L, 999961L, 999979L, 999983L,
-1000003L, 1000033L, 1000037L, 1000039L, 1000081L, 1000099L, 1000117L, 1000121L, 1000133L,
-1000151L, 1000159L, 1000171L, 1000183L, 1000187L, 1000193L, 1000199L, 1000211L, 1000213L,
-1000231L, 1000249L, 1000253L, 1000273L, 1000289L, 1000291L, 1000303L, 1000313L, 1000333L,
-1000357L, 1000367L, 1000381L, 1000393L, 1000397L, 1000403L, 1000409L, 1000423L, 1000427L,
-1000429L, 1000453L, 1000457L, 1000507L, 1000537L, 1000541L, 1000547L, 1000577L, 1000579L,
-1000589L, 1000609L, 1000619L, 1000621L, 1000639L, 1000651L, 1000667L, 1000669L, 1000679L,
-1000691L, 1000697L, 1000721L, 1000723L, 1000763L, 1000777L, 1000793L, 1000829L, 1000847L,
-1000849L, 1000859L, 1000861L, 1000889L, 1000907L, 1000919L, 1000921L, 1000931L, 1000969L,
-1000973L, 1000981L, 1000999L, 1001003L, 1001017L, 1001023L, 1001027L, 1001041L, 1001069L,
-1001081L, 1001087L, 1001089L, 1001093L, 1001107L, 1001123L, 1001153L, 1001159L, 1001173L,
-1001177L, 1001191L, 1001197L, 1001219L, 1001237L, 1001267L, 1001279L, 1001291L, 1001303L,
-1001311L, 1001321L, 1001323L, 1001327L, 1001347L, 1001353L, 1001369L, 1001381L, 1001387L,
-1001389L, 1001401L, 1001411L, 1001431L, 1001447L, 1001459L, 1001467L, 1001491L, 1001501L,
-1001527L, 1001531L, 1001549L, 1001551L, 1001563L, 1001569L, 1001587L, 1001593L, 1001621L,
-1001629L, 1001639L, 1001659L, 1001669L, 1001683L, 1001687L, 1001713L, 1001723L, 1001743L,
-1001783L, 1001797L, 1001801L, 1001807L, 1001809L, 1001821L, 1001831L, 1001839L, 1001911L,
-1001933L, 1001941L, 1001947L, 1001953L, 1001977L, 1001981L, 1001983L, 1001989L, 1002017L,
-1002049L, 1002061L, 1002073L, 1002077L, 1002083L, 1002091L, 1002101L, 1002109L, 1002121L,
-1002143L, 1002149L, 1002151L, 1002173L, 1002191L, 1002227L, 1002241L, 1002247L, 1002257L,
-1002259L, 1002263L, 1002289L, 1002299L, 1002341L, 1002343L, 1002347L, 1002349L, 1002359L,
-1002361L, 1002377L, 1002403L, 1002427L, 1002433L, 1002451L, 1002457L, 1002467L, 1002481L,
-1002487L, 1002493L, 1002503L, 1002511L, 1002517L, 1002523L, 1002527L, 1002553L, 1002569L,
-1002577L, 1002583L, 1002619L, 1002623L, 1002647L, 1002653L, 1002679L, 1002709L, 1002713L,
-1002719L, 1002721L, 1002739L, 1002751L, 1002767L, 1002769L, 1002773L, 1002787L, 1002797L,
-1002809L, 1002817L, 1002821L, 1002851L, 1002853L, 1002857L, 1002863L, 1002871L, 1002887L,
-1002893L, 1002899L, 1002913L, 1002917L, 1002929L, 1002931L, 1002973L, 1002979L, 1003001L,
-1003003L, 1003019L, 1003039L, 1003049L, 1003087L, 1003091L, 1003097L, 1003103L, 1003109L,
-1003111L, 1003133L, 1003141L, 1003193L, 1003199L, 1003201L, 1003241L, 1003259L, 1003273L,
-1003279L, 1003291L, 1003307L, 1003337L, 1003349L, 1003351L, 1003361L, 1003363L, 1003367L,
-1003369L, 1003381L, 1003397L, 1003411L, 1003417L, 1003433L, 1003463L, 1003469L, 1003507L,
-1003517L, 1003543L, 1003549L, 1003589L, 1003601L, 1003609L, 1003619L, 1003621L, 1003627L,
-1003631L, 1003679L, 1003693L, 1003711L, 1003729L, 1003733L, 1003741L, 1003747L, 1003753L,
-1003757L, 1003763L, 1003771L, 1003787L, 1003817L, 1003819L, 1003841L, 1003879L, 1003889L,
-1003897L, 1003907L, 1003909L, 1003913L, 1003931L, 1003943L, 1003957L, 1003963L, 1004027L,
-1004033L, 1004053L, 1004057L, 1004063L, 1004077L, 1004089L, 1004117L, 1004119L, 1004137L,
-1004141L, 1004161L, 1004167L, 1004209L, 1004221L, 1004233L, 1004273L, 1004279L, 1004287L,
-1004293L, 1004303L, 1004317L, 1004323L, 1004363L, 1004371L, 1004401L, 1004429L, 1004441L,
-1004449L, 1004453L, 1004461L, 1004477L, 1004483L, 1004501L, 1004527L, 1004537L, 1004551L,
-1004561L, 1004567L, 1004599L, 1004651L, 1004657L, 1004659L, 1004669L, 1004671L, 1004677L,
-1004687L, 1004723L, 1004737L, 1004743L, 1004747L, 1004749L, 1004761L, 1004779L, 1004797L,
-1004873L, 1004903L, 1004911L, 1004917L, 1004963L, 1004977L, 1004981L, 1004987L, 1005007L,
-1005013L, 1005019L, 1005029L, 1005041L, 1005049L, 1005071L, 1005073L, 1005079L, 1005101L,
-1005107L, 1005131L, 1005133L, 1005143L, 1005161L, 1005187L, 1005203L, 1005209L, 1005217L,
-1005223L, 1005229L, 1005239L, 1005241L, 1005269L, 1005287L, 1005293L, 1005313L, 1005317L,
-1005331L, 1005349L, 1005359L, 1005371L, 1005373L, 1005391L, 1005409L, 1005413L, 1005427L,
-1005437L, 1005439L, 1005457L, 1005467L, 1005481L, 1005493L, 1005503L, 1005527L, 1005541L,
-1005551L, 1005553L, 1005581L, 1005593L, 1005617L, 1005619L, 1005637L, 1005643L, 1005647L,
-1005661L, 1005677L, 1005679L, 1005701L, 1005709L, 1005751L, 1005761L, 1005821L, 1005827L,
-1005833L, 1005883L, 1005911L, 1005913L, 1005931L, 1005937L, 1005959L, 1005971L, 1005989L,
-1006003L, 1006007L, 1006021L, 1006037L, 1006063L, 1006087L, 1006091L, 1006123L, 1006133L,
-1006147L, 1006151L, 1006153L, 1006163L, 1006169L, 1006171L, 1006177L, 1006189L, 1006193L,
-1006217L, 1006219L, 1006231L, 1006237L, 1006241L, 1006249L, 1006253L, 1006267L, 1006279L,
-1006301L, 1006303L, 1006307L, 1006309L, 1006331L, 1006333L, 1006337L, 1006339L, 1006351L,
-1006361L, 1006367L, 1006391L, 1006393L, 1006433L, 1006441L, 1006463L, 1006469L, 1006471L,
-1006493L, 1006507L, 1006513L, 1006531L, 1006543L, 1006547L, 1006559L, 1006583L, 1006589L,
-1006609L, 1006613L, 1006633L, 1006637L, 1006651L, 1006711L, 1006721L, 1006739L, 1006751L,
-1006769L, 1006781L, 1006783L, 1006799L, 1006847L, 1006853L, 1006861L, 1006877L, 1006879L,
-1006883L, 1006891L, 1006897L, 1006933L, 1006937L, 1006949L, 1006969L, 1006979L, 1006987L,
-1006991L, 1007021L, 1007023L, 1007047L, 1007059L, 1007081L, 1007089L, 1007099L, 1007117L,
-1007119L, 1007129L, 1007137L, 1007161L, 1007173L, 1007179L, 1007203L, 1007231L, 1007243L,
-1007249L, 1007297L, 1007299L, 1007309L, 1007317L, 1007339L, 1007353L, 1007359L, 1007381L,
-1007387L, 1007401L, 1007417L, 1007429L, 1007441L, 1007459L, 1007467L, 1007483L, 1007497L,
-1007519L, 1007527L, 1007549L, 1007557L, 1007597L, 1007599L, 1007609L, 1007647L, 1007651L,
-1007681L, 1007683L, 1007693L, 1007701L, 1007711L, 1007719L, 1007723L, 1007729L, 1007731L,
-1007749L, 1007753L, 1007759L, 1007767L, 1007771L, 1007789L, 1007801L, 1007807L, 1007813L,
-1007819L, 1007827L, 1007857L, 1007861L, 1007873L, 1007887L, 1007891L, 1007921L, 1007933L,
-1007939L, 1007957L, 1007959L, 1007971L, 1007977L, 1008001L, 1008013L, 1008017L, 1008031L,
-1008037L, 1008041L, 1008043L, 1008101L, 1008131L, 1008157L, 1008181L, 1008187L, 1008193L,
-1008199L, 1008209L, 1008223L, 1008229L, 1008233L, 1008239L, 1008247L, 1008257L, 1008263L,
-1008317L, 1008323L, 1008331L, 1008347L, 1008353L, 1008373L, 1008379L, 1008401L, 1008407L,
-1008409L, 1008419L, 1008421L, 1008433L, 1008437L, 1008451L, 1008467L, 1008493L, 1008499L,
-1008503L, 1008517L, 1008541L, 1008547L, 1008563L, 1008571L, 1008587L, 1008589L, 1008607L,
-1008611L, 1008613L, 1008617L, 1008659L, 1008701L, 1008719L, 1008743L, 1008773L, 1008779L,
-1008781L, 1008793L, 1008809L, 1008817L, 1008829L, 1008851L, 1008853L, 1008857L, 1008859L,
-1008863L, 1008871L, 1008901L, 1008911L, 1008913L, 1008923L, 1008937L, 1008947L, 1008979L,
-1008983L, 1008989L, 1008991L, 1009007L, 1009037L, 1009049L, 1009061L, 1009097L, 1009121L,
-1009139L, 1009153L, 1009157L, 1009159L, 1009163L, 1009189L, 1009193L, 1009199L, 1009201L,
-1009207L, 1009237L, 1009243L, 1009247L, 1009259L, 1009289L, 1009291L, 1009301L, 1009303L,
-1009319L, 1009321L, 1009343L, 1009357L, 1009361L, 1009369L, 1009373L, 1009387L, 1009399L,
-1009417L, 1009433L, 1009439L, 1009457L, 1009483L, 1009487L, 1009499L, 1009501L, 1009507L,
-1009531L, 1009537L, 1009559L, 1009573L, 1009601L, 1009609L, 1009621L, 1009627L, 1009637L,
-1009643L, 1009649L, 1009651L, 1009669L, 1009727L, 1009741L, 1009747L, 1009781L, 1009787L,
-1009807L, 1009819L, 1009837L, 1009843L, 1009859L, 1009873L, 1009901L, 1009909L, 1009927L,
-1009937L, 1009951L, 1009963L, 1009991L, 1009993L, 1009997L, 1010003L, 1010033L, 1010069L,
-1010081L, 1010083L, 1010129L, 1010131L, 1010143L, 1010167L, 1010179L, 1010201L, 1010203L,
-1010237L, 1010263L, 1010291L, 1010297L, 1010329L, 1010353L, 1010357L, 1010381L, 1010407L,
-1010411L, 1010419L, 1010423L, 1010431L, 1010461L, 1010467L, 1010473L, 1010491L, 1010501L,
-1010509L, 1010519L, 1010549L, 1010567L, 1010579L, 1010617L, 1010623L, 1010627L, 1010671L,
-1010683L, 1010687L, 1010717L, 1010719L, 1010747L, 1010749L, 1010753L, 1010759L, 1010767L,
-1010771L, 1010783L, 1010791L, 1010797L, 1010809L, 1010833L, 1010843L, 1010861L, 1010881L,
-1010897L, 1010899L, 1010903L, 1010917L, 1010929L, 1010957L, 1010981L, 1010983L, 1010993L,
-1011001L, 1011013L, 1011029L, 1011037L, 1011067L, 1011071L, 1011077L, 1011079L, 1011091L,
-1011107L, 1011137L, 1011139L, 1011163L, 1011167L, 1011191L, 1011217L, 1011221L, 1011229L,
-1011233L, 1011239L, 1011271L, 1011277L, 1011281L, 1011289L, 1011331L, 1011343L, 1011349L,
-1011359L, 1011371L, 1011377L, 1011391L, 1011397L, 1011407L, 1011431L, 1011443L, 1011509L,
-1011539L, 1011553L, 1011559L, 1011583L, 1011587L, 1011589L, 1011599L, 1011601L, 1011631L,
-1011641L, 1011649L, 1011667L, 1011671L, 1011677L, 1011697L, 1011719L, 1011733L, 1011737L,
-1011749L, 1011763L, 1011779L, 1011797L, 1011799L, 1011817L, 1011827L, 1011889L, 1011893L,
-1011917L, 1011937L, 1011943L, 1011947L, 1011961L, 1011973L, 1011979L, 1012007L, 1012009L,
-1012031L, 1012043L, 1012049L, 1012079L, 1012087L, 1012093L, 1012097L, 1012103L, 1012133L,
-1012147L, 1012159L, 1012171L, 1012183L, 1012189L, 1012201L, 1012213L, 1012217L, 1012229L,
-1012241L, 1012259L, 1012261L, 1012267L, 1012279L, 1012289L, 1012307L, 1012321L, 1012369L,
-1012373L, 1012379L, 1012397L, 1012399L, 1012411L, 1012421L, 1012423L, 1012433L, 1012439L,
-1012447L, 1012457L, 1012463L, 1012481L, 1012489L, 1012507L, 1012513L, 1012519L, 1012523L,
-1012547L, 1012549L, 1012559L, 1012573L, 1012591L, 1012597L, 1012601L, 1012619L, 1012631L,
-1012633L, 1012637L, 1012657L, 1012663L, 1012679L, 1012691L, 1012699L, 1012703L, 1012717L,
-1012721L, 1012733L, 1012751L, 1012763L, 1012769L, 1012771L, 1012789L, 1012811L, 1012829L,
-1012831L, 1012861L, 1012903L, 1012919L, 1012931L, 1012967L, 1012981L, 1012993L, 1012997L,
-1013003L, 1013009L, 1013029L, 1013041L, 1013053L, 1013063L, 1013143L, 1013153L, 1013197L,
-1013203L, 1013227L, 1013237L, 1013239L, 1013249L, 1013263L, 1013267L, 1013279L, 1013291L,
-1013321L, 1013329L, 1013377L, 1013399L, 1013401L, 1013429L, 1013431L, 1013471L, 1013477L,
-1013501L, 1013503L, 1013527L, 1013531L, 1013533L, 1013563L, 1013569L, 1013581L, 1013603L,
-1013609L, 1013627L, 1013629L, 1013641L, 1013671L, 1013681L, 1013687L, 1013699L, 1013711L,
-1013713L, 1013717L, 1013729L, 1013741L, 1013767L, 1013773L, 1013791L, 1013813L, 1013819L,
-1013827L, 1013833L, 1013839L, 1013843L, 1013851L, 1013879L, 1013891L, 1013893L, 1013899L,
-1013921L, 1013923L, 1013933L, 1013993L, 1014007L, 1014029L, 1014037L, 1014061L, 1014089L,
-1014113L, 1014121L, 1014127L, 1014131L, 1014137L, 1014149L, 1014157L, 1014161L, 1014173L,
-1014193L, 1014197L, 1014199L, 1014229L, 1014257L, 1014259L, 1014263L, 1014287L, 1014301L,
-1014317L, 1014319L, 1014331L, 1014337L, 1014341L, 1014359L, 1014361L, 1014371L, 1014389L,
-1014397L, 1014451L, 1014457L, 1014469L, 1014487L, 1014493L, 1014521L, 1014539L, 1014547L,
-1014557L, 1014571L, 1014593L, 1014617L, 1014631L, 1014641L, 1014649L, 1014677L, 1014697L,
-1014719L, 1014721L, 1014731L, 1014743L, 1014749L, 1014763L, 1014779L, 1014787L, 1014817L,
-1014821L, 1014833L, 1014863L, 1014869L, 1014877L, 1014887L, 1014889L, 1014907L, 1014941L,
-1014953L, 1014973L, 1014989L, 1015009L, 1015039L, 1015043L, 1015051L, 1015057L, 1015061L,
-1015067L, 1015073L, 1015081L, 1015093L, 1015097L, 1015123L, 1015127L, 1015139L, 1015159L,
-1015163L, 1015171L, 1015199L, 1015207L, 1015277L, 1015309L, 1015349L, 1015361L, 1015363L,
-1015367L, 1015369L, 1015403L, 1015409L, 1015423L, 1015433L, 1015451L, 1015453L, 1015459L,
-1015463L, 1015471L, 1015481L, 1015499L, 1015501L, 1015507L, 1015517L, 1015523L, 1015541L,
-1015549L, 1015559L, 1015561L, 1015571L, 1015601L, 1015603L, 1015627L, 1015661L, 1015691L,
-1015697L, 1015709L, 1015723L, 1015727L, 1015739L, 1015747L, 1015753L, 1015769L, 1015813L,
-1015823L, 1015829L, 1015843L, 1015853L, 1015871L, 1015877L, 1015891L, 1015897L, 1015907L,
-1015913L, 1015919L, 1015967L, 1015981L, 1015991L, 1016009L, 1016011L, 1016023L, 1016027L,
-1016033L, 1016051L, 1016053L, 1016069L, 1016083L, 1016089L, 1016111L, 1016123L, 1016137L,
-1016143L, 1016153L, 1016159L, 1016173L, 1016201L, 1016203L, 1016221L, 1016227L, 1016231L,
-1016237L, 1016263L, 1016303L, 1016339L, 1016341L, 1016357L, 1016359L, 1016371L, 1016399L,
-1016401L, 1016419L, 1016423L, 1016441L, 1016453L, 1016489L, 1016497L, 1016527L, 1016567L,
-1016569L, 1016573L, 1016581L, 1016597L, 1016599L, 1016611L, 1016621L, 1016641L, 1016663L,
-1016681L, 1016689L, 1016731L, 1016737L, 1016749L, 1016773L, 1016777L, 1016783L, 1016789L,
-1016839L, 1016843L, 1016849L, 1016879L, 1016881L, 1016891L, 1016909L, 1016921L, 1016927L,
-1016929L, 1016941L, 1016947L, 1016959L, 1016971L, 1017007L, 1017011L, 1017031L, 1017041L,
-1017043L, 1017061L, 1017077L, 1017097L, 1017119L, 1017131L, 1017139L, 1017157L, 1017173L,
-1017179L, 1017193L, 1017199L, 1017209L, 1017227L, 1017277L, 1017293L, 1017299L, 1017301L,
-1017307L, 1017311L, 1017319L, 1017323L, 1017329L, 1017347L, 1017353L, 1017361L, 1017371L,
-1017377L, 1017383L, 1017391L, 1017437L, 1017439L, 1017449L, 1017473L, 1017479L, 1017481L,
-1017539L, 1017551L, 1017553L, 1017559L, 1017607L, 1017613L, 1017617L, 1017623L, 1017647L,
-1017649L, 1017673L, 1017683L, 1017703L, 1017713L, 1017719L, 1017721L, 1017749L, 1017781L,
-1017787L, 1017799L, 1017817L, 1017827L, 1017847L, 1017851L, 1017857L, 1017859L, 1017881L,
-1017889L, 1017923L, 1017953L, 1017959L, 1017997L, 1018007L, 1018019L, 1018021L, 1018057L,
-1018091L, 1018097L, 1018109L, 1018123L, 1018177L, 1018201L, 1018207L, 1018217L, 1018223L,
-1018247L, 1018253L, 1018271L, 1018291L, 1018301L, 1018309L, 1018313L, 1018337L, 1018357L,
-1018411L, 1018421L, 1018429L, 1018439L, 1018447L, 1018471L, 1018477L, 1018489L, 1018513L,
-1018543L, 1018559L, 1018583L, 1018613L, 1018621L, 1018643L, 1018649L, 1018651L, 1018669L,
-1018673L, 1018679L, 1018697L, 1018709L, 1018711L, 1018729L, 1018733L, 1018763L, 1018769L,
-1018777L, 1018789L, 1018807L, 1018811L, 1018813L, 1018817L, 1018859L, 1018873L, 1018879L,
-1018889L, 1018903L, 1018907L, 1018931L, 1018937L, 1018949L, 1018957L, 1018967L, 1018981L,
-1018987L, 1018993L, 1018999L, 1019023L, 1019033L, 1019059L, 1019069L, 1019071L, 1019077L,
-1019093L, 1019119L, 1019129L, 1019173L, 1019177L, 1019197L, 1019209L, 1019237L, 1019251L,
-1019257L, 1019261L, 1019267L, 1019273L, 1019281L, 1019297L, 1019329L, 1019339L, 1019351L,
-1019353L, 1019357L, 1019377L, 1019399L, 1019411L, 1019413L, 1019423L, 1019443L, 1019449L,
-1019453L, 1019467L, 1019471L, 1019479L, 1019503L, 1019509L, 1019531L, 1019533L, 1019537L,
-1019549L, 1019563L, 1019617L, 1019639L, 1019647L, 1019657L, 1019663L, 1019687L, 1019693L,
-1019699L, 1019701L, 1019713L, 1019717L, 1019723L, 1019729L, 1019731L, 1019741L, 1019747L,
-1019771L, 1019783L, 1019801L, 1019819L, 1019827L, 1019839L, 1019849L, 1019857L, 1019861L,
-1019873L, 1019899L, 1019903L, 1019927L, 1019971L, 1020001L, 1020007L, 1020011L, 1020013L,
-1020023L, 1020037L, 1020043L, 1020049L, 1020059L, 1020077L, 1020079L, 1020101L, 1020109L,
-1020113L, 1020137L, 1020143L, 1020157L, 1020163L, 1020223L, 1020233L, 1020247L, 1020259L,
-1020269L, 1020293L, 1020301L, 1020329L, 1020337L, 1020353L, 1020361L, 1020379L, 1020389L,
-1020401L, 1020407L, 1020413L, 1020419L, 1020431L, 1020451L, 1020457L, 1020491L, 1020517L,
-1020529L, 1020541L, 1020557L, 1020583L, 1020589L, 1020599L, 1020619L, 1020631L, 1020667L,
-1020683L, 1020689L, 1020707L, 1020709L, 1020743L, 1020751L, 1020757L, 1020779L, 1020797L,
-1020821L, 1020823L, 1020827L, 1020839L, 1020841L, 1020847L, 1020853L, 1020881L, 1020893L,
-1020907L, 1020913L, 1020931L, 1020959L, 1020961L, 1020967L, 1020973L, 1020977L, 1020979L,
-1020989L, 1020991L, 1020997L, 1021001L, 1021019L, 1021043L, 1021067L, 1021073L, 1021081L,
-1021087L, 1021091L, 1021093L, 1021123L, 1021127L, 1021129L, 1021157L, 1021159L, 1021183L,
-1021199L, 1021217L, 1021243L, 1021253L, 1021259L, 1021261L, 1021271L, 1021283L, 1021289L,
-1021291L, 1021297L, 1021301L, 1021303L, 1021327L, 1021331L, 1021333L, 1021367L, 1021369L,
-1021373L, 1021381L, 1021387L, 1021403L, 1021417L, 1021429L, 1021441L, 1021457L, 1021463L,
-1021483L, 1021487L, 1021541L, 1021561L, 1021571L, 1021577L, 1021621L, 1021627L, 1021651L,
-1021661L, 1021663L, 1021673L, 1021697L, 1021711L, 1021747L, 1021753L, 1021759L, 1021777L,
-1021793L, 1021799L, 1021807L, 1021831L, 1021837L, 1021849L, 1021861L, 1021879L, 1021897L,
-1021907L, 1021919L, 1021961L, 1021963L, 1021973L, 1022011L, 1022017L, 1022033L, 1022053L,
-1022059L, 1022071L, 1022083L, 1022113L, 1022123L, 1022129L, 1022137L, 1022141L, 1022167L,
-1022179L, 1022183L, 1022191L, 1022201L, 1022209L, 1022237L, 1022243L, 1022249L, 1022251L,
-1022291L, 1022303L, 1022341L, 1022377L, 1022381L, 1022383L, 1022387L, 1022389L, 1022429L,
-1022443L, 1022449L, 1022467L, 1022491L, 1022501L, 1022503L, 1022507L, 1022509L, 1022513L,
-1022519L, 1022531L, 1022573L, 1022591L, 1022611L, 1022629L, 1022633L, 1022639L, 1022653L,
-1022677L, 1022683L, 1022689L, 1022701L, 1022719L, 1022729L, 1022761L, 1022773L, 1022797L,
-1022821L, 1022837L, 1022843L, 1022849L, 1022869L, 1022881L, 1022891L, 1022899L, 1022911L,
-1022929L, 1022933L, 1022963L, 1022977L, 1022981L, 1023019L, 1023037L, 1023041L, 1023047L,
-1023067L, 1023079L, 1023083L, 1023101L, 1023107L, 1023133L, 1023163L, 1023167L, 1023173L,
-1023199L, 1023203L, 1023221L, 1023227L, 1023229L, 1023257L, 1023259L, 1023263L, 1023277L,
-1023289L, 1023299L, 1023301L, 1023311L, 1023313L, 1023317L, 1023329L, 1023353L, 1023361L,
-1023367L, 1023389L, 1023391L, 1023409L, 1023413L, 1023419L, 1023461L, 1023467L, 1023487L,
-1023499L, 1023521L, 1023541L, 1023551L, 1023557L, 1023571L, 1023577L, 1023601L, 1023643L,
-1023653L, 1023697L, 1023719L, 1023721L, 1023731L, 1023733L, 1023751L, 1023769L, 1023821L,
-1023833L, 1023839L, 1023851L, 1023857L, 1023871L, 1023941L, 1023943L, 1023947L, 1023949L,
-1023973L, 1023977L, 1023991L, 1024021L, 1024031L, 1024061L, 1024073L, 1024087L, 1024091L,
-1024099L, 1024103L, 1024151L, 1024159L, 1024171L, 1024183L, 1024189L, 1024207L, 1024249L,
-1024277L, 1024307L, 1024313L, 1024319L, 1024321L, 1024327L, 1024337L, 1024339L, 1024357L,
-1024379L, 1024391L, 1024399L, 1024411L, 1024421L, 1024427L, 1024433L, 1024477L, 1024481L,
-1024511L, 1024523L, 1024547L, 1024559L, 1024577L, 1024579L, 1024589L, 1024591L, 1024609L,
-1024633L, 1024663L, 1024669L, 1024693L, 1024697L, 1024703L, 1024711L, 1024721L, 1024729L,
-1024757L, 1024783L, 1024799L, 1024823L, 1024843L, 1024853L, 1024871L, 1024883L, 1024901L,
-1024909L, 1024921L, 1024931L, 1024939L, 1024943L, 1024951L, 1024957L, 1024963L, 1024987L,
-1024997L, 1025009L, 1025021L, 1025029L, 1025039L, 1025047L, 1025081L, 1025093L, 1025099L,
-1025111L, 1025113L, 1025119L, 1025137L, 1025147L, 1025149L, 1025153L, 1025161L, 1025197L,
-1025203L, 1025209L, 1025231L, 1025239L, 1025257L, 1025261L, 1025267L, 1025273L, 1025279L,
-1025281L, 1025303L, 1025327L, 1025333L, 1025347L, 1025351L, 1025383L, 1025393L, 1025407L,
-1025413L, 1025417L, 1025419L, 1025443L, 1025459L, 1025477L, 1025483L, 1025503L, 1025509L,
-1025513L, 1025537L, 1025543L, 1025551L, 1025561L, 1025579L, 1025611L, 1025621L, 1025623L,
-1025641L, 1025653L, 1025659L, 1025669L, 1025693L, 1025707L, 1025741L, 1025747L, 1025749L,
-1025767L, 1025789L, 1025803L, 1025807L, 1025819L, 1025839L, 1025873L, 1025887L, 1025891L,
-1025897L, 1025909L, 1025911L, 1025917L, 1025929L, 1025939L, 1025957L, 1026029L, 1026031L,
-1026037L, 1026041L, 1026043L, 1026061L, 1026073L, 1026101L, 1026119L, 1026127L, 1026139L,
-1026143L, 1026167L, 1026197L, 1026199L, 1026217L, 1026227L, 1026229L, 1026251L, 1026253L,
-1026257L, 1026293L, 1026299L, 1026313L, 1026331L, 1026359L, 1026371L, 1026383L, 1026391L,
-1026401L, 1026407L, 1026413L, 1026427L, 1026439L, 1026449L, 1026457L, 1026479L, 1026481L,
-1026521L, 1026547L, 1026563L, 1026577L, 1026581L, 1026583L, 1026587L, 1026593L, 1026661L,
-1026667L, 1026673L, 1026677L, 1026679L, 1026709L, 1026733L, 1026757L, 1026761L, 1026791L,
-1026799L, 1026811L, 1026829L, 1026833L, 1026847L, 1026853L, 1026859L, 1026887L, 1026899L,
-1026911L, 1026913L, 1026917L, 1026941L, 1026943L, 1026947L, 1026979L, 1026989L, 1027001L,
-1027003L, 1027027L, 1027031L, 1027051L, 1027067L, 1027097L, 1027127L, 1027129L, 1027139L,
-1027153L, 1027163L, 1027181L, 1027189L, 1027199L, 1027207L, 1027211L, 1027223L, 1027241L,
-1027261L, 1027277L, 1027289L, 1027319L, 1027321L, 1027331L, 1027357L, 1027391L, 1027409L,
-1027417L, 1027421L, 1027427L, 1027459L, 1027471L, 1027483L, 1027487L, 1027489L, 1027493L,
-1027519L, 1027547L, 1027549L, 1027567L, 1027591L, 1027597L, 1027613L, 1027643L, 1027679L,
-1027687L, 1027693L, 1027703L, 1027717L, 1027727L, 1027739L, 1027751L, 1027753L, 1027757L,
-1027759L, 1027777L, 1027783L, 1027787L, 1027799L, 1027841L, 1027853L, 1027883L, 1027891L,
-1027931L, 1027969L, 1027987L, 1028003L, 1028011L, 1028017L, 1028023L, 1028029L, 1028047L,
-1028051L, 1028063L, 1028081L, 1028089L, 1028099L, 1028101L, 1028107L, 1028113L, 1028117L,
-1028129L, 1028141L, 1028149L, 1028189L, 1028191L, 1028201L, 1028207L, 1028213L, 1028221L,
-1028231L, 1028243L, 1028263L, 1028273L, 1028303L, 1028309L, 1028317L, 1028327L, 1028329L,
-1028333L, 1028389L, 1028393L, 1028411L, 1028437L, 1028471L, 1028473L, 1028479L, 1028509L,
-1028557L, 1028561L, 1028569L, 1028579L, 1028581L, 1028597L, 1028617L, 1028647L, 1028663L,
-1028669L, 1028681L, 1028683L, 1028737L, 1028747L, 1028749L, 1028761L, 1028773L, 1028777L,
-1028803L, 1028809L, 1028837L, 1028843L, 1028873L, 1028893L, 1028903L, 1028939L, 1028941L,
-1028953L, 1028957L, 1028969L, 1028981L, 1028999L, 1029001L, 1029013L, 1029023L, 1029037L,
-1029103L, 1029109L, 1029113L, 1029139L, 1029151L, 1029157L, 1029167L, 1029179L, 1029191L,
-1029199L, 1029209L, 1029247L, 1029251L, 1029263L, 1029277L, 1029289L, 1029307L, 1029323L,
-1029331L, 1029337L, 1029341L, 1029349L, 1029359L, 1029361L, 1029383L, 1029403L, 1029407L,
-1029409L, 1029433L, 1029467L, 1029473L, 1029481L, 1029487L, 1029499L, 1029517L, 1029521L,
-1029527L, 1029533L, 1029547L, 1029563L, 1029569L, 1029577L, 1029583L, 1029593L, 1029601L,
-1029617L, 1029643L, 1029647L, 1029653L, 1029689L, 1029697L, 1029731L, 1029751L, 1029757L,
-1029767L, 1029803L, 1029823L, 1029827L, 1029839L, 1029841L, 1029859L, 1029881L, 1029883L,
-1029907L, 1029929L, 1029937L, 1029943L, 1029953L, 1029967L, 1029983L, 1029989L, 1030019L,
-1030021L, 1030027L, 1030031L, 1030033L, 1030039L, 1030049L, 1030061L, 1030067L, 1030069L,
-1030091L, 1030111L, 1030121L, 1030153L, 1030157L, 1030181L, 1030201L, 1030213L, 1030219L,
-1030241L, 1030247L, 1030291L, 1030297L, 1030307L, 1030349L, 1030357L, 1030361L, 1030369L,
-1030411L, 1030417L, 1030429L, 1030439L, 1030441L, 1030451L, 1030493L, 1030511L, 1030529L,
-1030537L, 1030543L, 1030571L, 1030583L, 1030619L, 1030637L, 1030639L, 1030643L, 1030681L,
-1030703L, 1030723L, 1030739L, 1030741L, 1030751L, 1030759L, 1030763L, 1030787L, 1030793L,
-1030801L, 1030811L, 1030817L, 1030823L, 1030831L, 1030847L, 1030867L, 1030873L, 1030889L,
-1030919L, 1030933L, 1030949L, 1030951L, 1030957L, 1030987L, 1030993L, 1031003L, 1031047L,
-1031053L, 1031057L, 1031081L, 1031117L, 1031119L, 1031137L, 1031141L, 1031161L, 1031189L,
-1031231L, 1031267L, 1031279L, 1031281L, 1031291L, 1031299L, 1031309L, 1031323L, 1031347L,
-1031357L, 1031399L, 1031411L, 1031413L, 1031423L, 1031431L, 1031447L, 1031461L, 1031477L,
-1031479L, 1031483L, 1031489L, 1031507L, 1031521L, 1031531L, 1031533L, 1031549L, 1031561L,
-1031593L, 1031609L, 1031623L, 1031629L, 1031633L, 1031669L, 1031677L, 1031707L, 1031717L,
-1031729L, 1031731L, 1031741L, 1031753L, 1031759L, 1031761L, 1031809L, 1031813L, 1031831L,
-1031837L, 1031869L, 1031911L, 1031923L, 1031981L, 1031999L, 1032007L, 1032047L, 1032049L,
-1032067L, 1032071L, 1032107L, 1032131L, 1032151L, 1032191L, 1032193L, 1032211L, 1032221L,
-1032233L, 1032259L, 1032287L, 1032299L, 1032307L, 1032319L, 1032329L, 1032341L, 1032347L,
-1032349L, 1032373L, 1032377L, 1032391L, 1032397L, 1032407L, 1032419L, 1032433L, 1032457L,
-1032463L, 1032467L, 1032491L, 1032497L, 1032509L, 1032511L, 1032527L, 1032541L, 1032571L,
-1032583L, 1032601L, 1032607L, 1032613L, 1032617L, 1032643L, 1032649L, 1032679L, 1032683L,
-1032697L, 1032701L, 1032709L, 1032721L, 1032727L, 1032739L, 1032751L, 1032763L, 1032793L,
-1032799L, 1032803L, 1032833L, 1032839L, 1032841L, 1032847L, 1032851L, 1032853L, 1032881L,
-1032887L, 1032901L, 1032943L, 1032949L, 1032959L, 1032961L, 1033001L, 1033007L, 1033027L,
-1033033L, 1033037L, 1033057L, 1033061L, 1033063L, 1033069L, 1033079L, 1033099L, 1033127L,
-1033139L, 1033171L, 1033181L, 1033189L, 1033223L, 1033271L, 1033273L, 1033289L, 1033297L,
-1033303L, 1033309L, 1033313L, 1033337L, 1033339L, 1033343L, 1033349L, 1033363L, 1033369L,
-1033381L, 1033387L, 1033393L, 1033421L, 1033423L, 1033427L, 1033441L, 1033451L, 1033457L,
-1033463L, 1033469L, 1033489L, 1033493L, 1033499L, 1033507L, 1033517L, 1033537L, 1033541L,
-1033559L, 1033567L, 1033601L, 1033603L, 1033631L, 1033661L, 1033663L, 1033667L, 1033679L,
-1033687L, 1033693L, 1033741L, 1033751L, 1033759L, 1033777L, 1033783L, 1033789L, 1033793L,
-1033801L, 1033807L, 1033829L, 1033841L, 1033843L, 1033867L, 1033927L, 1033951L, 1033987L,
-1034003L, 1034009L, 1034027L, 1034029L, 1034069L, 1034071L, 1034101L, 1034119L, 1034123L,
-1034147L, 1034167L, 1034171L, 1034177L, 1034183L, 1034197L, 1034207L, 1034219L, 1034221L,
-1034233L, 1034237L, 1034239L, 1034249L, 1034251L, 1034281L, 1034309L, 1034317L, 1034323L,
-1034339L, 1034353L, 1034357L, 1034359L, 1034381L, 1034387L, 1034419L, 1034443L, 1034461L,
-1034477L, 1034479L, 1034489L, 1034491L, 1034503L, 1034513L, 1034549L, 1034567L, 1034581L,
-1034591L, 1034597L, 1034599L, 1034617L, 1034639L, 1034651L, 1034653L, 1034659L, 1034707L,
-1034729L, 1034731L, 1034767L, 1034771L, 1034783L, 1034791L, 1034809L, 1034827L, 1034833L,
-1034837L, 1034849L, 1034857L, 1034861L, 1034863L, 1034867L, 1034879L, 1034903L, 1034941L,
-1034951L, 1034953L, 1034959L, 1034983L, 1034989L, 1034993L, 1035007L, 1035019L, 1035043L,
-1035061L, 1035077L, 1035107L, 1035131L, 1035163L, 1035187L, 1035191L, 1035197L, 1035211L,
-1035241L, 1035247L, 1035257L, 1035263L, 1035277L, 1035301L, 1035313L, 1035323L, 1035341L,
-1035343L, 1035361L, 1035379L, 1035383L, 1035403L, 1035409L, 1035413L, 1035427L, 1035449L,
-1035451L, 1035467L, 1035469L, 1035473L, 1035479L, 1035499L, 1035527L, 1035533L, 1035547L,
-1035563L, 1035571L, 1035581L, 1035599L, 1035607L, 1035613L, 1035631L, 1035637L, 1035641L,
-1035649L, 1035659L, 1035707L, 1035733L, 1035743L, 1035761L, 1035763L, 1035781L, 1035791L,
-1035829L, 1035869L, 1035893L, 1035917L, 1035949L, 1035953L, 1035959L, 1035973L, 1035977L,
-1036001L, 1036003L, 1036027L, 1036039L, 1036067L, 1036069L, 1036073L, 1036093L, 1036109L,
-1036117L, 1036121L, 1036129L, 1036153L, 1036163L, 1036183L, 1036213L, 1036223L, 1036229L,
-1036247L, 1036249L, 1036253L, 1036261L, 1036267L, 1036271L, 1036291L, 1036297L, 1036307L,
-1036319L, 1036327L, 1036331L, 1036339L, 1036349L, 1036351L, 1036363L, 1036367L, 1036369L,
-1036391L, 1036411L, 1036459L, 1036471L, 1036493L, 1036499L, 1036513L, 1036531L, 1036537L,
-1036561L, 1036579L, 1036613L, 1036619L, 1036631L, 1036649L, 1036661L, 1036667L, 1036669L,
-1036681L, 1036729L, 1036747L, 1036751L, 1036757L, 1036759L, 1036769L, 1036787L, 1036793L,
-1036799L, 1036829L, 1036831L, 1036853L, 1036873L, 1036877L, 1036883L, 1036913L, 1036921L,
-1036943L, 1036951L, 1036957L, 1036979L, 1036991L, 1036993L, 1037041L, 1037053L, 1037059L,
-1037081L, 1037087L, 1037089L, 1037123L, 1037129L, 1037137L, 1037143L, 1037213L, 1037233L,
-1037249L, 1037261L, 1037273L, 1037293L, 1037297L, 1037303L, 1037317L, 1037327L, 1037329L,
-1037339L, 1037347L, 1037401L, 1037411L, 1037437L, 1037441L, 1037447L, 1037471L, 1037479L,
-1037489L, 1037497L, 1037503L, 1037537L, 1037557L, 1037563L, 1037567L, 1037593L, 1037611L,
-1037627L, 1037653L, 1037657L, 1037677L, 1037681L, 1037683L, 1037741L, 1037747L, 1037753L,
-1037759L, 1037767L, 1037791L, 1037801L, 1037819L, 1037831L, 1037857L, 1037873L, 1037879L,
-1037893L, 1037903L, 1037917L, 1037929L, 1037941L, 1037957L, 1037963L, 1037983L, 1038001L,
-1038017L, 1038019L, 1038029L, 1038041L, 1038043L, 1038047L, 1038073L, 1038077L, 1038119L,
-1038127L, 1038143L, 1038157L, 1038187L, 1038199L, 1038203L, 1038209L, 1038211L, 1038227L,
-1038251L, 1038253L, 1038259L, 1038263L, 1038269L, 1038307L, 1038311L, 1038319L, 1038329L,
-1038337L, 1038383L, 1038391L, 1038409L, 1038421L, 1038449L, 1038463L, 1038487L, 1038497L,
-1038503L, 1038523L, 1038529L, 1038539L, 1038563L, 1038589L, 1038599L, 1038601L, 1038617L,
-1038619L, 1038623L, 1038629L, 1038637L, 1038643L, 1038671L, 1038689L, 1038691L, 1038707L,
-1038721L, 1038727L, 1038731L, 1038757L, 1038797L, 1038803L, 1038811L, 1038823L, 1038827L,
-1038833L, 1038881L, 1038913L, 1038937L, 1038941L, 1038953L, 1039001L, 1039007L, 1039021L,
-1039033L, 1039037L, 1039039L, 1039043L, 1039067L, 1039069L, 1039081L, 1039109L, 1039111L,
-1039127L, 1039139L, 1039153L, 1039169L, 1039187L, 1039229L, 1039249L, 1039279L, 1039289L,
-1039307L, 1039321L, 1039327L, 1039343L, 1039349L, 1039351L, 1039387L, 1039421L, 1039427L,
-1039429L, 1039463L, 1039469L, 1039477L, 1039481L, 1039513L, 1039517L, 1039537L, 1039543L,
-1039553L, 1039603L, 1039607L, 1039631L, 1039651L, 1039657L, 1039667L, 1039681L, 1039733L,
-1039763L, 1039769L, 1039789L, 1039799L, 1039817L, 1039823L, 1039837L, 1039891L, 1039897L,
-1039901L, 1039921L, 1039931L, 1039943L, 1039949L, 1039979L, 1039999L, 1040021L, 1040029L,
-1040051L, 1040057L, 1040059L, 1040069L, 1040071L, 1040089L, 1040093L, 1040101L, 1040113L,
-1040119L, 1040141L, 1040153L, 1040159L, 1040161L, 1040167L, 1040183L, 1040189L, 1040191L,
-1040203L, 1040219L, 1040227L, 1040311L, 1040327L, 1040339L, 1040353L, 1040371L, 1040381L,
-1040387L, 1040407L, 1040411L, 1040419L, 1040447L, 1040449L, 1040483L, 1040489L, 1040503L,
-1040521L, 1040531L, 1040563L, 1040579L, 1040581L, 1040597L, 1040629L, 1040651L, 1040657L,
-1040659L, 1040671L, 1040717L, 1040731L, 1040747L, 1040749L, 1040771L, 1040777L, 1040779L,
-1040783L, 1040797L, 1040803L, 1040807L, 1040813L, 1040821L, 1040827L, 1040833L, 1040857L,
-1040861L, 1040873L, 1040881L, 1040891L, 1040899L, 1040929L, 1040939L, 1040947L, 1040951L,
-1040959L, 1040981L, 1040989L, 1041041L, 1041077L, 1041083L, 1041091L, 1041109L, 1041119L,
-1041121L, 1041127L, 1041137L, 1041149L, 1041151L, 1041163L, 1041167L, 1041169L, 1041203L,
-1041221L, 1041223L, 1041239L, 1041241L, 1041253L, 1041269L, 1041281L, 1041283L, 1041289L,
-1041307L, 1041311L, 1041317L, 1041329L, 1041343L, 1041349L, 1041373L, 1041421L, 1041427L,
-1041449L, 1041451L, 1041461L, 1041497L, 1041511L, 1041517L, 1041529L, 1041553L, 1041559L,
-1041563L, 1041571L, 1041577L, 1041583L, 1041617L, 1041619L, 1041643L, 1041653L, 1041671L,
-1041673L, 1041701L, 1041731L, 1041737L, 1041757L, 1041779L, 1041787L, 1041793L, 1041823L,
-1041829L, 1041841L, 1041853L, 1041857L, 1041863L, 1041869L, 1041889L, 1041893L, 1041907L,
-1041919L, 1041949L, 1041961L, 1041983L, 1041991L, 1042001L, 1042021L, 1042039L, 1042043L,
-1042081L, 1042087L, 1042091L, 1042099L, 1042103L, 1042109L, 1042121L, 1042123L, 1042133L,
-1042141L, 1042183L, 1042187L, 1042193L, 1042211L, 1042241L, 1042243L, 1042259L, 1042267L,
-1042271L, 1042273L, 1042309L, 1042331L, 1042333L, 1042357L, 1042369L, 1042373L, 1042381L,
-1042399L, 1042427L, 1042439L, 1042451L, 1042469L, 1042487L, 1042519L, 1042523L, 1042529L,
-1042571L, 1042577L, 1042583L, 1042597L, 1042607L, 1042609L, 1042619L, 1042631L, 1042633L,
-1042681L, 1042687L, 1042693L, 1042703L, 1042709L, 1042733L, 1042759L, 1042781L, 1042799L,
-1042819L, 1042829L, 1042837L, 1042849L, 1042861L, 1042897L, 1042901L, 1042903L, 1042931L,
-1042949L, 1042961L, 1042997L, 1043011L, 1043023L, 1043047L, 1043083L, 1043089L, 1043111L,
-1043113L, 1043117L, 1043131L, 1043167L, 1043173L, 1043177L, 1043183L, 1043191L, 1043201L,
-1043209L, 1043213L, 1043221L, 1043279L, 1043291L, 1043293L, 1043299L, 1043311L, 1043323L,
-1043351L, 1043369L, 1043377L, 1043401L, 1043453L, 1043467L, 1043479L, 1043489L, 1043501L,
-1043513L, 1043521L, 1043531L, 1043543L, 1043557L, 1043587L, 1043591L, 1043593L, 1043597L,
-1043599L, 1043617L, 1043639L, 1043657L, 1043663L, 1043683L, 1043701L, 1043723L, 1043743L,
-1043747L, 1043753L, 1043759L, 1043761L, 1043767L, 1043773L, 1043831L, 1043837L, 1043839L,
-1043843L, 1043849L, 1043857L, 1043869L, 1043873L, 1043897L, 1043899L, 1043921L, 1043923L,
-1043929L, 1043951L, 1043969L, 1043981L, 1044019L, 1044023L, 1044041L, 1044053L, 1044079L,
-1044091L, 1044097L, 1044133L, 1044139L, 1044149L, 1044161L, 1044167L, 1044179L, 1044181L,
-1044187L, 1044193L, 1044209L, 1044217L, 1044227L, 1044247L, 1044257L, 1044271L, 1044283L,
-1044287L, 1044289L, 1044299L, 1044343L, 1044347L, 1044353L, 1044367L, 1044371L, 1044383L,
-1044391L, 1044397L, 1044409L, 1044437L, 1044443L, 1044451L, 1044457L, 1044479L, 1044509L,
-1044517L, 1044529L, 1044559L, 1044569L, 1044583L, 1044587L, 1044613L, 1044619L, 1044629L,
-1044653L, 1044689L, 1044697L, 1044727L, 1044733L, 1044737L, 1044739L, 1044749L, 1044751L,
-1044761L, 1044767L, 1044779L, 1044781L, 1044809L, 1044811L, 1044833L, 1044839L, 1044847L,
-1044851L, 1044859L, 1044877L, 1044889L, 1044893L, 1044931L, 1044941L, 1044971L, 1044997L,
-1045003L, 1045013L, 1045021L, 1045027L, 1045043L, 1045061L, 1045063L, 1045081L, 1045111L,
-1045117L, 1045123L, 1045129L, 1045151L, 1045153L, 1045157L, 1045183L, 1045193L, 1045199L,
-1045223L, 1045229L, 1045237L, 1045241L, 1045273L, 1045277L, 1045307L, 1045309L, 1045321L,
-1045349L, 1045367L, 1045391L, 1045393L, 1045397L, 1045409L, 1045411L, 1045423L, 1045427L,
-1045469L, 1045487L, 1045493L, 1045507L, 1045523L, 1045529L, 1045543L, 1045547L, 1045549L,
-1045559L, 1045571L, 1045573L, 1045607L, 1045621L, 1045633L, 1045643L, 1045651L, 1045663L,
-1045679L, 1045691L, 1045727L, 1045729L, 1045739L, 1045763L, 1045799L, 1045801L, 1045819L,
-1045829L, 1045841L, 1045859L, 1045903L, 1045907L, 1045963L, 1045981L, 1045987L, 1045997L,
-1046029L, 1046047L, 1046051L, 1046053L, 1046069L, 1046077L, 1046081L, 1046113L, 1046119L,
-1046179L, 1046183L, 1046189L, 1046191L, 1046203L, 1046207L, 1046237L, 1046239L, 1046257L,
-1046263L, 1046329L, 1046347L, 1046351L, 1046369L, 1046371L, 1046389L, 1046393L, 1046399L,
-1046413L, 1046447L, 1046449L, 1046459L, 1046497L, 1046519L, 1046527L, 1046557L, 1046579L,
-1046587L, 1046597L, 1046599L, 1046627L, 1046641L, 1046657L, 1046659L, 1046677L, 1046681L,
-1046687L, 1046701L, 1046711L, 1046779L, 1046791L, 1046797L, 1046807L, 1046827L, 1046833L,
-1046849L, 1046863L, 1046867L, 1046897L, 1046917L, 1046933L, 1046951L, 1046959L, 1046977L,
-1046993L, 1046999L, 1047031L, 1047041L, 1047043L, 1047061L, 1047077L, 1047089L, 1047097L,
-1047107L, 1047119L, 1047127L, 1047131L, 1047133L, 1047139L, 1047157L, 1047173L, 1047197L,
-1047199L, 1047229L, 1047239L, 1047247L, 1047271L, 1047281L, 1047283L, 1047289L, 1047307L,
-1047311L, 1047313L, 1047317L, 1047323L, 1047341L, 1047367L, 1047373L, 1047379L, 1047391L,
-1047419L, 1047467L, 1047469L, 1047479L, 1047491L, 1047499L, 1047511L, 1047533L, 1047539L,
-1047551L, 1047559L, 1047587L, 1047589L, 1047647L, 1047649L, 1047653L, 1047667L, 1047671L,
-1047689L, 1047691L, 1047701L, 1047703L, 1047713L, 1047721L, 1047737L, 1047751L, 1047763L,
-1047773L, 1047779L, 1047821L, 1047833L, 1047841L, 1047859L, 1047881L, 1047883L, 1047887L,
-1047923L, 1047929L, 1047941L, 1047961L, 1047971L, 1047979L, 1047989L, 1047997L, 1048007L,
-1048009L, 1048013L, 1048027L, 1048043L, 1048049L, 1048051L, 1048063L, 1048123L, 1048127L,
-1048129L, 1048139L, 1048189L, 1048193L, 1048213L, 1048217L, 1048219L, 1048261L, 1048273L,
-1048291L, 1048309L, 1048343L, 1048357L, 1048361L, 1048367L, 1048387L, 1048391L, 1048423L,
-1048433L, 1048447L, 1048507L, 1048517L, 1048549L, 1048559L, 1048571L, 1048573L, 1048583L,
-1048589L, 1048601L, 1048609L, 1048613L, 1048627L, 1048633L, 1048661L, 1048681L, 1048703L,
-1048709L, 1048717L, 1048721L, 1048759L, 1048783L, 1048793L, 1048799L, 1048807L, 1048829L,
-1048837L, 1048847L, 1048867L, 1048877L, 1048889L, 1048891L, 1048897L, 1048909L, 1048919L,
-1048963L, 1048991L, 1049011L, 1049023L, 1049039L, 1049051L, 1049057L, 1049063L, 1049077L,
-1049089L, 1049093L, 1049101L, 1049117L, 1049129L, 1049131L, 1049137L, 1049141L, 1049143L,
-1049171L, 1049173L, 1049177L, 1049183L, 1049201L, 1049219L, 1049227L, 1049239L, 1049263L,
-1049281L, 1049297L, 1049333L, 1049339L, 1049387L, 1049413L, 1049429L, 1049437L, 1049459L,
-1049471L, 1049473L, 1049479L, 1049483L, 1049497L, 1049509L, 1049519L, 1049527L, 1049533L,
-1049537L, 1049549L, 1049569L, 1049599L, 1049603L, 1049611L, 1049623L, 1049639L, 1049663L,
-1049677L, 1049681L, 1049683L, 1049687L, 1049707L, 1049717L, 1049747L, 1049773L, 1049791L,
-1049809L, 1049821L, 1049827L, 1049833L, 1049837L, 1049843L, 1049849L, 1049857L, 1049861L,
-1049863L, 1049891L, 1049897L, 1049899L, 1049941L, 1049953L, 1049963L, 1049977L, 1049999L,
-1050011L, 1050013L, 1050031L, 1050041L, 1050053L, 1050079L, 1050083L, 1050139L, 1050151L,
-1050167L, 1050169L, 1050191L, 1050197L, 1050229L, 1050233L, 1050239L, 1050241L, 1050253L,
-1050281L, 1050307L, 1050317L, 1050323L, 1050331L, 1050337L, 1050349L, 1050367L, 1050391L,
-1050421L, 1050431L, 1050437L, 1050449L, 1050451L, 1050457L, 1050473L, 1050503L, 1050509L,
-1050523L, 1050563L, 1050593L, 1050611L, 1050631L, 1050713L, 1050727L, 1050733L, 1050737L,
-1050739L, 1050743L, 1050769L, 1050773L, 1050781L, 1050811L, 1050817L, 1050851L, 1050853L,
-1050887L, 1050899L, 1050901L, 1050913L, 1050949L, 1050961L, 1050977L, 1050997L, 1051003L,
-1051007L, 1051009L, 1051019L, 1051027L, 1051051L, 1051069L, 1051079L, 1051081L, 1051139L,
-1051147L, 1051151L, 1051153L, 1051157L, 1051177L, 1051181L, 1051247L, 1051277L, 1051283L,
-1051291L, 1051301L, 1051313L, 1051319L, 1051333L, 1051373L, 1051397L, 1051409L, 1051417L,
-1051423L, 1051459L, 1051469L, 1051471L, 1051481L, 1051499L, 1051507L, 1051543L, 1051549L,
-1051553L, 1051559L, 1051571L, 1051591L, 1051601L, 1051607L, 1051619L, 1051621L, 1051639L,
-1051643L, 1051649L, 1051663L, 1051697L, 1051709L, 1051717L, 1051747L, 1051759L, 1051763L,
-1051781L, 1051789L, 1051811L, 1051819L, 1051829L, 1051847L, 1051849L, 1051879L, 1051889L,
-1051903L, 1051913L, 1051927L, 1051949L, 1051957L, 1051961L, 1051979L, 1051987L, 1051991L,
-1052027L, 1052039L, 1052041L, 1052063L, 1052083L, 1052099L, 1052111L, 1052119L, 1052137L,
-1052141L, 1052179L, 1052197L, 1052203L, 1052221L, 1052231L, 1052237L, 1052269L, 1052279L,
-1052281L, 1052287L, 1052299L, 1052309L, 1052321L, 1052327L, 1052329L, 1052333L, 1052413L,
-1052417L, 1052431L, 1052437L, 1052459L, 1052473L, 1052479L, 1052489L, 1052531L, 1052533L,
-1052537L, 1052551L, 1052561L, 1052563L, 1052567L, 1052573L, 1052609L, 1052629L, 1052663L,
-1052693L, 1052707L, 1052719L, 1052731L, 1052743L, 1052747L, 1052767L, 1052797L, 1052801L,
-1052803L, 1052813L, 1052819L, 1052851L, 1052873L, 1052881L, 1052893L, 1052897L, 1052899L,
-1052939L, 1052971L, 1052981L, 1052993L, 1053007L, 1053029L, 1053061L, 1053067L, 1053071L,
-1053079L, 1053083L, 1053089L, 1053097L, 1053103L, 1053179L, 1053181L, 1053191L, 1053197L,
-1053233L, 1053257L, 1053259L, 1053263L, 1053271L, 1053293L, 1053301L, 1053319L, 1053347L,
-1053361L, 1053383L, 1053401L, 1053407L, 1053421L, 1053449L, 1053461L, 1053467L, 1053487L,
-1053491L, 1053497L, 1053509L, 1053511L, 1053529L, 1053539L, 1053551L, 1053557L, 1053571L,
-1053581L, 1053583L, 1053589L, 1053593L, 1053617L, 1053691L, 1053697L, 1053707L, 1053713L,
-1053727L, 1053737L, 1053739L, 1053749L, 1053757L, 1053769L, 1053809L, 1053817L, 1053821L,
-1053827L, 1053863L, 1053953L, 1053959L, 1053967L, 1053971L, 1053989L, 1053991L, 1054003L,
-1054007L, 1054013L, 1054033L, 1054043L, 1054049L, 1054061L, 1054073L, 1054091L, 1054133L,
-1054169L, 1054171L, 1054181L, 1054189L, 1054199L, 1054201L, 1054213L, 1054219L, 1054243L,
-1054247L, 1054259L, 1054267L, 1054301L, 1054303L, 1054309L, 1054321L, 1054327L, 1054331L,
-1054337L, 1054363L, 1054369L, 1054373L, 1054381L, 1054393L, 1054423L, 1054429L, 1054439L,
-1054441L, 1054457L, 1054477L, 1054483L, 1054517L, 1054523L, 1054531L, 1054549L, 1054577L,
-1054583L, 1054597L, 1054607L, 1054609L, 1054621L, 1054639L, 1054649L, 1054667L, 1054673L,
-1054679L, 1054717L, 1054721L, 1054723L, 1054733L, 1054769L, 1054813L, 1054819L, 1054831L,
-1054843L, 1054853L, 1054903L, 1054909L, 1054927L, 1054931L, 1054951L, 1054957L, 1054993L,
-1055017L, 1055039L, 1055057L, 1055063L, 1055077L, 1055083L, 1055113L, 1055137L, 1055141L,
-1055143L, 1055167L, 1055189L, 1055191L, 1055231L, 1055233L, 1055251L, 1055261L, 1055267L,
-1055269L, 1055303L, 1055321L, 1055347L, 1055359L, 1055363L, 1055371L, 1055387L, 1055399L,
-1055407L, 1055413L, 1055423L, 1055429L, 1055437L, 1055471L, 1055489L, 1055501L, 1055503L,
-1055531L, 1055543L, 1055567L, 1055591L, 1055597L, 1055603L, 1055609L, 1055611L, 1055671L,
-1055689L, 1055713L, 1055731L, 1055737L, 1055741L, 1055771L, 1055783L, 1055801L, 1055809L,
-1055827L, 1055839L, 1055851L, 1055863L, 1055867L, 1055881L, 1055893L, 1055897L, 1055911L,
-1055917L, 1055933L, 1055939L, 1055947L, 1055959L, 1055969L, 1055981L, 1056007L, 1056019L,
-1056047L, 1056049L, 1056053L, 1056061L, 1056071L, 1056073L, 1056089L, 1056109L, 1056113L,
-1056149L, 1056161L, 1056169L, 1056173L, 1056179L, 1056203L, 1056217L, 1056241L, 1056247L,
-1056269L, 1056271L, 1056281L, 1056287L, 1056311L, 1056317L, 1056323L, 1056347L, 1056353L,
-1056361L, 1056371L, 1056373L, 1056379L, 1056401L, 1056443L, 1056463L, 1056469L, 1056479L,
-1056481L, 1056493L, 1056509L, 1056521L, 1056541L, 1056563L, 1056569L, 1056577L, 1056589L,
-1056599L, 1056613L, 1056617L, 1056623L, 1056641L, 1056659L, 1056667L, 1056707L, 1056719L,
-1056721L, 1056739L, 1056773L, 1056779L, 1056793L, 1056823L, 1056829L, 1056833L, 1056863L,
-1056871L, 1056893L, 1056911L, 1056917L, 1056929L, 1056949L, 1056959L, 1056971L, 1057003L,
-1057013L, 1057019L, 1057033L, 1057037L, 1057051L, 1057087L, 1057093L, 1057117L, 1057129L,
-1057157L, 1057163L, 1057181L, 1057183L, 1057219L, 1057223L, 1057237L, 1057249L, 1057271L,
-1057279L, 1057291L, 1057307L, 1057361L, 1057367L, 1057387L, 1057391L, 1057393L, 1057411L,
-1057421L, 1057477L, 1057487L, 1057489L, 1057493L, 1057531L, 1057541L, 1057561L, 1057577L,
-1057579L, 1057603L, 1057607L, 1057613L, 1057631L, 1057633L, 1057643L, 1057657L, 1057663L,
-1057681L, 1057699L, 1057703L, 1057739L, 1057741L, 1057753L, 1057781L, 1057807L, 1057831L,
-1057853L, 1057879L, 1057883L, 1057897L, 1057907L, 1057919L, 1057951L, 1057957L, 1057963L,
-1057981L, 1057993L, 1058009L, 1058011L, 1058021L, 1058027L, 1058041L, 1058059L, 1058077L,
-1058093L, 1058107L, 1058117L, 1058143L, 1058147L, 1058149L, 1058153L, 1058171L, 1058179L,
-1058203L, 1058221L, 1058227L, 1058249L, 1058257L, 1058263L, 1058287L, 1058303L, 1058329L,
-1058339L, 1058341L, 1058353L, 1058377L, 1058381L, 1058383L, 1058389L, 1058419L, 1058423L,
-1058443L, 1058461L, 1058479L, 1058489L, 1058503L, 1058507L, 1058543L, 1058549L, 1058567L,
-1058591L, 1058593L, 1058597L, 1058627L, 1058639L, 1058653L, 1058657L, 1058663L, 1058671L,
-1058677L, 1058683L, 1058693L, 1058711L, 1058723L, 1058731L, 1058747L, 1058749L, 1058753L,
-1058767L, 1058773L, 1058779L, 1058791L, 1058803L, 1058807L, 1058809L, 1058821L, 1058839L,
-1058861L, 1058891L, 1058921L, 1058951L, 1058983L, 1058999L, 1059001L, 1059007L, 1059017L,
-1059029L, 1059059L, 1059061L, 1059067L, 1059073L, 1059077L, 1059103L, 1059119L, 1059131L,
-1059137L, 1059161L, 1059169L, 1059181L, 1059197L, 1059209L, 1059217L, 1059221L, 1059251L,
-1059257L, 1059259L, 1059263L, 1059271L, 1059293L, 1059299L, 1059313L, 1059323L, 1059343L,
-1059349L, 1059413L, 1059419L, 1059433L, 1059437L, 1059439L, 1059467L, 1059479L, 1059503L,
-1059511L, 1059517L, 1059547L, 1059557L, 1059571L, 1059599L, 1059613L, 1059637L, 1059647L,
-1059671L, 1059683L, 1059697L, 1059701L, 1059703L, 1059713L, 1059733L, 1059743L, 1059749L,
-1059757L, 1059769L, 1059787L, 1059823L, 1059833L, 1059847L, 1059857L, 1059871L, 1059889L,
-1059893L, 1059923L, 1059931L, 1059937L, 1059941L, 1060009L, 1060019L, 1060021L, 1060039L,
-1060043L, 1060051L, 1060061L, 1060091L, 1060097L, 1060123L, 1060133L, 1060151L, 1060177L,
-1060187L, 1060201L, 1060207L, 1060223L, 1060229L, 1060237L, 1060249L, 1060253L, 1060271L,
-1060303L, 1060313L, 1060321L, 1060343L, 1060349L, 1060351L, 1060357L, 1060361L, 1060373L,
-1060379L, 1060391L, 1060393L, 1060403L, 1060421L, 1060427L, 1060441L, 1060453L, 1060463L,
-1060469L, 1060481L, 1060487L, 1060513L, 1060519L, 1060529L, 1060567L, 1060571L, 1060573L,
-1060589L, 1060597L, 1060621L, 1060673L, 1060687L, 1060721L, 1060723L, 1060739L, 1060747L,
-1060769L, 1060777L, 1060781L, 1060861L, 1060867L, 1060883L, 1060937L, 1060949L, 1060963L,
-1060981L, 1060991L, 1060993L, 1061033L, 1061057L, 1061069L, 1061087L, 1061101L, 1061107L,
-1061117L, 1061129L, 1061141L, 1061143L, 1061149L, 1061171L, 1061189L, 1061227L, 1061251L,
-1061261L, 1061273L, 1061279L, 1061287L, 1061297L, 1061311L, 1061317L, 1061323L, 1061353L,
-1061363L, 1061377L, 1061393L, 1061407L, 1061413L, 1061441L, 1061453L, 1061483L, 1061509L,
-1061513L, 1061527L, 1061561L, 1061569L, 1061573L, 1061591L, 1061597L, 1061609L, 1061617L,
-1061623L, 1061629L, 1061647L, 1061651L, 1061677L, 1061689L, 1061699L, 1061707L, 1061717L,
-1061729L, 1061737L, 1061759L, 1061771L, 1061773L, 1061779L, 1061783L, 1061807L, 1061831L,
-1061849L, 1061867L, 1061869L, 1061881L, 1061897L, 1061903L, 1061909L, 1061911L, 1061917L,
-1061959L, 1061969L, 1061993L, 1062001L, 1062013L, 1062031L, 1062073L, 1062107L, 1062121L,
-1062169L, 1062197L, 1062203L, 1062251L, 1062253L, 1062263L, 1062293L, 1062311L, 1062343L,
-1062349L, 1062361L, 1062367L, 1062379L, 1062407L, 1062409L, 1062427L, 1062443L, 1062469L,
-1062497L, 1062511L, 1062521L, 1062547L, 1062557L, 1062563L, 1062599L, 1062601L, 1062643L,
-1062671L, 1062673L, 1062683L, 1062697L, 1062701L, 1062707L, 1062731L, 1062779L, 1062781L,
-1062793L, 1062797L, 1062827L, 1062847L, 1062869L, 1062871L, 1062877L, 1062881L, 1062907L,
-1062911L, 1062913L, 1062931L, 1062947L, 1062949L, 1062977L, 1062979L, 1062989L, 1063001L,
-1063009L, 1063019L, 1063033L, 1063039L, 1063043L, 1063067L, 1063079L, 1063087L, 1063109L,
-1063123L, 1063151L, 1063157L, 1063159L, 1063177L, 1063189L, 1063193L, 1063201L, 1063213L,
-1063219L, 1063241L, 1063243L, 1063273L, 1063303L, 1063319L, 1063351L, 1063379L, 1063397L,
-1063399L, 1063409L, 1063427L, 1063441L, 1063453L, 1063457L, 1063463L, 1063471L, 1063477L,
-1063483L, 1063501L, 1063523L, 1063529L, 1063541L, 1063547L, 1063553L, 1063561L, 1063597L,
-1063609L, 1063613L, 1063619L, 1063627L, 1063637L, 1063649L, 1063661L, 1063693L, 1063709L,
-1063721L, 1063729L, 1063739L, 1063747L, 1063757L, 1063771L, 1063781L, 1063813L, 1063823L,
-1063831L, 1063837L, 1063847L, 1063849L, 1063871L, 1063873L, 1063891L, 1063897L, 1063903L,
-1063913L, 1063919L, 1063921L, 1063927L, 1063961L, 1063963L, 1063967L, 1063969L, 1063973L,
-1063987L, 1063999L, 1064017L, 1064029L, 1064059L, 1064069L, 1064087L, 1064117L, 1064131L,
-1064153L, 1064159L, 1064177L, 1064179L, 1064191L, 1064197L, 1064201L, 1064243L, 1064257L,
-1064263L, 1064269L, 1064281L, 1064311L, 1064317L, 1064321L, 1064333L, 1064339L, 1064341L,
-1064359L, 1064377L, 1064383L, 1064407L, 1064411L, 1064431L, 1064467L, 1064471L, 1064473L,
-1064477L, 1064507L, 1064519L, 1064521L, 1064533L, 1064549L, 1064587L, 1064593L, 1064629L,
-1064653L, 1064669L, 1064671L, 1064681L, 1064689L, 1064699L, 1064731L, 1064737L, 1064743L,
-1064753L, 1064771L, 1064783L, 1064801L, 1064813L, 1064867L, 1064873L, 1064911L, 1064927L,
-1064933L, 1064939L, 1064941L, 1064951L, 1064953L, 1064957L, 1064977L, 1064989L, 1065011L,
-1065013L, 1065017L, 1065019L, 1065037L, 1065041L, 1065047L, 1065059L, 1065073L, 1065089L,
-1065091L, 1065109L, 1065131L, 1065133L, 1065137L, 1065173L, 1065209L, 1065217L, 1065263L,
-1065269L, 1065277L, 1065283L, 1065307L, 1065313L, 1065319L, 1065331L, 1065343L, 1065347L,
-1065391L, 1065409L, 1065433L, 1065469L, 1065479L, 1065503L, 1065511L, 1065523L, 1065527L,
-1065529L, 1065557L, 1065569L, 1065593L, 1065601L, 1065629L, 1065643L, 1065667L, 1065677L,
-1065683L, 1065689L, 1065697L, 1065709L, 1065733L, 1065763L, 1065773L, 1065787L, 1065791L,
-1065809L, 1065817L, 1065821L, 1065829L, 1065839L, 1065847L, 1065851L, 1065887L, 1065893L,
-1065899L, 1065901L, 1065937L, 1065941L, 1065949L, 1065973L, 1065979L, 1066001L, 1066031L,
-1066049L, 1066063L, 1066067L, 1066111L, 1066133L, 1066139L, 1066141L, 1066157L, 1066159L,
-1066217L, 1066231L, 1066237L, 1066253L, 1066267L, 1066279L, 1066283L, 1066297L, 1066313L,
-1066319L, 1066327L, 1066333L, 1066339L, 1066343L, 1066367L, 1066379L, 1066399L, 1066409L,
-1066411L, 1066423L, 1066433L, 1066447L, 1066511L, 1066517L, 1066523L, 1066531L, 1066553L,
-1066561L, 1066567L, 1066577L, 1066619L, 1066621L, 1066643L, 1066651L, 1066669L, 1066687L,
-1066693L, 1066721L, 1066729L, 1066753L, 1066757L, 1066777L, 1066789L, 1066811L, 1066817L,
-1066847L, 1066859L, 1066867L, 1066883L, 1066889L, 1066909L, 1066913L, 1066931L, 1066973L,
-1066979L, 1066981L, 1066987L, 1066999L, 1067009L, 1067023L, 1067029L, 1067047L, 1067057L,
-1067063L, 1067069L, 1067083L, 1067137L, 1067147L, 1067159L, 1067167L, 1067179L, 1067203L,
-1067207L, 1067221L, 1067239L, 1067263L, 1067293L, 1067327L, 1067329L, 1067347L, 1067351L,
-1067359L, 1067371L, 1067383L, 1067387L, 1067411L, 1067441L, 1067459L, 1067467L, 1067471L,
-1067489L, 1067491L, 1067497L, 1067509L, 1067537L, 1067551L, 1067557L, 1067567L, 1067569L,
-1067593L, 1067597L, 1067611L, 1067621L, 1067639L, 1067653L, 1067669L, 1067687L, 1067701L,
-1067707L, 1067711L, 1067741L, 1067747L, 1067749L, 1067761L, 1067767L, 1067777L, 1067789L,
-1067797L, 1067831L, 1067837L, 1067849L, 1067851L, 1067879L, 1067893L, 1067903L, 1067909L,
-1067921L, 1067939L, 1067951L, 1067987L, 1067999L, 1068019L, 1068037L, 1068061L, 1068083L,
-1068101L, 1068103L, 1068107L, 1068113L, 1068131L, 1068149L, 1068191L, 1068203L, 1068217L,
-1068233L, 1068241L, 1068247L, 1068251L, 1068253L, 1068257L, 1068259L, 1068271L, 1068307L,
-1068311L, 1068323L, 1068329L, 1068343L, 1068367L, 1068371L, 1068377L, 1068383L, 1068407L,
-1068409L, 1068437L, 1068439L, 1068461L, 1068469L, 1068481L, 1068491L, 1068497L, 1068499L,
-1068517L, 1068559L, 1068577L, 1068589L, 1068611L, 1068619L, 1068629L, 1068631L, 1068677L,
-1068701L, 1068703L, 1068707L, 1068709L, 1068713L, 1068719L, 1068721L, 1068751L, 1068757L,
-1068761L, 1068779L, 1068803L, 1068811L, 1068817L, 1068857L, 1068871L, 1068877L, 1068887L,
-1068889L, 1068901L, 1068913L, 1068917L, 1068941L, 1068989L, 1069001L, 1069007L, 1069031L,
-1069039L, 1069043L, 1069051L, 1069087L, 1069099L, 1069127L, 1069129L, 1069141L, 1069171L,
-1069183L, 1069193L, 1069199L, 1069207L, 1069217L, 1069219L, 1069223L, 1069267L, 1069273L,
-1069291L, 1069303L, 1069307L, 1069349L, 1069363L, 1069379L, 1069421L, 1069427L, 1069429L,
-1069441L, 1069451L, 1069459L, 1069463L, 1069499L, 1069501L, 1069507L, 1069517L, 1069543L,
-1069547L, 1069553L, 1069561L, 1069571L, 1069573L, 1069577L, 1069583L, 1069591L, 1069597L,
-1069603L, 1069609L, 1069631L, 1069639L, 1069667L, 1069687L, 1069693L, 1069697L, 1069727L,
-1069741L, 1069751L, 1069777L, 1069807L, 1069811L, 1069819L, 1069823L, 1069853L, 1069867L,
-1069919L, 1069921L, 1069927L, 1069931L, 1069933L, 1069949L, 1069951L, 1069973L, 1069979L,
-1069987L, 1070009L, 1070011L, 1070021L, 1070033L, 1070039L, 1070063L, 1070081L, 1070087L,
-1070093L, 1070131L, 1070149L, 1070171L, 1070189L, 1070197L, 1070203L, 1070207L, 1070221L,
-1070231L, 1070233L, 1070243L, 1070249L, 1070257L, 1070287L, 1070291L, 1070309L, 1070317L,
-1070323L, 1070339L, 1070341L, 1070347L, 1070357L, 1070369L, 1070389L, 1070411L, 1070417L,
-1070423L, 1070429L, 1070431L, 1070453L, 1070471L, 1070491L, 1070497L, 1070501L, 1070513L,
-1070527L, 1070533L, 1070543L, 1070557L, 1070561L, 1070567L, 1070569L, 1070579L, 1070621L,
-1070659L, 1070681L, 1070683L, 1070689L, 1070753L, 1070761L, 1070777L, 1070789L, 1070803L,
-1070827L, 1070843L, 1070851L, 1070869L, 1070873L, 1070899L, 1070921L, 1070933L, 1070939L,
-1070947L, 1070981L, 1070987L, 1071023L, 1071047L, 1071053L, 1071061L, 1071067L, 1071121L,
-1071131L, 1071139L, 1071149L, 1071151L, 1071157L, 1071181L, 1071193L, 1071197L, 1071223L,
-1071227L, 1071229L, 1071233L, 1071241L, 1071253L, 1071269L, 1071283L, 1071311L, 1071313L,
-1071337L, 1071341L, 1071349L, 1071359L, 1071373L, 1071377L, 1071379L, 1071401L, 1071407L,
-1071419L, 1071439L, 1071443L, 1071451L, 1071457L, 1071479L, 1071487L, 1071529L, 1071533L,
-1071541L, 1071563L, 1071569L, 1071571L, 1071589L, 1071601L, 1071641L, 1071643L, 1071659L,
-1071661L, 1071671L, 1071683L, 1071703L, 1071739L, 1071743L, 1071761L, 1071773L, 1071787L,
-1071803L, 1071817L, 1071821L, 1071841L, 1071857L, 1071871L, 1071899L, 1071907L, 1071911L,
-1071919L, 1071937L, 1071943L, 1071977L, 1071979L, 1071991L, 1072009L, 1072039L, 1072103L,
-1072129L, 1072133L, 1072147L, 1072157L, 1072163L, 1072187L, 1072199L, 1072213L, 1072219L,
-1072229L, 1072231L, 1072301L, 1072327L, 1072339L, 1072363L, 1072367L, 1072373L, 1072381L,
-1072387L, 1072397L, 1072429L, 1072433L, 1072439L, 1072447L, 1072457L, 1072459L, 1072471L,
-1072517L, 1072537L, 1072543L, 1072613L, 1072627L, 1072633L, 1072637L, 1072657L, 1072711L,
-1072733L, 1072763L, 1072793L, 1072801L, 1072811L, 1072823L, 1072829L, 1072831L, 1072837L,
-1072843L, 1072849L, 1072859L, 1072867L, 1072901L, 1072919L, 1072931L, 1072933L, 1072937L,
-1072943L, 1072957L, 1072961L, 1072969L, 1072991L, 1072997L, 1072999L, 1073053L, 1073069L,
-1073077L, 1073089L, 1073099L, 1073113L, 1073117L, 1073131L, 1073141L, 1073143L, 1073147L,
-1073153L, 1073183L, 1073201L, 1073209L, 1073213L, 1073221L, 1073239L, 1073243L, 1073263L,
-1073279L, 1073297L, 1073311L, 1073321L, 1073351L, 1073353L, 1073381L, 1073383L, 1073393L,
-1073399L, 1073411L, 1073441L, 1073447L, 1073461L, 1073491L, 1073507L, 1073509L, 1073521L,
-1073537L, 1073563L, 1073573L, 1073587L, 1073593L, 1073599L, 1073603L, 1073627L, 1073647L,
-1073651L, 1073687L, 1073711L, 1073713L, 1073717L, 1073729L, 1073773L, 1073789L, 1073791L,
-1073803L, 1073819L, 1073837L, 1073857L, 1073869L, 1073879L, 1073881L, 1073909L, 1073911L,
-1073921L, 1073951L, 1073953L, 1073983L, 1074001L, 1074023L, 1074041L, 1074061L, 1074067L,
-1074071L, 1074079L, 1074083L, 1074107L, 1074109L, 1074113L, 1074121L, 1074133L, 1074167L,
-1074223L, 1074251L, 1074253L, 1074259L, 1074277L, 1074287L, 1074289L, 1074299L, 1074329L,
-1074343L, 1074361L, 1074371L, 1074377L, 1074379L, 1074389L, 1074427L, 1074433L, 1074461L,
-1074473L, 1074481L, 1074509L, 1074511L, 1074523L, 1074533L, 1074559L, 1074581L, 1074607L,
-1074617L, 1074641L, 1074643L, 1074649L, 1074673L, 1074683L, 1074691L, 1074701L, 1074707L,
-1074709L, 1074713L, 1074719L, 1074751L, 1074761L, 1074763L, 1074833L, 1074839L, 1074847L,
-1074851L, 1074877L, 1074883L, 1074889L, 1074901L, 1074907L, 1074917L, 1074919L, 1074923L,
-1074929L, 1074949L, 1074971L, 1074973L, 1074977L, 1074989L, 1074991L, 1075007L, 1075013L,
-1075021L, 1075027L, 1075069L, 1075073L, 1075079L, 1075091L, 1075093L, 1075103L, 1075133L,
-1075141L, 1075147L, 1075159L, 1075163L, 1075169L, 1075171L, 1075177L, 1075187L, 1075201L,
-1075231L, 1075237L, 1075241L, 1075259L, 1075279L, 1075289L, 1075303L, 1075337L, 1075339L,
-1075351L, 1075357L, 1075391L, 1075397L, 1075409L, 1075429L, 1075433L, 1075441L, 1075453L,
-1075463L, 1075469L, 1075489L, 1075493L, 1075499L, 1075507L, 1075519L, 1075531L, 1075537L,
-1075561L, 1075577L, 1075601L, 1075619L, 1075621L, 1075643L, 1075649L, 1075651L, 1075663L,
-1075667L, 1075673L, 1075681L, 1075691L, 1075693L, 1075699L, 1075703L, 1075727L, 1075729L,
-1075757L, 1075759L, 1075769L, 1075771L, 1075787L, 1075807L, 1075843L, 1075853L, 1075859L,
-1075897L, 1075909L, 1075957L, 1075973L, 1076003L, 1076011L, 1076017L, 1076029L, 1076039L,
-1076051L, 1076057L, 1076063L, 1076069L, 1076077L, 1076107L, 1076111L, 1076113L, 1076123L,
-1076129L, 1076137L, 1076143L, 1076167L, 1076171L, 1076191L, 1076203L, 1076213L, 1076237L,
-1076263L, 1076279L, 1076281L, 1076303L, 1076323L, 1076329L, 1076353L, 1076359L, 1076381L,
-1076399L, 1076401L, 1076417L, 1076429L, 1076443L, 1076447L, 1076461L, 1076473L, 1076477L,
-1076501L, 1076503L, 1076507L, 1076513L, 1076519L, 1076557L, 1076563L, 1076587L, 1076611L,
-1076617L, 1076639L, 1076651L, 1076657L, 1076671L, 1076707L, 1076717L, 1076731L, 1076753L,
-1076767L, 1076771L, 1076773L, 1076813L, 1076821L, 1076827L, 1076843L, 1076861L, 1076869L,
-1076879L, 1076893L, 1076903L, 1076917L, 1076921L, 1076953L, 1076981L, 1077017L, 1077023L,
-1077047L, 1077059L, 1077079L, 1077101L, 1077127L, 1077143L, 1077161L, 1077179L, 1077191L,
-1077203L, 1077221L, 1077227L, 1077233L, 1077289L, 1077299L, 1077301L, 1077311L, 1077337L,
-1077347L, 1077353L, 1077371L, 1077397L, 1077413L, 1077421L, 1077449L, 1077457L, 1077469L,
-1077499L, 1077533L, 1077539L, 1077541L, 1077563L, 1077599L, 1077607L, 1077641L, 1077673L,
-1077677L, 1077691L, 1077697L, 1077707L, 1077719L, 1077721L, 1077733L, 1077743L, 1077751L,
-1077761L, 1077763L, 1077793L, 1077799L, 1077821L, 1077823L, 1077827L, 1077841L, 1077859L,
-1077863L, 1077893L, 1077911L, 1077913L, 1077917L, 1077943L, 1077971L, 1077977L, 1077997L,
-1078001L, 1078009L, 1078019L, 1078027L, 1078031L, 1078043L, 1078081L, 1078109L, 1078111L,
-1078127L, 1078151L, 1078153L, 1078159L, 1078163L, 1078169L, 1078183L, 1078199L, 1078219L,
-1078241L, 1078247L, 1078331L, 1078333L, 1078367L, 1078369L, 1078373L, 1078387L, 1078393L,
-1078403L, 1078409L, 1078411L, 1078417L, 1078471L, 1078489L, 1078507L, 1078537L, 1078559L,
-1078589L, 1078643L, 1078657L, 1078673L, 1078681L, 1078691L, 1078699L, 1078711L, 1078717L,
-1078733L, 1078739L, 1078757L, 1078787L, 1078789L, 1078807L, 1078813L, 1078817L, 1078841L,
-1078849L, 1078853L, 1078873L, 1078879L, 1078919L, 1078927L, 1078937L, 1078943L, 1078951L,
-1078967L, 1078981L, 1078993L, 1079009L, 1079011L, 1079021L, 1079033L, 1079053L, 1079059L,
-1079069L, 1079077L, 1079081L, 1079087L, 1079093L, 1079101L, 1079107L, 1079123L, 1079147L,
-1079153L, 1079173L, 1079189L, 1079213L, 1079227L, 1079233L, 1079251L, 1079269L, 1079291L,
-1079297L, 1079311L, 1079317L, 1079329L, 1079339L, 1079357L, 1079359L, 1079369L, 1079383L,
-1079399L, 1079417L, 1079431L, 1079453L, 1079461L, 1079471L, 1079473L, 1079503L, 1079509L,
-1079527L, 1079531L, 1079539L, 1079569L, 1079593L, 1079609L, 1079621L, 1079629L, 1079633L,
-1079647L, 1079651L, 1079669L, 1079671L, 1079681L, 1079711L, 1079717L, 1079753L, 1079777L,
-1079779L, 1079783L, 1079797L, 1079809L, 1079821L, 1079831L, 1079849L, 1079861L, 1079867L,
-1079879L, 1079887L, 1079917L, 1079927L, 1079929L, 1079933L, 1079957L, 1079963L, 1079977L,
-1079983L, 1079987L, 1079999L, 1080007L, 1080029L, 1080043L, 1080049L, 1080059L, 1080073L,
-1080077L, 1080083L, 1080089L, 1080091L, 1080097L, 1080119L, 1080137L, 1080143L, 1080173L,
-1080199L, 1080217L, 1080223L, 1080229L, 1080251L, 1080259L, 1080263L, 1080269L, 1080271L,
-1080281L, 1080301L, 1080307L, 1080311L, 1080329L, 1080341L, 1080347L, 1080353L, 1080383L,
-1080413L, 1080419L, 1080433L, 1080439L, 1080449L, 1080451L, 1080463L, 1080479L, 1080481L,
-1080491L, 1080523L, 1080539L, 1080553L, 1080557L, 1080559L, 1080589L, 1080613L, 1080647L,
-1080649L, 1080661L, 1080679L, 1080683L, 1080713L, 1080749L, 1080757L, 1080763L, 1080767L,
-1080773L, 1080787L, 1080791L, 1080797L, 1080803L, 1080811L, 1080817L, 1080823L, 1080841L,
-1080847L, 1080851L, 1080857L, 1080899L, 1080901L, 1080907L, 1080913L, 1080923L, 1080941L,
-1080943L, 1080971L, 1080973L, 1080983L, 1081027L, 1081037L, 1081051L, 1081061L, 1081079L,
-1081097L, 1081099L, 1081121L, 1081123L, 1081127L, 1081133L, 1081139L, 1081153L, 1081163L,
-1081219L, 1081229L, 1081231L, 1081237L, 1081243L, 1081247L, 1081277L, 1081279L, 1081291L,
-1081303L, 1081307L, 1081331L, 1081337L, 1081351L, 1081361L, 1081369L, 1081403L, 1081417L,
-1081429L, 1081441L, 1081477L, 1081501L, 1081513L, 1081541L, 1081583L, 1081631L, 1081637L,
-1081657L, 1081679L, 1081681L, 1081687L, 1081699L, 1081709L, 1081711L, 1081721L, 1081723L,
-1081733L, 1081741L, 1081757L, 1081763L, 1081771L, 1081777L, 1081781L, 1081789L, 1081793L,
-1081813L, 1081823L, 1081853L, 1081859L, 1081891L, 1081901L, 1081907L, 1081919L, 1081937L,
-1081939L, 1081979L, 1081981L, 1082017L, 1082023L, 1082027L, 1082047L, 1082083L, 1082089L,
-1082093L, 1082099L, 1082129L, 1082141L, 1082143L, 1082149L, 1082153L, 1082161L, 1082171L,
-1082177L, 1082189L, 1082197L, 1082209L, 1082231L, 1082233L, 1082243L, 1082273L, 1082317L,
-1082321L, 1082351L, 1082369L, 1082377L, 1082381L, 1082383L, 1082387L, 1082399L, 1082429L,
-1082443L, 1082447L, 1082467L, 1082491L, 1082527L, 1082531L, 1082533L, 1082573L, 1082579L,
-1082581L, 1082593L, 1082597L, 1082603L, 1082621L, 1082629L, 1082647L, 1082659L, 1082681L,
-1082699L, 1082707L, 1082717L, 1082723L, 1082729L, 1082743L, 1082761L, 1082777L, 1082801L,
-1082881L, 1082891L, 1082911L, 1082969L, 1082971L, 1082989L, 1082993L, 1082999L, 1083007L,
-1083031L, 1083037L, 1083059L, 1083073L, 1083077L, 1083079L, 1083083L, 1083107L, 1083113L,
-1083119L, 1083151L, 1083167L, 1083191L, 1083193L, 1083211L, 1083241L, 1083253L, 1083283L,
-1083287L, 1083289L, 1083301L, 1083307L, 1083311L, 1083317L, 1083319L, 1083337L, 1083349L,
-1083367L, 1083371L, 1083377L, 1083391L, 1083409L, 1083431L, 1083443L, 1083449L, 1083451L,
-1083463L, 1083473L, 1083497L, 1083517L, 1083541L, 1083559L, 1083571L, 1083583L, 1083601L,
-1083611L, 1083613L, 1083659L, 1083689L, 1083707L, 1083713L, 1083721L, 1083743L, 1083749L,
-1083757L, 1083793L, 1083809L, 1083827L, 1083833L, 1083839L, 1083847L, 1083851L, 1083871L,
-1083881L, 1083899L, 1083911L, 1083913L, 1083923L, 1083941L, 1083947L, 1083949L, 1083983L,
-1084001L, 1084019L, 1084043L, 1084051L, 1084067L, 1084079L, 1084087L, 1084093L, 1084103L,
-1084133L, 1084147L, 1084157L, 1084177L, 1084217L, 1084219L, 1084247L, 1084253L, 1084267L,
-1084297L, 1084301L, 1084309L, 1084313L, 1084333L, 1084357L, 1084367L, 1084373L, 1084403L,
-1084423L, 1084429L, 1084451L, 1084459L, 1084469L, 1084471L, 1084477L, 1084483L, 1084493L,
-1084543L, 1084547L, 1084553L, 1084579L, 1084609L, 1084613L, 1084621L, 1084627L, 1084637L,
-1084649L, 1084661L, 1084669L, 1084673L, 1084697L, 1084711L, 1084723L, 1084747L, 1084757L,
-1084771L, 1084777L, 1084793L, 1084799L, 1084817L, 1084823L, 1084829L, 1084859L, 1084871L,
-1084891L, 1084927L, 1084939L, 1084943L, 1084949L, 1084981L, 1084987L, 1084997L, 1085003L,
-1085011L, 1085017L, 1085023L, 1085047L, 1085053L, 1085101L, 1085111L, 1085113L, 1085131L,
-1085137L, 1085141L, 1085143L, 1085153L, 1085159L, 1085179L, 1085197L, 1085221L, 1085269L,
-1085309L, 1085317L, 1085327L, 1085351L, 1085353L, 1085369L, 1085389L, 1085407L, 1085419L,
-1085429L, 1085431L, 1085443L, 1085459L, 1085473L, 1085509L, 1085521L, 1085551L, 1085587L,
-1085611L, 1085627L, 1085633L, 1085657L, 1085663L, 1085677L, 1085681L, 1085687L, 1085719L,
-1085737L, 1085753L, 1085767L, 1085771L, 1085779L, 1085801L, 1085809L, 1085813L, 1085827L,
-1085857L, 1085863L, 1085867L, 1085873L, 1085881L, 1085891L, 1085911L, 1085933L, 1085957L,
-1085971L, 1085989L, 1086031L, 1086047L, 1086073L, 1086089L, 1086091L, 1086101L, 1086103L,
-1086119L, 1086133L, 1086139L, 1086149L, 1086161L, 1086179L, 1086191L, 1086193L, 1086199L,
-1086203L, 1086247L, 1086251L, 1086257L, 1086259L, 1086263L, 1086277L, 1086299L, 1086301L,
-1086307L, 1086331L, 1086343L, 1086347L, 1086353L, 1086361L, 1086373L, 1086389L, 1086391L,
-1086413L, 1086433L, 1086443L, 1086461L, 1086469L, 1086493L, 1086509L, 1086511L, 1086523L,
-1086529L, 1086557L, 1086559L, 1086587L, 1086607L, 1086611L, 1086619L, 1086637L, 1086641L,
-1086647L, 1086677L, 1086689L, 1086703L, 1086731L, 1086749L, 1086763L, 1086769L, 1086791L,
-1086809L, 1086817L, 1086859L, 1086863L, 1086881L, 1086893L, 1086901L, 1086913L, 1086919L,
-1086923L, 1086931L, 1086937L, 1086989L, 1086991L, 1087001L, 1087019L, 1087027L, 1087061L,
-1087091L, 1087109L, 1087117L, 1087129L, 1087147L, 1087159L, 1087231L, 1087241L, 1087249L,
-1087259L, 1087271L, 1087291L, 1087301L, 1087309L, 1087349L, 1087357L, 1087379L, 1087381L,
-1087391L, 1087409L, 1087423L, 1087433L, 1087451L, 1087453L, 1087459L, 1087483L, 1087487L,
-1087517L, 1087519L, 1087543L, 1087553L, 1087561L, 1087589L, 1087591L, 1087621L, 1087631L,
-1087657L, 1087663L, 1087673L, 1087679L, 1087687L, 1087717L, 1087729L, 1087741L, 1087747L,
-1087753L, 1087781L, 1087787L, 1087789L, 1087799L, 1087811L, 1087817L, 1087829L, 1087841L,
-1087843L, 1087861L, 1087873L, 1087897L, 1087903L, 1087907L, 1087937L, 1087963L, 1087967L,
-1087973L, 1087981L, 1087987L, 1088023L, 1088027L, 1088039L, 1088053L, 1088063L, 1088071L,
-1088081L, 1088089L, 1088093L, 1088123L, 1088159L, 1088161L, 1088209L, 1088233L, 1088237L,
-1088239L, 1088251L, 1088267L, 1088273L, 1088293L, 1088309L, 1088371L, 1088387L, 1088389L,
-1088393L, 1088407L, 1088413L, 1088419L, 1088431L, 1088443L, 1088447L, 1088449L, 1088467L,
-1088471L, 1088489L, 1088519L, 1088533L, 1088537L, 1088543L, 1088569L, 1088579L, 1088603L,
-1088611L, 1088617L, 1088621L, 1088623L, 1088639L, 1088641L, 1088657L, 1088669L, 1088671L,
-1088687L, 1088693L, 1088707L, 1088723L, 1088749L, 1088753L, 1088761L, 1088777L, 1088783L,
-1088807L, 1088827L, 1088831L, 1088839L, 1088851L, 1088903L, 1088917L, 1088933L, 1088953L,
-1088957L, 1088959L, 1088977L, 1088987L, 1088993L, 1089017L, 1089029L, 1089047L, 1089091L,
-1089103L, 1089107L, 1089113L, 1089133L, 1089161L, 1089191L, 1089197L, 1089217L, 1089223L,
-1089227L, 1089239L, 1089259L, 1089299L, 1089313L, 1089359L, 1089383L, 1089397L, 1089401L,
-1089421L, 1089427L, 1089457L, 1089461L, 1089463L, 1089469L, 1089481L, 1089497L, 1089503L,
-1089509L, 1089523L, 1089551L, 1089563L, 1089611L, 1089629L, 1089653L, 1089661L, 1089677L,
-1089679L, 1089703L, 1089709L, 1089713L, 1089757L, 1089793L, 1089799L, 1089841L, 1089863L,
-1089877L, 1089917L, 1089919L, 1089941L, 1089943L, 1089961L, 1089967L, 1090003L, 1090013L,
-1090021L, 1090027L, 1090031L, 1090097L, 1090099L, 1090127L, 1090129L, 1090151L, 1090153L,
-1090169L, 1090181L, 1090189L, 1090211L, 1090213L, 1090217L, 1090241L, 1090249L, 1090267L,
-1090273L, 1090303L, 1090333L, 1090373L, 1090381L, 1090387L, 1090403L, 1090409L, 1090421L,
-1090423L, 1090457L, 1090459L, 1090469L, 1090471L, 1090483L, 1090493L, 1090519L, 1090553L,
-1090577L, 1090589L, 1090597L, 1090613L, 1090627L, 1090681L, 1090697L, 1090709L, 1090711L,
-1090717L, 1090721L, 1090757L, 1090759L, 1090769L, 1090783L, 1090799L, 1090807L, 1090819L,
-1090841L, 1090849L, 1090877L, 1090879L, 1090883L, 1090889L, 1090891L, 1090897L, 1090909L,
-1090919L, 1090927L, 1090937L, 1090939L, 1090949L, 1090963L, 1090967L, 1090979L, 1090997L,
-1091003L, 1091017L, 1091021L, 1091023L, 1091033L, 1091047L, 1091053L, 1091059L, 1091063L,
-1091071L, 1091119L, 1091137L, 1091147L, 1091149L, 1091159L, 1091161L, 1091173L, 1091177L,
-1091191L, 1091219L, 1091221L, 1091239L, 1091243L, 1091257L, 1091261L, 1091263L, 1091267L,
-1091269L, 1091273L, 1091287L, 1091329L, 1091339L, 1091359L, 1091369L, 1091371L, 1091381L,
-1091393L, 1091399L, 1091401L, 1091411L, 1091413L, 1091443L, 1091459L, 1091471L, 1091477L,
-1091509L, 1091521L, 1091527L, 1091549L, 1091551L, 1091561L, 1091581L, 1091591L, 1091609L,
-1091617L, 1091627L, 1091633L, 1091639L, 1091659L, 1091663L, 1091681L, 1091687L, 1091711L,
-1091729L, 1091731L, 1091737L, 1091749L, 1091777L, 1091807L, 1091809L, 1091837L, 1091843L,
-1091863L, 1091869L, 1091887L, 1091917L, 1091939L, 1091957L, 1091983L, 1092019L, 1092023L,
-1092041L, 1092043L, 1092059L, 1092061L, 1092067L, 1092089L, 1092103L, 1092107L, 1092127L,
-1092137L, 1092151L, 1092163L, 1092173L, 1092181L, 1092191L, 1092209L, 1092229L, 1092241L,
-1092251L, 1092257L, 1092269L, 1092283L, 1092307L, 1092331L, 1092337L, 1092349L, 1092353L,
-1092361L, 1092373L, 1092379L, 1092389L, 1092391L, 1092397L, 1092419L, 1092433L, 1092451L,
-1092461L, 1092463L, 1092473L, 1092479L, 1092493L, 1092541L, 1092583L, 1092593L, 1092601L,
-1092629L, 1092643L, 1092659L, 1092667L, 1092677L, 1092713L, 1092731L, 1092733L, 1092757L,
-1092779L, 1092803L, 1092821L, 1092827L, 1092829L, 1092851L, 1092853L, 1092863L, 1092887L,
-1092893L, 1092901L, 1092907L, 1092911L, 1092919L, 1092929L, 1092961L, 1092977L, 1092989L,
-1092991L, 1092997L, 1093007L, 1093033L, 1093061L, 1093063L, 1093067L, 1093069L, 1093087L,
-1093109L, 1093111L, 1093129L, 1093133L, 1093159L, 1093163L, 1093177L, 1093199L, 1093201L,
-1093223L, 1093237L, 1093243L, 1093249L, 1093273L, 1093283L, 1093289L, 1093297L, 1093307L,
-1093327L, 1093331L, 1093357L, 1093363L, 1093381L, 1093399L, 1093403L, 1093409L, 1093427L,
-1093441L, 1093487L, 1093493L, 1093517L, 1093529L, 1093531L, 1093537L, 1093541L, 1093553L,
-1093571L, 1093577L, 1093591L, 1093633L, 1093637L, 1093639L, 1093657L, 1093663L, 1093667L,
-1093679L, 1093681L, 1093699L, 1093717L, 1093723L, 1093733L, 1093739L, 1093747L, 1093751L,
-1093753L, 1093777L, 1093789L, 1093823L, 1093837L, 1093843L, 1093847L, 1093871L, 1093889L,
-1093901L, 1093907L, 1093927L, 1093943L, 1093951L, 1093957L, 1093969L, 1093991L, 1093993L,
-1093997L, 1093999L, 1094011L, 1094029L, 1094047L, 1094057L, 1094059L, 1094081L, 1094089L,
-1094099L, 1094101L, 1094123L, 1094129L, 1094131L, 1094143L, 1094147L, 1094161L, 1094183L,
-1094209L, 1094237L, 1094263L, 1094293L, 1094299L, 1094321L, 1094333L, 1094339L, 1094371L,
-1094377L, 1094407L, 1094411L, 1094417L, 1094437L, 1094441L, 1094449L, 1094453L, 1094461L,
-1094473L, 1094491L, 1094519L, 1094531L, 1094539L, 1094543L, 1094549L, 1094551L, 1094557L,
-1094567L, 1094573L, 1094603L, 1094623L, 1094629L, 1094633L, 1094657L, 1094669L, 1094671L,
-1094683L, 1094689L, 1094693L, 1094701L, 1094711L, 1094747L, 1094759L, 1094773L, 1094791L,
-1094801L, 1094803L, 1094809L, 1094831L, 1094833L, 1094843L, 1094881L, 1094887L, 1094897L,
-1094911L, 1094921L, 1094923L, 1094939L, 1094957L, 1094963L, 1094969L, 1094983L, 1094999L,
-1095023L, 1095043L, 1095047L, 1095049L, 1095067L, 1095071L, 1095091L, 1095119L, 1095161L,
-1095169L, 1095173L, 1095209L, 1095221L, 1095223L, 1095229L, 1095239L, 1095247L, 1095251L,
-1095257L, 1095287L, 1095313L, 1095319L, 1095343L, 1095349L, 1095401L, 1095403L, 1095427L,
-1095433L, 1095439L, 1095443L, 1095449L, 1095461L, 1095481L, 1095487L, 1095491L, 1095503L,
-1095529L, 1095541L, 1095551L, 1095557L, 1095569L, 1095581L, 1095583L, 1095613L, 1095631L,
-1095671L, 1095691L, 1095713L, 1095719L, 1095727L, 1095733L, 1095739L, 1095751L, 1095779L,
-1095781L, 1095791L, 1095793L, 1095811L, 1095821L, 1095833L, 1095839L, 1095841L, 1095847L,
-1095851L, 1095859L, 1095907L, 1095931L, 1095947L, 1095959L, 1095961L, 1095979L, 1095989L,
-1096031L, 1096057L, 1096061L, 1096079L, 1096097L, 1096099L, 1096127L, 1096133L, 1096141L,
-1096159L, 1096163L, 1096189L, 1096201L, 1096219L, 1096267L, 1096289L, 1096307L, 1096327L,
-1096349L, 1096351L, 1096363L, 1096373L, 1096379L, 1096393L, 1096399L, 1096423L, 1096427L,
-1096451L, 1096477L, 1096481L, 1096489L, 1096493L, 1096499L, 1096507L, 1096541L, 1096549L,
-1096553L, 1096559L, 1096561L, 1096583L, 1096609L, 1096621L, 1096631L, 1096639L, 1096673L,
-1096691L, 1096703L, 1096727L, 1096741L, 1096763L, 1096787L, 1096793L, 1096807L, 1096817L,
-1096829L, 1096831L, 1096853L, 1096859L, 1096861L, 1096871L, 1096883L, 1096919L, 1096951L,
-1096957L, 1096967L, 1096969L, 1096981L, 1096999L, 1097009L, 1097017L, 1097029L, 1097039L,
-1097051L, 1097069L, 1097081L, 1097101L, 1097111L, 1097113L, 1097141L, 1097143L, 1097147L,
-1097179L, 1097189L, 1097203L, 1097209L, 1097221L, 1097237L, 1097267L, 1097293L, 1097297L,
-1097321L, 1097323L, 1097351L, 1097359L, 1097377L, 1097381L, 1097413L, 1097419L, 1097423L,
-1097441L, 1097443L, 1097461L, 1097483L, 1097501L, 1097513L, 1097533L, 1097539L, 1097543L,
-1097549L, 1097557L, 1097599L, 1097627L, 1097633L, 1097651L, 1097653L, 1097659L, 1097669L,
-1097699L, 1097711L, 1097717L, 1097729L, 1097743L, 1097783L, 1097791L, 1097797L, 1097819L,
-1097849L, 1097851L, 1097861L, 1097869L, 1097879L, 1097891L, 1097893L, 1097897L, 1097903L,
-1097909L, 1097923L, 1097933L, 1097947L, 1097983L, 1098017L, 1098023L, 1098037L, 1098073L,
-1098077L, 1098101L, 1098109L, 1098121L, 1098133L, 1098151L, 1098187L, 1098191L, 1098193L,
-1098203L, 1098211L, 1098221L, 1098233L, 1098269L, 1098287L, 1098301L, 1098311L, 1098313L,
-1098341L, 1098373L, 1098379L, 1098397L, 1098401L, 1098439L, 1098443L, 1098451L, 1098463L,
-1098469L, 1098479L, 1098481L, 1098509L, 1098511L, 1098533L, 1098541L, 1098593L, 1098613L,
-1098623L, 1098631L, 1098649L, 1098667L, 1098673L, 1098689L, 1098707L, 1098709L, 1098731L,
-1098737L, 1098787L, 1098791L, 1098803L, 1098821L, 1098833L, 1098847L, 1098953L, 1098967L,
-1098973L, 1098989L, 1099031L, 1099051L, 1099057L, 1099079L, 1099081L, 1099097L, 1099103L,
-1099117L, 1099121L, 1099139L, 1099171L, 1099177L, 1099181L, 1099199L, 1099223L, 1099247L,
-1099249L, 1099261L, 1099279L, 1099289L, 1099309L, 1099313L, 1099327L, 1099337L, 1099363L,
-1099369L, 1099391L, 1099393L, 1099409L, 1099411L, 1099421L, 1099433L, 1099459L, 1099463L,
-1099487L, 1099489L, 1099493L, 1099499L, 1099507L, 1099513L, 1099519L, 1099523L, 1099541L,
-1099547L, 1099559L, 1099573L, 1099589L, 1099619L, 1099621L, 1099627L, 1099633L, 1099649L,
-1099669L, 1099687L, 1099711L, 1099717L, 1099723L, 1099727L, 1099729L, 1099741L, 1099757L,
-1099771L, 1099783L, 1099793L, 1099799L, 1099807L, 1099817L, 1099823L, 1099841L, 1099843L,
-1099859L, 1099867L, 1099927L, 1099933L, 1099957L, 1099961L, 1099997L, 1100009L, 1100023L,
-1100027L, 1100039L, 1100041L, 1100051L, 1100063L, 1100089L, 1100093L, 1100101L, 1100123L,
-1100131L, 1100147L, 1100149L, 1100161L, 1100167L, 1100171L, 1100179L, 1100213L, 1100219L,
-1100243L, 1100249L, 1100261L, 1100273L, 1100279L, 1100303L, 1100311L, 1100321L, 1100353L,
-1100357L, 1100377L, 1100381L, 1100387L, 1100419L, 1100441L, 1100443L, 1100447L, 1100467L,
-1100471L, 1100483L, 1100503L, 1100509L, 1100513L, 1100543L, 1100557L, 1100569L, 1100581L,
-1100591L, 1100611L, 1100641L, 1100653L, 1100681L, 1100683L, 1100747L, 1100773L, 1100777L,
-1100783L, 1100797L, 1100807L, 1100831L, 1100833L, 1100837L, 1100839L, 1100851L, 1100857L,
-1100887L, 1100893L, 1100899L, 1100909L, 1100921L, 1100933L, 1100947L, 1100977L, 1101071L,
-1101091L, 1101097L, 1101103L, 1101109L, 1101127L, 1101143L, 1101169L, 1101179L, 1101193L,
-1101211L, 1101229L, 1101253L, 1101283L, 1101299L, 1101307L, 1101319L, 1101323L, 1101341L,
-1101349L, 1101371L, 1101377L, 1101389L, 1101403L, 1101407L, 1101409L, 1101421L, 1101431L,
-1101433L, 1101439L, 1101467L, 1101473L, 1101509L, 1101511L, 1101517L, 1101521L, 1101533L,
-1101559L, 1101571L, 1101577L, 1101587L, 1101593L, 1101613L, 1101619L, 1101641L, 1101649L,
-1101671L, 1101673L, 1101689L, 1101691L, 1101697L, 1101733L, 1101743L, 1101761L, 1101767L,
-1101773L, 1101781L, 1101803L, 1101811L, 1101839L, 1101851L, 1101871L, 1101883L, 1101901L,
-1101917L, 1101929L, 1101931L, 1101937L, 1101941L, 1101959L, 1101967L, 1102001L, 1102007L,
-1102021L, 1102027L, 1102063L, 1102069L, 1102111L, 1102117L, 1102147L, 1102151L, 1102159L,
-1102163L, 1102169L, 1102181L, 1102187L, 1102201L, 1102237L, 1102243L, 1102249L, 1102253L,
-1102259L, 1102271L, 1102279L, 1102301L, 1102307L, 1102313L, 1102333L, 1102337L, 1102393L,
-1102397L, 1102411L, 1102427L, 1102429L, 1102441L, 1102447L, 1102457L, 1102463L, 1102481L,
-1102483L, 1102523L, 1102537L, 1102547L, 1102553L, 1102567L, 1102571L, 1102583L, 1102663L,
-1102669L, 1102679L, 1102681L, 1102691L, 1102693L, 1102709L, 1102721L, 1102727L, 1102729L,
-1102733L, 1102747L, 1102757L, 1102813L, 1102823L, 1102831L, 1102847L, 1102853L, 1102861L,
-1102879L, 1102883L, 1102891L, 1102901L, 1102903L, 1102921L, 1102939L, 1102951L, 1102963L,
-1102967L, 1102979L, 1102991L, 1102999L, 1103009L, 1103017L, 1103029L, 1103041L, 1103059L,
-1103087L, 1103101L, 1103107L, 1103111L, 1103119L, 1103129L, 1103143L, 1103171L, 1103183L,
-1103191L, 1103203L, 1103213L, 1103237L, 1103257L, 1103279L, 1103281L, 1103293L, 1103309L,
-1103339L, 1103341L, 1103353L, 1103371L, 1103437L, 1103449L, 1103461L, 1103467L, 1103483L,
-1103489L, 1103497L, 1103519L, 1103533L, 1103549L, 1103561L, 1103579L, 1103581L, 1103587L,
-1103591L, 1103603L, 1103611L, 1103617L, 1103621L, 1103629L, 1103633L, 1103639L, 1103699L,
-1103723L, 1103737L, 1103749L, 1103779L, 1103797L, 1103803L, 1103849L, 1103857L, 1103863L,
-1103873L, 1103899L, 1103903L, 1103911L, 1103923L, 1103933L, 1103981L, 1103987L, 1103989L,
-1104017L, 1104041L, 1104079L, 1104097L, 1104101L, 1104107L, 1104113L, 1104119L, 1104137L,
-1104139L, 1104157L, 1104179L, 1104193L, 1104203L, 1104209L, 1104217L, 1104221L, 1104241L,
-1104247L, 1104289L, 1104293L, 1104307L, 1104319L, 1104331L, 1104343L, 1104353L, 1104373L,
-1104377L, 1104379L, 1104403L, 1104409L, 1104427L, 1104431L, 1104449L, 1104479L, 1104491L,
-1104511L, 1104517L, 1104533L, 1104557L, 1104559L, 1104589L, 1104599L, 1104613L, 1104619L,
-1104659L, 1104661L, 1104671L, 1104683L, 1104703L, 1104707L, 1104731L, 1104737L, 1104739L,
-1104743L, 1104749L, 1104751L, 1104767L, 1104769L, 1104781L, 1104787L, 1104791L, 1104797L,
-1104811L, 1104821L, 1104823L, 1104833L, 1104853L, 1104877L, 1104889L, 1104899L, 1104913L,
-1104919L, 1104937L, 1104941L, 1104947L, 1104959L, 1105009L, 1105019L, 1105033L, 1105061L,
-1105063L, 1105067L, 1105109L, 1105141L, 1105157L, 1105163L, 1105171L, 1105177L, 1105193L,
-1105201L, 1105207L, 1105213L, 1105217L, 1105231L, 1105261L, 1105267L, 1105271L, 1105309L,
-1105327L, 1105333L, 1105337L, 1105339L, 1105343L, 1105387L, 1105397L, 1105427L, 1105441L,
-1105457L, 1105463L, 1105501L, 1105513L, 1105519L, 1105537L, 1105547L, 1105549L, 1105571L,
-1105579L, 1105583L, 1105589L, 1105603L, 1105607L, 1105609L, 1105613L, 1105619L, 1105627L,
-1105639L, 1105649L, 1105651L, 1105661L, 1105669L, 1105691L, 1105693L, 1105711L, 1105757L,
-1105759L, 1105787L, 1105807L, 1105813L, 1105823L, 1105847L, 1105861L, 1105873L, 1105879L,
-1105883L, 1105891L, 1105913L, 1105919L, 1105943L, 1105961L, 1105963L, 1105997L, 1105999L,
-1106029L, 1106069L, 1106087L, 1106099L, 1106101L, 1106129L, 1106137L, 1106159L, 1106167L,
-1106177L, 1106179L, 1106197L, 1106201L, 1106213L, 1106219L, 1106233L, 1106243L, 1106249L,
-1106257L, 1106267L, 1106279L, 1106293L, 1106311L, 1106317L, 1106363L, 1106381L, 1106401L,
-1106407L, 1106419L, 1106423L, 1106429L, 1106447L, 1106449L, 1106471L, 1106477L, 1106489L,
-1106491L, 1106509L, 1106527L, 1106531L, 1106543L, 1106563L, 1106569L, 1106593L, 1106621L,
-1106627L, 1106629L, 1106653L, 1106671L, 1106687L, 1106689L, 1106741L, 1106747L, 1106761L,
-1106767L, 1106771L, 1106779L, 1106789L, 1106801L, 1106821L, 1106827L, 1106837L, 1106839L,
-1106851L, 1106881L, 1106891L, 1106909L, 1106923L, 1106927L, 1106939L, 1106953L, 1106957L,
-1106977L, 1106993L, 1106999L, 1107019L, 1107031L, 1107047L, 1107049L, 1107053L, 1107083L,
-1107101L, 1107107L, 1107109L, 1107157L, 1107167L, 1107173L, 1107199L, 1107203L, 1107217L,
-1107269L, 1107317L, 1107319L, 1107341L, 1107347L, 1107383L, 1107389L, 1107401L, 1107409L,
-1107419L, 1107433L, 1107439L, 1107467L, 1107479L, 1107487L, 1107497L, 1107503L, 1107511L,
-1107523L, 1107527L, 1107553L, 1107569L, 1107571L, 1107581L, 1107583L, 1107593L, 1107619L,
-1107677L, 1107679L, 1107721L, 1107727L, 1107751L, 1107763L, 1107773L, 1107781L, 1107787L,
-1107791L, 1107793L, 1107797L, 1107803L, 1107811L, 1107823L, 1107851L, 1107853L, 1107881L,
-1107893L, 1107913L, 1107917L, 1107923L, 1107929L, 1107937L, 1107989L, 1108001L, 1108007L,
-1108021L, 1108049L, 1108057L, 1108069L, 1108073L, 1108091L, 1108103L, 1108123L, 1108127L,
-1108147L, 1108169L, 1108171L, 1108181L, 1108201L, 1108207L, 1108223L, 1108229L, 1108241L,
-1108253L, 1108259L, 1108267L, 1108313L, 1108321L, 1108337L, 1108357L, 1108361L, 1108363L,
-1108369L, 1108397L, 1108423L, 1108427L, 1108447L, 1108453L, 1108463L, 1108469L, 1108477L,
-1108487L, 1108489L, 1108501L, 1108507L, 1108537L, 1108543L, 1108559L, 1108561L, 1108567L,
-1108571L, 1108573L, 1108579L, 1108603L, 1108609L, 1108619L, 1108633L, 1108663L, 1108691L,
-1108693L, 1108697L, 1108703L, 1108711L, 1108717L, 1108727L, 1108729L, 1108733L, 1108739L,
-1108747L, 1108753L, 1108759L, 1108771L, 1108781L, 1108801L, 1108817L, 1108819L, 1108823L,
-1108867L, 1108903L, 1108907L, 1108909L, 1108957L, 1108967L, 1108993L, 1108997L, 1108999L,
-1109021L, 1109033L, 1109057L, 1109113L, 1109117L, 1109123L, 1109159L, 1109161L, 1109167L,
-1109189L, 1109197L, 1109219L, 1109231L, 1109243L, 1109249L, 1109257L, 1109281L, 1109287L,
-1109291L, 1109309L, 1109327L, 1109347L, 1109351L, 1109363L, 1109387L, 1109393L, 1109399L,
-1109401L, 1109411L, 1109431L, 1109473L, 1109477L, 1109489L, 1109491L, 1109509L, 1109513L,
-1109531L, 1109533L, 1109561L, 1109579L, 1109609L, 1109611L, 1109629L, 1109639L, 1109653L,
-1109663L, 1109723L, 1109737L, 1109749L, 1109761L, 1109783L, 1109789L, 1109791L, 1109813L,
-1109821L, 1109839L, 1109851L, 1109861L, 1109869L, 1109881L, 1109887L, 1109891L, 1109897L,
-1109903L, 1109909L, 1109921L, 1109951L, 1109987L, 1110007L, 1110013L, 1110019L, 1110023L,
-1110041L, 1110061L, 1110077L, 1110089L, 1110103L, 1110127L, 1110133L, 1110167L, 1110181L,
-1110223L, 1110229L, 1110247L, 1110269L, 1110271L, 1110289L, 1110301L, 1110311L, 1110313L,
-1110331L, 1110349L, 1110353L, 1110367L, 1110397L, 1110401L, 1110413L, 1110427L, 1110433L,
-1110449L, 1110467L, 1110479L, 1110517L, 1110521L, 1110523L, 1110533L, 1110539L, 1110541L,
-1110547L, 1110583L, 1110587L, 1110589L, 1110611L, 1110617L, 1110643L, 1110667L, 1110679L,
-1110709L, 1110713L, 1110719L, 1110727L, 1110743L, 1110773L, 1110779L, 1110803L, 1110817L,
-1110821L, 1110839L, 1110859L, 1110881L, 1110887L, 1110913L, 1110917L, 1110919L, 1110929L,
-1110931L, 1110943L, 1110953L, 1110959L, 1110971L, 1110973L, 1110979L, 1110983L, 1110997L,
-1111007L, 1111013L, 1111021L, 1111031L, 1111043L, 1111049L, 1111057L, 1111067L, 1111081L,
-1111087L, 1111091L, 1111151L, 1111157L, 1111169L, 1111181L, 1111183L, 1111189L, 1111211L,
-1111213L, 1111219L, 1111247L, 1111259L, 1111283L, 1111289L, 1111301L, 1111333L, 1111339L,
-1111351L, 1111361L, 1111379L, 1111393L, 1111399L, 1111423L, 1111427L, 1111433L, 1111447L,
-1111457L, 1111489L, 1111493L, 1111499L, 1111531L, 1111543L, 1111547L, 1111553L, 1111559L,
-1111573L, 1111577L, 1111637L, 1111639L, 1111651L, 1111661L, 1111667L, 1111673L, 1111687L,
-1111703L, 1111711L, 1111723L, 1111727L, 1111741L, 1111757L, 1111771L, 1111787L, 1111793L,
-1111801L, 1111841L, 1111853L, 1111867L, 1111897L, 1111921L, 1111933L, 1111949L, 1111963L,
-1111967L, 1111991L, 1112003L, 1112011L, 1112017L, 1112047L, 1112057L, 1112077L, 1112081L,
-1112087L, 1112093L, 1112107L, 1112113L, 1112129L, 1112131L, 1112141L, 1112143L, 1112147L,
-1112159L, 1112171L, 1112197L, 1112201L, 1112239L, 1112269L, 1112273L, 1112291L, 1112323L,
-1112333L, 1112339L, 1112341L, 1112351L, 1112359L, 1112369L, 1112381L, 1112383L, 1112389L,
-1112413L, 1112467L, 1112471L, 1112477L, 1112483L, 1112509L, 1112513L, 1112519L, 1112543L,
-1112549L, 1112561L, 1112567L, 1112569L, 1112581L, 1112591L, 1112597L, 1112611L, 1112623L,
-1112651L, 1112653L, 1112663L, 1112677L, 1112689L, 1112707L, 1112723L, 1112729L, 1112731L,
-1112737L, 1112747L, 1112777L, 1112779L, 1112789L, 1112821L, 1112827L, 1112831L, 1112833L,
-1112857L, 1112897L, 1112899L, 1112911L, 1112921L, 1112941L, 1112953L, 1112959L, 1112971L,
-1112977L, 1112983L, 1113011L, 1113019L, 1113029L, 1113043L, 1113059L, 1113083L, 1113089L,
-1113103L, 1113137L, 1113149L, 1113157L, 1113173L, 1113181L, 1113187L, 1113193L, 1113197L,
-1113199L, 1113221L, 1113239L, 1113253L, 1113257L, 1113317L, 1113319L, 1113337L, 1113349L,
-1113373L, 1113379L, 1113401L, 1113403L, 1113421L, 1113451L, 1113461L, 1113481L, 1113491L,
-1113509L, 1113521L, 1113527L, 1113557L, 1113569L, 1113587L, 1113599L, 1113617L, 1113643L,
-1113667L, 1113701L, 1113703L, 1113713L, 1113719L, 1113751L, 1113773L, 1113781L, 1113787L,
-1113793L, 1113797L, 1113809L, 1113859L, 1113863L, 1113877L, 1113883L, 1113887L, 1113899L,
-1113941L, 1113949L, 1113953L, 1113961L, 1113971L, 1113991L, 1113997L, 1114019L, 1114031L,
-1114037L, 1114039L, 1114049L, 1114063L, 1114111L, 1114117L, 1114159L, 1114193L, 1114207L,
-1114213L, 1114241L, 1114249L, 1114261L, 1114271L, 1114273L, 1114283L, 1114297L, 1114301L,
-1114303L, 1114349L, 1114361L, 1114381L, 1114397L, 1114423L, 1114427L, 1114447L, 1114471L,
-1114489L, 1114493L, 1114501L, 1114507L, 1114523L, 1114541L, 1114549L, 1114567L, 1114573L,
-1114577L, 1114591L, 1114601L, 1114613L, 1114651L, 1114657L, 1114661L, 1114681L, 1114693L,
-1114697L, 1114709L, 1114721L, 1114723L, 1114733L, 1114753L, 1114759L, 1114801L, 1114807L,
-1114811L, 1114829L, 1114837L, 1114849L, 1114859L, 1114873L, 1114891L, 1114907L, 1114909L,
-1114931L, 1114937L, 1114943L, 1114969L, 1114973L, 1114987L, 1114999L, 1115011L, 1115027L,
-1115029L, 1115057L, 1115071L, 1115089L, 1115099L, 1115113L, 1115117L, 1115131L, 1115189L,
-1115207L, 1115227L, 1115237L, 1115239L, 1115267L, 1115269L, 1115273L, 1115297L, 1115299L,
-1115321L, 1115327L, 1115329L, 1115351L, 1115363L, 1115381L, 1115399L, 1115407L, 1115417L,
-1115419L, 1115447L, 1115449L, 1115453L, 1115467L, 1115497L, 1115501L, 1115519L, 1115531L,
-1115533L, 1115539L, 1115551L, 1115561L, 1115567L, 1115573L, 1115579L, 1115581L, 1115599L,
-1115627L, 1115633L, 1115641L, 1115657L, 1115683L, 1115701L, 1115711L, 1115713L, 1115731L,
-1115743L, 1115759L, 1115767L, 1115771L, 1115773L, 1115789L, 1115831L, 1115839L, 1115843L,
-1115857L, 1115879L, 1115899L, 1115911L, 1115923L, 1115929L, 1115941L, 1115987L, 1115993L,
-1116001L, 1116053L, 1116077L, 1116091L, 1116107L, 1116133L, 1116163L, 1116173L, 1116187L,
-1116209L, 1116223L, 1116229L, 1116257L, 1116277L, 1116281L, 1116289L, 1116301L, 1116317L,
-1116319L, 1116329L, 1116337L, 1116347L, 1116371L, 1116419L, 1116431L, 1116439L, 1116449L,
-1116461L, 1116469L, 1116473L, 1116491L, 1116499L, 1116523L, 1116541L, 1116547L, 1116569L,
-1116571L, 1116593L, 1116601L, 1116631L, 1116637L, 1116641L, 1116653L, 1116659L, 1116677L,
-1116701L, 1116743L, 1116749L, 1116751L, 1116809L, 1116821L, 1116851L, 1116853L, 1116859L,
-1116887L, 1116889L, 1116893L, 1116911L, 1116937L, 1116943L, 1116977L, 1116989L, 1117009L,
-1117013L, 1117021L, 1117027L, 1117031L, 1117033L, 1117057L, 1117069L, 1117073L, 1117079L,
-1117099L, 1117111L, 1117117L, 1117153L, 1117169L, 1117177L, 1117199L, 1117243L, 1117247L,
-1117253L, 1117267L, 1117273L, 1117279L, 1117301L, 1117307L, 1117309L, 1117321L, 1117349L,
-1117367L, 1117379L, 1117433L, 1117439L, 1117451L, 1117463L, 1117471L, 1117477L, 1117481L,
-1117483L, 1117489L, 1117513L, 1117549L, 1117553L, 1117579L, 1117591L, 1117601L, 1117603L,
-1117607L, 1117609L, 1117657L, 1117661L, 1117673L, 1117679L, 1117681L, 1117709L, 1117729L,
-1117741L, 1117757L, 1117759L, 1117763L, 1117769L, 1117793L, 1117799L, 1117811L, 1117813L,
-1117817L, 1117819L, 1117861L, 1117867L, 1117877L, 1117889L, 1117901L, 1117913L, 1117931L,
-1117933L, 1117939L, 1117943L, 1117967L, 1117973L, 1117993L, 1118003L, 1118009L, 1118011L,
-1118021L, 1118023L, 1118027L, 1118041L, 1118063L, 1118081L, 1118101L, 1118113L, 1118123L,
-1118137L, 1118147L, 1118149L, 1118189L, 1118197L, 1118203L, 1118219L, 1118261L, 1118267L,
-1118291L, 1118303L, 1118309L, 1118317L, 1118339L, 1118363L, 1118371L, 1118393L, 1118419L,
-1118437L, 1118441L, 1118479L, 1118483L, 1118497L, 1118519L, 1118527L, 1118563L, 1118567L,
-1118569L, 1118599L, 1118629L, 1118653L, 1118659L, 1118713L, 1118717L, 1118723L, 1118737L,
-1118749L, 1118773L, 1118779L, 1118783L, 1118797L, 1118807L, 1118809L, 1118827L, 1118837L,
-1118851L, 1118857L, 1118861L, 1118863L, 1118867L, 1118869L, 1118893L, 1118911L, 1118921L,
-1118941L, 1118947L, 1118951L, 1118969L, 1118987L, 1118993L, 1119029L, 1119037L, 1119047L,
-1119049L, 1119077L, 1119091L, 1119109L, 1119121L, 1119169L, 1119179L, 1119221L, 1119227L,
-1119241L, 1119269L, 1119281L, 1119299L, 1119319L, 1119323L, 1119343L, 1119359L, 1119389L,
-1119397L, 1119403L, 1119449L, 1119473L, 1119523L, 1119527L, 1119529L, 1119557L, 1119577L,
-1119589L, 1119607L, 1119611L, 1119623L, 1119649L, 1119653L, 1119659L, 1119673L, 1119691L,
-1119697L, 1119707L, 1119733L, 1119737L, 1119779L, 1119793L, 1119799L, 1119809L, 1119817L,
-1119821L, 1119823L, 1119857L, 1119863L, 1119871L, 1119907L, 1119913L, 1119947L, 1119949L,
-1119959L, 1120001L, 1120019L, 1120051L, 1120073L, 1120081L, 1120087L, 1120109L, 1120121L,
-1120153L, 1120157L, 1120159L, 1120187L, 1120211L, 1120219L, 1120237L, 1120271L, 1120277L,
-1120289L, 1120291L, 1120303L, 1120313L, 1120319L, 1120321L, 1120337L, 1120349L, 1120363L,
-1120369L, 1120391L, 1120423L, 1120429L, 1120459L, 1120481L, 1120499L, 1120501L, 1120507L,
-1120513L, 1120517L, 1120519L, 1120529L, 1120541L, 1120543L, 1120547L, 1120549L, 1120573L,
-1120577L, 1120591L, 1120607L, 1120627L, 1120633L, 1120649L, 1120661L, 1120663L, 1120667L,
-1120673L, 1120687L, 1120711L, 1120723L, 1120727L, 1120739L, 1120741L, 1120747L, 1120771L,
-1120781L, 1120783L, 1120787L, 1120799L, 1120807L, 1120811L, 1120831L, 1120837L, 1120849L,
-1120871L, 1120883L, 1120901L, 1120907L, 1120913L, 1120919L, 1120939L, 1120957L, 1120961L,
-1120969L, 1120993L, 1121011L, 1121017L, 1121023L, 1121027L, 1121033L, 1121047L, 1121051L,
-1121083L, 1121093L, 1121101L, 1121143L, 1121147L, 1121173L, 1121179L, 1121189L, 1121191L,
-1121203L, 1121221L, 1121231L, 1121249L, 1121257L, 1121261L, 1121293L, 1121297L, 1121317L,
-1121333L, 1121347L, 1121357L, 1121369L, 1121377L, 1121383L, 1121387L, 1121389L, 1121423L,
-1121431L, 1121443L, 1121447L, 1121453L, 1121509L, 1121539L, 1121543L, 1121557L, 1121599L,
-1121621L, 1121629L, 1121651L, 1121671L, 1121689L, 1121693L, 1121699L, 1121707L, 1121723L,
-1121737L, 1121819L, 1121831L, 1121833L, 1121837L, 1121839L, 1121867L, 1121899L, 1121933L,
-1121941L, 1121947L, 1121987L, 1121993L, 1122001L, 1122029L, 1122041L, 1122053L, 1122071L,
-1122089L, 1122091L, 1122103L, 1122113L, 1122131L, 1122133L, 1122137L, 1122139L, 1122157L,
-1122179L, 1122181L, 1122227L, 1122241L, 1122259L, 1122263L, 1122269L, 1122281L, 1122283L,
-1122287L, 1122367L, 1122371L, 1122389L, 1122397L, 1122419L, 1122427L, 1122431L, 1122437L,
-1122449L, 1122467L, 1122481L, 1122491L, 1122529L, 1122533L, 1122551L, 1122571L, 1122587L,
-1122599L, 1122623L, 1122643L, 1122647L, 1122659L, 1122679L, 1122683L, 1122701L, 1122721L,
-1122739L, 1122749L, 1122757L, 1122761L, 1122811L, 1122841L, 1122857L, 1122887L, 1122899L,
-1122923L, 1122937L, 1122941L, 1122983L, 1122997L, 1123051L, 1123079L, 1123081L, 1123093L,
-1123127L, 1123151L, 1123181L, 1123189L, 1123211L, 1123217L, 1123219L, 1123231L, 1123247L,
-1123267L, 1123279L, 1123303L, 1123307L, 1123319L, 1123327L, 1123349L, 1123351L, 1123361L,
-1123379L, 1123391L, 1123399L, 1123403L, 1123427L, 1123429L, 1123439L, 1123477L, 1123483L,
-1123487L, 1123501L, 1123511L, 1123517L, 1123531L, 1123541L, 1123553L, 1123561L, 1123567L,
-1123589L, 1123597L, 1123601L, 1123621L, 1123631L, 1123637L, 1123651L, 1123667L, 1123669L,
-1123691L, 1123693L, 1123699L, 1123709L, 1123729L, 1123739L, 1123741L, 1123747L, 1123777L,
-1123807L, 1123841L, 1123867L, 1123873L, 1123879L, 1123883L, 1123897L, 1123901L, 1123909L,
-1123919L, 1123931L, 1123943L, 1123951L, 1123961L, 1123973L, 1123979L, 1123999L, 1124027L,
-1124041L, 1124051L, 1124083L, 1124087L, 1124107L, 1124113L, 1124119L, 1124131L, 1124141L,
-1124147L, 1124197L, 1124203L, 1124209L, 1124219L, 1124239L, 1124251L, 1124267L, 1124269L,
-1124293L, 1124297L, 1124303L, 1124317L, 1124351L, 1124353L, 1124369L, 1124377L, 1124423L,
-1124429L, 1124437L, 1124441L, 1124443L, 1124449L, 1124509L, 1124531L, 1124551L, 1124561L,
-1124581L, 1124593L, 1124597L, 1124603L, 1124639L, 1124647L, 1124653L, 1124659L, 1124681L,
-1124687L, 1124699L, 1124719L, 1124741L, 1124749L, 1124759L, 1124789L, 1124797L, 1124803L,
-1124807L, 1124813L, 1124831L, 1124833L, 1124867L, 1124869L, 1124951L, 1124957L, 1124969L,
-1124983L, 1124987L, 1124993L, 1125001L, 1125013L, 1125017L, 1125029L, 1125053L, 1125097L,
-1125109L, 1125121L, 1125127L, 1125139L, 1125143L, 1125151L, 1125167L, 1125169L, 1125193L,
-1125203L, 1125209L, 1125217L, 1125221L, 1125253L, 1125259L, 1125283L, 1125317L, 1125323L,
-1125329L, 1125343L, 1125359L, 1125361L, 1125379L, 1125391L, 1125401L, 1125407L, 1125419L,
-1125431L, 1125433L, 1125469L, 1125473L, 1125479L, 1125499L, 1125529L, 1125539L, 1125557L,
-1125559L, 1125569L, 1125571L, 1125581L, 1125599L, 1125629L, 1125647L, 1125653L, 1125679L,
-1125701L, 1125713L, 1125739L, 1125763L, 1125767L, 1125793L, 1125797L, 1125811L, 1125823L,
-1125833L, 1125857L, 1125871L, 1125899L, 1125907L, 1125911L, 1125913L, 1125923L, 1125931L,
-1125941L, 1125953L, 1125973L, 1125991L, 1126031L, 1126033L, 1126043L, 1126067L, 1126093L,
-1126159L, 1126189L, 1126201L, 1126211L, 1126219L, 1126247L, 1126253L, 1126259L, 1126283L,
-1126313L, 1126319L, 1126343L, 1126351L, 1126357L, 1126361L, 1126381L, 1126387L, 1126397L,
-1126399L, 1126421L, 1126439L, 1126441L, 1126457L, 1126459L, 1126483L, 1126501L, 1126513L,
-1126519L, 1126523L, 1126537L, 1126553L, 1126561L, 1126577L, 1126579L, 1126597L, 1126627L,
-1126649L, 1126661L, 1126663L, 1126667L, 1126669L, 1126693L, 1126703L, 1126711L, 1126751L,
-1126759L, 1126771L, 1126781L, 1126787L, 1126823L, 1126831L, 1126837L, 1126843L, 1126847L,
-1126859L, 1126861L, 1126889L, 1126897L, 1126963L, 1126973L, 1126991L, 1126999L, 1127011L,
-1127029L, 1127033L, 1127039L, 1127051L, 1127081L, 1127101L, 1127111L, 1127123L, 1127149L,
-1127153L, 1127167L, 1127177L, 1127183L, 1127197L, 1127209L, 1127221L, 1127227L, 1127239L,
-1127249L, 1127263L, 1127281L, 1127297L, 1127303L, 1127309L, 1127311L, 1127323L, 1127333L,
-1127351L, 1127359L, 1127369L, 1127381L, 1127383L, 1127393L, 1127407L, 1127411L, 1127443L,
-1127447L, 1127453L, 1127461L, 1127507L, 1127513L, 1127527L, 1127531L, 1127537L, 1127557L,
-1127561L, 1127573L, 1127587L, 1127603L, 1127617L, 1127629L, 1127641L, 1127657L, 1127663L,
-1127683L, 1127701L, 1127741L, 1127767L, 1127773L, 1127801L, 1127803L, 1127809L, 1127813L,
-1127837L, 1127849L, 1127857L, 1127881L, 1127891L, 1127911L, 1127947L, 1127957L, 1127969L,
-1127981L, 1127983L, 1127993L, 1128031L, 1128037L, 1128089L, 1128091L, 1128107L, 1128109L,
-1128143L, 1128151L, 1128161L, 1128181L, 1128209L, 1128223L, 1128227L, 1128233L, 1128247L,
-1128251L, 1128287L, 1128289L, 1128293L, 1128299L, 1128301L, 1128313L, 1128349L, 1128371L,
-1128373L, 1128383L, 1128397L, 1128427L, 1128433L, 1128451L, 1128497L, 1128499L, 1128503L,
-1128509L, 1128521L, 1128527L, 1128539L, 1128553L, 1128557L, 1128577L, 1128583L, 1128599L,
-1128601L, 1128623L, 1128629L, 1128637L, 1128641L, 1128643L, 1128661L, 1128667L, 1128691L,
-1128697L, 1128703L, 1128713L, 1128719L, 1128727L, 1128731L, 1128737L, 1128761L, 1128763L,
-1128769L, 1128773L, 1128779L, 1128781L, 1128811L, 1128821L, 1128823L, 1128889L, 1128899L,
-1128901L, 1128917L, 1128931L, 1128937L, 1128943L, 1128947L, 1128949L, 1128977L, 1128979L,
-1128997L, 1129013L, 1129019L, 1129033L, 1129043L, 1129103L, 1129109L, 1129111L, 1129127L,
-1129133L, 1129153L, 1129159L, 1129169L, 1129187L, 1129211L, 1129213L, 1129217L, 1129229L,
-1129253L, 1129283L, 1129307L, 1129313L, 1129333L, 1129343L, 1129367L, 1129391L, 1129399L,
-1129409L, 1129433L, 1129439L, 1129441L, 1129459L, 1129477L, 1129487L, 1129489L, 1129501L,
-1129511L, 1129519L, 1129523L, 1129559L, 1129561L, 1129571L, 1129577L, 1129603L, 1129619L,
-1129643L, 1129663L, 1129679L, 1129693L, 1129699L, 1129717L, 1129729L, 1129741L, 1129747L,
-1129757L, 1129763L, 1129787L, 1129789L, 1129819L, 1129831L, 1129841L, 1129847L, 1129853L,
-1129859L, 1129861L, 1129889L, 1129897L, 1129951L, 1129957L, 1129963L, 1129991L, 1130011L,
-1130023L, 1130039L, 1130047L, 1130053L, 1130057L, 1130081L, 1130099L, 1130117L, 1130123L,
-1130131L, 1130191L, 1130237L, 1130251L, 1130257L, 1130267L, 1130273L, 1130281L, 1130287L,
-1130293L, 1130299L, 1130317L, 1130321L, 1130351L, 1130359L, 1130369L, 1130407L, 1130413L,
-1130417L, 1130429L, 1130431L, 1130447L, 1130471L, 1130497L, 1130501L, 1130527L, 1130561L,
-1130579L, 1130581L, 1130587L, 1130621L, 1130627L, 1130629L, 1130639L, 1130641L, 1130651L,
-1130677L, 1130693L, 1130699L, 1130711L, 1130719L, 1130737L, 1130741L, 1130777L, 1130783L,
-1130803L, 1130807L, 1130809L, 1130813L, 1130819L, 1130827L, 1130863L, 1130929L, 1130939L,
-1130947L, 1130951L, 1130953L, 1130957L, 1130963L, 1130981L, 1131023L, 1131047L, 1131049L,
-1131077L, 1131079L, 1131083L, 1131103L, 1131113L, 1131121L, 1131131L, 1131133L, 1131139L,
-1131157L, 1131181L, 1131191L, 1131217L, 1131223L, 1131239L, 1131253L, 1131259L, 1131269L,
-1131271L, 1131307L, 1131323L, 1131329L, 1131331L, 1131341L, 1131343L, 1131353L, 1131379L,
-1131397L, 1131413L, 1131419L, 1131421L, 1131437L, 1131451L, 1131463L, 1131467L, 1131479L,
-1131491L, 1131509L, 1131523L, 1131547L, 1131553L, 1131569L, 1131617L, 1131629L, 1131643L,
-1131653L, 1131671L, 1131677L, 1131701L, 1131721L, 1131727L, 1131737L, 1131749L, 1131751L,
-1131763L, 1131769L, 1131787L, 1131799L, 1131821L, 1131827L, 1131829L, 1131839L, 1131857L,
-1131863L, 1131869L, 1131881L, 1131883L, 1131913L, 1131917L, 1131919L, 1131937L, 1131943L,
-1131959L, 1131961L, 1131973L, 1131997L, 1132003L, 1132009L, 1132063L, 1132067L, 1132091L,
-1132123L, 1132139L, 1132141L, 1132177L, 1132199L, 1132223L, 1132249L, 1132259L, 1132291L,
-1132301L, 1132309L, 1132321L, 1132333L, 1132393L, 1132403L, 1132409L, 1132423L, 1132429L,
-1132447L, 1132463L, 1132471L, 1132477L, 1132487L, 1132499L, 1132507L, 1132511L, 1132519L,
-1132529L, 1132541L, 1132561L, 1132567L, 1132583L, 1132597L, 1132601L, 1132603L, 1132627L,
-1132633L, 1132639L, 1132643L, 1132661L, 1132667L, 1132673L, 1132679L, 1132697L, 1132721L,
-1132739L, 1132753L, 1132783L, 1132787L, 1132793L, 1132811L, 1132823L, 1132861L, 1132877L,
-1132883L, 1132909L, 1132919L, 1132927L, 1132933L, 1132949L, 1132969L, 1132979L, 1132987L,
-1132991L, 1132993L, 1132997L, 1133009L, 1133017L, 1133039L, 1133047L, 1133053L, 1133071L,
-1133131L, 1133147L, 1133149L, 1133159L, 1133173L, 1133177L, 1133183L, 1133189L, 1133191L,
-1133219L, 1133227L, 1133239L, 1133257L, 1133261L, 1133263L, 1133287L, 1133303L, 1133317L,
-1133333L, 1133357L, 1133359L, 1133381L, 1133387L, 1133459L, 1133467L, 1133477L, 1133479L,
-1133501L, 1133507L, 1133513L, 1133519L, 1133533L, 1133537L, 1133551L, 1133579L, 1133591L,
-1133621L, 1133623L, 1133633L, 1133641L, 1133651L, 1133653L, 1133659L, 1133677L, 1133681L,
-1133683L, 1133689L, 1133731L, 1133777L, 1133789L, 1133809L, 1133819L, 1133827L, 1133837L,
-1133843L, 1133851L, 1133857L, 1133861L, 1133893L, 1133897L, 1133903L, 1133911L, 1133933L,
-1133947L, 1133959L, 1133963L, 1133971L, 1133989L, 1134031L, 1134037L, 1134043L, 1134047L,
-1134059L, 1134071L, 1134079L, 1134113L, 1134137L, 1134143L, 1134149L, 1134151L, 1134163L,
-1134169L, 1134179L, 1134187L, 1134193L, 1134239L, 1134241L, 1134247L, 1134271L, 1134283L,
-1134299L, 1134311L, 1134313L, 1134389L, 1134391L, 1134403L, 1134421L, 1134437L, 1134443L,
-1134449L, 1134467L, 1134479L, 1134481L, 1134487L, 1134503L, 1134517L, 1134541L, 1134557L,
-1134559L, 1134583L, 1134587L, 1134607L, 1134611L, 1134619L, 1134649L, 1134667L, 1134673L,
-1134691L, 1134697L, 1134703L, 1134709L, 1134719L, 1134769L, 1134781L, 1134787L, 1134811L,
-1134821L, 1134841L, 1134863L, 1134871L, 1134877L, 1134883L, 1134907L, 1134923L, 1134929L,
-1134961L, 1134967L, 1134977L, 1134989L, 1135007L, 1135009L, 1135019L, 1135021L, 1135061L,
-1135063L, 1135081L, 1135087L, 1135091L, 1135093L, 1135103L, 1135111L, 1135129L, 1135133L,
-1135159L, 1135171L, 1135187L, 1135201L, 1135217L, 1135229L, 1135237L, 1135241L, 1135247L,
-1135261L, 1135279L, 1135283L, 1135291L, 1135327L, 1135333L, 1135339L, 1135363L, 1135367L,
-1135403L, 1135411L, 1135427L, 1135429L, 1135439L, 1135451L, 1135469L, 1135483L, 1135513L,
-1135531L, 1135597L, 1135613L, 1135619L, 1135633L, 1135643L, 1135657L, 1135663L, 1135699L,
-1135703L, 1135711L, 1135721L, 1135733L, 1135751L, 1135777L, 1135819L, 1135831L, 1135837L,
-1135847L, 1135853L, 1135859L, 1135861L, 1135873L, 1135879L, 1135891L, 1135903L, 1135913L,
-1135919L, 1135921L, 1135951L, 1135963L, 1135969L, 1135997L, 1135999L, 1136041L, 1136053L,
-1136063L, 1136077L, 1136081L, 1136087L, 1136089L, 1136111L, 1136117L, 1136123L, 1136129L,
-1136147L, 1136153L, 1136183L, 1136203L, 1136221L, 1136227L, 1136231L, 1136237L, 1136287L,
-1136299L, 1136309L, 1136327L, 1136329L, 1136339L, 1136357L, 1136363L, 1136383L, 1136389L,
-1136393L, 1136411L, 1136417L, 1136449L, 1136459L, 1136461L, 1136477L, 1136483L, 1136557L,
-1136567L, 1136579L, 1136587L, 1136593L, 1136609L, 1136617L, 1136623L, 1136627L, 1136633L,
-1136647L, 1136651L, 1136659L, 1136669L, 1136699L, 1136717L, 1136719L, 1136741L, 1136749L,
-1136767L, 1136809L, 1136813L, 1136819L, 1136831L, 1136833L, 1136843L, 1136869L, 1136897L,
-1136917L, 1136921L, 1136939L, 1136951L, 1136969L, 1136981L, 1136983L, 1136999L, 1137001L,
-1137007L, 1137029L, 1137067L, 1137091L, 1137109L, 1137137L, 1137139L, 1137161L, 1137163L,
-1137167L, 1137179L, 1137203L, 1137209L, 1137229L, 1137233L, 1137247L, 1137263L, 1137271L,
-1137289L, 1137313L, 1137329L, 1137337L, 1137341L, 1137403L, 1137407L, 1137427L, 1137439L,
-1137457L, 1137481L, 1137503L, 1137527L, 1137529L, 1137547L, 1137551L, 1137553L, 1137569L,
-1137611L, 1137613L, 1137629L, 1137659L, 1137667L, 1137673L, 1137677L, 1137707L, 1137733L,
-1137743L, 1137749L, 1137767L, 1137781L, 1137803L, 1137809L, 1137811L, 1137817L, 1137859L,
-1137863L, 1137869L, 1137881L, 1137883L, 1137887L, 1137889L, 1137911L, 1137919L, 1137937L,
-1137953L, 1137959L, 1137973L, 1137977L, 1137991L, 1138019L, 1138057L, 1138061L, 1138091L,
-1138097L, 1138117L, 1138127L, 1138141L, 1138147L, 1138171L, 1138183L, 1138213L, 1138237L,
-1138273L, 1138363L, 1138367L, 1138369L, 1138391L, 1138393L, 1138409L, 1138411L, 1138427L,
-1138429L, 1138433L, 1138441L, 1138451L, 1138457L, 1138483L, 1138519L, 1138547L, 1138559L,
-1138567L, 1138589L, 1138591L, 1138637L, 1138639L, 1138649L, 1138667L, 1138673L, 1138679L,
-1138681L, 1138703L, 1138717L, 1138729L, 1138733L, 1138741L, 1138751L, 1138757L, 1138771L,
-1138777L, 1138793L, 1138829L, 1138831L, 1138849L, 1138853L, 1138867L, 1138883L, 1138901L,
-1138919L, 1138957L, 1138961L, 1138967L, 1138979L, 1138987L, 1138997L, 1138999L, 1139003L,
-1139011L, 1139041L, 1139059L, 1139081L, 1139087L, 1139123L, 1139141L, 1139143L, 1139147L,
-1139191L, 1139197L, 1139227L, 1139239L, 1139249L, 1139263L, 1139269L, 1139273L, 1139287L,
-1139291L, 1139293L, 1139309L, 1139321L, 1139329L, 1139353L, 1139387L, 1139393L, 1139407L,
-1139423L, 1139461L, 1139471L, 1139473L, 1139483L, 1139491L, 1139503L, 1139519L, 1139521L,
-1139531L, 1139539L, 1139549L, 1139557L, 1139573L, 1139587L, 1139623L, 1139669L, 1139681L,
-1139683L, 1139687L, 1139713L, 1139717L, 1139741L, 1139771L, 1139773L, 1139779L, 1139807L,
-1139819L, 1139843L, 1139849L, 1139851L, 1139861L, 1139863L, 1139869L, 1139909L, 1139911L,
-1139917L, 1139921L, 1139951L, 1139959L, 1139989L, 1139993L, 1140091L, 1140101L, 1140103L,
-1140121L, 1140127L, 1140131L, 1140137L, 1140143L, 1140157L, 1140163L, 1140197L, 1140203L,
-1140233L, 1140239L, 1140253L, 1140257L, 1140281L, 1140289L, 1140311L, 1140319L, 1140341L,
-1140353L, 1140371L, 1140379L, 1140383L, 1140389L, 1140413L, 1140421L, 1140431L, 1140439L,
-1140449L, 1140463L, 1140487L, 1140493L, 1140533L, 1140539L, 1140563L, 1140569L, 1140571L,
-1140577L, 1140611L, 1140619L, 1140637L, 1140677L, 1140679L, 1140691L, 1140697L, 1140709L,
-1140721L, 1140749L, 1140787L, 1140803L, 1140847L, 1140851L, 1140859L, 1140863L, 1140871L,
-1140901L, 1140911L, 1140913L, 1140929L, 1140949L, 1140959L, 1140967L, 1140973L, 1140983L,
-1140991L, 1141009L, 1141013L, 1141027L, 1141031L, 1141033L, 1141039L, 1141061L, 1141067L,
-1141081L, 1141087L, 1141093L, 1141097L, 1141103L, 1141109L, 1141123L, 1141139L, 1141171L,
-1141219L, 1141223L, 1141229L, 1141241L, 1141243L, 1141253L, 1141267L, 1141271L, 1141277L,
-1141279L, 1141289L, 1141291L, 1141303L, 1141319L, 1141321L, 1141351L, 1141373L, 1141379L,
-1141381L, 1141391L, 1141417L, 1141423L, 1141447L, 1141453L, 1141477L, 1141507L, 1141523L,
-1141529L, 1141531L, 1141541L, 1141571L, 1141573L, 1141597L, 1141631L, 1141633L, 1141649L,
-1141661L, 1141667L, 1141717L, 1141739L, 1141757L, 1141769L, 1141801L, 1141813L, 1141837L,
-1141849L, 1141853L, 1141867L, 1141871L, 1141901L, 1141909L, 1141949L, 1141963L, 1141967L,
-1141969L, 1141999L, 1142003L, 1142017L, 1142021L, 1142039L, 1142041L, 1142059L, 1142069L,
-1142083L, 1142129L, 1142131L, 1142159L, 1142161L, 1142171L, 1142191L, 1142201L, 1142233L,
-1142237L, 1142243L, 1142263L, 1142269L, 1142279L, 1142287L, 1142311L, 1142321L, 1142333L,
-1142353L, 1142357L, 1142359L, 1142363L, 1142389L, 1142423L, 1142431L, 1142473L, 1142483L,
-1142503L, 1142507L, 1142509L, 1142539L, 1142549L, 1142569L, 1142573L, 1142593L, 1142599L,
-1142633L, 1142651L, 1142677L, 1142693L, 1142707L, 1142737L, 1142759L, 1142773L, 1142777L,
-1142783L, 1142789L, 1142809L, 1142821L, 1142833L, 1142837L, 1142851L, 1142863L, 1142881L,
-1142891L, 1142909L, 1142917L, 1142923L, 1142929L, 1142941L, 1142959L, 1142969L, 1142971L,
-1143013L, 1143019L, 1143047L, 1143049L, 1143053L, 1143061L, 1143067L, 1143071L, 1143073L,
-1143089L, 1143091L, 1143101L, 1143113L, 1143143L, 1143161L, 1143167L, 1143193L, 1143217L,
-1143223L, 1143227L, 1143239L, 1143257L, 1143269L, 1143281L, 1143283L, 1143299L, 1143341L,
-1143347L, 1143371L, 1143391L, 1143407L, 1143433L, 1143469L, 1143473L, 1143481L, 1143487L,
-1143529L, 1143551L, 1143563L, 1143577L, 1143587L, 1143589L, 1143601L, 1143619L, 1143643L,
-1143647L, 1143661L, 1143679L, 1143697L, 1143719L, 1143749L, 1143763L, 1143799L, 1143803L,
-1143809L, 1143817L, 1143829L, 1143851L, 1143887L, 1143893L, 1143943L, 1143949L, 1143953L,
-1143959L, 1143977L, 1144001L, 1144007L, 1144019L, 1144037L, 1144061L, 1144081L, 1144103L,
-1144139L, 1144141L, 1144147L, 1144153L, 1144163L, 1144183L, 1144193L, 1144211L, 1144223L,
-1144243L, 1144249L, 1144261L, 1144271L, 1144277L, 1144279L, 1144291L, 1144301L, 1144327L,
-1144333L, 1144343L, 1144349L, 1144357L, 1144379L, 1144393L, 1144399L, 1144417L, 1144439L,
-1144441L, 1144453L, 1144477L, 1144483L, 1144499L, 1144511L, 1144519L, 1144523L, 1144529L,
-1144537L, 1144573L, 1144589L, 1144603L, 1144607L, 1144621L, 1144643L, 1144657L, 1144667L,
-1144681L, 1144691L, 1144721L, 1144723L, 1144727L, 1144739L, 1144757L, 1144783L, 1144823L,
-1144837L, 1144867L, 1144877L, 1144879L, 1144889L, 1144901L, 1144903L, 1144907L, 1144919L,
-1144931L, 1144939L, 1144951L, 1144973L, 1144981L, 1144993L, 1145003L, 1145021L, 1145057L,
-1145059L, 1145077L, 1145093L, 1145099L, 1145107L, 1145129L, 1145141L, 1145143L, 1145173L,
-1145189L, 1145191L, 1145203L, 1145213L, 1145227L, 1145269L, 1145281L, 1145293L, 1145299L,
-1145303L, 1145311L, 1145323L, 1145327L, 1145329L, 1145359L, 1145369L, 1145371L, 1145381L,
-1145387L, 1145393L, 1145411L, 1145429L, 1145461L, 1145479L, 1145497L, 1145509L, 1145533L,
-1145537L, 1145539L, 1145593L, 1145611L, 1145621L, 1145623L, 1145659L, 1145689L, 1145693L,
-1145713L, 1145723L, 1145741L, 1145743L, 1145747L, 1145773L, 1145789L, 1145797L, 1145801L,
-1145803L, 1145831L, 1145843L, 1145849L, 1145873L, 1145897L, 1145899L, 1145971L, 1145983L,
-1145999L, 1146037L, 1146043L, 1146049L, 1146071L, 1146083L, 1146091L, 1146097L, 1146133L,
-1146143L, 1146179L, 1146217L, 1146221L, 1146263L, 1146281L, 1146307L, 1146323L, 1146329L,
-1146331L, 1146347L, 1146367L, 1146391L, 1146407L, 1146413L, 1146419L, 1146421L, 1146461L,
-1146487L, 1146491L, 1146511L, 1146521L, 1146529L, 1146533L, 1146539L, 1146559L, 1146569L,
-1146581L, 1146661L, 1146671L, 1146679L, 1146697L, 1146703L, 1146709L, 1146713L, 1146727L,
-1146731L, 1146763L, 1146773L, 1146779L, 1146781L, 1146787L, 1146791L, 1146793L, 1146797L,
-1146799L, 1146809L, 1146823L, 1146829L, 1146833L, 1146841L, 1146857L, 1146869L, 1146877L,
-1146881L, 1146911L, 1146917L, 1146931L, 1146947L, 1146953L, 1146967L, 1146989L, 1147009L,
-1147021L, 1147039L, 1147043L, 1147051L, 1147067L, 1147073L, 1147099L, 1147103L, 1147117L,
-1147127L, 1147141L, 1147169L, 1147183L, 1147187L, 1147189L, 1147193L, 1147213L, 1147229L,
-1147231L, 1147243L, 1147247L, 1147249L, 1147253L, 1147271L, 1147273L, 1147297L, 1147301L,
-1147331L, 1147339L, 1147351L, 1147379L, 1147387L, 1147409L, 1147417L, 1147423L, 1147427L,
-1147441L, 1147451L, 1147453L, 1147459L, 1147463L, 1147499L, 1147507L, 1147511L, 1147561L,
-1147567L, 1147571L, 1147579L, 1147583L, 1147591L, 1147613L, 1147621L, 1147637L, 1147639L,
-1147669L, 1147697L, 1147709L, 1147711L, 1147717L, 1147739L, 1147759L, 1147793L, 1147819L,
-1147841L, 1147843L, 1147889L, 1147897L, 1147903L, 1147921L, 1147931L, 1147969L, 1147981L,
-1147987L, 1147997L, 1148029L, 1148039L, 1148047L, 1148087L, 1148089L, 1148099L, 1148111L,
-1148167L, 1148171L, 1148177L, 1148219L, 1148249L, 1148261L, 1148263L, 1148291L, 1148293L,
-1148297L, 1148311L, 1148327L, 1148339L, 1148359L, 1148377L, 1148387L, 1148437L, 1148453L,
-1148489L, 1148501L, 1148507L, 1148513L, 1148527L, 1148549L, 1148561L, 1148593L, 1148599L,
-1148621L, 1148629L, 1148647L, 1148663L, 1148677L, 1148681L, 1148687L, 1148701L, 1148713L,
-1148729L, 1148731L, 1148737L, 1148747L, 1148753L, 1148761L, 1148773L, 1148837L, 1148839L,
-1148857L, 1148867L, 1148879L, 1148921L, 1148933L, 1148941L, 1148957L, 1148963L, 1148971L,
-1148977L, 1148981L, 1148989L, 1148999L, 1149007L, 1149017L, 1149037L, 1149053L, 1149059L,
-1149061L, 1149131L, 1149151L, 1149157L, 1149163L, 1149167L, 1149191L, 1149193L, 1149209L,
-1149221L, 1149227L, 1149229L, 1149233L, 1149259L, 1149283L, 1149307L, 1149341L, 1149349L,
-1149361L, 1149373L, 1149403L, 1149409L, 1149413L, 1149427L, 1149457L, 1149469L, 1149487L,
-1149493L, 1149503L, 1149509L, 1149521L, 1149527L, 1149539L, 1149559L, 1149569L, 1149581L,
-1149587L, 1149593L, 1149601L, 1149607L, 1149619L, 1149637L, 1149641L, 1149661L, 1149679L,
-1149689L, 1149737L, 1149749L, 1149769L, 1149773L, 1149779L, 1149803L, 1149817L, 1149857L,
-1149859L, 1149881L, 1149887L, 1149901L, 1149913L, 1149917L, 1149919L, 1149943L, 1149971L,
-1149979L, 1149983L, 1149989L, 1149991L, 1150027L, 1150031L, 1150057L, 1150063L, 1150073L,
-1150081L, 1150103L, 1150117L, 1150139L, 1150141L, 1150151L, 1150159L, 1150183L, 1150187L,
-1150199L, 1150211L, 1150213L, 1150217L, 1150229L, 1150243L, 1150249L, 1150301L, 1150309L,
-1150349L, 1150351L, 1150363L, 1150397L, 1150403L, 1150411L, 1150417L, 1150421L, 1150423L,
-1150447L, 1150489L, 1150511L, 1150519L, 1150531L, 1150537L, 1150547L, 1150561L, 1150579L,
-1150603L, 1150609L, 1150631L, 1150649L, 1150651L, 1150657L, 1150661L, 1150673L, 1150687L,
-1150703L, 1150717L, 1150729L, 1150733L, 1150739L, 1150741L, 1150757L, 1150763L, 1150769L,
-1150777L, 1150783L, 1150823L, 1150837L, 1150847L, 1150861L, 1150867L, 1150871L, 1150873L,
-1150879L, 1150909L, 1150921L, 1150927L, 1150939L, 1150949L, 1150957L, 1150973L, 1150987L,
-1151021L, 1151041L, 1151047L, 1151057L, 1151063L, 1151069L, 1151083L, 1151089L, 1151113L,
-1151141L, 1151147L, 1151159L, 1151167L, 1151177L, 1151179L, 1151203L, 1151209L, 1151221L,
-1151233L, 1151237L, 1151243L, 1151251L, 1151287L, 1151303L, 1151317L, 1151327L, 1151333L,
-1151363L, 1151369L, 1151383L, 1151389L, 1151399L, 1151401L, 1151413L, 1151417L, 1151431L,
-1151441L, 1151443L, 1151471L, 1151473L, 1151483L, 1151519L, 1151537L, 1151569L, 1151581L,
-1151593L, 1151599L, 1151603L, 1151611L, 1151629L, 1151639L, 1151651L, 1151653L, 1151659L,
-1151671L, 1151687L, 1151701L, 1151713L, 1151729L, 1151737L, 1151747L, 1151753L, 1151779L,
-1151807L, 1151861L, 1151873L, 1151879L, 1151881L, 1151911L, 1151933L, 1151963L, 1151981L,
-1151987L, 1151993L, 1151999L, 1152023L, 1152029L, 1152037L, 1152071L, 1152077L, 1152079L,
-1152091L, 1152113L, 1152119L, 1152121L, 1152149L, 1152157L, 1152161L, 1152163L, 1152181L,
-1152187L, 1152227L, 1152233L, 1152287L, 1152313L, 1152317L, 1152337L, 1152343L, 1152367L,
-1152383L, 1152391L, 1152397L, 1152419L, 1152421L, 1152493L, 1152509L, 1152517L, 1152523L,
-1152527L, 1152589L, 1152623L, 1152629L, 1152631L, 1152637L, 1152643L, 1152649L, 1152653L,
-1152667L, 1152677L, 1152707L, 1152733L, 1152751L, 1152757L, 1152761L, 1152763L, 1152773L,
-1152791L, 1152793L, 1152799L, 1152841L, 1152857L, 1152881L, 1152887L, 1152913L, 1152917L,
-1152937L, 1152941L, 1152979L, 1152989L, 1152997L, 1153001L, 1153007L, 1153021L, 1153027L,
-1153049L, 1153057L, 1153063L, 1153073L, 1153099L, 1153109L, 1153123L, 1153147L, 1153153L,
-1153157L, 1153171L, 1153177L, 1153183L, 1153199L, 1153211L, 1153219L, 1153223L, 1153237L,
-1153241L, 1153247L, 1153249L, 1153261L, 1153267L, 1153277L, 1153309L, 1153337L, 1153343L,
-1153349L, 1153367L, 1153393L, 1153421L, 1153429L, 1153441L, 1153457L, 1153459L, 1153463L,
-1153483L, 1153487L, 1153511L, 1153517L, 1153531L, 1153553L, 1153573L, 1153577L, 1153589L,
-1153597L, 1153609L, 1153613L, 1153639L, 1153643L, 1153681L, 1153687L, 1153721L, 1153729L,
-1153751L, 1153753L, 1153759L, 1153769L, 1153777L, 1153799L, 1153811L, 1153849L, 1153853L,
-1153871L, 1153891L, 1153921L, 1153967L, 1153973L, 1154017L, 1154029L, 1154033L, 1154039L,
-1154047L, 1154051L, 1154119L, 1154123L, 1154129L, 1154159L, 1154173L, 1154177L, 1154183L,
-1154207L, 1154221L, 1154227L, 1154233L, 1154239L, 1154243L, 1154267L, 1154291L, 1154297L,
-1154299L, 1154311L, 1154323L, 1154327L, 1154339L, 1154353L, 1154359L, 1154369L, 1154401L,
-1154411L, 1154431L, 1154449L, 1154467L, 1154473L, 1154509L, 1154513L, 1154537L, 1154539L,
-1154551L, 1154561L, 1154563L, 1154567L, 1154579L, 1154581L, 1154603L, 1154633L, 1154639L,
-1154651L, 1154653L, 1154707L, 1154723L, 1154737L, 1154753L, 1154771L, 1154789L, 1154819L,
-1154821L, 1154849L, 1154863L, 1154887L, 1154893L, 1154897L, 1154911L, 1154927L, 1154947L,
-1154969L, 1154971L, 1154987L, 1155001L, 1155017L, 1155019L, 1155053L, 1155061L, 1155071L,
-1155097L, 1155101L, 1155107L, 1155127L, 1155149L, 1155151L, 1155169L, 1155179L, 1155211L,
-1155223L, 1155233L, 1155239L, 1155247L, 1155263L, 1155293L, 1155311L, 1155317L, 1155373L,
-1155377L, 1155379L, 1155403L, 1155419L, 1155431L, 1155437L, 1155449L, 1155457L, 1155461L,
-1155499L, 1155527L, 1155529L, 1155569L, 1155577L, 1155601L, 1155607L, 1155611L, 1155613L,
-1155617L, 1155619L, 1155629L, 1155631L, 1155653L, 1155659L, 1155689L, 1155697L, 1155701L,
-1155703L, 1155709L, 1155733L, 1155821L, 1155823L, 1155829L, 1155841L, 1155851L, 1155859L,
-1155863L, 1155899L, 1155901L, 1155907L, 1155919L, 1155923L, 1155929L, 1155937L, 1155943L,
-1155953L, 1155961L, 1155967L, 1155971L, 1155977L, 1155997L, 1156009L, 1156013L, 1156019L,
-1156031L, 1156033L, 1156037L, 1156039L, 1156073L, 1156079L, 1156087L, 1156097L, 1156109L,
-1156121L, 1156151L, 1156157L, 1156171L, 1156217L, 1156229L, 1156231L, 1156249L, 1156261L,
-1156271L, 1156291L, 1156297L, 1156303L, 1156307L, 1156327L, 1156333L, 1156343L, 1156367L,
-1156369L, 1156387L, 1156403L, 1156423L, 1156427L, 1156429L, 1156451L, 1156453L, 1156457L,
-1156483L, 1156501L, 1156523L, 1156537L, 1156541L, 1156553L, 1156567L, 1156591L, 1156613L,
-1156627L, 1156633L, 1156637L, 1156643L, 1156681L, 1156699L, 1156709L, 1156711L, 1156721L,
-1156741L, 1156747L, 1156751L, 1156769L, 1156783L, 1156801L, 1156807L, 1156819L, 1156823L,
-1156847L, 1156849L, 1156873L, 1156907L, 1156927L, 1156949L, 1156963L, 1156997L, 1157011L,
-1157017L, 1157033L, 1157053L, 1157059L, 1157063L, 1157069L, 1157077L, 1157099L, 1157111L,
-1157131L, 1157159L, 1157171L, 1157179L, 1157183L, 1157201L, 1157203L, 1157209L, 1157213L,
-1157227L, 1157237L, 1157243L, 1157251L, 1157257L, 1157263L, 1157279L, 1157293L, 1157327L,
-1157333L, 1157339L, 1157341L, 1157357L, 1157363L, 1157369L, 1157381L, 1157393L, 1157413L,
-1157437L, 1157449L, 1157489L, 1157491L, 1157503L, 1157531L, 1157539L, 1157557L, 1157579L,
-1157591L, 1157609L, 1157621L, 1157627L, 1157641L, 1157669L, 1157671L, 1157699L, 1157701L,
-1157711L, 1157713L, 1157729L, 1157747L, 1157749L, 1157759L, 1157771L, 1157773L, 1157791L,
-1157831L, 1157833L, 1157837L, 1157839L, 1157851L, 1157869L, 1157873L, 1157899L, 1157929L,
-1157953L, 1157969L, 1157977L, 1157987L, 1158007L, 1158011L, 1158037L, 1158071L, 1158077L,
-1158089L, 1158121L, 1158133L, 1158139L, 1158161L, 1158187L, 1158197L, 1158203L, 1158217L,
-1158247L, 1158251L, 1158263L, 1158271L, 1158293L, 1158301L, 1158307L, 1158317L, 1158323L,
-1158341L, 1158361L, 1158383L, 1158389L, 1158401L, 1158407L, 1158419L, 1158427L, 1158457L,
-1158461L, 1158467L, 1158473L, 1158481L, 1158491L, 1158523L, 1158529L, 1158539L, 1158541L,
-1158551L, 1158569L, 1158587L, 1158593L, 1158607L, 1158611L, 1158613L, 1158617L, 1158629L,
-1158643L, 1158653L, 1158673L, 1158679L, 1158683L, 1158713L, 1158719L, 1158743L, 1158757L,
-1158761L, 1158769L, 1158799L, 1158821L, 1158823L, 1158827L, 1158841L, 1158847L, 1158863L,
-1158881L, 1158887L, 1158923L, 1158953L, 1158961L, 1158977L, 1158991L, 1159001L, 1159007L,
-1159027L, 1159031L, 1159049L, 1159063L, 1159073L, 1159079L, 1159087L, 1159091L, 1159127L,
-1159139L, 1159153L, 1159187L, 1159189L, 1159199L, 1159201L, 1159229L, 1159231L, 1159241L,
-1159243L, 1159259L, 1159271L, 1159283L, 1159303L, 1159337L, 1159339L, 1159381L, 1159393L,
-1159397L, 1159421L, 1159423L, 1159429L, 1159447L, 1159463L, 1159489L, 1159517L, 1159523L,
-1159531L, 1159541L, 1159577L, 1159583L, 1159597L, 1159601L, 1159633L, 1159649L, 1159661L,
-1159663L, 1159709L, 1159721L, 1159777L, 1159787L, 1159789L, 1159811L, 1159813L, 1159843L,
-1159853L, 1159861L, 1159877L, 1159889L, 1159901L, 1159909L, 1159919L, 1159967L, 1159973L,
-1159981L, 1159993L, 1159997L, 1160009L, 1160039L, 1160041L, 1160057L, 1160077L, 1160111L,
-1160129L, 1160141L, 1160147L, 1160161L, 1160167L, 1160179L, 1160207L, 1160213L, 1160219L,
-1160221L, 1160227L, 1160251L, 1160279L, 1160287L, 1160297L, 1160303L, 1160309L, 1160317L,
-1160351L, 1160359L, 1160363L, 1160371L, 1160407L, 1160413L, 1160429L, 1160443L, 1160447L,
-1160449L, 1160459L, 1160473L, 1160479L, 1160491L, 1160503L, 1160513L, 1160519L, 1160543L,
-1160567L, 1160569L, 1160581L, 1160597L, 1160611L, 1160639L, 1160659L, 1160681L, 1160689L,
-1160713L, 1160717L, 1160749L, 1160771L, 1160807L, 1160813L, 1160837L, 1160839L, 1160867L,
-1160893L, 1160903L, 1160911L, 1160927L, 1160941L, 1160953L, 1160977L, 1160983L, 1160987L,
-1160989L, 1161001L, 1161007L, 1161011L, 1161031L, 1161037L, 1161047L, 1161059L, 1161077L,
-1161091L, 1161101L, 1161107L, 1161113L, 1161137L, 1161143L, 1161163L, 1161169L, 1161203L,
-1161217L, 1161227L, 1161233L, 1161239L, 1161241L, 1161263L, 1161269L, 1161289L, 1161313L,
-1161317L, 1161331L, 1161343L, 1161371L, 1161397L, 1161401L, 1161403L, 1161437L, 1161439L,
-1161443L, 1161449L, 1161463L, 1161481L, 1161487L, 1161493L, 1161497L, 1161499L, 1161509L,
-1161521L, 1161529L, 1161547L, 1161551L, 1161553L, 1161581L, 1161599L, 1161617L, 1161619L,
-1161637L, 1161647L, 1161659L, 1161683L, 1161691L, 1161703L, 1161749L, 1161757L, 1161761L,
-1161767L, 1161781L, 1161791L, 1161829L, 1161833L, 1161841L, 1161851L, 1161857L, 1161871L,
-1161877L, 1161883L, 1161893L, 1161929L, 1161931L, 1161947L, 1161949L, 1161991L, 1161997L,
-1162009L, 1162037L, 1162043L, 1162061L, 1162067L, 1162079L, 1162081L, 1162093L, 1162099L,
-1162129L, 1162193L, 1162219L, 1162223L, 1162229L, 1162243L, 1162253L, 1162261L, 1162277L,
-1162279L, 1162297L, 1162303L, 1162321L, 1162339L, 1162361L, 1162367L, 1162373L, 1162417L,
-1162423L, 1162453L, 1162463L, 1162471L, 1162481L, 1162493L, 1162501L, 1162507L, 1162529L,
-1162537L, 1162541L, 1162543L, 1162547L, 1162559L, 1162571L, 1162573L, 1162583L, 1162589L,
-1162597L, 1162619L, 1162621L, 1162631L, 1162649L, 1162663L, 1162669L, 1162687L, 1162691L,
-1162709L, 1162727L, 1162729L, 1162741L, 1162751L, 1162753L, 1162771L, 1162789L, 1162793L,
-1162807L, 1162853L, 1162859L, 1162867L, 1162877L, 1162879L, 1162897L, 1162901L, 1162907L,
-1162927L, 1162937L, 1162943L, 1162951L, 1162957L, 1162961L, 1162969L, 1162981L, 1162991L,
-1163003L, 1163011L, 1163017L, 1163033L, 1163039L, 1163069L, 1163077L, 1163081L, 1163083L,
-1163093L, 1163111L, 1163119L, 1163131L, 1163137L, 1163143L, 1163147L, 1163159L, 1163167L,
-1163177L, 1163189L, 1163207L, 1163221L, 1163231L, 1163233L, 1163251L, 1163257L, 1163263L,
-1163273L, 1163311L, 1163329L, 1163333L, 1163339L, 1163353L, 1163417L, 1163423L, 1163431L,
-1163441L, 1163467L, 1163473L, 1163479L, 1163483L, 1163507L, 1163521L, 1163543L, 1163551L,
-1163557L, 1163581L, 1163587L, 1163609L, 1163611L, 1163627L, 1163629L, 1163641L, 1163651L,
-1163653L, 1163663L, 1163671L, 1163689L, 1163699L, 1163711L, 1163713L, 1163717L, 1163719L,
-1163737L, 1163753L, 1163759L, 1163783L, 1163791L, 1163821L, 1163831L, 1163843L, 1163849L,
-1163873L, 1163879L, 1163891L, 1163923L, 1163947L, 1163969L, 1163971L, 1163977L, 1163989L,
-1163993L, 1164001L, 1164029L, 1164043L, 1164067L, 1164071L, 1164077L, 1164091L, 1164101L,
-1164173L, 1164179L, 1164181L, 1164193L, 1164199L, 1164203L, 1164217L, 1164221L, 1164253L,
-1164287L, 1164323L, 1164343L, 1164367L, 1164409L, 1164413L, 1164419L, 1164431L, 1164433L,
-1164439L, 1164461L, 1164479L, 1164497L, 1164503L, 1164511L, 1164521L, 1164533L, 1164557L,
-1164571L, 1164587L, 1164589L, 1164593L, 1164599L, 1164607L, 1164617L, 1164623L, 1164629L,
-1164641L, 1164659L, 1164671L, 1164689L, 1164731L, 1164749L, 1164791L, 1164799L, 1164803L,
-1164811L, 1164817L, 1164829L, 1164841L, 1164853L, 1164859L, 1164869L, 1164899L, 1164937L,
-1164941L, 1164953L, 1164967L, 1164979L, 1164991L, 1164997L, 1165001L, 1165037L, 1165049L,
-1165051L, 1165057L, 1165069L, 1165079L, 1165081L, 1165103L, 1165121L, 1165127L, 1165139L,
-1165147L, 1165183L, 1165187L, 1165189L, 1165193L, 1165201L, 1165207L, 1165211L, 1165217L,
-1165223L, 1165273L, 1165279L, 1165301L, 1165303L, 1165349L, 1165357L, 1165361L, 1165363L,
-1165379L, 1165397L, 1165399L, 1165421L, 1165447L, 1165453L, 1165471L, 1165511L, 1165529L,
-1165531L, 1165579L, 1165583L, 1165643L, 1165667L, 1165691L, 1165711L, 1165721L, 1165727L,
-1165729L, 1165739L, 1165751L, 1165777L, 1165789L, 1165799L, 1165819L, 1165823L, 1165831L,
-1165837L, 1165849L, 1165861L, 1165873L, 1165889L, 1165903L, 1165909L, 1165919L, 1165921L,
-1165933L, 1165937L, 1165943L, 1165949L, 1165951L, 1165991L, 1165993L, 1166021L, 1166027L,
-1166041L, 1166057L, 1166083L, 1166089L, 1166093L, 1166101L, 1166107L, 1166131L, 1166141L,
-1166147L, 1166153L, 1166213L, 1166219L, 1166227L, 1166237L, 1166287L, 1166311L, 1166323L,
-1166329L, 1166359L, 1166383L, 1166393L, 1166401L, 1166411L, 1166413L, 1166441L, 1166453L,
-1166479L, 1166483L, 1166497L, 1166507L, 1166527L, 1166531L, 1166533L, 1166549L, 1166563L,
-1166567L, 1166569L, 1166579L, 1166597L, 1166603L, 1166609L, 1166617L, 1166639L, 1166663L,
-1166677L, 1166687L, 1166713L, 1166723L, 1166729L, 1166741L, 1166773L, 1166779L, 1166801L,
-1166807L, 1166827L, 1166833L, 1166839L, 1166849L, 1166857L, 1166861L, 1166903L, 1166927L,
-1166929L, 1166947L, 1166953L, 1166969L, 1166987L, 1167011L, 1167013L, 1167053L, 1167059L,
-1167077L, 1167083L, 1167139L, 1167143L, 1167157L, 1167167L, 1167193L, 1167209L, 1167211L,
-1167217L, 1167233L, 1167241L, 1167251L, 1167277L, 1167289L, 1167293L, 1167307L, 1167317L,
-1167329L, 1167347L, 1167349L, 1167359L, 1167391L, 1167409L, 1167421L, 1167443L, 1167449L,
-1167469L, 1167473L, 1167539L, 1167547L, 1167559L, 1167571L, 1167581L, 1167587L, 1167599L,
-1167613L, 1167623L, 1167637L, 1167653L, 1167659L, 1167667L, 1167689L, 1167697L, 1167701L,
-1167703L, 1167707L, 1167709L, 1167731L, 1167763L, 1167773L, 1167791L, 1167799L, 1167811L,
-1167821L, 1167823L, 1167833L, 1167839L, 1167841L, 1167847L, 1167853L, 1167869L, 1167889L,
-1167899L, 1167913L, 1167919L, 1167937L, 1167953L, 1167973L, 1168001L, 1168007L, 1168031L,
-1168039L, 1168043L, 1168093L, 1168133L, 1168151L, 1168169L, 1168183L, 1168187L, 1168231L,
-1168241L, 1168243L, 1168247L, 1168249L, 1168261L, 1168301L, 1168319L, 1168327L, 1168337L,
-1168339L, 1168351L, 1168357L, 1168361L, 1168397L, 1168399L, 1168403L, 1168411L, 1168451L,
-1168463L, 1168477L, 1168487L, 1168493L, 1168501L, 1168523L, 1168537L, 1168553L, 1168619L,
-1168621L, 1168627L, 1168637L, 1168639L, 1168693L, 1168711L, 1168721L, 1168751L, 1168757L,
-1168763L, 1168771L, 1168789L, 1168799L, 1168819L, 1168829L, 1168831L, 1168841L, 1168847L,
-1168859L, 1168877L, 1168879L, 1168897L, 1168919L, 1168927L, 1168931L, 1168933L, 1168957L,
-1168969L, 1168987L, 1168997L, 1169009L, 1169011L, 1169017L, 1169023L, 1169027L, 1169029L,
-1169059L, 1169081L, 1169131L, 1169137L, 1169149L, 1169171L, 1169177L, 1169183L, 1169191L,
-1169249L, 1169257L, 1169261L, 1169269L, 1169281L, 1169293L, 1169323L, 1169327L, 1169341L,
-1169347L, 1169353L, 1169369L, 1169381L, 1169383L, 1169401L, 1169411L, 1169417L, 1169419L,
-1169449L, 1169453L, 1169473L, 1169477L, 1169491L, 1169513L, 1169521L, 1169563L, 1169587L,
-1169591L, 1169593L, 1169603L, 1169627L, 1169633L, 1169647L, 1169669L, 1169677L, 1169683L,
-1169687L, 1169713L, 1169741L, 1169747L, 1169759L, 1169761L, 1169767L, 1169789L, 1169801L,
-1169809L, 1169827L, 1169873L, 1169879L, 1169899L, 1169929L, 1169933L, 1169939L, 1170007L,
-1170011L, 1170019L, 1170023L, 1170031L, 1170049L, 1170061L, 1170067L, 1170089L, 1170107L,
-1170109L, 1170119L, 1170131L, 1170133L, 1170137L, 1170139L, 1170167L, 1170173L, 1170193L,
-1170203L, 1170209L, 1170233L, 1170251L, 1170271L, 1170277L, 1170311L, 1170317L, 1170329L,
-1170349L, 1170361L, 1170373L, 1170397L, 1170437L, 1170443L, 1170451L, 1170461L, 1170487L,
-1170497L, 1170511L, 1170517L, 1170523L, 1170541L, 1170553L, 1170563L, 1170581L, 1170583L,
-1170593L, 1170599L, 1170607L, 1170641L, 1170649L, 1170661L, 1170667L, 1170679L, 1170683L,
-1170707L, 1170709L, 1170713L, 1170721L, 1170727L, 1170751L, 1170779L, 1170781L, 1170787L,
-1170803L, 1170811L, 1170821L, 1170833L, 1170853L, 1170857L, 1170863L, 1170899L, 1170941L,
-1170947L, 1170971L, 1170979L, 1171031L, 1171033L, 1171039L, 1171057L, 1171061L, 1171069L,
-1171073L, 1171109L, 1171111L, 1171117L, 1171123L, 1171133L, 1171189L, 1171199L, 1171201L,
-1171207L, 1171231L, 1171241L, 1171243L, 1171253L, 1171259L, 1171267L, 1171301L, 1171319L,
-1171343L, 1171393L, 1171399L, 1171421L, 1171427L, 1171447L, 1171451L, 1171463L, 1171477L,
-1171517L, 1171523L, 1171529L, 1171549L, 1171553L, 1171561L, 1171579L, 1171591L, 1171601L,
-1171619L, 1171633L, 1171637L, 1171661L, 1171669L, 1171699L, 1171721L, 1171747L, 1171771L,
-1171783L, 1171789L, 1171801L, 1171811L, 1171813L, 1171823L, 1171837L, 1171847L, 1171867L,
-1171921L, 1171927L, 1171931L, 1171957L, 1171967L, 1171969L, 1171979L, 1171981L, 1171991L,
-1171999L, 1172009L, 1172021L, 1172023L, 1172027L, 1172029L, 1172047L, 1172063L, 1172069L,
-1172081L, 1172107L, 1172111L, 1172147L, 1172179L, 1172207L, 1172233L, 1172257L, 1172261L,
-1172273L, 1172279L, 1172317L, 1172329L, 1172351L, 1172377L, 1172393L, 1172401L, 1172407L,
-1172411L, 1172417L, 1172429L, 1172443L, 1172447L, 1172461L, 1172467L, 1172491L, 1172497L,
-1172503L, 1172531L, 1172533L, 1172537L, 1172539L, 1172543L, 1172573L, 1172579L, 1172657L,
-1172659L, 1172663L, 1172671L, 1172681L, 1172683L, 1172687L, 1172713L, 1172749L, 1172777L,
-1172783L, 1172797L, 1172803L, 1172807L, 1172819L, 1172833L, 1172867L, 1172893L, 1172903L,
-1172921L, 1172929L, 1172933L, 1172939L, 1172953L, 1172957L, 1172959L, 1172981L, 1172993L,
-1173001L, 1173013L, 1173043L, 1173059L, 1173101L, 1173121L, 1173127L, 1173157L, 1173163L,
-1173173L, 1173181L, 1173191L, 1173199L, 1173223L, 1173239L, 1173259L, 1173281L, 1173283L,
-1173301L, 1173343L, 1173349L, 1173373L, 1173397L, 1173401L, 1173407L, 1173433L, 1173439L,
-1173463L, 1173481L, 1173511L, 1173521L, 1173539L, 1173541L, 1173551L, 1173553L, 1173581L,
-1173583L, 1173587L, 1173589L, 1173593L, 1173617L, 1173631L, 1173709L, 1173743L, 1173749L,
-1173779L, 1173787L, 1173803L, 1173811L, 1173827L, 1173829L, 1173841L, 1173853L, 1173881L,
-1173883L, 1173917L, 1173937L, 1173941L, 1173947L, 1173959L, 1173961L, 1173979L, 1173983L,
-1174021L, 1174027L, 1174031L, 1174049L, 1174073L, 1174079L, 1174091L, 1174093L, 1174099L,
-1174141L, 1174163L, 1174171L, 1174193L, 1174211L, 1174213L, 1174231L, 1174237L, 1174247L,
-1174259L, 1174267L, 1174273L, 1174301L, 1174307L, 1174319L, 1174331L, 1174337L, 1174339L,
-1174361L, 1174387L, 1174399L, 1174423L, 1174441L, 1174451L, 1174463L, 1174469L, 1174477L,
-1174487L, 1174489L, 1174499L, 1174507L, 1174519L, 1174531L, 1174549L, 1174571L, 1174583L,
-1174601L, 1174603L, 1174619L, 1174627L, 1174669L, 1174673L, 1174681L, 1174687L, 1174709L,
-1174721L, 1174727L, 1174739L, 1174759L, 1174763L, 1174769L, 1174781L, 1174783L, 1174793L,
-1174801L, 1174829L, 1174847L, 1174879L, 1174883L, 1174891L, 1174897L, 1174913L, 1174919L,
-1174949L, 1174951L, 1174969L, 1174973L, 1175003L, 1175021L, 1175029L, 1175039L, 1175071L,
-1175077L, 1175099L, 1175107L, 1175123L, 1175143L, 1175149L, 1175173L, 1175191L, 1175219L,
-1175243L, 1175249L, 1175257L, 1175267L, 1175297L, 1175351L, 1175353L, 1175371L, 1175387L,
-1175389L, 1175407L, 1175411L, 1175413L, 1175417L, 1175437L, 1175467L, 1175479L, 1175483L,
-1175497L, 1175509L, 1175521L, 1175561L, 1175569L, 1175579L, 1175591L, 1175617L, 1175623L,
-1175627L, 1175651L, 1175659L, 1175677L, 1175683L, 1175687L, 1175711L, 1175717L, 1175723L,
-1175729L, 1175743L, 1175767L, 1175789L, 1175791L, 1175803L, 1175807L, 1175813L, 1175819L,
-1175821L, 1175833L, 1175849L, 1175857L, 1175887L, 1175899L, 1175927L, 1175939L, 1175953L,
-1175959L, 1175963L, 1175969L, 1175981L, 1175989L, 1176023L, 1176029L, 1176031L, 1176041L,
-1176061L, 1176083L, 1176089L, 1176113L, 1176121L, 1176127L, 1176137L, 1176163L, 1176173L,
-1176187L, 1176191L, 1176221L, 1176223L, 1176239L, 1176277L, 1176293L, 1176323L, 1176353L,
-1176361L, 1176367L, 1176377L, 1176391L, 1176397L, 1176403L, 1176407L, 1176421L, 1176433L,
-1176449L, 1176463L, 1176509L, 1176521L, 1176529L, 1176533L, 1176557L, 1176583L, 1176589L,
-1176599L, 1176601L, 1176607L, 1176631L, 1176641L, 1176647L, 1176671L, 1176673L, 1176701L,
-1176709L, 1176713L, 1176737L, 1176767L, 1176779L, 1176787L, 1176793L, 1176797L, 1176811L,
-1176827L, 1176869L, 1176871L, 1176881L, 1176899L, 1176911L, 1176937L, 1176943L, 1176947L,
-1176949L, 1176983L, 1177009L, 1177019L, 1177027L, 1177037L, 1177067L, 1177073L, 1177087L,
-1177093L, 1177103L, 1177129L, 1177147L, 1177153L, 1177157L, 1177159L, 1177171L, 1177181L,
-1177201L, 1177207L, 1177219L, 1177223L, 1177237L, 1177243L, 1177247L, 1177277L, 1177291L,
-1177331L, 1177387L, 1177399L, 1177427L, 1177433L, 1177447L, 1177453L, 1177459L, 1177481L,
-1177489L, 1177499L, 1177507L, 1177513L, 1177529L, 1177541L, 1177543L, 1177549L, 1177571L,
-1177609L, 1177613L, 1177619L, 1177621L, 1177637L, 1177651L, 1177667L, 1177681L, 1177697L,
-1177711L, 1177717L, 1177723L, 1177733L, 1177739L, 1177741L, 1177751L, 1177763L, 1177769L,
-1177801L, 1177843L, 1177859L, 1177873L, 1177877L, 1177901L, 1177919L, 1177921L, 1177933L,
-1177949L, 1177987L, 1177997L, 1178003L, 1178017L, 1178033L, 1178039L, 1178041L, 1178059L,
-1178069L, 1178087L, 1178101L, 1178113L, 1178123L, 1178131L, 1178141L, 1178159L, 1178161L,
-1178167L, 1178173L, 1178189L, 1178197L, 1178201L, 1178207L, 1178213L, 1178227L, 1178231L,
-1178237L, 1178239L, 1178263L, 1178269L, 1178273L, 1178297L, 1178347L, 1178363L, 1178369L,
-1178371L, 1178377L, 1178393L, 1178417L, 1178447L, 1178461L, 1178479L, 1178483L, 1178521L,
-1178533L, 1178537L, 1178549L, 1178557L, 1178591L, 1178609L, 1178621L, 1178623L, 1178633L,
-1178641L, 1178659L, 1178669L, 1178689L, 1178699L, 1178701L, 1178707L, 1178711L, 1178717L,
-1178719L, 1178743L, 1178753L, 1178767L, 1178803L, 1178809L, 1178833L, 1178843L, 1178851L,
-1178887L, 1178897L, 1178909L, 1178921L, 1178927L, 1178939L, 1178953L, 1178959L, 1178963L,
-1178971L, 1178977L, 1178981L, 1178993L, 1179011L, 1179019L, 1179047L, 1179109L, 1179127L,
-1179149L, 1179151L, 1179173L, 1179179L, 1179193L, 1179203L, 1179223L, 1179251L, 1179253L,
-1179259L, 1179263L, 1179281L, 1179287L, 1179289L, 1179293L, 1179317L, 1179319L, 1179323L,
-1179329L, 1179331L, 1179337L, 1179379L, 1179383L, 1179389L, 1179403L, 1179413L, 1179419L,
-1179421L, 1179427L, 1179467L, 1179491L, 1179499L, 1179527L, 1179547L, 1179551L, 1179553L,
-1179569L, 1179571L, 1179583L, 1179589L, 1179599L, 1179637L, 1179641L, 1179649L, 1179677L,
-1179733L, 1179751L, 1179757L, 1179779L, 1179793L, 1179797L, 1179839L, 1179847L, 1179853L,
-1179859L, 1179863L, 1179869L, 1179883L, 1179901L, 1179907L, 1179929L, 1179947L, 1179961L,
-1179973L, 1179977L, 1179979L, 1179989L, 1179991L, 1180009L, 1180013L, 1180019L, 1180027L,
-1180031L, 1180043L, 1180057L, 1180073L, 1180087L, 1180093L, 1180099L, 1180111L, 1180117L,
-1180121L, 1180133L, 1180141L, 1180159L, 1180171L, 1180219L, 1180237L, 1180241L, 1180243L,
-1180247L, 1180253L, 1180279L, 1180303L, 1180313L, 1180351L, 1180369L, 1180373L, 1180381L,
-1180391L, 1180397L, 1180409L, 1180423L, 1180427L, 1180447L, 1180477L, 1180493L, 1180507L,
-1180519L, 1180537L, 1180547L, 1180549L, 1180577L, 1180591L, 1180631L, 1180637L, 1180643L,
-1180657L, 1180661L, 1180691L, 1180693L, 1180709L, 1180721L, 1180723L, 1180727L, 1180733L,
-1180757L, 1180771L, 1180799L, 1180807L, 1180811L, 1180819L, 1180847L, 1180849L, 1180853L,
-1180859L, 1180873L, 1180877L, 1180891L, 1180897L, 1180901L, 1180903L, 1180913L, 1180931L,
-1180937L, 1180951L, 1180957L, 1180961L, 1180979L, 1180987L, 1180997L, 1181017L, 1181023L,
-1181039L, 1181051L, 1181053L, 1181057L, 1181093L, 1181099L, 1181137L, 1181149L, 1181153L,
-1181171L, 1181183L, 1181197L, 1181203L, 1181209L, 1181237L, 1181263L, 1181267L, 1181269L,
-1181281L, 1181293L, 1181309L, 1181311L, 1181321L, 1181329L, 1181407L, 1181413L, 1181437L,
-1181443L, 1181461L, 1181471L, 1181473L, 1181501L, 1181507L, 1181519L, 1181527L, 1181549L,
-1181561L, 1181563L, 1181573L, 1181581L, 1181611L, 1181617L, 1181633L, 1181647L, 1181681L,
-1181699L, 1181701L, 1181723L, 1181729L, 1181731L, 1181759L, 1181767L, 1181771L, 1181773L,
-1181777L, 1181839L, 1181879L, 1181881L, 1181893L, 1181897L, 1181911L, 1181923L, 1181927L,
-1181963L, 1181969L, 1181981L, 1181987L, 1182007L, 1182019L, 1182023L, 1182031L, 1182043L,
-1182073L, 1182121L, 1182133L, 1182143L, 1182157L, 1182211L, 1182253L, 1182277L, 1182281L,
-1182283L, 1182287L, 1182289L, 1182331L, 1182341L, 1182343L, 1182347L, 1182353L, 1182383L,
-1182397L, 1182403L, 1182413L, 1182421L, 1182431L, 1182437L, 1182439L, 1182449L, 1182451L,
-1182463L, 1182479L, 1182487L, 1182491L, 1182509L, 1182521L, 1182539L, 1182547L, 1182581L,
-1182593L, 1182611L, 1182659L, 1182677L, 1182679L, 1182689L, 1182691L, 1182697L, 1182703L,
-1182737L, 1182739L, 1182757L, 1182763L, 1182767L, 1182781L, 1182787L, 1182791L, 1182817L,
-1182847L, 1182869L, 1182889L, 1182893L, 1182901L, 1182917L, 1182919L, 1182947L, 1182953L,
-1182967L, 1182989L, 1183003L, 1183027L, 1183031L, 1183033L, 1183057L, 1183079L, 1183093L,
-1183103L, 1183121L, 1183123L, 1183141L, 1183151L, 1183157L, 1183159L, 1183163L, 1183181L,
-1183199L, 1183201L, 1183211L, 1183213L, 1183241L, 1183261L, 1183267L, 1183271L, 1183277L,
-1183279L, 1183333L, 1183337L, 1183349L, 1183381L, 1183393L, 1183397L, 1183409L, 1183411L,
-1183423L, 1183447L, 1183451L, 1183471L, 1183477L, 1183531L, 1183537L, 1183541L, 1183561L,
-1183571L, 1183579L, 1183597L, 1183607L, 1183613L, 1183687L, 1183697L, 1183709L, 1183723L,
-1183729L, 1183733L, 1183739L, 1183753L, 1183759L, 1183769L, 1183771L, 1183781L, 1183799L,
-1183811L, 1183813L, 1183837L, 1183843L, 1183877L, 1183913L, 1183933L, 1183939L, 1183943L,
-1183951L, 1183961L, 1183969L, 1183981L, 1183993L, 1183997L, 1184003L, 1184011L, 1184047L,
-1184059L, 1184069L, 1184077L, 1184081L, 1184083L, 1184093L, 1184119L, 1184123L, 1184129L,
-1184143L, 1184149L, 1184171L, 1184173L, 1184207L, 1184219L, 1184243L, 1184269L, 1184291L,
-1184299L, 1184303L, 1184317L, 1184329L, 1184347L, 1184357L, 1184363L, 1184369L, 1184377L,
-1184399L, 1184411L, 1184413L, 1184423L, 1184429L, 1184453L, 1184459L, 1184461L, 1184471L,
-1184473L, 1184483L, 1184489L, 1184507L, 1184527L, 1184537L, 1184539L, 1184549L, 1184551L,
-1184587L, 1184609L, 1184653L, 1184663L, 1184671L, 1184683L, 1184731L, 1184741L, 1184749L,
-1184759L, 1184767L, 1184791L, 1184797L, 1184837L, 1184839L, 1184867L, 1184881L, 1184893L,
-1184903L, 1184923L, 1184927L, 1184933L, 1184947L, 1184957L, 1184959L, 1184987L, 1184993L,
-1185013L, 1185017L, 1185071L, 1185077L, 1185089L, 1185103L, 1185109L, 1185113L, 1185127L,
-1185131L, 1185179L, 1185181L, 1185241L, 1185281L, 1185287L, 1185299L, 1185307L, 1185313L,
-1185319L, 1185329L, 1185337L, 1185343L, 1185361L, 1185367L, 1185377L, 1185383L, 1185389L,
-1185403L, 1185439L, 1185463L, 1185469L, 1185493L, 1185497L, 1185511L, 1185523L, 1185551L,
-1185559L, 1185577L, 1185589L, 1185601L, 1185617L, 1185623L, 1185637L, 1185643L, 1185647L,
-1185659L, 1185661L, 1185671L, 1185677L, 1185683L, 1185689L, 1185697L, 1185703L, 1185707L,
-1185721L, 1185749L, 1185787L, 1185791L, 1185797L, 1185817L, 1185823L, 1185827L, 1185851L,
-1185859L, 1185871L, 1185883L, 1185889L, 1185893L, 1185907L, 1185929L, 1185931L, 1185953L,
-1185979L, 1185997L, 1186001L, 1186033L, 1186049L, 1186051L, 1186057L, 1186063L, 1186067L,
-1186079L, 1186099L, 1186111L, 1186117L, 1186121L, 1186127L, 1186147L, 1186169L, 1186181L,
-1186217L, 1186231L, 1186249L, 1186259L, 1186291L, 1186321L, 1186337L, 1186349L, 1186351L,
-1186373L, 1186397L, 1186403L, 1186411L, 1186439L, 1186441L, 1186489L, 1186517L, 1186519L,
-1186541L, 1186573L, 1186589L, 1186597L, 1186621L, 1186631L, 1186657L, 1186673L, 1186693L,
-1186697L, 1186699L, 1186739L, 1186741L, 1186751L, 1186769L, 1186789L, 1186807L, 1186811L,
-1186813L, 1186837L, 1186841L, 1186847L, 1186879L, 1186931L, 1186937L, 1186963L, 1186973L,
-1186981L, 1187003L, 1187009L, 1187023L, 1187047L, 1187051L, 1187089L, 1187107L, 1187111L,
-1187117L, 1187141L, 1187159L, 1187167L, 1187189L, 1187201L, 1187227L, 1187233L, 1187239L,
-1187261L, 1187279L, 1187287L, 1187309L, 1187311L, 1187317L, 1187321L, 1187339L, 1187341L,
-1187353L, 1187357L, 1187363L, 1187369L, 1187383L, 1187387L, 1187411L, 1187413L, 1187419L,
-1187429L, 1187453L, 1187471L, 1187479L, 1187489L, 1187507L, 1187509L, 1187539L, 1187551L,
-1187561L, 1187567L, 1187587L, 1187623L, 1187629L, 1187639L, 1187657L, 1187687L, 1187689L,
-1187699L, 1187701L, 1187707L, 1187717L, 1187723L, 1187741L, 1187749L, 1187761L, 1187801L,
-1187803L, 1187819L, 1187821L, 1187833L, 1187839L, 1187863L, 1187867L, 1187873L, 1187887L,
-1187897L, 1187911L, 1187933L, 1187939L, 1187941L, 1187947L, 1187981L, 1187993L, 1187999L,
-1188001L, 1188007L, 1188017L, 1188029L, 1188037L, 1188041L, 1188049L, 1188059L, 1188071L,
-1188073L, 1188149L, 1188151L, 1188167L, 1188169L, 1188179L, 1188197L, 1188223L, 1188227L,
-1188233L, 1188247L, 1188259L, 1188263L, 1188269L, 1188277L, 1188287L, 1188289L, 1188293L,
-1188307L, 1188353L, 1188359L, 1188361L, 1188377L, 1188389L, 1188409L, 1188413L, 1188457L,
-1188491L, 1188511L, 1188527L, 1188529L, 1188553L, 1188557L, 1188559L, 1188581L, 1188587L,
-1188601L, 1188613L, 1188619L, 1188637L, 1188653L, 1188661L, 1188667L, 1188679L, 1188689L,
-1188721L, 1188727L, 1188731L, 1188763L, 1188769L, 1188787L, 1188839L, 1188841L, 1188851L,
-1188857L, 1188899L, 1188917L, 1188931L, 1188937L, 1188947L, 1188973L, 1188977L, 1188991L,
-1189003L, 1189007L, 1189021L, 1189033L, 1189057L, 1189061L, 1189063L, 1189093L, 1189109L,
-1189121L, 1189127L, 1189151L, 1189159L, 1189163L, 1189171L, 1189189L, 1189193L, 1189213L,
-1189219L, 1189231L, 1189271L, 1189277L, 1189301L, 1189313L, 1189327L, 1189333L, 1189339L,
-1189361L, 1189387L, 1189403L, 1189417L, 1189453L, 1189469L, 1189471L, 1189481L, 1189483L,
-1189553L, 1189567L, 1189577L, 1189579L, 1189603L, 1189607L, 1189613L, 1189621L, 1189627L,
-1189631L, 1189633L, 1189637L, 1189649L, 1189651L, 1189673L, 1189703L, 1189709L, 1189717L,
-1189751L, 1189757L, 1189759L, 1189763L, 1189789L, 1189801L, 1189807L, 1189823L, 1189831L,
-1189843L, 1189871L, 1189879L, 1189891L, 1189897L, 1189901L, 1189907L, 1189919L, 1189933L,
-1189967L, 1189999L, 1190011L, 1190023L, 1190029L, 1190041L, 1190047L, 1190069L, 1190071L,
-1190081L, 1190143L, 1190149L, 1190159L, 1190177L, 1190201L, 1190237L, 1190249L, 1190261L,
-1190263L, 1190279L, 1190291L, 1190311L, 1190347L, 1190359L, 1190381L, 1190417L, 1190429L,
-1190447L, 1190467L, 1190473L, 1190477L, 1190489L, 1190491L, 1190507L, 1190509L, 1190513L,
-1190533L, 1190573L, 1190587L, 1190591L, 1190611L, 1190633L, 1190639L, 1190647L, 1190671L,
-1190699L, 1190701L, 1190719L, 1190723L, 1190737L, 1190743L, 1190753L, 1190773L, 1190789L,
-1190807L, 1190809L, 1190821L, 1190831L, 1190837L, 1190851L, 1190873L, 1190897L, 1190899L,
-1190911L, 1190923L, 1190929L, 1190947L, 1190951L, 1190953L, 1190983L, 1191011L, 1191013L,
-1191019L, 1191031L, 1191061L, 1191077L, 1191079L, 1191089L, 1191097L, 1191103L, 1191107L,
-1191109L, 1191119L, 1191131L, 1191149L, 1191163L, 1191187L, 1191191L, 1191199L, 1191209L,
-1191221L, 1191247L, 1191277L, 1191283L, 1191293L, 1191301L, 1191313L, 1191341L, 1191347L,
-1191353L, 1191373L, 1191409L, 1191431L, 1191439L, 1191457L, 1191481L, 1191499L, 1191529L,
-1191539L, 1191551L, 1191559L, 1191563L, 1191571L, 1191577L, 1191601L, 1191611L, 1191613L,
-1191637L, 1191643L, 1191667L, 1191679L, 1191691L, 1191703L, 1191719L, 1191727L, 1191731L,
-1191739L, 1191761L, 1191767L, 1191769L, 1191781L, 1191793L, 1191809L, 1191821L, 1191833L,
-1191847L, 1191899L, 1191923L, 1191937L, 1191941L, 1191947L, 1191973L, 1191979L, 1191991L,
-1192013L, 1192027L, 1192039L, 1192069L, 1192073L, 1192097L, 1192099L, 1192109L, 1192127L,
-1192141L, 1192151L, 1192153L, 1192171L, 1192181L, 1192183L, 1192187L, 1192199L, 1192201L,
-1192207L, 1192211L, 1192241L, 1192253L, 1192259L, 1192267L, 1192271L, 1192327L, 1192337L,
-1192339L, 1192349L, 1192357L, 1192369L, 1192391L, 1192409L, 1192417L, 1192423L, 1192427L,
-1192453L, 1192469L, 1192483L, 1192517L, 1192549L, 1192559L, 1192561L, 1192571L, 1192579L,
-1192589L, 1192603L, 1192651L, 1192673L, 1192679L, 1192699L, 1192717L, 1192721L, 1192753L,
-1192781L, 1192811L, 1192817L, 1192823L, 1192831L, 1192837L, 1192847L, 1192853L, 1192879L,
-1192883L, 1192889L, 1192897L, 1192903L, 1192909L, 1192927L, 1192937L, 1192951L, 1192967L,
-1192969L, 1193011L, 1193021L, 1193041L, 1193047L, 1193057L, 1193081L, 1193107L, 1193119L,
-1193123L, 1193131L, 1193149L, 1193161L, 1193173L, 1193183L, 1193209L, 1193233L, 1193237L,
-1193239L, 1193243L, 1193261L, 1193267L, 1193299L, 1193303L, 1193329L, 1193351L, 1193363L,
-1193369L, 1193399L, 1193429L, 1193431L, 1193443L, 1193459L, 1193473L, 1193483L, 1193497L,
-1193501L, 1193503L, 1193513L, 1193537L, 1193557L, 1193567L, 1193573L, 1193603L, 1193609L,
-1193617L, 1193653L, 1193663L, 1193683L, 1193693L, 1193701L, 1193707L, 1193711L, 1193729L,
-1193737L, 1193741L, 1193743L, 1193761L, 1193767L, 1193771L, 1193783L, 1193821L, 1193833L,
-1193837L, 1193839L, 1193849L, 1193867L, 1193869L, 1193887L, 1193909L, 1193911L, 1193939L,
-1193947L, 1193963L, 1193971L, 1193989L, 1193993L, 1194019L, 1194023L, 1194031L, 1194041L,
-1194047L, 1194059L, 1194103L, 1194157L, 1194161L, 1194163L, 1194203L, 1194209L, 1194211L,
-1194241L, 1194251L, 1194253L, 1194269L, 1194293L, 1194311L, 1194329L, 1194341L, 1194343L,
-1194373L, 1194379L, 1194383L, 1194407L, 1194421L, 1194439L, 1194443L, 1194449L, 1194463L,
-1194493L, 1194517L, 1194521L, 1194541L, 1194547L, 1194553L, 1194581L, 1194593L, 1194601L,
-1194631L, 1194659L, 1194667L, 1194671L, 1194679L, 1194707L, 1194727L, 1194731L, 1194733L,
-1194751L, 1194757L, 1194763L, 1194769L, 1194797L, 1194799L, 1194803L, 1194821L, 1194847L,
-1194857L, 1194877L, 1194883L, 1194889L, 1194899L, 1194901L, 1194917L, 1194923L, 1194959L,
-1194961L, 1194971L, 1194979L, 1194997L, 1195021L, 1195031L, 1195037L, 1195039L, 1195067L,
-1195091L, 1195121L, 1195123L, 1195127L, 1195141L, 1195153L, 1195169L, 1195171L, 1195189L,
-1195193L, 1195217L, 1195223L, 1195231L, 1195237L, 1195247L, 1195277L, 1195291L, 1195361L,
-1195387L, 1195421L, 1195429L, 1195459L, 1195463L, 1195477L, 1195483L, 1195489L, 1195501L,
-1195543L, 1195547L, 1195549L, 1195561L, 1195567L, 1195573L, 1195589L, 1195669L, 1195673L,
-1195679L, 1195681L, 1195693L, 1195703L, 1195709L, 1195721L, 1195723L, 1195741L, 1195751L,
-1195759L, 1195771L, 1195801L, 1195807L, 1195811L, 1195837L, 1195849L, 1195891L, 1195897L,
-1195907L, 1195919L, 1195927L, 1195937L, 1195979L, 1195991L, 1196003L, 1196029L, 1196033L,
-1196059L, 1196077L, 1196087L, 1196089L, 1196119L, 1196123L, 1196141L, 1196177L, 1196191L,
-1196201L, 1196219L, 1196227L, 1196231L, 1196267L, 1196269L, 1196281L, 1196287L, 1196309L,
-1196323L, 1196329L, 1196347L, 1196357L, 1196359L, 1196399L, 1196401L, 1196413L, 1196431L,
-1196471L, 1196473L, 1196491L, 1196501L, 1196509L, 1196513L, 1196519L, 1196521L, 1196537L,
-1196539L, 1196593L, 1196597L, 1196603L, 1196609L, 1196633L, 1196653L, 1196683L, 1196707L,
-1196717L, 1196719L, 1196729L, 1196731L, 1196773L, 1196809L, 1196813L, 1196837L, 1196843L,
-1196857L, 1196861L, 1196863L, 1196869L, 1196873L, 1196891L, 1196911L, 1196927L, 1196939L,
-1196959L, 1196999L, 1197011L, 1197013L, 1197017L, 1197029L, 1197037L, 1197041L, 1197059L,
-1197067L, 1197073L, 1197103L, 1197107L, 1197113L, 1197121L, 1197167L, 1197181L, 1197187L,
-1197193L, 1197197L, 1197199L, 1197211L, 1197221L, 1197239L, 1197257L, 1197263L, 1197269L,
-1197277L, 1197281L, 1197289L, 1197307L, 1197337L, 1197347L, 1197349L, 1197353L, 1197359L,
-1197367L, 1197389L, 1197407L, 1197409L, 1197433L, 1197451L, 1197467L, 1197473L, 1197479L,
-1197509L, 1197527L, 1197571L, 1197577L, 1197601L, 1197617L, 1197619L, 1197631L, 1197649L,
-1197697L, 1197709L, 1197739L, 1197743L, 1197751L, 1197767L, 1197799L, 1197821L, 1197827L,
-1197829L, 1197881L, 1197901L, 1197907L, 1197923L, 1197929L, 1197941L, 1197947L, 1197953L,
-1197971L, 1197997L, 1198013L, 1198033L, 1198037L, 1198049L, 1198051L, 1198063L, 1198069L,
-1198073L, 1198081L, 1198103L, 1198123L, 1198133L, 1198151L, 1198157L, 1198187L, 1198189L,
-1198201L, 1198217L, 1198229L, 1198247L, 1198259L, 1198261L, 1198289L, 1198291L, 1198297L,
-1198303L, 1198321L, 1198343L, 1198361L, 1198363L, 1198397L, 1198399L, 1198403L, 1198411L,
-1198427L, 1198433L, 1198447L, 1198451L, 1198469L, 1198481L, 1198511L, 1198513L, 1198523L,
-1198537L, 1198583L, 1198607L, 1198609L, 1198621L, 1198643L, 1198651L, 1198661L, 1198669L,
-1198679L, 1198699L, 1198727L, 1198751L, 1198793L, 1198811L, 1198819L, 1198849L, 1198853L,
-1198861L, 1198867L, 1198877L, 1198903L, 1198927L, 1198949L, 1198973L, 1198979L, 1198991L,
-1198997L, 1198999L, 1199039L, 1199047L, 1199069L, 1199083L, 1199087L, 1199089L, 1199117L,
-1199123L, 1199131L, 1199137L, 1199167L, 1199183L, 1199189L, 1199203L, 1199257L, 1199309L,
-1199329L, 1199351L, 1199357L, 1199369L, 1199371L, 1199377L, 1199389L, 1199417L, 1199423L,
-1199437L, 1199441L, 1199447L, 1199459L, 1199461L, 1199467L, 1199477L, 1199491L, 1199507L,
-1199509L, 1199521L, 1199551L, 1199557L, 1199573L, 1199587L, 1199591L, 1199593L, 1199617L,
-1199621L, 1199623L, 1199629L, 1199659L, 1199663L, 1199677L, 1199683L, 1199689L, 1199699L,
-1199711L, 1199719L, 1199767L, 1199777L, 1199789L, 1199801L, 1199813L, 1199819L, 1199833L,
-1199839L, 1199851L, 1199857L, 1199879L, 1199893L, 1199899L, 1199909L, 1199923L, 1199929L,
-1199953L, 1199969L, 1199993L, 1199999L, 1200007L, 1200061L, 1200077L, 1200083L, 1200109L,
-1200139L, 1200161L, 1200167L, 1200179L, 1200187L, 1200191L, 1200233L, 1200253L, 1200307L,
-1200313L, 1200323L, 1200341L, 1200349L, 1200359L, 1200361L, 1200371L, 1200373L, 1200377L,
-1200383L, 1200389L, 1200403L, 1200443L, 1200449L, 1200461L, 1200467L, 1200491L, 1200499L,
-1200509L, 1200527L, 1200581L, 1200583L, 1200607L, 1200611L, 1200637L, 1200643L, 1200673L,
-1200679L, 1200691L, 1200697L, 1200701L, 1200739L, 1200751L, 1200779L, 1200799L, 1200809L,
-1200811L, 1200833L, 1200839L, 1200869L, 1200883L, 1200887L, 1200889L, 1200917L, 1200929L,
-1200937L, 1200943L, 1200949L, 1200959L, 1200989L, 1201001L, 1201003L, 1201019L, 1201021L,
-1201027L, 1201043L, 1201049L, 1201061L, 1201073L, 1201087L, 1201097L, 1201103L, 1201111L,
-1201117L, 1201141L, 1201153L, 1201163L, 1201171L, 1201183L, 1201201L, 1201217L, 1201229L,
-1201241L, 1201247L, 1201261L, 1201283L, 1201307L, 1201309L, 1201327L, 1201337L, 1201381L,
-1201439L, 1201469L, 1201481L, 1201483L, 1201489L, 1201493L, 1201513L, 1201523L, 1201531L,
-1201553L, 1201559L, 1201567L, 1201583L, 1201601L, 1201633L, 1201637L, 1201643L, 1201687L,
-1201691L, 1201699L, 1201703L, 1201709L, 1201729L, 1201787L, 1201793L, 1201813L, 1201829L,
-1201841L, 1201843L, 1201853L, 1201873L, 1201909L, 1201919L, 1201939L, 1201961L, 1201969L,
-1201999L, 1202009L, 1202017L, 1202023L, 1202027L, 1202029L, 1202041L, 1202057L, 1202063L,
-1202077L, 1202081L, 1202099L, 1202107L, 1202129L, 1202147L, 1202153L, 1202183L, 1202191L,
-1202219L, 1202221L, 1202231L, 1202239L, 1202251L, 1202261L, 1202269L, 1202293L, 1202303L,
-1202317L, 1202321L, 1202329L, 1202347L, 1202363L, 1202387L, 1202423L, 1202429L, 1202437L,
-1202447L, 1202471L, 1202473L, 1202477L, 1202483L, 1202497L, 1202501L, 1202507L, 1202549L,
-1202561L, 1202569L, 1202603L, 1202609L, 1202627L, 1202629L, 1202633L, 1202689L, 1202741L,
-1202743L, 1202771L, 1202779L, 1202783L, 1202791L, 1202807L, 1202813L, 1202819L, 1202827L,
-1202837L, 1202843L, 1202849L, 1202857L, 1202863L, 1202867L, 1202881L, 1202939L, 1202959L,
-1202963L, 1202977L, 1202987L, 1203019L, 1203067L, 1203077L, 1203101L, 1203121L, 1203127L,
-1203149L, 1203151L, 1203161L, 1203179L, 1203193L, 1203211L, 1203217L, 1203221L, 1203229L,
-1203233L, 1203263L, 1203283L, 1203287L, 1203329L, 1203331L, 1203343L, 1203359L, 1203361L,
-1203421L, 1203437L, 1203443L, 1203457L, 1203463L, 1203467L, 1203487L, 1203493L, 1203509L,
-1203533L, 1203557L, 1203571L, 1203581L, 1203607L, 1203611L, 1203619L, 1203641L, 1203661L,
-1203667L, 1203689L, 1203691L, 1203731L, 1203733L, 1203739L, 1203757L, 1203773L, 1203779L,
-1203791L, 1203793L, 1203799L, 1203809L, 1203817L, 1203827L, 1203841L, 1203863L, 1203887L,
-1203893L, 1203899L, 1203901L, 1203913L, 1203919L, 1203929L, 1203931L, 1203941L, 1203949L,
-1203953L, 1203959L, 1203971L, 1204003L, 1204019L, 1204037L, 1204097L, 1204103L, 1204117L,
-1204139L, 1204141L, 1204153L, 1204169L, 1204171L, 1204183L, 1204207L, 1204219L, 1204243L,
-1204271L, 1204279L, 1204289L, 1204309L, 1204337L, 1204363L, 1204369L, 1204397L, 1204409L,
-1204421L, 1204447L, 1204451L, 1204453L, 1204471L, 1204477L, 1204493L, 1204507L, 1204519L,
-1204529L, 1204561L, 1204583L, 1204597L, 1204607L, 1204613L, 1204633L, 1204649L, 1204669L,
-1204681L, 1204699L, 1204711L, 1204729L, 1204741L, 1204781L, 1204783L, 1204787L, 1204813L,
-1204823L, 1204859L, 1204871L, 1204873L, 1204883L, 1204891L, 1204937L, 1204967L, 1204969L,
-1204981L, 1205027L, 1205047L, 1205081L, 1205089L, 1205093L, 1205101L, 1205117L, 1205119L,
-1205123L, 1205159L, 1205173L, 1205179L, 1205219L, 1205231L, 1205251L, 1205257L, 1205287L,
-1205293L, 1205339L, 1205377L, 1205387L, 1205411L, 1205437L, 1205447L, 1205459L, 1205467L,
-1205471L, 1205473L, 1205489L, 1205513L, 1205527L, 1205537L, 1205539L, 1205549L, 1205557L,
-1205563L, 1205609L, 1205627L, 1205629L, 1205639L, 1205647L, 1205653L, 1205663L, 1205669L,
-1205681L, 1205693L, 1205707L, 1205713L, 1205717L, 1205731L, 1205749L, 1205753L, 1205767L,
-1205773L, 1205779L, 1205819L, 1205843L, 1205891L, 1205899L, 1205903L, 1205921L, 1205947L,
-1205951L, 1205969L, 1205977L, 1205999L, 1206013L, 1206017L, 1206043L, 1206053L, 1206059L,
-1206061L, 1206071L, 1206113L, 1206131L, 1206151L, 1206157L, 1206169L, 1206173L, 1206181L,
-1206187L, 1206199L, 1206209L, 1206223L, 1206229L, 1206259L, 1206263L, 1206277L, 1206307L,
-1206319L, 1206323L, 1206341L, 1206347L, 1206353L, 1206377L, 1206383L, 1206391L, 1206407L,
-1206433L, 1206449L, 1206461L, 1206467L, 1206479L, 1206497L, 1206529L, 1206539L, 1206553L,
-1206563L, 1206577L, 1206581L, 1206587L, 1206619L, 1206637L, 1206679L, 1206683L, 1206691L,
-1206701L, 1206703L, 1206713L, 1206721L, 1206731L, 1206743L, 1206749L, 1206761L, 1206767L,
-1206769L, 1206773L, 1206781L, 1206791L, 1206809L, 1206827L, 1206841L, 1206869L, 1206941L,
-1206973L, 1206979L, 1207001L, 1207027L, 1207033L, 1207039L, 1207043L, 1207079L, 1207093L,
-1207097L, 1207111L, 1207117L, 1207121L, 1207123L, 1207133L, 1207147L, 1207159L, 1207211L,
-1207223L, 1207237L, 1207249L, 1207259L, 1207267L, 1207291L, 1207307L, 1207309L, 1207313L,
-1207319L, 1207331L, 1207343L, 1207351L, 1207363L, 1207379L, 1207387L, 1207403L, 1207417L,
-1207429L, 1207439L, 1207441L, 1207447L, 1207489L, 1207501L, 1207511L, 1207519L, 1207529L,
-1207537L, 1207597L, 1207603L, 1207627L, 1207649L, 1207681L, 1207699L, 1207721L, 1207727L,
-1207751L, 1207757L, 1207769L, 1207841L, 1207883L, 1207903L, 1207909L, 1207919L, 1207933L,
-1207957L, 1207961L, 1207979L, 1207981L, 1208017L, 1208021L, 1208023L, 1208027L, 1208033L,
-1208057L, 1208069L, 1208089L, 1208113L, 1208117L, 1208131L, 1208149L, 1208159L, 1208177L,
-1208189L, 1208209L, 1208219L, 1208237L, 1208239L, 1208243L, 1208269L, 1208279L, 1208297L,
-1208299L, 1208303L, 1208341L, 1208371L, 1208387L, 1208399L, 1208407L, 1208413L, 1208423L,
-1208447L, 1208461L, 1208507L, 1208521L, 1208561L, 1208569L, 1208573L, 1208591L, 1208651L,
-1208657L, 1208663L, 1208677L, 1208681L, 1208689L, 1208707L, 1208731L, 1208741L, 1208777L,
-1208789L, 1208791L, 1208797L, 1208813L, 1208821L, 1208833L, 1208843L, 1208849L, 1208863L,
-1208873L, 1208927L, 1208939L, 1208941L, 1208957L, 1209007L, 1209017L, 1209029L, 1209053L,
-1209073L, 1209079L, 1209083L, 1209107L, 1209113L, 1209121L, 1209139L, 1209151L, 1209163L,
-1209181L, 1209191L, 1209199L, 1209209L, 1209223L, 1209233L, 1209239L, 1209251L, 1209269L,
-1209277L, 1209281L, 1209287L, 1209311L, 1209337L, 1209347L, 1209353L, 1209367L, 1209379L,
-1209427L, 1209437L, 1209457L, 1209463L, 1209469L, 1209487L, 1209491L, 1209517L, 1209539L,
-1209557L, 1209563L, 1209577L, 1209583L, 1209587L, 1209617L, 1209629L, 1209631L, 1209647L,
-1209671L, 1209697L, 1209707L, 1209709L, 1209739L, 1209757L, 1209763L, 1209773L, 1209779L,
-1209781L, 1209809L, 1209811L, 1209821L, 1209841L, 1209853L, 1209877L, 1209883L, 1209889L,
-1209931L, 1209947L, 1209959L, 1209973L, 1209979L, 1210003L, 1210019L, 1210021L, 1210037L,
-1210039L, 1210049L, 1210051L, 1210067L, 1210093L, 1210103L, 1210123L, 1210127L, 1210151L,
-1210163L, 1210169L, 1210177L, 1210193L, 1210207L, 1210211L, 1210229L, 1210241L, 1210259L,
-1210289L, 1210351L, 1210369L, 1210379L, 1210387L, 1210393L, 1210397L, 1210399L, 1210403L,
-1210409L, 1210411L, 1210427L, 1210439L, 1210441L, 1210459L, 1210477L, 1210483L, 1210499L,
-1210523L, 1210541L, 1210549L, 1210597L, 1210609L, 1210613L, 1210631L, 1210637L, 1210639L,
-1210711L, 1210717L, 1210747L, 1210753L, 1210777L, 1210787L, 1210793L, 1210799L, 1210801L,
-1210817L, 1210819L, 1210831L, 1210843L, 1210871L, 1210873L, 1210877L, 1210879L, 1210883L,
-1210897L, 1210903L, 1210921L, 1210933L, 1210939L, 1210949L, 1210967L, 1210987L, 1210999L,
-1211027L, 1211039L, 1211051L, 1211057L, 1211059L, 1211081L, 1211083L, 1211087L, 1211141L,
-1211167L, 1211179L, 1211183L, 1211191L, 1211207L, 1211227L, 1211261L, 1211279L, 1211281L,
-1211303L, 1211311L, 1211333L, 1211339L, 1211381L, 1211389L, 1211393L, 1211407L, 1211411L,
-1211423L, 1211443L, 1211477L, 1211489L, 1211501L, 1211503L, 1211531L, 1211537L, 1211543L,
-1211549L, 1211563L, 1211593L, 1211597L, 1211599L, 1211603L, 1211621L, 1211629L, 1211647L,
-1211653L, 1211657L, 1211659L, 1211669L, 1211677L, 1211689L, 1211701L, 1211719L, 1211723L,
-1211731L, 1211737L, 1211741L, 1211761L, 1211767L, 1211779L, 1211789L, 1211797L, 1211807L,
-1211813L, 1211827L, 1211843L, 1211857L, 1211863L, 1211897L, 1211911L, 1211921L, 1211923L,
-1211933L, 1211983L, 1211999L, 1212011L, 1212017L, 1212023L, 1212047L, 1212053L, 1212061L,
-1212103L, 1212119L, 1212121L, 1212149L, 1212173L, 1212187L, 1212191L, 1212199L, 1212221L,
-1212227L, 1212241L, 1212251L, 1212259L, 1212283L, 1212293L, 1212301L, 1212319L, 1212331L,
-1212347L, 1212361L, 1212373L, 1212397L, 1212401L, 1212427L, 1212433L, 1212437L, 1212439L,
-1212443L, 1212473L, 1212479L, 1212487L, 1212517L, 1212521L, 1212551L, 1212569L, 1212611L,
-1212613L, 1212641L, 1212649L, 1212671L, 1212677L, 1212683L, 1212697L, 1212703L, 1212709L,
-1212719L, 1212737L, 1212769L, 1212773L, 1212781L, 1212787L, 1212793L, 1212811L, 1212817L,
-1212839L, 1212847L, 1212851L, 1212853L, 1212857L, 1212877L, 1212889L, 1212907L, 1212917L,
-1212919L, 1212923L, 1212931L, 1212943L, 1212973L, 1212989L, 1213007L, 1213019L, 1213021L,
-1213027L, 1213033L, 1213049L, 1213057L, 1213063L, 1213081L, 1213087L, 1213097L, 1213109L,
-1213129L, 1213133L, 1213141L, 1213151L, 1213153L, 1213183L, 1213189L, 1213213L, 1213241L,
-1213253L, 1213259L, 1213271L, 1213301L, 1213327L, 1213339L, 1213357L, 1213367L, 1213379L,
-1213427L, 1213439L, 1213451L, 1213469L, 1213481L, 1213483L, 1213517L, 1213529L, 1213547L,
-1213561L, 1213573L, 1213577L, 1213591L, 1213601L, 1213607L, 1213627L, 1213631L, 1213633L,
-1213643L, 1213651L, 1213657L, 1213661L, 1213673L, 1213721L, 1213741L, 1213747L, 1213757L,
-1213759L, 1213763L, 1213781L, 1213801L, 1213829L, 1213837L, 1213841L, 1213873L, 1213879L,
-1213897L, 1213907L, 1213909L, 1213913L, 1213921L, 1213931L, 1213939L, 1213943L, 1213951L,
-1213981L, 1214011L, 1214023L, 1214039L, 1214047L, 1214077L, 1214093L, 1214113L, 1214117L,
-1214131L, 1214137L, 1214141L, 1214159L, 1214167L, 1214183L, 1214189L, 1214197L, 1214219L,
-1214221L, 1214237L, 1214261L, 1214273L, 1214281L, 1214299L, 1214333L, 1214357L, 1214371L,
-1214393L, 1214401L, 1214407L, 1214413L, 1214417L, 1214431L, 1214441L, 1214453L, 1214459L,
-1214471L, 1214483L, 1214489L, 1214519L, 1214533L, 1214567L, 1214573L, 1214579L, 1214593L,
-1214617L, 1214623L, 1214639L, 1214641L, 1214657L, 1214659L, 1214663L, 1214669L, 1214671L,
-1214683L, 1214687L, 1214711L, 1214729L, 1214737L, 1214743L, 1214749L, 1214767L, 1214819L,
-1214827L, 1214849L, 1214867L, 1214891L, 1214909L, 1214923L, 1214933L, 1214947L, 1214957L,
-1214959L, 1214963L, 1214971L, 1214977L, 1214981L, 1215017L, 1215029L, 1215047L, 1215079L,
-1215083L, 1215103L, 1215121L, 1215133L, 1215157L, 1215161L, 1215167L, 1215173L, 1215197L,
-1215209L, 1215229L, 1215239L, 1215271L, 1215283L, 1215299L, 1215301L, 1215311L, 1215329L,
-1215349L, 1215359L, 1215367L, 1215391L, 1215397L, 1215407L, 1215421L, 1215433L, 1215437L,
-1215439L, 1215451L, 1215457L, 1215463L, 1215497L, 1215499L, 1215509L, 1215521L, 1215553L,
-1215569L, 1215583L, 1215587L, 1215623L, 1215629L, 1215631L, 1215637L, 1215647L, 1215649L,
-1215673L, 1215679L, 1215703L, 1215719L, 1215743L, 1215769L, 1215779L, 1215787L, 1215827L,
-1215839L, 1215847L, 1215853L, 1215859L, 1215881L, 1215899L, 1215917L, 1215919L, 1215923L,
-1216009L, 1216013L, 1216021L, 1216043L, 1216067L, 1216069L, 1216087L, 1216091L, 1216109L,
-1216123L, 1216147L, 1216151L, 1216177L, 1216213L, 1216249L, 1216273L, 1216277L, 1216337L,
-1216339L, 1216349L, 1216351L, 1216373L, 1216379L, 1216387L, 1216393L, 1216417L, 1216421L,
-1216433L, 1216441L, 1216451L, 1216459L, 1216489L, 1216507L, 1216529L, 1216543L, 1216547L,
-1216559L, 1216561L, 1216577L, 1216583L, 1216591L, 1216601L, 1216603L, 1216619L, 1216681L,
-1216693L, 1216711L, 1216717L, 1216729L, 1216751L, 1216759L, 1216763L, 1216777L, 1216793L,
-1216799L, 1216807L, 1216823L, 1216841L, 1216847L, 1216849L, 1216867L, 1216871L, 1216879L,
-1216903L, 1216913L, 1216937L, 1216939L, 1216951L, 1216961L, 1216973L, 1216987L, 1216997L,
-1217009L, 1217017L, 1217023L, 1217033L, 1217053L, 1217057L, 1217063L, 1217071L, 1217077L,
-1217089L, 1217093L, 1217107L, 1217113L, 1217119L, 1217131L, 1217141L, 1217143L, 1217147L,
-1217171L, 1217179L, 1217191L, 1217207L, 1217213L, 1217219L, 1217233L, 1217261L, 1217269L,
-1217297L, 1217299L, 1217303L, 1217309L, 1217317L, 1217329L, 1217351L, 1217393L, 1217399L,
-1217407L, 1217417L, 1217423L, 1217443L, 1217467L, 1217471L, 1217473L, 1217477L, 1217483L,
-1217509L, 1217521L, 1217533L, 1217537L, 1217561L, 1217617L, 1217647L, 1217651L, 1217663L,
-1217669L, 1217677L, 1217683L, 1217687L, 1217719L, 1217731L, 1217753L, 1217759L, 1217771L,
-1217809L, 1217813L, 1217831L, 1217833L, 1217861L, 1217893L, 1217899L, 1217903L, 1217917L,
-1217921L, 1217927L, 1217933L, 1217941L, 1217947L, 1217963L, 1217977L, 1217989L, 1218017L,
-1218043L, 1218089L, 1218121L, 1218131L, 1218157L, 1218167L, 1218179L, 1218197L, 1218199L,
-1218209L, 1218211L, 1218221L, 1218247L, 1218251L, 1218257L, 1218263L, 1218277L, 1218281L,
-1218307L, 1218313L, 1218367L, 1218383L, 1218391L, 1218401L, 1218421L, 1218433L, 1218449L,
-1218457L, 1218463L, 1218467L, 1218473L, 1218487L, 1218533L, 1218557L, 1218559L, 1218571L,
-1218583L, 1218601L, 1218617L, 1218631L, 1218649L, 1218653L, 1218683L, 1218691L, 1218709L,
-1218727L, 1218731L, 1218739L, 1218761L, 1218773L, 1218779L, 1218787L, 1218821L, 1218829L,
-1218853L, 1218859L, 1218901L, 1218911L, 1218913L, 1218923L, 1218941L, 1218949L, 1218953L,
-1218989L, 1218991L, 1219003L, 1219061L, 1219081L, 1219091L, 1219109L, 1219111L, 1219123L,
-1219129L, 1219147L, 1219177L, 1219213L, 1219237L, 1219241L, 1219271L, 1219279L, 1219297L,
-1219301L, 1219303L, 1219307L, 1219313L, 1219343L, 1219349L, 1219357L, 1219399L, 1219411L,
-1219433L, 1219453L, 1219457L, 1219469L, 1219481L, 1219487L, 1219489L, 1219501L, 1219507L,
-1219549L, 1219577L, 1219607L, 1219613L, 1219619L, 1219639L, 1219643L, 1219649L, 1219651L,
-1219657L, 1219663L, 1219679L, 1219703L, 1219717L, 1219721L, 1219727L, 1219739L, 1219747L,
-1219753L, 1219763L, 1219783L, 1219787L, 1219789L, 1219793L, 1219807L, 1219811L, 1219831L,
-1219837L, 1219843L, 1219847L, 1219849L, 1219859L, 1219861L, 1219871L, 1219877L, 1219879L,
-1219891L, 1219909L, 1219913L, 1219919L, 1219931L, 1219949L, 1219951L, 1219957L, 1219961L,
-1219963L, 1219991L, 1220027L, 1220029L, 1220041L, 1220071L, 1220077L, 1220099L, 1220147L,
-1220171L, 1220203L, 1220239L, 1220249L, 1220251L, 1220257L, 1220309L, 1220327L, 1220333L,
-1220347L, 1220353L, 1220363L, 1220369L, 1220393L, 1220411L, 1220423L, 1220437L, 1220489L,
-1220491L, 1220497L, 1220507L, 1220591L, 1220599L, 1220623L, 1220657L, 1220663L, 1220669L,
-1220689L, 1220699L, 1220711L, 1220717L, 1220729L, 1220743L, 1220761L, 1220773L, 1220777L,
-1220783L, 1220797L, 1220801L, 1220803L, 1220819L, 1220833L, 1220839L, 1220893L, 1220897L,
-1220903L, 1220917L, 1220927L, 1220953L, 1220969L, 1220981L, 1220983L, 1220993L, 1221019L,
-1221029L, 1221049L, 1221061L, 1221079L, 1221083L, 1221089L, 1221097L, 1221113L, 1221119L,
-1221131L, 1221163L, 1221167L, 1221193L, 1221197L, 1221221L, 1221223L, 1221239L, 1221247L,
-1221251L, 1221289L, 1221299L, 1221373L, 1221379L, 1221383L, 1221391L, 1221421L, 1221427L,
-1221443L, 1221449L, 1221457L, 1221463L, 1221469L, 1221499L, 1221503L, 1221523L, 1221527L,
-1221533L, 1221541L, 1221551L, 1221557L, 1221559L, 1221589L, 1221593L, 1221601L, 1221631L,
-1221641L, 1221653L, 1221659L, 1221667L, 1221707L, 1221749L, 1221751L, 1221761L, 1221767L,
-1221791L, 1221793L, 1221811L, 1221821L, 1221823L, 1221853L, 1221863L, 1221907L, 1221917L,
-1221937L, 1221959L, 1221971L, 1222003L, 1222019L, 1222027L, 1222037L, 1222049L, 1222057L,
-1222063L, 1222097L, 1222129L, 1222157L, 1222159L, 1222171L, 1222187L, 1222219L, 1222229L,
-1222231L, 1222241L, 1222253L, 1222259L, 1222267L, 1222271L, 1222279L, 1222307L, 1222373L,
-1222393L, 1222409L, 1222411L, 1222433L, 1222471L, 1222483L, 1222493L, 1222499L, 1222513L,
-1222523L, 1222537L, 1222561L, 1222567L, 1222583L, 1222597L, 1222601L, 1222603L, 1222633L,
-1222643L, 1222651L, 1222667L, 1222679L, 1222681L, 1222693L, 1222717L, 1222723L, 1222729L,
-1222751L, 1222757L, 1222769L, 1222777L, 1222789L, 1222801L, 1222811L, 1222829L, 1222831L,
-1222847L, 1222853L, 1222889L, 1222909L, 1222913L, 1222931L, 1222943L, 1222957L, 1222967L,
-1222993L, 1223003L, 1223021L, 1223029L, 1223039L, 1223051L, 1223059L, 1223077L, 1223083L,
-1223093L, 1223119L, 1223149L, 1223161L, 1223177L, 1223179L, 1223197L, 1223203L, 1223207L,
-1223231L, 1223237L, 1223263L, 1223279L, 1223281L, 1223309L, 1223311L, 1223323L, 1223329L,
-1223351L, 1223357L, 1223381L, 1223419L, 1223437L, 1223447L, 1223449L, 1223459L, 1223471L,
-1223489L, 1223491L, 1223527L, 1223533L, 1223549L, 1223561L, 1223569L, 1223587L, 1223591L,
-1223603L, 1223633L, 1223683L, 1223687L, 1223689L, 1223693L, 1223723L, 1223731L, 1223749L,
-1223753L, 1223767L, 1223773L, 1223777L, 1223857L, 1223863L, 1223867L, 1223879L, 1223897L,
-1223921L, 1223939L, 1223941L, 1223953L, 1223977L, 1223987L, 1223993L, 1224029L, 1224031L,
-1224053L, 1224059L, 1224077L, 1224079L, 1224089L, 1224109L, 1224121L, 1224131L, 1224133L,
-1224149L, 1224163L, 1224169L, 1224193L, 1224203L, 1224217L, 1224229L, 1224233L, 1224239L,
-1224257L, 1224259L, 1224269L, 1224271L, 1224281L, 1224287L, 1224299L, 1224329L, 1224337L,
-1224347L, 1224389L, 1224403L, 1224413L, 1224437L, 1224439L, 1224473L, 1224479L, 1224481L,
-1224529L, 1224533L, 1224577L, 1224599L, 1224637L, 1224673L, 1224677L, 1224701L, 1224703L,
-1224709L, 1224739L, 1224763L, 1224767L, 1224809L, 1224823L, 1224851L, 1224857L, 1224859L,
-1224863L, 1224869L, 1224887L, 1224889L, 1224893L, 1224913L, 1224919L, 1224943L, 1224953L,
-1224967L, 1224973L, 1224983L, 1224991L, 1225009L, 1225019L, 1225061L, 1225067L, 1225073L,
-1225079L, 1225087L, 1225093L, 1225097L, 1225099L, 1225109L, 1225111L, 1225117L, 1225123L,
-1225127L, 1225129L, 1225153L, 1225157L, 1225183L, 1225219L, 1225223L, 1225261L, 1225283L,
-1225297L, 1225303L, 1225319L, 1225327L, 1225331L, 1225361L, 1225373L, 1225381L, 1225397L,
-1225409L, 1225459L, 1225493L, 1225501L, 1225507L, 1225517L, 1225529L, 1225541L, 1225559L,
-1225571L, 1225577L, 1225579L, 1225589L, 1225591L, 1225603L, 1225621L, 1225643L, 1225657L,
-1225663L, 1225687L, 1225691L, 1225703L, 1225723L, 1225727L, 1225729L, 1225759L, 1225769L,
-1225787L, 1225817L, 1225849L, 1225871L, 1225879L, 1225883L, 1225891L, 1225897L, 1225907L,
-1225909L, 1225919L, 1225927L, 1225933L, 1225949L, 1225963L, 1225981L, 1225997L, 1225999L,
-1226011L, 1226041L, 1226053L, 1226063L, 1226077L, 1226083L, 1226087L, 1226101L, 1226111L,
-1226117L, 1226179L, 1226189L, 1226191L, 1226209L, 1226213L, 1226237L, 1226257L, 1226263L,
-1226293L, 1226297L, 1226299L, 1226311L, 1226321L, 1226339L, 1226341L, 1226347L, 1226353L,
-1226377L, 1226387L, 1226417L, 1226461L, 1226471L, 1226479L, 1226483L, 1226501L, 1226503L,
-1226531L, 1226539L, 1226549L, 1226557L, 1226581L, 1226593L, 1226609L, 1226611L, 1226623L,
-1226629L, 1226651L, 1226663L, 1226677L, 1226681L, 1226683L, 1226699L, 1226707L, 1226711L,
-1226713L, 1226741L, 1226767L, 1226779L, 1226783L, 1226789L, 1226801L, 1226803L, 1226807L,
-1226821L, 1226831L, 1226851L, 1226857L, 1226861L, 1226867L, 1226891L, 1226899L, 1226959L,
-1226977L, 1226983L, 1226993L, 1227047L, 1227053L, 1227101L, 1227103L, 1227131L, 1227133L,
-1227143L, 1227151L, 1227157L, 1227167L, 1227173L, 1227181L, 1227241L, 1227271L, 1227277L,
-1227299L, 1227301L, 1227319L, 1227323L, 1227329L, 1227337L, 1227353L, 1227379L, 1227407L,
-1227431L, 1227437L, 1227463L, 1227469L, 1227491L, 1227497L, 1227539L, 1227547L, 1227559L,
-1227563L, 1227619L, 1227637L, 1227649L, 1227659L, 1227683L, 1227701L, 1227703L, 1227713L,
-1227719L, 1227769L, 1227797L, 1227829L, 1227833L, 1227841L, 1227847L, 1227871L, 1227881L,
-1227887L, 1227911L, 1227917L, 1227929L, 1227943L, 1227949L, 1227973L, 1227977L, 1227979L,
-1227983L, 1228001L, 1228009L, 1228013L, 1228021L, 1228091L, 1228099L, 1228109L, 1228133L,
-1228147L, 1228153L, 1228159L, 1228163L, 1228181L, 1228187L, 1228193L, 1228219L, 1228243L,
-1228247L, 1228273L, 1228277L, 1228291L, 1228303L, 1228309L, 1228327L, 1228333L, 1228351L,
-1228373L, 1228391L, 1228393L, 1228397L, 1228399L, 1228429L, 1228441L, 1228457L, 1228459L,
-1228489L, 1228501L, 1228519L, 1228537L, 1228541L, 1228543L, 1228547L, 1228567L, 1228571L,
-1228583L, 1228589L, 1228603L, 1228613L, 1228631L, 1228651L, 1228657L, 1228679L, 1228691L,
-1228693L, 1228741L, 1228763L, 1228783L, 1228789L, 1228837L, 1228841L, 1228849L, 1228861L,
-1228883L, 1228889L, 1228891L, 1228907L, 1228919L, 1228937L, 1228943L, 1228949L, 1228951L,
-1228961L, 1228963L, 1228987L, 1228993L, 1229021L, 1229023L, 1229071L, 1229077L, 1229093L,
-1229113L, 1229131L, 1229141L, 1229149L, 1229159L, 1229197L, 1229201L, 1229203L, 1229209L,
-1229213L, 1229227L, 1229237L, 1229257L, 1229269L, 1229273L, 1229279L, 1229297L, 1229309L,
-1229311L, 1229317L, 1229329L, 1229351L, 1229353L, 1229359L, 1229369L, 1229377L, 1229381L,
-1229401L, 1229443L, 1229447L, 1229453L, 1229461L, 1229483L, 1229489L, 1229519L, 1229521L,
-1229531L, 1229561L, 1229563L, 1229581L, 1229597L, 1229617L, 1229633L, 1229647L, 1229663L,
-1229689L, 1229707L, 1229719L, 1229731L, 1229743L, 1229773L, 1229783L, 1229807L, 1229827L,
-1229869L, 1229873L, 1229897L, 1229903L, 1229911L, 1229939L, 1229941L, 1229957L, 1229981L,
-1229993L, 1229999L, 1230013L, 1230023L, 1230029L, 1230067L, 1230071L, 1230107L, 1230127L,
-1230167L, 1230169L, 1230181L, 1230199L, 1230223L, 1230227L, 1230233L, 1230241L, 1230263L,
-1230301L, 1230311L, 1230329L, 1230331L, 1230337L, 1230343L, 1230347L, 1230349L, 1230367L,
-1230371L, 1230373L, 1230377L, 1230379L, 1230391L, 1230401L, 1230433L, 1230461L, 1230469L,
-1230479L, 1230491L, 1230521L, 1230529L, 1230539L, 1230547L, 1230571L, 1230587L, 1230599L,
-1230629L, 1230631L, 1230637L, 1230667L, 1230689L, 1230727L, 1230739L, 1230743L, 1230751L,
-1230769L, 1230791L, 1230829L, 1230863L, 1230869L, 1230871L, 1230881L, 1230907L, 1230913L,
-1230941L, 1230949L, 1230967L, 1230997L, 1231001L, 1231003L, 1231039L, 1231049L, 1231051L,
-1231063L, 1231073L, 1231091L, 1231093L, 1231099L, 1231127L, 1231129L, 1231141L, 1231171L,
-1231177L, 1231193L, 1231199L, 1231201L, 1231207L, 1231229L, 1231231L, 1231247L, 1231261L,
-1231267L, 1231277L, 1231283L, 1231301L, 1231303L, 1231309L, 1231313L, 1231319L, 1231337L,
-1231339L, 1231357L, 1231379L, 1231381L, 1231387L, 1231411L, 1231421L, 1231423L, 1231453L,
-1231457L, 1231459L, 1231469L, 1231481L, 1231487L, 1231511L, 1231513L, 1231547L, 1231553L,
-1231577L, 1231579L, 1231589L, 1231597L, 1231613L, 1231631L, 1231663L, 1231669L, 1231687L,
-1231691L, 1231697L, 1231709L, 1231721L, 1231733L, 1231753L, 1231757L, 1231771L, 1231781L,
-1231787L, 1231799L, 1231807L, 1231817L, 1231829L, 1231831L, 1231843L, 1231859L, 1231873L,
-1231877L, 1231883L, 1231889L, 1231943L, 1231961L, 1231981L, 1231987L, 1231999L, 1232003L,
-1232069L, 1232071L, 1232083L, 1232089L, 1232171L, 1232183L, 1232201L, 1232213L, 1232221L,
-1232227L, 1232243L, 1232269L, 1232291L, 1232299L, 1232327L, 1232339L, 1232351L, 1232353L,
-1232377L, 1232389L, 1232393L, 1232401L, 1232411L, 1232417L, 1232431L, 1232437L, 1232453L,
-1232461L, 1232477L, 1232527L, 1232531L, 1232537L, 1232563L, 1232573L, 1232603L, 1232611L,
-1232617L, 1232657L, 1232659L, 1232683L, 1232689L, 1232713L, 1232719L, 1232771L, 1232797L,
-1232801L, 1232809L, 1232831L, 1232843L, 1232849L, 1232851L, 1232879L, 1232893L, 1232909L,
-1232941L, 1232947L, 1232977L, 1232981L, 1232983L, 1232999L, 1233019L, 1233047L, 1233073L,
-1233079L, 1233097L, 1233101L, 1233107L, 1233121L, 1233143L, 1233179L, 1233181L, 1233187L,
-1233209L, 1233241L, 1233251L, 1233259L, 1233263L, 1233301L, 1233313L, 1233319L, 1233361L,
-1233371L, 1233373L, 1233377L, 1233409L, 1233431L, 1233433L, 1233437L, 1233439L, 1233473L,
-1233493L, 1233497L, 1233509L, 1233523L, 1233527L, 1233539L, 1233563L, 1233569L, 1233577L,
-1233587L, 1233593L, 1233599L, 1233607L, 1233611L, 1233619L, 1233641L, 1233647L, 1233653L,
-1233709L, 1233721L, 1233751L, 1233761L, 1233763L, 1233779L, 1233781L, 1233851L, 1233887L,
-1233899L, 1233907L, 1233923L, 1233929L, 1233949L, 1233983L, 1234001L, 1234003L, 1234039L,
-1234049L, 1234063L, 1234067L, 1234099L, 1234109L, 1234117L, 1234133L, 1234147L, 1234187L,
-1234231L, 1234237L, 1234241L, 1234243L, 1234253L, 1234271L, 1234309L, 1234333L, 1234349L,
-1234351L, 1234367L, 1234379L, 1234391L, 1234393L, 1234417L, 1234439L, 1234463L, 1234511L,
-1234517L, 1234531L, 1234537L, 1234543L, 1234547L, 1234577L, 1234603L, 1234613L, 1234627L,
-1234657L, 1234687L, 1234703L, 1234721L, 1234747L, 1234757L, 1234759L, 1234769L, 1234777L,
-1234787L, 1234789L, 1234799L, 1234813L, 1234819L, 1234837L, 1234841L, 1234843L, 1234853L,
-1234873L, 1234889L, 1234901L, 1234951L, 1234967L, 1234969L, 1234991L, 1235021L, 1235027L,
-1235041L, 1235063L, 1235083L, 1235093L, 1235099L, 1235131L, 1235137L, 1235141L, 1235149L,
-1235159L, 1235167L, 1235177L, 1235183L, 1235191L, 1235239L, 1235243L, 1235249L, 1235251L,
-1235263L, 1235281L, 1235287L, 1235303L, 1235309L, 1235321L, 1235327L, 1235363L, 1235369L,
-1235383L, 1235389L, 1235417L, 1235419L, 1235431L, 1235447L, 1235449L, 1235459L, 1235473L,
-1235477L, 1235497L, 1235501L, 1235503L, 1235539L, 1235569L, 1235573L, 1235593L, 1235651L,
-1235653L, 1235659L, 1235669L, 1235701L, 1235711L, 1235761L, 1235789L, 1235791L, 1235803L,
-1235807L, 1235821L, 1235831L, 1235833L, 1235867L, 1235879L, 1235887L, 1235891L, 1235909L,
-1235929L, 1235933L, 1235947L, 1235977L, 1235981L, 1235987L, 1235999L, 1236017L, 1236073L,
-1236077L, 1236161L, 1236163L, 1236173L, 1236203L, 1236211L, 1236229L, 1236233L, 1236239L,
-1236259L, 1236307L, 1236317L, 1236329L, 1236337L, 1236383L, 1236397L, 1236419L, 1236439L,
-1236449L, 1236467L, 1236479L, 1236481L, 1236491L, 1236517L, 1236527L, 1236533L, 1236541L,
-1236553L, 1236583L, 1236611L, 1236623L, 1236629L, 1236643L, 1236659L, 1236661L, 1236667L,
-1236701L, 1236709L, 1236713L, 1236727L, 1236737L, 1236743L, 1236751L, 1236757L, 1236761L,
-1236769L, 1236787L, 1236791L, 1236797L, 1236803L, 1236811L, 1236827L, 1236857L, 1236883L,
-1236901L, 1236953L, 1236959L, 1236979L, 1237001L, 1237013L, 1237031L, 1237037L, 1237043L,
-1237051L, 1237057L, 1237063L, 1237079L, 1237091L, 1237121L, 1237129L, 1237139L, 1237151L,
-1237163L, 1237177L, 1237199L, 1237207L, 1237211L, 1237213L, 1237217L, 1237231L, 1237253L,
-1237273L, 1237279L, 1237283L, 1237297L, 1237309L, 1237349L, 1237363L, 1237373L, 1237387L,
-1237393L, 1237403L, 1237417L, 1237433L, 1237441L, 1237471L, 1237487L, 1237493L, 1237499L,
-1237501L, 1237513L, 1237519L, 1237529L, 1237531L, 1237543L, 1237547L, 1237567L, 1237571L,
-1237589L, 1237619L, 1237627L, 1237661L, 1237721L, 1237727L, 1237739L, 1237757L, 1237763L,
-1237783L, 1237813L, 1237823L, 1237829L, 1237843L, 1237849L, 1237853L, 1237867L, 1237877L,
-1237897L, 1237919L, 1237931L, 1237939L, 1237949L, 1237961L, 1237963L, 1237967L, 1237993L,
-1238023L, 1238033L, 1238051L, 1238063L, 1238071L, 1238087L, 1238089L, 1238101L, 1238119L,
-1238129L, 1238137L, 1238177L, 1238179L, 1238189L, 1238197L, 1238201L, 1238219L, 1238267L,
-1238269L, 1238273L, 1238291L, 1238317L, 1238327L, 1238333L, 1238371L, 1238381L, 1238383L,
-1238407L, 1238411L, 1238423L, 1238429L, 1238431L, 1238437L, 1238449L, 1238459L, 1238491L,
-1238509L, 1238521L, 1238533L, 1238537L, 1238551L, 1238597L, 1238599L, 1238621L, 1238647L,
-1238659L, 1238681L, 1238683L, 1238687L, 1238693L, 1238717L, 1238719L, 1238747L, 1238749L,
-1238759L, 1238761L, 1238767L, 1238771L, 1238789L, 1238801L, 1238821L, 1238827L, 1238833L,
-1238843L, 1238863L, 1238893L, 1238903L, 1238911L, 1238917L, 1238921L, 1238947L, 1238989L,
-1238999L, 1239001L, 1239013L, 1239023L, 1239041L, 1239067L, 1239089L, 1239103L, 1239109L,
-1239127L, 1239151L, 1239179L, 1239191L, 1239197L, 1239223L, 1239229L, 1239239L, 1239247L,
-1239269L, 1239281L, 1239311L, 1239319L, 1239323L, 1239341L, 1239347L, 1239353L, 1239361L,
-1239367L, 1239377L, 1239379L, 1239397L, 1239421L, 1239443L, 1239449L, 1239457L, 1239461L,
-1239481L, 1239499L, 1239509L, 1239517L, 1239523L, 1239529L, 1239533L, 1239551L, 1239569L,
-1239583L, 1239593L, 1239599L, 1239607L, 1239619L, 1239643L, 1239661L, 1239671L, 1239697L,
-1239727L, 1239737L, 1239739L, 1239751L, 1239761L, 1239773L, 1239803L, 1239817L, 1239839L,
-1239877L, 1239893L, 1239899L, 1239911L, 1239913L, 1239919L, 1239923L, 1239943L, 1239961L,
-1239971L, 1239983L, 1239989L, 1240007L, 1240009L, 1240013L, 1240021L, 1240027L, 1240039L,
-1240081L, 1240087L, 1240097L, 1240117L, 1240139L, 1240153L, 1240159L, 1240181L, 1240193L,
-1240199L, 1240207L, 1240219L, 1240231L, 1240241L, 1240247L, 1240271L, 1240273L, 1240307L,
-1240319L, 1240333L, 1240361L, 1240363L, 1240387L, 1240391L, 1240399L, 1240423L, 1240483L,
-1240487L, 1240511L, 1240517L, 1240523L, 1240543L, 1240553L, 1240559L, 1240607L, 1240621L,
-1240637L, 1240667L, 1240669L, 1240691L, 1240699L, 1240703L, 1240709L, 1240717L, 1240739L,
-1240741L, 1240751L, 1240763L, 1240769L, 1240777L, 1240793L, 1240807L, 1240817L, 1240831L,
-1240859L, 1240861L, 1240931L, 1240957L, 1240973L, 1240979L, 1240991L, 1240999L, 1241003L,
-1241027L, 1241033L, 1241039L, 1241059L, 1241077L, 1241081L, 1241087L, 1241159L, 1241161L,
-1241173L, 1241197L, 1241203L, 1241243L, 1241249L, 1241257L, 1241263L, 1241267L, 1241269L,
-1241291L, 1241321L, 1241341L, 1241347L, 1241351L, 1241369L, 1241377L, 1241381L, 1241389L,
-1241407L, 1241413L, 1241417L, 1241423L, 1241437L, 1241447L, 1241467L, 1241477L, 1241483L,
-1241489L, 1241491L, 1241507L, 1241509L, 1241549L, 1241551L, 1241557L, 1241573L, 1241579L,
-1241587L, 1241627L, 1241651L, 1241659L, 1241677L, 1241699L, 1241741L, 1241743L, 1241761L,
-1241771L, 1241789L, 1241813L, 1241819L, 1241827L, 1241869L, 1241879L, 1241893L, 1241921L,
-1241923L, 1241927L, 1241939L, 1241941L, 1241951L, 1241957L, 1241963L, 1241971L, 1241987L,
-1242001L, 1242029L, 1242061L, 1242067L, 1242089L, 1242097L, 1242103L, 1242107L, 1242119L,
-1242121L, 1242151L, 1242167L, 1242169L, 1242181L, 1242191L, 1242193L, 1242217L, 1242221L,
-1242233L, 1242251L, 1242271L, 1242289L, 1242317L, 1242347L, 1242359L, 1242361L, 1242379L,
-1242403L, 1242407L, 1242413L, 1242419L, 1242421L, 1242457L, 1242487L, 1242503L, 1242517L,
-1242569L, 1242601L, 1242611L, 1242617L, 1242623L, 1242629L, 1242641L, 1242643L, 1242739L,
-1242757L, 1242763L, 1242767L, 1242781L, 1242803L, 1242811L, 1242817L, 1242823L, 1242827L,
-1242841L, 1242859L, 1242869L, 1242889L, 1242893L, 1242929L, 1242931L, 1242937L, 1242947L,
-1242959L, 1242977L, 1242979L, 1242991L, 1243003L, 1243013L, 1243093L, 1243097L, 1243111L,
-1243129L, 1243133L, 1243141L, 1243147L, 1243157L, 1243169L, 1243181L, 1243211L, 1243271L,
-1243273L, 1243309L, 1243337L, 1243343L, 1243349L, 1243367L, 1243369L, 1243373L, 1243387L,
-1243391L, 1243393L, 1243421L, 1243427L, 1243439L, 1243471L, 1243477L, 1243481L, 1243483L,
-1243511L, 1243523L, 1243537L, 1243547L, 1243559L, 1243577L, 1243579L, 1243609L, 1243631L,
-1243639L, 1243643L, 1243663L, 1243673L, 1243691L, 1243709L, 1243717L, 1243741L, 1243747L,
-1243783L, 1243789L, 1243793L, 1243807L, 1243811L, 1243819L, 1243841L, 1243843L, 1243859L,
-1243877L, 1243883L, 1243889L, 1243927L, 1243933L, 1243939L, 1243943L, 1243951L, 1243961L,
-1243967L, 1243969L, 1243997L, 1244003L, 1244021L, 1244027L, 1244029L, 1244039L, 1244041L,
-1244053L, 1244057L, 1244059L, 1244083L, 1244099L, 1244141L, 1244143L, 1244149L, 1244153L,
-1244167L, 1244183L, 1244197L, 1244203L, 1244233L, 1244249L, 1244261L, 1244263L, 1244279L,
-1244293L, 1244333L, 1244357L, 1244359L, 1244363L, 1244381L, 1244393L, 1244401L, 1244423L,
-1244429L, 1244437L, 1244447L, 1244459L, 1244471L, 1244479L, 1244483L, 1244501L, 1244521L,
-1244531L, 1244533L, 1244543L, 1244567L, 1244591L, 1244603L, 1244609L, 1244611L, 1244627L,
-1244629L, 1244647L, 1244687L, 1244699L, 1244713L, 1244729L, 1244741L, 1244753L, 1244759L,
-1244777L, 1244797L, 1244813L, 1244819L, 1244821L, 1244833L, 1244839L, 1244857L, 1244863L,
-1244879L, 1244909L, 1244911L, 1244923L, 1244953L, 1244987L, 1244989L, 1244993L, 1245001L,
-1245017L, 1245019L, 1245037L, 1245067L, 1245091L, 1245103L, 1245113L, 1245121L, 1245137L,
-1245149L, 1245169L, 1245187L, 1245191L, 1245217L, 1245227L, 1245281L, 1245331L, 1245353L,
-1245379L, 1245397L, 1245401L, 1245421L, 1245449L, 1245451L, 1245479L, 1245509L, 1245527L,
-1245529L, 1245551L, 1245557L, 1245589L, 1245613L, 1245617L, 1245619L, 1245623L, 1245649L,
-1245683L, 1245689L, 1245691L, 1245701L, 1245707L, 1245719L, 1245721L, 1245763L, 1245767L,
-1245779L, 1245781L, 1245791L, 1245799L, 1245817L, 1245833L, 1245847L, 1245863L, 1245877L,
-1245883L, 1245917L, 1245929L, 1245943L, 1245953L, 1245961L, 1245971L, 1245973L, 1246013L,
-1246033L, 1246057L, 1246061L, 1246073L, 1246081L, 1246093L, 1246099L, 1246103L, 1246181L,
-1246187L, 1246199L, 1246207L, 1246213L, 1246241L, 1246243L, 1246247L, 1246249L, 1246261L,
-1246283L, 1246303L, 1246307L, 1246313L, 1246319L, 1246327L, 1246331L, 1246339L, 1246351L,
-1246361L, 1246363L, 1246367L, 1246369L, 1246373L, 1246379L, 1246387L, 1246397L, 1246429L,
-1246433L, 1246451L, 1246459L, 1246471L, 1246477L, 1246481L, 1246489L, 1246499L, 1246501L,
-1246513L, 1246517L, 1246529L, 1246537L, 1246543L, 1246561L, 1246573L, 1246579L, 1246589L,
-1246591L, 1246601L, 1246631L, 1246639L, 1246667L, 1246673L, 1246697L, 1246703L, 1246711L,
-1246733L, 1246747L, 1246757L, 1246781L, 1246823L, 1246829L, 1246841L, 1246867L, 1246879L,
-1246891L, 1246907L, 1246919L, 1246943L, 1246961L, 1246963L, 1246997L, 1247009L, 1247017L,
-1247033L, 1247053L, 1247063L, 1247089L, 1247101L, 1247107L, 1247117L, 1247119L, 1247167L,
-1247177L, 1247189L, 1247209L, 1247231L, 1247243L, 1247263L, 1247269L, 1247291L, 1247297L,
-1247303L, 1247317L, 1247321L, 1247327L, 1247329L, 1247371L, 1247383L, 1247401L, 1247417L,
-1247419L, 1247429L, 1247447L, 1247453L, 1247459L, 1247479L, 1247501L, 1247509L, 1247527L,
-1247549L, 1247557L, 1247563L, 1247569L, 1247581L, 1247591L, 1247599L, 1247611L, 1247621L,
-1247627L, 1247641L, 1247651L, 1247663L, 1247693L, 1247699L, 1247737L, 1247759L, 1247761L,
-1247767L, 1247777L, 1247797L, 1247801L, 1247833L, 1247837L, 1247861L, 1247867L, 1247879L,
-1247881L, 1247893L, 1247923L, 1247947L, 1247951L, 1247959L, 1247969L, 1248001L, 1248007L,
-1248011L, 1248017L, 1248019L, 1248031L, 1248041L, 1248059L, 1248061L, 1248083L, 1248101L,
-1248103L, 1248113L, 1248119L, 1248151L, 1248193L, 1248199L, 1248209L, 1248211L, 1248217L,
-1248229L, 1248239L, 1248241L, 1248253L, 1248271L, 1248323L, 1248329L, 1248337L, 1248341L,
-1248347L, 1248349L, 1248353L, 1248383L, 1248391L, 1248407L, 1248413L, 1248427L, 1248449L,
-1248451L, 1248469L, 1248493L, 1248503L, 1248529L, 1248539L, 1248551L, 1248553L, 1248563L,
-1248571L, 1248589L, 1248593L, 1248631L, 1248641L, 1248671L, 1248673L, 1248691L, 1248697L,
-1248703L, 1248721L, 1248757L, 1248781L, 1248799L, 1248809L, 1248829L, 1248833L, 1248847L,
-1248857L, 1248859L, 1248869L, 1248881L, 1248893L, 1248917L, 1248941L, 1248953L, 1248977L,
-1248979L, 1248991L, 1249013L, 1249019L, 1249033L, 1249037L, 1249043L, 1249049L, 1249057L,
-1249063L, 1249091L, 1249099L, 1249111L, 1249121L, 1249133L, 1249139L, 1249141L, 1249151L,
-1249159L, 1249163L, 1249187L, 1249201L, 1249217L, 1249243L, 1249247L, 1249273L, 1249301L,
-1249319L, 1249321L, 1249333L, 1249343L, 1249361L, 1249363L, 1249373L, 1249397L, 1249403L,
-1249411L, 1249427L, 1249433L, 1249477L, 1249481L, 1249487L, 1249489L, 1249499L, 1249511L,
-1249519L, 1249531L, 1249559L, 1249603L, 1249621L, 1249627L, 1249631L, 1249643L, 1249657L,
-1249669L, 1249681L, 1249691L, 1249693L, 1249727L, 1249733L, 1249739L, 1249741L, 1249747L,
-1249757L, 1249799L, 1249811L, 1249817L, 1249819L, 1249837L, 1249841L, 1249847L, 1249849L,
-1249861L, 1249873L, 1249901L, 1249921L, 1249939L, 1249943L, 1249999L, 1250003L, 1250009L,
-1250021L, 1250023L, 1250057L, 1250069L, 1250083L, 1250087L, 1250099L, 1250107L, 1250141L,
-1250147L, 1250149L, 1250173L, 1250177L, 1250189L, 1250201L, 1250203L, 1250237L, 1250243L,
-1250273L, 1250281L, 1250297L, 1250309L, 1250351L, 1250357L, 1250407L, 1250413L, 1250437L,
-1250443L, 1250449L, 1250453L, 1250461L, 1250471L, 1250479L, 1250497L, 1250507L, 1250519L,
-1250521L, 1250527L, 1250551L, 1250593L, 1250609L, 1250611L, 1250629L, 1250647L, 1250653L,
-1250677L, 1250701L, 1250737L, 1250749L, 1250761L, 1250771L, 1250773L, 1250779L, 1250783L,
-1250801L, 1250813L, 1250831L, 1250839L, 1250863L, 1250867L, 1250917L, 1250923L, 1250929L,
-1250939L, 1250969L, 1250971L, 1250981L, 1250983L, 1251011L, 1251037L, 1251043L, 1251053L,
-1251071L, 1251083L, 1251097L, 1251101L, 1251109L, 1251121L, 1251157L, 1251161L, 1251179L,
-1251227L, 1251247L, 1251259L, 1251287L, 1251301L, 1251307L, 1251317L, 1251323L, 1251329L,
-1251409L, 1251427L, 1251431L, 1251433L, 1251461L, 1251463L, 1251527L, 1251529L, 1251533L,
-1251571L, 1251577L, 1251581L, 1251583L, 1251641L, 1251661L, 1251667L, 1251671L, 1251697L,
-1251703L, 1251707L, 1251713L, 1251721L, 1251743L, 1251787L, 1251791L, 1251797L, 1251827L,
-1251841L, 1251851L, 1251857L, 1251869L, 1251871L, 1251881L, 1251907L, 1251911L, 1251919L,
-1251923L, 1251937L, 1251947L, 1251953L, 1251961L, 1251983L, 1252021L, 1252037L, 1252049L,
-1252057L, 1252063L, 1252073L, 1252079L, 1252103L, 1252109L, 1252123L, 1252129L, 1252151L,
-1252159L, 1252177L, 1252187L, 1252193L, 1252201L, 1252211L, 1252217L, 1252219L, 1252247L,
-1252259L, 1252267L, 1252283L, 1252331L, 1252343L, 1252357L, 1252399L, 1252403L, 1252411L,
-1252421L, 1252429L, 1252439L, 1252451L, 1252457L, 1252469L, 1252483L, 1252507L, 1252523L,
-1252579L, 1252609L, 1252631L, 1252639L, 1252661L, 1252663L, 1252681L, 1252711L, 1252717L,
-1252721L, 1252729L, 1252739L, 1252751L, 1252777L, 1252799L, 1252817L, 1252819L, 1252843L,
-1252873L, 1252877L, 1252897L, 1252903L, 1252913L, 1252921L, 1252943L, 1252957L, 1252963L,
-1252987L, 1252991L, 1252997L, 1253011L, 1253023L, 1253027L, 1253047L, 1253059L, 1253071L,
-1253089L, 1253093L, 1253099L, 1253111L, 1253137L, 1253167L, 1253171L, 1253249L, 1253251L,
-1253261L, 1253279L, 1253323L, 1253327L, 1253333L, 1253347L, 1253377L, 1253381L, 1253401L,
-1253437L, 1253453L, 1253471L, 1253479L, 1253513L, 1253519L, 1253521L, 1253557L, 1253587L,
-1253591L, 1253599L, 1253621L, 1253627L, 1253683L, 1253689L, 1253701L, 1253717L, 1253723L,
-1253729L, 1253737L, 1253741L, 1253761L, 1253783L, 1253803L, 1253831L, 1253839L, 1253849L,
-1253851L, 1253887L, 1253897L, 1253909L, 1253911L, 1253947L, 1253951L, 1253953L, 1253963L,
-1253969L, 1253999L, 1254013L, 1254017L, 1254023L, 1254031L, 1254037L, 1254049L, 1254053L,
-1254059L, 1254061L, 1254079L, 1254091L, 1254109L, 1254119L, 1254131L, 1254137L, 1254151L,
-1254157L, 1254161L, 1254179L, 1254193L, 1254203L, 1254217L, 1254241L, 1254251L, 1254257L,
-1254269L, 1254293L, 1254301L, 1254317L, 1254329L, 1254367L, 1254371L, 1254373L, 1254377L,
-1254427L, 1254433L, 1254467L, 1254469L, 1254479L, 1254497L, 1254503L, 1254523L, 1254527L,
-1254529L, 1254541L, 1254553L, 1254557L, 1254577L, 1254593L, 1254607L, 1254613L, 1254619L,
-1254623L, 1254637L, 1254647L, 1254653L, 1254661L, 1254667L, 1254683L, 1254689L, 1254731L,
-1254733L, 1254739L, 1254751L, 1254761L, 1254767L, 1254791L, 1254793L, 1254823L, 1254833L,
-1254839L, 1254863L, 1254899L, 1254907L, 1254941L, 1254959L, 1254971L, 1254983L, 1254997L,
-1255013L, 1255021L, 1255039L, 1255049L, 1255063L, 1255069L, 1255081L, 1255103L, 1255109L,
-1255117L, 1255123L, 1255129L, 1255139L, 1255147L, 1255153L, 1255157L, 1255169L, 1255181L,
-1255183L, 1255187L, 1255201L, 1255211L, 1255237L, 1255249L, 1255253L, 1255259L, 1255279L,
-1255301L, 1255307L, 1255313L, 1255321L, 1255333L, 1255337L, 1255357L, 1255361L, 1255367L,
-1255391L, 1255393L, 1255421L, 1255427L, 1255451L, 1255453L, 1255477L, 1255519L, 1255549L,
-1255559L, 1255567L, 1255591L, 1255601L, 1255609L, 1255619L, 1255633L, 1255651L, 1255663L,
-1255679L, 1255687L, 1255693L, 1255721L, 1255747L, 1255757L, 1255759L, 1255799L, 1255801L,
-1255811L, 1255829L, 1255831L, 1255847L, 1255861L, 1255907L, 1255913L, 1255927L, 1255931L,
-1255939L, 1255949L, 1255963L, 1255967L, 1255993L, 1255997L, 1256009L, 1256023L, 1256029L,
-1256041L, 1256063L, 1256107L, 1256149L, 1256161L, 1256197L, 1256201L, 1256209L, 1256231L,
-1256243L, 1256267L, 1256279L, 1256303L, 1256323L, 1256347L, 1256369L, 1256383L, 1256389L,
-1256393L, 1256407L, 1256429L, 1256449L, 1256477L, 1256531L, 1256533L, 1256543L, 1256573L,
-1256579L, 1256587L, 1256597L, 1256611L, 1256617L, 1256621L, 1256659L, 1256681L, 1256687L,
-1256693L, 1256707L, 1256711L, 1256729L, 1256737L, 1256747L, 1256753L, 1256777L, 1256797L,
-1256809L, 1256813L, 1256819L, 1256821L, 1256837L, 1256863L, 1256867L, 1256873L, 1256887L,
-1256891L, 1256897L, 1256903L, 1256911L, 1256917L, 1256923L, 1256939L, 1256953L, 1256989L,
-1256993L, 1257013L, 1257017L, 1257029L, 1257041L, 1257043L, 1257049L, 1257071L, 1257073L,
-1257077L, 1257079L, 1257089L, 1257103L, 1257119L, 1257131L, 1257163L, 1257199L, 1257209L,
-1257229L, 1257233L, 1257239L, 1257241L, 1257247L, 1257251L, 1257253L, 1257281L, 1257293L,
-1257307L, 1257313L, 1257317L, 1257323L, 1257331L, 1257359L, 1257397L, 1257409L, 1257437L,
-1257457L, 1257461L, 1257463L, 1257491L, 1257493L, 1257499L, 1257517L, 1257521L, 1257547L,
-1257559L, 1257563L, 1257569L, 1257587L, 1257589L, 1257611L, 1257647L, 1257653L, 1257689L,
-1257691L, 1257713L, 1257719L, 1257721L, 1257749L, 1257787L, 1257827L, 1257829L, 1257853L,
-1257859L, 1257869L, 1257877L, 1257911L, 1257931L, 1257953L, 1257959L, 1257961L, 1257973L,
-1257989L, 1258001L, 1258013L, 1258027L, 1258039L, 1258079L, 1258087L, 1258097L, 1258099L,
-1258109L, 1258133L, 1258139L, 1258141L, 1258151L, 1258163L, 1258171L, 1258177L, 1258181L,
-1258183L, 1258207L, 1258211L, 1258217L, 1258219L, 1258241L, 1258267L, 1258291L, 1258297L,
-1258303L, 1258319L, 1258337L, 1258343L, 1258349L, 1258373L, 1258403L, 1258409L, 1258417L,
-1258421L, 1258423L, 1258429L, 1258441L, 1258451L, 1258457L, 1258469L, 1258471L, 1258483L,
-1258487L, 1258511L, 1258531L, 1258559L, 1258589L, 1258597L, 1258601L, 1258627L, 1258637L,
-1258639L, 1258643L, 1258657L, 1258661L, 1258667L, 1258681L, 1258709L, 1258711L, 1258717L,
-1258723L, 1258753L, 1258771L, 1258781L, 1258783L, 1258787L, 1258811L, 1258819L, 1258837L,
-1258847L, 1258871L, 1258877L, 1258889L, 1258903L, 1258927L, 1258931L, 1258937L, 1258967L,
-1258973L, 1258993L, 1259017L, 1259029L, 1259033L, 1259039L, 1259047L, 1259051L, 1259053L,
-1259057L, 1259077L, 1259081L, 1259087L, 1259099L, 1259107L, 1259113L, 1259123L, 1259129L,
-1259143L, 1259171L, 1259179L, 1259191L, 1259213L, 1259231L, 1259243L, 1259249L, 1259287L,
-1259299L, 1259317L, 1259329L, 1259371L, 1259389L, 1259393L, 1259413L, 1259429L, 1259477L,
-1259509L, 1259527L, 1259537L, 1259539L, 1259543L, 1259551L, 1259563L, 1259569L, 1259593L,
-1259603L, 1259627L, 1259639L, 1259653L, 1259659L, 1259663L, 1259669L, 1259677L, 1259689L,
-1259701L, 1259737L, 1259743L, 1259749L, 1259759L, 1259767L, 1259777L, 1259803L, 1259821L,
-1259851L, 1259873L, 1259899L, 1259903L, 1259927L, 1259939L, 1259953L, 1259977L, 1259983L,
-1260011L, 1260019L, 1260031L, 1260047L, 1260059L, 1260067L, 1260113L, 1260121L, 1260131L,
-1260143L, 1260157L, 1260163L, 1260167L, 1260169L, 1260191L, 1260223L, 1260269L, 1260277L,
-1260283L, 1260293L, 1260317L, 1260319L, 1260323L, 1260341L, 1260359L, 1260361L, 1260383L,
-1260401L, 1260419L, 1260437L, 1260439L, 1260461L, 1260473L, 1260481L, 1260487L, 1260509L,
-1260541L, 1260547L, 1260551L, 1260569L, 1260577L, 1260583L, 1260599L, 1260629L, 1260641L,
-1260643L, 1260661L, 1260673L, 1260691L, 1260713L, 1260719L, 1260731L, 1260733L, 1260751L,
-1260757L, 1260767L, 1260769L, 1260797L, 1260799L, 1260827L, 1260829L, 1260841L, 1260851L,
-1260877L, 1260881L, 1260887L, 1260893L, 1260899L, 1260901L, 1260911L, 1260971L, 1260979L,
-1260989L, 1260991L, 1261033L, 1261069L, 1261079L, 1261081L, 1261109L, 1261121L, 1261133L,
-1261157L, 1261171L, 1261177L, 1261199L, 1261217L, 1261223L, 1261259L, 1261261L, 1261279L,
-1261289L, 1261301L, 1261313L, 1261321L, 1261327L, 1261333L, 1261357L, 1261363L, 1261373L,
-1261387L, 1261411L, 1261427L, 1261459L, 1261487L, 1261489L, 1261523L, 1261531L, 1261549L,
-1261567L, 1261571L, 1261627L, 1261639L, 1261643L, 1261649L, 1261697L, 1261699L, 1261717L,
-1261721L, 1261739L, 1261747L, 1261759L, 1261763L, 1261769L, 1261789L, 1261801L, 1261823L,
-1261829L, 1261831L, 1261837L, 1261861L, 1261889L, 1261891L, 1261901L, 1261913L, 1261933L,
-1261943L, 1261963L, 1261969L, 1261973L, 1262011L, 1262017L, 1262057L, 1262071L, 1262081L,
-1262083L, 1262087L, 1262099L, 1262101L, 1262119L, 1262143L, 1262147L, 1262203L, 1262207L,
-1262221L, 1262231L, 1262237L, 1262269L, 1262281L, 1262291L, 1262293L, 1262299L, 1262311L,
-1262321L, 1262363L, 1262377L, 1262411L, 1262419L, 1262441L, 1262453L, 1262461L, 1262479L,
-1262483L, 1262491L, 1262509L, 1262519L, 1262543L, 1262557L, 1262563L, 1262581L, 1262587L,
-1262617L, 1262621L, 1262623L, 1262629L, 1262633L, 1262669L, 1262671L, 1262693L, 1262711L,
-1262713L, 1262717L, 1262731L, 1262741L, 1262753L, 1262771L, 1262783L, 1262819L, 1262839L,
-1262851L, 1262869L, 1262881L, 1262887L, 1262893L, 1262897L, 1262903L, 1262917L, 1262927L,
-1262929L, 1262939L, 1262941L, 1262957L, 1263007L, 1263047L, 1263071L, 1263077L, 1263079L,
-1263103L, 1263107L, 1263109L, 1263113L, 1263121L, 1263133L, 1263173L, 1263179L, 1263181L,
-1263187L, 1263191L, 1263193L, 1263209L, 1263239L, 1263247L, 1263259L, 1263263L, 1263299L,
-1263307L, 1263319L, 1263323L, 1263331L, 1263337L, 1263341L, 1263347L, 1263373L, 1263377L,
-1263391L, 1263403L, 1263461L, 1263463L, 1263473L, 1263487L, 1263499L, 1263503L, 1263511L,
-1263539L, 1263541L, 1263547L, 1263569L, 1263583L, 1263599L, 1263607L, 1263629L, 1263631L,
-1263659L, 1263667L, 1263677L, 1263697L, 1263701L, 1263751L, 1263761L, 1263767L, 1263793L,
-1263799L, 1263803L, 1263817L, 1263853L, 1263863L, 1263887L, 1263917L, 1263929L, 1263931L,
-1263943L, 1263947L, 1263949L, 1263953L, 1263961L, 1263973L, 1263979L, 1264009L, 1264027L,
-1264033L, 1264037L, 1264049L, 1264061L, 1264063L, 1264129L, 1264177L, 1264189L, 1264199L,
-1264213L, 1264231L, 1264259L, 1264261L, 1264267L, 1264271L, 1264301L, 1264303L, 1264331L,
-1264337L, 1264363L, 1264387L, 1264411L, 1264447L, 1264451L, 1264499L, 1264537L, 1264541L,
-1264559L, 1264561L, 1264573L, 1264577L, 1264597L, 1264607L, 1264643L, 1264649L, 1264651L,
-1264657L, 1264663L, 1264667L, 1264687L, 1264699L, 1264733L, 1264741L, 1264763L, 1264787L,
-1264801L, 1264807L, 1264819L, 1264829L, 1264853L, 1264859L, 1264867L, 1264873L, 1264877L,
-1264883L, 1264889L, 1264897L, 1264903L, 1264909L, 1264933L, 1264969L, 1264979L, 1264981L,
-1264997L, 1265029L, 1265041L, 1265051L, 1265053L, 1265063L, 1265081L, 1265083L, 1265087L,
-1265093L, 1265101L, 1265111L, 1265113L, 1265119L, 1265129L, 1265167L, 1265177L, 1265179L,
-1265197L, 1265233L, 1265249L, 1265273L, 1265279L, 1265281L, 1265311L, 1265321L, 1265333L,
-1265347L, 1265353L, 1265377L, 1265387L, 1265393L, 1265431L, 1265443L, 1265449L, 1265461L,
-1265471L, 1265477L, 1265479L, 1265503L, 1265519L, 1265521L, 1265527L, 1265549L, 1265557L,
-1265573L, 1265581L, 1265597L, 1265603L, 1265611L, 1265617L, 1265623L, 1265639L, 1265653L,
-1265657L, 1265681L, 1265729L, 1265741L, 1265777L, 1265779L, 1265801L, 1265813L, 1265827L,
-1265843L, 1265857L, 1265861L, 1265863L, 1265867L, 1265899L, 1265903L, 1265909L, 1265911L,
-1265921L, 1265923L, 1265941L, 1265959L, 1265969L, 1265977L, 1265981L, 1265987L, 1265993L,
-1266019L, 1266043L, 1266047L, 1266059L, 1266073L, 1266077L, 1266079L, 1266091L, 1266101L,
-1266107L, 1266113L, 1266149L, 1266157L, 1266163L, 1266191L, 1266197L, 1266229L, 1266241L,
-1266247L, 1266259L, 1266263L, 1266269L, 1266271L, 1266277L, 1266281L, 1266301L, 1266323L,
-1266337L, 1266341L, 1266359L, 1266371L, 1266373L, 1266379L, 1266389L, 1266409L, 1266413L,
-1266431L, 1266451L, 1266469L, 1266487L, 1266491L, 1266493L, 1266511L, 1266523L, 1266527L,
-1266539L, 1266557L, 1266563L, 1266583L, 1266589L, 1266593L, 1266611L, 1266631L, 1266677L,
-1266719L, 1266731L, 1266743L, 1266751L, 1266757L, 1266761L, 1266763L, 1266767L, 1266779L,
-1266781L, 1266799L, 1266841L, 1266847L, 1266851L, 1266869L, 1266883L, 1266893L, 1266899L,
-1266913L, 1266919L, 1266929L, 1266931L, 1266943L, 1266949L, 1266953L, 1267009L, 1267043L,
-1267051L, 1267067L, 1267103L, 1267109L, 1267117L, 1267121L, 1267127L, 1267151L, 1267157L,
-1267159L, 1267183L, 1267193L, 1267199L, 1267223L, 1267237L, 1267291L, 1267297L, 1267303L,
-1267307L, 1267349L, 1267381L, 1267403L, 1267411L, 1267429L, 1267447L, 1267451L, 1267459L,
-1267463L, 1267481L, 1267501L, 1267517L, 1267529L, 1267531L, 1267549L, 1267577L, 1267579L,
-1267589L, 1267613L, 1267633L, 1267649L, 1267663L, 1267681L, 1267709L, 1267711L, 1267723L,
-1267727L, 1267757L, 1267771L, 1267787L, 1267789L, 1267823L, 1267831L, 1267837L, 1267859L,
-1267873L, 1267883L, 1267891L, 1267897L, 1267907L, 1267933L, 1267939L, 1267943L, 1267951L,
-1267957L, 1267961L, 1267999L, 1268011L, 1268017L, 1268039L, 1268051L, 1268053L, 1268077L,
-1268093L, 1268119L, 1268143L, 1268147L, 1268167L, 1268173L, 1268177L, 1268207L, 1268213L,
-1268221L, 1268233L, 1268261L, 1268279L, 1268287L, 1268291L, 1268299L, 1268327L, 1268341L,
-1268357L, 1268359L, 1268369L, 1268413L, 1268419L, 1268429L, 1268447L, 1268453L, 1268461L,
-1268467L, 1268479L, 1268537L, 1268549L, 1268563L, 1268567L, 1268593L, 1268599L, 1268621L,
-1268623L, 1268627L, 1268633L, 1268669L, 1268681L, 1268713L, 1268731L, 1268741L, 1268747L,
-1268753L, 1268759L, 1268777L, 1268783L, 1268789L, 1268791L, 1268797L, 1268803L, 1268807L,
-1268843L, 1268849L, 1268867L, 1268881L, 1268899L, 1268921L, 1268929L, 1268947L, 1268963L,
-1269001L, 1269007L, 1269013L, 1269017L, 1269041L, 1269043L, 1269049L, 1269061L, 1269077L,
-1269091L, 1269113L, 1269119L, 1269131L, 1269167L, 1269173L, 1269179L, 1269187L, 1269193L,
-1269197L, 1269221L, 1269223L, 1269239L, 1269241L, 1269253L, 1269263L, 1269283L, 1269287L,
-1269299L, 1269311L, 1269337L, 1269343L, 1269377L, 1269379L, 1269383L, 1269391L, 1269413L,
-1269427L, 1269461L, 1269467L, 1269493L, 1269497L, 1269529L, 1269547L, 1269559L, 1269563L,
-1269571L, 1269589L, 1269601L, 1269641L, 1269643L, 1269683L, 1269691L, 1269703L, 1269731L,
-1269733L, 1269743L, 1269757L, 1269797L, 1269847L, 1269859L, 1269869L, 1269871L, 1269901L,
-1269907L, 1269911L, 1269923L, 1269929L, 1269937L, 1269953L, 1269971L, 1270001L, 1270013L,
-1270033L, 1270051L, 1270063L, 1270067L, 1270079L, 1270097L, 1270103L, 1270111L, 1270123L,
-1270141L, 1270147L, 1270151L, 1270183L, 1270193L, 1270201L, 1270231L, 1270237L, 1270249L,
-1270271L, 1270279L, 1270301L, 1270309L, 1270319L, 1270327L, 1270333L, 1270337L, 1270343L,
-1270361L, 1270391L, 1270417L, 1270421L, 1270429L, 1270433L, 1270441L, 1270471L, 1270483L,
-1270499L, 1270513L, 1270531L, 1270537L, 1270541L, 1270547L, 1270559L, 1270561L, 1270567L,
-1270571L, 1270573L, 1270579L, 1270609L, 1270627L, 1270639L, 1270649L, 1270651L, 1270657L,
-1270667L, 1270669L, 1270679L, 1270747L, 1270757L, 1270771L, 1270817L, 1270823L, 1270849L,
-1270859L, 1270861L, 1270879L, 1270897L, 1270901L, 1270909L, 1270933L, 1270943L, 1270961L,
-1270981L, 1271027L, 1271029L, 1271033L, 1271047L, 1271051L, 1271059L, 1271069L, 1271087L,
-1271089L, 1271111L, 1271117L, 1271129L, 1271147L, 1271161L, 1271167L, 1271173L, 1271183L,
-1271197L, 1271201L, 1271203L, 1271213L, 1271227L, 1271239L, 1271251L, 1271293L, 1271299L,
-1271317L, 1271321L, 1271339L, 1271351L, 1271353L, 1271359L, 1271383L, 1271393L, 1271399L,
-1271401L, 1271419L, 1271429L, 1271449L, 1271471L, 1271483L, 1271503L, 1271507L, 1271513L,
-1271521L, 1271531L, 1271551L, 1271561L, 1271597L, 1271603L, 1271609L, 1271657L, 1271659L,
-1271671L, 1271687L, 1271701L, 1271717L, 1271731L, 1271747L, 1271749L, 1271791L, 1271797L,
-1271807L, 1271813L, 1271827L, 1271833L, 1271839L, 1271843L, 1271849L, 1271903L, 1271927L,
-1271929L, 1271939L, 1271953L, 1271971L, 1271987L, 1271999L, 1272001L, 1272043L, 1272049L,
-1272067L, 1272071L, 1272079L, 1272091L, 1272109L, 1272113L, 1272133L, 1272151L, 1272157L,
-1272163L, 1272169L, 1272191L, 1272203L, 1272211L, 1272223L, 1272233L, 1272247L, 1272253L,
-1272269L, 1272281L, 1272283L, 1272287L, 1272289L, 1272329L, 1272343L, 1272347L, 1272361L,
-1272367L, 1272377L, 1272379L, 1272409L, 1272421L, 1272443L, 1272451L, 1272461L, 1272539L,
-1272547L, 1272559L, 1272577L, 1272589L, 1272617L, 1272629L, 1272631L, 1272641L, 1272647L,
-1272653L, 1272673L, 1272679L, 1272749L, 1272811L, 1272827L, 1272833L, 1272847L, 1272851L,
-1272857L, 1272863L, 1272881L, 1272883L, 1272893L, 1272899L, 1272913L, 1272917L, 1272919L,
-1272937L, 1272941L, 1272961L, 1272983L, 1272989L, 1272991L, 1273001L, 1273021L, 1273033L,
-1273037L, 1273039L, 1273087L, 1273099L, 1273109L, 1273117L, 1273121L, 1273127L, 1273157L,
-1273159L, 1273199L, 1273213L, 1273231L, 1273241L, 1273267L, 1273289L, 1273291L, 1273301L,
-1273309L, 1273313L, 1273331L, 1273333L, 1273343L, 1273367L, 1273381L, 1273403L, 1273409L,
-1273411L, 1273417L, 1273421L, 1273423L, 1273457L, 1273463L, 1273471L, 1273483L, 1273499L,
-1273507L, 1273541L, 1273543L, 1273549L, 1273561L, 1273567L, 1273609L, 1273637L, 1273639L,
-1273663L, 1273673L, 1273681L, 1273687L, 1273693L, 1273721L, 1273729L, 1273733L, 1273739L,
-1273757L, 1273771L, 1273781L, 1273787L, 1273823L, 1273843L, 1273879L, 1273889L, 1273891L,
-1273903L, 1273907L, 1273919L, 1273933L, 1273939L, 1273957L, 1273981L, 1274011L, 1274017L,
-1274041L, 1274051L, 1274071L, 1274087L, 1274089L, 1274111L, 1274113L, 1274129L, 1274137L,
-1274149L, 1274183L, 1274209L, 1274227L, 1274249L, 1274267L, 1274291L, 1274293L, 1274297L,
-1274309L, 1274323L, 1274333L, 1274353L, 1274363L, 1274381L, 1274389L, 1274401L, 1274411L,
-1274423L, 1274437L, 1274461L, 1274509L, 1274549L, 1274557L, 1274561L, 1274599L, 1274617L,
-1274621L, 1274629L, 1274633L, 1274671L, 1274701L, 1274719L, 1274723L, 1274737L, 1274759L,
-1274771L, 1274773L, 1274803L, 1274851L, 1274857L, 1274873L, 1274879L, 1274899L, 1274921L,
-1274929L, 1274939L, 1274941L, 1274989L, 1275011L, 1275019L, 1275041L, 1275067L, 1275107L,
-1275121L, 1275133L, 1275173L, 1275179L, 1275193L, 1275199L, 1275203L, 1275227L, 1275269L,
-1275277L, 1275283L, 1275293L, 1275319L, 1275341L, 1275349L, 1275359L, 1275361L, 1275401L,
-1275437L, 1275457L, 1275467L, 1275499L, 1275503L, 1275523L, 1275539L, 1275541L, 1275553L,
-1275559L, 1275563L, 1275569L, 1275583L, 1275601L, 1275611L, 1275643L, 1275661L, 1275667L,
-1275683L, 1275691L, 1275707L, 1275709L, 1275719L, 1275737L, 1275749L, 1275751L, 1275779L,
-1275803L, 1275817L, 1275823L, 1275829L, 1275839L, 1275847L, 1275851L, 1275863L, 1275877L,
-1275889L, 1275893L, 1275899L, 1275931L, 1275947L, 1275973L, 1275977L, 1275979L, 1276001L,
-1276007L, 1276013L, 1276027L, 1276031L, 1276039L, 1276049L, 1276057L, 1276069L, 1276103L,
-1276117L, 1276123L, 1276129L, 1276133L, 1276147L, 1276157L, 1276169L, 1276183L, 1276193L,
-1276213L, 1276237L, 1276243L, 1276271L, 1276279L, 1276307L, 1276313L, 1276351L, 1276357L,
-1276361L, 1276397L, 1276409L, 1276433L, 1276441L, 1276447L, 1276481L, 1276501L, 1276511L,
-1276529L, 1276543L, 1276571L, 1276579L, 1276589L, 1276603L, 1276619L, 1276621L, 1276631L,
-1276637L, 1276657L, 1276679L, 1276687L, 1276711L, 1276721L, 1276733L, 1276739L, 1276747L,
-1276763L, 1276771L, 1276777L, 1276817L, 1276829L, 1276861L, 1276867L, 1276871L, 1276889L,
-1276897L, 1276903L, 1276927L, 1276949L, 1276967L, 1276969L, 1276973L, 1276987L, 1276999L,
-1277011L, 1277021L, 1277039L, 1277041L, 1277063L, 1277069L, 1277071L, 1277083L, 1277093L,
-1277099L, 1277113L, 1277137L, 1277147L, 1277197L, 1277207L, 1277209L, 1277233L, 1277249L,
-1277257L, 1277267L, 1277299L, 1277321L, 1277323L, 1277357L, 1277359L, 1277369L, 1277387L,
-1277429L, 1277449L, 1277461L, 1277477L, 1277483L, 1277491L, 1277501L, 1277543L, 1277557L,
-1277569L, 1277593L, 1277597L, 1277621L, 1277629L, 1277651L, 1277657L, 1277677L, 1277699L,
-1277723L, 1277729L, 1277741L, 1277743L, 1277753L, 1277761L, 1277791L, 1277803L, 1277813L,
-1277819L, 1277833L, 1277849L, 1277863L, 1277867L, 1277879L, 1277897L, 1277909L, 1277911L,
-1277957L, 1277971L, 1277993L, 1278007L, 1278029L, 1278031L, 1278047L, 1278097L, 1278107L,
-1278113L, 1278131L, 1278139L, 1278163L, 1278181L, 1278191L, 1278197L, 1278203L, 1278209L,
-1278217L, 1278227L, 1278253L, 1278287L, 1278289L, 1278323L, 1278337L, 1278341L, 1278371L,
-1278373L, 1278379L, 1278391L, 1278397L, 1278401L, 1278419L, 1278437L, 1278439L, 1278463L,
-1278467L, 1278479L, 1278481L, 1278493L, 1278527L, 1278551L, 1278583L, 1278601L, 1278611L,
-1278617L, 1278619L, 1278623L, 1278631L, 1278637L, 1278659L, 1278671L, 1278701L, 1278709L,
-1278713L, 1278721L, 1278733L, 1278769L, 1278779L, 1278787L, 1278799L, 1278803L, 1278811L,
-1278817L, 1278839L, 1278857L, 1278881L, 1278899L, 1278911L, 1278983L, 1278997L, 1279001L,
-1279013L, 1279021L, 1279027L, 1279039L, 1279043L, 1279081L, 1279087L, 1279093L, 1279111L,
-1279123L, 1279133L, 1279141L, 1279163L, 1279171L, 1279177L, 1279181L, 1279183L, 1279189L,
-1279193L, 1279211L, 1279249L, 1279253L, 1279303L, 1279307L, 1279309L, 1279319L, 1279321L,
-1279337L, 1279357L, 1279361L, 1279417L, 1279427L, 1279457L, 1279459L, 1279483L, 1279493L,
-1279507L, 1279511L, 1279519L, 1279541L, 1279547L, 1279549L, 1279561L, 1279583L, 1279601L,
-1279609L, 1279627L, 1279643L, 1279657L, 1279661L, 1279667L, 1279673L, 1279679L, 1279687L,
-1279693L, 1279703L, 1279727L, 1279753L, 1279757L, 1279787L, 1279801L, 1279807L, 1279813L,
-1279819L, 1279823L, 1279843L, 1279847L, 1279853L, 1279871L, 1279877L, 1279907L, 1279919L,
-1279921L, 1279931L, 1279937L, 1279961L, 1279969L, 1279997L, 1280023L, 1280101L, 1280107L,
-1280113L, 1280119L, 1280129L, 1280131L, 1280141L, 1280159L, 1280161L, 1280173L, 1280179L,
-1280183L, 1280221L, 1280231L, 1280267L, 1280281L, 1280291L, 1280297L, 1280309L, 1280317L,
-1280333L, 1280371L, 1280399L, 1280401L, 1280407L, 1280417L, 1280431L, 1280453L, 1280473L,
-1280519L, 1280537L, 1280549L, 1280561L, 1280567L, 1280597L, 1280603L, 1280623L, 1280633L,
-1280651L, 1280659L, 1280677L, 1280693L, 1280707L, 1280737L, 1280743L, 1280759L, 1280761L,
-1280767L, 1280789L, 1280791L, 1280803L, 1280821L, 1280833L, 1280837L, 1280857L, 1280863L,
-1280869L, 1280887L, 1280921L, 1280947L, 1280969L, 1280987L, 1280989L, 1281029L, 1281041L,
-1281043L, 1281047L, 1281083L, 1281089L, 1281097L, 1281101L, 1281131L, 1281149L, 1281157L,
-1281167L, 1281187L, 1281193L, 1281211L, 1281221L, 1281229L, 1281253L, 1281257L, 1281263L,
-1281281L, 1281283L, 1281317L, 1281331L, 1281349L, 1281367L, 1281383L, 1281389L, 1281407L,
-1281431L, 1281433L, 1281439L, 1281451L, 1281457L, 1281463L, 1281503L, 1281521L, 1281523L,
-1281541L, 1281547L, 1281551L, 1281563L, 1281587L, 1281649L, 1281653L, 1281667L, 1281673L,
-1281677L, 1281691L, 1281697L, 1281703L, 1281727L, 1281739L, 1281751L, 1281773L, 1281779L,
-1281781L, 1281799L, 1281803L, 1281809L, 1281821L, 1281823L, 1281827L, 1281853L, 1281871L,
-1281883L, 1281899L, 1281937L, 1281941L, 1281961L, 1281971L, 1281979L, 1281983L, 1282007L,
-1282009L, 1282031L, 1282033L, 1282051L, 1282069L, 1282079L, 1282081L, 1282093L, 1282109L,
-1282117L, 1282121L, 1282133L, 1282153L, 1282163L, 1282187L, 1282201L, 1282213L, 1282231L,
-1282241L, 1282261L, 1282277L, 1282279L, 1282289L, 1282297L, 1282343L, 1282349L, 1282363L,
-1282381L, 1282387L, 1282399L, 1282417L, 1282423L, 1282427L, 1282451L, 1282469L, 1282471L,
-1282493L, 1282499L, 1282507L, 1282511L, 1282513L, 1282517L, 1282529L, 1282543L, 1282571L,
-1282577L, 1282597L, 1282607L, 1282613L, 1282627L, 1282637L, 1282639L, 1282649L, 1282657L,
-1282661L, 1282681L, 1282693L, 1282703L, 1282717L, 1282739L, 1282751L, 1282763L, 1282781L,
-1282783L, 1282807L, 1282817L, 1282867L, 1282877L, 1282903L, 1282907L, 1282909L, 1282913L,
-1282933L, 1282943L, 1282951L, 1282961L, 1282969L, 1282993L, 1283011L, 1283017L, 1283021L,
-1283027L, 1283063L, 1283069L, 1283083L, 1283099L, 1283111L, 1283119L, 1283129L, 1283137L,
-1283159L, 1283167L, 1283171L, 1283173L, 1283179L, 1283207L, 1283237L, 1283297L, 1283323L,
-1283333L, 1283339L, 1283353L, 1283383L, 1283389L, 1283417L, 1283437L, 1283441L, 1283473L,
-1283479L, 1283509L, 1283521L, 1283537L, 1283539L, 1283543L, 1283549L, 1283563L, 1283573L,
-1283591L, 1283603L, 1283677L, 1283683L, 1283701L, 1283707L, 1283717L, 1283719L, 1283731L,
-1283753L, 1283759L, 1283767L, 1283771L, 1283797L, 1283831L, 1283839L, 1283873L, 1283879L,
-1283881L, 1283897L, 1283903L, 1283939L, 1283941L, 1283957L, 1283969L, 1283981L, 1283983L,
-1284007L, 1284037L, 1284043L, 1284047L, 1284053L, 1284083L, 1284131L, 1284169L, 1284187L,
-1284209L, 1284211L, 1284223L, 1284263L, 1284271L, 1284287L, 1284293L, 1284301L, 1284313L,
-1284317L, 1284329L, 1284341L, 1284373L, 1284379L, 1284383L, 1284421L, 1284427L, 1284433L,
-1284443L, 1284467L, 1284473L, 1284487L, 1284511L, 1284523L, 1284541L, 1284551L, 1284553L,
-1284559L, 1284583L, 1284601L, 1284617L, 1284623L, 1284631L, 1284641L, 1284659L, 1284691L,
-1284709L, 1284713L, 1284737L, 1284739L, 1284763L, 1284769L, 1284791L, 1284793L, 1284823L,
-1284841L, 1284847L, 1284851L, 1284863L, 1284889L, 1284901L, 1284917L, 1284931L, 1284937L,
-1284967L, 1284971L, 1284977L, 1284991L, 1285021L, 1285049L, 1285051L, 1285057L, 1285061L,
-1285069L, 1285099L, 1285111L, 1285117L, 1285129L, 1285139L, 1285147L, 1285159L, 1285169L,
-1285181L, 1285199L, 1285213L, 1285223L, 1285231L, 1285237L, 1285247L, 1285259L, 1285267L,
-1285279L, 1285283L, 1285289L, 1285301L, 1285351L, 1285381L, 1285393L, 1285397L, 1285411L,
-1285429L, 1285441L, 1285451L, 1285469L, 1285481L, 1285507L, 1285511L, 1285513L, 1285517L,
-1285519L, 1285547L, 1285549L, 1285553L, 1285607L, 1285619L, 1285633L, 1285649L, 1285679L,
-1285699L, 1285703L, 1285717L, 1285741L, 1285747L, 1285759L, 1285763L, 1285777L, 1285789L,
-1285793L, 1285799L, 1285811L, 1285813L, 1285841L, 1285847L, 1285853L, 1285859L, 1285871L,
-1285877L, 1285891L, 1285903L, 1285913L, 1285937L, 1285943L, 1285969L, 1285981L, 1285993L,
-1286011L, 1286017L, 1286039L, 1286071L, 1286081L, 1286093L, 1286099L, 1286107L, 1286119L,
-1286147L, 1286149L, 1286177L, 1286189L, 1286191L, 1286209L, 1286227L, 1286239L, 1286261L,
-1286267L, 1286269L, 1286273L, 1286287L, 1286303L, 1286323L, 1286359L, 1286371L, 1286381L,
-1286387L, 1286399L, 1286419L, 1286447L, 1286489L, 1286491L, 1286503L, 1286513L, 1286521L,
-1286533L, 1286557L, 1286561L, 1286569L, 1286581L, 1286587L, 1286617L, 1286629L, 1286633L,
-1286641L, 1286647L, 1286653L, 1286657L, 1286669L, 1286683L, 1286693L, 1286707L, 1286711L,
-1286773L, 1286777L, 1286783L, 1286797L, 1286807L, 1286819L, 1286821L, 1286833L, 1286837L,
-1286839L, 1286843L, 1286881L, 1286939L, 1286941L, 1286953L, 1286959L, 1286969L, 1286981L,
-1286983L, 1287007L, 1287047L, 1287059L, 1287061L, 1287067L, 1287071L, 1287101L, 1287109L,
-1287131L, 1287133L, 1287157L, 1287163L, 1287173L, 1287179L, 1287197L, 1287199L, 1287217L,
-1287233L, 1287239L, 1287289L, 1287323L, 1287329L, 1287343L, 1287347L, 1287353L, 1287361L,
-1287371L, 1287373L, 1287401L, 1287431L, 1287457L, 1287467L, 1287469L, 1287479L, 1287487L,
-1287491L, 1287499L, 1287511L, 1287541L, 1287551L, 1287553L, 1287569L, 1287589L, 1287593L,
-1287607L, 1287613L, 1287623L, 1287661L, 1287683L, 1287691L, 1287697L, 1287707L, 1287731L,
-1287739L, 1287743L, 1287749L, 1287751L, 1287757L, 1287761L, 1287787L, 1287799L, 1287817L,
-1287821L, 1287829L, 1287841L, 1287857L, 1287883L, 1287887L, 1287899L, 1287917L, 1287947L,
-1287961L, 1287967L, 1287973L, 1287983L, 1287989L, 1287997L, 1288003L, 1288009L, 1288013L,
-1288033L, 1288037L, 1288043L, 1288051L, 1288057L, 1288061L, 1288099L, 1288103L, 1288109L,
-1288117L, 1288163L, 1288169L, 1288171L, 1288187L, 1288193L, 1288201L, 1288213L, 1288247L,
-1288249L, 1288291L, 1288307L, 1288337L, 1288349L, 1288361L, 1288363L, 1288367L, 1288393L,
-1288421L, 1288423L, 1288429L, 1288439L, 1288487L, 1288513L, 1288519L, 1288531L, 1288541L,
-1288543L, 1288559L, 1288571L, 1288597L, 1288603L, 1288607L, 1288613L, 1288643L, 1288649L,
-1288657L, 1288691L, 1288697L, 1288699L, 1288709L, 1288711L, 1288733L, 1288769L, 1288783L,
-1288799L, 1288817L, 1288823L, 1288829L, 1288831L, 1288843L, 1288849L, 1288853L, 1288871L,
-1288873L, 1288877L, 1288891L, 1288919L, 1288921L, 1288933L, 1288939L, 1288951L, 1288967L,
-1288981L, 1288993L, 1288997L, 1289003L, 1289009L, 1289027L, 1289039L, 1289053L, 1289077L,
-1289083L, 1289111L, 1289129L, 1289149L, 1289153L, 1289159L, 1289179L, 1289213L, 1289231L,
-1289237L, 1289261L, 1289273L, 1289287L, 1289303L, 1289329L, 1289333L, 1289341L, 1289363L,
-1289371L, 1289381L, 1289401L, 1289411L, 1289423L, 1289429L, 1289447L, 1289459L, 1289513L,
-1289531L, 1289537L, 1289551L, 1289557L, 1289567L, 1289593L, 1289597L, 1289599L, 1289621L,
-1289623L, 1289627L, 1289653L, 1289657L, 1289677L, 1289711L, 1289713L, 1289731L, 1289747L,
-1289749L, 1289753L, 1289779L, 1289789L, 1289801L, 1289803L, 1289831L, 1289839L, 1289851L,
-1289867L, 1289881L, 1289921L, 1289927L, 1289933L, 1289963L, 1289969L, 1289971L, 1290013L,
-1290019L, 1290031L, 1290049L, 1290077L, 1290083L, 1290109L, 1290131L, 1290143L, 1290151L,
-1290161L, 1290167L, 1290169L, 1290173L, 1290199L, 1290203L, 1290209L, 1290257L, 1290259L,
-1290287L, 1290293L, 1290299L, 1290319L, 1290329L, 1290371L, 1290379L, 1290427L, 1290431L,
-1290433L, 1290439L, 1290463L, 1290467L, 1290469L, 1290491L, 1290503L, 1290533L, 1290539L,
-1290551L, 1290563L, 1290571L, 1290581L, 1290593L, 1290607L, 1290629L, 1290631L, 1290637L,
-1290643L, 1290649L, 1290659L, 1290673L, 1290683L, 1290719L, 1290791L, 1290811L, 1290823L,
-1290847L, 1290853L, 1290857L, 1290869L, 1290901L, 1290907L, 1290923L, 1290937L, 1290983L,
-1291001L, 1291007L, 1291009L, 1291019L, 1291021L, 1291063L, 1291079L, 1291111L, 1291117L,
-1291139L, 1291153L, 1291159L, 1291163L, 1291177L, 1291193L, 1291211L, 1291217L, 1291219L,
-1291223L, 1291229L, 1291249L, 1291271L, 1291313L, 1291321L, 1291327L, 1291343L, 1291349L,
-1291357L, 1291369L, 1291379L, 1291387L, 1291391L, 1291421L, 1291447L, 1291453L, 1291471L,
-1291481L, 1291483L, 1291489L, 1291501L, 1291523L, 1291547L, 1291567L, 1291579L, 1291603L,
-1291637L, 1291669L, 1291673L, 1291691L, 1291783L, 1291793L, 1291799L, 1291817L, 1291819L,
-1291831L, 1291861L, 1291877L, 1291883L, 1291907L, 1291909L, 1291931L, 1291957L, 1291963L,
-1291967L, 1291991L, 1291999L, 1292009L, 1292023L, 1292029L, 1292063L, 1292069L, 1292089L,
-1292099L, 1292113L, 1292131L, 1292141L, 1292143L, 1292149L, 1292167L, 1292177L, 1292219L,
-1292237L, 1292243L, 1292251L, 1292257L, 1292261L, 1292281L, 1292293L, 1292309L, 1292329L,
-1292339L, 1292353L, 1292371L, 1292383L, 1292387L, 1292419L, 1292429L, 1292441L, 1292477L,
-1292491L, 1292503L, 1292509L, 1292539L, 1292549L, 1292563L, 1292567L, 1292579L, 1292587L,
-1292591L, 1292593L, 1292597L, 1292609L, 1292633L, 1292639L, 1292653L, 1292657L, 1292659L,
-1292693L, 1292701L, 1292713L, 1292717L, 1292729L, 1292737L, 1292783L, 1292789L, 1292801L,
-1292813L, 1292831L, 1292843L, 1292857L, 1292887L, 1292927L, 1292947L, 1292953L, 1292957L,
-1292971L, 1292983L, 1292989L, 1292999L, 1293001L, 1293011L, 1293031L, 1293077L, 1293119L,
-1293133L, 1293137L, 1293157L, 1293169L, 1293179L, 1293199L, 1293203L, 1293233L, 1293239L,
-1293247L, 1293251L, 1293277L, 1293283L, 1293287L, 1293307L, 1293317L, 1293319L, 1293323L,
-1293329L, 1293361L, 1293367L, 1293373L, 1293401L, 1293419L, 1293421L, 1293433L, 1293473L,
-1293491L, 1293493L, 1293499L, 1293529L, 1293533L, 1293541L, 1293553L, 1293559L, 1293583L,
-1293587L, 1293613L, 1293619L, 1293647L, 1293659L, 1293701L, 1293739L, 1293757L, 1293763L,
-1293791L, 1293797L, 1293821L, 1293829L, 1293839L, 1293841L, 1293857L, 1293869L, 1293899L,
-1293917L, 1293923L, 1293931L, 1293947L, 1293949L, 1293961L, 1293967L, 1293977L, 1293979L,
-1293983L, 1294019L, 1294021L, 1294031L, 1294037L, 1294039L, 1294061L, 1294081L, 1294087L,
-1294103L, 1294121L, 1294123L, 1294129L, 1294169L, 1294177L, 1294199L, 1294201L, 1294231L,
-1294253L, 1294273L, 1294277L, 1294301L, 1294303L, 1294309L, 1294339L, 1294351L, 1294361L,
-1294367L, 1294369L, 1294393L, 1294399L, 1294453L, 1294459L, 1294471L, 1294477L, 1294483L,
-1294561L, 1294571L, 1294583L, 1294597L, 1294609L, 1294621L, 1294627L, 1294633L, 1294639L,
-1294649L, 1294651L, 1294691L, 1294721L, 1294723L, 1294729L, 1294753L, 1294757L, 1294759L,
-1294817L, 1294823L, 1294841L, 1294849L, 1294939L, 1294957L, 1294967L, 1294973L, 1294987L,
-1294999L, 1295003L, 1295027L, 1295033L, 1295051L, 1295057L, 1295069L, 1295071L, 1295081L,
-1295089L, 1295113L, 1295131L, 1295137L, 1295159L, 1295183L, 1295191L, 1295201L, 1295207L,
-1295219L, 1295221L, 1295243L, 1295263L, 1295279L, 1295293L, 1295297L, 1295299L, 1295309L,
-1295317L, 1295321L, 1295323L, 1295339L, 1295347L, 1295369L, 1295377L, 1295387L, 1295389L,
-1295447L, 1295473L, 1295491L, 1295501L, 1295513L, 1295533L, 1295543L, 1295549L, 1295551L,
-1295561L, 1295563L, 1295603L, 1295611L, 1295617L, 1295639L, 1295647L, 1295653L, 1295681L,
-1295711L, 1295717L, 1295737L, 1295741L, 1295747L, 1295761L, 1295783L, 1295803L, 1295809L,
-1295813L, 1295839L, 1295849L, 1295867L, 1295869L, 1295873L, 1295881L, 1295947L, 1295953L,
-1295989L, 1295993L, 1296007L, 1296011L, 1296019L, 1296023L, 1296037L, 1296041L, 1296059L,
-1296077L, 1296089L, 1296101L, 1296109L, 1296137L, 1296143L, 1296167L, 1296181L, 1296187L,
-1296209L, 1296227L, 1296277L, 1296283L, 1296287L, 1296293L, 1296319L, 1296331L, 1296341L,
-1296343L, 1296371L, 1296391L, 1296409L, 1296413L, 1296419L, 1296467L, 1296473L, 1296481L,
-1296499L, 1296511L, 1296521L, 1296523L, 1296551L, 1296557L, 1296563L, 1296571L, 1296583L,
-1296587L, 1296593L, 1296601L, 1296613L, 1296623L, 1296629L, 1296649L, 1296679L, 1296689L,
-1296703L, 1296721L, 1296727L, 1296749L, 1296781L, 1296787L, 1296803L, 1296817L, 1296829L,
-1296833L, 1296839L, 1296877L, 1296899L, 1296907L, 1296929L, 1296949L, 1296973L, 1296983L,
-1297001L, 1297003L, 1297013L, 1297019L, 1297027L, 1297057L, 1297061L, 1297063L, 1297091L,
-1297103L, 1297123L, 1297129L, 1297139L, 1297147L, 1297157L, 1297169L, 1297171L, 1297193L,
-1297201L, 1297211L, 1297217L, 1297229L, 1297243L, 1297249L, 1297271L, 1297273L, 1297279L,
-1297297L, 1297313L, 1297333L, 1297337L, 1297349L, 1297357L, 1297367L, 1297369L, 1297393L,
-1297397L, 1297399L, 1297403L, 1297411L, 1297421L, 1297447L, 1297451L, 1297459L, 1297477L,
-1297487L, 1297501L, 1297507L, 1297519L, 1297523L, 1297537L, 1297561L, 1297573L, 1297601L,
-1297607L, 1297619L, 1297631L, 1297633L, 1297649L, 1297651L, 1297657L, 1297669L, 1297687L,
-1297693L, 1297727L, 1297739L, 1297771L, 1297781L, 1297799L, 1297841L, 1297847L, 1297853L,
-1297873L, 1297927L, 1297963L, 1297973L, 1297979L, 1297993L, 1298027L, 1298039L, 1298047L,
-1298053L, 1298057L, 1298111L, 1298113L, 1298117L, 1298119L, 1298131L, 1298149L, 1298161L,
-1298173L, 1298191L, 1298197L, 1298221L, 1298261L, 1298279L, 1298291L, 1298309L, 1298317L,
-1298329L, 1298333L, 1298351L, 1298357L, 1298371L, 1298387L, 1298467L, 1298489L, 1298491L,
-1298537L, 1298551L, 1298573L, 1298581L, 1298611L, 1298617L, 1298641L, 1298651L, 1298653L,
-1298699L, 1298719L, 1298723L, 1298747L, 1298771L, 1298779L, 1298789L, 1298797L, 1298809L,
-1298819L, 1298831L, 1298849L, 1298863L, 1298887L, 1298909L, 1298911L, 1298923L, 1298951L,
-1298963L, 1298981L, 1298989L, 1299007L, 1299013L, 1299019L, 1299029L, 1299041L, 1299059L,
-1299061L, 1299079L, 1299097L, 1299101L, 1299143L, 1299169L, 1299173L, 1299187L, 1299203L,
-1299209L, 1299211L, 1299223L, 1299227L, 1299257L, 1299269L, 1299283L, 1299289L, 1299299L,
-1299317L, 1299323L, 1299341L, 1299343L, 1299349L, 1299359L, 1299367L, 1299377L, 1299379L,
-1299437L, 1299439L, 1299449L, 1299451L, 1299457L, 1299491L, 1299499L, 1299533L, 1299541L,
-1299553L, 1299583L, 1299601L, 1299631L, 1299637L, 1299647L, 1299653L, 1299673L, 1299689L,
-1299709L, 1299721L, 1299743L, 1299763L, 1299791L, 1299811L, 1299817L, 1299821L, 1299827L
-};
+// The first NR_OF_PRIMES_L primes, generated using a prime sieve on first use
+const long int *get_primes_l();
+#define PRIMES_L (get_primes_l())
 
 #define PRIME_M_COUNT 10000
 
@@ -22,6 +22,7 @@
 #include <vector>
 #include <list>
 #include <algorithm>
+#include <thread>
 #ifdef HAVE_LIBREADLINE
 #	include <readline/readline.h>
 #	include <readline/history.h>
@@ -424,6 +425,7 @@ void update_option_list() {
 		ADD_OPTION_TO_LIST3("scientific notation", "exp", "exp mode")
 		ADD_OPTION_TO_LIST("exp display", "edisp")
 		ADD_OPTION_TO_LIST("precision", "prec")
+		ADD_OPTION_TO_LIST("calculation cache", "cache")
 		ADD_OPTION_TO_LIST("interval display", "ivdisp")
 		ADD_OPTION_TO_LIST3("interval arithmetic", "ia", "interval")
 		ADD_OPTION_TO_LIST("variable units", "varunits")
@@ -849,6 +851,21 @@ int enable_unicode = -1;
 
 bool result_autocalculated = false;
 
+// used by the concurrent test file command: calculates the expression repeatedly in a separate calculation context
+void concurrent_calculation(const string *expression, string *result) {
+	CALCULATOR->beginThreadContext();
+	for(size_t i = 0; i < 20; i++) {
+		string str = CALCULATOR->calculateAndPrint(*expression, 0, evalops, printops);
+		if(i == 0) {
+			*result = str;
+		} else if(str != *result) {
+			*result = "mismatch: " + *result + ", " + str;
+			break;
+		}
+	}
+	CALCULATOR->endThreadContext();
+}
+
 void handle_exit() {
 	CALCULATOR->abort();
 	if(enable_unicode >= 0) {
@@ -2177,6 +2194,16 @@ void set_option(string str) {
 			}
 			expression_calculation_updated();
 		}
+	} else if(EQUALS_IGNORECASE_AND_LOCAL(svar, "calculation cache", _("calculation cache")) || svar == "cache") {
+		long int v = -1;
+		if(EQUALS_IGNORECASE_AND_LOCAL(svalue, "off", _("off"))) v = 0;
+		else if(!empty_value && svalue.find_first_not_of(SPACES NUMBERS) == string::npos) v = s2i(svalue);
+		if(v < 0) {
+			PUTS_UNICODE(_("Illegal value."));
+		} else {
+			CALCULATOR->setEvaluationCacheSize(v);
+			CALCULATOR->setParseCacheSize(v);
+		}
 	} else if(EQUALS_IGNORECASE_AND_LOCAL(svar, "interval display", _("interval display")) || svar == "ivdisp") {
 		int v = -1;
 		//interval display mode
@@ -2543,6 +2570,17 @@ bool show_set_help(string set_option = "") {
 		str += "(> 0) "; str += i2s(CALCULATOR->getPrecision()); str += "*"; CHECK_IF_SCREEN_FILLED_PUTS(str.c_str());
 		SET_OPTION_FOUND
 	}
+	if(SET_OPTION_MATCHES("calculation cache", "cache")) {
+		STR_AND_TABS_SET("calculation cache", "cache");
+		SET_DESCRIPTION(_("Maximum number of parsed expressions and calculation results that are kept for reuse."));
+		str += "(0";
+		if(CALCULATOR->evaluationCacheSize() == 0) str += "*";
+		str += " = "; str += _("off");
+		str += ", > 0)";
+		if(CALCULATOR->evaluationCacheSize() > 0) {str += " "; str += i2s(CALCULATOR->evaluationCacheSize()); str += "*";}
+		CHECK_IF_SCREEN_FILLED_PUTS(str.c_str());
+		SET_OPTION_FOUND
+	}
 
 	CHECK_IF_SCREEN_FILLED_HEADING_S(_("Enabled Objects"));
 
@@ -5394,6 +5432,21 @@ int main(int argc, char *argv[]) {
 					PUTS_UNICODE(_("No user-defined variable or function with the specified name exist."));
 				}
 			}
+		//test file command: calculates the expression simultaneously in four threads and sets the result to the common result of all calculations
+		} else if(unittest && scom == "concurrent") {
+			str = str.substr(ispace + 1, slen - (ispace + 1));
+			remove_blank_ends(str);
+			vector<string> results(4);
+			vector<std::thread> threads;
+			for(size_t i = 0; i < results.size(); i++) threads.push_back(std::thread(concurrent_calculation, &str, &results[i]));
+			for(size_t i = 0; i < threads.size(); i++) threads[i].join();
+			result_text = results[0];
+			for(size_t i = 1; i < results.size(); i++) {
+				if(results[i] != result_text) {
+					result_text = "mismatch: " + result_text + ", " + results[i];
+					break;
+				}
+			}
 		//qalc command
 		} else if(EQUALS_IGNORECASE_AND_LOCAL(scom, "keep", _("keep")) || EQUALS_IGNORECASE_AND_LOCAL(scom, "unkeep", _("unkeep"))) {
 			bool unkeep = EQUALS_IGNORECASE_AND_LOCAL(scom, "unkeep", _("unkeep"));
@@ -6300,6 +6353,7 @@ int main(int argc, char *argv[]) {
 			}
 			CHECK_IF_SCREEN_FILLED_PUTS(str.c_str())
 			PRINT_AND_COLON_TABS(_("precision"), "prec") str += i2s(CALCULATOR->getPrecision()); CHECK_IF_SCREEN_FILLED_PUTS(str.c_str())
+			PRINT_AND_COLON_TABS(_("calculation cache"), "cache") if(CALCULATOR->evaluationCacheSize() == 0) {str += _("off");} else {str += i2s(CALCULATOR->evaluationCacheSize());} CHECK_IF_SCREEN_FILLED_PUTS(str.c_str())
 
 			CHECK_IF_SCREEN_FILLED_HEADING(_("Enabled Objects"));
 